@@ -11,6 +11,9 @@ CONFIG -= app_bundle
 
 CONFIG += c++11
 
+# Remove packet and MMM node traces from the binary
+no_trace_logs: DEFINES += MC_NO_TRACE_LOGS
+
 INCLUDEPATH += $$PWD/src $$PWD/src/MessageProtocol $$PWD/src/Mooltipass $$PWD/src/Settings
 
 win32 {
@@ -59,6 +62,7 @@ SOURCES += src/main_daemon.cpp \
     src/MPDevice.cpp \
     src/MPManager.cpp \
     src/Common.cpp \
+    src/AsyncLogger.cpp \
     src/WSServer.cpp \
     src/AppDaemon.cpp \
     src/AsyncJobs.cpp \
@@ -73,21 +77,31 @@ SOURCES += src/main_daemon.cpp \
     src/FilesCache.cpp \
     src/SimpleCrypt/SimpleCrypt.cpp \
     src/ParseDomain.cpp \
+    src/PublicSuffixList.cpp \
     src/MessageProtocol/MessageProtocolMini.cpp \
     src/MessageProtocol/MessageProtocolBLE.cpp \
     src/MPDeviceBleImpl.cpp \
     src/HaveIBeenPwned.cpp \
+    src/HibpOfflineIndex.cpp \
+    src/SettingsCache.cpp \
     src/Mooltipass/MPNodeMini.cpp \
     src/Mooltipass/MPNodeBLE.cpp \
     src/Mooltipass/MPSettingsMini.cpp \
     src/Mooltipass/MPSettingsBLE.cpp \
+    src/Mooltipass/MPSettingsBatcher.cpp \
     src/Settings/DeviceSettings.cpp \
     src/Settings/DeviceSettingsMini.cpp \
     src/Settings/DeviceSettingsBLE.cpp \
-    src/Mooltipass/MPBLEFreeAddressProvider.cpp
+    src/Mooltipass/MPBLEFreeAddressProvider.cpp \
+    src/Mooltipass/MPNodeIndex.cpp \
+    src/Mooltipass/MPFlashPlacement.cpp \
+    src/Mooltipass/MPServiceIndex.cpp \
+    src/Mooltipass/MPSaveJournal.cpp \
+    src/Mooltipass/MPNodeGraphChecker.cpp
 
 HEADERS  += \
     src/Common.h \
+    src/AsyncLogger.h \
     src/MPDevice.h \
     src/MPManager.h \
     src/MooltipassCmds.h \
@@ -106,20 +120,31 @@ HEADERS  += \
     src/FilesCache.h \
     src/SimpleCrypt/SimpleCrypt.h \
     src/ParseDomain.h \
+    src/PublicSuffixList.h \
+    src/publicsuffix/psl-data.h \
     src/MessageProtocol/IMessageProtocol.h \
     src/MessageProtocol/MessageProtocolMini.h \
     src/MessageProtocol/MessageProtocolBLE.h \
     src/MPDeviceBleImpl.h \
     src/HaveIBeenPwned.h \
+    src/HibpOfflineIndex.h \
+    src/SettingsCache.h \
     src/BleCommon.h \
     src/Mooltipass/MPNodeMini.h \
     src/Mooltipass/MPNodeBLE.h \
     src/Mooltipass/MPSettingsMini.h \
     src/Mooltipass/MPSettingsBLE.h \
+    src/Mooltipass/MPSettingsBatcher.h \
     src/Settings/DeviceSettings.h \
     src/Settings/DeviceSettingsMini.h \
     src/Settings/DeviceSettingsBLE.h \
-    src/Mooltipass/MPBLEFreeAddressProvider.h
+    src/Mooltipass/MPBLEFreeAddressProvider.h \
+    src/Mooltipass/MPNodeIndex.h \
+    src/Mooltipass/MPFlashPlacement.h \
+    src/Mooltipass/MPServiceIndex.h \
+    src/Mooltipass/MPSaveJournal.h \
+    src/Mooltipass/MPNodeGraphChecker.h \
+    src/RequestCoalescer.h
 
 DISTFILES += \
     src/http-parser/CONTRIBUTIONS \
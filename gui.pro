@@ -24,8 +24,11 @@ include (src/qtcsv/qtcsv.pri)
 
 SOURCES += src/main_gui.cpp \
     src/MainWindow.cpp \
+    src/CsvImporter.cpp \
     src/ParseDomain.cpp \
+    src/PublicSuffixList.cpp \
     src/Common.cpp \
+    src/AsyncLogger.cpp \
     src/WSClient.cpp \
     src/RotateSpinner.cpp \
     src/AppGui.cpp \
@@ -35,6 +38,7 @@ SOURCES += src/main_gui.cpp \
     src/OutputLog.cpp \
     src/AnsiEscapeCodeHandler.cpp \
     src/PasswordLineEdit.cpp \
+    src/PasswordStrengthEvaluator.cpp \
     src/CredentialsManagement.cpp \
     src/zxcvbn-c/zxcvbn.c \
     src/FilesManagement.cpp \
@@ -42,6 +46,7 @@ SOURCES += src/main_gui.cpp \
     src/CredentialView.cpp \
     src/CredentialModel.cpp \
     src/CredentialModelFilter.cpp \
+    src/CredentialSearchIndex.cpp \
     src/ItemDelegate.cpp \
     src/LoginItem.cpp \
     src/TreeItem.cpp \
@@ -71,8 +76,12 @@ SOURCES += src/main_gui.cpp \
     src/DeviceDetector.cpp
 
 HEADERS  += src/MainWindow.h \
+    src/CsvImporter.h \
     src/ParseDomain.h \
+    src/PublicSuffixList.h \
+    src/publicsuffix/psl-data.h \
     src/Common.h \
+    src/AsyncLogger.h \
     src/QtHelper.h \
     src/WSClient.h \
     src/RotateSpinner.h \
@@ -84,6 +93,7 @@ HEADERS  += src/MainWindow.h \
     src/OutputLog.h \
     src/AnsiEscapeCodeHandler.h \
     src/PasswordLineEdit.h \
+    src/PasswordStrengthEvaluator.h \
     src/CredentialsManagement.h \
     src/zxcvbn-c/dict-src.h \
     src/zxcvbn-c/zxcvbn.h \
@@ -97,6 +107,7 @@ HEADERS  += src/MainWindow.h \
     src/ItemDelegate.h \
     src/CredentialModel.h \
     src/CredentialModelFilter.h \
+    src/CredentialSearchIndex.h \
     src/AnimatedColorButton.h \
     src/PasswordProfilesModel.h \
     src/PassGenerationProfilesDialog.h \
@@ -57,6 +57,8 @@ public:
     AnsiEscapeCodeHandler();
     QList<FormattedText> parseText(const FormattedText &input);
     void endFormatScope();
+    // No open format scope and no partial escape sequence
+    bool isIdle() const { return m_previousFormatClosed && m_pendingText.isEmpty(); }
 
 private:
     void setFormatScope(const QTextCharFormat &charFormat);
@@ -135,7 +135,11 @@ bool AppDaemon::initialize()
     }
 
     if (parser.isSet(debugDevOption))
+    {
         debugDevEnabled = true;
+        QLoggingCategory::setFilterRules(QStringLiteral("moolticute.packet.debug=true\n"
+                                                        "moolticute.mmm.debug=true"));
+    }
 
     //Install and start mp manager instance and ws server
     if (!WSServer::Instance()->initialize())
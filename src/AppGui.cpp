@@ -72,6 +72,11 @@ bool AppGui::initialize()
             win->daemonLogAppend(logBuffer);
             logBuffer.clear();
         }
+        else if (logBuffer.size() > MAX_PENDING_LOG_SIZE)
+        {
+            //Main window is not there yet, keep only the latest logs
+            logBuffer = logBuffer.right(MAX_PENDING_LOG_SIZE);
+        }
     });
 
     qInfo() << "------------------------------------";
@@ -619,6 +624,10 @@ void AppGui::daemonLogRead()
             win->daemonLogAppend(logBuffer);
             logBuffer.clear();
         }
+        else if (logBuffer.size() > MAX_PENDING_LOG_SIZE)
+        {
+            logBuffer = logBuffer.right(MAX_PENDING_LOG_SIZE);
+        }
         //qDebug() << QString::fromUtf8(out);
     }
 }
@@ -98,6 +98,7 @@ private:
 
      //Buffer for storing log from daemon when mainwindow is not created
      QByteArray logBuffer;
+     static const int MAX_PENDING_LOG_SIZE = 100 * 1024;
 
      Common::MPStatus m_lastNotificationStatus;
 
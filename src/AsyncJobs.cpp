@@ -110,12 +110,32 @@ void AsyncJobs::dequeueStartJob(const QByteArray &data)
         return;
     }
 
+    if (interruptible && yieldCheck && yieldCheck())
+    {
+        //let the scheduler run more urgent work first
+        paused = true;
+        pausedData = data;
+        emit yielded();
+        return;
+    }
+
     currentJob = jobs.dequeue();
     connect(currentJob, SIGNAL(done(QByteArray)), this, SLOT(jobDone(QByteArray)));
     connect(currentJob, SIGNAL(error()), this, SLOT(jobFailed()));
     currentJob->start(data);
 }
 
+void AsyncJobs::resume()
+{
+    if (!paused) return;
+    paused = false;
+
+    qDebug() << "Resuming:" << log;
+    QByteArray data = pausedData;
+    pausedData.clear();
+    dequeueStartJob(data);
+}
+
 void AsyncJobs::jobFailed()
 {
     disconnect(currentJob, SIGNAL(done(QByteArray)), this, SLOT(jobDone(QByteArray)));
@@ -136,3 +156,86 @@ void AsyncJobs::setCurrentJobError(QString err)
     if (currentJob)
         currentJob->setErrorStr(err);
 }
+
+void AsyncJobs::cancel(const QString &err)
+{
+    //Failed handlers read the error from the job they get
+    AsyncJob *job = jobs.isEmpty()? currentJob : jobs.head();
+    if (job)
+        job->setErrorStr(err);
+    emit failed(job);
+    deleteLater();
+}
+
+void AsyncJobsQueue::enqueue(AsyncJobs *jobs)
+{
+    jobs->markEnqueued();
+    queue.append(jobs);
+}
+
+int AsyncJobsQueue::effectivePriority(const AsyncJobs *jobs) const
+{
+    const int promotion = static_cast<int>(jobs->getWaitTime() / AGING_INTERVAL_MS);
+    return qMax(static_cast<int>(AsyncJobs::PriorityInteractive), jobs->getPriority() - promotion);
+}
+
+AsyncJobs *AsyncJobsQueue::dequeue(bool afterYield)
+{
+    if (queue.isEmpty())
+        return nullptr;
+
+    //An aged job must not take the slot given up for more urgent work
+    const auto priorityOf = [this, afterYield](const AsyncJobs *jobs)
+    {
+        return afterYield? static_cast<int>(jobs->getPriority()) : effectivePriority(jobs);
+    };
+
+    //First one of the most urgent class, keeps FIFO order inside a class
+    int bestIdx = 0;
+    int bestPriority = priorityOf(queue.first());
+    for (int i = 1; i < queue.size() && bestPriority > AsyncJobs::PriorityInteractive; i++)
+    {
+        const int p = priorityOf(queue.at(i));
+        if (p < bestPriority)
+        {
+            bestPriority = p;
+            bestIdx = i;
+        }
+    }
+
+    AsyncJobs *jobs = queue.takeAt(bestIdx);
+
+    WaitStats &st = stats[jobs->getPriority()];
+    const qint64 waited = jobs->getWaitTime();
+    st.count++;
+    st.totalMs += waited;
+    st.maxMs = qMax(st.maxMs, waited);
+
+    return jobs;
+}
+
+bool AsyncJobsQueue::hasInteractiveWaiting() const
+{
+    for (const AsyncJobs *jobs: queue)
+    {
+        if (jobs->getPriority() == AsyncJobs::PriorityInteractive)
+            return true;
+    }
+    return false;
+}
+
+QJsonObject AsyncJobsQueue::getStats() const
+{
+    static const char *names[AsyncJobs::PRIORITY_COUNT] = { "interactive", "normal", "background", "bulk" };
+
+    QJsonObject o;
+    for (int i = 0; i < AsyncJobs::PRIORITY_COUNT; i++)
+    {
+        const WaitStats &st = stats[i];
+        o[names[i]] = QJsonObject{{ "count", static_cast<qint64>(st.count) },
+                                  { "avg_wait_ms", st.count? st.totalMs / static_cast<qint64>(st.count) : 0 },
+                                  { "max_wait_ms", st.maxMs }};
+    }
+    o["waiting"] = queue.size();
+    return o;
+}
@@ -25,6 +25,7 @@
 #include <QQueue>
 #include <functional>
 #include <QTimer>
+#include <QElapsedTimer>
 #include "Common.h"
 
 /*
@@ -42,6 +43,10 @@
  * AsyncJobs queue support adding more jobs to the queue dynamically (even from the callback from
  * one running job). This is useful to add jobs to the queue that are different based on the result
  * of the data received from the device.
+ *
+ * Each AsyncJobs has a priority used by the device scheduler (AsyncJobsQueue) to pick the next
+ * AsyncJobs to run. An AsyncJobs marked as interruptible can also yield between two of its jobs
+ * so that more urgent AsyncJobs are run before it continues.
  */
 
 using AsyncFunc = std::function<bool(const QByteArray &prev_data, QByteArray &data_to_send)>;
@@ -158,6 +163,7 @@ public:
 
     void setReturnCheck(bool enable) { checkReturn = enable; }
     void setTimeout(int t) { timeout = t; }
+    quint8 getCmd() const { return cmd; }
 
 public slots:
     virtual void start(const QByteArray &previous_data);
@@ -190,6 +196,29 @@ public:
     AsyncJobs(QString log = QString(), QString jid = QString(), QObject *parent = nullptr);
     virtual ~AsyncJobs();
 
+    enum Priority
+    {
+        PriorityInteractive = 0, //user is waiting for it (credential fill, ...)
+        PriorityNormal,
+        PriorityBackground,      //cache refresh, parameters loading
+        PriorityBulk,            //long memory management work
+    };
+    static constexpr int PRIORITY_COUNT = PriorityBulk + 1;
+
+    void setPriority(Priority p) { priority = p; }
+    Priority getPriority() const { return priority; }
+
+    //Only set this when the device state allows other commands
+    //to be sent between two jobs of this queue (not in MMM)
+    void setInterruptible(bool enable) { interruptible = enable; }
+    bool isInterruptible() const { return interruptible; }
+    void setYieldCheck(std::function<bool()> fn) { yieldCheck = std::move(fn); }
+    void resume();
+
+    //Time spent in the scheduler queue
+    void markEnqueued() { waitTimer.start(); }
+    qint64 getWaitTime() const { return waitTimer.isValid()? waitTimer.elapsed() : 0; }
+
     void append(AsyncJob *j);
     void prepend(AsyncJob *j);
     void insertAfter(AsyncJob *j, int pos);
@@ -200,6 +229,8 @@ public:
     QVariant user_data;
 
     void setCurrentJobError(QString err);
+    //Drop a queue which was never started, failed() is emitted with err
+    void cancel(const QString &err);
 
 public slots:
     void start();
@@ -207,6 +238,8 @@ public slots:
 signals:
     void finished(const QByteArray &data);
     void failed(AsyncJob *job);
+    //queue has been paused between two jobs, call resume() to continue
+    void yielded();
 
 private slots:
     void dequeueStartJob(const QByteArray &data);
@@ -220,6 +253,54 @@ private:
 
     QString jobsid;
     QString log;
+
+    Priority priority = PriorityNormal;
+    bool interruptible = false;
+    bool paused = false;
+    QByteArray pausedData;
+    std::function<bool()> yieldCheck;
+    QElapsedTimer waitTimer;
+};
+
+/*
+ * Scheduler queue of AsyncJobs for a device.
+ * AsyncJobs are dequeued by priority then in FIFO order. A waiting AsyncJobs
+ * is promoted one priority class for each AGING_INTERVAL_MS it waited,
+ * so background work cannot starve. When an AsyncJobs yielded, the device
+ * goes to the most urgent class waiting, aging only orders jobs of a class.
+ */
+class AsyncJobsQueue
+{
+public:
+    void enqueue(AsyncJobs *jobs);
+    AsyncJobs *dequeue(bool afterYield = false);
+    bool isEmpty() const { return queue.isEmpty(); }
+    int removeAll(AsyncJobs *jobs) { return queue.removeAll(jobs); }
+
+    //true if an interactive AsyncJobs is waiting. Aging is not taken into
+    //account here as only interactive work may preempt an AsyncJobs
+    bool hasInteractiveWaiting() const;
+
+    QList<AsyncJobs *>::const_iterator begin() const { return queue.begin(); }
+    QList<AsyncJobs *>::const_iterator end() const { return queue.end(); }
+
+    //Queue wait times per priority class
+    QJsonObject getStats() const;
+
+    static constexpr int AGING_INTERVAL_MS = 2000;
+
+private:
+    int effectivePriority(const AsyncJobs *jobs) const;
+
+    QList<AsyncJobs *> queue;
+
+    struct WaitStats
+    {
+        quint64 count = 0;
+        qint64 totalMs = 0;
+        qint64 maxMs = 0;
+    };
+    WaitStats stats[AsyncJobs::PRIORITY_COUNT];
 };
 
 #endif // ASYNCJOBS_H
@@ -0,0 +1,210 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "AsyncLogger.h"
+#include "Common.h"
+#include "version.h"
+#include <QDateTime>
+#include <stdio.h>
+
+#ifdef Q_OS_WIN_DISABLE_FOR_NOW
+#define COLOR_LIGHTRED
+#define COLOR_RED
+#define COLOR_LIGHTBLUE
+#define COLOR_BLUE
+#define COLOR_GREEN
+#define COLOR_YELLOW
+#define COLOR_ORANGE
+#define COLOR_WHITE
+#define COLOR_LIGHTCYAN
+#define COLOR_CYAN
+#define COLOR_RESET
+#define COLOR_HIGH
+#else
+#define COLOR_LIGHTRED  "\033[31;1m"
+#define COLOR_RED       "\033[31m"
+#define COLOR_LIGHTBLUE "\033[34;1m"
+#define COLOR_BLUE      "\033[34m"
+#define COLOR_GREEN     "\033[32;1m"
+#define COLOR_YELLOW    "\033[33;1m"
+#define COLOR_ORANGE    "\033[0;33m"
+#define COLOR_WHITE     "\033[37;1m"
+#define COLOR_LIGHTCYAN "\033[36;1m"
+#define COLOR_CYAN      "\033[36m"
+#define COLOR_RESET     "\033[0m"
+#define COLOR_HIGH      "\033[1m"
+#endif
+
+AsyncLogger::AsyncLogger(QObject *parent):
+    QThread(parent),
+    m_ring(RING_SIZE)
+{
+}
+
+AsyncLogger *AsyncLogger::instance()
+{
+    static AsyncLogger *logger = new AsyncLogger();
+    return logger;
+}
+
+void AsyncLogger::startLogging()
+{
+    if (m_logging)
+        return;
+
+    m_stopping = false;
+    m_logging = true;
+    start(QThread::LowPriority);
+}
+
+void AsyncLogger::stopLogging()
+{
+    if (!m_logging || QThread::currentThread() == this)
+        return;
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_stopping = true;
+        m_cond.wakeOne();
+    }
+    wait();
+    m_logging = false;
+}
+
+bool AsyncLogger::push(QtMsgType type, const QMessageLogContext &context, const QString &msg)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_logging || m_stopping)
+        return false;
+
+    int idx = (m_head + m_count) % RING_SIZE;
+    if (m_count == RING_SIZE)
+    {
+        //Ring is full, overwrite the oldest message
+        m_head = (m_head + 1) % RING_SIZE;
+        m_dropped++;
+    }
+    else
+    {
+        m_count++;
+    }
+
+    Entry &e = m_ring[idx];
+    e.type = type;
+    e.timestamp = QDateTime::currentMSecsSinceEpoch();
+    e.file = context.file;
+    e.line = context.line;
+    e.msg = msg;
+
+    m_cond.wakeOne();
+    return true;
+}
+
+bool AsyncLogger::isGuiMessage(QtMsgType type)
+{
+    //In release, do not display qDebug messages from GUI
+    return QStringLiteral(APP_VERSION) == "git" || type != QtDebugMsg;
+}
+
+QByteArray AsyncLogger::formatMessage(QtMsgType type, qint64 timestamp, const char *file, int line, const QString &msg)
+{
+    QString fname = file;
+    fname = fname.section('\\', -1, -1);
+
+    QByteArray s;
+    s.reserve(msg.size() + fname.size() + 64);
+    switch (type) {
+    default:
+    case QtDebugMsg: s += COLOR_CYAN "DEBUG" COLOR_RESET; break;
+    case QtInfoMsg: s += COLOR_GREEN "INFO" COLOR_RESET; break;
+    case QtWarningMsg: s += COLOR_YELLOW "WARNING" COLOR_RESET; break;
+    case QtCriticalMsg: s += COLOR_ORANGE "CRITICAL" COLOR_RESET; break;
+    case QtFatalMsg: s += COLOR_RED "FATAL" COLOR_RESET; break;
+    }
+    s += ": (";
+    s += QDateTime::fromMSecsSinceEpoch(timestamp).toString(Common::ISODateWithMsFormat).toUtf8();
+    s += ") ";
+    s += fname.toUtf8();
+    s += ':';
+    s += QByteArray::number(line);
+    s += " - ";
+    s += msg.toUtf8();
+    s += '\n';
+    return s;
+}
+
+void AsyncLogger::run()
+{
+    QVector<Entry> batch;
+    batch.reserve(MAX_BATCH);
+
+    forever
+    {
+        quint32 dropped = 0;
+        bool stopping = false;
+        {
+            QMutexLocker locker(&m_mutex);
+            while (m_count == 0 && !m_stopping)
+            {
+                m_cond.wait(&m_mutex);
+            }
+
+            while (m_count > 0 && batch.size() < MAX_BATCH)
+            {
+                batch.append(std::move(m_ring[m_head]));
+                m_ring[m_head].msg.clear();
+                m_head = (m_head + 1) % RING_SIZE;
+                m_count--;
+            }
+            dropped = m_dropped;
+            m_dropped = 0;
+            stopping = m_stopping && m_count == 0;
+        }
+
+        QByteArray lines, guiLines;
+        if (dropped > 0)
+        {
+            lines = formatMessage(QtWarningMsg, QDateTime::currentMSecsSinceEpoch(), __FILE__, __LINE__,
+                                  QStringLiteral("Logger overflow, %1 messages dropped").arg(dropped));
+            guiLines = lines;
+        }
+
+        for (const Entry &e: batch)
+        {
+            const QByteArray line = formatMessage(e.type, e.timestamp, e.file, e.line, e.msg);
+            lines += line;
+            if (isGuiMessage(e.type))
+            {
+                guiLines += line;
+            }
+        }
+        batch.clear();
+
+        if (!lines.isEmpty())
+        {
+            fwrite(lines.constData(), 1, static_cast<size_t>(lines.size()), stdout);
+            fflush(stdout);
+            emit linesReady(lines, guiLines);
+        }
+
+        if (stopping)
+        {
+            break;
+        }
+    }
+}
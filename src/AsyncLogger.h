@@ -0,0 +1,86 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef ASYNCLOGGER_H
+#define ASYNCLOGGER_H
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QVector>
+
+/* Background writer for the Qt message handler.
+ * The calling thread only stores the raw message in a bounded ring,
+ * formatting and the blocking stdout write happen in the logger thread.
+ * Formatted lines are then handed to the main thread with linesReady()
+ * for the gui and local socket sinks.
+ * When the ring is full the oldest messages are dropped and a note is
+ * written in the log.
+ */
+class AsyncLogger: public QThread
+{
+    Q_OBJECT
+
+public:
+    static AsyncLogger *instance();
+
+    //Start the writer thread
+    void startLogging();
+    //Write every queued message and stop the writer thread
+    void stopLogging();
+    bool isLogging() const { return m_logging; }
+
+    //Queue a message, returns false if the logger is not running
+    bool push(QtMsgType type, const QMessageLogContext &context, const QString &msg);
+
+    static QByteArray formatMessage(QtMsgType type, qint64 timestamp, const char *file, int line, const QString &msg);
+    //Messages also forwarded to the gui log
+    static bool isGuiMessage(QtMsgType type);
+
+signals:
+    void linesReady(const QByteArray &lines, const QByteArray &guiLines);
+
+protected:
+    void run() override;
+
+private:
+    explicit AsyncLogger(QObject *parent = nullptr);
+
+    struct Entry
+    {
+        QtMsgType type = QtDebugMsg;
+        qint64 timestamp = 0;
+        const char *file = nullptr;
+        int line = 0;
+        QString msg;
+    };
+
+    static constexpr int RING_SIZE = 8192;
+    static constexpr int MAX_BATCH = 512;
+
+    QMutex m_mutex;
+    QWaitCondition m_cond;
+    QVector<Entry> m_ring;
+    int m_head = 0;
+    int m_count = 0;
+    quint32 m_dropped = 0;
+    bool m_stopping = false;
+    volatile bool m_logging = false;
+};
+
+#endif // ASYNCLOGGER_H
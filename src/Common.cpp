@@ -21,6 +21,7 @@
 #include <QLocalSocket>
 #include <time.h>
 #include "version.h"
+#include "AsyncLogger.h"
 #include <chrono>
 
 #ifndef Q_OS_WIN
@@ -35,34 +36,6 @@
 #include <qt_windows.h>
 #endif
 
-#ifdef Q_OS_WIN_DISABLE_FOR_NOW
-#define COLOR_LIGHTRED
-#define COLOR_RED
-#define COLOR_LIGHTBLUE
-#define COLOR_BLUE
-#define COLOR_GREEN
-#define COLOR_YELLOW
-#define COLOR_ORANGE
-#define COLOR_WHITE
-#define COLOR_LIGHTCYAN
-#define COLOR_CYAN
-#define COLOR_RESET
-#define COLOR_HIGH
-#else
-#define COLOR_LIGHTRED  "\033[31;1m"
-#define COLOR_RED       "\033[31m"
-#define COLOR_LIGHTBLUE "\033[34;1m"
-#define COLOR_BLUE      "\033[34m"
-#define COLOR_GREEN     "\033[32;1m"
-#define COLOR_YELLOW    "\033[33;1m"
-#define COLOR_ORANGE    "\033[0;33m"
-#define COLOR_WHITE     "\033[37;1m"
-#define COLOR_LIGHTCYAN "\033[36;1m"
-#define COLOR_CYAN      "\033[36m"
-#define COLOR_RESET     "\033[0m"
-#define COLOR_HIGH      "\033[1m"
-#endif
-
 QHash<Common::MPStatus, QString> Common::MPStatusUserString = {
     { Common::UnknownStatus, QObject::tr("Unknown status") },
     { Common::NoCardInserted, QObject::tr("No card inserted") },
@@ -121,67 +94,113 @@ const QString Common::ISODateWithMsFormat = "yyyy-MM-ddTHH:mm:ss.zzz";
 const QString Common::SIMPLE_CRYPT = "SimpleCrypt";
 const QString Common::SIMPLE_CRYPT_V2 = "SimpleCryptV2";
 
-static void _messageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg)
+//Logs kept until the first log client connects
+static const int STARTING_BUFFER_MAX_SIZE = 512 * 1024;
+//A slow log client is skipped when this much data is not written yet
+static const qint64 LOG_SOCKET_MAX_PENDING = 1024 * 1024;
+//Maximum log bytes sent to each sink per second
+static const qint64 LOG_SINK_MAX_BYTES_PER_SEC = 256 * 1024;
+
+class LogSinkLimiter
 {
-    QString fname = context.file;
-    fname = fname.section('\\', -1, -1);
-    const auto timestamp = QDateTime::currentDateTime().toString(Common::ISODateWithMsFormat);
-    QString s;
-    switch (type) {
-    default:
-    case QtDebugMsg:
+public:
+    bool allow(qint64 size)
     {
-        s = QString(COLOR_CYAN "DEBUG" COLOR_RESET ": (%0) %1:%2 - %3\n").arg(timestamp).arg(fname).arg(context.line).arg(msg);
-        break;
+        if (!window.isValid() || window.hasExpired(1000))
+        {
+            window.start();
+            bytes = 0;
+        }
+        if (bytes + size > LOG_SINK_MAX_BYTES_PER_SEC)
+        {
+            dropped += size;
+            return false;
+        }
+        bytes += size;
+        return true;
     }
-    case QtInfoMsg:
+
+    //Data dropped for another reason than the rate limit
+    void drop(qint64 size)
     {
-        s = QString(COLOR_GREEN "INFO" COLOR_RESET ": (%0) %1:%2 - %3\n").arg(timestamp).arg(fname).arg(context.line).arg(msg);
-        break;
+        dropped += size;
     }
-    case QtWarningMsg:
+
+    //Note to write in the sink once data goes through again
+    QByteArray takeDroppedNote()
     {
-        s = QString(COLOR_YELLOW "WARNING" COLOR_RESET ": (%0) %1:%2 - %3\n").arg(timestamp).arg(fname).arg(context.line).arg(msg);
-        break;
+        if (dropped == 0)
+            return QByteArray();
+        QByteArray note = AsyncLogger::formatMessage(QtWarningMsg, QDateTime::currentMSecsSinceEpoch(), __FILE__, __LINE__,
+                                                     QStringLiteral("Log rate limit reached, %1 bytes dropped").arg(dropped));
+        dropped = 0;
+        return note;
     }
-    case QtCriticalMsg:
+
+private:
+    QElapsedTimer window;
+    qint64 bytes = 0;
+    qint64 dropped = 0;
+};
+
+static LogSinkLimiter guiLogLimiter;
+static QHash<QLocalSocket *, LogSinkLimiter> debugLogLimiters;
+
+static void _appendStartingBuffer(const QByteArray &lines)
+{
+    startingDaemonBuffer.append(lines);
+    if (startingDaemonBuffer.size() > STARTING_BUFFER_MAX_SIZE)
     {
-        s = QString(COLOR_ORANGE "CRITICAL" COLOR_RESET ": (%0) %1:%2 - %3\n").arg(timestamp).arg(fname).arg(context.line).arg(msg);
-        break;
+        //Keep the most recent lines only
+        int cut = startingDaemonBuffer.indexOf('\n', startingDaemonBuffer.size() - STARTING_BUFFER_MAX_SIZE);
+        startingDaemonBuffer.remove(0, cut < 0 ? startingDaemonBuffer.size() : cut + 1);
     }
-    case QtFatalMsg:
+}
+
+//Called from the main thread with already formatted lines
+static void _dispatchLogLines(const QByteArray &lines, const QByteArray &guiLines)
+{
+    if (!guiLines.isEmpty() && guiLogLimiter.allow(guiLines.size()))
+        guiLogCallback(guiLogLimiter.takeDroppedNote() + guiLines);
+
+    if (Common::isDaemon() && debugLogClients.isEmpty())
     {
-        s = QString(COLOR_RED "FATAL" COLOR_RESET ": (%0) %1:%2 - %3\n").arg(timestamp).arg(fname).arg(context.line).arg(msg);
-        break;
-    }
+        _appendStartingBuffer(lines);
     }
 
-    if (!s.isEmpty())
+    for (QLocalSocket *sock: debugLogClients)
     {
-        printf("%s", qPrintable(s));
-        fflush(stdout);
-
-        //In release, do not display qDebug messages from GUI
-        if (QStringLiteral(APP_VERSION) == "git" ||
-            type == QtFatalMsg ||
-            type == QtCriticalMsg ||
-            type == QtWarningMsg ||
-            type == QtInfoMsg)
-            guiLogCallback(s.toUtf8());
-
-        if (Common::isDaemon() && debugLogClients.isEmpty())
-        {
-            startingDaemonBuffer.append(s.toUtf8());
-        }
-
-        for (QLocalSocket *sock: debugLogClients)
+        LogSinkLimiter &limiter = debugLogLimiters[sock];
+        if (sock->bytesToWrite() > LOG_SOCKET_MAX_PENDING)
         {
-            sock->write(s.toUtf8());
-            sock->flush();
+            //Client does not read fast enough
+            limiter.drop(lines.size());
+            continue;
         }
+        if (limiter.allow(lines.size()))
+            sock->write(limiter.takeDroppedNote() + lines);
     }
 }
 
+static void _messageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg)
+{
+    AsyncLogger *logger = AsyncLogger::instance();
+    if (type != QtFatalMsg && logger->push(type, context, msg))
+        return;
+
+    //Logger is not running, or the application is about to abort:
+    //write everything synchronously
+    if (type == QtFatalMsg)
+        logger->stopLogging();
+
+    const QByteArray s = AsyncLogger::formatMessage(type, QDateTime::currentMSecsSinceEpoch(), context.file, context.line, msg);
+    printf("%s", s.constData());
+    fflush(stdout);
+
+    if (QCoreApplication::instance() && QThread::currentThread() == QCoreApplication::instance()->thread())
+        _dispatchLogLines(s, AsyncLogger::isGuiMessage(type) ? s : QByteArray());
+}
+
 static bool is_daemon = false;
 void Common::setIsDaemon(bool en)
 {
@@ -220,11 +239,24 @@ void Common::installMessageOutputHandler(QLocalServer *logServer, GuiLogCallback
             QObject::connect(s, &QLocalSocket::disconnected, [s]()
             {
                 debugLogClients.removeAll(s);
+                debugLogLimiters.remove(s);
                 s->deleteLater();
             });
         });
     }
     guiLogCallback = guicb;
+
+    //Formatting and stdout writes are done in the logger thread,
+    //sockets and gui callback are only used from the main thread
+    AsyncLogger *logger = AsyncLogger::instance();
+    QObject::connect(logger, &AsyncLogger::linesReady, QCoreApplication::instance(),
+                     [](const QByteArray &lines, const QByteArray &guiLines)
+    {
+        _dispatchLogLines(lines, guiLines);
+    }, Qt::QueuedConnection);
+    QObject::connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, logger, &AsyncLogger::stopLogging);
+    logger->startLogging();
+
     qInstallMessageHandler(_messageOutput);
 }
 
@@ -255,6 +287,34 @@ QByteArray Common::dateToBytes(const QDate &dt)
     return data;
 }
 
+Q_LOGGING_CATEGORY(mcPacket, "moolticute.packet", QtInfoMsg)
+Q_LOGGING_CATEGORY(mcMmm, "moolticute.mmm", QtInfoMsg)
+
+QByteArray Common::toHexList(const QByteArray &data)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+
+    //"0x00, " for each byte, without the last separator, plus brackets
+    QByteArray res(data.isEmpty() ? 2 : data.size() * 6, Qt::Uninitialized);
+    char *out = res.data();
+    *out++ = '[';
+    for (int i = 0; i < data.size(); i++)
+    {
+        const quint8 b = static_cast<quint8>(data.at(i));
+        *out++ = '0';
+        *out++ = 'x';
+        *out++ = hexDigits[b >> 4];
+        *out++ = hexDigits[b & 0x0F];
+        if (i < data.size() - 1)
+        {
+            *out++ = ',';
+            *out++ = ' ';
+        }
+    }
+    *out++ = ']';
+    return res;
+}
+
 QJsonArray Common::bytesToJson(const QByteArray &data)
 {
     QJsonArray arr;
@@ -273,6 +333,36 @@ QJsonObject Common::bytesToJsonObjectArray(const QByteArray &data)
     return returnObject;
 }
 
+QJsonValue Common::bytesToJsonCompact(const QByteArray &data)
+{
+    return QJsonValue(QString::fromLatin1(data.toBase64()));
+}
+
+QByteArray Common::jsonToBytes(const QJsonValue &val)
+{
+    QByteArray res;
+    if (val.isString())
+    {
+        res = QByteArray::fromBase64(val.toString().toLatin1());
+    }
+    else if (val.isArray())
+    {
+        const QJsonArray arr = val.toArray();
+        res.reserve(arr.size());
+        for (const QJsonValue &v: arr)
+            res.append((char)v.toInt());
+    }
+    else if (val.isObject())
+    {
+        //Legacy export format, keys are "0" to "n-1"
+        const QJsonObject obj = val.toObject();
+        res.reserve(obj.size());
+        for (qint32 i = 0; i < obj.size(); i++)
+            res.append((char)obj[QString::number(i)].toInt());
+    }
+    return res;
+}
+
 //Check if the process with <pid> is running
 bool Common::isProcessRunning(qint64 pid)
 {
@@ -205,8 +205,14 @@ public:
     static QDate bytesToDate(const QByteArray &d);
     static QByteArray dateToBytes(const QDate &dt);
 
+    //"[0x01, 0x02, ...]" string of data, for packet traces
+    static QByteArray toHexList(const QByteArray &data);
     static QJsonArray bytesToJson(const QByteArray &data);
     static QJsonObject bytesToJsonObjectArray(const QByteArray &data);
+    //Compact base64 string, much smaller and faster to parse than the two above
+    static QJsonValue bytesToJsonCompact(const QByteArray &data);
+    //Decode bytes from a base64 string, a number array or a {"0": .., "1": ..} object
+    static QByteArray jsonToBytes(const QJsonValue &val);
 
     static bool isProcessRunning(qint64 pid);
 
@@ -304,6 +310,21 @@ const QRegularExpression regVersion("v([0-9]+)\\.([0-9]+)(.*)");
 Q_DECLARE_METATYPE(Common::MPStatus)
 Q_DECLARE_METATYPE(Common::MPHwVersion)
 
+//High volume traces (device packets, MMM nodes), enabled at runtime with --debug-log.
+//Build with CONFIG+=no_trace_logs to remove them from the binary.
+Q_DECLARE_LOGGING_CATEGORY(mcPacket)
+Q_DECLARE_LOGGING_CATEGORY(mcMmm)
+
+#ifdef MC_NO_TRACE_LOGS
+#define qTracePacket() QT_NO_QDEBUG_MACRO()
+#define qTraceMmm() QT_NO_QDEBUG_MACRO()
+#define qTracePacketEnabled() false
+#else
+#define qTracePacket() qCDebug(mcPacket)
+#define qTraceMmm() qCDebug(mcMmm)
+#define qTracePacketEnabled() mcPacket().isDebugEnabled()
+#endif
+
 #define CSS_BLUE_BUTTON "QPushButton {" \
                             "color: #fff;" \
                             "background-color: #60B1C7;" \
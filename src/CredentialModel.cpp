@@ -5,6 +5,7 @@
 #include <QFont>
 #include <QApplication>
 #include <QBrush>
+#include <QSet>
 
 // Application
 #include "CredentialModel.h"
@@ -151,9 +152,45 @@ int CredentialModel::rowCount(const QModelIndex &parent) const
     else
         pParentItem = static_cast<TreeItem *>(parent.internalPointer());
 
+    if (pParentItem->treeType() == TreeItem::Service && !isFetched(pParentItem))
+        return 0;
+
     return pParentItem->childCount();
 }
 
+bool CredentialModel::hasChildren(const QModelIndex &parent) const
+{
+    if (parent.column() > 0)
+        return false;
+
+    // Answer without fetching, so that views show the expand arrow
+    TreeItem *pParentItem = parent.isValid() ? static_cast<TreeItem *>(parent.internalPointer()) : m_pRootItem;
+    return pParentItem->childCount() > 0;
+}
+
+bool CredentialModel::canFetchMore(const QModelIndex &parent) const
+{
+    TreeItem *pParentItem = getItemByIndex(parent);
+    return (pParentItem != nullptr) && (pParentItem->treeType() == TreeItem::Service) &&
+           !isFetched(pParentItem) && (pParentItem->childCount() > 0);
+}
+
+void CredentialModel::fetchMore(const QModelIndex &parent)
+{
+    if (!canFetchMore(parent))
+        return;
+
+    ServiceItem *pServiceItem = static_cast<ServiceItem *>(getItemByIndex(parent));
+    beginInsertRows(parent, 0, pServiceItem->childCount() - 1);
+    pServiceItem->setFetched(true);
+    endInsertRows();
+}
+
+bool CredentialModel::isFetched(const TreeItem *pServiceItem) const
+{
+    return !m_bLazyLoading || static_cast<const ServiceItem *>(pServiceItem)->isFetched();
+}
+
 int CredentialModel::columnCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
@@ -172,27 +209,61 @@ void CredentialModel::load(const QJsonArray &json)
     if (json.isEmpty())
         return;
 
-    beginResetModel();
+    if (m_pRootItem->childCount() == 0)
+    {
+        // First load, nothing to keep in the views
+        int iLoginCount = 0;
+        for (int i=0; i<json.size(); i++)
+            iLoginCount += json.at(i).toObject()["childs"].toArray().size();
+
+        beginResetModel();
+        m_bLazyLoading = iLoginCount > LAZY_LOADING_THRESHOLD;
+        loadItems(json, false);
+        m_pRootItem->removeUnusedItems();
+        endResetModel();
+    }
+    else
+    {
+        // Only notify the views about what really changed
+        m_pRootItem->setItemsStatus(TreeItem::UNUSED);
+        loadItems(json, true);
+        removeUnusedRows();
+    }
+
+    bool bClearLoginDescription = m_pRootItem->childCount() == 0;
+    emit modelLoaded(bClearLoginDescription);
+}
 
-    m_pRootItem->setItemsStatus(TreeItem::UNUSED);
+void CredentialModel::loadItems(const QJsonArray &json, bool bIncremental)
+{
+    QSet<TreeItem *> changedServices;
     for (int i=0; i<json.size(); i++)
     {
         QJsonObject pnode = json.at(i).toObject();
 
+        // Retrieve credential data
+        QString sServiceName = pnode["service"].toString();
+
         QJsonArray jchilds = pnode["childs"].toArray();
         for (int j=0; j<jchilds.size(); j++)
         {
             QJsonObject cnode = jchilds.at(j).toObject();
 
-            // Retrieve credential data
-            QString sServiceName = pnode["service"].toString();
-
             // Check if this service already exists
             ServiceItem *pServiceItem = m_pRootItem->findServiceByName(sServiceName);
 
             // Service does not exist, add it
             if (pServiceItem == nullptr)
+            {
+                int iRow = m_pRootItem->childCount();
+                if (bIncremental)
+                    beginInsertRows(QModelIndex(), iRow, iRow);
                 pServiceItem = m_pRootItem->addService(sServiceName);
+                // An empty service can expose its logins right away
+                pServiceItem->setFetched(bIncremental);
+                if (bIncremental)
+                    endInsertRows();
+            }
             pServiceItem->setStatus(TreeItem::USED);
 
             QString sLoginName = cnode["login"].toString();
@@ -202,56 +273,147 @@ void CredentialModel::load(const QJsonArray &json)
 
             // Login does not exist, add it
             if (pLoginItem == nullptr)
+            {
+                int iRow = pServiceItem->childCount();
+                bool bNotify = bIncremental && isFetched(pServiceItem);
+                if (bNotify)
+                    beginInsertRows(createIndex(pServiceItem->row(), 0, pServiceItem), iRow, iRow);
                 pLoginItem = pServiceItem->addLogin(sLoginName);
+                if (bNotify)
+                    endInsertRows();
+                if (bIncremental)
+                    changedServices.insert(pServiceItem);
+            }
             pLoginItem->setStatus(TreeItem::USED);
 
-            // Update login item description
-            QString sDescription = cnode["description"].toString();
-            pLoginItem->setDescription(sDescription);
+            if (loadLoginItem(pLoginItem, cnode) && bIncremental && isFetched(pServiceItem))
+            {
+                int iRow = pLoginItem->row();
+                emit dataChanged(createIndex(iRow, 0, pLoginItem), createIndex(iRow, columnCount() - 1, pLoginItem));
+            }
+        }
+    }
 
-            // Update login item created date
-            QDate dCreatedDate = QDate::fromString(cnode["date_created"].toString(), Qt::ISODate);
-            pLoginItem->setUpdatedDate(dCreatedDate);
+    // Services display a summary of their logins
+    foreach (TreeItem *pServiceItem, changedServices)
+    {
+        int iRow = pServiceItem->row();
+        emit dataChanged(createIndex(iRow, 0, pServiceItem), createIndex(iRow, columnCount() - 1, pServiceItem));
+    }
+}
 
-            // Update login item updated date
-            QDate dUpdatedDate = QDate::fromString(cnode["date_last_used"].toString(), Qt::ISODate);
-            pLoginItem->setAccessedDate(dUpdatedDate);
+bool CredentialModel::loadLoginItem(LoginItem *pLoginItem, const QJsonObject &cnode)
+{
+    bool bChanged = false;
 
-            // Update login item category
-            if (DeviceDetector::instance().isBle())
-            {
-                pLoginItem->setCategory(cnode["category"].toVariant().toInt());
-                pLoginItem->setkeyAfterLogin(cnode["key_after_login"].toVariant().toInt());
-                pLoginItem->setkeyAfterPwd(cnode["key_after_pwd"].toVariant().toInt());
-                pLoginItem->setPwdBlankFlag(cnode["pwd_blank_flag"].toVariant().toInt());
-            }
+    // Update login item description
+    QString sDescription = cnode["description"].toString();
+    if (sDescription != pLoginItem->description())
+    {
+        pLoginItem->setDescription(sDescription);
+        bChanged = true;
+    }
 
-            QJsonArray a = cnode["address"].toArray();
-            if (a.size() < 2)
-            {
-                qWarning() << "Moolticute daemon did not send the node address, please upgrade moolticute daemon.";
-                continue;
-            }
-            QByteArray bAddress;
-            bAddress.append((char)a.at(0).toInt());
-            bAddress.append((char)a.at(1).toInt());
+    // Update login item created date
+    QDate dCreatedDate = QDate::fromString(cnode["date_created"].toString(), Qt::ISODate);
+    if (dCreatedDate != pLoginItem->updatedDate())
+    {
+        pLoginItem->setUpdatedDate(dCreatedDate);
+        bChanged = true;
+    }
 
-            // Update login item address
-            pLoginItem->setAddress(bAddress);
+    // Update login item updated date
+    QDate dUpdatedDate = QDate::fromString(cnode["date_last_used"].toString(), Qt::ISODate);
+    if (dUpdatedDate != pLoginItem->accessedDate())
+    {
+        pLoginItem->setAccessedDate(dUpdatedDate);
+        bChanged = true;
+    }
 
-            // Update login favorite
-            int iFavorite = cnode["favorite"].toInt();
-            pLoginItem->setFavorite(iFavorite);
+    // Update login item category
+    if (DeviceDetector::instance().isBle())
+    {
+        int iCategory = cnode["category"].toVariant().toInt();
+        int iKeyAfterLogin = cnode["key_after_login"].toVariant().toInt();
+        int iKeyAfterPwd = cnode["key_after_pwd"].toVariant().toInt();
+        int iPwdBlankFlag = cnode["pwd_blank_flag"].toVariant().toInt();
+        if ((iCategory != pLoginItem->category()) ||
+            (iKeyAfterLogin != pLoginItem->keyAfterLogin()) ||
+            (iKeyAfterPwd != pLoginItem->keyAfterPwd()) ||
+            (iPwdBlankFlag != pLoginItem->pwdBlankFlag()))
+        {
+            pLoginItem->setCategory(iCategory);
+            pLoginItem->setkeyAfterLogin(iKeyAfterLogin);
+            pLoginItem->setkeyAfterPwd(iKeyAfterPwd);
+            pLoginItem->setPwdBlankFlag(iPwdBlankFlag);
+            bChanged = true;
         }
     }
 
-    // Remove unused items
-    m_pRootItem->removeUnusedItems();
+    QJsonArray a = cnode["address"].toArray();
+    if (a.size() < 2)
+    {
+        qWarning() << "Moolticute daemon did not send the node address, please upgrade moolticute daemon.";
+        return bChanged;
+    }
+    QByteArray bAddress;
+    bAddress.append((char)a.at(0).toInt());
+    bAddress.append((char)a.at(1).toInt());
 
-    endResetModel();
+    // Update login item address
+    if (bAddress != pLoginItem->address())
+    {
+        pLoginItem->setAddress(bAddress);
+        bChanged = true;
+    }
 
-    bool bClearLoginDescription = m_pRootItem->childCount() == 0;
-    emit modelLoaded(bClearLoginDescription);
+    // Update login favorite
+    qint8 iFavorite = (qint8)cnode["favorite"].toInt();
+    if (iFavorite != pLoginItem->favorite())
+    {
+        pLoginItem->setFavorite(iFavorite);
+        bChanged = true;
+    }
+
+    return bChanged;
+}
+
+void CredentialModel::removeUnusedRows()
+{
+    // Walk backwards so that the remaining rows keep their number
+    for (int iRow = m_pRootItem->childCount() - 1; iRow >= 0; iRow--)
+    {
+        TreeItem *pServiceItem = m_pRootItem->child(iRow);
+        if (pServiceItem->status() == TreeItem::UNUSED)
+        {
+            beginRemoveRows(QModelIndex(), iRow, iRow);
+            if (m_pRootItem->removeOne(pServiceItem))
+                delete pServiceItem;
+            endRemoveRows();
+            continue;
+        }
+
+        QModelIndex serviceIndex = createIndex(iRow, 0, pServiceItem);
+        bool bNotify = isFetched(pServiceItem);
+        bool bRemoved = false;
+        for (int iLoginRow = pServiceItem->childCount() - 1; iLoginRow >= 0; iLoginRow--)
+        {
+            TreeItem *pLoginItem = pServiceItem->child(iLoginRow);
+            if (pLoginItem->status() != TreeItem::UNUSED)
+                continue;
+
+            if (bNotify)
+                beginRemoveRows(serviceIndex, iLoginRow, iLoginRow);
+            if (pServiceItem->removeOne(pLoginItem))
+                delete pLoginItem;
+            if (bNotify)
+                endRemoveRows();
+            bRemoved = true;
+        }
+
+        if (bRemoved)
+            emit dataChanged(serviceIndex, createIndex(iRow, columnCount() - 1, pServiceItem));
+    }
 }
 
 ServiceItem *CredentialModel::addService(const QString &sServiceName)
@@ -265,23 +427,39 @@ ServiceItem *CredentialModel::addService(const QString &sServiceName)
     return new ServiceItem(sServiceName);
 }
 
+QSet<int> CredentialModel::usedFavorites() const
+{
+    // Walk the items, logins of lazy services are not in the model yet
+    QSet<int> favorites;
+    foreach (TreeItem *pServiceItem, m_pRootItem->childs())
+    {
+        foreach (TreeItem *pItem, pServiceItem->childs())
+        {
+            const LoginItem *pLoginItem = tree_item_cast<LoginItem>(pItem);
+            if ((pLoginItem != nullptr) && (pLoginItem->favorite() >= 0))
+                favorites.insert(pLoginItem->favorite());
+        }
+    }
+    return favorites;
+}
+
 QModelIndex CredentialModel::getServiceIndexByName(const QString &sServiceName, int column) const
 {
-    QModelIndexList lMatches = match(index(0, column, QModelIndex()), Qt::DisplayRole, sServiceName, 1, Qt::MatchExactly);
-    if (!lMatches.isEmpty())
-        return lMatches.first();
+    ServiceItem *pServiceItem = m_pRootItem->findServiceByName(sServiceName);
+    if ((pServiceItem == nullptr) || (pServiceItem->name() != sServiceName))
+        return QModelIndex();
 
-    return QModelIndex();
+    return createIndex(pServiceItem->row(), column, pServiceItem);
 }
 
 LoginItem *CredentialModel::getLoginItemByIndex(const QModelIndex &idx) const
 {
-    return dynamic_cast<LoginItem *>(getItemByIndex(idx));
+    return tree_item_cast<LoginItem>(getItemByIndex(idx));
 }
 
 ServiceItem *CredentialModel::getServiceItemByIndex(const QModelIndex &idx) const
 {
-    return dynamic_cast<ServiceItem *>(getItemByIndex(idx));
+    return tree_item_cast<ServiceItem>(getItemByIndex(idx));
 }
 
 QString CredentialModel::getCategoryName(int catId) const
@@ -434,6 +612,7 @@ void CredentialModel::clear()
     qDebug() << "*** CLEAR ALL ITEMS FROM GUI ***";
     beginResetModel();
     m_pRootItem->clear();
+    m_bLazyLoading = false;
     endResetModel();
 }
 
@@ -463,7 +642,7 @@ QJsonArray CredentialModel::getJsonChanges()
     {
         QVector<TreeItem *> vLogins = pService->childs();
         foreach (TreeItem *pLogin, vLogins) {
-            LoginItem *pLoginItem = dynamic_cast<LoginItem *>(pLogin);
+            LoginItem *pLoginItem = tree_item_cast<LoginItem>(pLogin);
             QJsonObject object = pLoginItem->toJson();
             jarr.append(object);
         }
@@ -493,6 +672,8 @@ void CredentialModel::addCredential(QString sServiceName, const QString &sLoginN
             QModelIndex serviceIndex = getServiceIndexByName(pTargetService->name());
             if (serviceIndex.isValid())
             {
+                // Expose the existing logins first, the new one is selected afterwards
+                fetchMore(serviceIndex);
                 beginInsertRows(serviceIndex, rowCount(serviceIndex), rowCount(serviceIndex));
                 pAddedLoginItem = pTargetService->addLogin(sLoginName);
                 pAddedLoginItem->setPasswordLocked(false);
@@ -508,6 +689,7 @@ void CredentialModel::addCredential(QString sServiceName, const QString &sLoginN
     {
         beginInsertRows(QModelIndex(), rowCount(), rowCount());
         ServiceItem *pAddedService = m_pRootItem->addService(sServiceName);
+        pAddedService->setFetched(true);
         endInsertRows();
 
         QModelIndex serviceIndex = getServiceIndexByName(pAddedService->name());
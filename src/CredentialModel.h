@@ -4,9 +4,11 @@
 // Qt
 #include <QAbstractItemModel>
 #include <QJsonArray>
+#include <QJsonObject>
 #include <QDate>
 #include <QTimer>
 #include <QIcon>
+#include <QSet>
 
 // Application
 #include "Common.h"
@@ -42,6 +44,9 @@ public:
     virtual QModelIndex parent(const QModelIndex &idx) const;
     virtual int rowCount(const QModelIndex &parent = QModelIndex()) const;
     virtual int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    virtual bool hasChildren(const QModelIndex &parent = QModelIndex()) const;
+    virtual bool canFetchMore(const QModelIndex &parent) const;
+    virtual void fetchMore(const QModelIndex &parent);
     void load(const QJsonArray &json);
     void setClearTextPassword(const QString &sServiceName, const QString &sLoginName, const QString &sPassword);
     QJsonArray getJsonChanges();
@@ -58,14 +63,24 @@ public:
     void updateCategories(const QString& cat1, const QString& cat2, const QString& cat3, const QString& cat4);
     bool isUserCategoryClean() const { return m_categoryClean; }
     void setUserCategoryClean(bool clean) { m_categoryClean = clean; }
+    QSet<int> usedFavorites() const;
 
 private:
     ServiceItem *addService(const QString &sServiceName);
+    void loadItems(const QJsonArray &json, bool bIncremental);
+    bool loadLoginItem(LoginItem *pLoginItem, const QJsonObject &cnode);
+    void removeUnusedRows();
+    bool isFetched(const TreeItem *pServiceItem) const;
+
+    // Above this many logins, the logins of a service are only exposed
+    // to the views once it is expanded
+    static constexpr int LAZY_LOADING_THRESHOLD = 2000;
 
 private:
     RootItem *m_pRootItem;
     QList<QString> m_categories{tr("Default category"), "", "", "", ""};
     bool m_categoryClean = false;
+    bool m_bLazyLoading = false;
 
 signals:
     void modelLoaded(bool bClearLoginDescription);
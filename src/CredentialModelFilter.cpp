@@ -17,12 +17,15 @@ CredentialModelFilter::~CredentialModelFilter()
 void CredentialModelFilter::setFilter(const QString &sFilter)
 {
     m_sFilter = sFilter;
+    m_sNeedle = CredentialSearchIndex::normalize(sFilter);
+    m_bMatchesDirty = true;
     invalidateFilter();
 }
 
 bool CredentialModelFilter::switchFavFilter()
 {
     m_favFilter = !m_favFilter;
+    m_bAcceptedDirty = true;
     invalidateFilter();
     return m_favFilter;
 }
@@ -90,81 +93,219 @@ void CredentialModelFilter::refreshFavorites()
 {
     if (m_favFilter)
     {
+        m_bAcceptedDirty = true;
         invalidateFilter();
     }
 }
 
-bool CredentialModelFilter::filterAcceptsRow(int iSrcRow, const QModelIndex &srcParent) const
+void CredentialModelFilter::setSourceModel(QAbstractItemModel *pSourceModel)
 {
-    // Get source index
-    QModelIndex srcIndex = sourceModel()->index(iSrcRow, 0, srcParent);
-    if (srcIndex.isValid())
+    foreach (const QMetaObject::Connection &c, m_sourceConnections)
+        disconnect(c);
+    m_sourceConnections.clear();
+    setFilterStateDirty();
+
+    // Connected before the proxy model, so that the filter state is up to
+    // date when it filters the changed rows
+    if (pSourceModel != nullptr)
     {
-        // If any of children matches the filter, then current index matches the filter as well
-        int iRowCount = sourceModel()->rowCount(srcIndex);
-        for (int i=0; i<iRowCount; ++i)
-            if (filterAcceptsRow(i, srcIndex))
-                return true;
-        return acceptRow(iSrcRow, srcParent);
+        m_sourceConnections << connect(pSourceModel, &QAbstractItemModel::modelReset, this, &CredentialModelFilter::setFilterStateDirty);
+        m_sourceConnections << connect(pSourceModel, &QAbstractItemModel::layoutChanged, this, &CredentialModelFilter::setFilterStateDirty);
+        m_sourceConnections << connect(pSourceModel, &QAbstractItemModel::rowsInserted, this, &CredentialModelFilter::onSourceRowsInserted);
+        m_sourceConnections << connect(pSourceModel, &QAbstractItemModel::rowsAboutToBeRemoved, this, &CredentialModelFilter::onSourceRowsAboutToBeRemoved);
+        m_sourceConnections << connect(pSourceModel, &QAbstractItemModel::rowsRemoved, this, &CredentialModelFilter::onSourceRowsRemoved);
+        m_sourceConnections << connect(pSourceModel, &QAbstractItemModel::dataChanged, this, &CredentialModelFilter::onSourceDataChanged);
     }
 
-    // Parent call for initial behaviour:
-    return QSortFilterProxyModel::filterAcceptsRow(iSrcRow, srcParent) ;
+    QSortFilterProxyModel::setSourceModel(pSourceModel);
 }
 
-bool CredentialModelFilter::testItemAgainstNameAndDescription(TreeItem *pItem, const QString &sFilter) const
+bool CredentialModelFilter::filterAcceptsRow(int iSrcRow, const QModelIndex &srcParent) const
 {
-    if (pItem)
+    // Get source item
+    TreeItem *pItem = sourceItem(iSrcRow, srcParent);
+    if (pItem == nullptr)
     {
-        bool bCondition1 = pItem->name().contains(sFilter, Qt::CaseInsensitive);
-        bool bCondition2 = pItem->description().contains(sFilter, Qt::CaseInsensitive);
-        return bCondition1 || bCondition2;
+        // Parent call for initial behaviour:
+        return QSortFilterProxyModel::filterAcceptsRow(iSrcRow, srcParent);
     }
-    return false;
+
+    if (m_sNeedle.isEmpty() && !m_favFilter)
+        return true;
+
+    updateFilterState();
+    return m_accepted.contains(pItem);
 }
 
-bool CredentialModelFilter::acceptRow(int iSrcRow, const QModelIndex &srcParent) const
+void CredentialModelFilter::updateFilterState() const
 {
-    // Get src model
-    CredentialModel *pCredentialModel  = dynamic_cast<CredentialModel *>(sourceModel());
+    if (!m_sNeedle.isEmpty() && m_bIndexDirty)
+        rebuildSearchIndex();
+
+    if (m_bMatchesDirty)
+    {
+        if (m_sNeedle.isEmpty())
+            m_matches.clear();
+        else if (!m_sMatchedNeedle.isEmpty() && m_sNeedle.contains(m_sMatchedNeedle))
+            // The query grew, only the previous matches can still match
+            m_matches = m_searchIndex.narrow(m_sNeedle, m_matches);
+        else
+            m_matches = m_searchIndex.match(m_sNeedle);
+        m_sMatchedNeedle = m_sNeedle;
+        m_bMatchesDirty = false;
+        m_bAcceptedDirty = true;
+    }
 
-    // Get src index
-    QModelIndex srcIndex = pCredentialModel->index(iSrcRow, 0, srcParent);
-    if (srcIndex.isValid())
+    if (m_bAcceptedDirty)
     {
-        // Get item
-        TreeItem *pItem = pCredentialModel->getItemByIndex(srcIndex);
-        if (pItem != nullptr)
+        m_bAcceptedDirty = false;
+        m_accepted.clear();
+        for (int i = 0; i < sourceModel()->rowCount(); i++)
         {
-            // Is it a login item?
-            LoginItem *pLoginItem = dynamic_cast<LoginItem *>(pItem);
+            TreeItem *pServiceItem = sourceItem(i, QModelIndex());
+            if (pServiceItem != nullptr)
+                updateAcceptedService(pServiceItem);
+        }
+    }
+}
 
-            bool shouldDisplayByFavFilter = true;
-            if (m_favFilter)
-            {
-                if (pLoginItem != nullptr)
-                {
-                    shouldDisplayByFavFilter = !m_favFilter || (pLoginItem->favorite() != -1 && m_favFilter);
-                }
-                else
-                {
-                    shouldDisplayByFavFilter = !m_favFilter;
-                }
-            }
+void CredentialModelFilter::rebuildSearchIndex() const
+{
+    m_searchIndex.clear();
+    for (int i = 0; i < sourceModel()->rowCount(); i++)
+    {
+        TreeItem *pServiceItem = sourceItem(i, QModelIndex());
+        if (pServiceItem == nullptr)
+            continue;
+        m_searchIndex.insert(pServiceItem);
+        foreach (TreeItem *pLoginItem, pServiceItem->childs())
+            m_searchIndex.insert(pLoginItem);
+    }
+    m_bIndexDirty = false;
+    m_sMatchedNeedle.clear();
+    m_bMatchesDirty = true;
+}
 
-            if (pLoginItem != nullptr)
-            {
-                TreeItem *pParentItem = pLoginItem->parentItem();
-                bool bCondition = testItemAgainstNameAndDescription(pParentItem, m_sFilter) && shouldDisplayByFavFilter;
-                if (bCondition)
-                    return true;
-            }
+void CredentialModelFilter::updateIndexedItem(const TreeItem *pItem) const
+{
+    if (m_bIndexDirty)
+        return;
+    m_searchIndex.update(pItem);
 
-            return testItemAgainstNameAndDescription(pItem, m_sFilter) && shouldDisplayByFavFilter;
-        }
+    if (m_bMatchesDirty)
+    {
+        // The previous matches are not a superset of the next ones anymore
+        m_sMatchedNeedle.clear();
+        return;
     }
+    if (m_sNeedle.isEmpty())
+        return;
+    if (m_searchIndex.itemMatches(pItem, m_sNeedle))
+        m_matches.insert(pItem);
+    else
+        m_matches.remove(pItem);
+}
+
+void CredentialModelFilter::removeIndexedItem(const TreeItem *pItem) const
+{
+    m_searchIndex.remove(pItem);
+    m_matches.remove(pItem);
+    m_accepted.remove(pItem);
+}
 
-    return true;
+void CredentialModelFilter::updateAcceptedService(const TreeItem *pServiceItem) const
+{
+    // Everything will be computed again on the next filtering
+    if (m_bAcceptedDirty || m_bMatchesDirty || (m_bIndexDirty && !m_sNeedle.isEmpty()))
+        return;
+
+    // A login is shown if it or its service matches, a service is shown
+    // if it matches or if any of its logins is shown
+    bool bServiceMatches = isMatching(pServiceItem);
+    bool bLoginAccepted = false;
+    foreach (const TreeItem *pItem, pServiceItem->childs())
+    {
+        bool bAccepted = bServiceMatches || isMatching(pItem);
+        if (m_favFilter && pItem->treeType() == TreeItem::Login)
+            bAccepted = bAccepted && static_cast<const LoginItem *>(pItem)->favorite() != -1;
+
+        if (bAccepted)
+            m_accepted.insert(pItem);
+        else
+            m_accepted.remove(pItem);
+        bLoginAccepted |= bAccepted;
+    }
+
+    if (bLoginAccepted || (bServiceMatches && !m_favFilter))
+        m_accepted.insert(pServiceItem);
+    else
+        m_accepted.remove(pServiceItem);
+}
+
+bool CredentialModelFilter::isMatching(const TreeItem *pItem) const
+{
+    return m_sNeedle.isEmpty() || m_matches.contains(pItem);
+}
+
+TreeItem *CredentialModelFilter::sourceItem(int iSrcRow, const QModelIndex &srcParent) const
+{
+    CredentialModel *pCredentialModel = static_cast<CredentialModel *>(sourceModel());
+    return pCredentialModel->getItemByIndex(pCredentialModel->index(iSrcRow, 0, srcParent));
+}
+
+void CredentialModelFilter::onSourceRowsInserted(const QModelIndex &srcParent, int iFirst, int iLast)
+{
+    for (int i = iFirst; i <= iLast; i++)
+    {
+        TreeItem *pItem = sourceItem(i, srcParent);
+        if (pItem == nullptr)
+            continue;
+        updateIndexedItem(pItem);
+        foreach (TreeItem *pChild, pItem->childs())
+            updateIndexedItem(pChild);
+        updateAcceptedService(srcParent.isValid() ? pItem->parentItem() : pItem);
+    }
+}
+
+void CredentialModelFilter::onSourceRowsAboutToBeRemoved(const QModelIndex &srcParent, int iFirst, int iLast)
+{
+    for (int i = iFirst; i <= iLast; i++)
+    {
+        TreeItem *pItem = sourceItem(i, srcParent);
+        if (pItem == nullptr)
+            continue;
+        foreach (TreeItem *pChild, pItem->childs())
+            removeIndexedItem(pChild);
+        removeIndexedItem(pItem);
+    }
+}
+
+void CredentialModelFilter::onSourceRowsRemoved(const QModelIndex &srcParent)
+{
+    if (srcParent.isValid())
+        updateAcceptedService(static_cast<TreeItem *>(srcParent.internalPointer()));
+}
+
+void CredentialModelFilter::onSourceDataChanged(const QModelIndex &srcTopLeft, const QModelIndex &srcBottomRight)
+{
+    const QModelIndex srcParent = srcTopLeft.parent();
+    for (int i = srcTopLeft.row(); i <= srcBottomRight.row(); i++)
+    {
+        TreeItem *pItem = sourceItem(i, srcParent);
+        if (pItem == nullptr)
+            continue;
+        updateIndexedItem(pItem);
+        updateAcceptedService(srcParent.isValid() ? pItem->parentItem() : pItem);
+    }
+}
+
+void CredentialModelFilter::setFilterStateDirty()
+{
+    m_bIndexDirty = true;
+    m_bMatchesDirty = true;
+    m_bAcceptedDirty = true;
+    m_matches.clear();
+    m_accepted.clear();
 }
 
 bool CredentialModelFilter::lessThan(const QModelIndex &srcLeft, const QModelIndex &srcRight) const
@@ -205,6 +346,8 @@ QModelIndex CredentialModelFilter::getProxyIndexFromItem(TreeItem *pItem, int co
     case TreeItem::TreeType::Login:
     {
         QModelIndex parentIndex = getProxyIndexFromItem(pItem->parentItem());
+        if (canFetchMore(parentIndex))
+            fetchMore(parentIndex);
 
         for (int i = 0; i < rowCount(parentIndex); i ++)
         {
@@ -3,8 +3,10 @@
 
 // Qt
 #include <QSortFilterProxyModel>
+#include <QSet>
 
 // Application
+#include "CredentialSearchIndex.h"
 class TreeItem;
 
 class CredentialModelFilter : public QSortFilterProxyModel
@@ -22,19 +24,43 @@ public:
     void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) Q_DECL_OVERRIDE;
     QModelIndexList getNextRow(const QModelIndex &rowIdx);
     void refreshFavorites();
+    void setSourceModel(QAbstractItemModel *pSourceModel) Q_DECL_OVERRIDE;
 
 protected:
     virtual bool filterAcceptsRow(int iSrcRow, const QModelIndex &srcParent) const override;
     virtual bool lessThan(const QModelIndex &srcLeft, const QModelIndex &srcRight) const override;
 
 private:
-    bool acceptRow(int iSrcRow, const QModelIndex &srcParent) const;
-    bool testItemAgainstNameAndDescription(TreeItem *pItem, const QString &sFilter) const;
+    void updateFilterState() const;
+    void rebuildSearchIndex() const;
+    void updateIndexedItem(const TreeItem *pItem) const;
+    void removeIndexedItem(const TreeItem *pItem) const;
+    void updateAcceptedService(const TreeItem *pServiceItem) const;
+    bool isMatching(const TreeItem *pItem) const;
+    TreeItem *sourceItem(int iSrcRow, const QModelIndex &srcParent) const;
+
+    void onSourceRowsInserted(const QModelIndex &srcParent, int iFirst, int iLast);
+    void onSourceRowsAboutToBeRemoved(const QModelIndex &srcParent, int iFirst, int iLast);
+    void onSourceRowsRemoved(const QModelIndex &srcParent);
+    void onSourceDataChanged(const QModelIndex &srcTopLeft, const QModelIndex &srcBottomRight);
+    void setFilterStateDirty();
 
 private:
     QString m_sFilter;
     bool m_favFilter = false;
     Qt::SortOrder tempSortOrder;
+
+    // Filter results are computed once for the whole tree and kept up
+    // to date with the source model changes
+    QList<QMetaObject::Connection> m_sourceConnections;
+    mutable CredentialSearchIndex m_searchIndex;
+    mutable bool m_bIndexDirty = true;
+    mutable bool m_bMatchesDirty = true;
+    mutable bool m_bAcceptedDirty = true;
+    mutable QString m_sNeedle;
+    mutable QString m_sMatchedNeedle;
+    mutable QSet<const TreeItem *> m_matches;
+    mutable QSet<const TreeItem *> m_accepted;
 };
 
 #endif // CREDENTIALMODELFILTER_H
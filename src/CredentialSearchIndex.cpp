@@ -0,0 +1,126 @@
+// Application
+#include "CredentialSearchIndex.h"
+#include "TreeItem.h"
+
+void CredentialSearchIndex::clear()
+{
+    m_entries.clear();
+    m_trigrams.clear();
+}
+
+void CredentialSearchIndex::insert(const TreeItem *pItem)
+{
+    if (m_entries.contains(pItem))
+        remove(pItem);
+
+    Entry entry;
+    entry.sName = normalize(pItem->name());
+    entry.sDescription = normalize(pItem->description());
+
+    QSet<quint64> trigrams;
+    addTrigrams(entry.sName, trigrams);
+    addTrigrams(entry.sDescription, trigrams);
+    entry.vTrigrams.reserve(trigrams.size());
+    foreach (quint64 key, trigrams)
+    {
+        entry.vTrigrams << key;
+        m_trigrams[key].insert(pItem);
+    }
+
+    m_entries.insert(pItem, entry);
+}
+
+void CredentialSearchIndex::remove(const TreeItem *pItem)
+{
+    auto it = m_entries.find(pItem);
+    if (it == m_entries.end())
+        return;
+
+    foreach (quint64 key, it->vTrigrams)
+    {
+        auto postings = m_trigrams.find(key);
+        if (postings == m_trigrams.end())
+            continue;
+        postings->remove(pItem);
+        if (postings->isEmpty())
+            m_trigrams.erase(postings);
+    }
+    m_entries.erase(it);
+}
+
+void CredentialSearchIndex::update(const TreeItem *pItem)
+{
+    remove(pItem);
+    insert(pItem);
+}
+
+int CredentialSearchIndex::size() const
+{
+    return m_entries.size();
+}
+
+QSet<const TreeItem *> CredentialSearchIndex::match(const QString &sNeedle) const
+{
+    QSet<const TreeItem *> result;
+
+    if (sNeedle.size() < 3)
+    {
+        // Too short for the trigrams, check every item
+        for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it)
+        {
+            if (it->sName.contains(sNeedle) || it->sDescription.contains(sNeedle))
+                result.insert(it.key());
+        }
+        return result;
+    }
+
+    // Start from the rarest trigram of the query
+    const QSet<const TreeItem *> *pSmallest = nullptr;
+    for (int i = 0; i + 3 <= sNeedle.size(); i++)
+    {
+        auto postings = m_trigrams.constFind(trigramKey(sNeedle, i));
+        if (postings == m_trigrams.constEnd())
+            return result;
+        if (!pSmallest || postings->size() < pSmallest->size())
+            pSmallest = &postings.value();
+    }
+
+    return narrow(sNeedle, *pSmallest);
+}
+
+QSet<const TreeItem *> CredentialSearchIndex::narrow(const QString &sNeedle, const QSet<const TreeItem *> &candidates) const
+{
+    QSet<const TreeItem *> result;
+    foreach (const TreeItem *pItem, candidates)
+    {
+        if (itemMatches(pItem, sNeedle))
+            result.insert(pItem);
+    }
+    return result;
+}
+
+bool CredentialSearchIndex::itemMatches(const TreeItem *pItem, const QString &sNeedle) const
+{
+    auto it = m_entries.constFind(pItem);
+    if (it == m_entries.constEnd())
+        return false;
+    return it->sName.contains(sNeedle) || it->sDescription.contains(sNeedle);
+}
+
+QString CredentialSearchIndex::normalize(const QString &sText)
+{
+    return sText.toCaseFolded();
+}
+
+quint64 CredentialSearchIndex::trigramKey(const QString &sText, int iPos)
+{
+    return (quint64(sText.at(iPos).unicode()) << 32) |
+           (quint64(sText.at(iPos + 1).unicode()) << 16) |
+            quint64(sText.at(iPos + 2).unicode());
+}
+
+void CredentialSearchIndex::addTrigrams(const QString &sText, QSet<quint64> &trigrams)
+{
+    for (int i = 0; i + 3 <= sText.size(); i++)
+        trigrams.insert(trigramKey(sText, i));
+}
@@ -0,0 +1,50 @@
+#ifndef CREDENTIALSEARCHINDEX_H
+#define CREDENTIALSEARCHINDEX_H
+
+// Qt
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+// Application
+class TreeItem;
+
+/* Search index over the name and description of the credential tree items.
+ * Texts are stored case folded, and every trigram points to the items
+ * containing it, so a query only has to check a few candidates.
+ */
+class CredentialSearchIndex
+{
+public:
+    void clear();
+    void insert(const TreeItem *pItem);
+    void remove(const TreeItem *pItem);
+    void update(const TreeItem *pItem);
+    int size() const;
+
+    // Items with a name or description containing sNeedle
+    QSet<const TreeItem *> match(const QString &sNeedle) const;
+    // Same as match() but only checks candidates, for a query which grew
+    QSet<const TreeItem *> narrow(const QString &sNeedle, const QSet<const TreeItem *> &candidates) const;
+    bool itemMatches(const TreeItem *pItem, const QString &sNeedle) const;
+
+    // Queries must be normalized the same way as the indexed texts
+    static QString normalize(const QString &sText);
+
+private:
+    struct Entry
+    {
+        QString sName;
+        QString sDescription;
+        QVector<quint64> vTrigrams;
+    };
+
+    static quint64 trigramKey(const QString &sText, int iPos);
+    static void addTrigrams(const QString &sText, QSet<quint64> &trigrams);
+
+    QHash<const TreeItem *, Entry> m_entries;
+    QHash<quint64, QSet<const TreeItem *>> m_trigrams;
+};
+
+#endif // CREDENTIALSEARCHINDEX_H
@@ -72,11 +72,25 @@ void CredentialView::onModelLoaded(bool bClearLoginDescription)
         for (int i = 0; i < pCredModelFilter->rowCount(); i ++)
         {
             QModelIndex serviceIndex = pCredModelFilter->index(i, 0, QModelIndex());
+
+            // Only fetch the logins of services holding a favorite
+            const TreeItem *pServiceItem = pCredModelFilter->getItemByProxyIndex(serviceIndex);
+            bool bHasFavorite = false;
+            foreach (const TreeItem *pItem, pServiceItem->childs())
+            {
+                const LoginItem *pLoginItem = tree_item_cast<LoginItem>(pItem);
+                bHasFavorite |= (pLoginItem != nullptr) && (pLoginItem->favorite() >= 0);
+            }
+            if (!bHasFavorite)
+                continue;
+            if (pCredModelFilter->canFetchMore(serviceIndex))
+                pCredModelFilter->fetchMore(serviceIndex);
+
             for (int j = 0; j < pCredModelFilter->rowCount(serviceIndex); j ++)
             {
                 QModelIndex itemIndex = pCredModelFilter->index(j, 0, serviceIndex);
                 TreeItem *pItem = pCredModelFilter->getItemByProxyIndex(itemIndex);
-                LoginItem *loginItem = dynamic_cast<LoginItem *>(pItem);
+                LoginItem *loginItem = tree_item_cast<LoginItem>(pItem);
                 if (loginItem && loginItem->favorite() >= 0)
                 {
                     expand(serviceIndex);
@@ -107,7 +121,7 @@ void CredentialView::onToggleExpandedState(const QModelIndex &proxyIndex)
 {
     CredentialModelFilter *pCredModelFilter = dynamic_cast<CredentialModelFilter *>(model());
     TreeItem *pItem = pCredModelFilter->getItemByProxyIndex(proxyIndex);
-    ServiceItem *pServiceItem = dynamic_cast<ServiceItem *>(pItem);
+    ServiceItem *pServiceItem = tree_item_cast<ServiceItem>(pItem);
     m_pCurrentServiceItem = nullptr;
     if (pServiceItem != nullptr)
     {
@@ -189,13 +203,13 @@ void CredentialView::onLayoutAboutToBeChanged(const QList<QPersistentModelIndex>
         }
         else if (currentItem->treeType() == TreeItem::TreeType::Login)
         {
-            tempCurrentLoginItem = dynamic_cast<LoginItem *>(currentItem);
-            tempCurrentServiceItem = dynamic_cast<ServiceItem *>(currentItem->parentItem());
+            tempCurrentLoginItem = tree_item_cast<LoginItem>(currentItem);
+            tempCurrentServiceItem = tree_item_cast<ServiceItem>(currentItem->parentItem());
         }
         else if (currentItem->treeType() == TreeItem::TreeType::Service)
         {
             tempCurrentLoginItem = nullptr;
-            tempCurrentServiceItem = dynamic_cast<ServiceItem *>(currentItem);
+            tempCurrentServiceItem = tree_item_cast<ServiceItem>(currentItem);
         }
         else
         {
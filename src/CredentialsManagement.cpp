@@ -156,9 +156,22 @@ CredentialsManagement::CredentialsManagement(QWidget *parent) :
     ui->credDisplayFrame->setEnabled(false);
     updateSaveDiscardState();
 
+    // Filter once typing pauses, clearing the filter is applied at once
+    m_tFilterTimer.setInterval(150);
+    m_tFilterTimer.setSingleShot(true);
+    connect(&m_tFilterTimer, &QTimer::timeout, [=]()
+    {
+        m_pCredModelFilter->setFilter(ui->lineEditFilterCred->text());
+    });
     connect(ui->lineEditFilterCred, &QLineEdit::textChanged, [=](const QString &t)
     {
-        m_pCredModelFilter->setFilter(t);
+        if (t.isEmpty())
+        {
+            m_tFilterTimer.stop();
+            m_pCredModelFilter->setFilter(t);
+        }
+        else
+            m_tFilterTimer.start();
     });
 
     connect(ui->credentialTreeView, &CredentialView::expanded, this, &CredentialsManagement::onItemExpanded);
@@ -409,7 +422,7 @@ void CredentialsManagement::onPasswordUnlocked(const QString & service, const QS
         LoginItem *selectedLogin = tryGetSelectedLogin();
         TreeItem *serviceItem = nullptr;
         if (selectedLogin)
-            serviceItem = dynamic_cast<ServiceItem *>(selectedLogin->parentItem());
+            serviceItem = tree_item_cast<ServiceItem>(selectedLogin->parentItem());
 
         if (selectedLogin && serviceItem)
         {
@@ -1049,20 +1062,11 @@ void CredentialsManagement::updateFavMenu()
     // check taken favs
     if (m_pCredModel)
     {
-        int services = m_pCredModel->rowCount();
-        for (int i = 0; i < services; i ++)
+        foreach (int favNumber, m_pCredModel->usedFavorites())
         {
-            auto service_index = m_pCredModel->index(i,0);
-            int logins = m_pCredModel->rowCount(service_index);
-            for (int j = 0; j < logins; j++)
-            {
-                auto login_index = m_pCredModel->index(j, 0, service_index);
-                auto login = m_pCredModel->getLoginItemByIndex(login_index);
-                int favNumber = login->favorite();
-                if (favNumber >= 0 && actions.length() > favNumber &&
-                        actions.at(favNumber+1) != nullptr)
-                    actions.at(favNumber+1)->setEnabled(false);
-            }
+            if (actions.length() > favNumber &&
+                    actions.at(favNumber+1) != nullptr)
+                actions.at(favNumber+1)->setEnabled(false);
         }
     }
 }
@@ -116,6 +116,7 @@ private:
     CredentialModelFilter *m_pCredModelFilter = nullptr;
     WSClient *wsClient = nullptr;
     QTimer m_tSelectLoginTimer;
+    QTimer m_tFilterTimer;
     LoginItem *m_pAddedLoginItem;
 
     QMenu m_favMenu;
@@ -0,0 +1,161 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "CsvImporter.h"
+#include "qtcsv/reader.h"
+
+#include <QBuffer>
+#include <QFile>
+#include <QJsonObject>
+#include <QDebug>
+
+namespace
+{
+const QString PROBE_SEPARATORS = ",;.\t";
+
+class CredentialRowProcessor: public QtCSV::Reader::AbstractProcessor
+{
+public:
+    explicit CredentialRowProcessor(int maxReportedLines):
+        m_maxReportedLines(maxReportedLines)
+    {}
+
+    virtual bool processRowElements(const QStringList &elements) override
+    {
+        m_rowCount++;
+        if (elements.size() != 3)
+        {
+            m_invalidCount++;
+            if (m_invalidLines.size() < m_maxReportedLines)
+                m_invalidLines << QString::number(m_rowCount);
+            //No need to keep converting a file which won't be imported
+            m_creds = QJsonArray();
+            return true;
+        }
+
+        if (m_invalidCount == 0)
+        {
+            QJsonObject o;
+            o["service"] = elements.at(0);
+            o["login"] = elements.at(1);
+            o["password"] = elements.at(2);
+            m_creds.append(o);
+        }
+        return true;
+    }
+
+    int m_maxReportedLines;
+    int m_rowCount = 0;
+    int m_invalidCount = 0;
+    QStringList m_invalidLines;
+    QJsonArray m_creds;
+};
+}
+
+CsvImporter::CsvImporter(const QString &fileName, QObject *parent):
+    QThread(parent),
+    m_fileName(fileName)
+{
+}
+
+QChar CsvImporter::sniffSeparator(const QByteArray &sample)
+{
+    QChar fallback;
+
+    foreach (QChar c, PROBE_SEPARATORS)
+    {
+        QByteArray data = sample;
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::ReadOnly);
+        const QList<QStringList> rows = QtCSV::Reader::readToList(buffer, c);
+        if (rows.isEmpty())
+            return QChar();
+
+        int invalid = 0;
+        foreach (const QStringList &row, rows)
+        {
+            if (row.size() != 3)
+                invalid++;
+        }
+
+        if (invalid == 0)
+            return c;
+
+        // Less than half of the rows are invalid, it may be a password database
+        if (fallback.isNull() && invalid < rows.size() * 0.5)
+            fallback = c;
+    }
+
+    return fallback;
+}
+
+void CsvImporter::run()
+{
+    QFile f(m_fileName);
+    if (!f.open(QFile::ReadOnly))
+    {
+        emit importFailed(tr("Unable to read file %1").arg(m_fileName));
+        return;
+    }
+
+    QByteArray sample = f.read(SNIFF_SAMPLE_SIZE);
+    if (!f.atEnd())
+    {
+        //Don't let the last truncated row bias the detection
+        const int lastNewline = sample.lastIndexOf('\n');
+        if (lastNewline > 0)
+            sample.truncate(lastNewline + 1);
+    }
+
+    if (sample.trimmed().isEmpty())
+    {
+        emit importFailed(tr("Nothing is read from %1").arg(m_fileName));
+        return;
+    }
+
+    const QChar separator = sniffSeparator(sample);
+    if (separator.isNull())
+    {
+        emit importFailed(tr("Unable to import %1: Each row must contain exact 3 items using comma as a delimiter").arg(m_fileName));
+        return;
+    }
+    qDebug() << "ImportCSV: CSV" << separator << "delimiter detected";
+
+    f.seek(0);
+    CredentialRowProcessor processor(MAX_REPORTED_LINES);
+    QtCSV::Reader::readToProcessor(f, processor, separator);
+
+    if (processor.m_rowCount == 0)
+    {
+        emit importFailed(tr("Nothing is read from %1").arg(m_fileName));
+        return;
+    }
+
+    if (processor.m_invalidCount > 0)
+    {
+        if (processor.m_invalidCount < MAX_REPORTED_LINES)
+            emit importFailed(tr("Unable to import %1: Each row must contain exact 3 items. Some lines don't (lines number: %2)")
+                              .arg(m_fileName).arg(processor.m_invalidLines.join(",")));
+        else
+            emit importFailed(tr("Unable to import %1: Each row must contain exact 3 items (more than 10 lines don't)").arg(m_fileName));
+        return;
+    }
+
+    qDebug() << "ImportCSV:" << processor.m_creds.size() << "credentials read from" << m_fileName;
+    emit importParsed(processor.m_creds);
+}
@@ -0,0 +1,56 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef CSVIMPORTER_H
+#define CSVIMPORTER_H
+
+#include <QThread>
+#include <QJsonArray>
+
+/* Reads a CSV file of credentials (service, login, password) on a worker
+ * thread. The separator is guessed once from the start of the file, then
+ * the file is parsed a single time: rows are validated as they are read
+ * and directly converted to the payload of the import_csv message.
+ */
+class CsvImporter: public QThread
+{
+    Q_OBJECT
+
+public:
+    explicit CsvImporter(const QString &fileName, QObject *parent = nullptr);
+
+    //Separator giving 3 items on the rows of sample, or a null QChar.
+    //If no separator fits every row, the first one fitting at least half
+    //of them is returned so the invalid lines can be reported.
+    static QChar sniffSeparator(const QByteArray &sample);
+
+signals:
+    void importParsed(const QJsonArray &creds);
+    void importFailed(const QString &errorMessage);
+
+protected:
+    void run() override;
+
+private:
+    static constexpr int SNIFF_SAMPLE_SIZE = 64 * 1024;
+    static constexpr int MAX_REPORTED_LINES = 10;
+
+    QString m_fileName;
+};
+
+#endif // CSVIMPORTER_H
@@ -23,9 +23,11 @@ void DbExportsRegistry::checkIfDbMustBeExported()
 {
     if (!cardId.isEmpty())
     {
-        const QDate date = getLastExportDate(cardId);
-        const int lastCredentialCN = getLastExportCredentialDbChangeNumber(cardId);
-        const int lastDataCN = getLastExportDataDbChangeNumber(cardId);
+        //Parse the registry file once for the three values
+        QSettings s(settingsPath, QSettings::IniFormat);
+        const QDate date = getLastExportDate(s, cardId);
+        const int lastCredentialCN = getLastExportCredentialDbChangeNumber(s, cardId);
+        const int lastDataCN = getLastExportDataDbChangeNumber(s, cardId);
 
         const bool areChangesSinceLastBackup =
                 BackupChangeNumbersComparator::greaterThanWithWrapOver(credentialsDbChangeNumber, lastCredentialCN) ||
@@ -36,26 +38,20 @@ void DbExportsRegistry::checkIfDbMustBeExported()
     }
 }
 
-QDate DbExportsRegistry::getLastExportDate(const QString &id)
+QDate DbExportsRegistry::getLastExportDate(QSettings &s, const QString &id)
 {
-    QSettings s(settingsPath, QSettings::IniFormat);
-    s.sync();
     const QString key = "DbExportRegitry/"+id+"/date";
     return s.value(key, QDate()).toDate();
 }
 
-int DbExportsRegistry::getLastExportCredentialDbChangeNumber(const QString &id)
+int DbExportsRegistry::getLastExportCredentialDbChangeNumber(QSettings &s, const QString &id)
 {
-    QSettings s(settingsPath, QSettings::IniFormat);
-    s.sync();
     const QString key = "DbExportRegitry/"+id+"/credentialsDbChangeNumber";
     return s.value(key, -1).toInt();
 }
 
-int DbExportsRegistry::getLastExportDataDbChangeNumber(const QString &id)
+int DbExportsRegistry::getLastExportDataDbChangeNumber(QSettings &s, const QString &id)
 {
-    QSettings s(settingsPath, QSettings::IniFormat);
-    s.sync();
     const QString key = "DbExportRegitry/"+id+"/dataDbChangeNumber";
     return s.value(key, -1).toInt();
 }
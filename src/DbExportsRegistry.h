@@ -3,6 +3,8 @@
 
 #include <QObject>
 
+class QSettings;
+
 class DbExportsRegistry : public QObject
 {
     Q_OBJECT
@@ -23,10 +25,10 @@ public slots:
 
 private:
     void checkIfDbMustBeExported();
-    QDate getLastExportDate(const QString &cardId);
+    QDate getLastExportDate(QSettings &s, const QString &cardId);
     bool isOlderThanAMonth(const QDate &lastExport);
-    int getLastExportCredentialDbChangeNumber(const QString &id);
-    int getLastExportDataDbChangeNumber(const QString &id);
+    int getLastExportCredentialDbChangeNumber(QSettings &s, const QString &id);
+    int getLastExportDataDbChangeNumber(QSettings &s, const QString &id);
 };
 
 #endif // DBEXPORTSREGISTRY_H
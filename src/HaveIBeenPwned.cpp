@@ -1,4 +1,5 @@
 #include "HaveIBeenPwned.h"
+#include "SettingsCache.h"
 
 #include <QNetworkReply>
 #include <QCryptographicHash>
@@ -14,18 +15,72 @@ HaveIBeenPwned::HaveIBeenPwned(QObject *parent) :
  * @brief HaveIBeenPwned::isPasswordPwned
  * @param pwd Given password to check
  * @param credInfo "service: login"
- * Calculating the SHA1 hash of the password
- * and sending the first five char to HIBP v2 API.
+ * Calculating the SHA1 hash of the password and looking it up in the
+ * offline index if one is configured (settings/hibp_offline_file).
+ * Otherwise the first five char are sent to HIBP v2 API, which is also
+ * used when the offline index is not usable and
+ * settings/hibp_online_fallback is set.
  */
 void HaveIBeenPwned::isPasswordPwned(const QString &pwd, const QString &credInfo)
 {
-    QCryptographicHash sha1Hasher(QCryptographicHash::Sha1);
-    sha1Hasher.addData(pwd.toUtf8());
-    hash = sha1Hasher.result().toHex().toUpper();
-    this->credInfo = credInfo;
-    req.setUrl(QUrl(HIBP_API + hash.left(HIBP_REQUEST_SHA_LENGTH)));
-    hash = hash.mid(HIBP_REQUEST_SHA_LENGTH);
-    networkManager->get(req);
+    const QByteArray sha1 = QCryptographicHash::hash(pwd.toUtf8(), QCryptographicHash::Sha1);
+
+    const SettingsCache *s = SettingsCache::instance();
+    if (!s->value("settings/hibp_offline_file").toString().isEmpty())
+    {
+        if (loadOfflineIndex())
+        {
+            const quint32 pwnedNum = offlineIndex.lookup(sha1);
+            if (pwnedNum > 0)
+                emit sendPwnedMessage(credInfo, QString::number(pwnedNum));
+            else
+                emit safePassword();
+            return;
+        }
+
+        if (!s->value("settings/hibp_online_fallback", false).toBool())
+        {
+            qWarning() << "HIBP offline index unavailable, skipping password check";
+            return;
+        }
+    }
+
+    checkOnline(sha1, credInfo);
+}
+
+bool HaveIBeenPwned::auditHashes(const QVector<QByteArray> &sha1List, QVector<quint32> &counts)
+{
+    if (!loadOfflineIndex())
+        return false;
+
+    counts = offlineIndex.lookup(sha1List);
+    return true;
+}
+
+bool HaveIBeenPwned::loadOfflineIndex()
+{
+    const QString fileName = SettingsCache::instance()->value("settings/hibp_offline_file").toString();
+    if (fileName.isEmpty())
+    {
+        offlineIndex.close();
+        return false;
+    }
+
+    if (offlineIndex.isOpen() && offlineIndex.fileName() == fileName)
+        return true;
+
+    return offlineIndex.open(fileName);
+}
+
+void HaveIBeenPwned::checkOnline(const QByteArray &sha1, const QString &credInfo)
+{
+    const QString hash = sha1.toHex().toUpper();
+    QNetworkRequest req(QUrl(HIBP_API + hash.left(HIBP_REQUEST_SHA_LENGTH)));
+    QNetworkReply *reply = networkManager->get(req);
+
+    //Keep the request details on the reply, several checks can be in flight
+    reply->setProperty("hash_suffix", hash.mid(HIBP_REQUEST_SHA_LENGTH));
+    reply->setProperty("cred_info", credInfo);
 }
 
 /**
@@ -35,12 +90,16 @@ void HaveIBeenPwned::isPasswordPwned(const QString &pwd, const QString &credInfo
  */
 void HaveIBeenPwned::processReply(QNetworkReply *reply)
 {
+    reply->deleteLater();
+
     if (reply->error())
     {
         qDebug() << reply->errorString();
         return;
     }
 
+    const QString hash = reply->property("hash_suffix").toString();
+    const QString credInfo = reply->property("cred_info").toString();
     QString answer = reply->readAll();
 
     /**
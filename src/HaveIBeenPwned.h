@@ -4,6 +4,7 @@
 #include <QObject>
 #include <QNetworkAccessManager>
 #include <QNetworkRequest>
+#include "HibpOfflineIndex.h"
 
 class HaveIBeenPwned : public QObject
 {
@@ -13,6 +14,15 @@ public:
 
     void isPasswordPwned(const QString &pwd, const QString &credInfo);
 
+    /**
+     * @brief auditHashes
+     * @param sha1List raw SHA-1 digests of the passwords
+     * @param counts pwned count of each digest, 0 if not pwned
+     * @return false if no offline index is configured
+     * Checks many hashes at once against the offline index.
+     */
+    bool auditHashes(const QVector<QByteArray> &sha1List, QVector<quint32> &counts);
+
 signals:
     /**
      * @brief sendPwnedNum
@@ -33,11 +43,11 @@ public slots:
     void processReply(QNetworkReply *reply);
 
 private:
-    QNetworkAccessManager *networkManager = nullptr;
-    QNetworkRequest req;
+    bool loadOfflineIndex();
+    void checkOnline(const QByteArray &sha1, const QString &credInfo);
 
-    QString hash;
-    QString credInfo;
+    QNetworkAccessManager *networkManager = nullptr;
+    HibpOfflineIndex offlineIndex;
 
     const QString HIBP_API = "https://api.pwnedpasswords.com/range/";
     const QString HASH_SEPARATOR = "\r\n";
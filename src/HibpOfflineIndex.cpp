@@ -0,0 +1,261 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "HibpOfflineIndex.h"
+
+#include <QtEndian>
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+const char INDEX_MAGIC[] = "HIBP";
+
+//Below that many records, a linear scan is cheaper than more probes
+const quint64 LINEAR_SCAN_LIMIT = 16;
+
+inline quint64 digestPrefix(const uchar *digest)
+{
+    return qFromBigEndian<quint64>(digest);
+}
+
+inline int compareDigest(const uchar *record, const QByteArray &sha1)
+{
+    return std::memcmp(record, sha1.constData(), HibpOfflineIndex::SHA1_SIZE);
+}
+}
+
+HibpOfflineIndex::~HibpOfflineIndex()
+{
+    close();
+}
+
+bool HibpOfflineIndex::open(const QString &fileName)
+{
+    close();
+
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        qWarning() << "Failed to open HIBP index" << fileName << ":" << m_file.errorString();
+        return false;
+    }
+
+    const qint64 fileSize = m_file.size();
+    const uchar *data = fileSize >= HEADER_SIZE ? m_file.map(0, fileSize) : nullptr;
+    if (!data)
+    {
+        qWarning() << "Failed to map HIBP index" << fileName;
+        close();
+        return false;
+    }
+
+    const quint32 version = qFromBigEndian<quint32>(data + 4);
+    const quint64 count = qFromBigEndian<quint64>(data + 8);
+    if (std::memcmp(data, INDEX_MAGIC, 4) != 0 || version != FORMAT_VERSION ||
+        static_cast<quint64>(fileSize - HEADER_SIZE) != count * RECORD_SIZE)
+    {
+        qWarning() << "Invalid HIBP index" << fileName;
+        close();
+        return false;
+    }
+
+    m_records = data + HEADER_SIZE;
+    m_count = count;
+    qInfo() << "HIBP offline index loaded:" << m_count << "hashes";
+    return true;
+}
+
+void HibpOfflineIndex::close()
+{
+    //Closing the file also unmaps it
+    m_file.close();
+    m_records = nullptr;
+    m_count = 0;
+}
+
+quint32 HibpOfflineIndex::lookup(const QByteArray &sha1) const
+{
+    if (!isOpen() || sha1.size() != SHA1_SIZE)
+        return 0;
+
+    return countAt(findFrom(sha1, 0), sha1);
+}
+
+QVector<quint32> HibpOfflineIndex::lookup(const QVector<QByteArray> &sha1List) const
+{
+    QVector<quint32> counts(sha1List.size(), 0);
+    if (!isOpen())
+        return counts;
+
+    //Walk the queries in digest order, each search starts where the previous one ended
+    QVector<int> order;
+    order.reserve(sha1List.size());
+    for (int i = 0; i < sha1List.size(); i++)
+    {
+        if (sha1List.at(i).size() == SHA1_SIZE)
+            order.append(i);
+    }
+    std::sort(order.begin(), order.end(), [&sha1List](int a, int b)
+    {
+        return sha1List.at(a) < sha1List.at(b);
+    });
+
+    quint64 low = 0;
+    for (int i: order)
+    {
+        low = findFrom(sha1List.at(i), low);
+        counts[i] = countAt(low, sha1List.at(i));
+    }
+    return counts;
+}
+
+quint64 HibpOfflineIndex::findFrom(const QByteArray &sha1, quint64 low) const
+{
+    //Lower bound of sha1 in [low, m_count)
+    const quint64 key = digestPrefix(reinterpret_cast<const uchar *>(sha1.constData()));
+    quint64 hi = m_count;
+    bool bisect = false;
+
+    while (hi - low > LINEAR_SCAN_LIMIT)
+    {
+        const quint64 range = hi - low;
+        if (bisect)
+        {
+            const quint64 mid = low + range / 2;
+            if (compareDigest(record(mid), sha1) < 0)
+                low = mid + 1;
+            else
+                hi = mid;
+        }
+        else
+        {
+            const quint64 keyLow = digestPrefix(record(low));
+            const quint64 keyHigh = digestPrefix(record(hi - 1));
+            quint64 mid;
+            if (key <= keyLow)
+                mid = low;
+            else if (key >= keyHigh)
+                mid = hi - 1;
+            else
+                mid = low + static_cast<quint64>(static_cast<long double>(key - keyLow) / (keyHigh - keyLow) * (hi - 1 - low));
+
+            //The guess is usually off by about sqrt(range) records,
+            //so also probe that far on the other side to close the range
+            const quint64 gap = std::max(LINEAR_SCAN_LIMIT, static_cast<quint64>(std::sqrt(static_cast<double>(range))));
+            if (compareDigest(record(mid), sha1) < 0)
+            {
+                low = mid + 1;
+                if (hi - mid > gap)
+                {
+                    if (compareDigest(record(mid + gap), sha1) < 0)
+                        low = mid + gap + 1;
+                    else
+                        hi = mid + gap;
+                }
+            }
+            else
+            {
+                hi = mid;
+                if (mid - low >= gap)
+                {
+                    if (compareDigest(record(mid - gap), sha1) < 0)
+                        low = mid - gap + 1;
+                    else
+                        hi = mid - gap;
+                }
+            }
+        }
+
+        //Fall back to a bisection step when the guess did not halve the range
+        bisect = !bisect && (hi - low) > range / 2;
+    }
+
+    while (low < hi && compareDigest(record(low), sha1) < 0)
+        low++;
+    return low;
+}
+
+quint32 HibpOfflineIndex::countAt(quint64 i, const QByteArray &sha1) const
+{
+    if (i >= m_count || compareDigest(record(i), sha1) != 0)
+        return 0;
+    return qFromBigEndian<quint32>(record(i) + SHA1_SIZE);
+}
+
+bool HibpOfflineIndex::buildFromText(const QString &textFile, const QString &indexFile)
+{
+    QFile in(textFile);
+    if (!in.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        qWarning() << "Failed to open" << textFile << ":" << in.errorString();
+        return false;
+    }
+
+    QFile out(indexFile);
+    if (!out.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << "Failed to create" << indexFile << ":" << out.errorString();
+        return false;
+    }
+
+    //Record count is written once known
+    uchar header[HEADER_SIZE];
+    std::memcpy(header, INDEX_MAGIC, 4);
+    qToBigEndian<quint32>(FORMAT_VERSION, header + 4);
+    qToBigEndian<quint64>(0, header + 8);
+    out.write(reinterpret_cast<const char *>(header), HEADER_SIZE);
+
+    QByteArray previous;
+    quint64 count = 0;
+    uchar rec[RECORD_SIZE];
+    while (!in.atEnd())
+    {
+        const QByteArray line = in.readLine().trimmed();
+        if (line.isEmpty())
+            continue;
+
+        const int sep = line.indexOf(':');
+        const QByteArray digest = QByteArray::fromHex(line.left(sep));
+        bool ok = false;
+        const quint32 pwned = line.mid(sep + 1).toUInt(&ok);
+        if (sep != SHA1_SIZE * 2 || digest.size() != SHA1_SIZE || !ok)
+        {
+            qWarning() << "Invalid HIBP line" << count + 1 << "in" << textFile;
+            return false;
+        }
+        if (!previous.isEmpty() && previous >= digest)
+        {
+            qWarning() << "HIBP list" << textFile << "is not sorted by hash at line" << count + 1;
+            return false;
+        }
+
+        std::memcpy(rec, digest.constData(), SHA1_SIZE);
+        qToBigEndian<quint32>(pwned, rec + SHA1_SIZE);
+        out.write(reinterpret_cast<const char *>(rec), RECORD_SIZE);
+        previous = digest;
+        count++;
+    }
+
+    qToBigEndian<quint64>(count, header + 8);
+    out.seek(0);
+    out.write(reinterpret_cast<const char *>(header), HEADER_SIZE);
+    return out.error() == QFile::NoError;
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef HIBPOFFLINEINDEX_H
+#define HIBPOFFLINEINDEX_H
+
+#include <QFile>
+#include <QVector>
+
+/* Read only, memory mapped copy of the Pwned Passwords list.
+ *
+ * File layout (all integers big endian):
+ *   header:  "HIBP" | u32 version (1) | u64 record count
+ *   records: 20 bytes SHA-1 digest | u32 pwned count
+ * Records are sorted by digest. SHA-1 digests are uniformly distributed,
+ * so lookups use an interpolation search on the first 8 bytes and only
+ * touch a few pages of the mapping.
+ *
+ * buildFromText() converts the "SHA1:count" text dump published by
+ * haveibeenpwned.com (already sorted by hash) to that format.
+ */
+class HibpOfflineIndex
+{
+public:
+    HibpOfflineIndex() = default;
+    ~HibpOfflineIndex();
+
+    bool open(const QString &fileName);
+    void close();
+    bool isOpen() const { return m_records != nullptr; }
+    QString fileName() const { return m_file.fileName(); }
+    quint64 size() const { return m_count; }
+
+    //Number of times sha1 (raw 20 bytes digest) was pwned, 0 if not found
+    quint32 lookup(const QByteArray &sha1) const;
+    //Same as lookup() for many digests, in a single pass over the index
+    QVector<quint32> lookup(const QVector<QByteArray> &sha1List) const;
+
+    static bool buildFromText(const QString &textFile, const QString &indexFile);
+
+    static constexpr int SHA1_SIZE = 20;
+    static constexpr int RECORD_SIZE = SHA1_SIZE + 4;
+
+private:
+    static constexpr int HEADER_SIZE = 16;
+    static constexpr quint32 FORMAT_VERSION = 1;
+
+    const uchar *record(quint64 i) const { return m_records + i * RECORD_SIZE; }
+    quint64 findFrom(const QByteArray &sha1, quint64 low) const;
+    quint32 countAt(quint64 i, const QByteArray &sha1) const;
+
+    QFile m_file;
+    const uchar *m_records = nullptr;
+    quint64 m_count = 0;
+};
+
+#endif // HIBPOFFLINEINDEX_H
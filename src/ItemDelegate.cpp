@@ -15,16 +15,35 @@
 ItemDelegate::ItemDelegate(QWidget* parent):
     QStyledItemDelegate(parent)
 {
+    m_loginFont = qApp->font();
+    m_loginFont.setPointSize(8);
+    m_loginFont.setItalic(true);
+
+    m_favFont = qApp->font();
+    m_favFont.setPointSize(8);
+
+    m_loginNameFont = qApp->font();
+    m_loginNameFont.setBold(true);
+    m_loginNameFont.setItalic(true);
+    m_loginNameFont.setPointSize(10);
+
+    m_arrowIcon = AppGui::qtAwesome()->icon(fa::arrowcircleright
+                                    , {{ "color", QColor("#0097a7") }
+                                    , { "color-selected", QColor("#0097a7") }
+                                    , { "color-active", QColor("#0097a7") }});
 }
 
 QSize ItemDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
 {
-    QSize defaultSize = QStyledItemDelegate::sizeHint(option, index);
+    auto it = m_defaultSizeHints.constFind(index.column());
+    if (it == m_defaultSizeHints.constEnd())
+        it = m_defaultSizeHints.insert(index.column(), QStyledItemDelegate::sizeHint(option, index));
+    QSize defaultSize = it.value();
     if (index.isValid())
     {
         const CredentialModelFilter *pProxyModel = dynamic_cast<const CredentialModelFilter *>(index.model());
         const TreeItem *pItem = pProxyModel->getItemByProxyIndex(index);
-        const LoginItem *pLoginItem = dynamic_cast<const LoginItem *>(pItem);
+        const LoginItem *pLoginItem = tree_item_cast<LoginItem>(pItem);
         if ((pLoginItem != nullptr) && (pLoginItem->favorite() != Common::FAV_NOT_SET))
             return QSize(defaultSize.width(), defaultSize.height()*2);
     }
@@ -55,11 +74,8 @@ void ItemDelegate::paintServiceItem(QPainter *painter, const QStyleOptionViewIte
 
 void ItemDelegate::paintFavorite(QPainter *painter, const QStyleOptionViewItem &option, int iFavorite) const
 {
-    QFont f = loginFont();
     bool isBle = DeviceDetector::instance().isBle();
-    QIcon star = isBle ? AppGui::qtAwesome()->icon(fa::star,
-                                 {{"color" , QColor{Common::BLE_CATEGORY_COLOR[iFavorite/MAX_BLE_CAT_NUM]}}}) :
-                         AppGui::qtAwesome()->icon(fa::star);
+    const QIcon &star = favoriteIcon(iFavorite);
     QSize iconSz = QSize(option.rect.height(), option.rect.height());
     QPoint pos = option.rect.topLeft() + QPoint(0, -(option.rect.height()-iconSz.height())/2);
     QRect iconRect(pos, iconSz);
@@ -68,7 +84,7 @@ void ItemDelegate::paintFavorite(QPainter *painter, const QStyleOptionViewItem &
         star.paint(painter, iconRect);
 
     // Fav number
-    f = favFont();
+    QFont f = favFont();
     painter->setFont(f);
     int favNum = iFavorite;
     if (isBle)
@@ -87,15 +103,10 @@ void ItemDelegate::paintFavorite(QPainter *painter, const QStyleOptionViewItem &
 
 void ItemDelegate::paintArrow(QPainter *painter, const QStyleOptionViewItem &option) const
 {
-    QIcon arrow = AppGui::qtAwesome()->icon(fa::arrowcircleright
-                                    , {{ "color", QColor("#0097a7") }
-                                    , { "color-selected", QColor("#0097a7") }
-                                    , { "color-active", QColor("#0097a7") }});
-
     QPoint arrowPos(option.rect.topLeft() + QPoint(option.rect.height()*1/2, 0));
     QSize arrowSz(QSize(option.rect.height(), option.rect.height()));
     QRect arrowRec(arrowPos, arrowSz);
-    arrow.paint(painter, arrowRec);
+    m_arrowIcon.paint(painter, arrowRec);
 }
 
 bool ItemDelegate::paintCategoryIcon(QPainter *painter, const QStyleOptionViewItem &option, int catId) const
@@ -106,9 +117,6 @@ bool ItemDelegate::paintCategoryIcon(QPainter *painter, const QStyleOptionViewIt
         return false;
     }
 
-    QIcon categoryIcon = AppGui::qtAwesome()->icon(fa::folder,
-                                    {{ "color", QColor{Common::BLE_CATEGORY_COLOR[catId]}}});
-
     const int categoryIconSize = 15;
     int catIconXPos = categoryIconSize;
     QPoint catPos(option.rect.topLeft() + QPoint(option.rect.height()/2, 0));
@@ -118,7 +126,7 @@ bool ItemDelegate::paintCategoryIcon(QPainter *painter, const QStyleOptionViewIt
     catPos.setX(catPos.x() + catIconXPos);
     QSize catSz(QSize(categoryIconSize, categoryIconSize));
     QRect catRec(catPos, catSz);
-    categoryIcon.paint(painter, catRec);
+    categoryIcon(catId).paint(painter, catRec);
     return true;
 }
 
@@ -126,7 +134,7 @@ void ItemDelegate::paintLoginItem(QPainter *painter, const QStyleOptionViewItem
 {
     if (pLoginItem != nullptr)
     {
-        ServiceItem *pServiceItem = dynamic_cast<ServiceItem *>(pLoginItem->parentItem());
+        ServiceItem *pServiceItem = tree_item_cast<ServiceItem>(pLoginItem->parentItem());
         if ((pServiceItem != nullptr) && (pServiceItem->isExpanded()))
         {
             const bool noFav = pLoginItem->favorite() == Common::FAV_NOT_SET;
@@ -139,11 +147,7 @@ void ItemDelegate::paintLoginItem(QPainter *painter, const QStyleOptionViewItem
             QPen pen;
             pen.setColor(QColor("#3D96AF"));
             painter->setPen(pen);
-            QFont font = qApp->font();
-            font.setBold(true);
-            font.setItalic(true);
-            font.setPointSize(10);
-            painter->setFont(font);
+            painter->setFont(m_loginNameFont);
 
             int indent = 0;
             if (noFav)
@@ -176,8 +180,8 @@ void ItemDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
     {
         const CredentialModelFilter *pProxyModel = dynamic_cast<const CredentialModelFilter *>(index.model());
         const TreeItem *pItem = pProxyModel->getItemByProxyIndex(index);
-        const LoginItem *pLoginItem = dynamic_cast<const LoginItem *>(pItem);
-        const ServiceItem *pServiceItem = dynamic_cast<const ServiceItem *>(pItem);
+        const LoginItem *pLoginItem = tree_item_cast<LoginItem>(pItem);
+        const ServiceItem *pServiceItem = tree_item_cast<ServiceItem>(pItem);
 
         painter->save();
 
@@ -213,19 +217,40 @@ void ItemDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
     QStyledItemDelegate::paint(painter, option, index);
 }
 
+const QIcon &ItemDelegate::favoriteIcon(int iFavorite) const
+{
+    // Favorite star is colored with the category on BLE
+    int iKey = DeviceDetector::instance().isBle() ? iFavorite/MAX_BLE_CAT_NUM : -1;
+    auto it = m_favoriteIcons.constFind(iKey);
+    if (it == m_favoriteIcons.constEnd())
+    {
+        QIcon star = iKey >= 0 ? AppGui::qtAwesome()->icon(fa::star,
+                                     {{"color" , QColor{Common::BLE_CATEGORY_COLOR[iKey]}}}) :
+                                 AppGui::qtAwesome()->icon(fa::star);
+        it = m_favoriteIcons.insert(iKey, star);
+    }
+    return it.value();
+}
+
+const QIcon &ItemDelegate::categoryIcon(int catId) const
+{
+    auto it = m_categoryIcons.constFind(catId);
+    if (it == m_categoryIcons.constEnd())
+    {
+        it = m_categoryIcons.insert(catId, AppGui::qtAwesome()->icon(fa::folder,
+                                        {{ "color", QColor{Common::BLE_CATEGORY_COLOR[catId]}}}));
+    }
+    return it.value();
+}
+
 QFont ItemDelegate::loginFont() const
 {
-    QFont f = qApp->font();
-    f.setPointSize(8);
-    f.setItalic(true);
-    return f;
+    return m_loginFont;
 }
 
 QFont ItemDelegate::favFont() const
 {
-    QFont f = qApp->font();
-    f.setPointSize(8);
-    return f;
+    return m_favFont;
 }
 
 void ItemDelegate::emitSizeHintChanged(const QModelIndex &index)
@@ -3,6 +3,8 @@
 
 // Qt
 #include <QStyledItemDelegate>
+#include <QHash>
+#include <QIcon>
 
 // Application
 class ServiceItem;
@@ -24,8 +26,20 @@ private:
     void paintFavorite(QPainter *painter, const QStyleOptionViewItem &option, int iFavorite) const;
     void paintArrow(QPainter *painter, const QStyleOptionViewItem &option) const;
     bool paintCategoryIcon(QPainter *painter, const QStyleOptionViewItem &option, int catId) const;
+    const QIcon &favoriteIcon(int iFavorite) const;
+    const QIcon &categoryIcon(int catId) const;
     QFont loginFont() const;
     QFont favFont() const;
+
+    // Building icons and fonts is slow, they are created once and reused
+    // for every paint. Row heights only depend on the column.
+    QFont m_loginFont;
+    QFont m_favFont;
+    QFont m_loginNameFont;
+    QIcon m_arrowIcon;
+    mutable QHash<int, QIcon> m_favoriteIcons;
+    mutable QHash<int, QIcon> m_categoryIcons;
+    mutable QHash<int, QSize> m_defaultSizeHints;
 };
 
 
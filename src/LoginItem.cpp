@@ -7,7 +7,7 @@
 #include "ServiceItem.h"
 #include "DeviceDetector.h"
 
-LoginItem::LoginItem(const QString &sLoginName) : TreeItem(sLoginName),
+LoginItem::LoginItem(const QString &sLoginName) : TreeItem(sLoginName, QDate::currentDate(), QDate::currentDate(), "", Login),
     m_iFavorite(-1), m_sPassword(""), m_sPasswordOrig(""), m_bPasswordLocked(true)
 {
 }
@@ -101,8 +101,3 @@ bool LoginItem::hasBlankPwdChanged() const
 {
     return 0x00 != m_iPwdBlankFlag && !m_sPassword.isEmpty();
 }
-
-TreeItem::TreeType LoginItem::treeType() const
-{
-    return Login;
-}
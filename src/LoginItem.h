@@ -12,6 +12,8 @@ class ServiceItem;
 class LoginItem : public TreeItem
 {
 public:
+    static constexpr TreeType Kind = Login;
+
     LoginItem(const QString &sLoginName);
     virtual ~LoginItem();
     const QByteArray &address() const;
@@ -25,7 +27,6 @@ public:
     void setPasswordLocked(bool bVisible);
     bool passwordLocked() const;
     bool hasBlankPwdChanged() const;
-    virtual TreeType treeType()  const Q_DECL_OVERRIDE;
 private:    
     QByteArray m_bAddress;
     qint8 m_iFavorite;
@@ -18,6 +18,7 @@
  ******************************************************************************/
 #include "MPDevice.h"
 #include <functional>
+#include <memory>
 #include "ParseDomain.h"
 #include "MessageProtocolMini.h"
 #include "MessageProtocolBLE.h"
@@ -25,6 +26,7 @@
 #include "BleCommon.h"
 #include "MPSettingsBLE.h"
 #include "MPNodeBLE.h"
+#include "MPNodeIndex.h"
 #include "AppDaemon.h"
 
 MPDevice::MPDevice(QObject *parent):
@@ -56,6 +58,21 @@ MPDevice::MPDevice(QObject *parent):
 
     connect(this, SIGNAL(platformDataRead(QByteArray)), this, SLOT(newDataRead(QByteArray)));
 
+    //Cached service_exists results are only valid for the current database
+    const auto invalidateServiceExists = [this]() { serviceExistsRequests.invalidate(); };
+    connect(this, &MPDevice::statusChanged, invalidateServiceExists);
+    connect(this, &MPDevice::memMgmtModeChanged, invalidateServiceExists);
+    connect(this, &MPDevice::credentialsDbChangeNumberChanged, invalidateServiceExists);
+    connect(this, &MPDevice::dataDbChangeNumberChanged, invalidateServiceExists);
+    connect(this, &MPDevice::dbChangeNumbersChanged, invalidateServiceExists);
+
+    //A new card or a locked device means the service index is no longer ours
+    connect(this, &MPDevice::statusChanged, [this]()
+    {
+        serviceIndex.invalidate();
+        changeNumbersLoaded = false;
+    });
+
 //    connect(this, SIGNAL(platformFailed()), this, SLOT(commandFailed()));
 }
 
@@ -333,13 +350,12 @@ void MPDevice::newDataRead(const QByteArray &data)
         }
         qWarning() << "Wrong answer received: " << pMesProt->printCmd(dataCommand)
                    << " for command: " << pMesProt->printCmd(currentCommand);
-        if (AppDaemon::isDebugDev())
-            qWarning() << "Full response: " << data.toHex();
+        qTracePacket() << "Full response: " << data.toHex();
 
         return;
     }
 
-    if (AppDaemon::isDebugDev())
+    if (qTracePacketEnabled())
     {
         QString resMsg = "Received answer: ";
         if (isBLE() && !bleImpl->isFirstPacket(data))
@@ -348,10 +364,10 @@ void MPDevice::newDataRead(const QByteArray &data)
         }
         else
         {
-            qDebug() << "Message payload length:" << pMesProt->getMessageSize(data);
+            qTracePacket() << "Message payload length:" << pMesProt->getMessageSize(data);
             resMsg += pMesProt->printCmd(dataCommand);
         }
-        qDebug() << resMsg << " Full packet:" << data.toHex();
+        qTracePacket() << resMsg << " Full packet:" << data.toHex();
     }
 
     /**
@@ -396,8 +412,7 @@ void MPDevice::sendDataDequeue()
     currentCmd.running = true;
 
     int i = 0;
-    if (AppDaemon::isDebugDev())
-        qDebug() << "Platform send command: " << pMesProt->printCmd(currentCmd.data[0]);
+    qTracePacket() << "Platform send command: " << pMesProt->printCmd(currentCmd.data[0]);
 
     if (isBLE())
     {
@@ -406,19 +421,7 @@ void MPDevice::sendDataDequeue()
     // send data with platform code
     for (const auto &data : currentCmd.data)
     {
-        if (AppDaemon::isDebugDev())
-        {
-            auto toHex = [](quint16 b) -> QString { return QString("0x%1").arg((quint16)b, 2, 16, QChar('0')); };
-            QString a = "[";
-            for (int i = 0;i < data.size();i++)
-            {
-                a += toHex((quint8)data.at(i));
-                if (i < data.size() - 1) a += ", ";
-            }
-            a += "]";
-
-            qDebug() << "Full packet#" << i++ << ": " << a;
-        }
+        qTracePacket().noquote() << "Full packet#" << i++ << ": " << Common::toHexList(data);
 
         platformWrite(data);
     }
@@ -444,10 +447,25 @@ void MPDevice::sendDataDequeue()
 
 void MPDevice::runAndDequeueJobs()
 {
-    if (jobsQueue.isEmpty() || currentJobs)
+    if (currentJobs)
+        return;
+
+    //Continue a preempted AsyncJobs unless interactive work is waiting
+    if (!preemptedJobs.isEmpty() && !jobsQueue.hasInteractiveWaiting())
+    {
+        currentJobs = preemptedJobs.pop();
+        currentJobs->resume();
         return;
+    }
+
+    if (jobsQueue.isEmpty())
+        return;
+
+    //Preempted AsyncJobs are waiting: the device was given up for interactive work
+    currentJobs = jobsQueue.dequeue(!preemptedJobs.isEmpty());
 
-    currentJobs = jobsQueue.dequeue();
+    if (currentJobs->getWaitTime() > AsyncJobsQueue::AGING_INTERVAL_MS)
+        qDebug() << "AsyncJobs" << currentJobs->getJobsId() << "waited" << currentJobs->getWaitTime() << "ms in queue";
 
     connect(currentJobs, &AsyncJobs::finished, [this](const QByteArray &)
     {
@@ -460,13 +478,28 @@ void MPDevice::runAndDequeueJobs()
         runAndDequeueJobs();
     });
 
+    if (currentJobs->isInterruptible())
+    {
+        AsyncJobs *jobs = currentJobs;
+        jobs->setYieldCheck([this]()
+        {
+            return jobsQueue.hasInteractiveWaiting();
+        });
+        connect(jobs, &AsyncJobs::yielded, [this, jobs]()
+        {
+            qDebug() << "AsyncJobs" << jobs->getJobsId() << "yields to more urgent jobs";
+            preemptedJobs.push(jobs);
+            currentJobs = nullptr;
+            runAndDequeueJobs();
+        });
+    }
+
     currentJobs->start();
 }
 
 void MPDevice::resetFlipBit()
 {
-    if (AppDaemon::isDebugDev())
-        qDebug() << "Resetting flip bit for BLE";
+    qTracePacket() << "Resetting flip bit for BLE";
     bleImpl->sendResetFlipBit();
 }
 
@@ -490,6 +523,17 @@ void MPDevice::updateFilesCache()
     });
 }
 
+void MPDevice::loadParams()
+{
+    //A reload is already queued, its result will be sent to all clients
+    if (pSettings->isReadingParams())
+    {
+        qDebug() << "Device parameters are already being loaded";
+        return;
+    }
+    pSettings->loadParameters();
+}
+
 void MPDevice::addFileToCache(QString fileName, int size)
 {
     QVariantMap item;
@@ -651,10 +695,7 @@ void MPDevice::memMgmtModeReadFlash(AsyncJobs *jobs, bool fullScan,
                             qCritical() << "Get favorite: couldn't get answer";
                             return false;
                         }
-                        if (AppDaemon::isDebugDev())
-                        {
-                            qDebug() << "Received favorites: " << data.toHex();
-                        }
+                        qTraceMmm() << "Received favorites: " << data.toHex();
                         /* Append favorite to list */
                         favoritesAddrs = bleImpl->getFavorites(data);
                         favoritesAddrsClone = favoritesAddrs;
@@ -844,6 +885,7 @@ void MPDevice::startMemMgmtMode(bool wantData,
 
     /* New job for starting MMM */
     AsyncJobs *jobs = new AsyncJobs("Starting MMM mode", this);
+    jobs->setPriority(AsyncJobs::PriorityBulk);
 
     /* Ask device to go into MMM first */
     auto startMmmJob = new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone());
@@ -867,7 +909,23 @@ void MPDevice::startMemMgmtMode(bool wantData,
         if (checkLoadedNodes(!wantData, wantData, false))
         {
             qInfo() << "Mem management mode enabled, DB checked";
+            if (changeNumbersLoaded)
+            {
+                if (wantData)
+                {
+                    serviceIndex.build(MPServiceIndex::DATA, dataNodes, get_dataDbChangeNumber());
+                }
+                else
+                {
+                    serviceIndex.build(MPServiceIndex::CREDENTIALS, loginNodes, get_credentialsDbChangeNumber());
+                }
+            }
             force_memMgmtMode(true);
+            if (isBLE())
+            {
+                /* Saves won't have to wait for free addresses */
+                bleImpl->getFreeAddressProvider().prefetchFreeAddresses();
+            }
             cb(true, 0, QString());
         }
         else
@@ -942,7 +1000,7 @@ quint16 MPDevice::getNumberOfPages(void)
 
 quint16 MPDevice::getFlashPageFromAddress(const QByteArray &address)
 {
-    return (((quint16)address[1] << 5) & 0x1FE0) | (((quint16)address[0] >> 3) & 0x001F);
+    return MPFlashPlacement::pageFromAddress(address);
 }
 
 QByteArray MPDevice::getNextNodeAddressInMemory(const QByteArray &address)
@@ -965,10 +1023,21 @@ QByteArray MPDevice::getNextNodeAddressInMemory(const QByteArray &address)
     return return_data;
 }
 
+QByteArray MPDevice::getNextScanAddress(const QByteArray &address)
+{
+    if (!sweepScan)
+    {
+        return getNextNodeAddressInMemory(address);
+    }
+
+    /* Orphan sweep: only the addresses neither free nor linked are read */
+    return sweepAddresses.isEmpty() ? QByteArray() : sweepAddresses.takeFirst();
+}
+
 void MPDevice::loadSingleNodeAndScan(AsyncJobs *jobs, const QByteArray &address, const MPDeviceProgressCb &cbProgress)
 {
     /* Because of recursive calls, make sure we haven't reached the end of the memory */
-    if (getFlashPageFromAddress(address) == getNumberOfPages())
+    if (address.isEmpty() || getFlashPageFromAddress(address) == getNumberOfPages())
     {
         qDebug() << "Reached the end of flash memory";
         return;
@@ -1017,7 +1086,7 @@ void MPDevice::loadSingleNodeAndScan(AsyncJobs *jobs, const QByteArray &address,
             delete pnode;
 
             /* Load next node */
-            loadSingleNodeAndScan(jobs, getNextNodeAddressInMemory(address), cbProgress);
+            loadSingleNodeAndScan(jobs, getNextScanAddress(address), cbProgress);
             diagNbBytesRec += 64;
             return true;
         }
@@ -1053,28 +1122,28 @@ void MPDevice::loadSingleNodeAndScan(AsyncJobs *jobs, const QByteArray &address,
                     {
                         case MPNode::NodeParent :
                         {
-                            qDebug() << address.toHex() << ": parent node loaded:" << pnode->getService();
+                            qTraceMmm() << address.toHex() << ": parent node loaded:" << pnode->getService();
                             loginNodesClone.append(pnodeClone);
                             loginNodes.append(pnode);
                             break;
                         }
                         case MPNode::NodeChild :
                         {
-                            qDebug() << address.toHex() << ": child node loaded:" << pnode->getLogin();
+                            qTraceMmm() << address.toHex() << ": child node loaded:" << pnode->getLogin();
                             loginChildNodesClone.append(pnodeClone);
                             loginChildNodes.append(pnode);
                             break;
                         }
                         case MPNode::NodeParentData :
                         {
-                            qDebug() << address.toHex() << ": data parent node loaded:" << pnode->getService() << "with start child addr:" << pnode->getStartChildAddress().toHex();
+                            qTraceMmm() << address.toHex() << ": data parent node loaded:" << pnode->getService() << "with start child addr:" << pnode->getStartChildAddress().toHex();
                             dataNodesClone.append(pnodeClone);
                             dataNodes.append(pnode);
                             break;
                         }
                         case MPNode::NodeChildData :
                         {
-                            qDebug() << address.toHex() << ": data child node loaded";
+                            qTraceMmm() << address.toHex() << ": data child node loaded";
                             dataChildNodesClone.append(pnodeClone);
                             dataChildNodes.append(pnode);
                             break;
@@ -1084,7 +1153,7 @@ void MPDevice::loadSingleNodeAndScan(AsyncJobs *jobs, const QByteArray &address,
                 }
 
                 /* Load next node */
-                loadSingleNodeAndScan(jobs, getNextNodeAddressInMemory(address), cbProgress);
+                loadSingleNodeAndScan(jobs, getNextScanAddress(address), cbProgress);
                 diagNbBytesRec += 64*3;
             }
 
@@ -1149,7 +1218,7 @@ void MPDevice::loadLoginNode(AsyncJobs *jobs, const QByteArray &address, const M
                 }
 
                 //Node is loaded
-                qDebug() << address.toHex() << ": parent node loaded:" << srv;
+                qTraceMmm() << address.toHex() << ": parent node loaded:" << srv;
 
                 QVariantMap data = {
                     {"total", progressTotal},
@@ -1227,7 +1296,7 @@ void MPDevice::loadLoginChildNode(AsyncJobs *jobs, MPNode *parent, MPNode *paren
             else
             {
                 //Node is loaded
-                qDebug() << address.toHex() << ": child node loaded:" << cnode->getLogin();
+                qTraceMmm() << address.toHex() << ": child node loaded:" << cnode->getLogin();
 
                 //Load next child
                 if (cnode->getNextChildAddress() != MPNode::EmptyAddress)
@@ -1282,7 +1351,7 @@ void MPDevice::loadDataNode(AsyncJobs *jobs, const QByteArray &address, bool loa
             cbProgress(data);
 
             //Node is loaded
-            qDebug() << "Parent data node loaded: " << pnode->getService() << " at address " << pnode->getAddress().toHex() << " first child at " << pnode->getStartChildAddress().toHex();
+            qTraceMmm() << "Parent data node loaded: " << pnode->getService() << " at address " << pnode->getAddress().toHex() << " first child at " << pnode->getStartChildAddress().toHex();
 
             //Load data child
             if (pnode->getStartChildAddress() != MPNode::EmptyAddress && load_childs)
@@ -1344,7 +1413,7 @@ void MPDevice::loadDataChildNode(AsyncJobs *jobs, MPNode *parent, MPNode *parent
         else
         {
             //Node is loaded
-            qDebug() << "Child data node loaded";
+            qTraceMmm() << "Child data node loaded";
 
             QVariantMap data = {
                 {"total", -1},
@@ -2318,13 +2387,13 @@ bool MPDevice::addOrphanParentToDB(MPNode *parentNodePt, bool isDataParent, bool
                 if (curNodePt->getService().compare(parentNodePt->getService()) > 0)
                 {
                     /* We went one slot too far, curNodePt is the next parent Node */
-                    qDebug() << "Adding parent node before" << curNodePt->getService();
+                    qTraceMmm() << "Adding parent node before" << curNodePt->getService();
 
                     /* Check if it is the new first parent */
                     if (!prevNodePt)
                     {
                         /* We have a new start node! */
-                        qDebug() << "Parent node is the new start node";
+                        qTraceMmm() << "Parent node is the new start node";
                         if (isDataParent)
                         {
                             startDataNode = parentNodePt->getAddress();
@@ -2339,7 +2408,7 @@ bool MPDevice::addOrphanParentToDB(MPNode *parentNodePt, bool isDataParent, bool
                     }
                     else
                     {
-                        qDebug() << "... and after" << prevNodePt->getService();
+                        qTraceMmm() << "... and after" << prevNodePt->getService();
                         prevNodePt->setNextParentAddress(parentNodePt->getAddress(), parentNodePt->getVirtualAddress());
                         parentNodePt->setPreviousParentAddress(prevNodePt->getAddress(), prevNodePt->getVirtualAddress());
                     }
@@ -2370,7 +2439,7 @@ bool MPDevice::addOrphanParentToDB(MPNode *parentNodePt, bool isDataParent, bool
         }
 
         /* If we are here it means we need to take the last spot */
-        qDebug() << "Adding parent node after" << prevNodePt->getService();
+        qTraceMmm() << "Adding parent node after" << prevNodePt->getService();
         prevNodePt->setNextParentAddress(parentNodePt->getAddress(), parentNodePt->getVirtualAddress());
         parentNodePt->setPreviousParentAddress(prevNodePt->getAddress(), prevNodePt->getVirtualAddress());
         parentNodePt->setNextParentAddress(MPNode::EmptyAddress);
@@ -2478,7 +2547,7 @@ bool MPDevice::addChildToDB(MPNode* parentNodePt, MPNode* childNodePt, Common::A
                 /* Check if the current login is the first one */
                 if ((tempChildAddress == parentNodePt->getStartChildAddress()) && (tempVirtualChildAddress == parentNodePt->getStartChildVirtualAddress()))
                 {
-                    qDebug() << "Added in first position";
+                    qTraceMmm() << "Added in first position";
                     parentNodePt->setStartChildAddress(childNodePt->getAddress(), childNodePt->getVirtualAddress());
                     childNodePt->setPreviousChildAddress(MPNode::EmptyAddress);
                     childNodePt->setNextChildAddress(tempNextChildNodePt->getAddress(), tempNextChildNodePt->getVirtualAddress());
@@ -2489,7 +2558,7 @@ bool MPDevice::addChildToDB(MPNode* parentNodePt, MPNode* childNodePt, Common::A
                 }
                 else
                 {
-                    qDebug() << "Added in middle of list";
+                    qTraceMmm() << "Added in middle of list";
                     tempChildNodePt->setNextChildAddress(childNodePt->getAddress(), childNodePt->getVirtualAddress());
                     childNodePt->setPreviousChildAddress(tempChildNodePt->getAddress(), tempChildNodePt->getVirtualAddress());
                     childNodePt->setNextChildAddress(tempNextChildNodePt->getAddress(), tempNextChildNodePt->getVirtualAddress());
@@ -2510,7 +2579,7 @@ bool MPDevice::addChildToDB(MPNode* parentNodePt, MPNode* childNodePt, Common::A
     }
 
     /* If we arrived here, it means we are the last node */
-    qDebug() << "Added in last position";
+    qTraceMmm() << "Added in last position";
     tempChildNodePt->setNextChildAddress(childNodePt->getAddress(), childNodePt->getVirtualAddress());
     childNodePt->setPreviousChildAddress(tempChildNodePt->getAddress(), tempChildNodePt->getVirtualAddress());
     childNodePt->setNextChildAddress(MPNode::EmptyAddress);
@@ -2890,6 +2959,19 @@ bool MPDevice::checkLoadedNodes(bool checkCredentials, bool checkData, bool repa
 
     qInfo() << "Checking database...";
 
+    /* Check a snapshot of the graphs first, the walk below is only needed
+     * to tag the nodes and apply the repairs when issues were found */
+    const MPNodeGraphChecker::RepairPlan plan = checkNodeGraphs(checkCredentials, checkData);
+    if (plan.isEmpty())
+    {
+        qInfo() << "Database check OK";
+        return true;
+    }
+    for (const auto &issue: plan)
+    {
+        qDebug() << "Graph check:" << MPNodeGraphChecker::issueToString(issue);
+    }
+
     /* Tag pointed nodes, also detects DB errors */
     return_bool = tagPointedNodes(checkCredentials, checkData, repairAllowed);
     return_bool &= tagPointedNodes(checkCredentials, checkData, repairAllowed, Common::WEBAUTHN_ADDR_IDX);
@@ -3024,6 +3106,77 @@ bool MPDevice::checkLoadedNodes(bool checkCredentials, bool checkData, bool repa
     return return_bool;
 }
 
+/* Same scope as the checks done by checkLoadedNodes() */
+MPNodeGraphChecker::RepairPlan MPDevice::checkNodeGraphs(bool checkCredentials, bool checkData)
+{
+    MPNodeGraphChecker checker;
+    if (checkCredentials)
+    {
+        MPNodeGraphChecker::GraphSnapshot credentials = snapshotNodeGraph(loginNodes, loginChildNodes, startNode[Common::CRED_ADDR_IDX], virtualStartNode[Common::CRED_ADDR_IDX], false);
+        credentials.reportOrphans = true;
+        checker.setGraph(MPNodeGraphChecker::CredentialGraph, credentials);
+        checker.setFavorites(favoritesAddrs);
+
+        /* The webauthn chain is followed on every device, its orphans are only looked for on the BLE */
+        MPNodeGraphChecker::GraphSnapshot webauthn = snapshotNodeGraph(webAuthnLoginNodes, webAuthnLoginChildNodes, startNode[Common::WEBAUTHN_ADDR_IDX], virtualStartNode[Common::WEBAUTHN_ADDR_IDX], false);
+        webauthn.reportOrphans = isBLE();
+        checker.setGraph(MPNodeGraphChecker::WebAuthnGraph, webauthn);
+    }
+    if (checkData)
+    {
+        MPNodeGraphChecker::GraphSnapshot data = snapshotNodeGraph(dataNodes, dataChildNodes, startDataNode, virtualDataStartNode, true);
+        data.reportOrphans = true;
+        checker.setGraph(MPNodeGraphChecker::DataGraph, data);
+    }
+    return checker.run();
+}
+
+MPNodeGraphChecker::GraphSnapshot MPDevice::snapshotNodeGraph(const NodeList &parents, const NodeList &children, const QByteArray &startAddress, quint32 startVirtualAddress, bool isDataGraph)
+{
+    MPNodeGraphChecker::GraphSnapshot snapshot;
+    snapshot.enabled = true;
+    snapshot.checkPreviousChild = !isDataGraph;
+    snapshot.start.address = startAddress;
+    snapshot.start.virtualAddress = startVirtualAddress;
+
+    snapshot.parents.reserve(parents.size());
+    for (const MPNode *node: parents)
+    {
+        MPNodeGraphChecker::Node parent;
+        parent.address = node->getAddress();
+        parent.virtualAddress = node->getVirtualAddress();
+        parent.next.address = node->getNextParentAddress();
+        parent.next.virtualAddress = node->getNextParentVirtualAddress();
+        parent.previous.address = node->getPreviousParentAddress();
+        parent.previous.virtualAddress = node->getPreviousParentVirtualAddress();
+        parent.firstChild.address = node->getStartChildAddress();
+        parent.firstChild.virtualAddress = node->getStartChildVirtualAddress();
+        snapshot.parents << parent;
+    }
+
+    snapshot.children.reserve(children.size());
+    for (const MPNode *node: children)
+    {
+        MPNodeGraphChecker::Node child;
+        child.address = node->getAddress();
+        child.virtualAddress = node->getVirtualAddress();
+        if (isDataGraph)
+        {
+            child.next.address = node->getNextChildDataAddress();
+        }
+        else
+        {
+            child.next.address = node->getNextChildAddress();
+            child.previous.address = node->getPreviousChildAddress();
+            child.previous.virtualAddress = node->getPreviousChildVirtualAddress();
+        }
+        child.next.virtualAddress = node->getNextChildVirtualAddress();
+        snapshot.children << child;
+    }
+
+    return snapshot;
+}
+
 void MPDevice::checkLoadedLoginNodes(quint32 &parentNum, quint32 &childNum, bool repairAllowed, Common::AddressType addrType)
 {
     const bool isCred = addrType == Common::CRED_ADDR_IDX;
@@ -3068,10 +3221,12 @@ void MPDevice::addWriteNodePacketToJob(AsyncJobs *jobs, const QByteArray& addres
     for (auto packet : pMesProt->createWriteNodePackets(data, address))
     {
         jobs->append(new MPCommandJob(this, MPCmd::WRITE_FLASH_NODE, packet,
-            [this, writeCallback](const QByteArray &data, bool &) -> bool
+            [this, jobs, writeCallback](const QByteArray &data, bool &) -> bool
         {
             if (pMesProt->getFirstPayloadByte(data) == 0)
             {
+                /* Tells a refused write from a dropped link, see generateSavePackets */
+                jobs->setCurrentJobError("Couldn't Write In Flash");
                 qCritical() << "Couldn't Write In Flash";
                 return false;
             }
@@ -3082,9 +3237,190 @@ void MPDevice::addWriteNodePacketToJob(AsyncJobs *jobs, const QByteArray& addres
             }
         }));
 
-        if (AppDaemon::isDebugDev())
-            qDebug() << "Write node packet #" << static_cast<quint8>(packet[2]) << " : " << packet.toHex();
+        qTraceMmm() << "Write node packet #" << static_cast<quint8>(packet[2]) << " : " << packet.toHex();
+    }
+}
+
+void MPDevice::addWriteBatchToJob(AsyncJobs *jobs, MPNodeWriteBatch &writes, std::function<void(void)> writeCallback)
+{
+    for (const auto &write : writes.takeSorted())
+    {
+        const int journalIndex = saveJournal.addNodeWrite(write.first, write.second);
+        addWriteNodePacketToJob(jobs, write.first, write.second, writeCallback);
+        addJournalCheckpointToJob(jobs, journalIndex);
+    }
+}
+
+void MPDevice::addJournaledCommandToJob(AsyncJobs *jobs, MPCmd::Command cmd, const QByteArray &data)
+{
+    addCheckpointedCommandToJob(jobs, cmd, data, saveJournal.addCommand(cmd, data));
+}
+
+void MPDevice::addCheckpointedCommandToJob(AsyncJobs *jobs, MPCmd::Command cmd, const QByteArray &data, int journalIndex)
+{
+    if (journalIndex < 0)
+    {
+        jobs->append(new MPCommandJob(this, cmd, data, pMesProt->getDefaultFuncDone()));
+        return;
+    }
+
+    const AsyncFuncDone funcDone = pMesProt->getDefaultFuncDone();
+    jobs->append(new MPCommandJob(this, cmd, data,
+                                  [this, jobs, funcDone, journalIndex](const QByteArray &data, bool &done) -> bool
+    {
+        if (!funcDone(data, done))
+        {
+            jobs->setCurrentJobError("Device refused a journaled command");
+            return false;
+        }
+        saveJournal.markDone(journalIndex);
+        return true;
+    }));
+}
+
+void MPDevice::addJournalCheckpointToJob(AsyncJobs *jobs, int journalIndex)
+{
+    if (journalIndex < 0)
+    {
+        return;
+    }
+
+    /* All the packets of the node were acknowledged at this point */
+    CustomJob *checkpointJob = new CustomJob(this);
+    checkpointJob->setWork([this, checkpointJob, journalIndex]()
+    {
+        saveJournal.markDone(journalIndex);
+        emit checkpointJob->done(QByteArray());
+    });
+    jobs->append(checkpointJob);
+}
+
+void MPDevice::appendJournalReplay(AsyncJobs *jobs, int fromIndex)
+{
+    const QVector<MPSaveJournal::Entry> &entries = saveJournal.entries();
+    for (int i = fromIndex; i < entries.size(); i++)
+    {
+        if (entries[i].isNodeWrite())
+        {
+            addWriteNodePacketToJob(jobs, entries[i].address, entries[i].data, [](){});
+            addJournalCheckpointToJob(jobs, i);
+        }
+        else
+        {
+            addCheckpointedCommandToJob(jobs, static_cast<MPCmd::Command>(entries[i].cmd), entries[i].data, i);
+        }
+    }
+}
+
+void MPDevice::resumeInterruptedSave()
+{
+    if (saveResumeRunning || get_memMgmtMode() || !saveJournal.loadPending())
+    {
+        return;
+    }
+
+    if (saveJournal.isBLE() != isBLE())
+    {
+        qInfo() << "Interrupted save was made on another device type, not resuming it here";
+        return;
+    }
+
+    /* Device must still hold the database we were writing to */
+    const bool saveNotStarted = get_credentialsDbChangeNumber() == saveJournal.credChangeBefore() &&
+                                get_dataDbChangeNumber() == saveJournal.dataChangeBefore();
+    const bool saveStarted = get_credentialsDbChangeNumber() == saveJournal.credChangeAfter() &&
+                             get_dataDbChangeNumber() == saveJournal.dataChangeAfter();
+    if (!saveNotStarted && !saveStarted)
+    {
+        qWarning() << "Database changed since the interrupted save, dropping its journal";
+        saveJournal.finish();
+        return;
+    }
+
+    if (saveJournal.newAttempt() > MAX_SAVE_RESUME_ATTEMPTS)
+    {
+        qCritical() << "Interrupted save couldn't be resumed, please run an integrity check";
+        saveJournal.finish();
+        return;
+    }
+
+    const int nextEntry = saveJournal.nextEntry();
+    qInfo() << "Resuming interrupted save at write" << nextEntry << "of" << saveJournal.entries().size();
+    saveResumeRunning = true;
+
+    AsyncJobs *jobs = new AsyncJobs("Resuming interrupted save", this);
+    auto startMmmJob = new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone());
+    jobs->append(startMmmJob);
+
+    /* Change numbers are written first by a save, setting them again is harmless */
+    set_credentialsDbChangeNumber(saveJournal.credChangeAfter());
+    set_dataDbChangeNumber(saveJournal.dataChangeAfter());
+    updateChangeNumbers(jobs, Common::CredentialNumberChanged|Common::DataNumberChanged);
+
+    const QVector<MPSaveJournal::Entry> &entries = saveJournal.entries();
+    if (nextEntry < entries.size() && entries[nextEntry].isNodeWrite())
+    {
+        /* The node being written when the link dropped may have landed, read it back */
+        MPNode *pnode = pMesProt->createMPNode(this, entries[nextEntry].address);
+        jobs->append(new MPCommandJob(this, MPCmd::READ_FLASH_NODE,
+                                      entries[nextEntry].address,
+                                      [this, jobs, pnode, nextEntry](const QByteArray &data, bool &done) -> bool
+        {
+            if (pMesProt->getMessageSize(data) != 1)
+            {
+                pnode->appendData(pMesProt->getFullPayload(data));
+                if (!pnode->isDataLengthValid())
+                {
+                    done = false;
+                    return true;
+                }
+            }
+
+            const bool landed = pnode->getNodeData() == saveJournal.entries()[nextEntry].data;
+            pnode->deleteLater();
+            qDebug() << "Interrupted node write" << (landed ? "landed" : "didn't land");
+            if (landed)
+            {
+                saveJournal.markDone(nextEntry);
+            }
+            appendJournalReplay(jobs, landed ? nextEntry + 1 : nextEntry);
+            return true;
+        }));
+    }
+    else
+    {
+        appendJournalReplay(jobs, nextEntry);
     }
+
+    connect(jobs, &AsyncJobs::finished, [this](const QByteArray &)
+    {
+        qInfo() << "Interrupted save resumed and completed";
+        saveJournal.finish();
+        saveResumeRunning = false;
+        exitMemMgmtMode(false);
+        getChangeNumbers();
+    });
+
+    connect(jobs, &AsyncJobs::failed, [this, startMmmJob](AsyncJob *failedJob)
+    {
+        qCritical() << "Resuming interrupted save failed";
+        saveResumeRunning = false;
+        if (failedJob == startMmmJob)
+        {
+            /* Prompt declined, MMM wasn't entered. The journal is kept for the next attempt */
+            return;
+        }
+        if (failedJob && !failedJob->getErrorStr().isEmpty())
+        {
+            /* The device refused a write, replaying it again won't help */
+            qCritical() << "Dropping the save journal, please run an integrity check";
+            saveJournal.abort();
+        }
+        exitMemMgmtMode(false);
+    });
+
+    jobsQueue.enqueue(jobs);
+    runAndDequeueJobs();
 }
 
 /* Return true if packets need to be sent */
@@ -3107,6 +3443,13 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
         cbProgress(data);
     };
 
+    /* Writes are journaled on devices telling us their change numbers, see resumeInterruptedSave */
+    if (isFw12() || isBLE())
+    {
+        saveJournal.begin(isBLE(), credentialsDbChangeNumberClone, dataDbChangeNumberClone,
+                          get_credentialsDbChangeNumber(), get_dataDbChangeNumber());
+    }
+
     /* Change numbers */
     if (isFw12() || isBLE())
     {
@@ -3120,13 +3463,23 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
         }
     }
 
+    /*
+     * Node writes are grouped by flash page before being sent.
+     * New nodes are written before the nodes pointing to them, and
+     * removed nodes are erased once nothing points to them anymore,
+     * so an interrupted save never leaves a link to an unwritten node.
+     */
+    MPNodeWriteBatch newNodes;
+    MPNodeWriteBatch updatedNodes;
+    MPNodeWriteBatch removedNodes;
+
     /* First pass: check the nodes that changed or were added */
     if (tackleCreds)
     {
-        diagSavePacketsGenerated |= checkModifiedSavePacketNodes(jobs, dataWriteProgressCb, Common::CRED_ADDR_IDX);
+        diagSavePacketsGenerated |= checkModifiedSavePacketNodes(newNodes, updatedNodes, Common::CRED_ADDR_IDX);
         if (isBLE())
         {
-            diagSavePacketsGenerated |= checkModifiedSavePacketNodes(jobs, dataWriteProgressCb, Common::WEBAUTHN_ADDR_IDX);
+            diagSavePacketsGenerated |= checkModifiedSavePacketNodes(newNodes, updatedNodes, Common::WEBAUTHN_ADDR_IDX);
         }
     }
 
@@ -3140,14 +3493,14 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
             if (!temp_node_pointer)
             {
                 qDebug() << "Generating save packet for new data service" << nodelist_iterator->getService();
-                addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), nodelist_iterator->getNodeData(), dataWriteProgressCb);
+                newNodes.add(nodelist_iterator->getAddress(), nodelist_iterator->getNodeData());
                 diagSavePacketsGenerated = true;
                 progressTotal += 3;
             }
             else if (nodelist_iterator->getNodeData() != temp_node_pointer->getNodeData())
             {
                 qDebug() << "Generating save packet for updated data service" << nodelist_iterator->getService();
-                addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), nodelist_iterator->getNodeData(), dataWriteProgressCb);
+                updatedNodes.add(nodelist_iterator->getAddress(), nodelist_iterator->getNodeData());
                 diagSavePacketsGenerated = true;
                 progressTotal += 3;
             }
@@ -3160,7 +3513,7 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
             if (!temp_node_pointer)
             {
                 qDebug() << "Generating save packet for new data child node";
-                addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), nodelist_iterator->getNodeData(), dataWriteProgressCb);
+                newNodes.add(nodelist_iterator->getAddress(), nodelist_iterator->getNodeData());
                 diagSavePacketsGenerated = true;
                 progressTotal += 3;
             }
@@ -3169,22 +3522,57 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
                 qDebug() << "Generating save packet for updated data child node";
                 qDebug() << "Prev contents: " << temp_node_pointer->getNodeData().toHex();
                 qDebug() << "New  contents: " << nodelist_iterator->getNodeData().toHex();
-                addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), nodelist_iterator->getNodeData(), dataWriteProgressCb);
+                updatedNodes.add(nodelist_iterator->getAddress(), nodelist_iterator->getNodeData());
                 diagSavePacketsGenerated = true;
                 progressTotal += 3;
             }
         }
     }
 
+    addWriteBatchToJob(jobs, newNodes, dataWriteProgressCb);
+    addWriteBatchToJob(jobs, updatedNodes, dataWriteProgressCb);
+
     /* Second pass: check the nodes that were removed */
     if (tackleCreds)
     {
-        diagSavePacketsGenerated |= checkRemovedSavePacketNodes(jobs, dataWriteProgressCb, Common::CRED_ADDR_IDX);
+        diagSavePacketsGenerated |= checkRemovedSavePacketNodes(removedNodes, Common::CRED_ADDR_IDX);
         if (isBLE())
         {
-            diagSavePacketsGenerated |= checkRemovedSavePacketNodes(jobs, dataWriteProgressCb, Common::WEBAUTHN_ADDR_IDX);
+            diagSavePacketsGenerated |= checkRemovedSavePacketNodes(removedNodes, Common::WEBAUTHN_ADDR_IDX);
+        }
+    }
+    if (tackleData)
+    {
+        for (auto &nodelist_iterator: dataNodesClone)
+        {
+            /* See if we can find the same node in the clone list */
+            temp_node_pointer = findNodeWithAddressInList(dataNodes, nodelist_iterator->getAddress(), 0);
+
+            if (!temp_node_pointer)
+            {
+                qDebug() << "Generating delete packet for deleted data service" << nodelist_iterator->getService();
+                removedNodes.add(nodelist_iterator->getAddress(), QByteArray(MP_NODE_SIZE, 0xFF));
+                diagSavePacketsGenerated = true;
+                progressTotal += 3;
+            }
+        }
+        for (auto &nodelist_iterator: dataChildNodesClone)
+        {
+            /* See if we can find the same node in the clone list */
+            temp_node_pointer = findNodeWithAddressInList(dataChildNodes, nodelist_iterator->getAddress(), 0);
+
+            if (!temp_node_pointer)
+            {
+                qDebug() << "Generating delete packet for deleted data child node";
+                removedNodes.add(nodelist_iterator->getAddress(), QByteArray(MP_NODE_SIZE, 0xFF));
+                diagSavePacketsGenerated = true;
+                progressTotal += 3;
+            }
         }
+    }
 
+    if (tackleCreds)
+    {
         /* Diff favorites */
         for (qint32 i = 0; i < favoritesAddrs.length(); i++)
         {
@@ -3203,7 +3591,7 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
                     updateFavPacket.append(i);
                 }
                 updateFavPacket.append(favoritesAddrs[i]);
-                jobs->append(new MPCommandJob(this, MPCmd::SET_FAVORITE, updateFavPacket, pMesProt->getDefaultFuncDone()));
+                addJournaledCommandToJob(jobs, MPCmd::SET_FAVORITE, updateFavPacket);
             }
         }
 
@@ -3221,7 +3609,7 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
             {
                 setAddress = startNode[Common::CRED_ADDR_IDX];
             }
-            jobs->append(new MPCommandJob(this, MPCmd::SET_STARTING_PARENT, setAddress, pMesProt->getDefaultFuncDone()));
+            addJournaledCommandToJob(jobs, MPCmd::SET_STARTING_PARENT, setAddress);
         }
 
         if (isBLE() && startNode[Common::WEBAUTHN_ADDR_IDX] != startNodeClone[Common::WEBAUTHN_ADDR_IDX])
@@ -3229,53 +3617,28 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
             qDebug() << "Updating start node";
             diagSavePacketsGenerated = true;
             QByteArray setAddress = bleImpl->getStartAddressToSet(startNode, Common::WEBAUTHN_ADDR_IDX);
-            jobs->append(new MPCommandJob(this, MPCmd::SET_STARTING_PARENT, setAddress, pMesProt->getDefaultFuncDone()));
+            addJournaledCommandToJob(jobs, MPCmd::SET_STARTING_PARENT, setAddress);
         }
     }
     if (tackleData)
     {
-        for (auto &nodelist_iterator: dataNodesClone)
-        {
-            /* See if we can find the same node in the clone list */
-            temp_node_pointer = findNodeWithAddressInList(dataNodes, nodelist_iterator->getAddress(), 0);
-
-            if (!temp_node_pointer)
-            {
-                qDebug() << "Generating delete packet for deleted data service" << nodelist_iterator->getService();
-                addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), QByteArray(MP_NODE_SIZE, 0xFF), dataWriteProgressCb);
-                diagSavePacketsGenerated = true;
-                progressTotal += 3;
-            }
-        }
-        for (auto &nodelist_iterator: dataChildNodesClone)
-        {
-            /* See if we can find the same node in the clone list */
-            temp_node_pointer = findNodeWithAddressInList(dataChildNodes, nodelist_iterator->getAddress(), 0);
-
-            if (!temp_node_pointer)
-            {
-                qDebug() << "Generating delete packet for deleted data child node";
-                addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), QByteArray(MP_NODE_SIZE, 0xFF), dataWriteProgressCb);
-                diagSavePacketsGenerated = true;
-                progressTotal += 3;
-            }
-        }
-
         /* Diff start data node */
         if (startDataNode != startDataNodeClone)
         {
             qDebug() << "Updating start data node";
             diagSavePacketsGenerated = true;
-            jobs->append(new MPCommandJob(this, MPCmd::SET_DN_START_PARENT, startDataNode, pMesProt->getDefaultFuncDone()));
+            addJournaledCommandToJob(jobs, MPCmd::SET_DN_START_PARENT, startDataNode);
         }
     }
 
+    addWriteBatchToJob(jobs, removedNodes, dataWriteProgressCb);
+
     /* Diff ctr */
     if (ctrValue != ctrValueClone)
     {
         qDebug() << "Updating CTR value";
         diagSavePacketsGenerated = true;
-        jobs->append(new MPCommandJob(this, MPCmd::SET_CTRVALUE, ctrValue, pMesProt->getDefaultFuncDone()));
+        addJournaledCommandToJob(jobs, MPCmd::SET_CTRVALUE, ctrValue);
     }
 
     /* We need to diff cpz ctr values for firmwares running < v1.2 */
@@ -3295,23 +3658,44 @@ bool MPDevice::generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackl
         {
             qDebug() << "Adding missing cpzctr";
             diagSavePacketsGenerated = true;
-            jobs->append(new MPCommandJob(this, MPCmd::ADD_CARD_CPZ_CTR, cpzCtrValue[i], pMesProt->getDefaultFuncDone()));
+            addJournaledCommandToJob(jobs, MPCmd::ADD_CARD_CPZ_CTR, cpzCtrValue[i]);
         }
     }
 
     if (diagSavePacketsGenerated)
     {
         qInfo() << "Update packets were generated";
+        if (saveJournal.commit())
+        {
+            CustomJob *journalEndJob = new CustomJob(this);
+            journalEndJob->setWork([this, journalEndJob]()
+            {
+                saveJournal.finish();
+                emit journalEndJob->done(QByteArray());
+            });
+            jobs->append(journalEndJob);
+
+            /* Only timeouts and disconnections leave the journal to be resumed */
+            connect(jobs, &AsyncJobs::failed, this, [this](AsyncJob *failedJob)
+            {
+                if (failedJob && !failedJob->getErrorStr().isEmpty())
+                {
+                    qWarning() << "Save refused by the device, dropping its journal:" << failedJob->getErrorStr();
+                    saveJournal.abort();
+                }
+            });
+        }
     }
     else
     {
         qInfo() << "No need to generate update packets";
+        saveJournal.abort();
     }
 
     return diagSavePacketsGenerated;
 }
 
-bool MPDevice::checkModifiedSavePacketNodes(AsyncJobs *jobs, std::function<void()> writeCb, Common::AddressType addrType)
+bool MPDevice::checkModifiedSavePacketNodes(MPNodeWriteBatch &newNodes, MPNodeWriteBatch &updatedNodes, Common::AddressType addrType)
 {
     const bool isCred = addrType == Common::CRED_ADDR_IDX;
     NodeList& nodes = isCred ? loginNodes : webAuthnLoginNodes;
@@ -3329,7 +3713,7 @@ bool MPDevice::checkModifiedSavePacketNodes(AsyncJobs *jobs, std::function<void(
         {
             qDebug() << "Generating save packet for new service" << nodelist_iterator->getService();
             //qDebug() << "New  contents: " << nodelist_iterator->getNodeData().toHex();
-            addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), nodelist_iterator->getNodeData(), writeCb);
+            newNodes.add(nodelist_iterator->getAddress(), nodelist_iterator->getNodeData());
             savePacketGenerated = true;
             progressTotal += 3;
         }
@@ -3338,7 +3722,7 @@ bool MPDevice::checkModifiedSavePacketNodes(AsyncJobs *jobs, std::function<void(
             qDebug() << "Generating save packet for updated service" << nodelist_iterator->getService();
             //qDebug() << "Prev contents: " << temp_node_pointer->getNodeData().toHex();
             //qDebug() << "New  contents: " << nodelist_iterator->getNodeData().toHex();
-            addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), nodelist_iterator->getNodeData(), writeCb);
+            updatedNodes.add(nodelist_iterator->getAddress(), nodelist_iterator->getNodeData());
             savePacketGenerated = true;
             progressTotal += 3;
         }
@@ -3352,14 +3736,14 @@ bool MPDevice::checkModifiedSavePacketNodes(AsyncJobs *jobs, std::function<void(
         {
             qDebug() << "Generating save packet for new login" << nodelist_iterator->getLogin();
             //qDebug() << "New  contents: " << nodelist_iterator->getNodeData().toHex();
-            addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), nodelist_iterator->getNodeData(), writeCb);
+            newNodes.add(nodelist_iterator->getAddress(), nodelist_iterator->getNodeData());
             savePacketGenerated = true;
             progressTotal += 3;
         }
         else if (nodelist_iterator->getNodeData() != tmpNodePtr->getNodeData())
         {
             qDebug() << "Generating save packet for updated login" << nodelist_iterator->getLogin();
-            addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), nodelist_iterator->getNodeData(), writeCb);
+            updatedNodes.add(nodelist_iterator->getAddress(), nodelist_iterator->getNodeData());
             savePacketGenerated = true;
             progressTotal += 3;
         }
@@ -3367,7 +3751,7 @@ bool MPDevice::checkModifiedSavePacketNodes(AsyncJobs *jobs, std::function<void(
     return savePacketGenerated;
 }
 
-bool MPDevice::checkRemovedSavePacketNodes(AsyncJobs *jobs, std::function<void ()> writeCb, Common::AddressType addrType)
+bool MPDevice::checkRemovedSavePacketNodes(MPNodeWriteBatch &removedNodes, Common::AddressType addrType)
 {
     const bool isCred = addrType == Common::CRED_ADDR_IDX;
     NodeList& nodes = isCred ? loginNodes : webAuthnLoginNodes;
@@ -3384,7 +3768,7 @@ bool MPDevice::checkRemovedSavePacketNodes(AsyncJobs *jobs, std::function<void (
         if (!tmpNodePtr)
         {
             qDebug() << "Generating delete packet for deleted service" << nodelist_iterator->getService();
-            addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), QByteArray(getParentNodeSize(), 0xFF), writeCb);
+            removedNodes.add(nodelist_iterator->getAddress(), QByteArray(getParentNodeSize(), 0xFF));
             savePacketGenerated = true;
             progressTotal += 3;
         }
@@ -3397,7 +3781,7 @@ bool MPDevice::checkRemovedSavePacketNodes(AsyncJobs *jobs, std::function<void (
         if (!tmpNodePtr)
         {
             qDebug() << "Generating delete packet for deleted login" << nodelist_iterator->getLogin();
-            addWriteNodePacketToJob(jobs, nodelist_iterator->getAddress(), QByteArray(getChildNodeSize(), 0xFF), writeCb);
+            removedNodes.add(nodelist_iterator->getAddress(), QByteArray(getChildNodeSize(), 0xFF));
             savePacketGenerated = true;
             progressTotal += 3;
         }
@@ -3408,6 +3792,10 @@ bool MPDevice::checkRemovedSavePacketNodes(AsyncJobs *jobs, std::function<void (
 QByteArray MPDevice::getFreeAddress(quint32 virtualAddr)
 {
     const int virtAddr = static_cast<int>(virtualAddr);
+    if (virtAddr < placedAddresses.size() && !placedAddresses[virtAddr].isNull())
+    {
+        return placedAddresses[virtAddr];
+    }
     if (isBLE())
     {
         return bleImpl->getFreeAddressProvider().getFreeAddress(virtAddr);
@@ -3581,6 +3969,7 @@ void MPDevice::getCurrentCardCPZ()
         else
         {
             set_cardCPZ(pMesProt->getFullPayload(data));
+            saveJournal.setCardCPZ(get_cardCPZ());
             qDebug() << "Card CPZ: " << get_cardCPZ().toHex();
             if (filesCache.setCardCPZ(get_cardCPZ()))
             {
@@ -3654,6 +4043,9 @@ void MPDevice::getChangeNumbers()
         credentialsDbChangeNumberClone = credDbChangeNum;
         set_dataDbChangeNumber(dataDbChangeNum);
         dataDbChangeNumberClone = dataDbChangeNum;
+        changeNumbersLoaded = true;
+        serviceIndex.changeNumberUpdated(MPServiceIndex::CREDENTIALS, credDbChangeNum);
+        serviceIndex.changeNumberUpdated(MPServiceIndex::DATA, dataDbChangeNum);
         if (filesCache.setDbChangeNumber(dataDbChangeNum))
         {
             qDebug() << "dbChangeNumber set to file cache, emitting file cache changed";
@@ -3665,11 +4057,14 @@ void MPDevice::getChangeNumbers()
         return true;
     }));
 
-    connect(v12jobs, &AsyncJobs::finished, [](const QByteArray &)
+    connect(v12jobs, &AsyncJobs::finished, [this](const QByteArray &)
     {
         //data is last result
         //all jobs finished success
         qInfo() << "Finished loading change numbers";
+
+        //a save may have been cut by a disconnect
+        resumeInterruptedSave();
     });
 
     connect(v12jobs, &AsyncJobs::failed, [this](AsyncJob *)
@@ -3712,6 +4107,8 @@ void MPDevice::cancelUserRequest(const QString &reqid)
         {
             qInfo() << "Removing request from queue";
             jobsQueue.removeAll(j);
+            //Let its callbacks answer the client and release their state
+            j->cancel("Request canceled");
             return;
         }
     }
@@ -3727,8 +4124,7 @@ void MPDevice::writeCancelRequest()
 
     qDebug() << "Platform send command: " << pMesProt->printCmd(cancelRequestCmd);
 
-    if (AppDaemon::isDebugDev())
-        qDebug() << "Message:" << ba.toHex();
+    qTracePacket() << "Message:" << ba.toHex();
 
     qDebug() << "Platform send command: " << QString("0x%1").arg(static_cast<quint8>(ba[1]), 2, 16, QChar('0'));
     if (isBLE())
@@ -3738,9 +4134,18 @@ void MPDevice::writeCancelRequest()
     platformWrite(ba);
 }
 
-void MPDevice::getCredential(QString service, const QString &login, const QString &fallback_service, const QString &reqid,
+void MPDevice::getCredential(QString service, const QString &login, QString fallback_service, const QString &reqid,
                              std::function<void(bool success, QString errstr, const QString &_service, const QString &login, const QString &pass, const QString &desc)> cb)
 {
+    //Skip the context query that is known to fail on the device
+    if (isServiceIndexValid(MPServiceIndex::CREDENTIALS) &&
+        !fallback_service.isEmpty() &&
+        serviceIndex.resolve(MPServiceIndex::CREDENTIALS, service, fallback_service) == fallback_service)
+    {
+        service = fallback_service;
+        fallback_service.clear();
+    }
+
     QString logInf = QStringLiteral("Ask for password for service: %1 login: %2 fallback_service: %3 reqid: %4")
                      .arg(service)
                      .arg(login)
@@ -3752,6 +4157,7 @@ void MPDevice::getCredential(QString service, const QString &login, const QStrin
         jobs = new AsyncJobs(logInf, this);
     else
         jobs = new AsyncJobs(logInf, reqid, this);
+    jobs->setPriority(AsyncJobs::PriorityInteractive);
 
     QByteArray sdata = pMesProt->toByteArray(service);
     sdata.append((char)0);
@@ -3942,6 +4348,7 @@ void MPDevice::delCredentialAndLeave(QString service, const QString &login,
 void MPDevice::getRandomNumber(std::function<void(bool success, QString errstr, const QByteArray &nums)> cb)
 {
     AsyncJobs *jobs = new AsyncJobs("Get random numbers from device", this);
+    jobs->setPriority(AsyncJobs::PriorityInteractive);
 
     auto cmd = new MPCommandJob(this, MPCmd::GET_RANDOM_NUMBER, QByteArray());
     cmd->setTimeout(5000);
@@ -4020,11 +4427,14 @@ void MPDevice::setCredential(QString service, const QString &login,
     //Force all service names to lowercase
     service = service.toLower();
 
+    serviceExistsRequests.invalidate(serviceExistsKey(false, service));
+
     QString logInf = QStringLiteral("Adding/Changing credential for service: %1 login: %2")
                      .arg(service)
                      .arg(login);
 
     AsyncJobs *jobs = new AsyncJobs(logInf, this);
+    jobs->setPriority(AsyncJobs::PriorityInteractive);
 
     QByteArray sdata = pMesProt->toByteArray(service);
     sdata.append((char)0);
@@ -4123,10 +4533,11 @@ void MPDevice::setCredential(QString service, const QString &login,
         }));
     }
 
-    connect(jobs, &AsyncJobs::finished, [this, cb](const QByteArray &)
+    connect(jobs, &AsyncJobs::finished, [this, cb, service](const QByteArray &)
     {
         //all jobs finished success
         qInfo() << "set_credential success";
+        serviceIndex.insert(MPServiceIndex::CREDENTIALS, service);
         cb(true, QString());
 
         // request change numbers in case they changed
@@ -4218,7 +4629,7 @@ bool MPDevice::getDataNodeCb(AsyncJobs *jobs,
     return true;
 }
 
-void MPDevice::getDataNode(QString service, const QString &fallback_service, const QString &reqid,
+void MPDevice::getDataNode(QString service, QString fallback_service, const QString &reqid,
                            std::function<void(bool success, QString errstr, QString serv, QByteArray rawData)> cb,
                            const MPDeviceProgressCb &cbProgress)
 {
@@ -4229,6 +4640,15 @@ void MPDevice::getDataNode(QString service, const QString &fallback_service, con
         return;
     }
 
+    //Skip the context query that is known to fail on the device
+    if (isServiceIndexValid(MPServiceIndex::DATA) &&
+        !fallback_service.isEmpty() &&
+        serviceIndex.resolve(MPServiceIndex::DATA, service, fallback_service) == fallback_service)
+    {
+        service = fallback_service;
+        fallback_service.clear();
+    }
+
     QString logInf = QStringLiteral("Ask for data node for service: %1 fallback_service: %2 reqid: %3")
                      .arg(service)
                      .arg(fallback_service)
@@ -4239,6 +4659,7 @@ void MPDevice::getDataNode(QString service, const QString &fallback_service, con
         jobs = new AsyncJobs(logInf, this);
     else
         jobs = new AsyncJobs(logInf, reqid, this);
+    jobs->setPriority(AsyncJobs::PriorityInteractive);
 
     QByteArray sdata = pMesProt->toByteArray(service);
     sdata.append((char)0);
@@ -4375,6 +4796,8 @@ void MPDevice::setDataNode(QString service, const QByteArray &nodeData,
     //Force all service names to lowercase
     service = service.toLower();
 
+    serviceExistsRequests.invalidate(serviceExistsKey(true, service));
+
     QString logInf = QStringLiteral("Set data node for service: %1")
                      .arg(service);
 
@@ -4427,6 +4850,7 @@ void MPDevice::setDataNode(QString service, const QByteArray &nodeData,
     {
         //all jobs finished success
         qInfo() << "set_data_node success";
+        serviceIndex.insert(MPServiceIndex::DATA, service);
         cb(true, QString());
 
         // update file cache
@@ -4576,8 +5000,141 @@ void  MPDevice::deleteDataNodesAndLeave(QStringList services,
     runAndDequeueJobs();
 }
 
+void MPDevice::placeNewNodes()
+{
+    placedAddresses.clear();
+    if (newAddressesNeededCounter == 0)
+    {
+        return;
+    }
+
+    /* Parent and child addresses come from different pools on BLE */
+    MPFlashPlacement parentSpace;
+    MPFlashPlacement bleChildSpace;
+    MPFlashPlacement &childSpace = isBLE() ? bleChildSpace : parentSpace;
+
+    QList<NodeList *> parentLists = {&loginNodes, &dataNodes};
+    QList<NodeList *> childLists = {&loginChildNodes, &dataChildNodes};
+    if (isBLE())
+    {
+        parentLists << &webAuthnLoginNodes;
+        childLists << &webAuthnLoginChildNodes;
+    }
+
+    /* The addresses the new nodes would get are the ones to share */
+    quint32 maxVirtualAddress = 0;
+    const auto collect = [this, &maxVirtualAddress](const QList<NodeList *> &lists, MPFlashPlacement &space) -> bool
+    {
+        for (NodeList *list : lists)
+        {
+            for (MPNode *node : *list)
+            {
+                if (!node->getAddress().isNull())
+                {
+                    continue;
+                }
+                const QByteArray address = getFreeAddress(node->getVirtualAddress());
+                if (address.isEmpty())
+                {
+                    return false;
+                }
+                space.addFreeAddress(address);
+                maxVirtualAddress = qMax(maxVirtualAddress, node->getVirtualAddress());
+            }
+        }
+        return true;
+    };
+    if (!collect(parentLists, parentSpace) || !collect(childLists, childSpace))
+    {
+        qWarning() << "Missing free addresses, new nodes keep the device order";
+        return;
+    }
+
+    placedAddresses.resize(static_cast<int>(maxVirtualAddress) + 1);
+
+    const auto addressOf = [this](const QByteArray &address, quint32 virtualAddress) -> QByteArray
+    {
+        if (!address.isNull())
+        {
+            return address == MPNode::EmptyAddress ? QByteArray() : address;
+        }
+        return static_cast<int>(virtualAddress) < placedAddresses.size() ? placedAddresses[static_cast<int>(virtualAddress)] : QByteArray();
+    };
+    const auto pageOf = [](const QByteArray &address) -> int
+    {
+        return address.isEmpty() ? -1 : MPFlashPlacement::pageFromAddress(address);
+    };
+
+    /* New parents go next to the previous or next service */
+    for (NodeList *list : parentLists)
+    {
+        for (MPNode *node : *list)
+        {
+            if (!node->getAddress().isNull())
+            {
+                continue;
+            }
+            int page = pageOf(addressOf(node->getPreviousParentAddress(), node->getPreviousParentVirtualAddress()));
+            if (page < 0)
+            {
+                page = pageOf(addressOf(node->getNextParentAddress(), node->getNextParentVirtualAddress()));
+            }
+            placedAddresses[static_cast<int>(node->getVirtualAddress())] = parentSpace.take(page);
+        }
+    }
+
+    /* New children go next to the node before them in their parent chain */
+    for (int i = 0; i < parentLists.size(); i++)
+    {
+        const NodeList &childList = *childLists[i];
+        const bool isDataList = parentLists[i] == &dataNodes;
+        const MPNodeIndex childIndex(childList);
+        for (MPNode *parent : *parentLists[i])
+        {
+            QByteArray prevAddress = addressOf(parent->getAddress(), parent->getVirtualAddress());
+            QByteArray childAddress = parent->getStartChildAddress();
+            quint32 childVirtualAddress = parent->getStartChildVirtualAddress();
+
+            /* Bounded by the list size in case of a corrupted chain */
+            for (int walked = 0; walked < childList.size(); walked++)
+            {
+                if (childAddress == MPNode::EmptyAddress || (childAddress.isNull() && childVirtualAddress == 0))
+                {
+                    break;
+                }
+                MPNode *child = childIndex.find(childAddress, childVirtualAddress);
+                if (!child)
+                {
+                    break;
+                }
+                if (child->getAddress().isNull() && placedAddresses[static_cast<int>(child->getVirtualAddress())].isNull())
+                {
+                    placedAddresses[static_cast<int>(child->getVirtualAddress())] = childSpace.take(pageOf(prevAddress));
+                }
+                prevAddress = addressOf(child->getAddress(), child->getVirtualAddress());
+                childAddress = isDataList ? child->getNextChildDataAddress() : child->getNextChildAddress();
+                childVirtualAddress = child->getNextChildVirtualAddress();
+            }
+        }
+    }
+
+    /* Children not reachable from a parent */
+    for (NodeList *list : childLists)
+    {
+        for (MPNode *node : *list)
+        {
+            if (node->getAddress().isNull() && placedAddresses[static_cast<int>(node->getVirtualAddress())].isNull())
+            {
+                placedAddresses[static_cast<int>(node->getVirtualAddress())] = childSpace.take(-1);
+            }
+        }
+    }
+}
+
 void MPDevice::changeVirtualAddressesToFreeAddresses()
 {
+    placeNewNodes();
+
     if (virtualStartNode[Common::CRED_ADDR_IDX] != 0)
     {
         qDebug() << "Setting start node to " << getFreeAddress(virtualStartNode[Common::CRED_ADDR_IDX]).toHex();
@@ -4641,6 +5198,8 @@ void MPDevice::changeVirtualAddressesToFreeAddresses()
             if (i->getPreviousChildAddress().isNull()) i->setPreviousChildAddress(getFreeAddress(i->getPreviousChildVirtualAddress()));
         }
     }
+
+    placedAddresses.clear();
 }
 
 void MPDevice::updateChangeNumbers(AsyncJobs *jobs, quint8 flags)
@@ -4871,27 +5430,27 @@ QByteArray MPDevice::generateExportFileData(const QString &encryption)
     QJsonArray exportTopArray = QJsonArray();
 
     /* CTR */
-    exportTopArray.append(QJsonValue(Common::bytesToJsonObjectArray(ctrValue)));
+    exportTopArray.append(QJsonValue(Common::bytesToJsonCompact(ctrValue)));
 
     /* CPZ/CTR packets */
     QJsonArray cpzCtrQJsonArray = QJsonArray();
     for (qint32 i = 0; i < cpzCtrValue.size(); i++)
     {
-        cpzCtrQJsonArray.append(QJsonValue(Common::bytesToJsonObjectArray(cpzCtrValue[i])));
+        cpzCtrQJsonArray.append(QJsonValue(Common::bytesToJsonCompact(cpzCtrValue[i])));
     }
     exportTopArray.append(QJsonValue(cpzCtrQJsonArray));
 
     /* Starting parent */
-    exportTopArray.append(QJsonValue(Common::bytesToJson(startNode[Common::CRED_ADDR_IDX])));
+    exportTopArray.append(QJsonValue(Common::bytesToJsonCompact(startNode[Common::CRED_ADDR_IDX])));
 
     /* Data starting parent */
-    exportTopArray.append(QJsonValue(Common::bytesToJson(startDataNode)));
+    exportTopArray.append(QJsonValue(Common::bytesToJsonCompact(startDataNode)));
 
     /* Favorites */
     QJsonArray favQJsonArray = QJsonArray();
     for (qint32 i = 0; i < favoritesAddrs.size(); i++)
     {
-        favQJsonArray.append(QJsonValue(Common::bytesToJsonObjectArray(favoritesAddrs[i])));
+        favQJsonArray.append(QJsonValue(Common::bytesToJsonCompact(favoritesAddrs[i])));
     }
     exportTopArray.append(QJsonValue(favQJsonArray));
 
@@ -4900,9 +5459,9 @@ QByteArray MPDevice::generateExportFileData(const QString &encryption)
     for (qint32 i = 0; i < loginNodes.size(); i++)
     {
         QJsonObject nodeObject = QJsonObject();
-        nodeObject["address"] = QJsonValue(Common::bytesToJson(loginNodes[i]->getAddress()));
+        nodeObject["address"] = QJsonValue(Common::bytesToJsonCompact(loginNodes[i]->getAddress()));
         nodeObject["name"] = QJsonValue(loginNodes[i]->getService());
-        nodeObject["data"] = QJsonValue(Common::bytesToJsonObjectArray(loginNodes[i]->getNodeData()));
+        nodeObject["data"] = QJsonValue(Common::bytesToJsonCompact(loginNodes[i]->getNodeData()));
         nodeQJsonArray.append(QJsonValue(nodeObject));
     }
     exportTopArray.append(QJsonValue(nodeQJsonArray));
@@ -4912,9 +5471,9 @@ QByteArray MPDevice::generateExportFileData(const QString &encryption)
     for (qint32 i = 0; i < loginChildNodes.size(); i++)
     {
         QJsonObject nodeObject = QJsonObject();
-        nodeObject["address"] = QJsonValue(Common::bytesToJson(loginChildNodes[i]->getAddress()));
+        nodeObject["address"] = QJsonValue(Common::bytesToJsonCompact(loginChildNodes[i]->getAddress()));
         nodeObject["name"] = QJsonValue(loginChildNodes[i]->getLogin());
-        nodeObject["data"] = QJsonValue(Common::bytesToJsonObjectArray(loginChildNodes[i]->getNodeData()));
+        nodeObject["data"] = QJsonValue(Common::bytesToJsonCompact(loginChildNodes[i]->getNodeData()));
         nodeObject["pointed"] = QJsonValue(false);
         nodeQJsonArray.append(QJsonValue(nodeObject));
     }
@@ -4925,9 +5484,9 @@ QByteArray MPDevice::generateExportFileData(const QString &encryption)
     for (qint32 i = 0; i < dataNodes.size(); i++)
     {
         QJsonObject nodeObject = QJsonObject();
-        nodeObject["address"] = QJsonValue(Common::bytesToJson(dataNodes[i]->getAddress()));
+        nodeObject["address"] = QJsonValue(Common::bytesToJsonCompact(dataNodes[i]->getAddress()));
         nodeObject["name"] = QJsonValue(dataNodes[i]->getService());
-        nodeObject["data"] = QJsonValue(Common::bytesToJsonObjectArray(dataNodes[i]->getNodeData()));
+        nodeObject["data"] = QJsonValue(Common::bytesToJsonCompact(dataNodes[i]->getNodeData()));
         nodeQJsonArray.append(QJsonValue(nodeObject));
     }
     exportTopArray.append(QJsonValue(nodeQJsonArray));
@@ -4937,8 +5496,8 @@ QByteArray MPDevice::generateExportFileData(const QString &encryption)
     for (qint32 i = 0; i < dataChildNodes.size(); i++)
     {
         QJsonObject nodeObject = QJsonObject();
-        nodeObject["address"] = QJsonValue(Common::bytesToJson(dataChildNodes[i]->getAddress()));
-        nodeObject["data"] = QJsonValue(Common::bytesToJsonObjectArray(dataChildNodes[i]->getNodeData()));
+        nodeObject["address"] = QJsonValue(Common::bytesToJsonCompact(dataChildNodes[i]->getAddress()));
+        nodeObject["data"] = QJsonValue(Common::bytesToJsonCompact(dataChildNodes[i]->getNodeData()));
         nodeObject["pointed"] = QJsonValue(false);
         nodeQJsonArray.append(QJsonValue(nodeObject));
     }
@@ -4948,7 +5507,7 @@ QByteArray MPDevice::generateExportFileData(const QString &encryption)
     exportTopArray.append(QJsonValue(QString("moolticute")));
 
     /* bundle version */
-    exportTopArray.append(QJsonValue((qint64)1));
+    exportTopArray.append(QJsonValue((qint64)EXPORT_BUNDLE_VERSION));
 
     /* Credential change number */
     exportTopArray.append(QJsonValue((quint8)get_credentialsDbChangeNumber()));
@@ -5095,15 +5654,9 @@ void MPDevice::readExportNodes(QJsonArray &&nodes, ExportPayloadData id)
     {
         QJsonObject qjobject = nodes[i].toObject();
 
-        /* Fetch address */
-        QJsonArray serviceAddrArr = qjobject["address"].toArray();
-        QByteArray serviceAddr = QByteArray();
-        for (qint32 j = 0; j < serviceAddrArr.size(); j++) {serviceAddr.append(serviceAddrArr[j].toInt());}
-
-        /* Fetch core data */
-        QJsonObject dataObj = qjobject["data"].toObject();
-        QByteArray dataCore = QByteArray();
-        for (qint32 j = 0; j < dataObj.size(); j++) {dataCore.append(dataObj[QString::number(j)].toInt());}
+        /* Fetch address and core data, both legacy and compact encodings */
+        QByteArray serviceAddr = Common::jsonToBytes(qjobject["address"]);
+        QByteArray dataCore = Common::jsonToBytes(qjobject["data"]);
 
         /* Recreate node and add it to the list of imported nodes */
         MPNode* importedNode = pMesProt->createMPNode(qMove(dataCore), this, qMove(serviceAddr), 0);
@@ -5146,18 +5699,14 @@ bool MPDevice::readExportPayload(QJsonArray dataArray, QString &errorString)
     }
 
     /* Read CTR */
-    importedCtrValue = QByteArray();
-    auto qjobject = dataArray[EXPORT_CTR_INDEX].toObject();
-    for (qint32 i = 0; i < qjobject.size(); i++) {importedCtrValue.append(qjobject[QString::number(i)].toInt());}
+    importedCtrValue = Common::jsonToBytes(dataArray[EXPORT_CTR_INDEX]);
     qDebug() << "Imported CTR: " << importedCtrValue.toHex();
 
     /* Read CPZ CTR values */
     auto qjarray = dataArray[EXPORT_CPZ_CTR_INDEX].toArray();
     for (qint32 i = 0; i < qjarray.size(); i++)
     {
-        qjobject = qjarray[i].toObject();
-        QByteArray qbarray = QByteArray();
-        for (qint32 j = 0; j < qjobject.size(); j++) {qbarray.append(qjobject[QString::number(j)].toInt());}
+        QByteArray qbarray = Common::jsonToBytes(qjarray[i]);
         qDebug() << "Imported CPZ/CTR value : " << qbarray.toHex();
         importedCpzCtrValue.append(qbarray);
     }
@@ -5194,24 +5743,18 @@ bool MPDevice::readExportPayload(QJsonArray dataArray, QString &errorString)
     }
 
     /* Read Starting Parent */
-    importedStartNode = QByteArray();
-    qjarray = dataArray[EXPORT_STARTING_PARENT_INDEX].toArray();
-    for (qint32 i = 0; i < qjarray.size(); i++) {importedStartNode.append(qjarray[i].toInt());}
+    importedStartNode = Common::jsonToBytes(dataArray[EXPORT_STARTING_PARENT_INDEX]);
     qDebug() << "Imported start node: " << importedStartNode.toHex();
 
     /* Read Data Starting Parent */
-    importedStartDataNode = QByteArray();
-    qjarray = dataArray[EXPORT_DATA_STARTING_PARENT_INDEX].toArray();
-    for (qint32 i = 0; i < qjarray.size(); i++) {importedStartDataNode.append(qjarray[i].toInt());}
+    importedStartDataNode = Common::jsonToBytes(dataArray[EXPORT_DATA_STARTING_PARENT_INDEX]);
     qDebug() << "Imported data start node: " << importedStartDataNode.toHex();
 
     /* Read favorites */
     qjarray = dataArray[EXPORT_FAVORITES_INDEX].toArray();
     for (qint32 i = 0; i < qjarray.size(); i++)
     {
-        qjobject = qjarray[i].toObject();
-        QByteArray qbarray = QByteArray();
-        for (qint32 j = 0; j < qjobject.size(); j++) {qbarray.append(qjobject[QString::number(j)].toInt());}
+        QByteArray qbarray = Common::jsonToBytes(qjarray[i]);
         qDebug() << "Imported favorite " << i << " : " << qbarray.toHex();
         importedFavoritesAddrs.append(qbarray);
     }
@@ -5294,6 +5837,10 @@ void MPDevice::cleanMMMVars(void)
     clearAndDelete(dataNodesClone);
     favoritesAddrsClone.clear();
     freeAddresses.clear();
+    placedAddresses.clear();
+    sweepScan = false;
+    sweepAddresses.clear();
+    freeBlockMap.clear();
     if (isBLE())
     {
         clearAndDelete(webAuthnLoginChildNodes);
@@ -5308,6 +5855,7 @@ void MPDevice::startImportFileMerging(const MPDeviceProgressCb &cbProgress, Mess
 {
     /* New job for starting MMM */
     AsyncJobs *jobs = new AsyncJobs("Starting MMM mode for import file merging", this);
+    jobs->setPriority(AsyncJobs::PriorityBulk);
 
     /* Ask device to go into MMM first */
     jobs->append(new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone()));
@@ -5557,136 +6105,125 @@ bool MPDevice::checkImportedLoginNodes(const MessageHandlerCb &cb, Common::Addre
     NodeList& importChildNodes = isCred ? importedLoginChildNodes : importedWebauthnLoginChildNodes;
     NodeList& nodes = isCred ? loginNodes : webAuthnLoginNodes;
     NodeList& childNodes = isCred? loginChildNodes : webAuthnLoginChildNodes;
+
+    /* Index both sides once, then join imported nodes against ours */
+    QHash<QByteArray, MPNode*> parentsByCoreData;
+    parentsByCoreData.reserve(nodes.size());
+    for (MPNode* node: nodes)
+    {
+        const QByteArray coreData = node->getLoginNodeData();
+        if (!parentsByCoreData.contains(coreData))
+        {
+            parentsByCoreData.insert(coreData, node);
+        }
+    }
+    MPNodeIndex importChildIndex(importChildNodes);
+    MPNodeIndex childIndex(childNodes);
+    MPChildLoginIndex childLoginIndex(childIndex);
+    int newNodes = 0, changedNodes = 0, unchangedNodes = 0;
+
     /// Find the nodes we don't have in memory or that have been changed
     for (qint32 i = 0; i < importNodes.size(); i++)
     {
-        bool service_node_found = false;
+        MPNode* matched_parent_node = parentsByCoreData.value(importNodes[i]->getLoginNodeData(), nullptr);
 
-        // Loop in the memory nodes to compare data
-        for (qint32 j = 0; j < nodes.size(); j++)
+        if (matched_parent_node)
         {
-            if (importNodes[i]->getLoginNodeData() == nodes[j]->getLoginNodeData())
+            // We found a parent node that has the same core data (doesn't mean the same prev / next node though!)
+            //qDebug() << "Parent node core data match for " << importNodes[i]->getService();
+            matched_parent_node->setMergeTagged();
+
+            // Next step is to check if the children are the same
+            quint32 cur_import_child_node_addr_v = importNodes[i]->getStartChildVirtualAddress();
+            QByteArray cur_import_child_node_addr = importNodes[i]->getStartChildAddress();
+            quint32 matched_parent_first_child_v = matched_parent_node->getStartChildVirtualAddress();
+            QByteArray matched_parent_first_child = matched_parent_node->getStartChildAddress();
+
+            /* Special case: parent doesn't have children but we do */
+            if (((cur_import_child_node_addr == MPNode::EmptyAddress) || (cur_import_child_node_addr.isNull() && cur_import_child_node_addr_v == 0)) && ((matched_parent_first_child != MPNode::EmptyAddress) || (matched_parent_first_child.isNull() && matched_parent_first_child_v != 0)))
             {
-                // We found a parent node that has the same core data (doesn't mean the same prev / next node though!)
-                //qDebug() << "Parent node core data match for " << importNodes[i]->getService();
-                nodes[j]->setMergeTagged();
-                service_node_found = true;
+                matched_parent_node->setStartChildAddress(MPNode::EmptyAddress);
+            }
+
+            //qDebug() << "First child address for imported node: " << cur_import_child_node_addr.toHex() << " , for own node: " << matched_parent_first_child.toHex();
+            while ((cur_import_child_node_addr != MPNode::EmptyAddress) || (cur_import_child_node_addr.isNull() && cur_import_child_node_addr_v != 0))
+            {
+                // Find the imported child node in our list
+                MPNode* imported_child_node = importChildIndex.find(cur_import_child_node_addr, cur_import_child_node_addr_v);
 
-                // Next step is to check if the children are the same
-                quint32 cur_import_child_node_addr_v = importNodes[i]->getStartChildVirtualAddress();
-                QByteArray cur_import_child_node_addr = importNodes[i]->getStartChildAddress();
-                quint32 matched_parent_first_child_v = nodes[j]->getStartChildVirtualAddress();
-                QByteArray matched_parent_first_child = nodes[j]->getStartChildAddress();
+                // Check if we actually found the node
+                if (!imported_child_node)
+                {
+                    cleanImportedVars();
+                    exitMemMgmtMode(false);
+                    cb(false, "Couldn't Import Database: Corrupted Export File");
+                    qCritical() << "Couldn't find imported child node in our list (corrupted import file?)";
+                    return false;
+                }
 
-                /* Special case: parent doesn't have children but we do */
-                if (((cur_import_child_node_addr == MPNode::EmptyAddress) || (cur_import_child_node_addr.isNull() && cur_import_child_node_addr_v == 0)) && ((matched_parent_first_child != MPNode::EmptyAddress) || (matched_parent_first_child.isNull() && matched_parent_first_child_v != 0)))
+                // Try to find the match between the child nodes of the matched parent
+                MPNode* cur_child_node = nullptr;
+                if (!childLoginIndex.find(matched_parent_node, imported_child_node->getLogin(), cur_child_node))
                 {
-                    nodes[j]->setStartChildAddress(MPNode::EmptyAddress);
+                    cleanImportedVars();
+                    exitMemMgmtMode(false);
+                    cb(false, "Couldn't Import Database: Please Run Integrity Check");
+                    qCritical() << "Couldn't find child node in our list (bad node reading?)";
+                    return false;
                 }
 
-                //qDebug() << "First child address for imported node: " << cur_import_child_node_addr.toHex() << " , for own node: " << matched_parent_first_child.toHex();
-                while ((cur_import_child_node_addr != MPNode::EmptyAddress) || (cur_import_child_node_addr.isNull() && cur_import_child_node_addr_v != 0))
+                if (cur_child_node)
                 {
-                    // Find the imported child node in our list
-                    MPNode* imported_child_node = findNodeWithAddressInList(importChildNodes, cur_import_child_node_addr, cur_import_child_node_addr_v);
+                    // We have a match between imported login node & current login node
+                    cur_child_node->setMergeTagged();
 
-                    // Check if we actually found the node
-                    if (!imported_child_node)
+                    if (cur_child_node->getLoginChildNodeData() == imported_child_node->getLoginChildNodeData())
                     {
-                        cleanImportedVars();
-                        exitMemMgmtMode(false);
-                        cb(false, "Couldn't Import Database: Corrupted Export File");
-                        qCritical() << "Couldn't find imported child node in our list (corrupted import file?)";
-                        return false;
+                        ++unchangedNodes;
                     }
-
-                    // We found the imported child, now we need to find the one that matches
-                    //qDebug() << "Looking for child " + imported_child_node->getLogin() + " in the Mooltipass";
-
-                    // Try to find the match between the child nodes of the matched parent
-                    bool matched_login_found = false;
-                    QByteArray matched_parent_next_child = QByteArray(matched_parent_first_child);
-                    quint32 matched_parent_next_child_v = matched_parent_first_child_v;
-                    while (((matched_parent_next_child != MPNode::EmptyAddress) || (matched_parent_next_child.isNull() && matched_parent_next_child_v != 0)) && (matched_login_found == false))
+                    else
                     {
-                        // Find the child node at this address
-                        MPNode* cur_child_node = findNodeWithAddressInList(childNodes, matched_parent_next_child, matched_parent_next_child_v);
-
-                        if (!cur_child_node)
-                        {
-                            cleanImportedVars();
-                            exitMemMgmtMode(false);
-                            cb(false, "Couldn't Import Database: Please Run Integrity Check");
-                            qCritical() << "Couldn't find child node in our list (bad node reading?)";
-                            return false;
-                        }
-
-                        // We found the child, now we can compare the login name
-                        if (cur_child_node->getLogin() == imported_child_node->getLogin())
-                        {
-                            // We have a match between imported login node & current login node
-                            //qDebug() << "Child found in the mooltipass, comparing rest of the data";
-                            cur_child_node->setMergeTagged();
-                            matched_login_found = true;
-
-                            if (cur_child_node->getLoginChildNodeData() == imported_child_node->getLoginChildNodeData())
-                            {
-                                //qDebug() << importNodes[i]->getService() << " : child core data match for child " << imported_child_node->getLogin() << " , nothing to do";
-                            }
-                            else
-                            {
-                                // Data mismatch, overwrite the important part
-                                qDebug() << importNodes[i]->getService() << " : child core data mismatch for child " << imported_child_node->getLogin() << " , updating...";
-                                cur_child_node->setLoginChildNodeData(imported_child_node->getNodeFlags(), imported_child_node->getLoginChildNodeData());
-                            }
-                            break;
-                        }
-                        else
-                        {
-                            // Not a match, load next child address in var
-                            matched_parent_next_child = cur_child_node->getNextChildAddress();
-                            matched_parent_next_child_v = cur_child_node->getNextChildVirtualAddress();
-                        }
+                        // Data mismatch, overwrite the important part
+                        qDebug() << importNodes[i]->getService() << " : child core data mismatch for child " << imported_child_node->getLogin() << " , updating...";
+                        cur_child_node->setLoginChildNodeData(imported_child_node->getNodeFlags(), imported_child_node->getLoginChildNodeData());
+                        ++changedNodes;
                     }
-
+                }
+                else
+                {
                     // If we couldn't find the child node, we have to add it
-                    if(matched_login_found == false)
-                    {
-                        qDebug() << importNodes[i]->getService() << " : adding new child " << imported_child_node->getLogin() << " in the mooltipass...";
+                    qDebug() << importNodes[i]->getService() << " : adding new child " << imported_child_node->getLogin() << " in the mooltipass...";
 
-                        /* Increment new addresses counter */
-                        incrementNeededAddresses(MPNode::NodeChild);
+                    /* Increment new addresses counter */
+                    incrementNeededAddresses(MPNode::NodeChild);
 
-                        /* Create new node with null address and virtual address set to our counter value */
-                        MPNode* newChildNodePt = pMesProt->createMPNode(QByteArray(getChildNodeSize(), 0), this, QByteArray(), newAddressesNeededCounter);
-                        newChildNodePt->setType(MPNode::NodeChild);
-                        newChildNodePt->setLoginChildNodeData(imported_child_node->getNodeFlags(), imported_child_node->getLoginChildNodeData());
-                        newChildNodePt->setMergeTagged();
+                    /* Create new node with null address and virtual address set to our counter value */
+                    MPNode* newChildNodePt = pMesProt->createMPNode(QByteArray(getChildNodeSize(), 0), this, QByteArray(), newAddressesNeededCounter);
+                    newChildNodePt->setType(MPNode::NodeChild);
+                    newChildNodePt->setLoginChildNodeData(imported_child_node->getNodeFlags(), imported_child_node->getLoginChildNodeData());
+                    newChildNodePt->setMergeTagged();
 
-                        /* Add node to list */
-                        childNodes.append(newChildNodePt);
-                        if (!addChildToDB(nodes[j], newChildNodePt, addrType))
-                        {
-                            cleanImportedVars();
-                            exitMemMgmtMode(false);
-                            cb(false, "Couldn't Import Database: Please Run Integrity Check");
-                            qCritical() << "Couldn't add new child node to DB (corrupted DB?)";
-                            return false;
-                        }
+                    /* Add node to list */
+                    childNodes.append(newChildNodePt);
+                    childIndex.insert(newChildNodePt);
+                    if (!addChildToDB(matched_parent_node, newChildNodePt, addrType))
+                    {
+                        cleanImportedVars();
+                        exitMemMgmtMode(false);
+                        cb(false, "Couldn't Import Database: Please Run Integrity Check");
+                        qCritical() << "Couldn't add new child node to DB (corrupted DB?)";
+                        return false;
                     }
-
-                    // Process the next imported child node
-                    cur_import_child_node_addr = imported_child_node->getNextChildAddress();
-                    cur_import_child_node_addr_v = imported_child_node->getNextChildVirtualAddress();
+                    childLoginIndex.insert(matched_parent_node, newChildNodePt);
+                    ++newNodes;
                 }
 
-                // Jump to next service node
-                break;
+                // Process the next imported child node
+                cur_import_child_node_addr = imported_child_node->getNextChildAddress();
+                cur_import_child_node_addr_v = imported_child_node->getNextChildVirtualAddress();
             }
         }
-
-        // Did we find the service core data?
-        if(service_node_found == false)
+        else
         {
            /* Increment new addresses counter */
            incrementNeededAddresses(MPNode::NodeParent);
@@ -5699,6 +6236,7 @@ bool MPDevice::checkImportedLoginNodes(const MessageHandlerCb &cb, Common::Addre
 
            /* Add node to list */
            nodes.append(newNodePt);
+           parentsByCoreData.insert(newNodePt->getLoginNodeData(), newNodePt);
            if (!addOrphanParentToDB(newNodePt, false, false, addrType))
            {
                cleanImportedVars();
@@ -5713,7 +6251,7 @@ bool MPDevice::checkImportedLoginNodes(const MessageHandlerCb &cb, Common::Addre
            while (curImportChildAddr != MPNode::EmptyAddress)
            {
                /* Find node in list */
-               MPNode* curImportChildPt = findNodeWithAddressInList(importChildNodes, curImportChildAddr);
+               MPNode* curImportChildPt = importChildIndex.find(curImportChildAddr);
 
                if (!curImportChildPt)
                {
@@ -5735,6 +6273,7 @@ bool MPDevice::checkImportedLoginNodes(const MessageHandlerCb &cb, Common::Addre
 
                /* Add node to list */
                childNodes.append(newChildNodePt);
+               childIndex.insert(newChildNodePt);
                if (!addChildToDB(newNodePt, newChildNodePt, addrType))
                {
                    cleanImportedVars();
@@ -5743,169 +6282,184 @@ bool MPDevice::checkImportedLoginNodes(const MessageHandlerCb &cb, Common::Addre
                    qCritical() << "Couldn't add new child node to DB (corrupted DB?)";
                    return false;
                }
+               childLoginIndex.insert(newNodePt, newChildNodePt);
+               ++newNodes;
 
                /* Go to the next child */
                curImportChildAddr = curImportChildPt->getNextChildAddress();
            }
         }
     }
+
+    qInfo() << "Login merge:" << newNodes << "new," << changedNodes << "changed," << unchangedNodes << "unchanged";
     return true;
 }
 
 bool MPDevice::checkImportedDataNodes(const MessageHandlerCb &cb)
 {
+    /* Index both sides once, then join imported nodes against ours */
+    using DataNodeKey = QPair<QString, QByteArray>;
+    QHash<DataNodeKey, MPNode*> parentsByServiceCtr;
+    parentsByServiceCtr.reserve(dataNodes.size());
+    for (MPNode* node: dataNodes)
+    {
+        const DataNodeKey key(node->getService(), node->getStartDataCtr());
+        if (!parentsByServiceCtr.contains(key))
+        {
+            parentsByServiceCtr.insert(key, node);
+        }
+    }
+    MPNodeIndex importChildIndex(importedDataChildNodes);
+    MPNodeIndex childIndex(dataChildNodes);
+
     /// Find the data nodes we don't have in memory or that have been changed
     for (qint32 i = 0; i < importedDataNodes.size(); i++)
     {
         bool service_node_found = false;
         quint32 encDataSize = 0;
 
-        // Loop in the memory nodes to compare data
-        for (qint32 j = 0; j < dataNodes.size(); j++)
+        MPNode* matched_parent_node = parentsByServiceCtr.value(DataNodeKey(importedDataNodes[i]->getService(), importedDataNodes[i]->getStartDataCtr()), nullptr);
+        if (matched_parent_node)
         {
-            if ((importedDataNodes[i]->getService() == dataNodes[j]->getService()) && (importedDataNodes[i]->getStartDataCtr() == dataNodes[j]->getStartDataCtr()))
+            // We found a parent data node that has the same core data (doesn't mean the same prev / next node though!)
+            qDebug() << "Data parent node core data match for " << importedDataNodes[i]->getService();
+            matched_parent_node->setMergeTagged();
+            service_node_found = true;
+
+            // Next step is to check if the children are the same
+            quint32 cur_import_child_node_addr_v = importedDataNodes[i]->getStartChildVirtualAddress();
+            QByteArray cur_import_child_node_addr = importedDataNodes[i]->getStartChildAddress();
+            quint32 cur_matched_child_node_addr_v = matched_parent_node->getStartChildVirtualAddress();
+            QByteArray cur_matched_child_node_addr = matched_parent_node->getStartChildAddress();
+            MPNode* prev_matched_child_node = nullptr;
+            MPNode* matched_child_node = nullptr;
+            bool data_match_ongoing = true;
+
+            /* Special case: parent doesn't have children but we do */
+            if (((cur_import_child_node_addr == MPNode::EmptyAddress) || (cur_import_child_node_addr.isNull() && cur_import_child_node_addr_v == 0)) && ((cur_matched_child_node_addr != MPNode::EmptyAddress) || (cur_matched_child_node_addr.isNull() && cur_matched_child_node_addr_v != 0)))
             {
-                // We found a parent data node that has the same core data (doesn't mean the same prev / next node though!)
-                qDebug() << "Data parent node core data match for " << importedDataNodes[i]->getService();
-                dataNodes[j]->setMergeTagged();
-                service_node_found = true;
+                matched_parent_node->setStartChildAddress(MPNode::EmptyAddress);
+            }
 
-                // Next step is to check if the children are the same
-                quint32 cur_import_child_node_addr_v = importedDataNodes[i]->getStartChildVirtualAddress();
-                QByteArray cur_import_child_node_addr = importedDataNodes[i]->getStartChildAddress();
-                quint32 cur_matched_child_node_addr_v = dataNodes[j]->getStartChildVirtualAddress();
-                QByteArray cur_matched_child_node_addr = dataNodes[j]->getStartChildAddress();
-                MPNode* prev_matched_child_node = nullptr;
-                MPNode* matched_child_node = nullptr;
-                bool data_match_ongoing = true;
+            //qDebug() << "First child address for imported data node: " << cur_import_child_node_addr.toHex() << " , for own node: " << matched_parent_first_child.toHex();
+            while ((cur_import_child_node_addr != MPNode::EmptyAddress) || (cur_import_child_node_addr.isNull() && cur_import_child_node_addr_v != 0))
+            {
+                // Find the imported child node in our list
+                MPNode* imported_child_node = importChildIndex.find(cur_import_child_node_addr, cur_import_child_node_addr_v);
+                encDataSize += MP_NODE_DATA_ENC_SIZE;
 
-                /* Special case: parent doesn't have children but we do */
-                if (((cur_import_child_node_addr == MPNode::EmptyAddress) || (cur_import_child_node_addr.isNull() && cur_import_child_node_addr_v == 0)) && ((cur_matched_child_node_addr != MPNode::EmptyAddress) || (cur_matched_child_node_addr.isNull() && cur_matched_child_node_addr_v != 0)))
+                // Check if we actually found the node
+                if (!imported_child_node)
                 {
-                    dataNodes[j]->setStartChildAddress(MPNode::EmptyAddress);
+                    cleanImportedVars();
+                    exitMemMgmtMode(false);
+                    cb(false, "Couldn't Import Database: Corrupted Import File");
+                    qCritical() << "Couldn't find imported data child node in our list (corrupted import file?)";
+                    return false;
                 }
 
-                //qDebug() << "First child address for imported data node: " << cur_import_child_node_addr.toHex() << " , for own node: " << matched_parent_first_child.toHex();
-                while ((cur_import_child_node_addr != MPNode::EmptyAddress) || (cur_import_child_node_addr.isNull() && cur_import_child_node_addr_v != 0))
+                // If we are still matching, check that we still can
+                if (data_match_ongoing)
                 {
-                    // Find the imported child node in our list
-                    MPNode* imported_child_node = findNodeWithAddressInList(importedDataChildNodes, cur_import_child_node_addr, cur_import_child_node_addr_v);
-                    encDataSize += MP_NODE_DATA_ENC_SIZE;
-
-                    // Check if we actually found the node
-                    if (!imported_child_node)
+                    if ((cur_matched_child_node_addr == MPNode::EmptyAddress) || (cur_matched_child_node_addr.isNull() && cur_matched_child_node_addr_v == 0))
                     {
-                        cleanImportedVars();
-                        exitMemMgmtMode(false);
-                        cb(false, "Couldn't Import Database: Corrupted Import File");
-                        qCritical() << "Couldn't find imported data child node in our list (corrupted import file?)";
-                        return false;
+                        /* No next node */
+                        qDebug() << "Matched imported data child node chain is longer than what we have";
+                        data_match_ongoing = false;
                     }
-
-                    // If we are still matching, check that we still can
-                    if (data_match_ongoing)
+                    else
                     {
-                        if ((cur_matched_child_node_addr == MPNode::EmptyAddress) || (cur_matched_child_node_addr.isNull() && cur_matched_child_node_addr_v == 0))
+                        matched_child_node = childIndex.find(cur_matched_child_node_addr, cur_matched_child_node_addr_v);
+
+                        // Check if we actually found the node
+                        if (!matched_child_node)
                         {
-                            /* No next node */
-                            qDebug() << "Matched imported data child node chain is longer than what we have";
-                            data_match_ongoing = false;
+                            cleanImportedVars();
+                            exitMemMgmtMode(false);
+                            cb(false, "Couldn't Import Database: Please Run Integrity Check");
+                            qCritical() << "Couldn't find imported data child node in our list (corrupted DB?)";
+                            return false;
                         }
-                        else
-                        {
-                            matched_child_node = findNodeWithAddressInList(dataChildNodes, cur_matched_child_node_addr, cur_matched_child_node_addr_v);
 
-                            // Check if we actually found the node
-                            if (!matched_child_node)
-                            {
-                                cleanImportedVars();
-                                exitMemMgmtMode(false);
-                                cb(false, "Couldn't Import Database: Please Run Integrity Check");
-                                qCritical() << "Couldn't find imported data child node in our list (corrupted DB?)";
-                                return false;
-                            }
+                        // Check for data match
+                        if (matched_child_node->getDataChildNodeData() != imported_child_node->getDataChildNodeData())
+                        {
+                            qDebug() << "Data child node mismatch for " << importedDataNodes[i]->getService();
+                            data_match_ongoing = false;
 
-                            // Check for data match
-                            if (matched_child_node->getDataChildNodeData() != imported_child_node->getDataChildNodeData())
+                            /* Chain broken, delete all following data blocks */
+                            while ((cur_matched_child_node_addr != MPNode::EmptyAddress) || (cur_matched_child_node_addr.isNull() && cur_matched_child_node_addr_v != 0))
                             {
-                                qDebug() << "Data child node mismatch for " << importedDataNodes[i]->getService();
-                                data_match_ongoing = false;
+                                matched_child_node = childIndex.find(cur_matched_child_node_addr, cur_matched_child_node_addr_v);
 
-                                /* Chain broken, delete all following data blocks */
-                                while ((cur_matched_child_node_addr != MPNode::EmptyAddress) || (cur_matched_child_node_addr.isNull() && cur_matched_child_node_addr_v != 0))
+                                // Check if we actually found the node
+                                if (!matched_child_node)
                                 {
-                                    matched_child_node = findNodeWithAddressInList(dataChildNodes, cur_matched_child_node_addr, cur_matched_child_node_addr_v);
-
-                                    // Check if we actually found the node
-                                    if (!matched_child_node)
-                                    {
-                                        cleanImportedVars();
-                                        exitMemMgmtMode(false);
-                                        cb(false, "Couldn't Import Database: Please Run Integrity Check");
-                                        qCritical() << "Couldn't find imported data child node in our list (corrupted DB?)";
-                                        return false;
-                                    }
-
-                                    /* Next item */
-                                    cur_matched_child_node_addr = matched_child_node->getNextChildDataAddress();
-                                    cur_matched_child_node_addr_v = matched_child_node->getNextChildVirtualAddress();
-
-                                    /* Delete current block */
-                                    dataChildNodes.removeOne(matched_child_node);
+                                    cleanImportedVars();
+                                    exitMemMgmtMode(false);
+                                    cb(false, "Couldn't Import Database: Please Run Integrity Check");
+                                    qCritical() << "Couldn't find imported data child node in our list (corrupted DB?)";
+                                    return false;
                                 }
-                            }
-                            else
-                            {
-                                matched_child_node->setMergeTagged();
-                            }
-                        }
-                    }
-
-                    // If we stopped matching the child nodes, add child node data
-                    if (!data_match_ongoing)
-                    {
-                        qDebug() << importedDataNodes[i]->getService() << " : appending child data in the mooltipass...";
-
-                        /* Increment new addresses counter */
-                        incrementNeededAddresses(MPNode::NodeChild);
 
-                        /* Create new node with null address and virtual address set to our counter value */
-                        MPNode* newDataChildNodePt = pMesProt->createMPNode(QByteArray(getChildNodeSize(), 0), this, QByteArray(), newAddressesNeededCounter);
-                        newDataChildNodePt->setType(MPNode::NodeChild);
-                        newDataChildNodePt->setDataChildNodeData(imported_child_node->getNodeFlags(), imported_child_node->getDataChildNodeData());
-                        newDataChildNodePt->setMergeTagged();
+                                /* Next item */
+                                cur_matched_child_node_addr = matched_child_node->getNextChildDataAddress();
+                                cur_matched_child_node_addr_v = matched_child_node->getNextChildVirtualAddress();
 
-                        /* Add node to list */
-                        dataChildNodes.append(newDataChildNodePt);
-                        if (!prev_matched_child_node)
-                        {
-                            /* First node */
-                            dataNodes[j]->setStartChildAddress(QByteArray(), newAddressesNeededCounter);
+                                /* Delete current block */
+                                childIndex.remove(matched_child_node);
+                                dataChildNodes.removeOne(matched_child_node);
+                            }
                         }
                         else
                         {
-                            prev_matched_child_node->setNextChildDataAddress(QByteArray(), newAddressesNeededCounter);
+                            matched_child_node->setMergeTagged();
                         }
-
-                        /* Update prev matched child node */
-                        prev_matched_child_node = newDataChildNodePt;
                     }
+                }
+
+                // If we stopped matching the child nodes, add child node data
+                if (!data_match_ongoing)
+                {
+                    qDebug() << importedDataNodes[i]->getService() << " : appending child data in the mooltipass...";
 
-                    // Fetch next matched child if comparison is still ongoing
-                    if (data_match_ongoing)
+                    /* Increment new addresses counter */
+                    incrementNeededAddresses(MPNode::NodeChild);
+
+                    /* Create new node with null address and virtual address set to our counter value */
+                    MPNode* newDataChildNodePt = pMesProt->createMPNode(QByteArray(getChildNodeSize(), 0), this, QByteArray(), newAddressesNeededCounter);
+                    newDataChildNodePt->setType(MPNode::NodeChild);
+                    newDataChildNodePt->setDataChildNodeData(imported_child_node->getNodeFlags(), imported_child_node->getDataChildNodeData());
+                    newDataChildNodePt->setMergeTagged();
+
+                    /* Add node to list */
+                    dataChildNodes.append(newDataChildNodePt);
+                    childIndex.insert(newDataChildNodePt);
+                    if (!prev_matched_child_node)
+                    {
+                        /* First node */
+                        matched_parent_node->setStartChildAddress(QByteArray(), newAddressesNeededCounter);
+                    }
+                    else
                     {
-                        prev_matched_child_node = matched_child_node;
-                        matched_child_node->setMergeTagged();
-                        cur_matched_child_node_addr = matched_child_node->getNextChildDataAddress();
-                        cur_matched_child_node_addr_v = matched_child_node->getNextChildVirtualAddress();
+                        prev_matched_child_node->setNextChildDataAddress(QByteArray(), newAddressesNeededCounter);
                     }
 
-                    cur_import_child_node_addr = imported_child_node->getNextChildDataAddress();
-                    cur_import_child_node_addr_v = imported_child_node->getNextChildVirtualAddress();
+                    /* Update prev matched child node */
+                    prev_matched_child_node = newDataChildNodePt;
                 }
 
-                // Jump to next service node
-                break;
+                // Fetch next matched child if comparison is still ongoing
+                if (data_match_ongoing)
+                {
+                    prev_matched_child_node = matched_child_node;
+                    matched_child_node->setMergeTagged();
+                    cur_matched_child_node_addr = matched_child_node->getNextChildDataAddress();
+                    cur_matched_child_node_addr_v = matched_child_node->getNextChildVirtualAddress();
+                }
+
+                cur_import_child_node_addr = imported_child_node->getNextChildDataAddress();
+                cur_import_child_node_addr_v = imported_child_node->getNextChildVirtualAddress();
             }
         }
 
@@ -5923,6 +6477,7 @@ bool MPDevice::checkImportedDataNodes(const MessageHandlerCb &cb)
 
            /* Add node to list */
            dataNodes.append(newNodePt);
+           parentsByServiceCtr.insert(DataNodeKey(newNodePt->getService(), newNodePt->getStartDataCtr()), newNodePt);
            if (!addOrphanParentToDB(newNodePt, true, false))
            {
                cleanImportedVars();
@@ -5938,7 +6493,7 @@ bool MPDevice::checkImportedDataNodes(const MessageHandlerCb &cb)
            while (curImportChildAddr != MPNode::EmptyAddress)
            {
                /* Find node in list */
-               MPNode* curImportChildPt = findNodeWithAddressInList(importedDataChildNodes, curImportChildAddr);
+               MPNode* curImportChildPt = importChildIndex.find(curImportChildAddr);
                encDataSize += MP_NODE_DATA_ENC_SIZE;
 
                if (!curImportChildPt)
@@ -5961,6 +6516,7 @@ bool MPDevice::checkImportedDataNodes(const MessageHandlerCb &cb)
 
                /* Add node to list */
                dataChildNodes.append(newDataChildNodePt);
+               childIndex.insert(newDataChildNodePt);
                if (!prev_added_child_node)
                {
                    /* First node */
@@ -6003,6 +6559,8 @@ bool MPDevice::finishImportFileMerging(QString &stringError, bool noDelete)
         }
 
         /* Now we check all our parents and childs for non merge tag */
+        MPNodeIndex dataChildIndex(dataChildNodes);
+        int deletedNodes = 0;
         QListIterator<MPNode*> j(dataNodes);
         while (j.hasNext())
         {
@@ -6023,7 +6581,7 @@ bool MPDevice::finishImportFileMerging(QString &stringError, bool noDelete)
             /* Check every children */
             while (curChildNodeAddr != MPNode::EmptyAddress)
             {
-                MPNode* curNode = findNodeWithAddressInList(dataChildNodes, curChildNodeAddr);
+                MPNode* curNode = dataChildIndex.find(curChildNodeAddr);
 
                 /* Safety checks */
                 if (!curNode)
@@ -6047,9 +6605,11 @@ bool MPDevice::finishImportFileMerging(QString &stringError, bool noDelete)
                     }
 
                     /* Delete child */
+                    dataChildIndex.remove(curNode);
                     dataChildNodes.removeOne(curNode);
                     nodeItem->removeChild(curNode);
                     delete(curNode);
+                    ++deletedNodes;
                 }
             }
 
@@ -6060,14 +6620,28 @@ bool MPDevice::finishImportFileMerging(QString &stringError, bool noDelete)
                 removeEmptyParentFromDB(nodeItem, true);
             }
         }
+        qInfo() << "Data merge:" << deletedNodes << "deleted";
     }
 
     /* Favorite syncing */
     qInfo() << "Syncing favorites...";
+    MPNodeIndex importedParentIndex(importedLoginNodes);
+    MPNodeIndex importedChildIndex(importedLoginChildNodes);
+    MPNodeIndex childIndex(loginChildNodes);
+    MPChildLoginIndex childLoginIndex(childIndex);
+    QHash<QString, MPNode*> parentsByService;
+    parentsByService.reserve(loginNodes.size());
+    for (MPNode* node: loginNodes)
+    {
+        if (!parentsByService.contains(node->getService()))
+        {
+            parentsByService.insert(node->getService(), node);
+        }
+    }
     for (qint32 i = 0; i < importedFavoritesAddrs.size(); i++)
     {
-        MPNode* importedCurParentNode = findNodeWithAddressInList(importedLoginNodes, importedFavoritesAddrs[i].mid(0, 2));
-        MPNode* importedCurChildNode = findNodeWithAddressInList(importedLoginChildNodes, importedFavoritesAddrs[i].mid(2,2));
+        MPNode* importedCurParentNode = importedParentIndex.find(importedFavoritesAddrs[i].mid(0, 2));
+        MPNode* importedCurChildNode = importedChildIndex.find(importedFavoritesAddrs[i].mid(2,2));
         QByteArray localCurParentNodeAddr = favoritesAddrs[i].mid(0, 2);
         QByteArray localCurChildNodeAddr = favoritesAddrs[i].mid(2, 2);
 
@@ -6083,11 +6657,11 @@ bool MPDevice::finishImportFileMerging(QString &stringError, bool noDelete)
         }
         else
         {
-            MPNode* localCurParentNode = findNodeWithNameInList(loginNodes, importedCurParentNode->getService(), true);
+            MPNode* localCurParentNode = parentsByService.value(importedCurParentNode->getService(), nullptr);
             MPNode* localCurChildNode = nullptr;
             if (localCurParentNode)
             {
-                localCurChildNode = findNodeWithLoginWithGivenParentInList(loginChildNodes, localCurParentNode, importedCurChildNode->getLogin());
+                childLoginIndex.find(localCurParentNode, importedCurChildNode->getLogin(), localCurChildNode);
             }
 
             if (!localCurChildNode || !localCurParentNode)
@@ -6134,6 +6708,8 @@ bool MPDevice::finishImportLoginNodes(QString &stringError, Common::AddressType
     NodeList& nodes = isCred ? loginNodes : webAuthnLoginNodes;
     NodeList& childNodes = isCred? loginChildNodes : webAuthnLoginChildNodes;
     /* Now we check all our parents and childs for non merge tag */
+    MPNodeIndex childIndex(childNodes);
+    int deletedNodes = 0;
     QListIterator<MPNode*> i(nodes);
     while (i.hasNext())
     {
@@ -6152,7 +6728,7 @@ bool MPDevice::finishImportLoginNodes(QString &stringError, Common::AddressType
         /* Check every children */
         while (curChildNodeAddr != MPNode::EmptyAddress)
         {
-            MPNode* curNode = findNodeWithAddressInList(childNodes, curChildNodeAddr);
+            MPNode* curNode = childIndex.find(curChildNodeAddr);
 
             /* Safety checks */
             if (!curNode)
@@ -6169,10 +6745,13 @@ bool MPDevice::finishImportLoginNodes(QString &stringError, Common::AddressType
             /* Marked for deletion? */
             if (!curNode->getMergeTagged())
             {
+                childIndex.remove(curNode);
                 removeChildFromDB(nodeItem, curNode, true, true, addrType);
+                ++deletedNodes;
             }
         }
     }
+    qInfo() << "Login merge:" << deletedNodes << "deleted";
     return true;
 }
 
@@ -6220,15 +6799,13 @@ void MPDevice::loadFreeAddresses(AsyncJobs *jobs, const QByteArray &addressFrom,
                 {
                     freeAddresses.append(pMesProt->getPayloadBytes(data, 2 + i*2, 2));
 
-                    if (AppDaemon::isDebugDev())
-                        qDebug() << "Received free address " << pMesProt->getPayloadBytes(data, 2 + i*2, 2).toHex();
+                    qTraceMmm() << "Received free address " << pMesProt->getPayloadBytes(data, 2 + i*2, 2).toHex();
                 }
                 else
                 {
                     freeAddresses.append(pMesProt->getPayloadBytes(data,i*2, 2));
 
-                    if (AppDaemon::isDebugDev())
-                        qDebug() << "Received free address " << pMesProt->getPayloadBytes(data,i*2, 2).toHex();
+                    qTraceMmm() << "Received free address " << pMesProt->getPayloadBytes(data,i*2, 2).toHex();
                 }
             }
 
@@ -6277,6 +6854,7 @@ void MPDevice::startIntegrityCheck(const std::function<void(bool success, int fr
 {
     /* New job for starting MMM */
     AsyncJobs *jobs = new AsyncJobs("Starting integrity check", this);
+    jobs->setPriority(AsyncJobs::PriorityBulk);
 
     /* Ask device to go into MMM first */
     jobs->append(new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone()));
@@ -6305,53 +6883,21 @@ void MPDevice::startIntegrityCheck(const std::function<void(bool success, int fr
         qInfo() << "Available blocks:" << diagTotalBlocks - diagFreeBlocks;
         qInfo() << "Available credentials:" << (diagTotalBlocks - diagFreeBlocks) / 2;
 
-        /* We finished loading the nodes in memory */
-        AsyncJobs* repairJobs = new AsyncJobs("Checking memory contents...", this);
-
-        /* Let's corrupt the DB for fun */
-        //testCodeAgainstCleanDBChanges(repairJobs);
-
-        /* Check loaded nodes, set bool to repair */
-        checkLoadedNodes(true, true, true);
-
-        /* Just in case a new _recovered_ service was added, change virtual for real addresses */
-        changeVirtualAddressesToFreeAddresses();
-
-        /* set clone change number to actual, to prevent change number changes on device */
-        credentialsDbChangeNumberClone = get_credentialsDbChangeNumber();
-        dataDbChangeNumberClone = get_dataDbChangeNumber();
-
-        /* Generate save packets */
-        bool packets_generated = generateSavePackets(repairJobs, true, true, [](QVariantMap){});
-
-        /* Leave MMM */
-        repairJobs->append(new MPCommandJob(this, MPCmd::END_MEMORYMGMT, pMesProt->getDefaultFuncDone()));
-
-        connect(repairJobs, &AsyncJobs::finished, [this, packets_generated, cb](const QByteArray &data)
+        repairLoadedNodes([this, cb](bool success, bool packetsGenerated)
         {
-            Q_UNUSED(data);
-
-            if (packets_generated)
+            if (!success)
+            {
+                cb(false, diagFreeBlocks, diagTotalBlocks, "Error While Correcting Database (Device Disconnected?)");
+            }
+            else if (packetsGenerated)
             {
-                qInfo() << "Found and Corrected Errors in Database";
                 cb(true, diagFreeBlocks, diagTotalBlocks, "Errors Were Found And Corrected In The Database");
             }
             else
             {
-                qInfo() << "Nothing to correct in DB";
                 cb(true, diagFreeBlocks, diagTotalBlocks, "Database Is Free Of Errors");
             }
         });
-
-        connect(repairJobs, &AsyncJobs::failed, [this, cb](AsyncJob *failedJob)
-        {
-            Q_UNUSED(failedJob);
-            qCritical() << "Couldn't check memory contents";
-            cb(false, diagFreeBlocks, diagTotalBlocks, "Error While Correcting Database (Device Disconnected?)");
-        });
-
-        jobsQueue.enqueue(repairJobs);
-        runAndDequeueJobs();
     });
 
     connect(jobs, &AsyncJobs::failed, [this, cb](AsyncJob *failedJob)
@@ -6365,35 +6911,718 @@ void MPDevice::startIntegrityCheck(const std::function<void(bool success, int fr
     runAndDequeueJobs();
 }
 
-void MPDevice::serviceExists(bool isDatanode, QString service, const QString &reqid,
-                             std::function<void(bool success, QString errstr, QString service, bool exists)> cb)
+void MPDevice::startGraphIntegrityCheck(bool orphanSweep, const MPDeviceProgressCb &cbProgress,
+                                        const std::function<void(bool success, QString errstr, QJsonObject report)> &cb)
 {
-    if (service.isEmpty())
+    /* Nodes can't be scanned on BLE devices, the full check already follows the links */
+    if (orphanSweep && isBLE())
     {
-        qWarning() << "context is empty.";
-        cb(false, "context is empty", QString(), false);
-        return;
+        qInfo() << "Orphan sweep is not available on BLE devices";
+        orphanSweep = false;
     }
 
-    //Force all service names to lowercase
-    service = service.toLower();
+    /* New job for starting MMM */
+    AsyncJobs *jobs = new AsyncJobs("Starting graph integrity check", this);
+    jobs->setPriority(AsyncJobs::PriorityBulk);
 
-    QString logInf = QStringLiteral("Check if %1service exists: %2 reqid: %3")
-                     .arg(isDatanode?"data ":"credential ")
-                     .arg(service)
-                     .arg(reqid);
+    /* Ask device to go into MMM first */
+    auto startMmmJob = new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone());
+    jobs->append(startMmmJob);
 
-    AsyncJobs *jobs;
-    if (reqid.isEmpty())
-        jobs = new AsyncJobs(logInf, this);
-    else
-        jobs = new AsyncJobs(logInf, reqid, this);
+    /* Ask one free address just in case we need it for creating a _recovered_ service */
+    newAddressesNeededCounter = 1;
+    newAddressesReceivedCounter = 0;
+    loadFreeAddresses(jobs, MPNode::EmptyAddress, false, cbProgress);
 
-    QByteArray sdata = pMesProt->toByteArray(service);
-    sdata.append((char)0);
+    diagNbBytesRec = 0;
+    diagLastNbBytesPSec = 0;
+    lastFlashPageScanned = 0;
+    diagLastSecs = QDateTime::currentMSecsSinceEpoch()/1000;
+    diagFreeBlocks = 0;
+    diagTotalBlocks = 0;
 
-    jobs->append(new MPCommandJob(this, isDatanode? MPCmd::SET_DATA_SERVICE : MPCmd::CONTEXT,
-                                  sdata,
+    /* Phase one: follow the links from the start nodes and favorites */
+    memMgmtModeReadFlash(jobs, false, cbProgress, true, true, true);
+
+    connect(jobs, &AsyncJobs::finished, [this, orphanSweep, cb, cbProgress](const QByteArray &)
+    {
+        const QList<QByteArray> linked = linkedNodeAddresses();
+        const int fullScanReads = countScannableNodes();
+
+        auto report = std::make_shared<QJsonObject>();
+        (*report)["mode"] = orphanSweep ? "graph_sweep" : "graph";
+        (*report)["linked_nodes"] = linked.size();
+        (*report)["full_scan_reads"] = fullScanReads;
+        (*report)["sweep_reads_max"] = fullScanReads - linked.size();
+        qInfo() << "Graph check:" << linked.size() << "linked nodes, a full scan would read" << fullScanReads << "nodes";
+
+        auto repairCb = [cb, report](bool success, bool packetsGenerated)
+        {
+            if (!success)
+            {
+                cb(false, "Error While Correcting Database (Device Disconnected?)", *report);
+                return;
+            }
+            (*report)["corrected"] = packetsGenerated;
+            cb(true, packetsGenerated ? "Errors Were Found And Corrected In The Database" : "Database Is Free Of Errors", *report);
+        };
+
+        if (!orphanSweep)
+        {
+            repairLoadedNodes(repairCb);
+            return;
+        }
+
+        /* Phase two: read the blocks that are neither free nor linked */
+        AsyncJobs *sweepJobs = new AsyncJobs("Sweeping orphan nodes", this);
+        sweepJobs->setPriority(AsyncJobs::PriorityBulk);
+        loadFreeBlockMap(sweepJobs, MPNode::EmptyAddress, false, cbProgress);
+
+        CustomJob *sweepPlanJob = new CustomJob(this);
+        sweepPlanJob->setWork([this, sweepJobs, sweepPlanJob, linked, fullScanReads, report, cbProgress]()
+        {
+            QSet<QByteArray> linkedSet;
+            for (const QByteArray &linkedAddress : linked)
+            {
+                linkedSet.insert(linkedAddress);
+            }
+            sweepAddresses.clear();
+            QByteArray address = getMemoryFirstNodeAddress();
+            for (int i = 0; i < fullScanReads; i++)
+            {
+                if (!freeBlockMap.contains(address) && !linkedSet.contains(address))
+                {
+                    sweepAddresses.append(address);
+                }
+                address = getNextNodeAddressInMemory(address);
+            }
+
+            (*report)["free_blocks"] = freeBlockMap.size();
+            (*report)["sweep_reads"] = sweepAddresses.size();
+            qInfo() << "Orphan sweep will read" << sweepAddresses.size() << "nodes instead of" << fullScanReads;
+            QVariantMap data = {
+                {"total", fullScanReads},
+                {"current", 0},
+                {"msg", "Sweeping %1 Nodes (Full Scan: %2)"},
+                {"msg_args", QVariantList({sweepAddresses.size(), fullScanReads})}
+            };
+            cbProgress(data);
+
+            if (!sweepAddresses.isEmpty())
+            {
+                sweepScan = true;
+                loadSingleNodeAndScan(sweepJobs, sweepAddresses.takeFirst(), cbProgress);
+            }
+            emit sweepPlanJob->done(QByteArray());
+        });
+        sweepJobs->append(sweepPlanJob);
+
+        connect(sweepJobs, &AsyncJobs::finished, [this, linked, report, repairCb](const QByteArray &)
+        {
+            sweepScan = false;
+            (*report)["orphan_nodes"] = linkedNodeAddresses().size() - linked.size();
+            repairLoadedNodes(repairCb);
+        });
+
+        connect(sweepJobs, &AsyncJobs::failed, [this, cb, report](AsyncJob *)
+        {
+            qCritical() << "Failed sweeping the flash memory";
+            exitMemMgmtMode(false);
+            cb(false, "Couldn't scan the memory (Device Disconnected?)", *report);
+        });
+
+        jobsQueue.enqueue(sweepJobs);
+        runAndDequeueJobs();
+    });
+
+    connect(jobs, &AsyncJobs::failed, [this, orphanSweep, cb, cbProgress, startMmmJob](AsyncJob *failedJob)
+    {
+        QJsonObject report;
+        report["mode"] = orphanSweep ? "graph_sweep" : "graph";
+        if (failedJob == startMmmJob)
+        {
+            /* Refused on the device, MMM wasn't entered */
+            qCritical() << "Couldn't enter MMM for the graph integrity check";
+            cb(false, "Couldn't Start Memory Check, Please Approve Prompt On Device", report);
+            return;
+        }
+
+        /* Node reads refused by the device set an error, timeouts and disconnections don't */
+        const auto *cmdJob = qobject_cast<MPCommandJob *>(failedJob);
+        if (!cmdJob || cmdJob->getCmd() != MPCmd::READ_FLASH_NODE || failedJob->getErrorStr().isEmpty())
+        {
+            qCritical() << "Failed following the database links";
+            exitMemMgmtMode(false);
+            const QString errstr = failedJob->getErrorStr();
+            cb(false, errstr.isEmpty() ? "Couldn't scan the memory (Device Disconnected?)" : errstr, report);
+            return;
+        }
+
+        /* A link points to a block we can't read, only a full scan can sort it out */
+        qWarning() << "Couldn't follow the database links, falling back to the full integrity check";
+        exitMemMgmtMode(false);
+        startIntegrityCheck([cb](bool success, int freeBlocks, int totalBlocks, QString errstr)
+        {
+            QJsonObject report;
+            report["mode"] = "full";
+            report["free_blocks"] = freeBlocks;
+            report["full_scan_reads"] = totalBlocks;
+            cb(success, errstr, report);
+        }, cbProgress);
+    });
+
+    jobsQueue.enqueue(jobs);
+    runAndDequeueJobs();
+}
+
+QList<QByteArray> MPDevice::linkedNodeAddresses()
+{
+    QList<QByteArray> addresses;
+    for (const NodeList *list : {&loginNodes, &loginChildNodes, &dataNodes, &dataChildNodes})
+    {
+        for (MPNode *node : *list)
+        {
+            addresses.append(node->getAddress());
+        }
+    }
+    return addresses;
+}
+
+int MPDevice::countScannableNodes()
+{
+    /* Nodes from the first one after the graphics zone to the end of the flash */
+    const QByteArray firstAddress = getMemoryFirstNodeAddress();
+    return (getNumberOfPages() - getFlashPageFromAddress(firstAddress)) * getNodesPerPage() - (firstAddress[0] & 0x07);
+}
+
+void MPDevice::loadFreeBlockMap(AsyncJobs *jobs, const QByteArray &addressFrom, bool discardFirstAddr, const MPDeviceProgressCb &cbProgress)
+{
+    jobs->append(new MPCommandJob(this, MPCmd::GET_FREE_ADDRESSES,
+                                  addressFrom,
+                                  [this, jobs, discardFirstAddr, cbProgress](const QByteArray &data, bool &) -> bool
+    {
+        /* The device answers with the free addresses following addressFrom, until none is left */
+        const int nbAddresses = static_cast<int>(pMesProt->getMessageSize(data)/2);
+        QByteArray lastAddress;
+        for (int i = discardFirstAddr ? 1 : 0; i < nbAddresses; i++)
+        {
+            const QByteArray address = pMesProt->getPayloadBytes(data, i*2, 2);
+            if (!freeBlockMap.contains(address))
+            {
+                freeBlockMap.insert(address);
+                lastAddress = address;
+            }
+        }
+
+        QVariantMap progressData = {
+            {"total", countScannableNodes()},
+            {"current", freeBlockMap.size()},
+            {"msg", "Loading Free Blocks Map: %1 Free Blocks"},
+            {"msg_args", QVariantList({freeBlockMap.size()})}
+        };
+        cbProgress(progressData);
+
+        if (!lastAddress.isEmpty())
+        {
+            loadFreeBlockMap(jobs, lastAddress, true, cbProgress);
+        }
+        return true;
+    }));
+}
+
+void MPDevice::repairLoadedNodes(const std::function<void(bool success, bool packetsGenerated)> &cb)
+{
+    /* We finished loading the nodes in memory */
+    AsyncJobs* repairJobs = new AsyncJobs("Checking memory contents...", this);
+
+    /* Let's corrupt the DB for fun */
+    //testCodeAgainstCleanDBChanges(repairJobs);
+
+    /* Check loaded nodes, set bool to repair */
+    checkLoadedNodes(true, true, true);
+
+    /* Just in case a new _recovered_ service was added, change virtual for real addresses */
+    changeVirtualAddressesToFreeAddresses();
+
+    /* set clone change number to actual, to prevent change number changes on device */
+    credentialsDbChangeNumberClone = get_credentialsDbChangeNumber();
+    dataDbChangeNumberClone = get_dataDbChangeNumber();
+
+    /* Generate save packets */
+    bool packets_generated = generateSavePackets(repairJobs, true, true, [](QVariantMap){});
+
+    /* Leave MMM */
+    repairJobs->append(new MPCommandJob(this, MPCmd::END_MEMORYMGMT, pMesProt->getDefaultFuncDone()));
+
+    connect(repairJobs, &AsyncJobs::finished, [packets_generated, cb](const QByteArray &data)
+    {
+        Q_UNUSED(data);
+
+        if (packets_generated)
+        {
+            qInfo() << "Found and Corrected Errors in Database";
+        }
+        else
+        {
+            qInfo() << "Nothing to correct in DB";
+        }
+        cb(true, packets_generated);
+    });
+
+    connect(repairJobs, &AsyncJobs::failed, [cb](AsyncJob *failedJob)
+    {
+        Q_UNUSED(failedJob);
+        qCritical() << "Couldn't check memory contents";
+        cb(false, false);
+    });
+
+    jobsQueue.enqueue(repairJobs);
+    runAndDequeueJobs();
+}
+
+void MPDevice::compactDatabase(bool dryRun, const MPDeviceProgressCb &cbProgress,
+                               const std::function<void(bool success, QString errstr, QJsonObject report)> &cb)
+{
+    /* Page use is computed with the Mini flash layout */
+    if (isBLE())
+    {
+        cb(false, "Database Compaction Is Not Supported On This Device", QJsonObject());
+        return;
+    }
+
+    /* Nodes are moved under the feet of a MMM client otherwise */
+    if (get_memMgmtMode())
+    {
+        cb(false, "Memory Management Mode Is In Use", QJsonObject());
+        return;
+    }
+
+    /* An interrupted compaction is resumed from the save journal, which needs the change numbers */
+    if (!dryRun && (!isFw12() || !saveJournal.isEnabled()))
+    {
+        cb(false, "Database Compaction Requires Firmware v1.2 Or Newer", QJsonObject());
+        return;
+    }
+
+    AsyncJobs *jobs = new AsyncJobs(dryRun? "Starting database compaction dry run" : "Starting database compaction", this);
+    jobs->setPriority(AsyncJobs::PriorityBulk);
+
+    /* Ask device to go into MMM first */
+    auto startMmmJob = new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone());
+    jobs->append(startMmmJob);
+
+    /* Load the credentials */
+    memMgmtModeReadFlash(jobs, false, cbProgress, true, false, false);
+
+    /* Data nodes aren't loaded, pages are only emptied if their other blocks are free */
+    loadFreeBlockMap(jobs, MPNode::EmptyAddress, false, cbProgress);
+
+    connect(jobs, &AsyncJobs::finished, [this, dryRun, cb, cbProgress](const QByteArray &)
+    {
+        if (!checkLoadedNodes(true, false, false))
+        {
+            qInfo() << "DB has errors, not compacting it";
+            exitMemMgmtMode(true);
+            cb(false, "Database Contains Errors, Please Run Integrity Check", QJsonObject());
+            return;
+        }
+
+        QJsonObject report;
+        const CompactionPlan plan = planCompaction(report);
+        report["dry_run"] = dryRun;
+        qInfo() << "Database compaction:" << plan.moving.size() << "nodes to move out of" << plan.vacatedPages.size() << "pages";
+
+        if (dryRun || plan.moving.isEmpty())
+        {
+            exitMemMgmtMode(true);
+            cb(true, QString(), report);
+            return;
+        }
+
+        /* Ask enough addresses to skip the ones on the pages being emptied */
+        newAddressesNeededCounter = 0;
+        newAddressesReceivedCounter = 0;
+        QVector<MPNode::NodeType> reservedTypes;
+        for (int i = 0; i < plan.moving.size() + plan.vacatedFreeSlots; i++)
+        {
+            incrementNeededAddresses(MPNode::NodeParent);
+            reservedTypes << MPNode::NodeParent;
+        }
+        /* Add one extra address because we do pre-increment on that counter */
+        newAddressesNeededCounter++;
+
+        AsyncJobs *addressJobs = new AsyncJobs("Asking free addresses for compaction", this);
+        addressJobs->setPriority(AsyncJobs::PriorityBulk);
+        loadFreeAddresses(addressJobs, MPNode::EmptyAddress, false, cbProgress);
+
+        connect(addressJobs, &AsyncJobs::finished, [this, plan, reservedTypes, report, cb, cbProgress](const QByteArray &) mutable
+        {
+            QList<QByteArray> parentDest;
+            QList<QByteArray> childDest;
+            for (int i = 0; i < reservedTypes.size(); i++)
+            {
+                const QByteArray address = getFreeAddress(static_cast<quint32>(i + 1));
+                if (address.isEmpty() || plan.vacatedPages.contains(getFlashPageFromAddress(address)))
+                {
+                    continue;
+                }
+                (reservedTypes[i] == MPNode::NodeChild ? childDest : parentDest) << address;
+            }
+
+            const int movedNodes = relocateNodes(plan, parentDest, childDest);
+            report["moved_nodes"] = movedNodes;
+            if (movedNodes == 0)
+            {
+                qInfo() << "No free address available outside of the vacated pages";
+                exitMemMgmtMode(true);
+                cb(true, QString(), report);
+                return;
+            }
+
+            AsyncJobs *saveJobs = new AsyncJobs("Writing compacted database", this);
+            saveJobs->setPriority(AsyncJobs::PriorityBulk);
+
+            /* New copies are written first and old nodes erased last, see generateSavePackets */
+            generateSavePackets(saveJobs, true, false, cbProgress);
+            if (!saveJournal.isActive())
+            {
+                /* Nothing was sent yet, the nodes are still at their old addresses on the device */
+                qCritical() << "Couldn't record the compaction journal, not compacting";
+                saveJobs->deleteLater();
+                exitMemMgmtMode(true);
+                cb(false, "Couldn't Record The Compaction Journal", QJsonObject());
+                return;
+            }
+
+            connect(saveJobs, &AsyncJobs::finished, [this, report, cb](const QByteArray &)
+            {
+                qInfo() << "Database compacted";
+                exitMemMgmtMode(true);
+                cb(true, QString(), report);
+            });
+
+            connect(saveJobs, &AsyncJobs::failed, [this, cb](AsyncJob *)
+            {
+                qCritical() << "Writing the compacted database failed";
+                exitMemMgmtMode(true);
+                /* The journal was dropped if the device refused a write */
+                if (saveJournal.isActive())
+                {
+                    cb(false, "Compaction Interrupted, It Will Resume Once The Device Is Back", QJsonObject());
+                    return;
+                }
+                cb(false, "Couldn't Write The Compacted Database, Please Run Integrity Check", QJsonObject());
+            });
+
+            jobsQueue.enqueue(saveJobs);
+            runAndDequeueJobs();
+        });
+
+        connect(addressJobs, &AsyncJobs::failed, [this, cb](AsyncJob *)
+        {
+            qCritical() << "Couldn't get free addresses for compaction";
+            exitMemMgmtMode(true);
+            cb(false, "Couldn't Get Free Addresses", QJsonObject());
+        });
+
+        jobsQueue.enqueue(addressJobs);
+        runAndDequeueJobs();
+    });
+
+    connect(jobs, &AsyncJobs::failed, [this, cb, startMmmJob](AsyncJob *failedJob)
+    {
+        if (failedJob == startMmmJob)
+        {
+            /* MMM wasn't entered */
+            qCritical() << "Couldn't enter MMM for compaction";
+            cb(false, "Couldn't Load Database, Please Approve Prompt On Device", QJsonObject());
+            return;
+        }
+        qCritical() << "Failed scanning the flash memory";
+        exitMemMgmtMode(true);
+        cb(false, "Couldn't Load Database", QJsonObject());
+    });
+
+    jobsQueue.enqueue(jobs);
+    runAndDequeueJobs();
+}
+
+QList<MPNode *> MPDevice::nodesInListOrder(Common::AddressType addrType, QSet<MPNode *> &parents)
+{
+    const bool isCred = addrType == Common::CRED_ADDR_IDX;
+    NodeList &nodes = isCred ? loginNodes : webAuthnLoginNodes;
+    NodeList &childNodes = isCred ? loginChildNodes : webAuthnLoginChildNodes;
+    const MPNodeIndex parentIndex(nodes);
+    const MPNodeIndex childIndex(childNodes);
+
+    /* Walks are bounded by the list sizes in case of a loop */
+    QList<MPNode *> order;
+    QByteArray parentAddress = startNode[addrType];
+    for (int i = 0; i < nodes.size() && parentAddress != MPNode::EmptyAddress; i++)
+    {
+        MPNode *parent = parentIndex.find(parentAddress);
+        if (!parent)
+        {
+            break;
+        }
+        order << parent;
+        parents.insert(parent);
+
+        QByteArray childAddress = parent->getStartChildAddress();
+        for (int j = 0; j < childNodes.size() && childAddress != MPNode::EmptyAddress; j++)
+        {
+            MPNode *child = childIndex.find(childAddress);
+            if (!child)
+            {
+                break;
+            }
+            order << child;
+            childAddress = child->getNextChildAddress();
+        }
+        parentAddress = parent->getNextParentAddress();
+    }
+    return order;
+}
+
+MPDevice::CompactionPlan MPDevice::planCompaction(QJsonObject &report)
+{
+    CompactionPlan plan;
+    plan.listOrder = nodesInListOrder(Common::CRED_ADDR_IDX, plan.parents);
+    if (isBLE())
+    {
+        plan.listOrder << nodesInListOrder(Common::WEBAUTHN_ADDR_IDX, plan.parents);
+    }
+
+    /* Pages at most half used are emptied */
+    const int nodesPerPage = getNodesPerPage();
+    QHash<quint16, int> pageUse;
+    for (MPNode *node : plan.listOrder)
+    {
+        ++pageUse[getFlashPageFromAddress(node->getAddress())];
+    }
+    QHash<quint16, int> pageFree;
+    for (const QByteArray &address : freeBlockMap)
+    {
+        ++pageFree[getFlashPageFromAddress(address)];
+    }
+    int sharedPages = 0;
+    for (auto it = pageUse.constBegin(); it != pageUse.constEnd(); ++it)
+    {
+        if (it.value() * 2 > nodesPerPage)
+        {
+            continue;
+        }
+        /* Data or orphan nodes stay on the page, moving the credentials wouldn't free it */
+        if (it.value() + pageFree.value(it.key()) < nodesPerPage)
+        {
+            ++sharedPages;
+            continue;
+        }
+        plan.vacatedPages.insert(it.key());
+        plan.vacatedFreeSlots += nodesPerPage - it.value();
+    }
+
+    QSet<QByteArray> movingAddresses;
+    for (MPNode *node : plan.listOrder)
+    {
+        if (plan.vacatedPages.contains(getFlashPageFromAddress(node->getAddress())))
+        {
+            plan.moving.insert(node);
+            movingAddresses.insert(node->getAddress());
+            plan.parents.contains(node) ? ++plan.parentMoves : ++plan.childMoves;
+        }
+    }
+
+    /* Nodes that will point to a moved node */
+    int relinkedNodes = 0;
+    for (MPNode *node : plan.listOrder)
+    {
+        if (plan.moving.contains(node))
+        {
+            continue;
+        }
+        const QByteArrayList links = plan.parents.contains(node) ?
+                    QByteArrayList{node->getPreviousParentAddress(), node->getNextParentAddress(), node->getStartChildAddress()} :
+                    QByteArrayList{node->getPreviousChildAddress(), node->getNextChildAddress()};
+        for (const QByteArray &link : links)
+        {
+            if (movingAddresses.contains(link))
+            {
+                ++relinkedNodes;
+                break;
+            }
+        }
+    }
+    int pointerUpdates = 0;
+    for (const QByteArray &favorite : favoritesAddrs)
+    {
+        if (movingAddresses.contains(favorite.mid(0, 2)) || movingAddresses.contains(favorite.mid(2, 2)))
+        {
+            ++pointerUpdates;
+        }
+    }
+    for (const QByteArray &start : startNode)
+    {
+        if (movingAddresses.contains(start))
+        {
+            ++pointerUpdates;
+        }
+    }
+
+    /*
+     * Flash pages read by a scan in list order. Moved nodes are counted
+     * as packed together on new pages, which is what the free addresses
+     * returned by the device usually allow.
+     */
+    const auto countPageReads = [this, &plan, nodesPerPage](bool afterMove)
+    {
+        int reads = 0;
+        int movedIndex = 0;
+        qint64 lastPage = -1;
+        for (MPNode *node : plan.listOrder)
+        {
+            qint64 page = getFlashPageFromAddress(node->getAddress());
+            if (afterMove && plan.moving.contains(node))
+            {
+                page = 0x10000 + movedIndex++ / nodesPerPage;
+            }
+            if (page != lastPage)
+            {
+                ++reads;
+                lastPage = page;
+            }
+        }
+        return reads;
+    };
+    const int readsBefore = countPageReads(false);
+    const int readsAfter = countPageReads(true);
+
+    report["nodes"] = plan.listOrder.size();
+    report["moved_nodes"] = plan.moving.size();
+    report["vacated_pages"] = plan.vacatedPages.size();
+    report["shared_pages"] = sharedPages;
+    report["estimated_node_writes"] = plan.moving.size() * 2 + relinkedNodes;
+    report["estimated_pointer_updates"] = pointerUpdates;
+    report["page_reads_before"] = readsBefore;
+    report["page_reads_after"] = readsAfter;
+    report["scan_speedup"] = readsAfter > 0 ? static_cast<double>(readsBefore) / readsAfter : 1.0;
+    return plan;
+}
+
+int MPDevice::relocateNodes(const CompactionPlan &plan, QList<QByteArray> parentDest, QList<QByteArray> childDest)
+{
+    /* Moved nodes take the free addresses in list order, so they end up contiguous */
+    QHash<QByteArray, QByteArray> newAddresses;
+    for (MPNode *node : plan.listOrder)
+    {
+        if (!plan.moving.contains(node))
+        {
+            continue;
+        }
+        QList<QByteArray> &dest = (plan.parents.contains(node) || !isBLE()) ? parentDest : childDest;
+        if (!dest.isEmpty())
+        {
+            newAddresses.insert(node->getAddress(), dest.takeFirst());
+        }
+    }
+    if (newAddresses.isEmpty())
+    {
+        return 0;
+    }
+
+    for (MPNode *node : plan.listOrder)
+    {
+        if (plan.parents.contains(node))
+        {
+            if (newAddresses.contains(node->getPreviousParentAddress())) node->setPreviousParentAddress(newAddresses.value(node->getPreviousParentAddress()));
+            if (newAddresses.contains(node->getNextParentAddress())) node->setNextParentAddress(newAddresses.value(node->getNextParentAddress()));
+            if (newAddresses.contains(node->getStartChildAddress())) node->setStartChildAddress(newAddresses.value(node->getStartChildAddress()));
+        }
+        else
+        {
+            if (newAddresses.contains(node->getPreviousChildAddress())) node->setPreviousChildAddress(newAddresses.value(node->getPreviousChildAddress()));
+            if (newAddresses.contains(node->getNextChildAddress())) node->setNextChildAddress(newAddresses.value(node->getNextChildAddress()));
+        }
+        if (newAddresses.contains(node->getAddress())) node->setAddress(newAddresses.value(node->getAddress()));
+    }
+
+    for (QByteArray &start : startNode)
+    {
+        start = newAddresses.value(start, start);
+    }
+    for (QByteArray &favorite : favoritesAddrs)
+    {
+        favorite.replace(0, 2, newAddresses.value(favorite.mid(0, 2), favorite.mid(0, 2)));
+        favorite.replace(2, 2, newAddresses.value(favorite.mid(2, 2), favorite.mid(2, 2)));
+    }
+
+    return newAddresses.size();
+}
+
+bool MPDevice::isServiceIndexValid(MPServiceIndex::Kind kind) const
+{
+    //Without change numbers we can't know if the device db changed
+    if (!changeNumbersLoaded || !(isFw12() || isBLE()))
+    {
+        return false;
+    }
+    const quint32 changeNumber = (kind == MPServiceIndex::DATA) ? get_dataDbChangeNumber() : get_credentialsDbChangeNumber();
+    return serviceIndex.isValid(kind, changeNumber);
+}
+
+QString MPDevice::serviceExistsKey(bool isDatanode, const QString &service)
+{
+    return (isDatanode ? QStringLiteral("data:") : QStringLiteral("cred:")) + service.toLower();
+}
+
+void MPDevice::serviceExists(bool isDatanode, QString service, const QString &reqid,
+                             std::function<void(bool success, QString errstr, QString service, bool exists)> cb)
+{
+    if (service.isEmpty())
+    {
+        qWarning() << "context is empty.";
+        cb(false, "context is empty", QString(), false);
+        return;
+    }
+
+    //Force all service names to lowercase
+    service = service.toLower();
+
+    const MPServiceIndex::Kind indexKind = isDatanode ? MPServiceIndex::DATA : MPServiceIndex::CREDENTIALS;
+    if (isServiceIndexValid(indexKind))
+    {
+        qDebug() << "Service exists answered from service index:" << service;
+        cb(true, QString(), service, serviceIndex.contains(indexKind, service));
+        return;
+    }
+
+    //A request with a reqid can be canceled by its client,
+    //it is not shared so a cancel doesn't drop other clients answers
+    const bool coalesced = reqid.isEmpty();
+    const QString requestKey = serviceExistsKey(isDatanode, service);
+    if (coalesced && !serviceExistsRequests.join(requestKey, cb))
+    {
+        qDebug() << "Sharing service exists result for" << service;
+        return;
+    }
+
+    QString logInf = QStringLiteral("Check if %1service exists: %2 reqid: %3")
+                     .arg(isDatanode?"data ":"credential ")
+                     .arg(service)
+                     .arg(reqid);
+
+    AsyncJobs *jobs;
+    if (reqid.isEmpty())
+        jobs = new AsyncJobs(logInf, this);
+    else
+        jobs = new AsyncJobs(logInf, reqid, this);
+    jobs->setPriority(AsyncJobs::PriorityInteractive);
+
+    QByteArray sdata = pMesProt->toByteArray(service);
+    sdata.append((char)0);
+
+    jobs->append(new MPCommandJob(this, isDatanode? MPCmd::SET_DATA_SERVICE : MPCmd::CONTEXT,
+                                  sdata,
                                   [this, jobs, service](const QByteArray &data, bool &) -> bool
     {
         QVariantMap m = {{ "service", service },
@@ -6402,18 +7631,25 @@ void MPDevice::serviceExists(bool isDatanode, QString service, const QString &re
         return true;
     }));
 
-    connect(jobs, &AsyncJobs::finished, [jobs, cb](const QByteArray &)
+    connect(jobs, &AsyncJobs::finished, [this, jobs, requestKey, coalesced, cb](const QByteArray &)
     {
         //all jobs finished success
         qInfo() << "service_exists success";
         QVariantMap m = jobs->user_data.toMap();
-        cb(true, QString(), m["service"].toString(), m["exists"].toBool());
+        if (coalesced)
+            serviceExistsRequests.finish(requestKey, true, true, QString(), m["service"].toString(), m["exists"].toBool());
+        else
+            cb(true, QString(), m["service"].toString(), m["exists"].toBool());
     });
 
-    connect(jobs, &AsyncJobs::failed, [cb](AsyncJob *failedJob)
+    connect(jobs, &AsyncJobs::failed, [this, requestKey, coalesced, cb](AsyncJob *failedJob)
     {
         qCritical() << "Failed getting data node";
-        cb(false, failedJob->getErrorStr(), QString(), false);
+        const QString err = failedJob? failedJob->getErrorStr() : QString();
+        if (coalesced)
+            serviceExistsRequests.finish(requestKey, false, false, err, QString(), false);
+        else
+            cb(false, err, QString(), false);
     });
 
     jobsQueue.enqueue(jobs);
@@ -6447,6 +7683,7 @@ void MPDevice::importFromCSV(const QJsonArray &creds, const MPDeviceProgressCb &
 
     /* Load database credentials */
     AsyncJobs *jobs = new AsyncJobs("Starting MMM mode for CSV import", this);
+    jobs->setPriority(AsyncJobs::PriorityBulk);
 
     /* Ask device to go into MMM first */
     auto startMmmJob = new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone());
@@ -6570,6 +7807,10 @@ void MPDevice::setMMCredentials(const QJsonArray &creds, bool noDelete,
 {
     newAddressesNeededCounter = 0;
     newAddressesReceivedCounter = 0;
+    if (isBLE())
+    {
+        bleImpl->getFreeAddressProvider().resetReservations();
+    }
     bool packet_send_needed = false;
     AsyncJobs *jobs = new AsyncJobs("Merging credentials changes", this);
 
@@ -7067,6 +8308,7 @@ void MPDevice::exportDatabase(const QString &encryption, std::function<void(bool
 {
     /* New job for starting MMM */
     AsyncJobs *jobs = new AsyncJobs("Starting MMM mode for export file generation", this);
+    jobs->setPriority(AsyncJobs::PriorityBulk);
 
     /* Ask device to go into MMM first */
     jobs->append(new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone()));
@@ -7114,6 +8356,10 @@ void MPDevice::importDatabase(const QByteArray &fileData, bool noDelete,
     /* Reset temp vars */
     newAddressesNeededCounter = 0;
     newAddressesReceivedCounter = 0;
+    if (isBLE())
+    {
+        bleImpl->getFreeAddressProvider().resetReservations();
+    }
 
     /* Try to read the export file */
     if (readExportFile(fileData, errorString))
@@ -7183,8 +8429,16 @@ bool MPDevice::isFilesCacheInSync() const
 
 void MPDevice::getStoredFiles(std::function<void (bool, QList<QVariantMap>)> cb)
 {
+    //A full data scan is already running, wait for its result
+    if (!storedFilesRequests.join(QStringLiteral("files"), cb))
+    {
+        qDebug() << "Stored files scan already queued, sharing its result";
+        return;
+    }
+
     /* New job for starting MMM */
     AsyncJobs *jobs = new AsyncJobs("Starting MMM mode", this);
+    jobs->setPriority(AsyncJobs::PriorityBackground);
 
     /* Ask device to go into MMM first */
     jobs->append(new MPCommandJob(this, MPCmd::START_MEMORYMGMT, pMesProt->getDefaultFuncDone()));
@@ -7192,7 +8446,7 @@ void MPDevice::getStoredFiles(std::function<void (bool, QList<QVariantMap>)> cb)
     /* Load flash contents the usual way */
     memMgmtModeReadFlash(jobs, false, [](QVariant) {}, false, true, true);
 
-    connect(jobs, &AsyncJobs::finished, [this, cb](const QByteArray &data)
+    connect(jobs, &AsyncJobs::finished, [this](const QByteArray &data)
     {
         Q_UNUSED(data);
 
@@ -7208,20 +8462,25 @@ void MPDevice::getStoredFiles(std::function<void (bool, QList<QVariantMap>)> cb)
             list.append(item);
         }
 
+        if (changeNumbersLoaded)
+        {
+            serviceIndex.build(MPServiceIndex::DATA, dataNodes, get_dataDbChangeNumber());
+        }
+
         /* Clean vars, exit mmm */
         exitMemMgmtMode(false);
         cleanMMMVars();
 
         /* Callback */
-        cb(true, list);
+        storedFilesRequests.finish(QStringLiteral("files"), false, true, list);
     });
 
-    connect(jobs, &AsyncJobs::failed, [this, cb](AsyncJob *failedJob)
+    connect(jobs, &AsyncJobs::failed, [this](AsyncJob *failedJob)
     {
         Q_UNUSED(failedJob);
         qCritical() << "Setting device in MMM failed";
         exitMemMgmtMode(false);
-        cb(false, QList<QVariantMap>());
+        storedFilesRequests.finish(QStringLiteral("files"), false, false, QList<QVariantMap>());
     });
 
     jobsQueue.enqueue(jobs);
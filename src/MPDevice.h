@@ -28,6 +28,11 @@
 #include "FilesCache.h"
 #include "DeviceSettings.h"
 #include "MPSettingsMini.h"
+#include "RequestCoalescer.h"
+#include "MPFlashPlacement.h"
+#include "MPServiceIndex.h"
+#include "MPSaveJournal.h"
+#include "MPNodeGraphChecker.h"
 
 using MPCommandCb = std::function<void(bool success, const QByteArray &data, bool &done)>;
 using MPDeviceProgressCb = std::function<void(const QVariantMap &data)>;
@@ -96,6 +101,7 @@ public:
     void sendData(MPCmd::Command cmd, MPCommandCb cb);
     void sendData(MPCmd::Command cmd, const QByteArray &data, MPCommandCb cb);
     void enqueueAndRunJob(AsyncJobs* jobs);
+    QJsonObject getJobsQueueStats() const { return jobsQueue.getStats(); }
 
     void getUID(const QByteArray & key);
 
@@ -109,6 +115,15 @@ public:
     void exitMemMgmtMode(bool setMMMBool = true);
     void startIntegrityCheck(const std::function<void(bool success, int freeBlocks, int totalBlocks, QString errstr)> &cb,
                              const MPDeviceProgressCb &cbProgress);
+    //Two phase check: the linked nodes are read first, then with orphanSweep only
+    //the blocks that are neither free nor linked. Falls back to the full check
+    //if a link can't be followed
+    void startGraphIntegrityCheck(bool orphanSweep, const MPDeviceProgressCb &cbProgress,
+                                  const std::function<void(bool success, QString errstr, QJsonObject report)> &cb);
+    //Move the credential nodes out of half empty flash pages, in list order
+    //With dryRun the flash is only read and the expected gain is reported
+    void compactDatabase(bool dryRun, const MPDeviceProgressCb &cbProgress,
+                         const std::function<void(bool success, QString errstr, QJsonObject report)> &cb);
 
     //Send current date to MP
     void setCurrentDate();
@@ -117,7 +132,7 @@ public:
     void getChangeNumbers();
 
     //Ask a password for specified service/login to MP
-    void getCredential(QString service, const QString &login, const QString &fallback_service, const QString &reqid,
+    void getCredential(QString service, const QString &login, QString fallback_service, const QString &reqid,
                        std::function<void(bool success, QString errstr, const QString &_service, const QString &login, const QString &pass, const QString &desc)> cb);
 
     //Add or Set service/login/pass/desc in MP
@@ -138,7 +153,7 @@ public:
     void writeCancelRequest();
 
     //Request for a raw data node from the device
-    void getDataNode(QString service, const QString &fallback_service, const QString &reqid,
+    void getDataNode(QString service, QString fallback_service, const QString &reqid,
                      std::function<void(bool success, QString errstr, QString service, QByteArray rawData)> cb,
                      const MPDeviceProgressCb &cbProgress);
 
@@ -208,7 +223,7 @@ public:
     void updateFileInCache(QString fileName, int size);
     void removeFileFromCache(QString fileName);
 
-    void loadParams() { pSettings->loadParameters(); }
+    void loadParams();
 
 protected:
     enum ExportPayloadData
@@ -277,8 +292,15 @@ private:
     void loadDataChildNode(AsyncJobs *jobs, MPNode *parent, MPNode *parentClone, const QByteArray &address, const MPDeviceProgressCb &cbProgress, quint32 nbBytesFetched);
     void loadSingleNodeAndScan(AsyncJobs *jobs, const QByteArray &address,
                                const MPDeviceProgressCb &cbProgress);
+    QByteArray getNextScanAddress(const QByteArray &address);
+    void loadFreeBlockMap(AsyncJobs *jobs, const QByteArray &addressFrom, bool discardFirstAddr, const MPDeviceProgressCb &cbProgress);
+    QList<QByteArray> linkedNodeAddresses();
+    int countScannableNodes();
+    void repairLoadedNodes(const std::function<void(bool success, bool packetsGenerated)> &cb);
 
     void createJobAddContext(const QString &service, AsyncJobs *jobs, bool isDataNode = false);
+    static QString serviceExistsKey(bool isDatanode, const QString &service);
+    bool isServiceIndexValid(MPServiceIndex::Kind kind) const;
 
     bool getDataNodeCb(AsyncJobs *jobs,
                        const MPDeviceProgressCb &cbProgress,
@@ -318,6 +340,8 @@ private:
     // Functions added by mathieu for MMM : checks & repairs
     bool addOrphanParentToDB(MPNode *parentNodePt, bool isDataParent, bool addPossibleChildren, Common::AddressType addrType = Common::CRED_ADDR_IDX);
     bool checkLoadedNodes(bool checkCredentials, bool checkData, bool repairAllowed);
+    MPNodeGraphChecker::RepairPlan checkNodeGraphs(bool checkCredentials, bool checkData);
+    MPNodeGraphChecker::GraphSnapshot snapshotNodeGraph(const NodeList &parents, const NodeList &children, const QByteArray &startAddress, quint32 startVirtualAddress, bool isDataGraph);
     void checkLoadedLoginNodes(quint32 &parentNum, quint32 &childNum, bool repairAllowed, Common::AddressType addrType);
     bool tagPointedNodes(bool tagCredentials, bool tagData, bool repairAllowed, Common::AddressType addrType = Common::CRED_ADDR_IDX);
     bool addOrphanParentChildsToDB(MPNode *parentNodePt, bool isDataParent, Common::AddressType addrType = Common::CRED_ADDR_IDX);
@@ -337,14 +361,40 @@ private:
     // Functions added by mathieu for unit testing
     bool testCodeAgainstCleanDBChanges(AsyncJobs *jobs);
 
+    // Database compaction
+    struct CompactionPlan
+    {
+        QList<MPNode *> listOrder;
+        QSet<MPNode *> parents;
+        QSet<MPNode *> moving;
+        QSet<quint16> vacatedPages;
+        int parentMoves = 0;
+        int childMoves = 0;
+        //Free slots on the vacated pages, the device may return them
+        int vacatedFreeSlots = 0;
+    };
+    QList<MPNode *> nodesInListOrder(Common::AddressType addrType, QSet<MPNode *> &parents);
+    CompactionPlan planCompaction(QJsonObject &report);
+    int relocateNodes(const CompactionPlan &plan, QList<QByteArray> parentDest, QList<QByteArray> childDest);
+
     // Generate save packets
     bool generateSavePackets(AsyncJobs *jobs, bool tackleCreds, bool tackleData, const MPDeviceProgressCb &cbProgress);
-    bool checkModifiedSavePacketNodes(AsyncJobs *jobs, std::function<void()> writeCb, Common::AddressType addrType);
-    bool checkRemovedSavePacketNodes(AsyncJobs *jobs, std::function<void()> writeCb, Common::AddressType addrType);
+    bool checkModifiedSavePacketNodes(MPNodeWriteBatch &newNodes, MPNodeWriteBatch &updatedNodes, Common::AddressType addrType);
+    bool checkRemovedSavePacketNodes(MPNodeWriteBatch &removedNodes, Common::AddressType addrType);
+    void addWriteBatchToJob(AsyncJobs *jobs, MPNodeWriteBatch &writes, std::function<void(void)> writeCallback);
+
+    // Save journal, lets an interrupted save resume where it stopped
+    void addJournaledCommandToJob(AsyncJobs *jobs, MPCmd::Command cmd, const QByteArray &data);
+    void addCheckpointedCommandToJob(AsyncJobs *jobs, MPCmd::Command cmd, const QByteArray &data, int journalIndex);
+    void addJournalCheckpointToJob(AsyncJobs *jobs, int journalIndex);
+    void appendJournalReplay(AsyncJobs *jobs, int fromIndex);
+    void resumeInterruptedSave();
 
     QByteArray getFreeAddress(quint32 virtualAddr);
     // once we fetched free addresses, this function is called
     void changeVirtualAddressesToFreeAddresses();
+    // give the new nodes the free addresses closest to their neighbours
+    void placeNewNodes();
 
     void updateChangeNumbers(AsyncJobs *jobs, quint8 flags);
 
@@ -358,6 +408,11 @@ private:
     // Last page scanned
     quint16 lastFlashPageScanned = 0;
 
+    //Orphan sweep of the graph integrity check
+    bool sweepScan = false;
+    QList<QByteArray> sweepAddresses;
+    QSet<QByteArray> freeBlockMap;
+
     //timer that asks status
     QTimer *statusTimer = nullptr;
 
@@ -371,6 +426,18 @@ private:
     //command queue
     QQueue<MPCommand> commandQueue;
 
+    //identical requests coming from several clients are sent once
+    RequestCoalescer<bool, QString, QString, bool> serviceExistsRequests{SERVICE_EXISTS_CACHE_TTL};
+    RequestCoalescer<bool, QList<QVariantMap>> storedFilesRequests;
+
+    //services known from the last MMM read, used to answer lookups locally
+    MPServiceIndex serviceIndex;
+    bool changeNumbersLoaded = false;
+
+    //writes of the running save, kept on disk until they all landed
+    MPSaveJournal saveJournal;
+    bool saveResumeRunning = false;
+
     //passwords we need to change after leaving mmm
     QList<QStringList> mmmPasswordChangeArray;
 
@@ -380,6 +447,8 @@ private:
 
     // Buffer containing the free addresses we will need
     QList<QByteArray> freeAddresses;
+    // Free address chosen for each virtual address by placeNewNodes()
+    QVector<QByteArray> placedAddresses;
 
     // Values loaded when needed (e.g. mem mgmt mode)
     QByteArray ctrValue;
@@ -443,8 +512,11 @@ private:
     //when an AsyncJobs is currently running.
     //An AsyncJobs can also be removed if it was not started (using cancelUserRequest for example)
     //All AsyncJobs does have an <id>
-    QQueue<AsyncJobs *> jobsQueue;
+    //AsyncJobs are run by priority, see AsyncJobsQueue
+    AsyncJobsQueue jobsQueue;
     AsyncJobs *currentJobs = nullptr;
+    //interruptible AsyncJobs that yielded to more urgent ones
+    QStack<AsyncJobs *> preemptedJobs;
 
     //this is a cache for data upload
     QByteArray currentDataNode;
@@ -468,11 +540,15 @@ protected:
     static constexpr int MP_EXPORT_FIELD_NUM = 10;
     static constexpr int MC_EXPORT_FIELD_NUM = 14;
     static constexpr int BLE_EXPORT_FIELD_MIN_NUM = 18;
+    //Since bundle version 2, byte fields are stored as base64 strings
+    static constexpr int EXPORT_BUNDLE_VERSION = 2;
 
     static constexpr int RESET_SEND_DELAY = 300;
     static constexpr int INIT_STARTING_DELAY = RESET_SEND_DELAY + 150;
     static constexpr int STATUS_STARTING_DELAY = RESET_SEND_DELAY + 500;
     static constexpr int CATEGORY_FETCH_DELAY = 5000;
+    static constexpr int SERVICE_EXISTS_CACHE_TTL = 1500;
+    static constexpr int MAX_SAVE_RESUME_ATTEMPTS = 3;
 };
 
 #endif // MPDEVICE_H
@@ -4,12 +4,15 @@
 #include "MPNodeBLE.h"
 #include "AppDaemon.h"
 #include "DeviceSettingsBLE.h"
+#include "SettingsCache.h"
 
 MPDeviceBleImpl::MPDeviceBleImpl(MessageProtocolBLE* mesProt, MPDevice *dev):
     bleProt(mesProt),
     mpDev(dev),
     freeAddressProv(mesProt, dev)
 {
+    //Categories belong to the inserted card
+    connect(mpDev, &MPDevice::statusChanged, [this]() { userCategoriesRequests.invalidate(); });
 }
 
 bool MPDeviceBleImpl::isFirstPacket(const QByteArray &data)
@@ -89,8 +92,9 @@ void MPDeviceBleImpl::flashMCU(const MessageHandlerCb &cb)
     auto flashJob = new MPCommandJob(mpDev, MPCmd::CMD_DBG_UPDATE_MAIN_AUX, bleProt->getDefaultFuncDone());
     flashJob->setReturnCheck(false);
     jobs->append(flashJob);
-    QSettings s;
-    s.setValue(AFTER_AUX_FLASH_SETTING, true);
+    //Must be on disk before the device reboots
+    SettingsCache::instance()->setValue(AFTER_AUX_FLASH_SETTING, true);
+    SettingsCache::instance()->sync();
 
 
     connect(jobs, &AsyncJobs::failed, [cb](AsyncJob *failedJob)
@@ -173,6 +177,9 @@ void MPDeviceBleImpl::fetchData(QString filePath, MPCmd::Command cmd)
 
 void MPDeviceBleImpl::storeCredential(const BleCredential &cred, MessageHandlerCb cb)
 {
+    mpDev->serviceExistsRequests.invalidate(MPDevice::serviceExistsKey(false, cred.get(BleCredential::CredAttr::SERVICE)));
+    mpDev->serviceIndex.invalidate(MPServiceIndex::CREDENTIALS);
+
     auto *jobs = new AsyncJobs(QString("Store Credential"), this);
 
     jobs->append(new MPCommandJob(mpDev, MPCmd::CHECK_CREDENTIAL, createCheckCredMessage(cred),
@@ -220,6 +227,7 @@ void MPDeviceBleImpl::getCredential(const QString& service, const QString& login
     {
         jobs = new AsyncJobs(getCred, reqid, this);
     }
+    jobs->setPriority(AsyncJobs::PriorityInteractive);
 
     jobs->append(new MPCommandJob(mpDev, MPCmd::GET_CREDENTIAL, createGetCredMessage(service, login),
                             [this, service, login, cb, fallbackService, jobs](const QByteArray &data, bool &)
@@ -236,8 +244,7 @@ void MPDeviceBleImpl::getCredential(const QString& service, const QString& login
                                 }
                                 qDebug() << "Credential got successfully";
 
-                                if (AppDaemon::isDebugDev())
-                                    qDebug() << data.toHex();
+                                qTracePacket() << data.toHex();
 
                                 cb(true, "", bleProt->getFullPayload(data));
                                 return true;
@@ -409,10 +416,10 @@ bool MPDeviceBleImpl::processReceivedData(const QByteArray &data, QByteArray &da
 
 bool MPDeviceBleImpl::isAfterAuxFlash()
 {
-    QSettings s;
-    if (s.value(AFTER_AUX_FLASH_SETTING, false).toBool())
+    SettingsCache *s = SettingsCache::instance();
+    if (s->value(AFTER_AUX_FLASH_SETTING, false).toBool())
     {
-        s.setValue(AFTER_AUX_FLASH_SETTING, false);
+        s->setValue(AFTER_AUX_FLASH_SETTING, false);
         return true;
     }
     return false;
@@ -420,27 +427,34 @@ bool MPDeviceBleImpl::isAfterAuxFlash()
 
 void MPDeviceBleImpl::getUserCategories(const MessageHandlerCbData &cb)
 {
+    const QString requestKey = QStringLiteral("categories");
+    if (!userCategoriesRequests.join(requestKey, cb))
+    {
+        qDebug() << "Sharing user categories result";
+        return;
+    }
+
     AsyncJobs *jobs = new AsyncJobs("Get User Categories", this);
 
     jobs->append(new MPCommandJob(mpDev, MPCmd::GET_USER_CATEGORIES,
-                            [this, cb](const QByteArray &data, bool &)
+                            [this, requestKey](const QByteArray &data, bool &)
                             {
                                 if (MSG_SUCCESS == bleProt->getMessageSize(data))
                                 {
                                     qWarning() << "Get user categories failed";
-                                    cb(false, "Get user categories failed", QByteArray{});
+                                    userCategoriesRequests.finish(requestKey, false, false, "Get user categories failed", QByteArray{});
                                     return true;
                                 }
                                 qDebug() << "User categories got successfully";
 
-                                cb(true, "", bleProt->getFullPayload(data));
+                                userCategoriesRequests.finish(requestKey, true, true, "", bleProt->getFullPayload(data));
                                 return true;
                             }));
 
-    connect(jobs, &AsyncJobs::failed, [cb](AsyncJob *failedJob)
+    connect(jobs, &AsyncJobs::failed, [this, requestKey](AsyncJob *failedJob)
     {
         qCritical() << "Failed getting user categories: " << failedJob->getErrorStr();
-        cb(false, failedJob->getErrorStr(), QByteArray{});
+        userCategoriesRequests.finish(requestKey, false, false, failedJob->getErrorStr(), QByteArray{});
     });
 
     mpDev->enqueueAndRunJob(jobs);
@@ -448,6 +462,8 @@ void MPDeviceBleImpl::getUserCategories(const MessageHandlerCbData &cb)
 
 void MPDeviceBleImpl::setUserCategories(const QJsonObject &categories, const MessageHandlerCbData &cb)
 {
+    userCategoriesRequests.invalidate();
+
     AsyncJobs *jobs = new AsyncJobs("Set User Categories", this);
 
     jobs->append(new MPCommandJob(mpDev, MPCmd::SET_USER_CATEGORIES,
@@ -627,10 +643,7 @@ void MPDeviceBleImpl::setNodeCategory(MPNode* node, int category)
 {
     if (auto* nodeBle = dynamic_cast<MPNodeBLE*>(node))
     {
-        if (AppDaemon::isDebugDev())
-        {
-            qDebug() << "Setting category to: " << category;
-        }
+        qTraceMmm() << "Setting category to: " << category;
         nodeBle->setCategory(category);
     }
 }
@@ -639,10 +652,7 @@ void MPDeviceBleImpl::setNodeKeyAfterLogin(MPNode *node, int key)
 {
     if (auto* nodeBle = dynamic_cast<MPNodeBLE*>(node))
     {
-        if (AppDaemon::isDebugDev())
-        {
-            qDebug() << "Setting keyAfterLogin to: " << key;
-        }
+        qTraceMmm() << "Setting keyAfterLogin to: " << key;
         nodeBle->setKeyAfterLogin(key);
     }
 }
@@ -651,10 +661,7 @@ void MPDeviceBleImpl::setNodeKeyAfterPwd(MPNode *node, int key)
 {
     if (auto* nodeBle = dynamic_cast<MPNodeBLE*>(node))
     {
-        if (AppDaemon::isDebugDev())
-        {
-            qDebug() << "Setting keyAfterPwd to: " << key;
-        }
+        qTraceMmm() << "Setting keyAfterPwd to: " << key;
         nodeBle->setKeyAfterPwd(key);
     }
 }
@@ -663,10 +670,7 @@ void MPDeviceBleImpl::setNodePwdBlankFlag(MPNode *node)
 {
     if (auto* nodeBle = dynamic_cast<MPNodeBLE*>(node))
     {
-        if (AppDaemon::isDebugDev())
-        {
-            qDebug() << "Setting password blank flag";
-        }
+        qTraceMmm() << "Setting password blank flag";
         nodeBle->setPwdBlankFlag();
     }
 }
@@ -836,9 +840,9 @@ void MPDeviceBleImpl::generateExportData(QJsonArray &exportTopArray)
     for (qint32 i = 0; i < login.size(); i++)
     {
         QJsonObject nodeObject = QJsonObject();
-        nodeObject["address"] = QJsonValue(Common::bytesToJson(login[i]->getAddress()));
+        nodeObject["address"] = QJsonValue(Common::bytesToJsonCompact(login[i]->getAddress()));
         nodeObject["name"] = QJsonValue(login[i]->getService());
-        nodeObject["data"] = QJsonValue(Common::bytesToJsonObjectArray(login[i]->getNodeData()));
+        nodeObject["data"] = QJsonValue(Common::bytesToJsonCompact(login[i]->getNodeData()));
         nodeQJsonArray.append(QJsonValue(nodeObject));
     }
     exportTopArray.append(QJsonValue(nodeQJsonArray));
@@ -849,9 +853,9 @@ void MPDeviceBleImpl::generateExportData(QJsonArray &exportTopArray)
     for (qint32 i = 0; i < loginChild.size(); i++)
     {
         QJsonObject nodeObject = QJsonObject();
-        nodeObject["address"] = QJsonValue(Common::bytesToJson(loginChild[i]->getAddress()));
+        nodeObject["address"] = QJsonValue(Common::bytesToJsonCompact(loginChild[i]->getAddress()));
         nodeObject["name"] = QJsonValue(loginChild[i]->getLogin());
-        nodeObject["data"] = QJsonValue(Common::bytesToJsonObjectArray(loginChild[i]->getNodeData()));
+        nodeObject["data"] = QJsonValue(Common::bytesToJsonCompact(loginChild[i]->getNodeData()));
         nodeObject["pointed"] = QJsonValue(false);
         nodeQJsonArray.append(QJsonValue(nodeObject));
     }
@@ -986,8 +990,7 @@ void MPDeviceBleImpl::sendBundleToDevice(QString filePath, AsyncJobs *jobs, cons
                                       };
                                       cbProgress(progress);
 
-                                      if (AppDaemon::isDebugDev())
-                                          qDebug() << "Sending message to address #" << curAddress;
+                                      qTracePacket() << "Sending message to address #" << curAddress;
 
                                       return true;
                                   }));
@@ -155,6 +155,7 @@ private:
     QJsonObject m_categories;
     QJsonObject m_categoriesToImport;
     bool m_categoriesFetched = false;
+    RequestCoalescer<bool, QString, QByteArray> userCategoriesRequests{USER_CATEGORIES_CACHE_TTL};
     QJsonObject m_deviceLanguages;
     QJsonObject m_keyboardLayouts;
 
@@ -164,6 +165,7 @@ private:
     static constexpr int BUNBLE_DATA_ADDRESS_SIZE = 4;
     static constexpr int USER_CATEGORY_COUNT = 4;
     static constexpr int USER_CATEGORY_LENGTH = 66;
+    static constexpr int USER_CATEGORIES_CACHE_TTL = 3000;
     static constexpr int FAV_DATA_SIZE = 4;
     static constexpr int FAV_NUMBER = 50;
     static constexpr int LONG_MESSAGE_TIMEOUT_MS = 2000;
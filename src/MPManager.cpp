@@ -107,7 +107,11 @@ void MPManager::usbDeviceAdded(QString path)
     Q_UNUSED(path);
     return;
 #endif
-    if (devices.empty())
+    if (droppedLinks.contains(path))
+    {
+        qDebug() << "Device is already connected with usb: " << path;
+    }
+    else if (!devices.contains(path))
     {
         MPDevice *device = nullptr;
 #if defined(Q_OS_WIN)
@@ -120,18 +124,11 @@ void MPManager::usbDeviceAdded(QString path)
             return;
         }
 
-        if (isBluetooth && isBLEConnectedWithUsb())
-        {
-            qDebug() << "BLE is already connected with usb";
-            return;
-        }
-
         device = new MPDevice_win(this, MPDevice_win::getPlatDef(path, isBLE, isBluetooth));
 #elif defined(Q_OS_MAC)
         device = new MPDevice_mac(this, MPDevice_mac::getPlatDef(path));
 #endif
-        devices[path] = device;
-        emit mpConnected(device);
+        addDevice(path, device);
     }
     else
     {
@@ -142,13 +139,12 @@ void MPManager::usbDeviceAdded(QString path)
 #if defined(Q_OS_LINUX)
 void MPManager::usbDeviceAdded(QString path, bool isBLE, bool isBT)
 {
-    if (devices.empty())
+    if (droppedLinks.contains(path))
+    {
+        qDebug() << "Device is already connected with usb: " << path;
+    }
+    else if (!devices.contains(path))
     {
-        if (isBLE && isBLEConnectedWithUsb())
-        {
-            qDebug() << "BLE is already connected with usb";
-            return;
-        }
         MPDevice *device = nullptr;
         //Create our platform device object
         MPPlatformDef def;
@@ -158,8 +154,7 @@ void MPManager::usbDeviceAdded(QString path, bool isBLE, bool isBT)
         def.isBluetooth = isBT;
         device = new MPDevice_linux(this, def);
 
-        devices[path] = device;
-        emit mpConnected(device);
+        addDevice(path, device);
     }
     else
     {
@@ -171,6 +166,7 @@ void MPManager::usbDeviceAdded(QString path, bool isBLE, bool isBT)
 void MPManager::usbDeviceRemoved(QString path)
 {
     bool isMpDisconnected = false;
+    droppedLinks.remove(path);
     auto it = devices.find(path);
     if (it != devices.end())
     {
@@ -192,6 +188,27 @@ void MPManager::usbDeviceRemoved(QString path)
     }
 }
 
+MPDevice* MPManager::findDevice(const QString &id) const
+{
+    bool isNumber = false;
+    const qint64 num = id.toLongLong(&isNumber);
+    if (!isNumber)
+    {
+        return nullptr;
+    }
+
+    for (MPDevice *dev: devices)
+    {
+        //serial number is 0 and uid is -1 until they are read from the device
+        if ((dev->get_serialNumber() != 0 && static_cast<qint64>(dev->get_serialNumber()) == num) ||
+            (dev->get_uid() != -1 && dev->get_uid() == num))
+        {
+            return dev;
+        }
+    }
+    return nullptr;
+}
+
 MPDevice* MPManager::getDevice(int at)
 {
     if (at < 0 || at >= devices.count())
@@ -221,33 +238,23 @@ void MPManager::checkUsbDevices()
 #endif
     }
 
-#if defined(Q_OS_WIN) || defined(Q_OS_LINUX)
-    //Remove bt connection if usb is connected too
-    if (devlist.size() > 1)
-    {
-        auto it = std::remove_if(devlist.begin(), devlist.end(),
-                               [](MPPlatformDef def){return def.isBluetooth;});
-        if (it != devlist.end())
-        {
-            devlist.erase(it);
-        }
-    }
-#endif
-
     if (AppDaemon::isEmulationMode())
     {
         MPDevice *device;
         device = new MPDevice_emul(this);
         detectedDevs.append("EMULDEVICE_ID");
-        devices["EMULDEVICE_ID"] = device;
-        emit mpConnected(device);
+        addDevice("EMULDEVICE_ID", device);
     }
     else
     {
         for (const MPPlatformDef &def : devlist)
         {
             //This is a new connected mooltipass
-            if (!devices.contains(def.id))
+            if (droppedLinks.contains(def.id))
+            {
+                qDebug() << "Device is already connected with usb: " << def.id;
+            }
+            else if (!devices.contains(def.id))
             {
                 MPDevice *device;
 
@@ -260,8 +267,7 @@ void MPManager::checkUsbDevices()
                 device = new MPDevice_linux(this, def);
 #endif
 
-                devices[def.id] = device;
-                emit mpConnected(device);
+                addDevice(def.id, device);
             }
             else
             {
@@ -278,8 +284,7 @@ void MPManager::checkUsbDevices()
             {
                 MPDevice *device = new MPDevice_localSocket(this, def);
 
-                devices[def.id] = device;
-                emit mpConnected(device);
+                addDevice(def.id, device);
             }
             else
             {
@@ -304,11 +309,53 @@ void MPManager::checkUsbDevices()
         else
             it++;
     }
+
+    auto dropped = droppedLinks.begin();
+    while (dropped != droppedLinks.end())
+    {
+        if (!detectedDevs.contains(*dropped))
+            dropped = droppedLinks.erase(dropped);
+        else
+            dropped++;
+    }
 }
 
-bool MPManager::isBLEConnectedWithUsb()
+void MPManager::addDevice(const QString &id, MPDevice *device)
 {
-    return std::find_if(devices.begin(), devices.end(),
-              [](MPDevice * dev){ return dev->isBLE();})
-            != devices.end();
+    devices[id] = device;
+    //A BLE can be connected with usb and bluetooth at the same time,
+    //both links are only told apart once its serial number is read
+    connect(device, &MPDevice::serialNumberChanged, this, [this, device]()
+    {
+        removeDuplicateLink(device);
+    });
+    emit mpConnected(device);
+}
+
+void MPManager::removeDuplicateLink(MPDevice *device)
+{
+    const quint32 serial = device->get_serialNumber();
+    if (0 == serial)
+    {
+        return;
+    }
+
+    for (MPDevice *other: devices)
+    {
+        if (other == device || other->get_serialNumber() != serial || other->isBT() == device->isBT())
+        {
+            continue;
+        }
+
+        //Keep the usb link
+        MPDevice *btDevice = device->isBT()? device : other;
+        const QString id = devices.key(btDevice);
+        qInfo() << "Device" << serial << "is connected with usb, dropping its bluetooth link" << id;
+        devices.remove(id);
+        droppedLinks.insert(id);
+        emit mpDisconnected(btDevice);
+        //We may be called from a signal of that device
+        btDevice->deleteLater();
+        return;
+    }
 }
@@ -46,6 +46,10 @@ public:
     void stop();
     MPDevice* getDevice(int at);
     int getDeviceCount() { return devices.count(); }
+    QList<MPDevice *> getDevices() const { return devices.values(); }
+
+    //Find a connected device given its serial number or its uid
+    MPDevice* findDevice(const QString &id) const;
 
 signals:
     void mpConnected(MPDevice *device);
@@ -64,9 +68,12 @@ private:
     MPManager();
 
     void checkUsbDevices();
-    bool isBLEConnectedWithUsb();
+    void addDevice(const QString &id, MPDevice *device);
+    void removeDuplicateLink(MPDevice *device);
 
     QHash<QString, MPDevice *> devices;
+    //Bluetooth links of devices also connected with usb
+    QSet<QString> droppedLinks;
 };
 
 #endif // MPMANAGER_H
@@ -28,8 +28,7 @@
 #include "SettingsGuiHelper.h"
 #include "DeviceDetector.h"
 
-#include "qtcsv/stringdata.h"
-#include "qtcsv/reader.h"
+#include "CsvImporter.h"
 
 const QString MainWindow::NONE_STRING = tr("None");
 const QString MainWindow::TAB_STRING = tr("Tab");
@@ -1549,66 +1548,27 @@ void MainWindow::on_pushButtonImportCSV_clicked()
 
     s.setValue("last_used_path/import_csv_dir", QFileInfo(fname).canonicalPath());
 
-    QList<QStringList> readData;
-    QString probe_separators = ",;.\t";
-    QList<int> invalid_lines;
+    // Parse the file on a worker thread, big exports would freeze the UI
+    ui->widgetHeader->setEnabled(false);
+    ui->pushButtonImportCSV->setEnabled(false);
 
-    foreach (QChar c, probe_separators)
+    // No parent: the thread deletes itself once done, even if the window is gone
+    CsvImporter *importer = new CsvImporter(fname);
+    connect(importer, &CsvImporter::finished, importer, &CsvImporter::deleteLater);
+    connect(importer, &CsvImporter::importFailed, this, [this](const QString &errorMessage)
     {
-        qDebug() << "Probing read CSV with" << c << "as a separator";
-
-        readData = QtCSV::Reader::readToList(fname, c);
-
-        // empty file will be empty with any separator, stop immediately
-        if (readData.size() == 0)
-        {
-            QMessageBox::warning(this, tr("Error"), tr("Nothing is read from %1").arg(fname));
-            return;
-        }
-
-        invalid_lines.clear();
-
-        // Check every line of CSV file contains only 3 rows
-        for(int i = 0 ; i < readData.size() ; i++)
-        {
-            if (readData.at(i).size() != 3)
-                invalid_lines.append(i+1);
-        }
-
-        if (invalid_lines.size() == 0)
-        {
-            qDebug() << "ImportCSV: CSV" << c << "delimiter detected";
-            break;
-        }
-
-        // less than 10% of lines contains not 3 elements. It may be a password database
-        if (invalid_lines.size() < (readData.size() * 0.5))
-        {
-            if (invalid_lines.size() < 10)
-            {
-                QStringList sl;
-                foreach(int n, invalid_lines)
-                    sl << QString("%1").arg(n);
-                QMessageBox::warning(this, tr("Error"), tr("Unable to import %1: Each row must contain exact 3 items. Some lines don't (lines number: %2)").arg(fname).arg(sl.join(",")));
-            }
-            else
-            {
-                QMessageBox::warning(this, tr("Error"), tr("Unable to import %1: Each row must contain exact 3 items (more than 10 lines don't)").arg(fname));
-            }
-            return;
-        }
-    }
-
-    if (invalid_lines.size() > 0)
+        ui->widgetHeader->setEnabled(true);
+        ui->pushButtonImportCSV->setEnabled(true);
+        QMessageBox::warning(this, tr("Error"), errorMessage);
+    });
+    connect(importer, &CsvImporter::importParsed, this, [this](const QJsonArray &creds)
     {
-        QMessageBox::warning(this, tr("Error"), tr("Unable to import %1: Each row must contain exact 3 items using comma as a delimiter").arg(fname));
-        return;
-    }
-
-    ui->widgetHeader->setEnabled(false);
-    wsClient->importCSVFile(readData);
-    connect(wsClient, &WSClient::dbImported, this, &MainWindow::dbImported);
-    wantImportDatabase();
+        ui->pushButtonImportCSV->setEnabled(true);
+        wsClient->importCSVFile(creds);
+        connect(wsClient, &WSClient::dbImported, this, &MainWindow::dbImported);
+        wantImportDatabase();
+    });
+    importer->start();
 }
 
 void MainWindow::onLockDeviceSystemEventsChanged(bool checked)
@@ -8,46 +8,166 @@ MPBLEFreeAddressProvider::MPBLEFreeAddressProvider(MessageProtocolBLE *mesProt,
 
 }
 
-QByteArray MPBLEFreeAddressProvider::getFreeAddress(const int virtualAddr)
+QByteArray MPBLEFreeAddressProvider::getFreeAddress(const int virtualAddr) const
 {
-    if (m_parentAddrMapping.contains(virtualAddr))
+    const qint32 slot = virtualAddr >= 0 && virtualAddr < m_virtualSlots.size() ? m_virtualSlots[virtualAddr] : NO_SLOT;
+    if (NO_SLOT == slot)
     {
-        return m_parentAddrMapping[virtualAddr];
+        qCritical() << "No address reserved for virtual address: " << virtualAddr;
+        return QByteArray{};
     }
-    else if (m_childAddrMapping.contains(virtualAddr))
+
+    const QByteArray &pool = (slot & 1) ? m_childPool : m_parentPool;
+    const int pos = (slot >> 1) * MPNode::ADDRESS_LENGTH;
+    if (pos + MPNode::ADDRESS_LENGTH > pool.size())
     {
-        return m_childAddrMapping[virtualAddr];
+        qCritical() << "No address loaded for virtual address: " << virtualAddr;
+        return QByteArray{};
     }
-    qCritical() << "No address loaded for virtual address: " << virtualAddr;
-    return QByteArray{};
+    return pool.mid(pos, MPNode::ADDRESS_LENGTH);
 }
 
 void MPBLEFreeAddressProvider::loadFreeAddresses(AsyncJobs *jobs, const QByteArray &addressFrom, const MPDeviceProgressCb &cbProgress)
 {
-    if (0 == m_parentNodeNeeded && 0 == m_childNodeNeeded)
+    if (0 == m_parentReserved && 0 == m_childReserved)
     {
         qDebug() << "No free address is required";
         return;
     }
 
-    auto addressPackage = addressFrom;
-    auto freeAddrNum = MAX_FREE_ADDR_REQ;
-    FreeAddressInfo addressInfo;
-    addressInfo.parentNodeRequested = getNodeAskedNumber(MPNode::NodeParent, freeAddrNum);
-    addressInfo.childNodeRequested = getNodeAskedNumber(MPNode::NodeChild, freeAddrNum);
-    addressPackage.append(bleProt->toLittleEndianFromInt(addressInfo.parentNodeRequested));
-    addressPackage.append(bleProt->toLittleEndianFromInt(addressInfo.childNodeRequested));
+    appendFetchJob(jobs, addressFrom, cbProgress, 0, 0);
+}
 
-    addressInfo.startingPosition = 0;
-    jobs->append(createGetFreeAddressPackage(jobs, cbProgress, addressInfo, addressPackage));
+void MPBLEFreeAddressProvider::prefetchFreeAddresses()
+{
+    if (poolSize(MPNode::NodeParent) >= PREFETCH_PARENT_NODES &&
+        poolSize(MPNode::NodeChild) >= PREFETCH_CHILD_NODES)
+    {
+        return;
+    }
+
+    auto *jobs = new AsyncJobs("Prefetching free addresses", mpDev);
+    jobs->setPriority(AsyncJobs::PriorityBackground);
+
+    /* MMM may have been left before this queue runs */
+    auto *mmmCheckJob = new CustomJob();
+    mmmCheckJob->setWork([this, mmmCheckJob]()
+    {
+        if (mpDev->get_memMgmtMode())
+        {
+            emit mmmCheckJob->done(QByteArray());
+        }
+        else
+        {
+            emit mmmCheckJob->error();
+        }
+    });
+    jobs->append(mmmCheckJob);
+    appendFetchJob(jobs, MPNode::EmptyAddress, [](QVariantMap) {}, PREFETCH_PARENT_NODES, PREFETCH_CHILD_NODES);
+
+    QObject::connect(jobs, &AsyncJobs::finished, [this](const QByteArray &)
+    {
+        qDebug() << "Free addresses prefetched: " << poolSize(MPNode::NodeParent) << "parent," << poolSize(MPNode::NodeChild) << "child";
+    });
+    QObject::connect(jobs, &AsyncJobs::failed, [](AsyncJob *)
+    {
+        qDebug() << "Free addresses not prefetched";
+    });
+
+    mpDev->enqueueAndRunJob(jobs);
+}
+
+void MPBLEFreeAddressProvider::resetReservations()
+{
+    /* Reserved addresses may have been written by the last save */
+    m_parentPool.remove(0, qMin(m_parentPool.size(), m_parentReserved * MPNode::ADDRESS_LENGTH));
+    m_childPool.remove(0, qMin(m_childPool.size(), m_childReserved * MPNode::ADDRESS_LENGTH));
+    m_parentReserved = 0;
+    m_childReserved = 0;
+    m_virtualSlots.clear();
 }
 
 void MPBLEFreeAddressProvider::cleanFreeAddresses()
 {
     m_parentNodeNeeded = 0;
-    m_parentAddrMapping.clear();
     m_childNodeNeeded = 0;
-    m_childAddrMapping.clear();
+    m_parentPool.clear();
+    m_childPool.clear();
+    m_parentReserved = 0;
+    m_childReserved = 0;
+    m_virtualSlots.clear();
+}
+
+void MPBLEFreeAddressProvider::reserve(int mappingAddr, MPNode::NodeType nodeType)
+{
+    if (mappingAddr < 0)
+    {
+        qCritical() << "Invalid virtual address: " << mappingAddr;
+        return;
+    }
+
+    /* Virtual addresses are given in increasing order */
+    while (m_virtualSlots.size() <= mappingAddr)
+    {
+        m_virtualSlots.append(NO_SLOT);
+    }
+
+    if (MPNode::NodeParent == nodeType)
+    {
+        m_virtualSlots[mappingAddr] = m_parentReserved++ * 2;
+    }
+    else
+    {
+        m_virtualSlots[mappingAddr] = m_childReserved++ * 2 + 1;
+    }
+}
+
+int MPBLEFreeAddressProvider::poolSize(MPNode::NodeType nodeType) const
+{
+    const QByteArray &pool = MPNode::NodeParent == nodeType ? m_parentPool : m_childPool;
+    return pool.size() / MPNode::ADDRESS_LENGTH;
+}
+
+void MPBLEFreeAddressProvider::appendFetchJob(AsyncJobs *jobs, const QByteArray &addressFrom, const MPDeviceProgressCb &cbProgress, int minParentNodes, int minChildNodes)
+{
+    /* Needs are only known once the jobs before this one have run */
+    auto *fetchJob = new CustomJob();
+    fetchJob->setWork([this, jobs, fetchJob, addressFrom, cbProgress, minParentNodes, minChildNodes]()
+    {
+        const int parentNodes = qMax(m_parentReserved, minParentNodes);
+        const int childNodes = qMax(m_childReserved, minChildNodes);
+        if (parentNodes <= poolSize(MPNode::NodeParent) && childNodes <= poolSize(MPNode::NodeChild))
+        {
+            qDebug() << "Free addresses already loaded";
+            emit fetchJob->done(QByteArray());
+            return;
+        }
+
+        /*
+         * The device returns the first free addresses from addressFrom,
+         * the ones already in the pools would come back first, so the
+         * pools are loaded again from scratch.
+         */
+        m_parentPool.clear();
+        m_childPool.clear();
+        m_parentNodeNeeded = parentNodes;
+        m_childNodeNeeded = childNodes;
+
+        auto addressPackage = addressFrom;
+        auto freeAddrNum = MAX_FREE_ADDR_REQ;
+        FreeAddressInfo addressInfo;
+        addressInfo.parentNodeRequested = getNodeAskedNumber(MPNode::NodeParent, freeAddrNum);
+        addressInfo.childNodeRequested = getNodeAskedNumber(MPNode::NodeChild, freeAddrNum);
+        addressPackage.append(bleProt->toLittleEndianFromInt(addressInfo.parentNodeRequested));
+        addressPackage.append(bleProt->toLittleEndianFromInt(addressInfo.childNodeRequested));
+
+        addressInfo.startingPosition = 0;
+        addressInfo.newParentNodes = addressInfo.parentNodeRequested;
+        addressInfo.newChildNodes = addressInfo.childNodeRequested;
+        jobs->prepend(createGetFreeAddressPackage(jobs, cbProgress, addressInfo, addressPackage));
+        emit fetchJob->done(QByteArray());
+    });
+    jobs->append(fetchJob);
 }
 
 quint16 MPBLEFreeAddressProvider::getNodeAskedNumber(MPNode::NodeType nodeType, int &freeAddrNum)
@@ -73,17 +193,11 @@ quint16 MPBLEFreeAddressProvider::getNodeAskedNumber(MPNode::NodeType nodeType,
     return 0;
 }
 
-void MPBLEFreeAddressProvider::processReceivedAddrNumber(MPNode::NodeType nodeType, const QByteArray &receivedAddr, int &pos)
+void MPBLEFreeAddressProvider::processReceivedAddrNumber(MPNode::NodeType nodeType, const QByteArray &receivedAddr, int &pos, int count)
 {
-    auto& m_addrMapping = MPNode::NodeParent == nodeType ? m_parentAddrMapping : m_childAddrMapping;
-    for (auto& ba : m_addrMapping)
-    {
-        if (ba.isEmpty())
-        {
-            ba.append(receivedAddr.mid(pos, MPNode::ADDRESS_LENGTH));
-            pos += MPNode::ADDRESS_LENGTH;
-        }
-    }
+    auto& pool = MPNode::NodeParent == nodeType ? m_parentPool : m_childPool;
+    pool.append(receivedAddr.mid(pos, count * MPNode::ADDRESS_LENGTH));
+    pos += count * MPNode::ADDRESS_LENGTH;
 }
 
 void MPBLEFreeAddressProvider::loadRemainingFreeAddresses(AsyncJobs *jobs, const QByteArray &addressFrom, const MPDeviceProgressCb &cbProgress, bool isLastChild)
@@ -102,6 +216,8 @@ void MPBLEFreeAddressProvider::loadRemainingFreeAddresses(AsyncJobs *jobs, const
      * Increasing the requested node number of addressFrom's type,
      * because it will be received again in the response.
      */
+    addressInfo.newParentNodes = addressInfo.parentNodeRequested;
+    addressInfo.newChildNodes = addressInfo.childNodeRequested;
     if (isLastChild)
     {
         ++addressInfo.childNodeRequested;
@@ -140,8 +256,8 @@ MPCommandJob* MPBLEFreeAddressProvider::createGetFreeAddressPackage(AsyncJobs *j
 
                 int pos = addressInfo.startingPosition;
 
-                processReceivedAddrNumber(MPNode::NodeParent, receivedAddresses, pos);
-                processReceivedAddrNumber(MPNode::NodeChild, receivedAddresses, pos);
+                processReceivedAddrNumber(MPNode::NodeParent, receivedAddresses, pos, addressInfo.newParentNodes);
+                processReceivedAddrNumber(MPNode::NodeChild, receivedAddresses, pos, addressInfo.newChildNodes);
 
                 // There are more needed nodes
                 if (m_parentNodeNeeded + m_childNodeNeeded > 0)
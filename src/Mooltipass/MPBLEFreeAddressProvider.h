@@ -5,6 +5,13 @@
 #include "MPDevice.h"
 
 class MessageProtocolBLE;
+
+/* Free flash addresses for the nodes created in MMM.
+ * Parent and child addresses are kept in two flat pools, filled in the
+ * background right after entering MMM. Each virtual address reserves the
+ * next slot of its pool, so resolving it is an array access, and a save
+ * only has to ask the device when the prefetched pools are too small.
+ */
 class MPBLEFreeAddressProvider
 {
     struct FreeAddressInfo
@@ -12,18 +19,29 @@ class MPBLEFreeAddressProvider
         int parentNodeRequested = 0;
         int childNodeRequested = 0;
         int startingPosition = 0;
+        //Addresses not received in a previous packet
+        int newParentNodes = 0;
+        int newChildNodes = 0;
     };
 
 public:
     MPBLEFreeAddressProvider(MessageProtocolBLE *mesProt, MPDevice *dev);
 
-    void incrementParentNodeNeeded(int mappingAddr) { ++m_parentNodeNeeded; m_parentAddrMapping[mappingAddr] = QByteArray{}; }
-    void incrementChildNodeNeeded(int mappingAddr) { ++m_childNodeNeeded; m_childAddrMapping[mappingAddr] = QByteArray{}; }
-    QByteArray getFreeAddress(const int virtualAddr);
+    void incrementParentNodeNeeded(int mappingAddr) { reserve(mappingAddr, MPNode::NodeParent); }
+    void incrementChildNodeNeeded(int mappingAddr) { reserve(mappingAddr, MPNode::NodeChild); }
+    QByteArray getFreeAddress(const int virtualAddr) const;
     void loadFreeAddresses(AsyncJobs *jobs, const QByteArray &addressFrom, const MPDeviceProgressCb &cbProgress);
+    //Fill the pools while the user is editing in MMM
+    void prefetchFreeAddresses();
+    //Virtual addresses are numbered again from 1
+    void resetReservations();
     void cleanFreeAddresses();
 
 private:
+    void reserve(int mappingAddr, MPNode::NodeType nodeType);
+    int poolSize(MPNode::NodeType nodeType) const;
+    void appendFetchJob(AsyncJobs *jobs, const QByteArray &addressFrom, const MPDeviceProgressCb &cbProgress, int minParentNodes, int minChildNodes);
+
     /**
      * @brief getNodeAskedNumber
      * @param nodeType: The type of requested address (child/parent)
@@ -31,7 +49,7 @@ private:
      * @return Number of addresses which will requested in the next packet of nodeType
      */
     quint16 getNodeAskedNumber(MPNode::NodeType nodeType, int& freeAddrNum);
-    void processReceivedAddrNumber(MPNode::NodeType nodeType, const QByteArray& receivedAddr, int& pos);
+    void processReceivedAddrNumber(MPNode::NodeType nodeType, const QByteArray& receivedAddr, int& pos, int count);
     void loadRemainingFreeAddresses(AsyncJobs *jobs, const QByteArray &addressFrom, const MPDeviceProgressCb &cbProgress, bool isLastChild);
     MPCommandJob* createGetFreeAddressPackage(AsyncJobs *jobs, const MPDeviceProgressCb &cbProgress, FreeAddressInfo addressInfo, const QByteArray& addrPackage);
 
@@ -39,12 +57,22 @@ private:
     MessageProtocolBLE *bleProt;
     MPDevice *mpDev;
 
+    //Addresses still to be asked to the device
     int m_parentNodeNeeded = 0;
     int m_childNodeNeeded = 0;
-    QMap<int, QByteArray> m_parentAddrMapping;
-    QMap<int, QByteArray> m_childAddrMapping;
+
+    //Received addresses, MPNode::ADDRESS_LENGTH bytes each
+    QByteArray m_parentPool;
+    QByteArray m_childPool;
+    int m_parentReserved = 0;
+    int m_childReserved = 0;
+    //Pool slot of each virtual address: index * 2 + 1 for a child
+    QVector<qint32> m_virtualSlots;
 
     static constexpr int MAX_FREE_ADDR_REQ = 266;
+    static constexpr int PREFETCH_PARENT_NODES = 64;
+    static constexpr int PREFETCH_CHILD_NODES = 128;
+    static constexpr qint32 NO_SLOT = -1;
 };
 
 #endif // MPBLEFREEADDRESSPROVIDER_H
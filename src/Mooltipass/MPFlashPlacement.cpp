@@ -0,0 +1,77 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "MPFlashPlacement.h"
+
+#include <algorithm>
+#include <iterator>
+
+quint16 MPFlashPlacement::pageFromAddress(const QByteArray &address)
+{
+    return (((quint16)address[1] << 5) & 0x1FE0) | (((quint16)address[0] >> 3) & 0x001F);
+}
+
+void MPFlashPlacement::addFreeAddress(const QByteArray &address)
+{
+    m_freeByPage[pageFromAddress(address)].append(address);
+    ++m_count;
+}
+
+QByteArray MPFlashPlacement::take(int preferredPage)
+{
+    if (m_freeByPage.isEmpty())
+    {
+        return QByteArray();
+    }
+
+    auto it = m_freeByPage.begin();
+    if (preferredPage >= 0)
+    {
+        /* First page at or after the preferred one, unless the one before is closer */
+        it = m_freeByPage.lowerBound(static_cast<quint16>(preferredPage));
+        if (it == m_freeByPage.end() ||
+            (it != m_freeByPage.begin() && preferredPage - std::prev(it).key() < it.key() - preferredPage))
+        {
+            --it;
+        }
+    }
+
+    const QByteArray address = it->takeFirst();
+    if (it->isEmpty())
+    {
+        m_freeByPage.erase(it);
+    }
+    --m_count;
+    return address;
+}
+
+void MPNodeWriteBatch::add(const QByteArray &address, const QByteArray &data)
+{
+    m_writes.append(qMakePair(address, data));
+}
+
+QVector<QPair<QByteArray, QByteArray>> MPNodeWriteBatch::takeSorted()
+{
+    QVector<QPair<QByteArray, QByteArray>> writes;
+    writes.swap(m_writes);
+    std::stable_sort(writes.begin(), writes.end(), [](const QPair<QByteArray, QByteArray> &a, const QPair<QByteArray, QByteArray> &b)
+    {
+        return MPFlashPlacement::pageFromAddress(a.first) < MPFlashPlacement::pageFromAddress(b.first);
+    });
+    return writes;
+}
@@ -0,0 +1,63 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef MPFLASHPLACEMENT_H
+#define MPFLASHPLACEMENT_H
+
+#include <QByteArray>
+#include <QByteArrayList>
+#include <QMap>
+#include <QPair>
+#include <QVector>
+
+/* Pool of free node addresses grouped by flash page.
+ * New nodes take the free address closest to the page of the node they
+ * are linked to, so walking a list later reads fewer pages.
+ */
+class MPFlashPlacement
+{
+public:
+    /* Address format is 2 bytes little endian. last 3 bits are node number and first 13 bits are page address */
+    static quint16 pageFromAddress(const QByteArray &address);
+
+    void addFreeAddress(const QByteArray &address);
+    //Free address on preferredPage or on the closest page, lowest one when preferredPage is -1
+    QByteArray take(int preferredPage);
+    int size() const { return m_count; }
+
+private:
+    QMap<quint16, QByteArrayList> m_freeByPage;
+    int m_count = 0;
+};
+
+/* Node writes of a save, sent page by page.
+ * Writes on the same page keep the order they were added in.
+ */
+class MPNodeWriteBatch
+{
+public:
+    void add(const QByteArray &address, const QByteArray &data);
+    bool isEmpty() const { return m_writes.isEmpty(); }
+    //Address and data of the writes sorted by page, the batch is emptied
+    QVector<QPair<QByteArray, QByteArray>> takeSorted();
+
+private:
+    QVector<QPair<QByteArray, QByteArray>> m_writes;
+};
+
+#endif // MPFLASHPLACEMENT_H
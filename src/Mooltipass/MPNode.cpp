@@ -434,7 +434,7 @@ QJsonObject MPNode::toJson() const
     {
         obj["login"] = getLogin();
         obj["description"] = getDescription();
-        obj["password_enc"] = Common::bytesToJson(getPasswordEnc());
+        obj["password_enc"] = Common::bytesToJsonCompact(getPasswordEnc());
         obj["date_created"] = getDateCreated().toString(Qt::ISODate);
         obj["date_last_used"] = getDateLastUsed().toString(Qt::ISODate);
         obj["address"] = QJsonArray({{ address.at(0) },
@@ -451,7 +451,7 @@ QJsonObject MPNode::toJson() const
     }
     else if (getType() == NodeChildData)
     {
-        obj["data"] = Common::bytesToJson(getDataChildNodeData());
+        obj["data"] = Common::bytesToJsonCompact(getDataChildNodeData());
     }
 
     return obj;
@@ -0,0 +1,375 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "MPNodeGraphChecker.h"
+
+#include <QHash>
+#include <QRunnable>
+#include <QThreadPool>
+
+namespace
+{
+const QByteArray EMPTY_ADDRESS = QByteArray(2, 0);
+
+/* Below that many nodes the thread pool costs more than the walk */
+const int PARALLEL_MIN_NODES = 512;
+
+typedef MPNodeGraphChecker::Link Link;
+typedef MPNodeGraphChecker::Node Node;
+typedef MPNodeGraphChecker::Issue Issue;
+
+/* Same tests as the ones written out in MPDevice::tagPointedNodes() */
+bool isSet(const Link &link)
+{
+    return (link.address != EMPTY_ADDRESS) || (link.address.isNull() && link.virtualAddress != 0);
+}
+
+bool isSameLink(const Link &link, const Link &other)
+{
+    return (!link.address.isNull() && link.address == other.address) || (link.address.isNull() && link.virtualAddress == other.virtualAddress);
+}
+
+Link nodeLink(const Node &node)
+{
+    Link link;
+    link.address = node.address;
+    link.virtualAddress = node.virtualAddress;
+    return link;
+}
+
+/* Gives the node MPDevice::findNodeWithAddressInList() would return:
+ * the first one of the list having the address, or having the virtual
+ * address when its own address is null.
+ */
+class NodeLookup
+{
+public:
+    explicit NodeLookup(const QVector<Node> &nodes)
+    {
+        m_byAddress.reserve(nodes.size());
+        for (int i = 0; i < nodes.size(); i++)
+        {
+            const Node &node = nodes[i];
+            if (node.address.isNull())
+            {
+                if (!m_byVirtualAddress.contains(node.virtualAddress))
+                {
+                    m_byVirtualAddress.insert(node.virtualAddress, i);
+                }
+            }
+            else if (!m_byAddress.contains(node.address))
+            {
+                m_byAddress.insert(node.address, i);
+            }
+        }
+    }
+
+    int find(const Link &link) const
+    {
+        const int byAddress = link.address.isNull() ? -1 : m_byAddress.value(link.address, -1);
+        const int byVirtualAddress = m_byVirtualAddress.value(link.virtualAddress, -1);
+        if (byAddress < 0)
+        {
+            return byVirtualAddress;
+        }
+        if (byVirtualAddress < 0)
+        {
+            return byAddress;
+        }
+        return qMin(byAddress, byVirtualAddress);
+    }
+
+private:
+    QHash<QByteArray, int> m_byAddress;
+    QHash<quint32, int> m_byVirtualAddress;
+};
+
+Issue makeIssue(MPNodeGraphChecker::Graph graph, MPNodeGraphChecker::IssueType type, const Link &link)
+{
+    Issue issue;
+    issue.graph = graph;
+    issue.type = type;
+    issue.link = link;
+    return issue;
+}
+
+class GraphTask : public QRunnable
+{
+public:
+    GraphTask(const MPNodeGraphChecker::GraphSnapshot &snapshot, MPNodeGraphChecker::Graph graph, QVector<Issue> &result):
+        m_snapshot(snapshot),
+        m_graph(graph),
+        m_result(result)
+    {}
+
+    void run() override
+    {
+        m_result = MPNodeGraphChecker::checkGraph(m_snapshot, m_graph);
+    }
+
+private:
+    const MPNodeGraphChecker::GraphSnapshot &m_snapshot;
+    MPNodeGraphChecker::Graph m_graph;
+    QVector<Issue> &m_result;
+};
+}
+
+void MPNodeGraphChecker::setGraph(Graph graph, const GraphSnapshot &snapshot)
+{
+    m_graphs[graph] = snapshot;
+}
+
+void MPNodeGraphChecker::setFavorites(const QList<QByteArray> &favorites)
+{
+    m_favorites = favorites;
+}
+
+MPNodeGraphChecker::RepairPlan MPNodeGraphChecker::run() const
+{
+    QVector<Issue> results[GraphCount];
+    int nodeCount = 0;
+    for (int i = 0; i < GraphCount; i++)
+    {
+        if (m_graphs[i].enabled)
+        {
+            nodeCount += m_graphs[i].parents.size() + m_graphs[i].children.size();
+        }
+    }
+
+    if (nodeCount < PARALLEL_MIN_NODES)
+    {
+        for (int i = 0; i < GraphCount; i++)
+        {
+            if (m_graphs[i].enabled)
+            {
+                results[i] = checkGraph(m_graphs[i], static_cast<Graph>(i));
+            }
+        }
+    }
+    else
+    {
+        /* The snapshots are only read, each task writes its own result */
+        QThreadPool pool;
+        pool.setMaxThreadCount(GraphCount);
+        for (int i = 0; i < GraphCount; i++)
+        {
+            if (m_graphs[i].enabled)
+            {
+                pool.start(new GraphTask(m_graphs[i], static_cast<Graph>(i), results[i]));
+            }
+        }
+        pool.waitForDone();
+    }
+
+    RepairPlan plan;
+    for (int i = 0; i < GraphCount; i++)
+    {
+        plan += results[i];
+    }
+    if (m_graphs[CredentialGraph].enabled)
+    {
+        plan += checkFavorites(m_graphs[CredentialGraph], m_favorites);
+    }
+    return plan;
+}
+
+QVector<MPNodeGraphChecker::Issue> MPNodeGraphChecker::checkGraph(const GraphSnapshot &snapshot, Graph graph)
+{
+    QVector<Issue> issues;
+    const NodeLookup parentLookup(snapshot.parents);
+    const NodeLookup childLookup(snapshot.children);
+    QVector<bool> parentPointed(snapshot.parents.size(), false);
+    QVector<bool> childPointed(snapshot.children.size(), false);
+
+    int parentIdx = -1;
+    Link parentLink = snapshot.start;
+
+    /* Loop through the parent nodes */
+    while (isSet(parentLink))
+    {
+        const int nextParentIdx = parentLookup.find(parentLink);
+        if (nextParentIdx < 0)
+        {
+            issues << makeIssue(graph, MissingParent, parentLink);
+            break;
+        }
+        if (parentPointed[nextParentIdx])
+        {
+            issues << makeIssue(graph, ParentLoop, parentLink);
+            break;
+        }
+
+        const Node &parent = snapshot.parents[nextParentIdx];
+        const Link &previous = parent.previous;
+        if (isSameLink(parentLink, snapshot.start))
+        {
+            /* first parent node: previous address should be an empty one */
+            if ((previous.address != EMPTY_ADDRESS) || (previous.address.isNull() && previous.virtualAddress != 0))
+            {
+                issues << makeIssue(graph, BadPreviousParent, parentLink);
+            }
+        }
+        else if (!isSameLink(previous, nodeLink(snapshot.parents[parentIdx])))
+        {
+            issues << makeIssue(graph, BadPreviousParent, parentLink);
+        }
+
+        parentIdx = nextParentIdx;
+        parentPointed[parentIdx] = true;
+
+        /* browse through all the children */
+        int childIdx = -1;
+        Link childLink = parent.firstChild;
+        while (isSet(childLink))
+        {
+            const int nextChildIdx = childLookup.find(childLink);
+            if (nextChildIdx < 0)
+            {
+                issues << makeIssue(graph, MissingChild, childLink);
+                break;
+            }
+            if (childPointed[nextChildIdx])
+            {
+                issues << makeIssue(graph, ChildLoop, childLink);
+                break;
+            }
+
+            const Node &child = snapshot.children[nextChildIdx];
+            if (snapshot.checkPreviousChild)
+            {
+                const Link &previousChild = child.previous;
+                if (isSameLink(childLink, parent.firstChild))
+                {
+                    /* first child node in given parent: previous address should be an empty one */
+                    if ((!previousChild.address.isNull() && previousChild.address != EMPTY_ADDRESS) || (previousChild.address.isNull() && previousChild.virtualAddress != 0))
+                    {
+                        issues << makeIssue(graph, BadPreviousChild, childLink);
+                    }
+                }
+                else if (!isSameLink(previousChild, nodeLink(snapshot.children[childIdx])))
+                {
+                    issues << makeIssue(graph, BadPreviousChild, childLink);
+                }
+            }
+
+            childIdx = nextChildIdx;
+            childPointed[childIdx] = true;
+            childLink = child.next;
+        }
+
+        parentLink = parent.next;
+    }
+
+    if (snapshot.reportOrphans)
+    {
+        for (int i = 0; i < snapshot.parents.size(); i++)
+        {
+            if (!parentPointed[i])
+            {
+                issues << makeIssue(graph, OrphanParent, nodeLink(snapshot.parents[i]));
+            }
+        }
+        for (int i = 0; i < snapshot.children.size(); i++)
+        {
+            if (!childPointed[i])
+            {
+                issues << makeIssue(graph, OrphanChild, nodeLink(snapshot.children[i]));
+            }
+        }
+    }
+
+    return issues;
+}
+
+QVector<MPNodeGraphChecker::Issue> MPNodeGraphChecker::checkFavorites(const GraphSnapshot &credentials, const QList<QByteArray> &favorites)
+{
+    QVector<Issue> issues;
+    const NodeLookup parentLookup(credentials.parents);
+    const NodeLookup childLookup(credentials.children);
+
+    for (int i = 0; i < favorites.size(); i++)
+    {
+        Link parentLink;
+        parentLink.address = favorites[i].mid(0, 2);
+        const QByteArray childAddress = favorites[i].mid(2, 2);
+
+        /* Check if favorite is set */
+        if (parentLink.address == EMPTY_ADDRESS)
+        {
+            continue;
+        }
+
+        bool found = false;
+        const int parentIdx = parentLookup.find(parentLink);
+        if (parentIdx >= 0)
+        {
+            /* Look for the child in the chain of its parent, a loop can't be longer than the list */
+            Link childLink = credentials.parents[parentIdx].firstChild;
+            for (int steps = 0; !found && isSet(childLink) && steps <= credentials.children.size(); steps++)
+            {
+                const int childIdx = childLookup.find(childLink);
+                if (childIdx < 0)
+                {
+                    break;
+                }
+                const Node &child = credentials.children[childIdx];
+                found = child.address.isNull() ? child.virtualAddress == 0 : child.address == childAddress;
+                childLink = child.next;
+            }
+        }
+
+        if (!found)
+        {
+            Issue issue = makeIssue(CredentialGraph, BadFavorite, parentLink);
+            issue.favoriteIndex = i;
+            issues << issue;
+        }
+    }
+
+    return issues;
+}
+
+QString MPNodeGraphChecker::issueToString(const Issue &issue)
+{
+    QString graph;
+    switch (issue.graph)
+    {
+    case CredentialGraph: graph = "credential graph"; break;
+    case WebAuthnGraph: graph = "webauthn graph"; break;
+    default: graph = "data graph"; break;
+    }
+
+    QString type;
+    switch (issue.type)
+    {
+    case MissingParent: type = "missing parent node"; break;
+    case ParentLoop: type = "parent node loop at"; break;
+    case BadPreviousParent: type = "incorrect previous address for parent node"; break;
+    case MissingChild: type = "missing child node"; break;
+    case ChildLoop: type = "child node loop at"; break;
+    case BadPreviousChild: type = "incorrect previous address for child node"; break;
+    case OrphanParent: type = "orphan parent node"; break;
+    case OrphanChild: type = "orphan child node"; break;
+    default: type = QString("favorite %1 pointing to incorrect node").arg(issue.favoriteIndex); break;
+    }
+
+    const QString address = issue.link.address.isNull() ?
+                QString("virtual %1").arg(issue.link.virtualAddress) :
+                QString::fromLatin1(issue.link.address.toHex());
+    return QString("%1: %2 %3").arg(graph, type, address);
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef MPNODEGRAPHCHECKER_H
+#define MPNODEGRAPHCHECKER_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QVector>
+
+/* Read only consistency check of the loaded node graphs.
+ * The credential, WebAuthn and data graphs are copied into snapshots
+ * which are walked concurrently on a thread pool, following the same
+ * rules as MPDevice::tagPointedNodes(). Nothing is repaired here: the
+ * issues found make the repair plan, which MPDevice applies afterwards
+ * from its own thread.
+ */
+class MPNodeGraphChecker
+{
+public:
+    enum Graph
+    {
+        CredentialGraph = 0,
+        WebAuthnGraph,
+        DataGraph,
+        GraphCount
+    };
+
+    enum IssueType
+    {
+        MissingParent,
+        ParentLoop,
+        BadPreviousParent,
+        MissingChild,
+        ChildLoop,
+        BadPreviousChild,
+        OrphanParent,
+        OrphanChild,
+        BadFavorite
+    };
+
+    //Flash address, or virtual address when the address is null
+    struct Link
+    {
+        QByteArray address;
+        quint32 virtualAddress = 0;
+    };
+
+    struct Node
+    {
+        QByteArray address;
+        quint32 virtualAddress = 0;
+        Link next;
+        Link previous;
+        Link firstChild;        //parents only
+    };
+
+    struct GraphSnapshot
+    {
+        bool enabled = false;
+        bool reportOrphans = false;
+        bool checkPreviousChild = true;     //data children have no previous link
+        Link start;
+        QVector<Node> parents;
+        QVector<Node> children;
+    };
+
+    struct Issue
+    {
+        Graph graph;
+        IssueType type;
+        Link link;              //address of the node the issue is about
+        int favoriteIndex = -1;
+    };
+
+    typedef QVector<Issue> RepairPlan;
+
+    void setGraph(Graph graph, const GraphSnapshot &snapshot);
+    //Favorites are checked against the credential graph
+    void setFavorites(const QList<QByteArray> &favorites);
+
+    //Walk the graphs, concurrently when they are big enough
+    RepairPlan run() const;
+
+    static QVector<Issue> checkGraph(const GraphSnapshot &snapshot, Graph graph);
+    static QVector<Issue> checkFavorites(const GraphSnapshot &credentials, const QList<QByteArray> &favorites);
+    static QString issueToString(const Issue &issue);
+
+private:
+    GraphSnapshot m_graphs[GraphCount];
+    QList<QByteArray> m_favorites;
+};
+
+#endif // MPNODEGRAPHCHECKER_H
@@ -0,0 +1,135 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "MPNodeIndex.h"
+
+void MPNodeIndex::build(const QList<MPNode *> &list)
+{
+    clear();
+    m_byAddress.reserve(list.size());
+    for (MPNode *node: list)
+    {
+        insert(node);
+    }
+}
+
+void MPNodeIndex::insert(MPNode *node)
+{
+    /* Keep the first node for a given key, as a linear search would do */
+    const QByteArray address = node->getAddress();
+    if (address.isNull())
+    {
+        if (!m_byVirtualAddress.contains(node->getVirtualAddress()))
+        {
+            m_byVirtualAddress.insert(node->getVirtualAddress(), node);
+        }
+    }
+    else if (!m_byAddress.contains(address))
+    {
+        m_byAddress.insert(address, node);
+    }
+}
+
+void MPNodeIndex::remove(MPNode *node)
+{
+    const QByteArray address = node->getAddress();
+    if (address.isNull())
+    {
+        if (m_byVirtualAddress.value(node->getVirtualAddress()) == node)
+        {
+            m_byVirtualAddress.remove(node->getVirtualAddress());
+        }
+    }
+    else if (m_byAddress.value(address) == node)
+    {
+        m_byAddress.remove(address);
+    }
+}
+
+void MPNodeIndex::clear()
+{
+    m_byAddress.clear();
+    m_byVirtualAddress.clear();
+}
+
+MPNode *MPNodeIndex::find(const QByteArray &address, const quint32 virt_addr) const
+{
+    if (!address.isNull())
+    {
+        MPNode *node = m_byAddress.value(address, nullptr);
+        if (node)
+        {
+            return node;
+        }
+    }
+    return m_byVirtualAddress.value(virt_addr, nullptr);
+}
+
+bool MPChildLoginIndex::find(MPNode *parent, const QString &login, MPNode *&child)
+{
+    child = nullptr;
+    if (!m_logins.contains(parent) && !loadParent(parent))
+    {
+        return false;
+    }
+    child = m_logins[parent].value(login, nullptr);
+    return true;
+}
+
+void MPChildLoginIndex::insert(MPNode *parent, MPNode *child)
+{
+    if (!m_logins.contains(parent))
+    {
+        /* Chain will be walked on first lookup, child included */
+        return;
+    }
+    QHash<QString, MPNode *> &logins = m_logins[parent];
+    if (!logins.contains(child->getLogin()))
+    {
+        logins.insert(child->getLogin(), child);
+    }
+}
+
+bool MPChildLoginIndex::loadParent(MPNode *parent)
+{
+    QHash<QString, MPNode *> logins;
+    QByteArray childAddress = parent->getStartChildAddress();
+    quint32 childVirtualAddress = parent->getStartChildVirtualAddress();
+
+    /* browse through all the children */
+    while ((childAddress != MPNode::EmptyAddress) || (childAddress.isNull() && childVirtualAddress != 0))
+    {
+        MPNode *childNodePt = m_childIndex.find(childAddress, childVirtualAddress);
+        if (!childNodePt)
+        {
+            qWarning() << "MPChildLoginIndex: couldn't find child node with address" << childAddress.toHex() << "in our list";
+            return false;
+        }
+
+        if (!logins.contains(childNodePt->getLogin()))
+        {
+            logins.insert(childNodePt->getLogin(), childNodePt);
+        }
+
+        childAddress = childNodePt->getNextChildAddress();
+        childVirtualAddress = childNodePt->getNextChildVirtualAddress();
+    }
+
+    m_logins.insert(parent, logins);
+    return true;
+}
@@ -0,0 +1,73 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef MPNODEINDEX_H
+#define MPNODEINDEX_H
+
+#include <QHash>
+#include "MPNode.h"
+
+/* Hash index over a node list.
+ * Nodes with a real flash address are keyed by that address, nodes that
+ * were just created (null address) are keyed by their virtual address.
+ * Lookups follow the same rules as MPDevice::findNodeWithAddressInList
+ * but are O(1) instead of a linear scan of the list.
+ * The index doesn't own the nodes: callers must remove() a node before
+ * deleting it.
+ */
+class MPNodeIndex
+{
+public:
+    MPNodeIndex() = default;
+    explicit MPNodeIndex(const QList<MPNode *> &list) { build(list); }
+
+    void build(const QList<MPNode *> &list);
+    void insert(MPNode *node);
+    void remove(MPNode *node);
+    void clear();
+
+    MPNode *find(const QByteArray &address, const quint32 virt_addr = 0) const;
+
+private:
+    QHash<QByteArray, MPNode *> m_byAddress;
+    QHash<quint32, MPNode *> m_byVirtualAddress;
+};
+
+/* Index of the children of parent nodes, keyed by login name.
+ * Each parent chain is walked only once, the first time it is queried.
+ */
+class MPChildLoginIndex
+{
+public:
+    explicit MPChildLoginIndex(const MPNodeIndex &childIndex):
+        m_childIndex(childIndex)
+    {}
+
+    //Returns false if the child chain of parent is broken
+    bool find(MPNode *parent, const QString &login, MPNode *&child);
+    //Register a child that was just added to parent
+    void insert(MPNode *parent, MPNode *child);
+
+private:
+    bool loadParent(MPNode *parent);
+
+    const MPNodeIndex &m_childIndex;
+    QHash<MPNode *, QHash<QString, MPNode *>> m_logins;
+};
+
+#endif // MPNODEINDEX_H
@@ -0,0 +1,300 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "MPSaveJournal.h"
+#include "../SimpleCrypt/SimpleCrypt.h"
+
+#include <algorithm>
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QTextStream>
+
+static const int JOURNAL_VERSION = 1;
+
+void MPSaveJournal::setCardCPZ(const QByteArray &cardCPZ)
+{
+    if (m_cardCPZ == cardCPZ)
+    {
+        return;
+    }
+    m_cardCPZ = cardCPZ;
+
+    clear();
+    m_planPath.clear();
+    m_donePath.clear();
+    if (cardCPZ.isEmpty())
+    {
+        return;
+    }
+
+    QString fileName = QCryptographicHash::hash(cardCPZ, QCryptographicHash::Sha256).toHex();
+    fileName.truncate(30);
+
+    const QString dataPath = QStandardPaths::standardLocations(QStandardPaths::AppDataLocation).first();
+    QDir dataDir(dataPath);
+    dataDir.mkpath(dataPath);
+
+    m_planPath = dataDir.absoluteFilePath(QString("save_journal_%1").arg(fileName));
+    m_donePath = m_planPath + ".done";
+
+    m_key = 0;
+    for (int i = 0; i < std::min(8, cardCPZ.size()); i++)
+    {
+        m_key += (static_cast<quint64>(cardCPZ[i]) & 0xFF) << (i * 8);
+    }
+}
+
+void MPSaveJournal::begin(bool isBLE, quint32 credChangeBefore, quint32 dataChangeBefore,
+                          quint32 credChangeAfter, quint32 dataChangeAfter)
+{
+    clear();
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    m_recording = true;
+    m_isBLE = isBLE;
+    m_credChangeBefore = credChangeBefore;
+    m_dataChangeBefore = dataChangeBefore;
+    m_credChangeAfter = credChangeAfter;
+    m_dataChangeAfter = dataChangeAfter;
+}
+
+int MPSaveJournal::addNodeWrite(const QByteArray &address, const QByteArray &data)
+{
+    if (!m_recording)
+    {
+        return -1;
+    }
+
+    Entry entry;
+    entry.address = address;
+    entry.data = data;
+    m_entries.append(entry);
+    return m_entries.size() - 1;
+}
+
+int MPSaveJournal::addCommand(quint16 cmd, const QByteArray &data)
+{
+    if (!m_recording)
+    {
+        return -1;
+    }
+
+    Entry entry;
+    entry.cmd = cmd;
+    entry.data = data;
+    m_entries.append(entry);
+    return m_entries.size() - 1;
+}
+
+bool MPSaveJournal::commit()
+{
+    if (!m_recording)
+    {
+        return false;
+    }
+    m_recording = false;
+
+    QFile::remove(m_donePath);
+    if (!writePlan())
+    {
+        qWarning() << "Couldn't write save journal, save won't be resumable";
+        clear();
+        return false;
+    }
+    m_active = true;
+    return true;
+}
+
+void MPSaveJournal::abort()
+{
+    if (m_active)
+    {
+        QFile::remove(m_planPath);
+        QFile::remove(m_donePath);
+    }
+    clear();
+}
+
+void MPSaveJournal::markDone(int index)
+{
+    if (!m_active || index < 0)
+    {
+        return;
+    }
+
+    /* Writes are acknowledged in order, one line each */
+    QFile file(m_donePath);
+    if (!file.open(QIODevice::Append | QIODevice::Text))
+    {
+        qWarning() << "Couldn't log save progress to" << m_donePath;
+        return;
+    }
+    file.write(QByteArray::number(index) + '\n');
+    file.close();
+    m_nextEntry = index + 1;
+}
+
+void MPSaveJournal::finish()
+{
+    if (!m_active)
+    {
+        return;
+    }
+    QFile::remove(m_planPath);
+    QFile::remove(m_donePath);
+    clear();
+}
+
+bool MPSaveJournal::loadPending()
+{
+    clear();
+    if (!isEnabled() || !QFile::exists(m_planPath))
+    {
+        return false;
+    }
+
+    QFile file(m_planPath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        return false;
+    }
+
+    SimpleCrypt crypt(m_key);
+    crypt.setIntegrityProtectionMode(SimpleCrypt::ProtectionHash);
+    const QString rawJson = crypt.decryptToString(QString(file.readAll()));
+    const QJsonObject root = QJsonDocument::fromJson(rawJson.toUtf8()).object();
+    if (crypt.lastError() != SimpleCrypt::ErrorNoError || root["version"].toInt() != JOURNAL_VERSION)
+    {
+        qWarning() << "Unreadable save journal, removing it";
+        QFile::remove(m_planPath);
+        QFile::remove(m_donePath);
+        return false;
+    }
+
+    m_isBLE = root["ble"].toBool();
+    m_credChangeBefore = static_cast<quint32>(root["cred_change_before"].toDouble());
+    m_dataChangeBefore = static_cast<quint32>(root["data_change_before"].toDouble());
+    m_credChangeAfter = static_cast<quint32>(root["cred_change_after"].toDouble());
+    m_dataChangeAfter = static_cast<quint32>(root["data_change_after"].toDouble());
+    m_attempts = root["attempts"].toInt();
+    for (const QJsonValue &val : root["entries"].toArray())
+    {
+        const QJsonObject o = val.toObject();
+        Entry entry;
+        entry.cmd = static_cast<quint16>(o["cmd"].toInt());
+        entry.address = QByteArray::fromHex(o["address"].toString().toLatin1());
+        entry.data = QByteArray::fromBase64(o["data"].toString().toLatin1());
+        m_entries.append(entry);
+    }
+
+    /* Keep the highest index, a line cut by a crash is then harmless */
+    QFile done(m_donePath);
+    if (done.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        QTextStream in(&done);
+        while (!in.atEnd())
+        {
+            bool ok = false;
+            const int index = in.readLine().toInt(&ok);
+            if (ok && index + 1 > m_nextEntry)
+            {
+                m_nextEntry = std::min(index + 1, m_entries.size());
+            }
+        }
+    }
+
+    m_active = true;
+    return true;
+}
+
+int MPSaveJournal::newAttempt()
+{
+    if (!m_active)
+    {
+        return 0;
+    }
+    ++m_attempts;
+    writePlan();
+    return m_attempts;
+}
+
+bool MPSaveJournal::writePlan()
+{
+    QJsonArray entries;
+    for (const Entry &entry : m_entries)
+    {
+        QJsonObject o;
+        if (entry.isNodeWrite())
+        {
+            o["address"] = QString(entry.address.toHex());
+        }
+        else
+        {
+            o["cmd"] = entry.cmd;
+        }
+        o["data"] = QString(entry.data.toBase64());
+        entries.append(o);
+    }
+
+    QJsonObject root;
+    root["version"] = JOURNAL_VERSION;
+    root["ble"] = m_isBLE;
+    root["cred_change_before"] = static_cast<double>(m_credChangeBefore);
+    root["data_change_before"] = static_cast<double>(m_dataChangeBefore);
+    root["cred_change_after"] = static_cast<double>(m_credChangeAfter);
+    root["data_change_after"] = static_cast<double>(m_dataChangeAfter);
+    root["attempts"] = m_attempts;
+    root["entries"] = entries;
+
+    SimpleCrypt crypt(m_key);
+    crypt.setIntegrityProtectionMode(SimpleCrypt::ProtectionHash);
+
+    /* Never leave a truncated plan behind */
+    QSaveFile file(m_planPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        return false;
+    }
+    file.write(crypt.encryptToString(QJsonDocument(root).toJson(QJsonDocument::Compact)).toLatin1());
+    return file.commit();
+}
+
+void MPSaveJournal::clear()
+{
+    m_recording = false;
+    m_active = false;
+    m_isBLE = false;
+    m_credChangeBefore = 0;
+    m_dataChangeBefore = 0;
+    m_credChangeAfter = 0;
+    m_dataChangeAfter = 0;
+    m_attempts = 0;
+    m_nextEntry = 0;
+    m_entries.clear();
+}
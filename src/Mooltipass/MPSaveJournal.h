@@ -0,0 +1,102 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef MPSAVEJOURNAL_H
+#define MPSAVEJOURNAL_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+
+/* On disk journal of the writes sent by a MMM save.
+ * The planned writes are stored before the first one is sent, and every
+ * write acknowledged by the device is then logged, so a save interrupted
+ * by a disconnect can be resumed from the first write that didn't land
+ * instead of scanning and rewriting the whole database.
+ * The journal belongs to the card it was recorded for and is encrypted
+ * with a key derived from its CPZ, as the files cache.
+ */
+class MPSaveJournal
+{
+public:
+    struct Entry
+    {
+        quint16 cmd = 0;        //commands only
+        QByteArray address;     //node writes only
+        QByteArray data;
+
+        bool isNodeWrite() const { return !address.isEmpty(); }
+    };
+
+    //Journal file is selected by the card CPZ, no journaling without it
+    void setCardCPZ(const QByteArray &cardCPZ);
+    bool isEnabled() const { return !m_planPath.isEmpty(); }
+    //A committed journal is on disk, the save can be resumed
+    bool isActive() const { return m_active; }
+
+    //Recording of a new save, the returned index is passed to markDone()
+    void begin(bool isBLE, quint32 credChangeBefore, quint32 dataChangeBefore,
+               quint32 credChangeAfter, quint32 dataChangeAfter);
+    int addNodeWrite(const QByteArray &address, const QByteArray &data);
+    int addCommand(quint16 cmd, const QByteArray &data);
+    //Store the planned writes, they must not be sent before this
+    bool commit();
+    //Drop the save: what was recorded since begin(), or a committed journal
+    //whose writes the device refused, it must not be resumed
+    void abort();
+
+    void markDone(int index);
+    //All the writes landed, the journal is removed
+    void finish();
+
+    //Read a journal left by an interrupted save, false if there is none
+    bool loadPending();
+    //Count a resume attempt, returns the number of attempts so far
+    int newAttempt();
+
+    bool isBLE() const { return m_isBLE; }
+    quint32 credChangeBefore() const { return m_credChangeBefore; }
+    quint32 dataChangeBefore() const { return m_dataChangeBefore; }
+    quint32 credChangeAfter() const { return m_credChangeAfter; }
+    quint32 dataChangeAfter() const { return m_dataChangeAfter; }
+    const QVector<Entry> &entries() const { return m_entries; }
+    //First write which was not acknowledged by the device
+    int nextEntry() const { return m_nextEntry; }
+
+private:
+    bool writePlan();
+    void clear();
+
+    QByteArray m_cardCPZ;
+    QString m_planPath;
+    QString m_donePath;
+    quint64 m_key = 0;
+
+    bool m_recording = false;
+    bool m_active = false;
+    bool m_isBLE = false;
+    quint32 m_credChangeBefore = 0;
+    quint32 m_dataChangeBefore = 0;
+    quint32 m_credChangeAfter = 0;
+    quint32 m_dataChangeAfter = 0;
+    int m_attempts = 0;
+    int m_nextEntry = 0;
+    QVector<Entry> m_entries;
+};
+
+#endif // MPSAVEJOURNAL_H
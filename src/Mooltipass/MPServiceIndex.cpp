@@ -0,0 +1,95 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "MPServiceIndex.h"
+
+void MPServiceIndex::build(Kind kind, const QList<MPNode *> &parents, quint32 changeNumber)
+{
+    ServiceSet &set = m_sets[kind];
+    set.services.clear();
+    set.services.reserve(parents.size());
+    for (MPNode *node: parents)
+    {
+        set.services.insert(node->getService());
+    }
+    set.changeNumber = changeNumber;
+    set.valid = true;
+    set.acceptNextChange = false;
+    qDebug() << "Service index built with" << set.services.size() << (kind == DATA ? "data" : "credential") << "services";
+}
+
+void MPServiceIndex::invalidate()
+{
+    for (int i = 0; i < KIND_COUNT; ++i)
+    {
+        invalidate(static_cast<Kind>(i));
+    }
+}
+
+void MPServiceIndex::invalidate(Kind kind)
+{
+    ServiceSet &set = m_sets[kind];
+    set.services.clear();
+    set.valid = false;
+    set.acceptNextChange = false;
+}
+
+bool MPServiceIndex::isValid(Kind kind, quint32 changeNumber) const
+{
+    const ServiceSet &set = m_sets[kind];
+    return set.valid && !set.acceptNextChange && set.changeNumber == changeNumber;
+}
+
+bool MPServiceIndex::contains(Kind kind, const QString &service) const
+{
+    return m_sets[kind].services.contains(service);
+}
+
+QString MPServiceIndex::resolve(Kind kind, const QString &service, const QString &fallback) const
+{
+    if (contains(kind, service))
+    {
+        return service;
+    }
+    if (!fallback.isEmpty() && contains(kind, fallback))
+    {
+        return fallback;
+    }
+    return QString();
+}
+
+void MPServiceIndex::insert(Kind kind, const QString &service)
+{
+    ServiceSet &set = m_sets[kind];
+    if (!set.valid)
+    {
+        return;
+    }
+    set.services.insert(service);
+    set.acceptNextChange = true;
+}
+
+void MPServiceIndex::changeNumberUpdated(Kind kind, quint32 changeNumber)
+{
+    ServiceSet &set = m_sets[kind];
+    if (set.valid && set.acceptNextChange)
+    {
+        set.changeNumber = changeNumber;
+        set.acceptNextChange = false;
+    }
+}
@@ -0,0 +1,69 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef MPSERVICEINDEX_H
+#define MPSERVICEINDEX_H
+
+#include <QSet>
+#include <QString>
+#include "MPNode.h"
+
+/* Set of the service names stored on the device, one for credentials
+ * and one for data nodes. Each set is filled from the nodes read in MMM
+ * and is tied to the db change number the device reported at that time:
+ * as soon as the change number differs, the set is stale and the device
+ * has to be queried again.
+ */
+class MPServiceIndex
+{
+public:
+    enum Kind
+    {
+        CREDENTIALS = 0,
+        DATA,
+        KIND_COUNT
+    };
+
+    void build(Kind kind, const QList<MPNode *> &parents, quint32 changeNumber);
+    void invalidate();
+    void invalidate(Kind kind);
+
+    bool isValid(Kind kind, quint32 changeNumber) const;
+    bool contains(Kind kind, const QString &service) const;
+
+    //Service the device would select for service/fallback, empty if none
+    QString resolve(Kind kind, const QString &service, const QString &fallback) const;
+
+    //Register a service added by us, the next change number
+    //read from the device is then accepted for this set
+    void insert(Kind kind, const QString &service);
+    void changeNumberUpdated(Kind kind, quint32 changeNumber);
+
+private:
+    struct ServiceSet
+    {
+        QSet<QString> services;
+        quint32 changeNumber = 0;
+        bool valid = false;
+        bool acceptNextChange = false;
+    };
+
+    ServiceSet m_sets[KIND_COUNT];
+};
+
+#endif // MPSERVICEINDEX_H
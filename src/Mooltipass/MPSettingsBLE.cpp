@@ -9,14 +9,20 @@ MPSettingsBLE::MPSettingsBLE(MPDevice *parent, IMessageProtocol *mesProt)
       mpDevice{parent},
       pMesProt{mesProt}
 {
+    m_batcher = new MPSettingsBatcher(this);
 }
 
 void MPSettingsBLE::loadParameters()
 {
     m_readingParams = true;
+    //Serial number is known from the platform info
+    m_batcher->restore(mpDevice->get_serialNumber());
+
     AsyncJobs *jobs = new AsyncJobs(
                           "Loading device parameters",
                           this);
+    jobs->setPriority(AsyncJobs::PriorityBackground);
+    jobs->setInterruptible(true);
 
     jobs->append(new MPCommandJob(mpDevice,
                    MPCmd::GET_DEVICE_SETTINGS,
@@ -83,6 +89,19 @@ void MPSettingsBLE::loadParameters()
                     }
     ));
 
+    connect(jobs, &AsyncJobs::finished, [this](const QByteArray &)
+    {
+        m_readingParams = false;
+        qInfo() << "Finished loading device parameters";
+        m_batcher->store(mpDevice->get_serialNumber());
+    });
+
+    connect(jobs, &AsyncJobs::failed, [this](AsyncJob *)
+    {
+        m_readingParams = false;
+        qCritical() << "Loading device parameters failed";
+    });
+
     mpDevice->enqueueAndRunJob(jobs);
     return;
 }
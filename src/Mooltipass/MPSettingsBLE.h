@@ -2,6 +2,7 @@
 #define MPSETTINGSBLE_H
 
 #include "DeviceSettingsBLE.h"
+#include "MPSettingsBatcher.h"
 
 class MPDevice;
 class IMessageProtocol;
@@ -25,6 +26,7 @@ private:
 
     MPDevice* mpDevice = nullptr;
     IMessageProtocol* pMesProt = nullptr;
+    MPSettingsBatcher* m_batcher = nullptr;
 
     QByteArray m_lastDeviceSettings;
 };
@@ -0,0 +1,117 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "MPSettingsBatcher.h"
+#include "DeviceSettings.h"
+#include "SettingsCache.h"
+
+#include <QMetaProperty>
+
+MPSettingsBatcher::MPSettingsBatcher(DeviceSettings *settings):
+    QObject(settings),
+    m_settings(settings)
+{
+    m_writeTimer.setSingleShot(true);
+    m_writeTimer.setInterval(WRITE_DELAY_MS);
+    connect(&m_writeTimer, &QTimer::timeout, this, &MPSettingsBatcher::flushRequested);
+}
+
+bool MPSettingsBatcher::restore(quint32 serial)
+{
+    if (m_loadedFromDevice || 0 == serial)
+    {
+        return false;
+    }
+
+    const QVariantMap params = SettingsCache::instance()->value(cacheKey(serial)).toMap();
+    if (params.isEmpty())
+    {
+        return false;
+    }
+
+    qDebug() << "Using cached parameters of device" << serial;
+    for (auto it = params.constBegin(); it != params.constEnd(); ++it)
+    {
+        m_settings->setProperty(it.key(), it.value().toInt());
+    }
+    return true;
+}
+
+void MPSettingsBatcher::store(quint32 serial)
+{
+    m_loadedFromDevice = true;
+    if (0 == serial)
+    {
+        return;
+    }
+
+    QVariantMap params;
+    auto* metaObj = m_settings->getMetaObject();
+    while (nullptr != metaObj && QString{metaObj->className()} != "QObject")
+    {
+        for (int i = metaObj->propertyOffset(); i < metaObj->propertyCount(); ++i)
+        {
+            const QMetaProperty prop = metaObj->property(i);
+            params.insert(prop.name(), prop.read(m_settings).toInt());
+        }
+        metaObj = metaObj->superClass();
+    }
+
+    //Don't write the settings file again on every reload
+    if (SettingsCache::instance()->value(cacheKey(serial)).toMap() != params)
+    {
+        SettingsCache::instance()->setValue(cacheKey(serial), params);
+    }
+}
+
+void MPSettingsBatcher::queueWrite(MPParams::Param param, int val)
+{
+    bool queued = false;
+    for (auto &write: m_pendingWrites)
+    {
+        if (write.first == param)
+        {
+            write.second = val;
+            queued = true;
+            break;
+        }
+    }
+    if (!queued)
+    {
+        m_pendingWrites.append(qMakePair(param, val));
+    }
+
+    //Not restarted, a write is never delayed more than WRITE_DELAY_MS
+    if (!m_writeTimer.isActive())
+    {
+        m_writeTimer.start();
+    }
+}
+
+QVector<MPSettingsBatcher::ParamWrite> MPSettingsBatcher::takePendingWrites()
+{
+    m_writeTimer.stop();
+    QVector<ParamWrite> writes;
+    writes.swap(m_pendingWrites);
+    return writes;
+}
+
+QString MPSettingsBatcher::cacheKey(quint32 serial)
+{
+    return QStringLiteral("device_settings/%1").arg(serial);
+}
@@ -0,0 +1,71 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef MPSETTINGSBATCHER_H
+#define MPSETTINGSBATCHER_H
+
+#include <QObject>
+#include <QPair>
+#include <QTimer>
+#include <QVector>
+#include "MooltipassCmds.h"
+
+class DeviceSettings;
+
+/* Batching helper for the device parameters.
+ * The parameters read from a device are kept in the settings cache under
+ * its serial number, so on the next connection clients get them right
+ * away while the device is being read again.
+ * Parameter writes are queued and coalesced: a param_set touching several
+ * parameters, or a few param_set close to each other, end up in a single
+ * write burst with the last value of each parameter.
+ */
+class MPSettingsBatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    typedef QPair<MPParams::Param, int> ParamWrite;
+
+    explicit MPSettingsBatcher(DeviceSettings *settings);
+
+    //Apply the cached parameters, until the device was read once
+    bool restore(quint32 serial);
+    //Device parameters were read, keep them for the next connection
+    void store(quint32 serial);
+
+    void queueWrite(MPParams::Param param, int val);
+    bool hasPendingWrites() const { return !m_pendingWrites.isEmpty(); }
+    QVector<ParamWrite> takePendingWrites();
+
+signals:
+    //Pending writes have to be sent
+    void flushRequested();
+
+private:
+    static QString cacheKey(quint32 serial);
+
+    static constexpr int WRITE_DELAY_MS = 50;
+
+    DeviceSettings *m_settings = nullptr;
+    bool m_loadedFromDevice = false;
+    QVector<ParamWrite> m_pendingWrites;
+    QTimer m_writeTimer;
+};
+
+#endif // MPSETTINGSBATCHER_H
@@ -8,18 +8,36 @@ MPSettingsMini::MPSettingsMini(MPDevice *parent, IMessageProtocol *mesProt)
       mpDevice{parent},
       pMesProt{mesProt}
 {
+    m_batcher = new MPSettingsBatcher(this);
+    connect(m_batcher, &MPSettingsBatcher::flushRequested, this, &MPSettingsMini::writePendingParams);
 }
 
 void MPSettingsMini::loadParameters()
+{
+    if (m_batcher->hasPendingWrites())
+    {
+        //Parameters are read back once the write burst is sent
+        m_readingParams = true;
+        m_reloadAfterWrites = true;
+        return;
+    }
+    readParameters();
+}
+
+void MPSettingsMini::readParameters()
 {
     m_readingParams = true;
     AsyncJobs *jobs = new AsyncJobs(
                           "Loading device parameters",
                           this);
+    //Parameters are read one by one, let credential requests
+    //go through between two reads
+    jobs->setPriority(AsyncJobs::PriorityBackground);
+    jobs->setInterruptible(true);
 
     jobs->append(new MPCommandJob(mpDevice,
                                   MPCmd::VERSION,
-                                  [this](const QByteArray &data, bool &) -> bool
+                                  [this, jobs](const QByteArray &data, bool &) -> bool
     {
         const auto flashSize = pMesProt->getFirstPayloadByte(data);
         qDebug() << "received MP version FLASH size: " << flashSize << "Mb";
@@ -41,6 +59,22 @@ void MPSettingsMini::loadParameters()
             }
         }
 
+        if (mpDevice->isFw12() && mpDevice->isMini())
+        {
+            //Serial number first, so the cached parameters of this
+            //device are sent to the clients while reading them
+            jobs->prepend(new MPCommandJob(mpDevice,
+                                           MPCmd::GET_SERIAL,
+                                           [this](const QByteArray &data, bool &) -> bool
+            {
+                const auto serialNumber = pMesProt->getSerialNumber(data);
+                mpDevice->set_serialNumber(serialNumber);
+                qDebug() << "Mooltipass Mini serial number:" << serialNumber;
+                m_batcher->restore(serialNumber);
+                return true;
+            }));
+        }
+
         return true;
     }));
 
@@ -286,42 +320,8 @@ void MPSettingsMini::loadParameters()
         //data is last result
         //all jobs finished success
         qInfo() << "Finished loading device options";
-
-        if (mpDevice->isFw12() && mpDevice->isMini())
-        {
-            qInfo() << "Mini firmware above v1.2, requesting serial number";
-
-            AsyncJobs* v12jobs = new AsyncJobs("Loading device serial number", this);
-
-            /* Query serial number */
-            v12jobs->append(new MPCommandJob(mpDevice,
-                                          MPCmd::GET_SERIAL,
-                                          [this](const QByteArray &data, bool &) -> bool
-            {
-                const auto serialNumber = pMesProt->getSerialNumber(data);
-                mpDevice->set_serialNumber(serialNumber);
-                qDebug() << "Mooltipass Mini serial number:" << serialNumber;
-                return true;
-            }));
-
-            connect(v12jobs, &AsyncJobs::finished, [this](const QByteArray &data)
-            {
-                Q_UNUSED(data);
-                //data is last result
-                //all jobs finished success
-                m_readingParams = false;
-                qInfo() << "Finished loading Mini serial number";
-            });
-
-            connect(v12jobs, &AsyncJobs::failed, [this](AsyncJob *failedJob)
-            {
-                Q_UNUSED(failedJob);
-                qCritical() << "Loading Mini serial number failed";
-                m_readingParams = false;
-                loadParameters(); // memory: does it get "piled on?"
-            });
-            mpDevice->enqueueAndRunJob(v12jobs);
-        }
+        m_readingParams = false;
+        m_batcher->store(mpDevice->get_serialNumber());
     });
 
     connect(jobs, &AsyncJobs::failed, [this](AsyncJob *failedJob)
@@ -347,24 +347,53 @@ void MPSettingsMini::updateParam(MPParams::Param param, int val)
     }
 
     QMetaEnum m = QMetaEnum::fromType<MPParams::Param>();
-    QString logInf = QStringLiteral("Updating %1 param: %2").arg(m.valueToKey(param)).arg(val);
+    qDebug() << QStringLiteral("Queueing %1 param update: %2").arg(m.valueToKey(param)).arg(val);
+    m_batcher->queueWrite(param, val);
+}
+
+void MPSettingsMini::writePendingParams()
+{
+    const auto writes = m_batcher->takePendingWrites();
+    if (!writes.isEmpty())
+    {
+        AsyncJobs *jobs = new AsyncJobs(QStringLiteral("Updating %1 device parameters").arg(writes.size()), this);
 
-    AsyncJobs *jobs = new AsyncJobs(logInf, this);
+        for (const auto &write: writes)
+        {
+            const MPParams::Param param = write.first;
+            QByteArray ba;
+            ba.append(static_cast<quint8>(param));
+            ba.append(static_cast<quint8>(write.second));
+
+            //A refused parameter doesn't stop the others from being written
+            jobs->append(new MPCommandJob(mpDevice,
+                                          MPCmd::SET_MOOLTIPASS_PARM,
+                                          ba,
+                                          [this, param](const QByteArray &data, bool &) -> bool
+            {
+                if (0x01 == pMesProt->getFirstPayloadByte(data))
+                {
+                    qInfo() << param << " param updated with success";
+                }
+                else
+                {
+                    qWarning() << "Failed to change " << param;
+                }
+                return true;
+            }));
+        }
 
-    QByteArray ba;
-    ba.append(static_cast<quint8>(param));
-    ba.append(static_cast<quint8>(val));
+        connect(jobs, &AsyncJobs::failed, [](AsyncJob *)
+        {
+            qWarning() << "Failed to send the device parameters";
+        });
 
-    jobs->append(new MPCommandJob(mpDevice, MPCmd::SET_MOOLTIPASS_PARM, ba, pMesProt->getDefaultFuncDone()));
+        mpDevice->enqueueAndRunJob(jobs);
+    }
 
-    connect(jobs, &AsyncJobs::finished, [param](const QByteArray &)
+    if (m_reloadAfterWrites)
     {
-        qInfo() << param << " param updated with success";
-    });
-    connect(jobs, &AsyncJobs::failed, [param](AsyncJob *)
-    {
-        qWarning() << "Failed to change " << param;
-    });
-
-    mpDevice->enqueueAndRunJob(jobs);
+        m_reloadAfterWrites = false;
+        readParameters();
+    }
 }
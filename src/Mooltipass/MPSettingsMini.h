@@ -2,6 +2,7 @@
 #define MPSETTINGSMINI_H
 
 #include "DeviceSettingsMini.h"
+#include "MPSettingsBatcher.h"
 
 class MPDevice;
 class IMessageProtocol;
@@ -17,9 +18,18 @@ public:
     void loadParameters() override;
     void updateParam(MPParams::Param param, int val) override;
 
+private slots:
+    void writePendingParams();
+
 private:
+    void readParameters();
+
     MPDevice* mpDevice = nullptr;
     IMessageProtocol* pMesProt = nullptr;
+
+    MPSettingsBatcher* m_batcher = nullptr;
+    //param_set reload waiting for the pending writes
+    bool m_reloadAfterWrites = false;
 };
 
 #endif // MPSETTINGSMINI_H
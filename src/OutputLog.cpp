@@ -25,11 +25,13 @@ OutputLog::OutputLog(QWidget *parent):
     setMouseTracking(true);
     setUndoRedoEnabled(false);
 
-    m_scrollTimer.setInterval(10);
-    m_scrollTimer.setSingleShot(true);
-    connect(&m_scrollTimer, &QTimer::timeout,
-            this, &OutputLog::scrollToBottom);
-    m_lastMessage.start();
+    m_flushTimer.setInterval(FLUSH_INTERVAL_MS);
+    m_flushTimer.setSingleShot(true);
+    connect(&m_flushTimer, &QTimer::timeout,
+            this, &OutputLog::flushPending);
+
+    m_pending.setCapacity(m_maxLineCount);
+    setMaximumBlockCount(m_maxLineCount);
 
     cursor = textCursor();
 
@@ -72,6 +74,7 @@ void OutputLog::keyPressEvent(QKeyEvent *ev)
 void OutputLog::showEvent(QShowEvent *e)
 {
     QPlainTextEdit::showEvent(e);
+    flushPending();
     if (m_scrollToBottom)
         verticalScrollBar()->setValue(verticalScrollBar()->maximum());
     m_scrollToBottom = false;
@@ -99,6 +102,7 @@ QString OutputLog::doNewlineEnforcement(const QString &out)
 void OutputLog::setMaxLineCount(int count)
 {
     m_maxLineCount = count;
+    m_pending.setCapacity(m_maxLineCount);
     setMaximumBlockCount(m_maxLineCount);
 }
 
@@ -107,16 +111,70 @@ int OutputLog::maxLineCount() const
     return m_maxLineCount;
 }
 
+bool OutputLog::setSpillFile(const QString &fileName)
+{
+    m_spillFile.close();
+    if (fileName.isEmpty())
+        return true;
+
+    m_spillFile.setFileName(fileName);
+    if (!m_spillFile.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+    {
+        qWarning() << "Failed to open log spill file" << fileName << ":" << m_spillFile.errorString();
+        return false;
+    }
+    return true;
+}
+
+QString OutputLog::spillFile() const
+{
+    return m_spillFile.isOpen() ? m_spillFile.fileName() : QString();
+}
+
 void OutputLog::appendMessage(const QString &output, const QTextCharFormat &format)
 {
-    const QString out = normalizeNewlines(output);
-    setMaximumBlockCount(m_maxLineCount);
-    const bool atBottom = isScrollbarAtBottom() || m_scrollTimer.isActive();
+    if (m_spillFile.isOpen())
+        m_spillFile.write(output.toUtf8());
+
+    m_pending.append(Utils::FormattedText(output, format));
+
+    if (!m_flushTimer.isActive())
+        m_flushTimer.start();
+}
+
+void OutputLog::flushPending()
+{
+    m_flushTimer.stop();
+
+    if (m_spillFile.isOpen())
+        m_spillFile.flush();
+
+    //Nothing to lay out while hidden, the ring buffer keeps the last messages
+    if (m_pending.isEmpty() || !isVisible())
+        return;
+
+    const bool atBottom = isScrollbarAtBottom();
 
     if (!cursor.atEnd())
         cursor.movePosition(QTextCursor::End);
 
-    foreach (const Utils::FormattedText &output, parseAnsi(doNewlineEnforcement(out), format))
+    cursor.beginEditBlock();
+    while (!m_pending.isEmpty())
+    {
+        const Utils::FormattedText message = m_pending.takeFirst();
+        insertMessage(message.text, message.format);
+    }
+    cursor.endEditBlock();
+
+    if (atBottom)
+        scrollToBottom();
+}
+
+void OutputLog::insertMessage(const QString &output, const QTextCharFormat &format)
+{
+    const QString out = doNewlineEnforcement(normalizeNewlines(output));
+
+    foreach (const Utils::FormattedText &output, parseAnsi(out, format))
     {
         int startPos = 0;
         int crPos = -1;
@@ -129,21 +187,6 @@ void OutputLog::appendMessage(const QString &output, const QTextCharFormat &form
         if (startPos < output.text.count())
             append(cursor, output.text.mid(startPos), output.format);
     }
-
-    if (atBottom)
-    {
-        if (m_lastMessage.elapsed() < 5)
-        {
-            m_scrollTimer.start();
-        }
-        else
-        {
-            m_scrollTimer.stop();
-            scrollToBottom();
-        }
-    }
-
-    m_lastMessage.start();
 }
 
 void OutputLog::append(QTextCursor &cursor, const QString &text, const QTextCharFormat &format)
@@ -165,6 +208,7 @@ bool OutputLog::isScrollbarAtBottom() const
 void OutputLog::clear()
 {
     m_enforceNewline = false;
+    m_pending.clear();
     QPlainTextEdit::clear();
 }
 
@@ -194,5 +238,9 @@ QString OutputLog::normalizeNewlines(const QString &text)
 
 QList<Utils::FormattedText> OutputLog::parseAnsi(const QString &text, const QTextCharFormat &format)
 {
+    //Most log lines carry no escape code, no need to run them through the parser
+    if (escapeCodeHandler.isIdle() && !text.contains(QLatin1Char('\x1b')))
+        return QList<Utils::FormattedText>() << Utils::FormattedText(text, format);
+
     return escapeCodeHandler.parseText(Utils::FormattedText(text, format));
 }
@@ -39,6 +39,10 @@ public:
     void setMaxLineCount(int count);
     int maxLineCount() const;
 
+    //Also write every message to fileName, lines dropped from the view are kept there
+    bool setSpillFile(const QString &fileName);
+    QString spillFile() const;
+
 public slots:
     void setWordWrapEnabled(bool wrap);
 
@@ -50,14 +54,20 @@ protected:
 
 private slots:
     void scrollToBottom();
+    void flushPending();
 
 private:
-    QTimer m_scrollTimer;
-    QTime m_lastMessage;
+    //Pending messages are rendered at most once per frame
+    static const int FLUSH_INTERVAL_MS = 16;
+
+    QTimer m_flushTimer;
+    //Ring buffer of the messages not rendered yet, the oldest are dropped when full
+    QContiguousCache<Utils::FormattedText> m_pending;
+    QFile m_spillFile;
 
     bool m_enforceNewline = false;
     bool m_scrollToBottom = false;
-    int m_maxLineCount = 100000;
+    int m_maxLineCount = 20000;
     QTextCursor cursor;
     bool overwriteOutput = false;
     Utils::AnsiEscapeCodeHandler escapeCodeHandler;
@@ -66,6 +76,7 @@ private:
 
     QString normalizeNewlines(const QString &text);
     void append(QTextCursor &cursor, const QString &text, const QTextCharFormat &format);
+    void insertMessage(const QString &out, const QTextCharFormat &format);
 
     QList<Utils::FormattedText> parseAnsi(const QString &text, const QTextCharFormat &format);
 };
@@ -1,4 +1,5 @@
 #include "ParseDomain.h"
+#include "PublicSuffixList.h"
 
 
 ParseDomain::ParseDomain(const QString &url) :
@@ -12,52 +13,52 @@ ParseDomain::ParseDomain(const QString &url) :
 
     // remove possible www
     QString host = _url.host();
-    if (host.startsWith("www."))
+    if (host.startsWith("www.")) {
         host = host.mid(4); // = remove first 4 chars
-    _url.setHost(host);
-
-    QStringList domainParts = _url.host().split('.');
-
-    Q_ASSERT(! domainParts.isEmpty()); // XXX, can't be a valid URL in this case (QUrl::isValid() returned true already)
+        _url.setHost(host);
+    }
 
-    if (domainParts.size() == 1) {
-        _domain = _url.host(); // ex.:  http://mycomputer/test-website
+    const int lastDot = host.lastIndexOf('.');
+    if (lastDot < 0) {
+        _domain = host; // ex.:  http://mycomputer/test-website
         return;
     }
 
-    _tld = _url.topLevelDomain();
+    const int suffixLabels = PublicSuffixList::suffixLabelCount(host);
 
     // domain suffix is NOT recognized as one of public suffix list
-    if (_tld.isEmpty()) {
-        _tld = domainParts.takeLast();
-        _domain = domainParts.takeLast();
-        if (! domainParts.isEmpty())
-            _subdomain = domainParts.join('.');
+    if (suffixLabels == 0) {
+        _tld = host.mid(lastDot + 1);
+        const int domainDot = lastDot > 0 ? host.lastIndexOf('.', lastDot - 1) : -1;
+        _domain = host.mid(domainDot + 1, lastDot - domainDot - 1);
+        if (domainDot > 0)
+            _subdomain = host.left(domainDot);
         return;
     }
 
-    // TLD is recognized as one of public suffix list
-    int tld_dots = _tld.count('.');  // number of dot sections in TLD (may be more than 1)
-
-    // drop TLD from domain parts
-    for (int i = 0 ; i < tld_dots ; i++) {
-        domainParts.removeLast();
-    }
+    // TLD is recognized as one of public suffix list, find the dot before it
+    // (TLD may have more than 1 dot section)
+    int tldStart = host.size();
+    for (int i = 0; i < suffixLabels && tldStart >= 0; i++)
+        tldStart = tldStart > 0 ? host.lastIndexOf('.', tldStart - 1) : -1;
 
     // URL contains only TLD, invalid site
-    if (domainParts.isEmpty()) {
+    if (tldStart < 0) {
+        _tld = '.' + host;
         return;
     }
 
     // this URL has valid TLD and has domain part, can be a valid website URL
     _isWebsite = true;
-    _domain = domainParts.takeLast();
+    _tld = host.mid(tldStart);
+
+    const int domainDot = tldStart > 0 ? host.lastIndexOf('.', tldStart - 1) : -1;
+    _domain = host.mid(domainDot + 1, tldStart - domainDot - 1);
 
     // other parts is considered as subdomains
     // FIXME: no protection from super-cookies here, like  123523497098sdkfjsf.order.amazon.com
-    if (! domainParts.isEmpty()) {
-        _subdomain = domainParts.join('.');
-    }
+    if (domainDot > 0)
+        _subdomain = host.left(domainDot);
 }
 
 QString ParseDomain::getManuallyEnteredDomainName(const QString &service)
@@ -28,7 +28,7 @@
 #include <QComboBox>
 #include <array>
 #include "QtAwesome.h"
-#include "zxcvbn.h"
+#include "PasswordStrengthEvaluator.h"
 #include <QDebug>
 
 #include "PasswordProfilesModel.h"
@@ -142,6 +142,10 @@ PasswordOptionsPopup::PasswordOptionsPopup(QWidget* parent):
     std::seed_seq seed(iseed.begin(), iseed.end());
     m_random_generator.seed(seed);
 
+    m_strengthEvaluator = new PasswordStrengthEvaluator(this);
+    connect(m_strengthEvaluator, &PasswordStrengthEvaluator::entropyReady,
+            this, &PasswordOptionsPopup::updatePasswordStrength);
+
     setFrameShadow(QFrame::Plain);
     setFrameShape(QFrame::Panel);
 
@@ -360,7 +364,11 @@ void PasswordOptionsPopup::generatePassword()
     //Done
     m_passwordLabel->setText(result);
 
-    double entropy = ZxcvbnMatch(result, 0, 0);
+    m_strengthEvaluator->evaluate(result);
+}
+
+void PasswordOptionsPopup::updatePasswordStrength(double entropy)
+{
     m_entropy->setText(tr("Entropy: %1 bit").arg(QString::number(entropy, 'f', 2)));
     if (entropy > m_strengthBar->maximum())
         entropy = m_strengthBar->maximum();
@@ -30,6 +30,7 @@ class QProgressBar;
 class QComboBox;
 class PasswordProfilesModel;
 class PasswordProfile;
+class PasswordStrengthEvaluator;
 
 
 
@@ -49,6 +50,7 @@ private Q_SLOTS:
     void generatePassword();
     std::vector<char> generateCustomPasswordPool();
     void updatePasswordLength(int);
+    void updatePasswordStrength(double entropy);
     void emitPassword();
     void onPasswordProfileChanged(int index);
 
@@ -64,6 +66,7 @@ private:
     QLabel *m_quality, *m_entropy;
     QComboBox *m_passwordProfileCMB;
     QWidget *m_customPasswordControls;
+    PasswordStrengthEvaluator *m_strengthEvaluator;
 
     std::mt19937 m_random_generator;
 };
@@ -0,0 +1,83 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "PasswordStrengthEvaluator.h"
+#include "zxcvbn.h"
+
+PasswordStrengthEvaluator::PasswordStrengthEvaluator(QObject *parent):
+    QThread(parent)
+{
+}
+
+PasswordStrengthEvaluator::~PasswordStrengthEvaluator()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_stopping = true;
+        m_cond.wakeOne();
+    }
+    wait();
+}
+
+void PasswordStrengthEvaluator::evaluate(const QByteArray &password)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_pendingPassword = password;
+        m_pendingId = ++m_latestId;
+        m_cond.wakeOne();
+    }
+
+    if (!isRunning())
+        start(QThread::LowPriority);
+}
+
+double PasswordStrengthEvaluator::computeEntropy(const QByteArray &password)
+{
+    //zxcvbn dictionaries are built in, ZxcvbnMatch doesn't use any global state
+    return ZxcvbnMatch(password.constData(), nullptr, nullptr);
+}
+
+void PasswordStrengthEvaluator::run()
+{
+    QMutexLocker locker(&m_mutex);
+    while (!m_stopping)
+    {
+        if (m_pendingId == 0)
+        {
+            m_cond.wait(&m_mutex);
+            continue;
+        }
+
+        const QByteArray password = m_pendingPassword;
+        const quint64 id = m_pendingId;
+        m_pendingPassword.clear();
+        m_pendingId = 0;
+
+        locker.unlock();
+        const double entropy = computeEntropy(password);
+        locker.relock();
+
+        if (id == m_latestId && !m_stopping)
+        {
+            locker.unlock();
+            emit entropyReady(entropy);
+            locker.relock();
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef PASSWORDSTRENGTHEVALUATOR_H
+#define PASSWORDSTRENGTHEVALUATOR_H
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+/* Runs the zxcvbn entropy estimation of passwords on a worker thread.
+ * Only the latest request matters: a request still waiting replaces the
+ * previous one, and the result of a request which became stale while it
+ * was computed is not emitted.
+ */
+class PasswordStrengthEvaluator: public QThread
+{
+    Q_OBJECT
+
+public:
+    explicit PasswordStrengthEvaluator(QObject *parent = nullptr);
+    ~PasswordStrengthEvaluator();
+
+    //Queue an evaluation, entropyReady() is emitted if no newer request comes in
+    void evaluate(const QByteArray &password);
+
+    static double computeEntropy(const QByteArray &password);
+
+signals:
+    void entropyReady(double entropy);
+
+protected:
+    void run() override;
+
+private:
+    QMutex m_mutex;
+    QWaitCondition m_cond;
+    QByteArray m_pendingPassword;
+    quint64 m_pendingId = 0;
+    quint64 m_latestId = 0;
+    bool m_stopping = false;
+};
+
+#endif // PASSWORDSTRENGTHEVALUATOR_H
@@ -0,0 +1,98 @@
+#include "PublicSuffixList.h"
+#include "publicsuffix/psl-data.h"
+
+#include <cstring>
+
+namespace
+{
+const PslNode *findChild(const PslNode *node, const char *label, int length)
+{
+    int low = node->firstChild;
+    int high = node->firstChild + node->childCount;
+    while (low < high)
+    {
+        const int mid = low + (high - low) / 2;
+        const PslNode &child = PslNodes[mid];
+        int cmp = std::memcmp(PslLabels + child.labelOffset, label, qMin<int>(child.labelLength, length));
+        if (cmp == 0)
+            cmp = child.labelLength - length;
+
+        if (cmp == 0)
+            return &child;
+        if (cmp < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return nullptr;
+}
+
+//Hostnames are at most 253 chars, longer ones take the slow path
+const int MAX_STACK_HOST = 256;
+}
+
+int PublicSuffixList::suffixLabelCount(const char *host, int length)
+{
+    const PslNode *node = &PslNodes[0];
+    int labels = 0;
+    int best = 0;
+    int end = length;
+
+    while (end > 0)
+    {
+        int start = end;
+        while (start > 0 && host[start - 1] != '.')
+            start--;
+        if (start == end)
+            break; //empty label
+
+        labels++;
+        const PslNode *child = findChild(node, host + start, end - start);
+
+        //"!label.parent": the parent rule is the public suffix
+        if (child && (child->flags & PSL_EXCEPTION))
+            return labels - 1;
+
+        if ((child && (child->flags & PSL_TERMINAL)) || (node->flags & PSL_WILDCARD))
+            best = labels;
+
+        if (!child)
+            break;
+        node = child;
+        end = start - 1;
+    }
+
+    return best;
+}
+
+int PublicSuffixList::suffixLabelCount(const QString &host)
+{
+    const int length = host.size();
+    if (length <= MAX_STACK_HOST)
+    {
+        char ascii[MAX_STACK_HOST];
+        const QChar *data = host.constData();
+        int i = 0;
+        for (; i < length && data[i].unicode() < 0x80; i++)
+            ascii[i] = static_cast<char>(data[i].unicode());
+
+        if (i == length)
+            return suffixLabelCount(ascii, length);
+    }
+
+    //Internationalized or very long host
+    const QByteArray utf8 = host.toUtf8();
+    return suffixLabelCount(utf8.constData(), utf8.size());
+}
+
+QString PublicSuffixList::publicSuffix(const QString &host)
+{
+    int labels = suffixLabelCount(host);
+    if (labels == 0)
+        return QString();
+
+    int start = host.size();
+    while (labels-- > 0 && start > 0)
+        start = host.lastIndexOf('.', start - 1);
+    return start < 0 ? host : host.mid(start + 1);
+}
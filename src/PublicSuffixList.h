@@ -0,0 +1,25 @@
+#ifndef PUBLICSUFFIXLIST_H
+#define PUBLICSUFFIXLIST_H
+
+#include <QString>
+
+/* Public suffix lookup over the list embedded in publicsuffix/psl-data.h.
+ * The list is compiled into a trie of labels read from right to left, so
+ * a host is matched one label at a time without any allocation.
+ * Only explicit rules are matched: unlike the "*" default rule of the
+ * specification, an unknown TLD is not a public suffix.
+ * To update the list, see publicsuffix/psl-generate.cpp.
+ */
+class PublicSuffixList
+{
+public:
+    //! Number of labels of the longest public suffix ending host, 0 if none.
+    //! host is UTF-8 (or ACE), lower case, without trailing dot.
+    static int suffixLabelCount(const char *host, int length);
+    static int suffixLabelCount(const QString &host);
+
+    //! Public suffix of host ("co.uk" for "www.foo.co.uk"), empty if none
+    static QString publicSuffix(const QString &host);
+};
+
+#endif // PUBLICSUFFIXLIST_H
@@ -0,0 +1,132 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef REQUESTCOALESCER_H
+#define REQUESTCOALESCER_H
+
+#include <functional>
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QElapsedTimer>
+
+/* Shares one device request between all the callers asking the same thing
+ * while it is in flight, and optionally keeps its result for a short time.
+ *
+ * Usage:
+ *   if (!coalescer.join(key, cb))
+ *       return;      //result will be delivered to cb
+ *   ...send the request, and when it completes:
+ *   coalescer.finish(key, cacheable, args...);
+ *
+ * Only idempotent requests should go through this class.
+ */
+template<typename... Args>
+class RequestCoalescer
+{
+public:
+    using Callback = std::function<void(Args...)>;
+
+    explicit RequestCoalescer(int ttlMs = 0):
+        m_ttlMs(ttlMs)
+    {}
+
+    //Returns true if the caller has to run the request and call finish()
+    bool join(const QString &key, const Callback &cb)
+    {
+        auto cached = m_cache.find(key);
+        if (cached != m_cache.end())
+        {
+            if (cached->timer.isValid() && !cached->timer.hasExpired(m_ttlMs))
+            {
+                cached->replay(cb);
+                return false;
+            }
+            m_cache.erase(cached);
+        }
+
+        auto waiting = m_waiters.find(key);
+        if (waiting != m_waiters.end())
+        {
+            waiting->append(cb);
+            return false;
+        }
+
+        m_waiters.insert(key, QList<Callback>{cb});
+        return true;
+    }
+
+    //Deliver the result to every caller waiting on key
+    void finish(const QString &key, bool cacheable, Args... args)
+    {
+        const QList<Callback> callbacks = m_waiters.take(key);
+        const bool stale = m_stale.remove(key);
+
+        if (cacheable && !stale && m_ttlMs > 0)
+        {
+            CachedResult res;
+            res.replay = [args...](const Callback &cb) { cb(args...); };
+            res.timer.start();
+            m_cache.insert(key, res);
+        }
+
+        //Callbacks may start new requests for the same key,
+        //the waiter list was already taken out for that reason
+        for (const Callback &cb: callbacks)
+        {
+            cb(args...);
+        }
+    }
+
+    //Drop cached results, in flight requests will not be cached
+    void invalidate()
+    {
+        m_cache.clear();
+        for (auto it = m_waiters.constBegin(); it != m_waiters.constEnd(); ++it)
+        {
+            m_stale.insert(it.key());
+        }
+    }
+
+    void invalidate(const QString &key)
+    {
+        m_cache.remove(key);
+        if (m_waiters.contains(key))
+        {
+            m_stale.insert(key);
+        }
+    }
+
+    bool isPending(const QString &key) const { return m_waiters.contains(key); }
+    int pendingCount() const { return m_waiters.size(); }
+
+private:
+    struct CachedResult
+    {
+        std::function<void(const Callback &)> replay;
+        QElapsedTimer timer;
+    };
+
+    int m_ttlMs;
+    QHash<QString, QList<Callback>> m_waiters;
+    QHash<QString, CachedResult> m_cache;
+    QSet<QString> m_stale;
+};
+
+#endif // REQUESTCOALESCER_H
@@ -2,9 +2,10 @@
 #include "RootItem.h"
 #include "ServiceItem.h"
 
-RootItem::RootItem()
+RootItem::RootItem() :
+    TreeItem("ROOT", QDate::currentDate(), QDate::currentDate(), "", Root),
+    m_serviceIndex(Qt::CaseInsensitive)
 {
-    m_sName = "ROOT";
 }
 
 RootItem::~RootItem()
@@ -20,13 +21,7 @@ ServiceItem *RootItem::addService(const QString &sServiceName)
 
 ServiceItem *RootItem::findServiceByName(const QString &sServiceName)
 {
-    foreach (TreeItem *pItem, m_vChilds)
-    {
-        ServiceItem *pServiceItem = dynamic_cast<ServiceItem *>(pItem);
-        if ((pServiceItem != nullptr) && (pServiceItem->name().compare(sServiceName, Qt::CaseInsensitive) == 0))
-            return pServiceItem;
-    }
-    return nullptr;
+    return static_cast<ServiceItem *>(m_serviceIndex.find(sServiceName));
 }
 
 void RootItem::setItemsStatus(const Status &eStatus)
@@ -60,7 +55,18 @@ void RootItem::removeUnusedItems()
     }
 }
 
-TreeItem::TreeType RootItem::treeType() const
+void RootItem::childAdded(TreeItem *pItem)
+{
+    if (pItem->treeType() == Service)
+        m_serviceIndex.insert(pItem);
+}
+
+void RootItem::childRemoved(TreeItem *pItem, const QString &sName)
+{
+    m_serviceIndex.remove(pItem, sName, m_vChilds);
+}
+
+void RootItem::childsCleared()
 {
-    return Root;
+    m_serviceIndex.clear();
 }
@@ -8,6 +8,8 @@ class ServiceItem;
 class RootItem : public TreeItem
 {
 public:
+    static constexpr TreeType Kind = Root;
+
     RootItem();
     virtual ~RootItem();
 
@@ -16,7 +18,15 @@ public:
     void setItemsStatus(const Status &eStatus);
     void removeUnusedItems();
 
-    virtual TreeType treeType()  const Q_DECL_OVERRIDE;
+
+protected:
+    virtual void childAdded(TreeItem *pItem) Q_DECL_OVERRIDE;
+    virtual void childRemoved(TreeItem *pItem, const QString &sName) Q_DECL_OVERRIDE;
+    virtual void childsCleared() Q_DECL_OVERRIDE;
+
+private:
+    // Services by case folded name
+    TreeItemNameIndex m_serviceIndex;
 };
 
 #endif // ROOTITEM_H
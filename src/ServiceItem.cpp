@@ -3,8 +3,10 @@
 #include "LoginItem.h"
 
 ServiceItem::ServiceItem(const QString &sServiceName):
-    TreeItem(sServiceName),
-    m_bIsExpanded(false)
+    TreeItem(sServiceName, QDate::currentDate(), QDate::currentDate(), "", Service),
+    m_bIsExpanded(false),
+    m_bIsFetched(false),
+    m_loginIndex(Qt::CaseSensitive)
 {
 }
 
@@ -21,13 +23,7 @@ LoginItem *ServiceItem::addLogin(const QString &sLoginName)
 
 LoginItem *ServiceItem::findLoginByName(const QString &sLoginName)
 {
-    foreach (TreeItem *pItem, m_vChilds)
-    {
-        LoginItem *pLoginItem = dynamic_cast<LoginItem *>(pItem);
-        if ((pLoginItem != nullptr) && (pLoginItem->name().compare(sLoginName, Qt::CaseSensitive) == 0))
-            return pLoginItem;
-    }
-    return nullptr;
+    return static_cast<LoginItem *>(m_loginIndex.find(sLoginName));
 }
 
 bool ServiceItem::isExpanded() const
@@ -40,6 +36,16 @@ void ServiceItem::setExpanded(bool bExpanded)
     m_bIsExpanded = bExpanded;
 }
 
+bool ServiceItem::isFetched() const
+{
+    return m_bIsFetched;
+}
+
+void ServiceItem::setFetched(bool bFetched)
+{
+    m_bIsFetched = bFetched;
+}
+
 QString ServiceItem::logins() const
 {
     QString sLogins = "";
@@ -112,9 +118,20 @@ QDate ServiceItem::bestUpdateDate(Qt::SortOrder order) const
     return bestDate;
 }
 
-TreeItem::TreeType ServiceItem::treeType() const
+void ServiceItem::childAdded(TreeItem *pItem)
+{
+    if (pItem->treeType() == Login)
+        m_loginIndex.insert(pItem);
+}
+
+void ServiceItem::childRemoved(TreeItem *pItem, const QString &sName)
+{
+    m_loginIndex.remove(pItem, sName, m_vChilds);
+}
+
+void ServiceItem::childsCleared()
 {
-    return Service;
+    m_loginIndex.clear();
 }
 
 
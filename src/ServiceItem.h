@@ -8,6 +8,8 @@ class LoginItem;
 class ServiceItem : public TreeItem
 {
 public:
+    static constexpr TreeType Kind = Service;
+
     ServiceItem(const QString &sServiceName);
     virtual ~ServiceItem();
 
@@ -15,12 +17,21 @@ public:
     LoginItem *findLoginByName(const QString &sLoginName);
     bool isExpanded() const;
     void setExpanded(bool bExpanded);
+    bool isFetched() const;
+    void setFetched(bool bFetched);
     QString logins() const;
 
     virtual QDate bestUpdateDate(Qt::SortOrder order) const Q_DECL_OVERRIDE;
-    virtual TreeType treeType()  const Q_DECL_OVERRIDE;
+
+protected:
+    virtual void childAdded(TreeItem *pItem) Q_DECL_OVERRIDE;
+    virtual void childRemoved(TreeItem *pItem, const QString &sName) Q_DECL_OVERRIDE;
+    virtual void childsCleared() Q_DECL_OVERRIDE;
+
 private:
     bool m_bIsExpanded;
+    bool m_bIsFetched;
+    TreeItemNameIndex m_loginIndex;
 };
 
 #endif // SERVICEITEM_H
@@ -39,6 +39,7 @@ public:
 
     //reload parameters from MP
     virtual void loadParameters() = 0;
+    bool isReadingParams() const { return m_readingParams; }
     virtual void updateParam(MPParams::Param param, int val) = 0;
     void updateParam(MPParams::Param param, bool en);
     virtual void setupKeyboardLayout() {}
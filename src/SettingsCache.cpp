@@ -0,0 +1,207 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#include "SettingsCache.h"
+
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QDebug>
+
+SettingsCache *SettingsCache::instance()
+{
+    //Created on first use, the application name must be set by then
+    static SettingsCache *cache = new SettingsCache(QCoreApplication::instance());
+    return cache;
+}
+
+SettingsCache::SettingsCache(QObject *parent):
+    QObject(parent),
+    m_isDefault(true)
+{
+    init();
+}
+
+SettingsCache::SettingsCache(const QString &fileName, QSettings::Format format, QObject *parent):
+    QObject(parent),
+    m_fileName(fileName),
+    m_format(format)
+{
+    init();
+}
+
+SettingsCache::~SettingsCache()
+{
+    sync();
+}
+
+void SettingsCache::init()
+{
+    m_writeTimer.setSingleShot(true);
+    m_writeTimer.setInterval(WRITE_DELAY_MS);
+    connect(&m_writeTimer, &QTimer::timeout, this, &SettingsCache::sync);
+
+    m_reloadTimer.setSingleShot(true);
+    m_reloadTimer.setInterval(RELOAD_DELAY_MS);
+    connect(&m_reloadTimer, &QTimer::timeout, this, &SettingsCache::reload);
+
+    if (QCoreApplication::instance())
+        connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &SettingsCache::sync);
+
+    QScopedPointer<QSettings> s(createSettings());
+    foreach (const QString &key, s->allKeys())
+        m_values.insert(key, s->value(key));
+
+    connect(&m_watcher, &QFileSystemWatcher::fileChanged, this, &SettingsCache::onStoreChanged);
+    if (QFileInfo(s->fileName()).isFile())
+    {
+        m_watcher.addPath(s->fileName());
+    }
+    else
+    {
+        //Registry or a file that doesn't exist yet, check it from time to time
+        m_reloadTimer.setSingleShot(false);
+        m_reloadTimer.setInterval(POLL_INTERVAL_MS);
+        m_reloadTimer.start();
+    }
+}
+
+QSettings *SettingsCache::createSettings() const
+{
+    if (m_isDefault)
+        return new QSettings();
+    return new QSettings(m_fileName, m_format);
+}
+
+QVariant SettingsCache::value(const QString &key, const QVariant &defaultValue) const
+{
+    auto it = m_values.constFind(key);
+    return it == m_values.constEnd() ? defaultValue : it.value();
+}
+
+void SettingsCache::setValue(const QString &key, const QVariant &value)
+{
+    m_pendingRemovals.remove(key);
+    m_pendingWrites.insert(key, value);
+    if (!m_writeTimer.isActive())
+        m_writeTimer.start();
+
+    auto it = m_values.find(key);
+    if (it != m_values.end() && it.value() == value)
+        return;
+    m_values.insert(key, value);
+    emit valueChanged(key, value);
+}
+
+void SettingsCache::remove(const QString &key)
+{
+    m_pendingWrites.remove(key);
+    m_pendingRemovals.insert(key);
+    if (!m_writeTimer.isActive())
+        m_writeTimer.start();
+
+    if (m_values.remove(key) > 0)
+        emit valueChanged(key, QVariant());
+}
+
+void SettingsCache::sync()
+{
+    m_writeTimer.stop();
+    if (m_pendingWrites.isEmpty() && m_pendingRemovals.isEmpty())
+        return;
+
+    QScopedPointer<QSettings> s(createSettings());
+    writePending(*s);
+    s->sync();
+    if (s->status() != QSettings::NoError)
+        qWarning() << "Unable to save settings" << s->fileName() << s->status();
+
+    //The store may have just been created
+    if (m_watcher.files().isEmpty() && QFileInfo(s->fileName()).isFile())
+    {
+        m_reloadTimer.stop();
+        m_reloadTimer.setSingleShot(true);
+        m_reloadTimer.setInterval(RELOAD_DELAY_MS);
+        m_watcher.addPath(s->fileName());
+    }
+}
+
+void SettingsCache::writePending(QSettings &s)
+{
+    foreach (const QString &key, m_pendingRemovals)
+        s.remove(key);
+    for (auto it = m_pendingWrites.constBegin(); it != m_pendingWrites.constEnd(); ++it)
+        s.setValue(it.key(), it.value());
+
+    m_pendingRemovals.clear();
+    m_pendingWrites.clear();
+}
+
+void SettingsCache::onStoreChanged()
+{
+    //Files are often replaced rather than modified, watch the new one
+    const QStringList files = m_watcher.files();
+    QScopedPointer<QSettings> s(createSettings());
+    if (!files.contains(s->fileName()) && QFileInfo(s->fileName()).isFile())
+        m_watcher.addPath(s->fileName());
+
+    //Writers touch the file several times, reload once they are done
+    m_reloadTimer.start();
+}
+
+void SettingsCache::reload()
+{
+    QScopedPointer<QSettings> s(createSettings());
+    s->sync();
+
+    QHash<QString, QVariant> values;
+    foreach (const QString &key, s->allKeys())
+        values.insert(key, s->value(key));
+
+    //Local changes not written yet win over the store
+    for (auto it = m_pendingWrites.constBegin(); it != m_pendingWrites.constEnd(); ++it)
+        values.insert(it.key(), it.value());
+    foreach (const QString &key, m_pendingRemovals)
+        values.remove(key);
+
+    QStringList changed;
+    for (auto it = values.begin(); it != values.end(); ++it)
+    {
+        auto old = m_values.constFind(it.key());
+        if (old == m_values.constEnd())
+        {
+            changed << it.key();
+            continue;
+        }
+
+        //INI files give strings back, keep the type the value was cached with
+        QVariant read = it.value();
+        if (read.userType() != old.value().userType() && read.convert(old.value().userType()))
+            it.value() = read;
+        if (old.value() != it.value())
+            changed << it.key();
+    }
+    for (auto it = m_values.constBegin(); it != m_values.constEnd(); ++it)
+    {
+        if (!values.contains(it.key()))
+            changed << it.key();
+    }
+
+    m_values = values;
+    foreach (const QString &key, changed)
+        emit valueChanged(key, m_values.value(key));
+}
@@ -0,0 +1,90 @@
+/******************************************************************************
+ **  Copyright (c) Raoul Hecky. All Rights Reserved.
+ **
+ **  Moolticute is free software; you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation; either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Moolticute is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Foobar; if not, write to the Free Software
+ **  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ **
+ ******************************************************************************/
+#ifndef SETTINGSCACHE_H
+#define SETTINGSCACHE_H
+
+#include <QObject>
+#include <QHash>
+#include <QSet>
+#include <QSettings>
+#include <QTimer>
+#include <QFileSystemWatcher>
+
+/* In-memory copy of a QSettings store.
+ * Values are loaded once and served from a hash, so reading a setting on a
+ * request path never touches the filesystem. setValue() updates the copy
+ * immediately, the writes are coalesced and flushed to disk shortly after.
+ * The store is watched (or polled when it is not a plain file, like the
+ * Windows registry) so changes made by another process, like the GUI
+ * writing the daemon settings, are picked up and notified with
+ * valueChanged().
+ * Must be used from the main thread.
+ */
+class SettingsCache: public QObject
+{
+    Q_OBJECT
+
+public:
+    //Default application settings, as returned by QSettings()
+    static SettingsCache *instance();
+
+    SettingsCache(const QString &fileName, QSettings::Format format, QObject *parent = nullptr);
+    ~SettingsCache();
+
+    QVariant value(const QString &key, const QVariant &defaultValue = QVariant()) const;
+    bool contains(const QString &key) const { return m_values.contains(key); }
+
+    void setValue(const QString &key, const QVariant &value);
+    void remove(const QString &key);
+
+    //Write the pending changes now
+    void sync();
+
+signals:
+    void valueChanged(const QString &key, const QVariant &value);
+
+private slots:
+    void reload();
+    void onStoreChanged();
+
+private:
+    explicit SettingsCache(QObject *parent);
+
+    void init();
+    QSettings *createSettings() const;
+    void writePending(QSettings &s);
+
+    static constexpr int WRITE_DELAY_MS = 200;
+    static constexpr int RELOAD_DELAY_MS = 100;
+    static constexpr int POLL_INTERVAL_MS = 5000;
+
+    bool m_isDefault = false;
+    QString m_fileName;
+    QSettings::Format m_format = QSettings::NativeFormat;
+
+    QHash<QString, QVariant> m_values;
+    QHash<QString, QVariant> m_pendingWrites;
+    QSet<QString> m_pendingRemovals;
+
+    QTimer m_writeTimer;
+    QTimer m_reloadTimer;
+    QFileSystemWatcher m_watcher;
+};
+
+#endif // SETTINGSCACHE_H
@@ -5,7 +5,8 @@
 // Application
 #include "TreeItem.h"
 
-TreeItem::TreeItem(const QString &sName, const QDate &dCreatedDate, const QDate &dUpdatedDate, const QString &sDescription) :
+TreeItem::TreeItem(const QString &sName, const QDate &dCreatedDate, const QDate &dUpdatedDate, const QString &sDescription, TreeType eTreeType) :
+    m_eTreeType(eTreeType),
     m_pParentItem(nullptr),
     m_eStatus(UNUSED),
     m_sName(sName),
@@ -27,7 +28,13 @@ const QString &TreeItem::name() const
 
 void TreeItem::setName(const QString &sName)
 {
+    QString sOldName = m_sName;
     m_sName = sName;
+    if (m_pParentItem != nullptr)
+    {
+        m_pParentItem->childRemoved(this, sOldName);
+        m_pParentItem->childAdded(this);
+    }
 }
 
 TreeItem *TreeItem::child(int iIndex)
@@ -167,12 +174,16 @@ void TreeItem::addChild(TreeItem *pItem)
     {
         pItem->setParentItem(this);
         m_vChilds << pItem;
+        childAdded(pItem);
     }
 }
 
 bool TreeItem::removeOne(TreeItem *pItem)
 {
-    return m_vChilds.removeOne(pItem);
+    if (!m_vChilds.removeOne(pItem))
+        return false;
+    childRemoved(pItem, pItem->name());
+    return true;
 }
 
 TreeItem *TreeItem::parentItem()
@@ -184,9 +195,82 @@ void TreeItem::clear()
 {
     qDeleteAll(m_vChilds);
     m_vChilds.clear();
+    childsCleared();
+}
+
+void TreeItem::childAdded(TreeItem *pItem)
+{
+    Q_UNUSED(pItem);
+}
+
+void TreeItem::childRemoved(TreeItem *pItem, const QString &sName)
+{
+    Q_UNUSED(pItem);
+    Q_UNUSED(sName);
+}
+
+void TreeItem::childsCleared()
+{
+}
+
+TreeItemNameIndex::TreeItemNameIndex(Qt::CaseSensitivity eCase) :
+    m_eCase(eCase)
+{
+}
+
+void TreeItemNameIndex::insert(TreeItem *pItem)
+{
+    QString sKey = key(pItem->name());
+    auto it = m_hItems.constFind(sKey);
+    if (it == m_hItems.constEnd())
+        m_hItems.insert(sKey, pItem);
+    else if (it.value() != pItem)
+        m_iDuplicates++;
+}
+
+void TreeItemNameIndex::remove(TreeItem *pItem, const QString &sName, const QVector<TreeItem *> &vChilds)
+{
+    QString sKey = key(sName);
+    auto it = m_hItems.find(sKey);
+    if (it == m_hItems.end())
+        return;
+
+    if (it.value() != pItem)
+    {
+        // A duplicate which was hidden by the indexed item
+        if (m_iDuplicates > 0)
+            m_iDuplicates--;
+        return;
+    }
+
+    m_hItems.erase(it);
+    if (m_iDuplicates == 0)
+        return;
+
+    // Promote the next child with the same name
+    foreach (TreeItem *pChild, vChilds)
+    {
+        if ((pChild != pItem) && (key(pChild->name()) == sKey))
+        {
+            m_hItems.insert(sKey, pChild);
+            m_iDuplicates--;
+            return;
+        }
+    }
+}
+
+void TreeItemNameIndex::clear()
+{
+    m_hItems.clear();
+    m_iDuplicates = 0;
+}
+
+TreeItem *TreeItemNameIndex::find(const QString &sName) const
+{
+    return m_hItems.value(key(sName), nullptr);
 }
 
-TreeItem::TreeType TreeItem::treeType() const
+QString TreeItemNameIndex::key(const QString &sName) const
 {
-    return Base;
+    return m_eCase == Qt::CaseInsensitive ? sName.toCaseFolded() : sName;
 }
@@ -6,6 +6,7 @@
 #include <QVariant>
 #include <QVector>
 #include <QDate>
+#include <QHash>
 
 class TreeItem
 {
@@ -45,15 +46,22 @@ public:
     void addChild(TreeItem *pItem);
     bool removeOne(TreeItem *pItem);
     void clear();
-    virtual TreeType treeType()  const;
+    TreeType treeType() const { return m_eTreeType; }
 
 protected:
+    // Called when the list of childs changes, for items indexing their childs
+    virtual void childAdded(TreeItem *pItem);
+    virtual void childRemoved(TreeItem *pItem, const QString &sName);
+    virtual void childsCleared();
+
     explicit TreeItem(const QString &sName = "",
                       const QDate &dCreatedDate = QDate::currentDate(),
                       const QDate &dUpdatedDate = QDate::currentDate(),
-                      const QString &setDescription = "");
+                      const QString &setDescription = "",
+                      TreeType eTreeType = Base);
 
 protected:
+    const TreeType m_eTreeType;
     QVector<TreeItem *> m_vChilds;
     TreeItem *m_pParentItem;
     Status m_eStatus;
@@ -67,4 +75,38 @@ protected:
     int m_iPwdBlankFlag = 0;
 };
 
+// Checked downcast on the item kind, cheaper than a dynamic_cast
+template<class T>
+T *tree_item_cast(TreeItem *pItem)
+{
+    return ((pItem != nullptr) && (pItem->treeType() == T::Kind)) ? static_cast<T *>(pItem) : nullptr;
+}
+
+template<class T>
+const T *tree_item_cast(const TreeItem *pItem)
+{
+    return ((pItem != nullptr) && (pItem->treeType() == T::Kind)) ? static_cast<const T *>(pItem) : nullptr;
+}
+
+/* Name index over the childs of an item.
+ * With duplicated names the first child wins, as a linear search would do.
+ */
+class TreeItemNameIndex
+{
+public:
+    explicit TreeItemNameIndex(Qt::CaseSensitivity eCase);
+
+    void insert(TreeItem *pItem);
+    void remove(TreeItem *pItem, const QString &sName, const QVector<TreeItem *> &vChilds);
+    void clear();
+    TreeItem *find(const QString &sName) const;
+
+private:
+    QString key(const QString &sName) const;
+
+    Qt::CaseSensitivity m_eCase;
+    QHash<QString, TreeItem *> m_hItems;
+    int m_iDuplicates = 0;
+};
+
 #endif // TREEITEM_H
@@ -91,7 +91,8 @@ public:
 
     void exportDbFile(const QString &encryption);
     void importDbFile(const QByteArray &fileData, bool noDelete);
-    void importCSVFile(const QList<QStringList> &fileData);
+    //creds are the objects {service, login, password} read from the CSV file
+    void importCSVFile(const QJsonArray &creds);
 
     void sendListFilesCacheRequest();
     void sendRefreshFilesCacheRequest();
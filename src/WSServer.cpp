@@ -47,8 +47,8 @@ bool WSServer::initialize()
     connect(MPManager::Instance(), SIGNAL(mpConnected(MPDevice*)), this, SLOT(mpAdded(MPDevice*)));
     connect(MPManager::Instance(), SIGNAL(mpDisconnected(MPDevice*)), this, SLOT(mpRemoved(MPDevice*)));
 
-    if (MPManager::Instance()->getDeviceCount() > 0)
-        mpAdded(MPManager::Instance()->getDevice(0));
+    for (MPDevice *dev: MPManager::Instance()->getDevices())
+        mpAdded(dev);
 
     return true;
 }
@@ -65,7 +65,7 @@ void WSServer::onNewConnection()
 
     connect(wsocket, &QWebSocket::disconnected, this, &WSServer::socketDisconnected);
     WSServerCon *c = new WSServerCon(wsocket);
-    c->resetDevice(device);
+    c->resetDevice(getDefaultDevice());
     c->sendInitialStatus();
     //let clients send broadcast messages
     connect(c, &WSServerCon::notifyAllClients, this, &WSServer::notifyClients);
@@ -84,11 +84,14 @@ void WSServer::socketDisconnected()
     {
         qDebug() << "Connection closed " << wsClients[wsocket];
 
-        if (isMemModeLocked() &&
-            lockedUid == wsClients[wsocket]->getClientUid())
+        for (MPDevice *dev: qAsConst(devices))
         {
-            qWarning() << "Exiting MMM because client exits without doing it.";
-            device->exitMemMgmtMode();
+            if (isMemModeLocked(dev) &&
+                lockedUids.value(dev) == wsClients[wsocket]->getClientUid())
+            {
+                qWarning() << "Exiting MMM because client exits without doing it.";
+                dev->exitMemMgmtMode();
+            }
         }
 
         wsClients[wsocket]->deleteLater();
@@ -120,37 +123,69 @@ void WSServer::notifyGUI(const QString &message, bool &isGuiRunning)
     isGuiRunning = false;
 }
 
+void WSServer::notifyDeviceList()
+{
+    notifyClients({{ "msg", "device_list" },
+                   { "data", getDeviceList() }});
+}
+
+QJsonArray WSServer::getDeviceList() const
+{
+    QJsonArray list;
+    for (MPDevice *dev: devices)
+    {
+        list.append(QJsonObject{{ "hw_serial", static_cast<qint64>(dev->get_serialNumber()) },
+                                { "uid", dev->get_uid() },
+                                { "hw_version", dev->get_hwVersion() },
+                                { "is_ble", dev->isBLE() },
+                                { "default", dev == getDefaultDevice() }});
+    }
+    return list;
+}
+
 void WSServer::mpAdded(MPDevice *dev)
 {
-    if (device == dev)
+    if (devices.contains(dev))
         return;
 
-    //tell clients that current mp is not connected anymore
-    //and use new connected mp instead
-    if (device && device != dev)
-        mpRemoved(device);
-
     qDebug() << "Mooltipass connected";
-    device = dev;
+    devices.append(dev);
 
-    for (auto it = wsClients.begin();it != wsClients.end();it++)
+    //Serial and uid are only known once the device answered,
+    //refresh the list for clients addressing devices
+    connect(dev, &MPDevice::serialNumberChanged, this, &WSServer::notifyDeviceList);
+    connect(dev, &MPDevice::uidChanged, this, &WSServer::notifyDeviceList);
+
+    //First connected device is used by clients that did not select one
+    if (dev == getDefaultDevice())
     {
-        it.value()->resetDevice(device);
+        for (auto it = wsClients.begin();it != wsClients.end();it++)
+        {
+            it.value()->resetDevice(dev);
+        }
     }
+
+    notifyDeviceList();
 }
 
 void WSServer::mpRemoved(MPDevice *dev)
 {
-    if (device == dev)
-    {
-        qDebug() << "Mooltipass disconnected";
-        device = nullptr;
+    if (!devices.contains(dev))
+        return;
 
-        for (auto it = wsClients.begin();it != wsClients.end();it++)
-        {
-            it.value()->resetDevice(device);
-        }
+    qDebug() << "Mooltipass disconnected";
+    disconnect(dev, nullptr, this, nullptr);
+    devices.removeAll(dev);
+    lockedUids.remove(dev);
+
+    //Clients using that device fall back to the default one
+    for (auto it = wsClients.begin();it != wsClients.end();it++)
+    {
+        if (it.value()->getDevice() == dev)
+            it.value()->resetDevice(getDefaultDevice());
     }
+
+    notifyDeviceList();
 }
 
 void WSServer::originAuthenticationRequired(QWebSocketCorsAuthenticator *authenticator)
@@ -195,15 +230,15 @@ bool WSServer::checkClientExists(QWebSocket *ws)
     return true;
 }
 
-bool WSServer::isMemModeLocked(QString uid)
+bool WSServer::isMemModeLocked(MPDevice *dev, QString uid)
 {
     //if the current client that has locked
     //the mem mode query for locked state, return false
-    if (uid == lockedUid)
+    if (uid == lockedUids.value(dev))
         return false;
 
     //if mem mode is enabled, it is locked
-    if (device && device->get_memMgmtMode())
+    if (dev && dev->get_memMgmtMode())
         return true;
     return false;
 }
@@ -44,14 +44,19 @@ public:
     bool checkClientExists(WSServerCon *wscon);
     bool checkClientExists(QWebSocket *ws);
 
-    void setMemLockedClient(QString uid) { lockedUid = uid; }
-    bool isMemModeLocked(QString uid = QString());
+    void setMemLockedClient(QString uid, MPDevice *dev) { lockedUids[dev] = uid; }
+    bool isMemModeLocked(MPDevice *dev, QString uid = QString());
+
+    //Device used by clients that did not select one
+    MPDevice *getDefaultDevice() const { return devices.isEmpty()? nullptr : devices.first(); }
+    QJsonArray getDeviceList() const;
 
 private slots:
     void onNewConnection();
     void socketDisconnected();
     void notifyClients(const QJsonObject &obj);
     void notifyGUI(const QString& message, bool &isGuiRunning);
+    void notifyDeviceList();
 
     void mpAdded(MPDevice *device);
     void mpRemoved(MPDevice *device);
@@ -64,12 +69,12 @@ private:
     QHash<QWebSocket *, WSServerCon *> wsClients;
     QHash<WSServerCon *, QWebSocket *> wsClientsReverse; //reverse map for fast lookup
 
-    QString lockedUid;
+    //client uid that has locked MMM, for each device
+    QHash<MPDevice *, QString> lockedUids;
 
-    //Current MP
-    //For now only one MP is supported. maybe add multi support
-    // one day (but it's not really useful anyway)
-    MPDevice *device = nullptr;
+    //Connected MPs, in connection order. Each device has its own
+    //command queue and jobs queue, so they can be used in parallel.
+    QList<MPDevice *> devices;
 };
 
 #endif // WSSERVER_H
@@ -22,9 +22,29 @@
 #include "ParseDomain.h"
 #include "MPDeviceBleImpl.h"
 #include "HaveIBeenPwned.h"
+#include "SettingsCache.h"
 
 #include <QCryptographicHash>
 
+namespace
+{
+/* Commands answered through the signals of the bound device, which
+ * resetDevice() connected. They can't be addressed to another device
+ * with the "device" field, the client has to use select_device.
+ */
+const QSet<QString> BOUND_DEVICE_COMMANDS = {
+    "start_memorymgmt",
+    "exit_memorymgmt",
+    "param_set",
+    "load_params",
+    "request_device_uid",
+    "refresh_files_cache",
+    "list_files_cache",
+    "get_user_settings",
+    "request_keyboard_layout"
+};
+}
+
 WSServerCon::WSServerCon(QWebSocket *conn):
     wsClient(conn),
     clientUid(Common::createUid(QStringLiteral("ws-"))),
@@ -88,6 +108,29 @@ void WSServerCon::processMessage(const QString &message)
         sendJsonMessage(oroot);
         return;
     }
+    else if (root["msg"] == "get_devices")
+    {
+        QJsonObject oroot = root;
+        oroot["data"] = WSServer::Instance()->getDeviceList();
+        sendJsonMessage(oroot);
+        return;
+    }
+    else if (root["msg"] == "select_device")
+    {
+        //Bind this connection to a device, all following requests
+        //without a "device" field are sent to it
+        MPDevice *dev = nullptr;
+        if (!findRequestDevice(root["data"].toObject(), dev))
+        {
+            sendFailedJson(root, "Unknown device");
+            return;
+        }
+        resetDevice(dev);
+        QJsonObject oroot = root;
+        oroot["data"] = QJsonObject{{ "success", "true" }};
+        sendJsonMessage(oroot);
+        return;
+    }
     else if (root["msg"] == "show_status_notification_warning")
     {
         QJsonDocument showWarningDoc(root);
@@ -99,6 +142,34 @@ void WSServerCon::processMessage(const QString &message)
         }
         return;
     }
+    else if (root["msg"] == "hibp_audit")
+    {
+        //Bulk check of SHA-1 hex digests against the offline HIBP index
+        const QJsonArray jhashes = root["data"].toObject()["hashes"].toArray();
+        QVector<QByteArray> hashes;
+        hashes.reserve(jhashes.size());
+        for (const QJsonValue &v: jhashes)
+        {
+            hashes.append(QByteArray::fromHex(v.toString().toLatin1()));
+        }
+
+        QVector<quint32> counts;
+        if (!hibp->auditHashes(hashes, counts))
+        {
+            sendFailedJson(root, "HIBP offline index is not available");
+            return;
+        }
+
+        QJsonArray jcounts;
+        for (quint32 c: counts)
+        {
+            jcounts.append(static_cast<qint64>(c));
+        }
+        QJsonObject oroot = root;
+        oroot["data"] = QJsonObject{{ "counts", jcounts }};
+        sendJsonMessage(oroot);
+        return;
+    }
 
     //Strip the data for the progress lambda,
     //uneeded data should not be passed around
@@ -140,18 +211,34 @@ void WSServerCon::processMessage(const QString &message)
         sendJsonMessage(oroot);
     };
 
-    if (!mpdevice)
+    //A request can be addressed to any connected device with
+    //its serial number or uid, otherwise the bound device is used.
+    //Callbacks use this device, the connection may be bound to
+    //another one by the time they run
+    MPDevice *device = mpdevice;
+    if (!findRequestDevice(root, device))
+    {
+        sendFailedJson(root, "Unknown device");
+        return;
+    }
+    if (device != mpdevice && BOUND_DEVICE_COMMANDS.contains(root["msg"].toString()))
+    {
+        sendFailedJson(root, "Command not supported with a device field, use select_device first");
+        return;
+    }
+
+    if (!device)
     {
         sendFailedJson(root, "No device connected");
         return;
     }
 
-    if (checkMemModeEnabled(root))
+    if (checkMemModeEnabled(root, device))
         return;
 
     if (root["msg"] == "get_random_numbers")
     {
-        mpdevice->getRandomNumber([=](bool success, QString errstr, const QByteArray &rndNums)
+        device->getRandomNumber([=](bool success, QString errstr, const QByteArray &rndNums)
         {
             if (!WSServer::Instance()->checkClientExists(this))
                 return;
@@ -176,10 +263,10 @@ void WSServerCon::processMessage(const QString &message)
     {
         QJsonObject o = root["data"].toObject();
 
-        WSServer::Instance()->setMemLockedClient(clientUid);
+        WSServer::Instance()->setMemLockedClient(clientUid, device);
 
         //send command to start MMM
-        mpdevice->startMemMgmtMode(o["want_data"].toBool(),
+        device->startMemMgmtMode(o["want_data"].toBool(),
                 defaultProgressCb,
                 [=](bool success, int errCode, QString errMsg)
         {
@@ -197,17 +284,17 @@ void WSServerCon::processMessage(const QString &message)
     else if (root["msg"] == "exit_memorymgmt")
     {
         //send command to exit MMM
-        mpdevice->exitMemMgmtMode();
+        device->exitMemMgmtMode();
     }
     else if (root["msg"] == "set_credentials")
     {
-        if (!mpdevice->get_memMgmtMode())
+        if (!device->get_memMgmtMode())
         {
             sendFailedJson(root, "Not in memory management mode");
             return;
         }
 
-        mpdevice->setMMCredentials(
+        device->setMMCredentials(
                     root["data"].toArray(),
                     false,
                     defaultProgressCb,
@@ -236,11 +323,11 @@ void WSServerCon::processMessage(const QString &message)
         if (o.contains("request_id"))
             reqid = QStringLiteral("%1-%2").arg(clientUid).arg(getRequestId(o["request_id"]));
 
-        mpdevice->cancelUserRequest(reqid);
+        device->cancelUserRequest(reqid);
     }
     else if (root["msg"] == "reset_card")
     {
-        mpdevice->resetSmartCard([=](bool success, QString errstr)
+        device->resetSmartCard([=](bool success, QString errstr)
         {
             if (!WSServer::Instance()->checkClientExists(this))
                 return;
@@ -261,7 +348,7 @@ void WSServerCon::processMessage(const QString &message)
     }
     else if (root["msg"] == "lock_device")
     {
-        mpdevice->lockDevice([this, root](bool success, QString errstr)
+        device->lockDevice([this, root](bool success, QString errstr)
         {
             if (!success)
             {
@@ -278,7 +365,7 @@ void WSServerCon::processMessage(const QString &message)
     }
     else if (root["msg"] == "get_available_users")
     {
-        mpdevice->getAvailableUsers([this, root](bool success, QString result)
+        device->getAvailableUsers([this, root](bool success, QString result)
         {
             if (!success)
             {
@@ -296,7 +383,7 @@ void WSServerCon::processMessage(const QString &message)
     }
     else if (root["msg"] == "param_set")
     {
-        processParametersSet(root["data"].toObject());
+        processParametersSet(device, root["data"].toObject());
     }
     else if (root["msg"] == "export_database")
     {
@@ -307,7 +394,7 @@ void WSServerCon::processMessage(const QString &message)
             encryptionMethod = o.value("encryption").toString();
         }
 
-        mpdevice->exportDatabase(encryptionMethod,
+        device->exportDatabase(encryptionMethod,
                                  [=](bool success, QString errstr, QByteArray fileData)
         {
             qDebug() << "send exported DB on WS: success:" << success
@@ -342,7 +429,7 @@ void WSServerCon::processMessage(const QString &message)
             return;
         }
 
-        mpdevice->importDatabase(data, o["no_delete"].toBool(),
+        device->importDatabase(data, o["no_delete"].toBool(),
                     [=](bool success, QString errstr)
         {
             if (!WSServer::Instance()->checkClientExists(this))
@@ -362,13 +449,19 @@ void WSServerCon::processMessage(const QString &message)
         },
         defaultProgressCb);
     }
+    else if (root["msg"] == "get_jobs_queue_stats")
+    {
+        QJsonObject oroot = root;
+        oroot["data"] = device->getJobsQueueStats();
+        sendJsonMessage(oroot);
+    }
     else if (root["msg"] == "load_params")
     {
-        mpdevice->loadParams();
+        device->loadParams();
     }
     else if (root["msg"] == "import_csv")
     {
-        mpdevice->importFromCSV(
+        device->importFromCSV(
                     root["data"].toArray(),
                     defaultProgressCb,
                     [=](bool success, QString errstr)
@@ -389,13 +482,13 @@ void WSServerCon::processMessage(const QString &message)
             sendJsonMessage(oroot);
         });
     }
-    else if (mpdevice->isBLE())
+    else if (device->isBLE())
     {
-        processMessageBLE(root, defaultProgressCb);
+        processMessageBLE(root, device, defaultProgressCb);
     }
     else
     {
-        processMessageMini(root, defaultProgressCb);
+        processMessageMini(root, device, defaultProgressCb);
     }
 }
 
@@ -413,6 +506,15 @@ void WSServerCon::sendFailedJson(QJsonObject obj, QString errstr, int errCode)
 
 void WSServerCon::resetDevice(MPDevice *dev)
 {
+    if (mpdevice)
+    {
+        //Stop listening to the previously bound device
+        disconnect(mpdevice, nullptr, this, nullptr);
+        disconnect(mpdevice->settings(), nullptr, this, nullptr);
+        if (mpdevice->ble())
+            disconnect(mpdevice->ble(), nullptr, this, nullptr);
+    }
+
     mpdevice = dev;
 
     if (!mpdevice)
@@ -518,6 +620,8 @@ void WSServerCon::sendMemMgmtMode()
     QJsonObject jdata;
     jdata["login_nodes"] = logins;
     jdata["data_nodes"] = datas;
+    //password_enc and data bytes are base64 strings
+    jdata["bytes_encoding"] = "base64";
 
     sendJsonMessage({{ "msg", "memorymgmt_data" },
                      { "data", jdata }});
@@ -654,9 +758,9 @@ void WSServerCon::sendUserSettings(QJsonObject settings)
     sendJsonMessage(oroot);
 }
 
-void WSServerCon::processParametersSet(const QJsonObject &data)
+void WSServerCon::processParametersSet(MPDevice *device, const QJsonObject &data)
 {
-    DeviceSettings *settings = mpdevice->settings();
+    DeviceSettings *settings = device->settings();
     if (!settings)
         return;
 
@@ -689,20 +793,47 @@ QString WSServerCon::getRequestId(const QJsonValue &v)
 
 void WSServerCon::checkHaveIBeenPwned(const QString &service, const QString &login, const QString &password)
 {
-    QSettings s;
-    if (s.value("settings/enable_hibp_check").toBool())
+    if (SettingsCache::instance()->value("settings/enable_hibp_check").toBool())
     {
         QString credInfo = service + ": " + login + ": ";
         hibp->isPasswordPwned(password, credInfo);
     }
 }
 
-void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb &cbProgress)
+void WSServerCon::processMessageMini(QJsonObject root, MPDevice *device, const MPDeviceProgressCb &cbProgress)
 {
-    if (root["msg"] == "start_memcheck")
+    //"graph" and "graph_sweep" modes are faster than the default full scan
+    const QString memcheckMode = root["data"].toObject()["mode"].toString();
+
+    if (root["msg"] == "start_memcheck" && (memcheckMode == "graph" || memcheckMode == "graph_sweep"))
+    {
+        //start the faster check, following the links and optionally sweeping for orphans
+        device->startGraphIntegrityCheck(memcheckMode == "graph_sweep", cbProgress,
+                    [=](bool success, QString errstr, QJsonObject report)
+        {
+            if (!WSServer::Instance()->checkClientExists(this))
+                return;
+
+            QJsonObject oroot = root;
+            oroot["msg"] = "memcheck";
+
+            if (!success)
+            {
+                sendFailedJson(oroot, errstr);
+                return;
+            }
+
+            QJsonObject ores = report;
+            ores["memcheck_status"] = "done";
+            ores["status_msg"] = errstr;
+            oroot["data"] = ores;
+            sendJsonMessage(oroot);
+        });
+    }
+    else if (root["msg"] == "start_memcheck")
     {
         //start integrity check
-        mpdevice->startIntegrityCheck(
+        device->startIntegrityCheck(
                     [=](bool success, int freeBlocks, int totalBlocks, QString errstr)
         {
             if (!WSServer::Instance()->checkClientExists(this))
@@ -726,6 +857,28 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
         },
         cbProgress);
     }
+    else if (root["msg"] == "compact_db")
+    {
+        //Page use is computed with the Mini flash layout
+        const bool dryRun = root["data"].toObject()["dry_run"].toBool();
+
+        device->compactDatabase(dryRun, cbProgress,
+                    [=](bool success, QString errstr, QJsonObject report)
+        {
+            if (!WSServer::Instance()->checkClientExists(this))
+                return;
+
+            if (!success)
+            {
+                sendFailedJson(root, errstr);
+                return;
+            }
+
+            QJsonObject oroot = root;
+            oroot["data"] = report;
+            sendJsonMessage(oroot);
+        });
+    }
     else if (root["msg"] == "ask_password" ||
              root["msg"] == "get_credential")
     {
@@ -735,7 +888,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
         if (o.contains("request_id"))
             reqid = QStringLiteral("%1-%2").arg(clientUid).arg(getRequestId(o["request_id"]));
 
-        mpdevice->getCredential(o["service"].toString(), o["login"].toString(), o["fallback_service"].toString(),
+        device->getCredential(o["service"].toString(), o["login"].toString(), o["fallback_service"].toString(),
                 reqid,
                 [=](bool success, QString errstr, const QString &service, const QString &login, const QString &pass, const QString &desc)
         {
@@ -754,7 +907,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
             ores["service"] = service;
             ores["login"] = login;
             ores["password"] = pass;
-            if (mpdevice && mpdevice->isFw12()) //only add description for fw > 1.2
+            if (device->isFw12()) //only add description for fw > 1.2
                 ores["description"] = desc;
             oroot["data"] = ores;
             sendJsonMessage(oroot);
@@ -767,7 +920,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
         {
             return;
         }
-        mpdevice->setCredential(o["service"].toString(), o["login"].toString(),
+        device->setCredential(o["service"].toString(), o["login"].toString(),
                 o["password"].toString(), o["description"].toString(), o.contains("description"),
                 [=](bool success, QString errstr)
         {
@@ -789,7 +942,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
     else if (root["msg"] == "del_credential")
     {
         QJsonObject o = root["data"].toObject();
-        mpdevice->delCredentialAndLeave(o["service"].toString(), o["login"].toString(),
+        device->delCredentialAndLeave(o["service"].toString(), o["login"].toString(),
                 cbProgress,
                 [=](bool success, QString errstr)
         {
@@ -811,7 +964,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
     {
         QJsonObject o = root["data"].toObject();
         const QByteArray key = o.value("key").toString().toUtf8().simplified();
-        mpdevice->getUID(key);
+        device->getUID(key);
     }
     else if (root["msg"] == "get_data_node")
     {
@@ -820,7 +973,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
         if (o.contains("request_id"))
             reqid = QStringLiteral("%1-%2").arg(clientUid).arg(getRequestId(o["request_id"]));
 
-        mpdevice->getDataNode(o["service"].toString(), o["fallback_service"].toString(),
+        device->getDataNode(o["service"].toString(), o["fallback_service"].toString(),
                 reqid,
                 [=](bool success, QString errstr, const QString &service, const QByteArray &dataNode)
         {
@@ -862,7 +1015,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
             return;
         }
 
-        mpdevice->setDataNode(service, data,
+        device->setDataNode(service, data,
                 [=](bool success, QString errstr)
         {
             if (!WSServer::Instance()->checkClientExists(this))
@@ -886,7 +1039,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
     {
         QJsonObject o = root["data"].toObject();
 
-        if (!mpdevice->get_memMgmtMode())
+        if (!device->get_memMgmtMode())
         {
             sendFailedJson(root, "Not in memory management mode");
             return;
@@ -897,7 +1050,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
         for (int i = 0;i < jarr.size();i++)
             services.append(jarr[i].toString());
 
-        mpdevice->deleteDataNodesAndLeave(services,
+        device->deleteDataNodesAndLeave(services,
                 [=](bool success, QString errstr)
         {
             if (!WSServer::Instance()->checkClientExists(this))
@@ -923,7 +1076,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
         if (o.contains("request_id"))
             reqid = QStringLiteral("%1-%2").arg(clientUid).arg(getRequestId(o["request_id"]));
 
-        mpdevice->serviceExists(false, o["service"].toString(),
+        device->serviceExists(false, o["service"].toString(),
                 reqid,
                 [=](bool success, QString errstr, const QString &service, bool exists)
         {
@@ -952,7 +1105,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
         if (o.contains("request_id"))
             reqid = QStringLiteral("%1-%2").arg(clientUid).arg(getRequestId(o["request_id"]));
 
-        mpdevice->serviceExists(true, o["service"].toString(),
+        device->serviceExists(true, o["service"].toString(),
                 reqid,
                 [=](bool success, QString errstr, const QString &service, bool exists)
         {
@@ -975,7 +1128,7 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
     }
     else if (root["msg"] == "refresh_files_cache")
     {
-        mpdevice->updateFilesCache();
+        device->updateFilesCache();
     }
     else if (root["msg"] == "list_files_cache")
     {
@@ -983,10 +1136,10 @@ void WSServerCon::processMessageMini(QJsonObject root, const MPDeviceProgressCb
     }
 }
 
-void WSServerCon::processMessageBLE(QJsonObject root, const MPDeviceProgressCb &cbProgress)
+void WSServerCon::processMessageBLE(QJsonObject root, MPDevice *device, const MPDeviceProgressCb &cbProgress)
 {
     //Ble related commands
-    MPDeviceBleImpl *bleImpl = mpdevice->ble();
+    MPDeviceBleImpl *bleImpl = device->ble();
     if (nullptr == bleImpl)
     {
         return;
@@ -1173,9 +1326,9 @@ void WSServerCon::processMessageBLE(QJsonObject root, const MPDeviceProgressCb &
     }
 }
 
-bool WSServerCon::checkMemModeEnabled(const QJsonObject &root)
+bool WSServerCon::checkMemModeEnabled(const QJsonObject &root, MPDevice *device)
 {
-    if (WSServer::Instance()->isMemModeLocked(clientUid))
+    if (WSServer::Instance()->isMemModeLocked(device, clientUid))
     {
         sendFailedJson(root, "Device is in memory management mode");
         return true;
@@ -1184,6 +1337,16 @@ bool WSServerCon::checkMemModeEnabled(const QJsonObject &root)
     return false;
 }
 
+bool WSServerCon::findRequestDevice(const QJsonObject &root, MPDevice *&dev)
+{
+    if (!root.contains("device"))
+        return true;
+
+    const QJsonValue id = root["device"];
+    dev = MPManager::Instance()->findDevice(id.isString()? id.toString() : QString::number(id.toVariant().toLongLong()));
+    return dev != nullptr;
+}
+
 bool WSServerCon::processSetCredential(QJsonObject &root, QJsonObject &o)
 {
     QString loginName = o["login"].toString();
@@ -1203,8 +1366,7 @@ bool WSServerCon::processSetCredential(QJsonObject &root, QJsonObject &o)
 
     QString originalService = o["service"].toString();
     ParseDomain url(originalService);
-    QSettings s;
-    bool isSubdomainSelectionEnabled = s.value("settings/enable_subdomain_selection").toBool() && url.isWebsite();
+    bool isSubdomainSelectionEnabled = SettingsCache::instance()->value("settings/enable_subdomain_selection").toBool() && url.isWebsite();
     bool isManualCredential = o.contains("saveManualCredential");
     if (!url.subdomain().isEmpty() && isMsgContainsExtInfo && isSubdomainSelectionEnabled && !isManualCredential && !o.contains("saveDomainConfirmed"))
     {
@@ -37,6 +37,7 @@ public:
     void sendJsonMessage(const QJsonObject &data);
     void sendJsonMessageString(const QString &data);
     void resetDevice(MPDevice *dev);
+    MPDevice *getDevice() const { return mpdevice; }
     void sendInitialStatus();
 
     QString getClientUid() { return clientUid; }
@@ -67,7 +68,8 @@ private slots:
     void sendHibpNotification(QString credInfo, QString pwnedNum);
     void sendUserSettings(QJsonObject settings);
 private:
-    bool checkMemModeEnabled(const QJsonObject &root);
+    bool checkMemModeEnabled(const QJsonObject &root, MPDevice *device);
+    bool findRequestDevice(const QJsonObject &root, MPDevice *&dev);
     bool processSetCredential(QJsonObject &root, QJsonObject &o);
 
     QWebSocket *wsClient;
@@ -78,12 +80,12 @@ private:
 
     HaveIBeenPwned *hibp = nullptr;
 
-    void processParametersSet(const QJsonObject &data);
+    void processParametersSet(MPDevice *device, const QJsonObject &data);
     void sendFailedJson(QJsonObject obj, QString errstr = QString(), int errCode = -999);
     QString getRequestId(const QJsonValue &v);
     void checkHaveIBeenPwned(const QString &service, const QString &login, const QString &password);
-    void processMessageMini(QJsonObject root, const MPDeviceProgressCb &cbProgress);
-    void processMessageBLE(QJsonObject root, const MPDeviceProgressCb &cbProgress);
+    void processMessageMini(QJsonObject root, MPDevice *device, const MPDeviceProgressCb &cbProgress);
+    void processMessageBLE(QJsonObject root, MPDevice *device, const MPDeviceProgressCb &cbProgress);
 };
 
 #endif // WSSERVERCON_H
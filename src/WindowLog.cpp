@@ -25,6 +25,9 @@ WindowLog::WindowLog(QWidget *parent) :
 {
     setAttribute(Qt::WA_DeleteOnClose, true); //delete the dialog on close
     ui->setupUi(this);
+
+    QSettings s;
+    ui->plainTextEdit->setSpillFile(s.value("settings/log_spill_file").toString());
 }
 
 WindowLog::~WindowLog()
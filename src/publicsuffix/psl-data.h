@@ -0,0 +1,10755 @@
+/* Generated by psl-generate.cpp from public_suffix_list.dat, do not edit.
+ * 9506 rules, 10169 nodes.
+ */
+
+struct PslNode
+{
+    unsigned int labelOffset;
+    unsigned int firstChild;
+    unsigned short childCount;
+    unsigned char labelLength;
+    unsigned char flags;
+};
+
+enum PslNodeFlags
+{
+    PSL_TERMINAL = 1,
+    PSL_WILDCARD = 2,
+    PSL_EXCEPTION = 4
+};
+
+static const char PslLabels[] =
+    "aaaaarpabarthabbabbottabbvieabcableabogadoabudhabiacacademyaccentureaccountantaccountantsacoacto"
+    "radadsadultaeaegaeroaetnaafaflafricaagagakhanagencyaiaigairbusairforceairtelakdnalalfaromeoaliba"
+    "baalipayallfinanzallstateallyalsacealstomamamazonamericanexpressamericanfamilyamexamfamamicaamst"
+    "erdamanalyticsandroidanquananzaoaolapartmentsappappleaqaquarelleararabaramcoarchiarmyarpaartarte"
+    "asasdaasiaassociatesatathletaattorneyauauctionaudiaudibleaudioauspostauthorautoautosaviancaawaws"
+    "axaxaazazurebababybaidubanamexbananarepublicbandbankbarbarcelonabarclaycardbarclaysbarefootbarga"
+    "insbaseballbasketballbauhausbayernbbbbcbbtbbvabcgbcnbdbebeatsbeautybeerbentleyberlinbestbestbuyb"
+    "etbfbgbhbhartibibiblebidbikebingbingobiobizbjblackblackfridayblockbusterblogbloombergbluebmbmsbm"
+    "wbnbnpparibasboboatsboehringerbofabombondboobookbookingboschbostikbostonbotboutiqueboxbrbradesco"
+    "bridgestonebroadwaybrokerbrotherbrusselsbsbtbuildbuildersbusinessbuybuzzbvbwbybzbzhcacabcafecalc"
+    "allcalvinkleincamcameracampcanoncapetowncapitalcapitalonecarcaravancardscarecareercareerscarscas"
+    "acasecashcasinocatcateringcatholiccbacbncbrecbscccdcenterceocerncfcfacfdcgchchanelchannelcharity"
+    "chasechatcheapchintaichristmaschromechurchciciprianicircleciscocitadelciticiticcitycityeatsckclc"
+    "laimscleaningclickcliniccliniqueclothingcloudclubclubmedcmcncocoachcodescoffeecollegecolognecomc"
+    "omcastcommbankcommunitycompanycomparecomputercomseccondosconstructionconsultingcontactcontractor"
+    "scookingcookingchannelcoolcoopcorsicacountrycouponcouponscoursescpacrcreditcreditcardcreditunion"
+    "cricketcrowncrscruisecruisescucuisinellacvcwcxcycymrucyouczdaburdaddancedatadatedatingdatsundayd"
+    "clkddsdedealdealerdealsdegreedeliverydelldeloittedeltademocratdentaldentistdesidesigndevdhldiamo"
+    "ndsdietdigitaldirectdirectorydiscountdiscoverdishdiydjdkdmdnpdodocsdoctordogdomainsdotdownloaddr"
+    "ivedtvdubaidunlopdupontdurbandvagdvrdzeartheatececoedekaedueducationeeegemailemerckenergyenginee"
+    "rengineeringenterprisesepsonequipmenterericssonerniesesqestateetetisalateueurovisioneuseventsexc"
+    "hangeexpertexposedexpressextraspacefagefailfairwindsfaithfamilyfanfansfarmfarmersfashionfastfede"
+    "xfeedbackferrariferrerofifiatfidelityfidofilmfinalfinancefinancialfirefirestonefirmdalefishfishi"
+    "ngfitfitnessfjfkflickrflightsflirfloristflowersflyfmfofoofoodfoodnetworkfootballfordforexforsale"
+    "forumfoundationfoxfrfreefreseniusfrlfrogansfrontdoorfrontierftrfujitsufunfundfurniturefutbolfyig"
+    "agalgallerygallogallupgamegamesgapgardengaygbgbizgdgdngegeagentgentinggeorgegfggggeeghgigiftgift"
+    "sgivesgivingglglassgleglobalglobogmgmailgmbhgmogmxgngodaddygoldgoldpointgolfgoogoodyeargooggoogl"
+    "egopgotgovgpgqgrgraingergraphicsgratisgreengripegrocerygroupgsgtguguardianguccigugeguideguitarsg"
+    "urugwgyhairhamburghangouthaushbohdfchdfcbankhealthhealthcarehelphelsinkiherehermeshgtvhiphophisa"
+    "mitsuhitachihivhkhkthmhnhockeyholdingsholidayhomedepothomegoodshomeshomesensehondahorsehospitalh"
+    "osthostinghothoteleshotelshotmailhousehowhrhsbchthuhugheshyatthyundaiibmicbciceicuidieieeeifmika"
+    "noilimimamatimdbimmoimmobilieninincindustriesinfinitiinfoinginkinstituteinsuranceinsureintintern"
+    "ationalintuitinvestmentsioipirangaiqiririshisismailiististanbulititauitvjaguarjavajcbjejeepjetzt"
+    "jewelryjiojlljmjmpjnjjojobsjoburgjotjoyjpjpmorganjprsjuegosjuniperkaufenkddikekerryhotelskerrylo"
+    "gisticskerrypropertieskfhkgkhkikiakidskimkinderkindlekitchenkiwikmknkoelnkomatsukosherkpkpmgkpnk"
+    "rkrdkredkuokgroupkwkykyotokzlalacaixalamborghinilamerlancasterlancialandlandroverlanxesslasallel"
+    "atlatinolatrobelawlawyerlblcldsleaseleclerclefraklegallegolexuslgbtlilidllifelifeinsurancelifest"
+    "ylelightinglikelillylimitedlimolincolnlindelinklipsylivelivinglkllcllploanloanslockerlocuslollon"
+    "donlottelottolovelpllplfinanciallrlsltltdltdalulundbeckluxeluxurylvlymamacysmadridmaifmaisonmake"
+    "upmanmanagementmangomapmarketmarketingmarketsmarriottmarshallsmaseratimattelmbamcmckinseymdmemed"
+    "mediameetmelbournememememorialmenmenumerckmsdmgmhmiamimicrosoftmilminimintmitmitsubishimkmlmlbml"
+    "smmmmamnmomobimobilemodamoemoimommonashmoneymonstermormonmortgagemoscowmotomotorcyclesmovmoviemp"
+    "mqmrmsmsdmtmtnmtrmumuseummusicmutualmvmwmxmymznanabnagoyanamenaturanavynbancnenecnetnetbanknetfl"
+    "ixnetworkneustarnewnewsnextnextdirectnexusnfnflngngonhkniniconikenikonninjanissannissaynlnonokia"
+    "northwesternmutualnortonnownowruznowtvnpnrnranrwnttnunycnzobiobserverofficeokinawaolayanolayangr"
+    "oupoldnavyolloomomegaoneongoniononlonlineoooopenoracleorangeorgorganicoriginsosakaotsukaottovhpa"
+    "pagepanasonicparisparspartnerspartspartypassagenspaypccwpepetpfpfizerpgphpharmacyphdphilipsphone"
+    "photophotographyphotosphysiopicspictetpicturespidpinpingpinkpioneerpizzapkplplaceplayplaystation"
+    "plumbingpluspmpnpncpohlpokerpolitiepornpostprpramericapraxipressprimeproprodproductionsprofprogr"
+    "essivepromopropertiespropertyprotectionpruprudentialpsptpubpwpwcpyqaqponquebecquestracingradiore"
+    "readrealestaterealtorrealtyrecipesredredstoneredumbrellarehabreisereisenreitreliancerenrentrenta"
+    "lsrepairreportrepublicanrestrestaurantreviewreviewsrexrothrichrichardliricohrilrioriprorocherroc"
+    "ksrodeorogersroomrsrsvprurugbyruhrrunrwrweryukyusasaarlandsafesafetysakurasalesalonsamsclubsamsu"
+    "ngsandviksandvikcoromantsanofisapsarlsassavesaxosbsbisbsscscascbschaefflerschmidtscholarshipssch"
+    "oolschuleschwarzsciencescotsdsesearchseatsecuresecurityseekselectsenerservicessevensewsexsexysfr"
+    "sgshshangrilasharpshawshellshiashikshashoesshopshoppingshoujishowshowtimesisilksinasinglessitesj"
+    "skskiskinskyskypeslslingsmsmartsmilesnsncfsosoccersocialsoftbanksoftwaresohusolarsolutionssongso"
+    "nysoyspaspacesportspotsrsrlssststadastaplesstarstatebankstatefarmstcstcgroupstockholmstoragestor"
+    "estreamstudiostudystylesusuckssuppliessupplysupportsurfsurgerysuzukisvswatchswisssxsysydneysyste"
+    "mssztabtaipeitalktaobaotargettatamotorstatartattootaxtaxitctcitdtdkteamtechtechnologyteltemasekt"
+    "ennistevatftgththdtheatertheatretiaaticketstiendatiffanytipstirestiroltjtjmaxxtjxtktkmaxxtltmtma"
+    "lltntotodaytokyotoolstoptoraytoshibatotaltourstowntoyotatoystrtradetradingtrainingtraveltravelch"
+    "anneltravelerstravelersinsurancetrusttrvtttubetuitunestushutvtvstwtzuaubankubsugukunicomuniversi"
+    "tyunouolupsusuyuzvavacationsvanavanguardvcvevegasventuresverisignverm\303\266gensberaterverm\303\266gensbera"
+    "tungversicherungvetvgviviajesvideovigvikingvillasvinvipvirginvisavisionvivavivovlaanderenvnvodka"
+    "volkswagenvolvovotevotingvotovoyagevuvueloswaleswalmartwalterwangwanggouwatchwatchesweatherweath"
+    "erchannelwebcamweberwebsiteweddingweiboweirwfwhoswhowienwikiwilliamhillwinwindowswinewinnerswmew"
+    "olterskluwerwoodsideworkworksworldwowwswtcwtfxboxxeroxxfinityxihuanxinxn--11b4c3dxn--1ck2e1bxn--"
+    "1qqw23axn--2scrj9cxn--30rr7yxn--3bst00mxn--3ds443gxn--3e0b707exn--3hcrj9cxn--3pxu8kxn--42c2d9axn"
+    "--45br5cylxn--45brj9cxn--45q11cxn--4dbrk0cexn--4gbrimxn--54b7fta0ccxn--55qw42gxn--55qx5dxn--5su3"
+    "4j936bgsgxn--5tzm5gxn--6frz82gxn--6qq986b3xlxn--80adxhksxn--80ao21axn--80aqecdr1axn--80asehdbxn-"
+    "-80aswgxn--8y0a063axn--90a3acxn--90aexn--90aisxn--9dbq2axn--9et52uxn--9krt00axn--b4w605ferdxn--b"
+    "ck1b9a5dre4cxn--c1avgxn--c2br7gxn--cck2b3bxn--cckwcxetdxn--cg4bkixn--clchc0ea0b2g2a9gcdxn--czr69"
+    "4bxn--czrs0txn--czru2dxn--d1acj3bxn--d1alfxn--e1a4cxn--eckvdtc9dxn--efvy88hxn--fct429kxn--fhbeix"
+    "n--fiq228c5hsxn--fiq64bxn--fiqs8sxn--fiqz9sxn--fjq720axn--flw351exn--fpcrj9c3dxn--fzc2c9e2cxn--f"
+    "zys8d69uvgmxn--g2xx48cxn--gckr3f0fxn--gecrj9cxn--gk3at1exn--h2breg3evexn--h2brj9cxn--h2brj9c8cxn"
+    "--hxt814exn--i1b6b1a6a2exn--imr513nxn--io0a7ixn--j1aefxn--j1amhxn--j6w193gxn--jlq480n2rgxn--jvr1"
+    "89mxn--kcrx77d1x4axn--kprw13dxn--kpry57dxn--kput3ixn--l1accxn--lgbbat1ad8jxn--mgb2ddesxn--mgb9aw"
+    "bfxn--mgba3a3ejtxn--mgba3a4f16axn--mgba3a4fraxn--mgba7c0bbn0axn--mgbaakc7dvfxn--mgbaam7a8hxn--mg"
+    "bab2bdxn--mgbah1a3hjkrdxn--mgbai9a5eva00bxn--mgbai9azgqp6jxn--mgbayh7gpaxn--mgbbh1axn--mgbbh1a71"
+    "exn--mgbc0a9azcgxn--mgbca7dzdoxn--mgbcpq6gpa1axn--mgberp4a5d4a87gxn--mgberp4a5d4arxn--mgbgu82axn"
+    "--mgbi4ecexpxn--mgbpl2fhxn--mgbqly7c0a67fbcxn--mgbqly7cvafrxn--mgbt3dhdxn--mgbtf8flxn--mgbtx2bxn"
+    "--mgbx4cd0abxn--mix082fxn--mix891fxn--mk1bu44cxn--mxtq1mxn--ngbc5azdxn--ngbe9e0axn--ngbrxxn--nnx"
+    "388axn--nodexn--nqv7fxn--nqv7fs00emaxn--nyqy26axn--o3cw4hxn--ogbpf8flxn--otu796dxn--p1acfxn--p1a"
+    "ixn--pgbs0dhxn--pssy2uxn--q7ce6axn--q9jyb4cxn--qcka1pmcxn--qxa6axn--qxamxn--rhqv96gxn--rovu88bxn"
+    "--rvc1e0am3exn--s9brj9cxn--ses554gxn--t60b56axn--tckwexn--tiq49xqyjxn--unup4yxn--vermgensberater"
+    "-ctbxn--vermgensberatung-pwbxn--vhquvxn--vuq861bxn--w4r85el8fhu5dnraxn--w4rs40lxn--wgbh1cxn--wgb"
+    "l6axn--xhq521bxn--xkc2al3hye2axn--xkc2dl3a5ee0hxn--y9a3aqxn--yfro4i67oxn--ygbi2ammxxn--zfr164bxx"
+    "xxyzyachtsyahooyamaxunyandexyeyodobashiyogayokohamayouyoutubeytyunzazapposzarazerozipzmzonezueri"
+    "chzw\316\265\316\273\316\265\317\205\320\261\320\263\320\261\320\265\320\273\320\264\320\265\321\202\320\270\320\265\321\216\320\272\320\260\321\202\320\276\320\273\320\270\320\272\320\272\320\276\320\274\320\274\320\272\320\264\320\274\320\276\320\275\320\274\320\276\321\201\320\272\320\262\320\260\320\276\320\275\320\273\320\260\320\271\320\275\320\276\321\200\320\263"
+    "\321\200\321\203\321\201\321\200\321\204\321\201\320\260\320\271\321\202\321\201\321\200\320\261\321\203\320\272\321\200\322\233\320\260\320\267\325\260\325\241\325\265\327\231\327\251\327\250\327\220\327\234\327\247\327\225\327\235\330\247\330\250\331\210\330\270\330\250\331\212\330\247\330\252\330\265\330\247\331\204\330\247\330\252\330\247\330\261\330\247\331\205\331\203\331\210"
+    "\330\247\331\204\330\247\330\261\330\257\331\206\330\247\331\204\330\250\330\255\330\261\331\212\331\206\330\247\331\204\330\254\330\262\330\247\330\246\330\261\330\247\331\204\330\263\330\271\331\210\330\257\331\212\330\251\330\247\331\204\330\263\330\271\331\210\330\257\331\212\331\207\330\247\331\204\330\263\330\271\331\210\330\257\333\214\330\251\330\247\331\204\330\263\330\271"
+    "\331\210\330\257\333\214\333\203\330\247\331\204\330\271\331\204\331\212\330\247\331\206\330\247\331\204\331\205\330\272\330\261\330\250\330\247\331\204\331\212\331\205\331\206\330\247\331\205\330\247\330\261\330\247\330\252\330\247\331\212\330\261\330\247\331\206\330\247\333\214\330\261\330\247\331\206\330\250\330\247\330\261\330\252\330\250\330\247\330\262\330\247\330\261\330\250"
+    "\331\212\330\252\331\203\330\250\332\276\330\247\330\261\330\252\330\252\331\210\331\206\330\263\330\263\331\210\330\257\330\247\331\206\330\263\331\210\330\261\331\212\330\247\330\263\331\210\330\261\331\212\330\251\330\264\330\250\331\203\330\251\330\271\330\261\330\247\331\202\330\271\330\261\330\250\330\271\331\205\330\247\331\206\331\201\331\204\330\263\330\267\331\212\331\206"
+    "\331\202\330\267\330\261\331\203\330\247\330\253\331\210\331\204\331\212\331\203\331\203\331\210\331\205\331\205\330\265\330\261\331\205\331\204\331\212\330\263\331\212\330\247\331\205\331\210\330\261\331\212\330\252\330\247\331\206\331\212\330\247\331\205\331\210\331\202\330\271\331\207\331\205\330\261\330\247\331\207\331\276\330\247\331\203\330\263\330\252\330\247\331\206\331\276"
+    "\330\247\332\251\330\263\330\252\330\247\331\206\332\200\330\247\330\261\330\252\340\244\225\340\245\211\340\244\256\340\244\250\340\245\207\340\244\237\340\244\255\340\244\276\340\244\260\340\244\244\340\244\255\340\244\276\340\244\260\340\244\244\340\244\256\340\245\215\340\244\255\340\244\276\340\244\260\340\245\213\340\244\244\340\244\270\340\244\202\340\244\227\340\244\240\340"
+    "\244\250\340\246\254\340\246\276\340\246\202\340\246\262\340\246\276\340\246\255\340\246\276\340\246\260\340\246\244\340\246\255\340\246\276\340\247\260\340\246\244\340\250\255\340\250\276\340\250\260\340\250\244\340\252\255\340\252\276\340\252\260\340\252\244\340\254\255\340\254\276\340\254\260\340\254\244\340\256\207\340\256\250\340\257\215\340\256\244\340\256\277\340\256\257\340"
+    "\256\276\340\256\207\340\256\262\340\256\231\340\257\215\340\256\225\340\257\210\340\256\232\340\256\277\340\256\231\340\257\215\340\256\225\340\256\252\340\257\215\340\256\252\340\257\202\340\256\260\340\257\215\340\260\255\340\260\276\340\260\260\340\260\244\340\261\215\340\262\255\340\262\276\340\262\260\340\262\244\340\264\255\340\264\276\340\264\260\340\264\244\340\264\202\340"
+    "\266\275\340\266\202\340\266\232\340\267\217\340\270\204\340\270\255\340\270\241\340\271\204\340\270\227\340\270\242\340\272\245\340\272\262\340\272\247\341\203\222\341\203\224\343\201\277\343\202\223\343\201\252\343\202\242\343\203\236\343\202\276\343\203\263\343\202\257\343\203\251\343\202\246\343\203\211\343\202\260\343\203\274\343\202\260\343\203\253\343\202\263\343\203\240\343"
+    "\202\271\343\203\210\343\202\242\343\202\273\343\203\274\343\203\253\343\203\225\343\202\241\343\203\203\343\202\267\343\203\247\343\203\263\343\203\235\343\202\244\343\203\263\343\203\210\344\270\226\347\225\214\344\270\255\344\277\241\344\270\255\345\233\275\344\270\255\345\234\213\344\270\255\346\226\207\347\275\221\344\272\232\351\251\254\351\200\212\344\274\201\344\270\232\344"
+    "\275\233\345\261\261\344\277\241\346\201\257\345\201\245\345\272\267\345\205\253\345\215\246\345\205\254\345\217\270\345\205\254\347\233\212\345\217\260\346\271\276\345\217\260\347\201\243\345\225\206\345\237\216\345\225\206\345\272\227\345\225\206\346\240\207\345\230\211\351\207\214\345\230\211\351\207\214\345\244\247\351\205\222\345\272\227\345\234\250\347\272\277\345\244\247\346"
+    "\213\277\345\244\251\344\270\273\346\225\231\345\250\261\344\271\220\345\256\266\351\233\273\345\271\277\344\270\234\345\276\256\345\215\232\346\205\210\345\226\204\346\210\221\347\210\261\344\275\240\346\211\213\346\234\272\346\213\233\350\201\230\346\224\277\345\212\241\346\224\277\345\272\234\346\226\260\345\212\240\345\235\241\346\226\260\351\227\273\346\227\266\345\260\232\346"
+    "\233\270\347\261\215\346\234\272\346\236\204\346\267\241\351\251\254\351\224\241\346\270\270\346\210\217\346\276\263\351\226\200\346\276\263\351\227\250\347\202\271\347\234\213\347\247\273\345\212\250\347\273\204\347\273\207\346\234\272\346\236\204\347\275\221\345\235\200\347\275\221\345\272\227\347\275\221\347\253\231\347\275\221\347\273\234\350\201\224\351\200\232\350\207\272\347"
+    "\201\243\350\260\267\346\255\214\350\264\255\347\211\251\351\200\232\350\262\251\351\233\206\345\233\242\351\233\273\350\250\212\347\233\210\347\247\221\351\243\236\345\210\251\346\265\246\351\243\237\345\223\201\351\244\220\345\216\205\351\246\231\346\240\274\351\207\214\346\213\211\351\246\231\346\270\257\353\213\267\353\204\267\353\213\267\354\273\264\354\202\274\354\204\261\355"
+    "\225\234\352\265\255drrofficialnomblogspotschaccident-investigationaccident-preventionaerobaticaeroclubaerodrom"
+    "eagentsair-surveillanceair-traffic-controlaircraftairlineairportairtrafficambulanceamusementasso"
+    "ciationballooningcaacargocertificationchampionshipchartercivilaviationconferenceconsultantcontro"
+    "lcouncilcrewdgcaeducatoremergencyengineentertainmentfederationflightfuelglidinggovernmentgroundh"
+    "andlinghangglidinghomebuiltjournaljournalistleasinglogisticsmagazinemaintenancemicrolightmodelli"
+    "ngnavigationparachutingparaglidingpassenger-associationpilotproductionrecreationrepbodyresresear"
+    "chrotorcraftscientistskydivingstudenttradertrainerunionworkinggroupoffuwucommunenekonyaaedgvogpb"
+    "begetbookonlineclerkclerkstagedetadevelopereasypaneledgecomputeencrfirewebframerhasuraloginlinem"
+    "esserlinetlifynoopnorthflankondigitaloceanonflashdriveplatform0snowflakestreamlittelebittypedrea"
+    "mvercelwebwnextgobmusicasenasature164in-addrip6irisuriurncloudns123webseite12hp2ix4limafunkfeuer"
+    "futurecmsfuturehostingfuturemailinglima-citymyspreadshoporortsinfoprivactasnconfnswntozqldtasvic"
+    "waxyppaus123websiteinterhostsolutionskuleuventransurlwebhosting0123456789abbarsycdefghijklmnopqr"
+    "stuvwxyzactivetraildsclouddyndnsfor-betterfor-morefor-somefor-thejozimmafanmyftpno-iporxselfipwe"
+    "bhopagroarchitectesassuravocatseconoloisirsoterestotourismunivacademiaboliviacienciacooperativad"
+    "emocraciadeporteecologiaeconomiaempresaindigenaindustriamedicinamovimientonaturalnombrenoticiasp"
+    "atriaplurinacionalpoliticaprofesionalpueblorevistasaludtecnologiatksattransporte9guacuadmadvagra"
+    "juananiaparecidaarqatobarueribelembhzbibbmdboavistabsbcampinagrandecampinascaxiascimcngcntcontag"
+    "emcozcricuiabacuritibadefdesdetecnempenfengespetcetifarfeiraflogfloripafndfortalfotfozfstg12geog"
+    "gfgoianiagruimbindinfjabjampajdfjoinvillejorjusleglelloglondrinamacapamaceiomanausmaringamatmore"
+    "namusnatalniteroinotntrodoosascopalmaspoappgpscpsipvhqslrecreciferepribeiraoriobrancoriopretosal"
+    "vadorsampasantamariasantoandresaobernardosaogoncasegsjcslgslzsorocabasrvtecteothetmptrdudivixvlo"
+    "gzlgwecloudsitemediatechmycloudofgsjabawdevbcgcmbnbnsonqcyknabucsxfantasyleagueftpaccessgame-ser"
+    "vermyphotosscrappingspawntwmaildnskingfirenetflowgotdnslinkyard-cloudsquare7assoa\303\251roportfingogo"
+    "uvpressexn--aroport-byawwwaxarnetbanzaidiademelementorencowayjelasticjelejenv-arubajotelulukeliw"
+    "eblinkyardmagentositeon-rancheroxaperspectaprimetelravendbreclaimscwsensiositestaticstrafficplex"
+    "trendhostingurownvaporvoorloperahcanva-appscqgxgzhahbhehihlinstantcloudjljsjxlnnmnxqhquickconnec"
+    "txjxn--od0algxzynzj\347\266\262\347\265\241artscarrdcrdfirewalledreplitfirmleadpageslpagesmypin4totapreplsupabaseo"
+    "wo001www0emm1kapp3utilities4uadobeaemcloudairkitappsairkitapps-auaivencloudalpha-myqnapcloudamaz"
+    "onawsamscomputeappchiziapplinziappspacehostedappspaceusercontentappspotauthgear-stagingauthgeara"
+    "ppsawsglobalacceleratorawsmpplbalena-devicesbarsycenterbarsyonlinebetainaboxblogdnsblogsytebloxc"
+    "msbounty-fullboutirbplacedbuiltwithdarkcafjscechirecf-ipfsciscofreakclicketcloudcloudcontrolappc"
+    "loudcontrolledcloudflare-ipfscodecodespotcustomer-ocidamnserverdatadetectdattolocaldattorelaydat"
+    "towebddns5ddnsfreeddnsgeekddnskingddnslivedev-myqnapclouddevcdnaccessodigitaloceanspacesdiscords"
+    "aysdiscordsezditchyouripdnsaliasdnsdojodnsiskinkydoesntexistdontexistdoomdnsdopaasdrayddnsdreamh"
+    "ostersdsmynasdyn-o-saurdynaliasdyndns-at-homedyndns-at-workdyndns-blogdyndns-freedyndns-homedynd"
+    "ns-ipdyndns-maildyndns-officedyndns-picsdyndns-remotedyndns-serverdyndns-webdyndns-wikidyndns-wo"
+    "rkdynnselasticbeanstalkencoreapiest-a-la-maisonest-a-la-masionest-le-patronest-mon-blogueurevenn"
+    "odefamilydsfastly-edgefastly-terrariumfastvps-serverfbsbxfirebaseappfirewall-gatewayfldrvforgebl"
+    "ocksframercanvasfreebox-osfreeboxosfreemyipfrom-akfrom-alfrom-arfrom-cafrom-ctfrom-dcfrom-defrom"
+    "-flfrom-gafrom-hifrom-iafrom-idfrom-ilfrom-infrom-ksfrom-kyfrom-mafrom-mdfrom-mifrom-mnfrom-mofr"
+    "om-msfrom-mtfrom-ncfrom-ndfrom-nefrom-nhfrom-njfrom-nmfrom-nvfrom-ohfrom-okfrom-orfrom-pafrom-pr"
+    "from-rifrom-scfrom-sdfrom-tnfrom-txfrom-utfrom-vafrom-vtfrom-wafrom-wifrom-wvfrom-wygeekgalaxyge"
+    "ntappsgentlentapisgetmyipgiizegithubusercontentgleezegoogleapisgooglecodegotpantheonhealth-carer"
+    "eformherokuappherokusslhidorahobby-sitehomelinuxhomesecuritymachomesecuritypchomeunixhosted-by-p"
+    "reviderhostedpihosteurhotelwithflightiamallamaik-serverimpertriximpertrixcdnis-a-anarchistis-a-b"
+    "loggeris-a-bookkeeperis-a-bulls-fanis-a-catereris-a-chefis-a-conservativeis-a-cpais-a-cubicle-sl"
+    "aveis-a-democratis-a-designeris-a-doctoris-a-financialadvisoris-a-geekis-a-greenis-a-guruis-a-ha"
+    "rd-workeris-a-hunteris-a-landscaperis-a-lawyeris-a-liberalis-a-libertarianis-a-llamais-a-musicia"
+    "nis-a-nascarfanis-a-nurseis-a-painteris-a-personaltraineris-a-photographeris-a-playeris-a-republ"
+    "icanis-a-rockstaris-a-socialistis-a-studentis-a-teacheris-a-techieis-a-therapistis-an-accountant"
+    "is-an-actoris-an-actressis-an-anarchistis-an-artistis-an-engineeris-an-entertaineris-certifiedis"
+    "-goneis-into-animeis-into-carsis-into-cartoonsis-into-gamesis-leetis-not-certifiedis-slickis-ube"
+    "rleetis-with-thebandisa-geekisa-hockeynutissmarterthanyoujdevcloudjoyentjpnkasserverkilatironkoz"
+    "owktistorylikes-pielikescandylinodelinodeobjectslinodeusercontentlmpmlogoiploseyouriplpuserconte"
+    "ntmassivegridmazeplaymesswithdnsmeteorappmexminiservermyactivedirectorymyasustormydattomydobissm"
+    "ydrobomyiphostmyqnapcloudmysecuritycameramyshopblocksmyshopifymytabitmythic-beastsmytuleapmyvncn"
+    "eat-urlnet-freaksnfshostnospamproxyobservableusercontenton-aptibleonfabricaonrenderonthewifioogu"
+    "yoperauniteorsitesoutsystemscloudownproviderpagefrontapppagespeedmobilizerpagexlpaywhirlpgfogpix"
+    "olinoplatter-appplaystation-cloudplesknspoint2thispostman-echoprgmrpublishproxypythonanywhereqa2"
+    "qbuserqualifioappquicksytesquipelementsrackmazeremotewdrenderreservdreserve-onlinerhcloudsaves-t"
+    "he-whalesscrysecsecuritytacticssells-for-lesssells-for-uservebbsservebeerservecounterstrikeserve"
+    "exchangeserveftpservegameservehalflifeservehttpservehumourserveircservemp3servep2pservepicsserve"
+    "quakeservesarcasmshopitsitesiiitessimple-urlsimplesitesinaappskygearappsmushcdnspace-to-rentstac"
+    "khero-networkstdlibstreamlitappstufftoreadtb-hostingteaches-yogatemp-dnstheworkpcthingdustdatato"
+    "wnnews-stagingtry-snowplowtrycloudflaretuleap-partnerstypeformunusualpersonvipsinaappvultrobject"
+    "swafaicloudwafflecellwiardwebwithgooglewithyoutubewixsitewoltlab-demoworkisboringwpdevcloudwpeng"
+    "inepoweredwphostedmailwpmucdnwritesthisblogxnbayyolasitemyforumnognomeatheklogese4metacentrummun"
+    "irealmcommunity-procosidnsdd-dnsddnssdiskussionsbereichdnshomednsupdaterdray-dnsdraydnsdyn-berli"
+    "ndyn-ip24dyn-vpndynamisches-dnsdyndns1dynvpnfruskyfuettertdasnetzgit-reposgoipg\303\274nstigbestelleng"
+    "\303\274nstigliefernhome-webserverhs-heilbronnin-berlinin-brbin-butterin-dslin-vpninternet-dnsiservsch"
+    "uleisteingeekistmeinkeymachinel-o-g-i-nlcube-serverlebtimnetzleitungsenmein-iservmein-vigormy-ga"
+    "tewaymy-routermy-vigormy-wanmyhome-serverschulplattformschulserverspdnsspeedpartnersvn-repossyno"
+    "-dssynology-diskstationsynology-dstaifun-dnstest-iservtraeumtgeradeuberspacevirtual-uservirtualu"
+    "serxn--gnstigbestellen-zvbxn--gnstigliefern-wobbssautocodecurvdenodeno-staginggatewaygithubprevi"
+    "ewiservlcllclstagelocalcertpagesr2shiftcryptostgstgstagewebhareworkerscloudapps123hjemmesideregs"
+    "ldpolsocdappsbasek12ritaipfielibpririikeunsci123miwebcomputediskstationdogadomycdwellbeingzoneko"
+    "obinybostorj123kotisivualandcloudplatformdatacenterdyh\303\244kkinenikikapsixn--hkkinen-5wauser123site"
+    "webaeroportavocatavouesccichambagrichirurgiens-dentisteschirurgiens-dentistes-en-francedediboxen"
+    "-rootexperts-comptablesfbx-osfbxosgeometre-expertgoupilegretahuissier-justicemedecinnotaireson-w"
+    "ebpharmacienportprdveterinaireynhcnpypvtcyakaaspanelmodxxtranslateusercontentdiscourseguamhraidv"
+    "secaasxn--ciqpnxn--gmq050ixn--gmqw5axn--lcvr32dxn--mk0axixn--od0aq3bxn--tn0agxn--uc0atvxn--uc0ay"
+    "4axn--wcvs22dxn--zf0avx\344\270\252\344\272\272\345\200\213\344\272\272\346\225\216\350\202\262\346\225\231\350\202\262\347\256\207\344\272\272\347\265\204\347\271\224\347\265\204\347\273\207\347\266\262\347\273\234\347\273\204\347\271\224\347\273\204\347\273\207\347\275\221\347\265\241cloudac"
+    "cessfastvpsfreesitehalfmircloudmyfastpcloudtempurlwpmudevopencraftfromizpersorel2000agrarboltero"
+    "ticaerotikahotelingatlanjogaszkonyvelolakasreklamsuliszextozsdeutazasdesaflapforteponpesidf5g6gb"
+    "iharcsdelhidrgengujaratinternetnicupbarrel-of-knowledgebarrell-of-knowledgednsupdatedvrcamdynami"
+    "c-dnsfor-ourforumzgroks-thegroks-thishere-for-moreilovecollegeknowsitallmayfirstnsupdatev-info20"
+    "38apigeeazurecontainerb-databackplaneappbanzaicloudbasicserverbeagleboardbeebytebeebyteappbigvbi"
+    "tbucketbluebiteboxfusebrowsersafetymarkcleverappsdappnodededyndefinimadruddyn53editorxedugitfh-m"
+    "uensterforgerockghostgithubgitlabhasura-apphostyhostinghzclairlolipopmo-siemensmoonscalemusician"
+    "ngroknidnodearton-acornon-k3son-riopantheonsiteprotonetpstmnqcxqotoreadthedocsresindeviceresinst"
+    "agings5ysandcatsshifteditshwspacekitstolosthingdustunispaceupliutwentevaporcloudvbrplsbxvirtuals"
+    "erverwebthingswedeploycupcake123homepage16-b32-b64-babrabruzzoagrigentoalessandriaalto-adigealto"
+    "adigeananconaandria-barletta-traniandria-trani-barlettaandriabarlettatraniandriatranibarlettaaos"
+    "taaosta-valleyaostavalleyaosteapaquilaarezzoascoli-picenoascolipicenoastiavavellinobalsanbalsan-"
+    "sudtirolbalsan-suedtirolbalsan-s\303\274dtirolbaribarletta-trani-andriabarlettatraniandriabasbasilicat"
+    "abellunobeneventobergamobiellablbolognabolzanobolzano-altoadigebozenbozen-sudtirolbozen-suedtiro"
+    "lbozen-s\303\274dtirolbresciabrindisibulsanbulsan-sudtirolbulsan-suedtirolbulsan-s\303\274dtirolcagliaricala"
+    "briacaltanissettacampaniacampidano-mediocampidanomediocampobassocarbonia-iglesiascarboniaiglesia"
+    "scarrara-massacarraramassacasertacataniacatanzarocbcecesena-forlicesena-forl\303\254cesenaforlicesenaf"
+    "orl\303\254chieticomocosenzacremonacrotonectcuneodell-ogliastradellogliastraemilia-romagnaemiliaromagn"
+    "aemrenennafcfefermoferrarafgfirenzeflorencefoggiaforli-cesenaforlicesenaforl\303\254-cesenaforl\303\254cesen"
+    "afriuli-v-giuliafriuli-ve-giuliafriuli-vegiuliafriuli-venezia-giuliafriuli-veneziagiuliafriuli-v"
+    "giuliafriuliv-giuliafriulive-giuliafriulivegiuliafriulivenezia-giuliafriuliveneziagiuliafriulivg"
+    "iuliafrosinonefvggenoagenovagoriziagrossetoibxosiglesias-carboniaiglesiascarboniailiadboxosimper"
+    "iaiserniala-spezialaquilalaspezialatinalazlaziolelecceleccoligligurialivornololodilomlombardialo"
+    "mbardylucanialuccamaceratamantovamarmarchemassa-carraramassacarraramateramedio-campidanomediocam"
+    "pidanomessinamimilanmilanomodenamolmolisemonzamonza-brianzamonza-e-della-brianzamonzabrianzamonz"
+    "aebrianzamonzaedellabrianzanaplesnapolineennovaranuoroogliastraolbia-tempioolbiatempiooristanoot"
+    "padovapaduapalermoparmapaviapcpdperugiapesaro-urbinopesarourbinopescarapipiacenzapiedmontpiemont"
+    "episapistoiapmnpopordenonepotenzapratopupugpugliapvpzraragusaravennarcreggio-calabriareggio-emil"
+    "iareggiocalabriareggioemiliargririetiriminirmrnromaromerovigosalernosarsardegnasardiniasassarisa"
+    "vonasicsiciliasicilysienasiracusasondriospsuedtirolsynclouds\303\274dtiroltataatarantotetempio-olbiate"
+    "mpioolbiateramoternitimtorinotostoscanatptrani-andria-barlettatrani-barletta-andriatraniandriaba"
+    "rlettatranibarlettaandriatrapanitrentin-sud-tiroltrentin-sudtiroltrentin-sued-tiroltrentin-suedt"
+    "iroltrentin-s\303\274d-tiroltrentin-s\303\274dtiroltrentinotrentino-a-adigetrentino-aadigetrentino-alto-adig"
+    "etrentino-altoadigetrentino-s-tiroltrentino-stiroltrentino-sud-tiroltrentino-sudtiroltrentino-su"
+    "ed-tiroltrentino-suedtiroltrentino-s\303\274d-tiroltrentino-s\303\274dtiroltrentinoa-adigetrentinoaadigetren"
+    "tinoalto-adigetrentinoaltoadigetrentinos-tiroltrentinostiroltrentinosud-tiroltrentinosudtiroltre"
+    "ntinosued-tiroltrentinosuedtiroltrentinos\303\274d-tiroltrentinos\303\274dtiroltrentinsud-tiroltrentinsudtir"
+    "oltrentinsued-tiroltrentinsuedtiroltrentins\303\274d-tiroltrentins\303\274dtiroltrentotrevisotriestetsturint"
+    "uscanyududineumbumbriaurbino-pesarourbinopesaroval-d-aostaval-daostavald-aostavaldaostavalle-aos"
+    "tavalle-d-aostavalle-daostavalleaostavalled-aostavalledaostavallee-aostevallee-d-aostevalleeaost"
+    "evalleedaostevall\303\251e-aostevall\303\251e-d-aostevall\303\251eaostevall\303\251edaostevaovaresevbvdavenvenetovenezia"
+    "veniceverbaniavercelliveronavibo-valentiavibovalentiavicenzaviterbovrvsvtvvxn--balsan-sdtirol-ns"
+    "bxn--bozen-sdtirol-2obxn--bulsan-sdtirol-nsbxn--cesena-forl-mcbxn--cesenaforl-i8axn--forl-cesena"
+    "-fcbxn--forlcesena-c8axn--sdtirol-n2axn--trentin-sd-tirol-rzbxn--trentin-sdtirol-7vbxn--trentino"
+    "-sd-tirol-c3bxn--trentino-sdtirol-szbxn--trentinosd-tirol-rzbxn--trentinosdtirol-7vbxn--trentins"
+    "d-tirol-6vbxn--trentinsdtirol-nsbxn--valle-aoste-ebbxn--valle-d-aoste-ehbxn--valleaoste-e7axn--v"
+    "alledaoste-ebbaichiakitaangryaomoribabybluebabymilkbackdropbambinabitterblushboyboyfriendbutbuys"
+    "hopcandypopcapoocatfoodchibachicappachilloutchipschowderchuciaococottecoolblogcrankycutegirldaad"
+    "ecadecidigickegoismehimefakefurfashionstorefemflierfloppyfoolfrenchkissfukuifukuokafukushimagifu"
+    "girlfriendgirlygloomygonnagreatergunmahaccahandcraftedheavyherhihohippyhiroshimahokkaidoholyhung"
+    "ryhyogoibarakiicurusishikawaitigoiwatejellybeankagawakagoshimakanagawakawaiishopkawasakikikirara"
+    "killkilokitakyushukobekochikumamotokuronlglittlestarlolipopmclolitapunklomolovepoplovesickmainmi"
+    "emiyagimiyazakimodsmondmongolianmoonaganonagasakinamastenaraniigatanikitanobushinooroitaokayamao"
+    "opsparallelparasitepecoripeeweepennepepperpermapigboatpinokopunyupupupussycatpyaraindropreadymad"
+    "esadistsagasaitamasapporoschoolbussecretsendaishigashimaneshizuokastabastrippersubsunnydaysupers"
+    "aletheshopthicktochigitokushimatonkotsutottoritoyamaunderuppervelvetverseversusvivianwakayamawat"
+    "sonweblikewhitesnowxn--0trq7p7nnxn--1ctwoxn--1lqs03nxn--1lqs71dxn--2m4a15exn--32vp30hxn--4it168d"
+    "xn--4it797kxn--4pvxsxn--5js045dxn--5rtp49cxn--5rtq34kxn--6btw5axn--6orx2rxn--7t0a264cxn--8ltr62k"
+    "xn--8pvr4uxn--c3s14mxn--d5qv7z876cxn--djrs72d6uyxn--djty4kxn--efvn9sxn--ehqz56nxn--elqq16hxn--f6"
+    "qx53axn--k7yn95exn--kbrq7oxn--klt787dxn--kltp7dxn--kltx9axn--klty5xxn--mkru45ixn--nit225kxn--nts"
+    "o0iqx3axn--ntsq17gxn--pssu33lxn--qqqt11mxn--rht27zxn--rht3dxn--rht61exn--rny31hxn--tor131oxn--ui"
+    "st22hxn--uisz3gxn--uuwu58axn--vgu402cxn--zbx025dyamagatayamaguchiyamanashizombie\344\270\211\351\207\215\344\272\254\351\203\275\344\275\220\350"
+    "\263\200\345\205\265\345\272\253\345\214\227\346\265\267\351\201\223\345\215\203\350\221\211\345\222\214\346\255\214\345\261\261\345\237\274\347\216\211\345\244\247\345\210\206\345\244\247\351\230\252\345\245\210\350\211\257\345\256\256\345\237\216\345\256\256\345\264\216\345\257\214\345\261\261\345\261\261\345\217\243\345\261\261\345\275\242\345\261\261\346\242\250\345\262\220\351"
+    "\230\234\345\262\241\345\261\261\345\262\251\346\211\213\345\263\266\346\240\271\345\272\203\345\263\266\345\276\263\345\263\266\346\204\233\345\252\233\346\204\233\347\237\245\346\226\260\346\275\237\346\235\261\344\272\254\346\240\203\346\234\250\346\262\226\347\270\204\346\273\213\350\263\200\347\206\212\346\234\254\347\237\263\345\267\235\347\245\236\345\245\210\345\267\235\347"
+    "\246\217\344\272\225\347\246\217\345\262\241\347\246\217\345\263\266\347\247\213\347\224\260\347\276\244\351\246\254\350\214\250\345\237\216\351\225\267\345\264\216\351\225\267\351\207\216\351\235\222\346\243\256\351\235\231\345\262\241\351\246\231\345\267\235\351\253\230\347\237\245\351\263\245\345\217\226\351\271\277\345\205\220\345\263\266asspharmac"
+    "ienstrabusanchungbukchungnamdaegudaejeongangwongwangjugyeongbukgyeonggigyeongnamhsincheonjejujeo"
+    "nbukjeonnamseoululsanembjcloudkazteleportbnrperstaticoycyondwebmypephlxassngrpomgplcrouterbrasil"
+    "iac66daplieddnsdnsforedgestackfilegearfilegear-aufilegear-defilegear-gbfilegear-iefilegear-jpfil"
+    "egear-sgglitchhoptoi234itslogintolohmusmcdirmcpemydsnohostnoipsoundcastsynologytcp4transipvp4yom"
+    "bojulabminisiteagricultureairairguardalabamaalaskaamberamericanamericanaamericanantiquesamerican"
+    "artandannefrankanthroanthropologyantiquesaquariumarboretumarchaeologicalarchaeologyarchitecturea"
+    "rtanddesignartcenterartdecoarteducationartgalleryartsandcraftsasmatartassassinationassisiastrono"
+    "myatlantaaustinaustraliaautomotiveaviationaxisbadajozbaghdadbahnbalebaltimorebaselbathsbauernbea"
+    "uxartsbeeldengeluidbellevuebergbauberkeleybernbilbaobillbirdartbirthplacebonnbotanicalbotanicalg"
+    "ardenbotanicgardenbotanybrandywinevalleybrasilbristolbritishbritishcolumbiabroadcastbrunelbrusse"
+    "lbruxellesbuildingburghofbusbusheycadaquescaliforniacambridgecancanadacapebretoncarriercartoonar"
+    "tcasadelamonedacastlecastrescelticchattanoogacheltenhamchesapeakebaychicagochildrenchildrenschil"
+    "drensgardenchiropracticchocolatechristiansburgcincinnaticinemacircuscivilisationcivilizationcivi"
+    "lwarclintonclockcoalcoastaldefencecodycoldwarcollectioncolonialwilliamsburgcoloradoplateaucolumb"
+    "iacolumbuscommunicationcommunicationscomputerhistorycomunica\303\247\303\265escontemporarycontemporaryartcon"
+    "ventcopenhagencorporationcorreios-e-telecomunica\303\247\303\265escorvettecostumecountryestatecountycraftscr"
+    "anbrookcreationculturalculturalcenterculturecyberdalidallasdatabaseddrdecorativeartsdelawaredelm"
+    "enhorstdenmarkdepotdetroitdinosaurdiscoverydollsdonostiadurhameastafricaeastcoasteducationalegyp"
+    "tianeisenbahnelburgelvendrellembroideryencyclopedicenglandentomologyenvironmentenvironmentalcons"
+    "ervationepilepsyessexethnologyexeterexhibitionfarmequipmentfarmsteadfieldfigueresfilateliafinear"
+    "tfineartsfinlandflandersfloridaforcefortmissoulafortworthfrancaisefrankfurtfranziskanerfreemason"
+    "ryfreiburgfribourgfrogfundaciogeelvinckgemologicalgeologygeorgiagiessenglasgorgegrandrapidsgrazg"
+    "uernseyhalloffamehandsonharvestcelebrationhawaiiheimatunduhrenhellashembygdsforbundheritagehisto"
+    "irehistoricalhistoricalsocietyhistorichouseshistorischhistorischeshistoryhistoryofsciencehorolog"
+    "yhumanitiesillustrationimageandsoundindianindianaindianapolisindianmarketintelligenceinteractive"
+    "iraqironisleofmanjamisonjeffersonjerusalemjewishjewishartjfkjournalismjudaicajudygarlandjuedisch"
+    "esjuifkaratekarikaturkoebenhavnkunstkunstsammlungkunstunddesignlaborlabourlajollalancashirelande"
+    "slanslarssonlewismillerlinzlivinghistorylocalhistorylosangeleslouvreloyalistlucerneluxembourgluz"
+    "ernl\303\244nsmadmallorcamanchestermansionmansionsmanxmarburgmaritimemaritimomarylandmarylhurstmedical"
+    "medizinhistorischesmeeresmesaverdemichiganmidatlanticmilitarymillminersminingminnesotamissilemis"
+    "soulamodernmomamonmouthmonticellomontrealmotorcyclemuenchenmuenstermulhousemunciemuseetmuseumcen"
+    "termuseumverenigingnationalnationalfirearmsnationalheritagenativeamericannaturalhistorynaturalhi"
+    "storymuseumnaturalsciencesnaturenaturhistorischesnatuurwetenschappennaumburgnavalnebraskaneuesne"
+    "whampshirenewjerseynewmexiconewportnewspapernewyorkniepcenorfolknorthnynyoceanographicoceanograp"
+    "hiqueomahaontarioopenairoregonoregontrailotagooxfordpacificpaderbornpalacepaleopalmspringspanama"
+    "pasadenaphiladelphiaphiladelphiaareaphilatelyphoenixpilotspittsburghplanetariumplantationplantsp"
+    "lazaportalportlandportlligatposts-and-telecommunicationspreservationpresidioprojectpublicpubolra"
+    "ilroadrailwayresistanceriodejaneirorochesterrockartrussiasaintlouissalemsalvadordalisalzburgsand"
+    "iegosanfranciscosantabarbarasantacruzsantafesaskatchewansatxsavannahgaschlesischesschoenbrunnsch"
+    "okoladenschweizscience-fictionscienceandhistoryscienceandindustrysciencecentersciencecentersscie"
+    "ncehistorysciencessciencesnaturellesscotlandseaportsettlementsettlerssherbrookesibenikskolesocie"
+    "tysolognesoundandvisionsouthcarolinasouthwestspysquarestadtstalbansstarnbergstatestateofdelaware"
+    "stationsteamsteiermarkstjohnstpetersburgstuttgartsuissesurgeonshallsurreysvizzeraswedentanktcmte"
+    "lekommunikationtelevisiontexastextiletimetimekeepingtopologytouchtransporttreetrolleytrusteeuhre"
+    "nulmunderseausausantiquesusartsuscountryestateuscultureusdecorativeartsusgardenushistoryushuaiau"
+    "slivinghistoryutahuvicvalleyvantaaversaillesvillagevirginiavirtualvirtuelvolkenkundewalloniewarw"
+    "ashingtondcwatch-and-clockwatchandclockwesternwestfalenwhalingwildlifewilliamsburgwindmillworksh"
+    "opxn--9dbhblg6dixn--comunicaes-v6a2oxn--correios-e-telecomunicaes-ghc29axn--h1aeghxn--lns-qlayor"
+    "kyorkshireyosemiteyouthzoologicalzoology\320\270\320\272\320\276\320\274\327\231\327\250\327\225\327\251\327\234\327\231\327\235hisadobeio-staticadobeioruntimeaka"
+    "dnsakamaiakamai-stagingakamaiedgeakamaiedge-stagingakamaihdakamaihd-stagingakamaioriginakamaiori"
+    "gin-stagingakamaizedakamaized-stagingalwaysdataappudoat-band-campatlassian-devazure-mobileazures"
+    "taticappsazurewebsitesbar0bar1bar2bitbridgeblackbaudcdnboomlabouncemebroke-itbuyshousescasacamcd"
+    "n-edgescdn77cdn77-sslchannelsdvrclickrisingcloudappcloudfrontcloudfunctionscloudjiffycloudyclust"
+    "ercryptonomicdebiandnsupdoes-itdynathomedynudynv6eating-organicedgeappedgekeyedgekey-stagingedge"
+    "suiteedgesuite-stagingelastxendofinternetfastlyfastlylbfaststacksfeste-ipflynnhostingfrom-azfrom"
+    "-cofrom-lafrom-nygets-itham-radio-ophetemlhicamhomeftphomeipin-the-bandiobbipifonykicks-asskingh"
+    "ostknx-serverkrellianmeinforummemsetmyamazemydissentmyeffectmyfritzmymediapcmypsxnhlfannow-dnsof"
+    "fice-on-theonavstackownippgafanpodzoneprivatizehealthinsuranceredirectmesaveincloudscaleforcesch"
+    "okokeksscrapper-siteseidatsells-itsenseeringserveblogserveminecraftshopselectsiteleafsrcfstatic-"
+    "accesssytest3l3p0rttailscalethruheretorprojecttsukaeruuni5vpndnsvps-hostyandexcloudalcesarvoazim"
+    "uthtlonnoticeableothercolcistrondemonhosting-clusterkhplayaaaarborteaejrieafjordagdenesakershusa"
+    "knoluoktaakrehamnalaheadjualesundalgardalstahaugaltaalvdalamliamotandasuoloandebuandoyand\303\270yarda"
+    "laremarkarendalarnaaseralaskeraskimaskoyaskvollask\303\270yasnesaudnedalnaukraaureaurlandaurskog-holan"
+    "daurskog-h\303\270landaustevollaustrheimaveroyaver\303\270ybadaddjabahcavuotnabahccavuotnabaidarbajddarbalat"
+    "balestrandballangenbalsfjordbamblebardubarumbatsfjordbearalvahkibearalv\303\241hkibeardubeiarnbergberg"
+    "enberlevagberlev\303\245gbievatbiev\303\241tbindalbirkenesbjarkoybjark\303\270ybjerkreimbjugnbodobod\303\270boknbomlobre"
+    "mangerbronnoybronnoysundbrumunddalbrynebr\303\270nn\303\270ybr\303\270nn\303\270ysundbubudejjubuskerudbyglandbykleb\303\241hca"
+    "vuotnab\303\241hccavuotnab\303\241id\303\241rb\303\241jddarb\303\241l\303\241tb\303\245d\303\245ddj\303\245b\303\245tsfjordb\303\246rumb\303\270mlocahcesuolodavvenjarga"
+    "davvenj\303\241rgadavvesiidadeatnudepdielddanuorridivtasvuodnadivttasvuotnadonnadovredrammendrangedald"
+    "robakdr\303\270bakdyroydyr\303\270yd\303\270nnaegersundeideidfjordeidsbergeidskogeidsvolleigersundelverumenebakken"
+    "gerdaletneetnedalevenassieveneseven\303\241\305\241\305\241ievje-og-hornnesfarsundfauskefedjefetfetsundfhsfinnoyfi"
+    "nn\303\270yfitjarfjalerfjellflaflakstadflatangerflekkefjordflesbergflorafloroflor\303\270fl\303\245folkebiblfollda"
+    "lfordeforsandfosnesfranafredrikstadfreifrognfrolandfrostafroyafr\303\246nafr\303\270yafuoiskufuosskofusafylk"
+    "esbiblfyresdalf\303\270rdegaivuotnagalsagamvikgangaviikagaulargausdalgiehtavuoatnagildeskalgildesk\303\245lg"
+    "iskegjemnesgjerdrumgjerstadgjesdalgjovikgj\303\270vikgloppengolgrangranegranvingratangengrimstadgrongg"
+    "ruegulenguovdageaidnug\303\241ivuotnag\303\241ls\303\241g\303\241\305\213gaviikahabmerhadselhagebostadhaldenhalsahamarhamaroyh"
+    "ammarfeastahammerfesthapmirharamhareidharstadhasvikhattfjelldalhaugesundhedmarkhemnehemneshemsed"
+    "alheradhitrahjartdalhjelmelandhobolhob\303\270lhofhokksundholholeholmestrandholtalenholt\303\245lenhonefossh"
+    "ordalandhornindalhortenhoyangerhoylandethurdalhurumhvalerhyllestadh\303\241bmerh\303\241mm\303\241rfeastah\303\241pmirh\303"
+    "\245h\303\246gebostadh\303\270nefossh\303\270yangerh\303\270ylandetibestadidrettinderoyinder\303\270yivelandivgujan-mayenjessheim"
+    "jevnakerjolsterjondaljorpelandj\303\270lsterj\303\270rpelandkafjordkarasjohkakarasjokkarlsoykarmoykarm\303\270ykau"
+    "tokeinokirkenesklabukleppkl\303\246bukommunekongsbergkongsvingerkopervikkraanghkekragerokrager\303\270kristi"
+    "ansandkristiansundkrodsheradkrokstadelvakr\303\245anghkekr\303\270dsheradkvafjordkvalsundkvamkvanangenkvines"
+    "dalkvinnheradkviteseidkvitsoykvits\303\270ykv\303\246fjordkv\303\246nangenk\303\241r\303\241\305\241johkak\303\245fjordlaakesvuemielahppil"
+    "angevaglangev\303\245glardallarviklavagislavangenleangaviikalea\305\213gaviikalebesbyleikangerleirfjordleirv"
+    "iklekaleksviklenviklerdallesjalevangerlierliernelillehammerlillesandlindaslindesneslind\303\245sloabat"
+    "loab\303\241tlodingenloppalorenskoglotenlundlunnerluroylur\303\270ylusterlyngdallyngenl\303\241hppil\303\246rdall\303\270dinge"
+    "nl\303\270renskogl\303\270tenmalatvuopmimalselvmalvikmandalmarkermarnardalmasfjordenmasoymatta-varjjatmeland"
+    "meldalmelhusmeloymel\303\270ymerakermer\303\245kermidsundmidtre-gauldalmjondalenmj\303\270ndalenmo-i-ranamoarekemo"
+    "dalenmodummoldemore-og-romsdalmosjoenmosj\303\270enmoskenesmossmosvikmo\303\245rekemuosatmuos\303\241tm\303\241latvuopmi"
+    "m\303\241tta-v\303\241rjjatm\303\245lselvm\303\245s\303\270ym\303\270re-og-romsdalnaamesjevuemienamdalseidnamsosnamsskogannannestadn"
+    "aroynarviikanarviknaustdalnavuotnanedre-eikernesnanesoddennesoddtangennessebynessetnissedalnitte"
+    "dalnord-aurdalnord-fronnord-odalnorddalnordkappnordlandnordre-landnordreisanore-og-uvdalnotodden"
+    "notteroyn\303\241vuotnan\303\245\303\245mesjevuemien\303\246r\303\270yn\303\270tter\303\270yoddaoksnesolomasvuotnaoppdaloppegardoppeg\303\245rdo"
+    "rkangerorkdalorlandorskogorstaosenosloosoyroosteroyoster\303\270yostfoldostre-totenos\303\270yrooverhallaovr"
+    "e-eikeroyeroygardenoystre-slidreporsangerporsanguporsgrunnpors\303\241\305\213guraderadoyrad\303\270yrahkkeravjura"
+    "holtraisarakkestadralingenranarandabergraumarendalenrenneburennesoyrennes\303\270yrindalringeburingeri"
+    "keringsakerrisorrissaris\303\270rrlroanrodoyrollagromsaromskogrorosrostroykenroyrvikruovatrygger\303\241hkke"
+    "r\303\241vjur\303\241isar\303\245der\303\245holtr\303\246lingenr\303\270d\303\270yr\303\270mskogr\303\270rosr\303\270str\303\270ykenr\303\270yrviksalangensalatsaltdalsa"
+    "mnangersandefjordsandnessandnessjoensandnessj\303\270ensandoysand\303\270ysarpsborgsaudasauheradselselbuselj"
+    "eseljordsfsiellaksigdalsiljansirdalskanitskanlandskaunskedsmoskedsmokorsetskienskiervaskierv\303\241sk"
+    "iptvetskjakskjervoyskjerv\303\270yskj\303\245kskodjesk\303\241nitsk\303\245nlandslattumsmolasm\303\270lasnaasesnasasnillfjords"
+    "noasasn\303\245asesn\303\245sasogndalsognesokndalsolasolundsomnasondre-landsongdalensor-aurdalsor-fronsor-od"
+    "alsor-varangersorfoldsorreisasortlandsorumspjelkavikspydebergstangestatstathellestavangerstavern"
+    "steigensteinkjerstjordalstjordalshalsenstj\303\270rdalstj\303\270rdalshalsenstokkestor-elvdalstordstordalsto"
+    "rfjordstrandstrandastrynsulasuldalsundsunndalsurnadalsvalbardsveiosvelviksykkylvens\303\241lats\303\241l\303\241ts"
+    "\303\270gnes\303\270mnas\303\270ndre-lands\303\270r-aurdals\303\270r-frons\303\270r-odals\303\270r-varangers\303\270rfolds\303\270rreisas\303\270rumtanatana"
+    "ngertelemarktingvolltinntjeldsundtjometj\303\270metokketolgatonsbergtorskentranatranbytranoytran\303\270ytro"
+    "andintrogstadtromsatromsotroms\303\270trondheimtrysiltr\303\246natr\303\270gstadtvedestrandtydaltynsettysfjordtysn"
+    "estysvartysv\303\246rt\303\270nsbergullensakerullensvangulvikunjargaunj\303\241rgautsiravaapstevadsovads\303\270vagavaga"
+    "nvagsoyvaksdalvallevangvanylvenvardovard\303\270varggatvaroyvefsnvegavegarsheiveg\303\245rsheivenneslaverdal"
+    "verranvestbyvestfoldvestnesvestre-slidrevestre-totenvestvagoyvestv\303\245g\303\270yvevelstadvfvgsvikviknavi"
+    "ndafjordvoagatvoldavossvossevangenv\303\241rgg\303\241tv\303\245ganv\303\245gs\303\270yv\303\245g\303\245v\303\246r\303\270yxn--andy-iraxn--asky-iraxn"
+    "--aurskog-hland-jnbxn--avery-yuaxn--bdddj-mrabdxn--bearalvhki-y4axn--berlevg-jxaxn--bhcavuotna-s"
+    "4axn--bhccavuotna-k7axn--bidr-5nacxn--bievt-0qaxn--bjarky-fyaxn--bjddar-ptaxn--blt-elabxn--bmlo-"
+    "graxn--bod-2naxn--brnny-wuacxn--brnnysund-m8acxn--brum-voaxn--btsfjord-9zaxn--davvenjrga-y4axn--"
+    "dnna-graxn--drbak-wuaxn--dyry-iraxn--eveni-0qa01gaxn--finny-yuaxn--fjord-lraxn--fl-ziaxn--flor-j"
+    "raxn--frde-graxn--frna-woaxn--frya-hraxn--ggaviika-8ya47hxn--gildeskl-g0axn--givuotna-8yaxn--gjv"
+    "ik-wuaxn--gls-elacxn--h-2faxn--hbmer-xqaxn--hcesuolo-7ya35bxn--hgebostad-g3axn--hmmrfeasta-s4acx"
+    "n--hnefoss-q1axn--hobl-iraxn--holtlen-hxaxn--hpmir-xqaxn--hyanger-q1axn--hylandet-54axn--indery-"
+    "fyaxn--jlster-byaxn--jrpeland-54axn--karmy-yuaxn--kfjord-iuaxn--klbu-woaxn--koluokta-7ya57hxn--k"
+    "rager-gyaxn--kranghke-b0axn--krdsherad-m8axn--krehamn-dxaxn--krjohka-hwab49jxn--ksnes-uuaxn--kvf"
+    "jord-nxaxn--kvitsy-fyaxn--kvnangen-k0axn--l-1faxn--laheadju-7yaxn--langevg-jxaxn--ldingen-q1axn-"
+    "-leagaviika-52bxn--lesund-huaxn--lgrd-poacxn--lhppi-xqaxn--linds-praxn--loabt-0qaxn--lrdal-sraxn"
+    "--lrenskog-54axn--lt-liacxn--lten-graxn--lury-iraxn--mely-iraxn--merker-kuaxn--mjndalen-64axn--m"
+    "latvuopmi-s4axn--mli-tlaxn--mlselv-iuaxn--moreke-juaxn--mosjen-eyaxn--mot-tlaxn--mre-og-romsdal-"
+    "qqbxn--msy-ula0hxn--mtta-vrjjat-k7afxn--muost-0qaxn--nmesjevuemie-tcbaxn--nry-yla5gxn--nttery-by"
+    "aexn--nvuotna-hwaxn--oppegrd-ixaxn--ostery-fyaxn--osyro-wuaxn--porsgu-sta26fxn--rady-iraxn--rdal"
+    "-poaxn--rde-ulaxn--rdy-0nabxn--rennesy-v1axn--rhkkervju-01afxn--rholt-mraxn--risa-5naxn--risr-ir"
+    "axn--rland-uuaxn--rlingen-mxaxn--rmskog-byaxn--rros-graxn--rskog-uuaxn--rst-0naxn--rsta-fraxn--r"
+    "yken-vuaxn--ryrvik-byaxn--s-1faxn--sandnessjen-ogbxn--sandy-yuaxn--seral-lraxn--sgne-graxn--skie"
+    "rv-utaxn--skjervy-v1axn--skjk-soaxn--sknit-yqaxn--sknland-fxaxn--slat-5naxn--slt-elabxn--smla-hr"
+    "axn--smna-graxn--snase-nraxn--sndre-land-0cbxn--snes-poaxn--snsa-roaxn--sr-aurdal-l8axn--sr-fron"
+    "-q1axn--sr-odal-q1axn--sr-varanger-ggbxn--srfold-byaxn--srreisa-q1axn--srum-graxn--stfold-9xaxn-"
+    "-stjrdal-s1axn--stjrdalshalsen-sqbxn--stre-toten-zcbxn--tjme-hraxn--tnsberg-q1axn--trany-yuaxn--"
+    "trgstad-r1axn--trna-woaxn--troms-zuaxn--tysvr-vraxn--unjrga-rtaxn--vads-jraxn--vard-jraxn--vegrs"
+    "hei-c0axn--vestvgy-ixa6oxn--vg-yiabxn--vgan-qoaxn--vgsy-qoa0jxn--vre-eiker-k8axn--vrggt-xqadxn--"
+    "vry-yla5gxn--yer-znaxn--ygarden-p1axn--ystre-slidre-ujb\303\241k\305\213oluokta\303\241laheadju\303\241lt\303\241\303\245fjord\303\245kreh"
+    "amn\303\245l\303\245lesund\303\245lg\303\245rd\303\245mli\303\245mot\303\245rdal\303\245s\303\245seral\303\245snes\303\270ksnes\303\270rland\303\270rskog\303\270rsta\303\270stfold\303\270stre-"
+    "toten\303\270vre-eiker\303\270yer\303\270ygarden\303\270ystre-slidre\304\215\303\241hcesuoloenterprisecloudmerseinemineshacknetgeekg"
+    "ovtiwimaorim\304\201oriparliamentxn--mori-qsahomelinkonredserviceeeroeero-stageaccesscamaltervistaamun"
+    "eblogsitebmoattachmentsboldlygoingnowherecable-modemcamdvrcdn77-securecertmgrcollegefancouchpota"
+    "tofriesduckdnsdvrdnsdynservendoftheinternetfedorainfracloudfedorapeoplefedoraprojectfreeddnsfree"
+    "desktopfrom-megame-hosthepforgehomednshttpbinis-a-bruinsfanis-a-candidateis-a-celticsfanis-a-kni"
+    "ghtis-a-linux-useris-a-patsfanis-a-soxfanis-foundis-lostis-savedis-very-badis-very-evilis-very-g"
+    "oodis-very-niceis-very-sweetmisconfusedmlbfanmozilla-iotmy-firewallmyfirewallmywirenflfanpimient"
+    "apoivronpotagerpubtlsread-booksreadmyblogsellsyourhomesmall-webstuff-4-salesweetpepperteckidstoo"
+    "lforgetunktuxfamilyufcfanwebredirectwmcloudwmflabszaptonerdpolabocodeberghlx3magnetpdnspleskprvc"
+    "yrockytranslated1337famgokgongosaidatmaugustowbabia-gorabedzinbeepbeskidybialowiezabialystokbiel"
+    "awabieszczadyboleslawiecbydgoszczbytomcieszynczeladzczestdlugolekaecommerce-shopelblagelkgdagdan"
+    "skgdyniagliwiceglogowgminagnieznogorlicegrajewogsmhomesklepilawajaworznojelenia-gorajgorakaliszk"
+    "arpaczkartuzykaszubykatowicekazimierz-dolnykepnoketrzynklodzkokobierzycekolobrzegkoninkonskowola"
+    "krakowkrasnikkutnolapyleborklecznalegnicalezajsklimanowalomzalowiczlubartowlubinlublinlukowmailm"
+    "alborkmalopolskamazowszemazurymiastamielecmielnomragowonaklonieruchomoscinowarudanysaolawaolecko"
+    "olkuszolsztynopocznoopoleostrodaostrolekaostrowiecostrowwlkppilapiszpodhalepodlasiepolkowicepomo"
+    "rskiepomorzeponiatowapowiatpoznanprochowicepruszkowprzeworskpulawyradomrawa-mazrybnikrzeszowsano"
+    "ksdscloudsejnyshoparenasklepskoczowslaskslupsksopotsossosnowiecstalowa-wolastarachowicestargards"
+    "uwalkiswidnicaswidnikswiebodzinswinoujscieszczecinszczytnoszkolatargitarnobrzegtgoryturekturysty"
+    "katychyunicloudustkawalbrzychwarmiawarszawawawwegrowwielunwloclwloclawekwodzislawwolominwrocwroc"
+    "lawzachpomorzaganzakopanezarowzgorazgorzelecownindieestislaacaacctdnstracejurrechtplosec123pagin"
+    "awebpublbelaux443clanmyddnswebspacebrendlyox123saitadygeyabashkiriabircbgcldmaildagestaneurodirg"
+    "roznykalmykiakustanailk3marinemcpremordoviamskmyjinomytisna4unalchiknovpyatigorskrasregruhosting"
+    "spbtestvladikavkazvladimirdevelopmentmigrationonporterservers123minsidabrandfhfhskfhviopsysitcou"
+    "ldbeworkomforbkommunalforbundkomvuxlanbibnaturbruksgymnpabapartienscaledbiphashbangplatformvxlho"
+    "plixgitappgitpagebyenclouderafnwkfolionetworkleluxminterenovecoreomniweopensocialplatformshsrhtt"
+    "stdiheruberxs4allconsuladoembaixadanohoprincipesaotomesellfyshopwarestorebaseabkhaziaaktyubinska"
+    "rkhangelskarmeniaashgabadazerbaijanbalashovbryanskbukharachimkenteast-kazakhstanexnetivanovojamb"
+    "ylkalugakaracolkaragandakareliakhakassiakrasnodarkurganlenugmangyshlakmurmansknavoinorth-kazakhs"
+    "tanobninskpenzapokrovsksochitashkenttermeztogliattitroitsktselinogradtulatuvavologdaknightpointe"
+    "nsintlmincomnatorangecloud611nyanoyardvvpnplusprequalifymentdllbbsbelkeptskbetter-thanon-the-web"
+    "worse-thanebizurlxn--czrw28bxn--zf0ao64a\345\225\206\346\245\255\347\266\262\350\267\257cherkassycherkasychernigovchernihivchernivts"
+    "ichernovtsycrimeadndnepropetrovskdnipropetrovskdonetskdpifivano-frankivskkharkivkharkovkhersonkh"
+    "melnitskiykhmelnytskyikievkirovogradkrymkskvkyivlugansklutsklvivmykolaivnikolaevododesaodessapol"
+    "tavarivnerovnorvsebastopolsevastopolsumyternopiluzhgorodvinnicavinnytsiavolynyaltazaporizhzhezap"
+    "orizhzhiazhitomirzhytomyrzpztconncoprohospindependent-commissionindependent-inquestindependent-i"
+    "nquiryindependent-panelindependent-reviewnhspolicepublic-inquirypymntroyal-commissionakdcdnifedf"
+    "lgolffangraphoxiais-byisaland-4-salendnhnjnsnnvnyohokplatterppointtotxutwiwvwygub0ee12raradvisor"
+    "cloud66mypetsxn--4dbgdty6cxn--5dbhl8dxn--8dbq2axn--hebda8bxn--80auxn--90azhxn--d1atxn--o1acxn--o"
+    "1achxn--12c1fe0brxn--12cfi8ixb8lxn--12co0c3b4evaxn--h3cuzk1dixn--m3ch0j3axn--o3cyx2axn--41axn--8"
+    "0aaa0cvacxn--90a1afxn--90amcxn--h1ahnxn--h1alizxn--j1adpxn--j1ael8bcraftinglocalzoneagricaltgron"
+    "darnislimatriton\320\261\320\270\320\267\320\272\321\200\321\213\320\274\320\274\320\270\321\200\320\274\321\201\320\272\321\201\320\260\320\274\320\260\321\200\320\260\321\201\320\276\321\207\320\270\321\201\320\277\320\261\321\217\320\260\320\272\320\276\320\261\321\200\320\276\320\264\320\277\321\200\321\203\320\277\321\200\327\220"
+    "\327\247\327\223\327\236\327\231\327\224\327\231\327\251\327\225\327\221\327\236\327\236\327\251\327\234\327\246\327\224\327\234\340\270\227\340\270\253\340\270\262\340\270\243\340\270\230\340\270\270\340\270\243\340\270\201\340\270\264\340\270\210\340\270\243\340\270\261\340\270\220\340\270\232\340\270\262\340\270\245\340\270\250\340\270\266\340\270\201\340\270\251\340\270\262\340"
+    "\270\255\340\270\207\340\270\204\340\271\214\340\270\201\340\270\243\340\271\200\340\270\231\340\271\207\340\270\225privatelinksthexkundencloudletsezproxyvirtualclouddfrjrruiinstances"
+    "svcappenginees-1arubait1baremetalfr-park8snl-amspl-wawscalebooksmartlabelingaf-south-1ap-east-1a"
+    "p-northeast-1ap-northeast-2ap-northeast-3ap-south-1ap-southeast-1ap-southeast-2ca-central-1compu"
+    "te-1elbeu-central-1eu-north-1eu-south-1eu-west-1eu-west-2eu-west-3me-south-1s3s3-ap-northeast-1s"
+    "3-ap-northeast-2s3-ap-south-1s3-ap-southeast-1s3-ap-southeast-2s3-ca-central-1s3-eu-central-1s3-"
+    "eu-west-1s3-eu-west-2s3-eu-west-3s3-external-1s3-fips-us-gov-west-1s3-sa-east-1s3-us-east-2s3-us"
+    "-gov-west-1s3-us-west-1s3-us-west-2s3-website-ap-northeast-1s3-website-ap-southeast-1s3-website-"
+    "ap-southeast-2s3-website-eu-west-1s3-website-sa-east-1s3-website-us-east-1s3-website-us-west-1s3"
+    "-website-us-west-2sa-east-1us-east-1us-east-2us-west-1us-west-2alphabetabuilderdev-builderstg-bu"
+    "ilderociocpocsdemoinstanceus-gov-west-1eu-1eu-2eu-3eu-4us-1us-2us-3us-4appspaasrag-cloudrag-clou"
+    "d-chjcloud-ver-jpccnsmembersnodebalanceripcaracalcustomerfentigerlynxocelotoncillaonzasphinxyali"
+    "xenapijedlonrydu2u2-localcustomdynbzzgit-pagesdaemonrssravpagetabitorderbackyardssekd1uk0stagemo"
+    "cksysdevicesdisrectestingcloud-fr1jcaisaiamaanjoasukechiryuchitafusogamagorihandahazuhekinanhiga"
+    "shiuraichinomiyainazawainuyamaisshikiiwakurakaniekariyakasugaikirakiyosukomakikonankotamihamamiy"
+    "oshinishionisshinobuoguchioharuokazakiowariasahisetoshikatsushinshiroshitarataharatakahamatobish"
+    "imatoeitogotokaitokonametoyoaketoyohashitoyokawatoyonetsushimayatomidaisenfujisatogojomehachirog"
+    "atahappouhigashinarusehonjohonjyoikawakamikoanikamiokakatagamikazunokitaakitakosakakyowamisatomi"
+    "tanemoriyoshinikahonoshiroodateogaogatasembokuyokoteyurihonjogonohehachinohehashikamihiranaihiro"
+    "sakiitayanagikuroishimisawamutsunakadomarinohejioiraseowanirokunohesannoheshichinoheshingotakkot"
+    "owadatsugarutsurutaabikoasahichonanchoseichoshichuofunabashifuttsuhanamigawaichiharaichikawainza"
+    "iisumikamagayakamogawakashiwakatorikatsuurakimitsukisarazukozakikujukurikyonanmatsudomidoriminam"
+    "ibosomobaramutsuzawanagaranagareyamanarashinonaritanodaoamishirasatoomigawaonjukuotakisakaeshimo"
+    "fusashirakoshiroishisuisodegaurasosatakotateyamatoganetohnoshotomisatourayasuyachimatayachiyoyok"
+    "aichibayokoshibahikariyotsukaidoainanhonaiikataimabariiyokamijimakihokukumakogenmasakimatsunomat"
+    "suyamanamikataniihamaozusaijoseiyoshikokuchuotobetoonuchikouwajimayawatahamaechizeneiheijiikedak"
+    "atsuyamaminamiechizenobamaohionosabaesakaitsurugawakasaashiyabuzenchikugochikuhochikujochikushin"
+    "ochikuzendazaifufukuchihakatahigashihirokawahisayamaiizukainatsukikahokasugakasuyakawarakeisenko"
+    "gakuratekurogikurumeminamimiyakomiyamamiyawakamizumakimunakatanakagawanakamanishinogataogoriokag"
+    "akiokawaokiomutaongaonojootosaigawasasagurishingushinyoshitomishonaisoedasuetachiaraitagawatakat"
+    "atohotoyotsutsuikiukihaumiusuiyamadayameyanagawayukuhashiaizubangeaizumisatoaizuwakamatsuasakawa"
+    "bandaifurudonofutabahanawahiratahironoiitateinawashiroiwakiizumizakikagamiishikaneyamakawamataki"
+    "takatakitashiobarakoorikoriyamakunimimiharumishimanamienangonishiaizunishigookumaomotegootamasam"
+    "egawashimogoshirakawashowasomasukagawataishintamakawatanagurateneiyabukiyamatoyamatsuriyanaizuyu"
+    "gawaanpachienaginangodogujohashimahichisohidahigashishirakawaibigawakakamigaharakanikasaharakasa"
+    "matsukawauekitagataminominokamomitakemizunamimotosunakatsugawaogakisakahogisekisekigaharatajimit"
+    "akayamataruitokitomikawanouchiyaotsuyoroannakachiyodafujiokahigashiagatsumaisesakiitakurakannaka"
+    "nrakatashinakawabakiryukusatsumaebashimeiwaminakaminaganoharanakanojonanmokunumataoizumioraotash"
+    "ibukawashimonitashintotakasakitamamuratatebayashitomiokatsukiyonotsumagoiuenoyoshiokaasaminamida"
+    "iwaetajimafuchufukuyamahatsukaichihigashihiroshimahongojinsekikogenkaitakuikumanokuremiharanakao"
+    "nomichiosakikamijimaotakesakaseraseranishishinichishobaratakeharaabashiriabiraaibetsuakabiraakke"
+    "shiasahikawaashibetsuashoroassabuatsumabibaibieibifukabihorobiratorichippubetsuchitoseebetsuembe"
+    "tsueniwaerimoesanesashifukagawafuranofurubirahaborohakodatehamatonbetsuhidakahigashikagurahigash"
+    "ikawahiroohokuryuhokutohonbetsuhorokanaihoronobeimakaneishikariiwamizawaiwanaikamifuranokamikawa"
+    "kamishihorokamisunagawakamoenaikayabekembuchikikonaikimobetsukitahiroshimakitamikiyosatokoshimiz"
+    "ukunneppukuriyamakuromatsunaikushirokutchanmashikematsumaemikasaminamifuranomombetsumoseushimuka"
+    "wamurorannaienakasatsunainakatombetsunanaenanporonayoronemuroniikappunikinishiokoppenoboribetsuo"
+    "bihiroobiraoketookoppeotaruotobeotofukeotoineppuoumuozorapippurankoshirebunrikubetsurishiririshi"
+    "rifujisaromasarufutsushakotansharishibechashibetsushikabeshikaoishimamakishimizushimokawashinshi"
+    "notsushintokushiranukashiraoishiriuchisobetsusunagawataikitakasutakikawatakinoueteshikagatobetsu"
+    "tohmatomakomaitomaritoyatoyakotoyotomitoyouratsubetsutsukigataurakawaurausuuryuutashinaiwakkanai"
+    "wassamuyakumoyoichiaioiakashiakoamagasakiaogakiasagoawajifukusakigoshikiharimahimejiinagawaitami"
+    "kakogawakamigorikasaikawanishimikiminamiawajinishinomiyanishiwakisandasannansasayamasayoshinonse"
+    "nshisosumototaishitakatakarazukatakasagotakinotambatatsunotoyookayabuyashiroyokayokawaamibandoch"
+    "ikuseidaigofujishirohitachinakahitachiomiyahitachiotainainashikiitakoiwamajosokamisukasamakashim"
+    "akasumigauramihomitomoriyanamegataoaraiogawaomitamaryugasakisakuragawashimodateshimotsumashirosa"
+    "tosowasuifutakahagitamatsukuritomobetonetoridetsuchiuratsukubauchiharaushikuyawarayukianamizuhak"
+    "uihakusankagakahokukanazawakawakitanakanotonanaonominonoichinotoshikasuzutsubatatsurugiuchinadaw"
+    "ajimafudaifujisawahanamakihiraizumiichinoheichinosekiiwaizumijobojikamaishikanegasakikarumaikawa"
+    "ikitakamikujikunohekuzumakimizusawamoriokaninoheofunatooshuotsuchirikuzentakatashiwashizukuishis"
+    "umitatanohatatonoyahabaayagawahigashikagawakanonjikotohiramannomarugamemitoyonaoshimasanukitadot"
+    "sutakamatsutonoshouchinomiutazuzentsujiakuneamamihiokiisenizumikanoyakawanabekinkokouyamamakuraz"
+    "akimatsumotominamitanenakatanenishinoomotesatsumasendaisootarumizuyusuiaikawaatsugiayasechigasak"
+    "iebinahadanohakonehiratsukaiseharakaiseikamakurakiyokawamatsudaminamiashigaramiuranakaininomiyao"
+    "dawaraoioisosagamiharasamukawatsukuiyamakitayokosukayugawarazamazushiakigeiseihigashitsunoinokag"
+    "amikamikitagawamotoyamamurotonaharinakamuranankokunishitosaniyodogawaochiotoyootsukisakawasukumo"
+    "susakitosatosashimizutoyotsunoumajiyasudayusuharaamakusaaraoasochoyogyokutokamiamakusakikuchimas"
+    "hikimifuneminamataminamioguninagasunishiharaogunitakamoriukiutoyamagayatsushiroayabefukuchiyamah"
+    "igashiyamaideinejoyokameokakamokitakizukumiyamakyotambakyotanabekyotangomaizuruminamiyamashiromi"
+    "yazumukonagaokakyonakagyonantanoyamazakisakyoseikatanabeujiujitawarawazukayamashinayawatainabeis"
+    "ekameyamakawagoekihokisosakikiwakomonokuwanamatsusakaminamiisemisuginabarishimasuzukatadotakitam"
+    "akitobatsuudonoureshinowataraiyokkaichifurukawahigashimatsushimaishinomakiiwanumakakudamarumorim"
+    "atsushimaminamisanrikumuratanatoriogawaraohiraonagawaosakirifusemineshibatashichikashukushikamas"
+    "hiogamashiroishitagajotaiwatometomiyawakuyawatariyamamotozaoayaebinogokasehyugakadogawakawaminam"
+    "ikijokitaurakobayashikunitomikushimamimatamiyakonojomorotsukanichinannishimeranobeokasaitoshiiba"
+    "shintomitakaharutakanabetakazakiachiagematsuananaokiazuminochikuhokuchikumachinofujimihakubahara"
+    "hirayaiidaiijimaiiyamaiizunaikusakakaruizawakawakamikisokisofukushimakitaaikikomaganekomoromatsu"
+    "kawamiasaminamiaikiminamimakiminamiminowaminowamiyadamiyotamochizukinagawanagisonakanonozawaonse"
+    "nobuseokayaomachiomiookuwaooshikaotarisakakisakusakuhoshimosuwashinanomachishiojirisuwasuzakatak"
+    "agitateshinatogakushitoguratomiuedawadayamanouchiyasakayasuokachijiwafutsugotohasamihiradoisahay"
+    "akawatanakuchinotsumatsuuraomuraosetosaikaisaseboseihishimabarashinkamigototogitsuunzenandogoseh"
+    "egurihigashiyoshinoikarugaikomakamikitayamakanmakikashibakashiharakatsuragikoryokurotakimitsuemi"
+    "yakenosegawaojioudaoyodosakuraisangoshimoichishimokitayamashinjosonitakatoritawaramototenkawaten"
+    "riudayamatokoriyamayamatotakadayamazoeyoshinoaseinetgehirnagaaganogosenitoigawaizumozakijoetsuka"
+    "riwakashiwazakiminamiuonumamitsukemuikamurakamimyokonagaokaojiyasadosanjoseiroseirousekikawataga"
+    "mitainaitochiotokamachitsubametsunanuonumayahikoyoitayuzawabeppubungoonobungotakadahasamahijihim"
+    "eshimahitakamitsuekokonoekujukunisakikususaikitaketatsukumiusukiyufuakaiwaasakuchibizenhayashima"
+    "ibarakagaminokasaokakibichuokumenankurashikimaniwamisakinaginiiminishiawakurasatoshosetouchishoo"
+    "sojatakahashitamanotsuyamawakeyakageaguniginowanginozagushikamihaebaruhiraraiheyaishigakiitomani"
+    "zenakadenakinkitadaitokitanakagusukukumejimakunigamiminamidaitomotobunagonahanakagusukunakijinna"
+    "njoogimionnashimojitaketomitaramatokashikitomigusukutonakiurasoeurumayaeseyomitanyonabaruyonagun"
+    "izamamiabenochihayaakasakadaitofujiiderahabikinohannanhigashiosakahigashisumiyoshihigashiyodogaw"
+    "ahirakataizumiotsuizumisanokadomakaizukakanankashiwarakatanokawachinaganokishiwadakumatorimatsub"
+    "araminatominohmoriguchineyagawanoseosakasayamasayamasennansettsushijonawateshimamotosuitatadaoka"
+    "tajiritakaishitakatsukitondabayashitoyonakatoyonoyaoariakearitafukudomigenkaihamatamahizenimarik"
+    "amiminekanzakikaratsukitahatakiyamakouhokukyuraginishiaritaogiouchitakutaratosuyoshinogariarakaw"
+    "aasakachichibufujiminofukayahannohanyuhasudahatogayahatoyamahigashichichibuhigashimatsuyamairuma"
+    "iwatsukikamiizumikamisatokasukabekawaguchikawajimakazokitamotokoshigayakounosukukikumagayamatsub"
+    "ushiminanomiyashiromoroyamanagatoronamegawaniizaoganoogoseokegawaomiyaranzanryokamisakadosattesh"
+    "ikishiraokasokasugitotodatokigawatokorozawatsurugashimaurawawarabiyashioyokozeyonoyoriiyoshidayo"
+    "shikawayoshimiaishogamohigashiomihikonekokakoseikotomaibaramoriyamanagahamanishiazainotogawaomih"
+    "achimanotsurittoryuohtakashimatorahimetoyosatoyasuakagigotsuhamadahigashiizumohikawahikimiizumok"
+    "akinokimasudamatsuenishinoshimaohdaokinoshimaokuizumotamayutsuwanounnanyasugiyatsukaaraiatamifuj"
+    "ifujiedafujikawafujinomiyafukuroigotembahaibarahamamatsuhigashiizuitoiwataizuizunokunikakegawaka"
+    "nnamikawanehonkawazukikugawakosaimakinoharamatsuzakiminamiizumorimachinishiizunumazuomaezakishim"
+    "adashimodasusonoyaizuashikagabatohagaichikaiiwafunekaminokawakanumakarasuyamakuroisomashikomibum"
+    "okamoteginasunasushiobaranikkonishikatanogiohtawaraoyamasanoshimotsukeshioyatakanezawatsugaujiie"
+    "utsunomiyayaitaaizumiichibaitanokainankomatsushimamatsushigemimamuginarutosanagochishishikuiwaji"
+    "kiadachiakirunoakishimaaogashimabunkyochofuedogawafussahachijohachiojihamurahigashikurumehigashi"
+    "murayamahigashiyamatohinohinodehinoharainagiitabashikatsushikakiyosekodairakoganeikokubunjikomae"
+    "kouzushimakunitachimachidameguromitakamizuhomusashimurayamamusashinonerimaogasawaraokutamaomeosh"
+    "imasetagayashibuyashinagawashinjukusuginamisumidatachikawataitotamatoshimachizukawaharakogekotou"
+    "ramisasananbusakaiminatoyazuyonagofukumitsufunahashihimiimizuinamijohanakamiichikurobenakaniikaw"
+    "anamerikawanantonyuzenoyabetairatakaokatogatonamiunazukiuozuaridaaridagawagobohashimotohirogawai"
+    "wadekamitondakiminokinokawakitayamakoyakozakozagawakudoyamakushimotonachikatsuurashirahamataijiy"
+    "uasayurafunagatahigashineiidekaminoyamamamurogawamikawamurayamanagainakayamananyonishikawaobanaz"
+    "awaoeohkuraoishidasagaesakatasakegawashiratakatakahatatendotozawatsuruokayamanobeyonezawayuzaabu"
+    "hagihikarihofuiwakunikudamatsumitounagatoshimonosekishunantabusetokuyamaubeyuudoshifuefukifujika"
+    "waguchikofujiyoshidahayakawaichikawamisatokaikofukoshukosugeminami-alpsminobunakamichinarusawani"
+    "rasakinishikatsuraoshinotabayamatsuruuenoharayamanakakoupaassiteslocalhostforgotcentraluseastasi"
+    "aeastus2westeuropewestus2fra1-dewest1-usjls-sto1jls-sto2jls-sto3freetlssslwebpaasnordeste-idcnes"
+    "osvalerv\303\245lerxn--vler-qoaheroysandeher\303\270yb\303\270xn--b-5gaxn--hery-irastagingtelerscoriginhomeq-agriw"
+    "ickmpspkonsulatkppspkwpkwpspmupoirmoumpinbpiwpsppssepuprzgwsdnskostarostwougimumumigupowuppouwuz"
+    "swifwiihwinbwioswitdwiwwsawskrwuozwzmiuwbcivpslandingspectrumentmymaileradimobytemarklayershiftn"
+    "h-servretrosnubcampaignhomeofficeaffinitylotteryglugluglugsraffleentryweeklylotteryphxann-arborc"
+    "ogdsteatonwashtenawmelschoolsscalealp1eurfr-par-1fr-par-2nl-ams-1fncs3-websitewhmcn-north-1ebclo"
+    "ud9dualstackfltusrcustcdnfr-1lon-1lon-2ny-1ny-2sg-1atlnjsricdhvmchtrparochusersfunctionsnodescn-"
+    "northwest-1vfswebview-assets"
+    ;
+
+static const PslNode PslNodes[] =
+{
+    { 0, 1, 1651, 0, 0 },
+    { 0, 1652, 0, 3, 1 },
+    { 3, 1652, 0, 4, 1 },
+    { 7, 1652, 0, 6, 1 },
+    { 13, 1652, 0, 3, 1 },
+    { 16, 1652, 0, 6, 1 },
+    { 22, 1652, 0, 6, 1 },
+    { 28, 1652, 0, 3, 1 },
+    { 31, 1652, 0, 4, 1 },
+    { 35, 1652, 0, 7, 1 },
+    { 42, 1652, 0, 8, 1 },
+    { 50, 1652, 7, 2, 1 },
+    { 52, 1659, 1, 7, 1 },
+    { 59, 1660, 0, 9, 1 },
+    { 68, 1660, 0, 10, 1 },
+    { 78, 1660, 0, 11, 1 },
+    { 89, 1660, 0, 3, 1 },
+    { 92, 1660, 0, 5, 1 },
+    { 97, 1660, 1, 2, 1 },
+    { 99, 1661, 0, 3, 1 },
+    { 102, 1661, 0, 5, 1 },
+    { 107, 1661, 8, 2, 1 },
+    { 109, 1669, 0, 3, 1 },
+    { 112, 1669, 86, 4, 1 },
+    { 116, 1755, 0, 5, 1 },
+    { 121, 1755, 5, 2, 1 },
+    { 123, 1760, 0, 3, 1 },
+    { 126, 1760, 0, 6, 1 },
+    { 132, 1760, 5, 2, 1 },
+    { 134, 1765, 0, 7, 1 },
+    { 141, 1765, 0, 6, 1 },
+    { 147, 1765, 5, 2, 1 },
+    { 149, 1770, 0, 3, 1 },
+    { 152, 1770, 0, 6, 1 },
+    { 158, 1770, 0, 8, 1 },
+    { 166, 1770, 0, 6, 1 },
+    { 172, 1770, 0, 4, 1 },
+    { 176, 1770, 7, 2, 1 },
+    { 178, 1777, 0, 9, 1 },
+    { 187, 1777, 0, 7, 1 },
+    { 194, 1777, 0, 6, 1 },
+    { 200, 1777, 0, 9, 1 },
+    { 209, 1777, 0, 8, 1 },
+    { 217, 1777, 0, 4, 1 },
+    { 221, 1777, 0, 6, 1 },
+    { 227, 1777, 0, 6, 1 },
+    { 233, 1777, 9, 2, 1 },
+    { 235, 1786, 0, 6, 1 },
+    { 241, 1786, 0, 15, 1 },
+    { 256, 1786, 0, 14, 1 },
+    { 270, 1786, 0, 4, 1 },
+    { 274, 1786, 0, 5, 1 },
+    { 279, 1786, 0, 5, 1 },
+    { 284, 1786, 0, 9, 1 },
+    { 293, 1786, 0, 9, 1 },
+    { 302, 1786, 0, 7, 1 },
+    { 309, 1786, 0, 6, 1 },
+    { 315, 1786, 0, 3, 1 },
+    { 318, 1786, 6, 2, 1 },
+    { 320, 1792, 0, 3, 1 },
+    { 323, 1792, 0, 10, 1 },
+    { 333, 1792, 28, 3, 1 },
+    { 336, 1820, 0, 5, 1 },
+    { 341, 1820, 0, 2, 1 },
+    { 343, 1820, 0, 9, 1 },
+    { 352, 1820, 14, 2, 1 },
+    { 354, 1834, 0, 4, 1 },
+    { 358, 1834, 0, 6, 1 },
+    { 364, 1834, 0, 5, 1 },
+    { 369, 1834, 0, 4, 1 },
+    { 373, 1834, 6, 4, 1 },
+    { 377, 1840, 0, 3, 1 },
+    { 380, 1840, 0, 4, 1 },
+    { 384, 1840, 1, 2, 1 },
+    { 386, 1841, 0, 4, 1 },
+    { 390, 1841, 1, 4, 1 },
+    { 394, 1842, 0, 10, 1 },
+    { 404, 1842, 18, 2, 1 },
+    { 406, 1860, 0, 7, 1 },
+    { 413, 1860, 0, 8, 1 },
+    { 421, 1860, 18, 2, 1 },
+    { 423, 1878, 0, 7, 1 },
+    { 430, 1878, 0, 4, 1 },
+    { 434, 1878, 0, 7, 1 },
+    { 441, 1878, 0, 5, 1 },
+    { 446, 1878, 0, 7, 1 },
+    { 453, 1878, 0, 6, 1 },
+    { 459, 1878, 0, 4, 1 },
+    { 463, 1878, 0, 5, 1 },
+    { 468, 1878, 0, 7, 1 },
+    { 475, 1878, 1, 2, 1 },
+    { 477, 1879, 0, 3, 1 },
+    { 480, 1879, 8, 2, 1 },
+    { 482, 1887, 0, 3, 1 },
+    { 485, 1887, 12, 2, 1 },
+    { 487, 1899, 0, 5, 1 },
+    { 492, 1899, 8, 2, 1 },
+    { 494, 1907, 0, 4, 1 },
+    { 498, 1907, 0, 5, 1 },
+    { 503, 1907, 0, 7, 1 },
+    { 510, 1907, 0, 14, 1 },
+    { 524, 1907, 0, 4, 1 },
+    { 528, 1907, 0, 4, 1 },
+    { 532, 1907, 0, 3, 1 },
+    { 535, 1907, 0, 9, 1 },
+    { 544, 1907, 0, 11, 1 },
+    { 555, 1907, 0, 8, 1 },
+    { 563, 1907, 0, 8, 1 },
+    { 571, 1907, 0, 8, 1 },
+    { 579, 1907, 0, 8, 1 },
+    { 587, 1907, 2, 10, 1 },
+    { 597, 1909, 0, 7, 1 },
+    { 604, 1909, 0, 6, 1 },
+    { 610, 1909, 10, 2, 1 },
+    { 612, 1919, 0, 3, 1 },
+    { 615, 1919, 0, 3, 1 },
+    { 618, 1919, 0, 4, 1 },
+    { 622, 1919, 0, 3, 1 },
+    { 625, 1919, 0, 3, 1 },
+    { 628, 1919, 0, 2, 2 },
+    { 630, 1919, 8, 2, 1 },
+    { 632, 1927, 0, 5, 1 },
+    { 637, 1927, 0, 6, 1 },
+    { 643, 1927, 0, 4, 1 },
+    { 647, 1927, 0, 7, 1 },
+    { 654, 1927, 0, 6, 1 },
+    { 660, 1927, 0, 4, 1 },
+    { 664, 1927, 0, 7, 1 },
+    { 671, 1927, 0, 3, 1 },
+    { 674, 1927, 1, 2, 1 },
+    { 676, 1928, 38, 2, 1 },
+    { 678, 1966, 5, 2, 1 },
+    { 680, 1971, 0, 6, 1 },
+    { 686, 1971, 5, 2, 1 },
+    { 688, 1976, 0, 5, 1 },
+    { 693, 1976, 0, 3, 1 },
+    { 696, 1976, 0, 4, 1 },
+    { 700, 1976, 0, 4, 1 },
+    { 704, 1976, 0, 5, 1 },
+    { 709, 1976, 0, 3, 1 },
+    { 712, 1976, 15, 3, 1 },
+    { 715, 1991, 21, 2, 1 },
+    { 717, 2012, 0, 5, 1 },
+    { 722, 2012, 0, 11, 1 },
+    { 733, 2012, 0, 11, 1 },
+    { 744, 2012, 0, 4, 1 },
+    { 748, 2012, 0, 9, 1 },
+    { 757, 2012, 0, 4, 1 },
+    { 761, 2012, 5, 2, 1 },
+    { 763, 2017, 0, 3, 1 },
+    { 766, 2017, 0, 3, 1 },
+    { 769, 2017, 6, 2, 1 },
+    { 771, 2023, 0, 10, 1 },
+    { 781, 2023, 41, 2, 1 },
+    { 783, 2064, 0, 5, 1 },
+    { 788, 2064, 0, 10, 1 },
+    { 798, 2064, 0, 4, 1 },
+    { 802, 2064, 0, 3, 1 },
+    { 805, 2064, 0, 4, 1 },
+    { 809, 2064, 0, 3, 1 },
+    { 812, 2064, 0, 4, 1 },
+    { 816, 2064, 0, 7, 1 },
+    { 823, 2064, 0, 5, 1 },
+    { 828, 2064, 0, 6, 1 },
+    { 834, 2064, 0, 6, 1 },
+    { 840, 2064, 0, 3, 1 },
+    { 843, 2064, 0, 8, 1 },
+    { 851, 2064, 0, 3, 1 },
+    { 854, 2064, 141, 2, 1 },
+    { 856, 2205, 0, 8, 1 },
+    { 864, 2205, 0, 11, 1 },
+    { 875, 2205, 0, 8, 1 },
+    { 883, 2205, 0, 6, 1 },
+    { 889, 2205, 0, 7, 1 },
+    { 896, 2205, 0, 8, 1 },
+    { 904, 2205, 6, 2, 1 },
+    { 906, 2211, 5, 2, 1 },
+    { 908, 2216, 0, 5, 1 },
+    { 913, 2216, 1, 8, 1 },
+    { 921, 2217, 1, 8, 1 },
+    { 929, 2218, 0, 3, 1 },
+    { 932, 2218, 0, 4, 1 },
+    { 936, 2218, 0, 2, 1 },
+    { 938, 2218, 2, 2, 1 },
+    { 940, 2220, 6, 2, 1 },
+    { 942, 2226, 7, 2, 1 },
+    { 944, 2233, 0, 3, 1 },
+    { 947, 2233, 21, 2, 1 },
+    { 949, 2254, 0, 3, 1 },
+    { 952, 2254, 0, 4, 1 },
+    { 956, 2254, 0, 3, 1 },
+    { 959, 2254, 0, 4, 1 },
+    { 963, 2254, 0, 11, 1 },
+    { 974, 2254, 0, 3, 1 },
+    { 977, 2254, 0, 6, 1 },
+    { 983, 2254, 0, 4, 1 },
+    { 987, 2254, 0, 5, 1 },
+    { 992, 2254, 0, 8, 1 },
+    { 1000, 2254, 0, 7, 1 },
+    { 1007, 2254, 0, 10, 1 },
+    { 1017, 2254, 0, 3, 1 },
+    { 1020, 2254, 0, 7, 1 },
+    { 1027, 2254, 0, 5, 1 },
+    { 1032, 2254, 0, 4, 1 },
+    { 1036, 2254, 0, 6, 1 },
+    { 1042, 2254, 0, 7, 1 },
+    { 1049, 2254, 0, 4, 1 },
+    { 1053, 2254, 1, 4, 1 },
+    { 1057, 2255, 0, 4, 1 },
+    { 1061, 2255, 0, 4, 1 },
+    { 1065, 2255, 0, 6, 1 },
+    { 1071, 2255, 0, 3, 1 },
+    { 1074, 2255, 0, 8, 1 },
+    { 1082, 2255, 0, 8, 1 },
+    { 1090, 2255, 0, 3, 1 },
+    { 1093, 2255, 0, 3, 1 },
+    { 1096, 2255, 0, 4, 1 },
+    { 1100, 2255, 0, 3, 1 },
+    { 1103, 2255, 9, 2, 1 },
+    { 1105, 2264, 1, 2, 1 },
+    { 1107, 2265, 0, 6, 1 },
+    { 1113, 2265, 0, 3, 1 },
+    { 1116, 2265, 0, 4, 1 },
+    { 1120, 2265, 1, 2, 1 },
+    { 1122, 2266, 0, 3, 1 },
+    { 1125, 2266, 0, 3, 1 },
+    { 1128, 2266, 0, 2, 1 },
+    { 1130, 2266, 13, 2, 1 },
+    { 1132, 2279, 0, 6, 1 },
+    { 1138, 2279, 0, 7, 1 },
+    { 1145, 2279, 0, 7, 1 },
+    { 1152, 2279, 0, 5, 1 },
+    { 1157, 2279, 0, 4, 1 },
+    { 1161, 2279, 0, 5, 1 },
+    { 1166, 2279, 0, 7, 1 },
+    { 1173, 2279, 0, 9, 1 },
+    { 1182, 2279, 0, 6, 1 },
+    { 1188, 2279, 0, 6, 1 },
+    { 1194, 2279, 18, 2, 1 },
+    { 1196, 2297, 0, 8, 1 },
+    { 1204, 2297, 0, 6, 1 },
+    { 1210, 2297, 0, 5, 1 },
+    { 1215, 2297, 0, 7, 1 },
+    { 1222, 2297, 0, 4, 1 },
+    { 1226, 2297, 0, 5, 1 },
+    { 1231, 2297, 0, 4, 1 },
+    { 1235, 2297, 0, 8, 1 },
+    { 1243, 2297, 1, 2, 2 },
+    { 1245, 2298, 5, 2, 1 },
+    { 1247, 2303, 0, 6, 1 },
+    { 1253, 2303, 0, 8, 1 },
+    { 1261, 2303, 0, 5, 1 },
+    { 1266, 2303, 0, 6, 1 },
+    { 1272, 2303, 0, 8, 1 },
+    { 1280, 2303, 0, 8, 1 },
+    { 1288, 2303, 27, 5, 1 },
+    { 1293, 2330, 3, 4, 1 },
+    { 1297, 2333, 0, 7, 1 },
+    { 1304, 2333, 4, 2, 1 },
+    { 1306, 2337, 50, 2, 1 },
+    { 1308, 2387, 23, 2, 1 },
+    { 1310, 2410, 0, 5, 1 },
+    { 1315, 2410, 1, 5, 1 },
+    { 1320, 2411, 0, 6, 1 },
+    { 1326, 2411, 0, 7, 1 },
+    { 1333, 2411, 0, 7, 1 },
+    { 1340, 2411, 399, 3, 1 },
+    { 1343, 2810, 0, 7, 1 },
+    { 1350, 2810, 0, 8, 1 },
+    { 1358, 2810, 3, 9, 1 },
+    { 1367, 2813, 0, 7, 1 },
+    { 1374, 2813, 0, 7, 1 },
+    { 1381, 2813, 0, 8, 1 },
+    { 1389, 2813, 0, 6, 1 },
+    { 1395, 2813, 0, 6, 1 },
+    { 1401, 2813, 0, 12, 1 },
+    { 1413, 2813, 0, 10, 1 },
+    { 1423, 2813, 0, 7, 1 },
+    { 1430, 2813, 0, 11, 1 },
+    { 1441, 2813, 0, 7, 1 },
+    { 1448, 2813, 0, 14, 1 },
+    { 1462, 2813, 2, 4, 1 },
+    { 1466, 2815, 0, 4, 1 },
+    { 1470, 2815, 0, 7, 1 },
+    { 1477, 2815, 0, 7, 1 },
+    { 1484, 2815, 0, 6, 1 },
+    { 1490, 2815, 0, 7, 1 },
+    { 1497, 2815, 0, 7, 1 },
+    { 1504, 2815, 0, 3, 1 },
+    { 1507, 2815, 7, 2, 1 },
+    { 1509, 2822, 0, 6, 1 },
+    { 1515, 2822, 0, 10, 1 },
+    { 1525, 2822, 0, 11, 1 },
+    { 1536, 2822, 0, 7, 1 },
+    { 1543, 2822, 0, 5, 1 },
+    { 1548, 2822, 0, 3, 1 },
+    { 1551, 2822, 0, 6, 1 },
+    { 1557, 2822, 0, 7, 1 },
+    { 1564, 2822, 6, 2, 1 },
+    { 1566, 2828, 0, 10, 1 },
+    { 1576, 2828, 6, 2, 1 },
+    { 1578, 2834, 4, 2, 1 },
+    { 1580, 2838, 3, 2, 1 },
+    { 1582, 2841, 12, 2, 1 },
+    { 1584, 2853, 0, 5, 1 },
+    { 1589, 2853, 0, 4, 1 },
+    { 1593, 2853, 6, 2, 1 },
+    { 1595, 2859, 0, 5, 1 },
+    { 1600, 2859, 0, 3, 1 },
+    { 1603, 2859, 0, 5, 1 },
+    { 1608, 2859, 0, 4, 1 },
+    { 1612, 2859, 0, 4, 1 },
+    { 1616, 2859, 0, 6, 1 },
+    { 1622, 2859, 0, 6, 1 },
+    { 1628, 2859, 0, 3, 1 },
+    { 1631, 2859, 0, 4, 1 },
+    { 1635, 2859, 0, 3, 1 },
+    { 1638, 2859, 73, 2, 1 },
+    { 1640, 2932, 0, 4, 1 },
+    { 1644, 2932, 0, 6, 1 },
+    { 1650, 2932, 0, 5, 1 },
+    { 1655, 2932, 0, 6, 1 },
+    { 1661, 2932, 0, 8, 1 },
+    { 1669, 2932, 0, 4, 1 },
+    { 1673, 2932, 0, 8, 1 },
+    { 1681, 2932, 0, 5, 1 },
+    { 1686, 2932, 0, 8, 1 },
+    { 1694, 2932, 0, 6, 1 },
+    { 1700, 2932, 0, 7, 1 },
+    { 1707, 2932, 0, 4, 1 },
+    { 1711, 2932, 1, 6, 1 },
+    { 1717, 2933, 23, 3, 1 },
+    { 1720, 2956, 0, 3, 1 },
+    { 1723, 2956, 0, 8, 1 },
+    { 1731, 2956, 0, 4, 1 },
+    { 1735, 2956, 1, 7, 1 },
+    { 1742, 2957, 0, 6, 1 },
+    { 1748, 2957, 0, 9, 1 },
+    { 1757, 2957, 0, 8, 1 },
+    { 1765, 2957, 0, 8, 1 },
+    { 1773, 2957, 0, 4, 1 },
+    { 1777, 2957, 0, 3, 1 },
+    { 1780, 2957, 0, 2, 1 },
+    { 1782, 2957, 8, 2, 1 },
+    { 1784, 2965, 5, 2, 1 },
+    { 1786, 2970, 0, 3, 1 },
+    { 1789, 2970, 10, 2, 1 },
+    { 1791, 2980, 0, 4, 1 },
+    { 1795, 2980, 0, 6, 1 },
+    { 1801, 2980, 0, 3, 1 },
+    { 1804, 2980, 0, 7, 1 },
+    { 1811, 2980, 0, 3, 1 },
+    { 1814, 2980, 0, 8, 1 },
+    { 1822, 2980, 0, 5, 1 },
+    { 1827, 2980, 0, 3, 1 },
+    { 1830, 2980, 0, 5, 1 },
+    { 1835, 2980, 0, 6, 1 },
+    { 1841, 2980, 0, 6, 1 },
+    { 1847, 2980, 0, 6, 1 },
+    { 1853, 2980, 0, 4, 1 },
+    { 1857, 2980, 0, 3, 1 },
+    { 1860, 2980, 10, 2, 1 },
+    { 1862, 2990, 1, 5, 1 },
+    { 1867, 2991, 0, 3, 1 },
+    { 1870, 2991, 14, 2, 1 },
+    { 1872, 3005, 0, 3, 1 },
+    { 1875, 3005, 0, 5, 1 },
+    { 1880, 3005, 1, 3, 1 },
+    { 1883, 3006, 1, 9, 1 },
+    { 1892, 3007, 10, 2, 1 },
+    { 1894, 3017, 9, 2, 1 },
+    { 1896, 3026, 0, 5, 1 },
+    { 1901, 3026, 0, 6, 1 },
+    { 1907, 3026, 0, 6, 1 },
+    { 1913, 3026, 0, 8, 1 },
+    { 1921, 3026, 0, 11, 1 },
+    { 1932, 3026, 0, 11, 1 },
+    { 1943, 3026, 0, 5, 1 },
+    { 1948, 3026, 0, 9, 1 },
+    { 1957, 3026, 0, 2, 2 },
+    { 1959, 3026, 0, 8, 1 },
+    { 1967, 3026, 0, 4, 1 },
+    { 1971, 3026, 7, 2, 1 },
+    { 1973, 3033, 0, 3, 1 },
+    { 1976, 3033, 1, 6, 1 },
+    { 1982, 3034, 8, 2, 1 },
+    { 1984, 3042, 0, 8, 1 },
+    { 1992, 3042, 9, 2, 1 },
+    { 1994, 3051, 0, 10, 1 },
+    { 2004, 3051, 1, 3, 1 },
+    { 2007, 3052, 2, 6, 1 },
+    { 2013, 3054, 0, 8, 1 },
+    { 2021, 3054, 0, 6, 1 },
+    { 2027, 3054, 0, 7, 1 },
+    { 2034, 3054, 0, 7, 1 },
+    { 2041, 3054, 0, 10, 1 },
+    { 2051, 3054, 0, 4, 1 },
+    { 2055, 3054, 0, 4, 1 },
+    { 2059, 3054, 0, 9, 1 },
+    { 2068, 3054, 1, 5, 1 },
+    { 2073, 3055, 0, 6, 1 },
+    { 2079, 3055, 0, 3, 1 },
+    { 2082, 3055, 0, 4, 1 },
+    { 2086, 3055, 1, 4, 1 },
+    { 2090, 3056, 0, 7, 1 },
+    { 2097, 3056, 0, 7, 1 },
+    { 2104, 3056, 0, 4, 1 },
+    { 2108, 3056, 0, 5, 1 },
+    { 2113, 3056, 0, 8, 1 },
+    { 2121, 3056, 0, 7, 1 },
+    { 2128, 3056, 0, 7, 1 },
+    { 2135, 3056, 11, 2, 1 },
+    { 2137, 3067, 0, 4, 1 },
+    { 2141, 3067, 0, 8, 1 },
+    { 2149, 3067, 0, 4, 1 },
+    { 2153, 3067, 0, 4, 1 },
+    { 2157, 3067, 0, 5, 1 },
+    { 2162, 3067, 0, 7, 1 },
+    { 2169, 3067, 1, 9, 1 },
+    { 2178, 3068, 0, 4, 1 },
+    { 2182, 3068, 0, 9, 1 },
+    { 2191, 3068, 0, 8, 1 },
+    { 2199, 3068, 0, 4, 1 },
+    { 2203, 3068, 0, 7, 1 },
+    { 2210, 3068, 0, 3, 1 },
+    { 2213, 3068, 0, 7, 1 },
+    { 2220, 3068, 10, 2, 1 },
+    { 2222, 3078, 0, 2, 2 },
+    { 2224, 3078, 0, 6, 1 },
+    { 2230, 3078, 0, 7, 1 },
+    { 2237, 3078, 0, 4, 1 },
+    { 2241, 3078, 0, 7, 1 },
+    { 2248, 3078, 0, 7, 1 },
+    { 2255, 3078, 0, 3, 1 },
+    { 2258, 3078, 6, 2, 1 },
+    { 2260, 3084, 0, 2, 1 },
+    { 2262, 3084, 0, 3, 1 },
+    { 2265, 3084, 0, 4, 1 },
+    { 2269, 3084, 0, 11, 1 },
+    { 2280, 3084, 0, 8, 1 },
+    { 2288, 3084, 0, 4, 1 },
+    { 2292, 3084, 0, 5, 1 },
+    { 2297, 3084, 0, 7, 1 },
+    { 2304, 3084, 0, 5, 1 },
+    { 2309, 3084, 0, 10, 1 },
+    { 2319, 3084, 0, 3, 1 },
+    { 2322, 3084, 34, 2, 1 },
+    { 2324, 3118, 0, 4, 1 },
+    { 2328, 3118, 0, 9, 1 },
+    { 2337, 3118, 0, 3, 1 },
+    { 2340, 3118, 0, 7, 1 },
+    { 2347, 3118, 0, 9, 1 },
+    { 2356, 3118, 0, 8, 1 },
+    { 2364, 3118, 0, 3, 1 },
+    { 2367, 3118, 0, 7, 1 },
+    { 2374, 3118, 0, 3, 1 },
+    { 2377, 3118, 0, 4, 1 },
+    { 2381, 3118, 0, 9, 1 },
+    { 2390, 3118, 0, 6, 1 },
+    { 2396, 3118, 0, 3, 1 },
+    { 2399, 3118, 0, 2, 1 },
+    { 2401, 3118, 0, 3, 1 },
+    { 2404, 3118, 0, 7, 1 },
+    { 2411, 3118, 0, 5, 1 },
+    { 2416, 3118, 0, 6, 1 },
+    { 2422, 3118, 0, 4, 1 },
+    { 2426, 3118, 0, 5, 1 },
+    { 2431, 3118, 0, 3, 1 },
+    { 2434, 3118, 0, 6, 1 },
+    { 2440, 3118, 0, 3, 1 },
+    { 2443, 3118, 0, 2, 1 },
+    { 2445, 3118, 0, 4, 1 },
+    { 2449, 3118, 2, 2, 1 },
+    { 2451, 3120, 1, 3, 1 },
+    { 2454, 3121, 7, 2, 1 },
+    { 2456, 3128, 0, 3, 1 },
+    { 2459, 3128, 0, 4, 1 },
+    { 2463, 3128, 0, 7, 1 },
+    { 2470, 3128, 0, 6, 1 },
+    { 2476, 3128, 0, 2, 1 },
+    { 2478, 3128, 6, 2, 1 },
+    { 2480, 3134, 0, 4, 1 },
+    { 2484, 3134, 5, 2, 1 },
+    { 2486, 3139, 6, 2, 1 },
+    { 2488, 3145, 0, 4, 1 },
+    { 2492, 3145, 0, 5, 1 },
+    { 2497, 3145, 0, 5, 1 },
+    { 2502, 3145, 0, 6, 1 },
+    { 2508, 3145, 7, 2, 1 },
+    { 2510, 3152, 0, 5, 1 },
+    { 2515, 3152, 0, 3, 1 },
+    { 2518, 3152, 0, 6, 1 },
+    { 2524, 3152, 0, 5, 1 },
+    { 2529, 3152, 0, 2, 1 },
+    { 2531, 3152, 0, 5, 1 },
+    { 2536, 3152, 0, 4, 1 },
+    { 2540, 3152, 0, 3, 1 },
+    { 2543, 3152, 0, 3, 1 },
+    { 2546, 3152, 6, 2, 1 },
+    { 2548, 3158, 0, 7, 1 },
+    { 2555, 3158, 0, 4, 1 },
+    { 2559, 3158, 0, 9, 1 },
+    { 2568, 3158, 0, 4, 1 },
+    { 2572, 3158, 0, 3, 1 },
+    { 2575, 3158, 0, 8, 1 },
+    { 2583, 3158, 3, 4, 1 },
+    { 2587, 3161, 0, 6, 1 },
+    { 2593, 3161, 0, 3, 1 },
+    { 2596, 3161, 0, 3, 1 },
+    { 2599, 3161, 0, 3, 1 },
+    { 2602, 3161, 7, 2, 1 },
+    { 2604, 3168, 0, 2, 1 },
+    { 2606, 3168, 7, 2, 1 },
+    { 2608, 3175, 0, 8, 1 },
+    { 2616, 3175, 0, 8, 1 },
+    { 2624, 3175, 0, 6, 1 },
+    { 2630, 3175, 0, 5, 1 },
+    { 2635, 3175, 0, 5, 1 },
+    { 2640, 3175, 0, 7, 1 },
+    { 2647, 3175, 1, 5, 1 },
+    { 2652, 3176, 0, 2, 1 },
+    { 2654, 3176, 10, 2, 1 },
+    { 2656, 3186, 8, 2, 1 },
+    { 2658, 3194, 0, 8, 1 },
+    { 2666, 3194, 0, 5, 1 },
+    { 2671, 3194, 0, 4, 1 },
+    { 2675, 3194, 0, 5, 1 },
+    { 2680, 3194, 0, 7, 1 },
+    { 2687, 3194, 0, 4, 1 },
+    { 2691, 3194, 0, 2, 1 },
+    { 2693, 3194, 7, 2, 1 },
+    { 2695, 3201, 0, 4, 1 },
+    { 2699, 3201, 0, 7, 1 },
+    { 2706, 3201, 0, 7, 1 },
+    { 2713, 3201, 0, 4, 1 },
+    { 2717, 3201, 0, 3, 1 },
+    { 2720, 3201, 0, 4, 1 },
+    { 2724, 3201, 0, 8, 1 },
+    { 2732, 3201, 1, 6, 1 },
+    { 2738, 3202, 0, 10, 1 },
+    { 2748, 3202, 0, 4, 1 },
+    { 2752, 3202, 0, 8, 1 },
+    { 2760, 3202, 0, 4, 1 },
+    { 2764, 3202, 0, 6, 1 },
+    { 2770, 3202, 0, 4, 1 },
+    { 2774, 3202, 0, 6, 1 },
+    { 2780, 3202, 0, 9, 1 },
+    { 2789, 3202, 0, 7, 1 },
+    { 2796, 3202, 0, 3, 1 },
+    { 2799, 3202, 40, 2, 1 },
+    { 2801, 3242, 0, 3, 1 },
+    { 2804, 3242, 0, 2, 1 },
+    { 2806, 3242, 7, 2, 1 },
+    { 2808, 3249, 0, 6, 1 },
+    { 2814, 3249, 0, 8, 1 },
+    { 2822, 3249, 0, 7, 1 },
+    { 2829, 3249, 0, 9, 1 },
+    { 2838, 3249, 0, 9, 1 },
+    { 2847, 3249, 0, 5, 1 },
+    { 2852, 3249, 0, 9, 1 },
+    { 2861, 3249, 0, 5, 1 },
+    { 2866, 3249, 0, 5, 1 },
+    { 2871, 3249, 0, 8, 1 },
+    { 2879, 3249, 11, 4, 1 },
+    { 2883, 3260, 1, 7, 1 },
+    { 2890, 3261, 0, 3, 1 },
+    { 2893, 3261, 0, 7, 1 },
+    { 2900, 3261, 0, 6, 1 },
+    { 2906, 3261, 0, 7, 1 },
+    { 2913, 3261, 0, 5, 1 },
+    { 2918, 3261, 0, 3, 1 },
+    { 2921, 3261, 6, 2, 1 },
+    { 2923, 3267, 0, 4, 1 },
+    { 2927, 3267, 17, 2, 1 },
+    { 2929, 3284, 32, 2, 1 },
+    { 2931, 3316, 0, 6, 1 },
+    { 2937, 3316, 0, 5, 1 },
+    { 2942, 3316, 0, 7, 1 },
+    { 2949, 3316, 0, 3, 1 },
+    { 2952, 3316, 0, 4, 1 },
+    { 2956, 3316, 0, 3, 1 },
+    { 2959, 3316, 0, 3, 1 },
+    { 2962, 3316, 14, 2, 1 },
+    { 2964, 3330, 3, 2, 1 },
+    { 2966, 3333, 0, 4, 1 },
+    { 2970, 3333, 0, 3, 1 },
+    { 2973, 3333, 0, 5, 1 },
+    { 2978, 3333, 8, 2, 1 },
+    { 2980, 3341, 8, 2, 1 },
+    { 2982, 3349, 0, 6, 1 },
+    { 2988, 3349, 0, 4, 1 },
+    { 2992, 3349, 0, 4, 1 },
+    { 2996, 3349, 0, 10, 1 },
+    { 3006, 3349, 46, 2, 1 },
+    { 3008, 3395, 0, 3, 1 },
+    { 3011, 3395, 0, 10, 1 },
+    { 3021, 3395, 0, 8, 1 },
+    { 3029, 3395, 21, 4, 1 },
+    { 3033, 3416, 0, 3, 1 },
+    { 3036, 3416, 0, 3, 1 },
+    { 3039, 3416, 0, 9, 1 },
+    { 3048, 3416, 0, 9, 1 },
+    { 3057, 3416, 0, 6, 1 },
+    { 3063, 3416, 1, 3, 1 },
+    { 3066, 3417, 0, 13, 1 },
+    { 3079, 3417, 0, 6, 1 },
+    { 3085, 3417, 0, 11, 1 },
+    { 3096, 3417, 72, 2, 1 },
+    { 3098, 3489, 0, 8, 1 },
+    { 3106, 3489, 6, 2, 1 },
+    { 3108, 3495, 11, 2, 1 },
+    { 3110, 3506, 0, 5, 1 },
+    { 3115, 3506, 8, 2, 1 },
+    { 3117, 3514, 0, 7, 1 },
+    { 3124, 3514, 0, 3, 1 },
+    { 3127, 3514, 0, 8, 1 },
+    { 3135, 3514, 437, 2, 1 },
+    { 3137, 3951, 0, 4, 1 },
+    { 3141, 3951, 0, 3, 1 },
+    { 3144, 3951, 0, 6, 1 },
+    { 3150, 3951, 0, 4, 1 },
+    { 3154, 3951, 0, 3, 1 },
+    { 3157, 3951, 4, 2, 1 },
+    { 3159, 3955, 0, 4, 1 },
+    { 3163, 3955, 0, 5, 1 },
+    { 3168, 3955, 0, 7, 1 },
+    { 3175, 3955, 0, 3, 1 },
+    { 3178, 3955, 0, 3, 1 },
+    { 3181, 3955, 0, 2, 2 },
+    { 3183, 3955, 0, 3, 1 },
+    { 3186, 3955, 0, 3, 1 },
+    { 3189, 3955, 8, 2, 1 },
+    { 3191, 3963, 0, 4, 1 },
+    { 3195, 3963, 0, 6, 1 },
+    { 3201, 3963, 0, 3, 1 },
+    { 3204, 3963, 0, 3, 1 },
+    { 3207, 3963, 270, 2, 1 },
+    { 3209, 4233, 0, 8, 1 },
+    { 3217, 4233, 0, 4, 1 },
+    { 3221, 4233, 0, 6, 1 },
+    { 3227, 4233, 0, 7, 1 },
+    { 3234, 4233, 0, 6, 1 },
+    { 3240, 4233, 0, 4, 1 },
+    { 3244, 4233, 9, 2, 1 },
+    { 3246, 4242, 0, 11, 1 },
+    { 3257, 4242, 0, 14, 1 },
+    { 3271, 4242, 0, 15, 1 },
+    { 3286, 4242, 0, 3, 1 },
+    { 3289, 4242, 12, 2, 1 },
+    { 3291, 4254, 0, 2, 2 },
+    { 3293, 4254, 7, 2, 1 },
+    { 3295, 4261, 0, 3, 1 },
+    { 3298, 4261, 0, 4, 1 },
+    { 3302, 4261, 0, 3, 1 },
+    { 3305, 4261, 0, 6, 1 },
+    { 3311, 4261, 0, 6, 1 },
+    { 3317, 4261, 0, 7, 1 },
+    { 3324, 4261, 0, 4, 1 },
+    { 3328, 4261, 17, 2, 1 },
+    { 3330, 4278, 4, 2, 1 },
+    { 3332, 4282, 0, 5, 1 },
+    { 3337, 4282, 0, 7, 1 },
+    { 3344, 4282, 0, 6, 1 },
+    { 3350, 4282, 6, 2, 1 },
+    { 3352, 4288, 0, 4, 1 },
+    { 3356, 4288, 0, 3, 1 },
+    { 3359, 4288, 30, 2, 1 },
+    { 3361, 4318, 2, 3, 1 },
+    { 3364, 4320, 0, 4, 1 },
+    { 3368, 4320, 0, 9, 1 },
+    { 3377, 4320, 7, 2, 1 },
+    { 3379, 4327, 4, 2, 1 },
+    { 3381, 4331, 0, 5, 1 },
+    { 3386, 4331, 8, 2, 1 },
+    { 3388, 4339, 10, 2, 1 },
+    { 3390, 4349, 0, 7, 1 },
+    { 3397, 4349, 0, 11, 1 },
+    { 3408, 4349, 0, 5, 1 },
+    { 3413, 4349, 0, 9, 1 },
+    { 3422, 4349, 0, 6, 1 },
+    { 3428, 4349, 1, 4, 1 },
+    { 3432, 4350, 0, 9, 1 },
+    { 3441, 4350, 0, 7, 1 },
+    { 3448, 4350, 0, 7, 1 },
+    { 3455, 4350, 0, 3, 1 },
+    { 3458, 4350, 0, 6, 1 },
+    { 3464, 4350, 0, 7, 1 },
+    { 3471, 4350, 0, 3, 1 },
+    { 3474, 4350, 0, 6, 1 },
+    { 3480, 4350, 5, 2, 1 },
+    { 3482, 4355, 7, 2, 1 },
+    { 3484, 4362, 0, 3, 1 },
+    { 3487, 4362, 0, 5, 1 },
+    { 3492, 4362, 0, 7, 1 },
+    { 3499, 4362, 0, 6, 1 },
+    { 3505, 4362, 0, 5, 1 },
+    { 3510, 4362, 0, 4, 1 },
+    { 3514, 4362, 0, 5, 1 },
+    { 3519, 4362, 0, 4, 1 },
+    { 3523, 4362, 2, 2, 1 },
+    { 3525, 4364, 0, 4, 1 },
+    { 3529, 4364, 0, 4, 1 },
+    { 3533, 4364, 0, 13, 1 },
+    { 3546, 4364, 0, 9, 1 },
+    { 3555, 4364, 0, 8, 1 },
+    { 3563, 4364, 0, 4, 1 },
+    { 3567, 4364, 0, 5, 1 },
+    { 3572, 4364, 0, 7, 1 },
+    { 3579, 4364, 0, 4, 1 },
+    { 3583, 4364, 0, 7, 1 },
+    { 3590, 4364, 0, 5, 1 },
+    { 3595, 4364, 3, 4, 1 },
+    { 3599, 4367, 0, 5, 1 },
+    { 3604, 4367, 1, 4, 1 },
+    { 3608, 4368, 0, 6, 1 },
+    { 3614, 4368, 15, 2, 1 },
+    { 3616, 4383, 0, 3, 1 },
+    { 3619, 4383, 0, 3, 1 },
+    { 3622, 4383, 0, 4, 1 },
+    { 3626, 4383, 0, 5, 1 },
+    { 3631, 4383, 0, 6, 1 },
+    { 3637, 4383, 0, 5, 1 },
+    { 3642, 4383, 1, 3, 1 },
+    { 3645, 4384, 0, 6, 1 },
+    { 3651, 4384, 0, 5, 1 },
+    { 3656, 4384, 0, 5, 1 },
+    { 3661, 4384, 0, 4, 1 },
+    { 3665, 4384, 0, 3, 1 },
+    { 3668, 4384, 0, 12, 1 },
+    { 3680, 4384, 5, 2, 1 },
+    { 3682, 4389, 10, 2, 1 },
+    { 3684, 4399, 2, 2, 1 },
+    { 3686, 4401, 0, 3, 1 },
+    { 3689, 4401, 0, 4, 1 },
+    { 3693, 4401, 2, 2, 1 },
+    { 3695, 4403, 0, 8, 1 },
+    { 3703, 4403, 0, 4, 1 },
+    { 3707, 4403, 0, 6, 1 },
+    { 3713, 4403, 9, 2, 1 },
+    { 3715, 4412, 9, 2, 1 },
+    { 3717, 4421, 6, 2, 1 },
+    { 3719, 4427, 0, 5, 1 },
+    { 3724, 4427, 0, 6, 1 },
+    { 3730, 4427, 0, 4, 1 },
+    { 3734, 4427, 0, 6, 1 },
+    { 3740, 4427, 0, 6, 1 },
+    { 3746, 4427, 0, 3, 1 },
+    { 3749, 4427, 1, 10, 1 },
+    { 3759, 4428, 0, 5, 1 },
+    { 3764, 4428, 0, 3, 1 },
+    { 3767, 4428, 0, 6, 1 },
+    { 3773, 4428, 0, 9, 1 },
+    { 3782, 4428, 0, 7, 1 },
+    { 3789, 4428, 0, 8, 1 },
+    { 3797, 4428, 0, 9, 1 },
+    { 3806, 4428, 0, 8, 1 },
+    { 3814, 4428, 0, 6, 1 },
+    { 3820, 4428, 0, 3, 1 },
+    { 3823, 4428, 2, 2, 1 },
+    { 3825, 4430, 0, 8, 1 },
+    { 3833, 4430, 5, 2, 1 },
+    { 3835, 4435, 43, 2, 1 },
+    { 3837, 4478, 0, 3, 1 },
+    { 3840, 4478, 1, 5, 1 },
+    { 3845, 4479, 0, 4, 1 },
+    { 3849, 4479, 0, 9, 1 },
+    { 3858, 4479, 0, 4, 1 },
+    { 3862, 4479, 0, 8, 1 },
+    { 3870, 4479, 0, 3, 1 },
+    { 3873, 4479, 1, 4, 1 },
+    { 3877, 4480, 0, 8, 1 },
+    { 3885, 4480, 9, 2, 1 },
+    { 3887, 4489, 0, 2, 1 },
+    { 3889, 4489, 0, 5, 1 },
+    { 3894, 4489, 0, 9, 1 },
+    { 3903, 4489, 0, 3, 1 },
+    { 3906, 4489, 0, 4, 1 },
+    { 3910, 4489, 0, 4, 1 },
+    { 3914, 4489, 0, 3, 1 },
+    { 3917, 4489, 0, 10, 1 },
+    { 3927, 4489, 8, 2, 1 },
+    { 3929, 4497, 7, 2, 1 },
+    { 3931, 4504, 0, 3, 1 },
+    { 3934, 4504, 0, 3, 1 },
+    { 3937, 4504, 0, 2, 2 },
+    { 3939, 4504, 0, 3, 1 },
+    { 3942, 4504, 4, 2, 1 },
+    { 3944, 4508, 5, 2, 1 },
+    { 3946, 4513, 2, 4, 1 },
+    { 3950, 4515, 0, 6, 1 },
+    { 3956, 4515, 0, 4, 1 },
+    { 3960, 4515, 0, 3, 1 },
+    { 3963, 4515, 0, 3, 1 },
+    { 3966, 4515, 0, 3, 1 },
+    { 3969, 4515, 0, 6, 1 },
+    { 3975, 4515, 0, 5, 1 },
+    { 3980, 4515, 0, 7, 1 },
+    { 3987, 4515, 0, 6, 1 },
+    { 3993, 4515, 0, 8, 1 },
+    { 4001, 4515, 0, 6, 1 },
+    { 4007, 4515, 0, 4, 1 },
+    { 4011, 4515, 0, 11, 1 },
+    { 4022, 4515, 0, 3, 1 },
+    { 4025, 4515, 0, 5, 1 },
+    { 4030, 4515, 1, 2, 1 },
+    { 4032, 4516, 0, 2, 1 },
+    { 4034, 4516, 2, 2, 1 },
+    { 4036, 4518, 7, 2, 1 },
+    { 4038, 4525, 0, 3, 1 },
+    { 4041, 4525, 4, 2, 1 },
+    { 4043, 4529, 0, 3, 1 },
+    { 4046, 4529, 0, 3, 1 },
+    { 4049, 4529, 7, 2, 1 },
+    { 4051, 4536, 551, 6, 1 },
+    { 4057, 5087, 0, 5, 1 },
+    { 4062, 5087, 0, 6, 1 },
+    { 4068, 5087, 14, 2, 1 },
+    { 4070, 5101, 11, 2, 1 },
+    { 4072, 5112, 6, 2, 1 },
+    { 4074, 5118, 9, 2, 1 },
+    { 4076, 5127, 8, 2, 1 },
+    { 4078, 5135, 17, 2, 1 },
+    { 4080, 5152, 0, 3, 1 },
+    { 4083, 5152, 0, 6, 1 },
+    { 4089, 5152, 2, 4, 1 },
+    { 4093, 5154, 0, 6, 1 },
+    { 4099, 5154, 0, 4, 1 },
+    { 4103, 5154, 0, 3, 1 },
+    { 4106, 5154, 2, 2, 1 },
+    { 4108, 5156, 0, 2, 1 },
+    { 4110, 5156, 0, 3, 1 },
+    { 4113, 5156, 165, 3, 1 },
+    { 4116, 5321, 0, 7, 1 },
+    { 4123, 5321, 0, 7, 1 },
+    { 4130, 5321, 5, 7, 1 },
+    { 4137, 5326, 0, 7, 1 },
+    { 4144, 5326, 0, 3, 1 },
+    { 4147, 5326, 1, 4, 1 },
+    { 4151, 5327, 0, 4, 1 },
+    { 4155, 5327, 0, 10, 1 },
+    { 4165, 5327, 0, 5, 1 },
+    { 4170, 5327, 10, 2, 1 },
+    { 4172, 5337, 0, 3, 1 },
+    { 4175, 5337, 15, 2, 1 },
+    { 4177, 5352, 0, 3, 1 },
+    { 4180, 5352, 0, 3, 1 },
+    { 4183, 5352, 14, 2, 1 },
+    { 4185, 5366, 0, 4, 1 },
+    { 4189, 5366, 0, 4, 1 },
+    { 4193, 5366, 0, 5, 1 },
+    { 4198, 5366, 0, 5, 1 },
+    { 4203, 5366, 0, 6, 1 },
+    { 4209, 5366, 0, 6, 1 },
+    { 4215, 5366, 10, 2, 1 },
+    { 4217, 5376, 896, 2, 1 },
+    { 4219, 6272, 0, 5, 1 },
+    { 4224, 6272, 0, 18, 1 },
+    { 4242, 6272, 0, 6, 1 },
+    { 4248, 6272, 0, 3, 1 },
+    { 4251, 6272, 0, 6, 1 },
+    { 4257, 6272, 0, 5, 1 },
+    { 4262, 6272, 0, 2, 2 },
+    { 4264, 6272, 7, 2, 1 },
+    { 4266, 6279, 0, 3, 1 },
+    { 4269, 6279, 0, 3, 1 },
+    { 4272, 6279, 0, 3, 1 },
+    { 4275, 6279, 4, 2, 1 },
+    { 4277, 6283, 0, 3, 1 },
+    { 4280, 6283, 17, 2, 1 },
+    { 4282, 6300, 0, 3, 1 },
+    { 4285, 6300, 0, 8, 1 },
+    { 4293, 6300, 0, 6, 1 },
+    { 4299, 6300, 0, 7, 1 },
+    { 4306, 6300, 0, 6, 1 },
+    { 4312, 6300, 0, 11, 1 },
+    { 4323, 6300, 0, 7, 1 },
+    { 4330, 6300, 0, 4, 1 },
+    { 4334, 6300, 9, 2, 1 },
+    { 4336, 6309, 0, 5, 1 },
+    { 4341, 6309, 3, 3, 1 },
+    { 4344, 6312, 0, 3, 1 },
+    { 4347, 6312, 0, 5, 1 },
+    { 4352, 6312, 0, 3, 1 },
+    { 4355, 6312, 3, 6, 1 },
+    { 4361, 6315, 0, 3, 1 },
+    { 4364, 6315, 0, 4, 1 },
+    { 4368, 6315, 0, 6, 1 },
+    { 4374, 6315, 1, 6, 1 },
+    { 4380, 6316, 114, 3, 1 },
+    { 4383, 6430, 0, 7, 1 },
+    { 4390, 6430, 0, 7, 1 },
+    { 4397, 6430, 0, 5, 1 },
+    { 4402, 6430, 0, 6, 1 },
+    { 4408, 6430, 0, 3, 1 },
+    { 4411, 6430, 1, 3, 1 },
+    { 4414, 6431, 11, 2, 1 },
+    { 4416, 6442, 9, 4, 1 },
+    { 4420, 6451, 0, 9, 1 },
+    { 4429, 6451, 0, 5, 1 },
+    { 4434, 6451, 0, 4, 1 },
+    { 4438, 6451, 0, 8, 1 },
+    { 4446, 6451, 0, 5, 1 },
+    { 4451, 6451, 1, 5, 1 },
+    { 4456, 6452, 0, 9, 1 },
+    { 4465, 6452, 0, 3, 1 },
+    { 4468, 6452, 0, 4, 1 },
+    { 4472, 6452, 8, 2, 1 },
+    { 4474, 6460, 0, 3, 1 },
+    { 4477, 6460, 3, 2, 1 },
+    { 4479, 6463, 0, 6, 1 },
+    { 4485, 6463, 0, 2, 2 },
+    { 4487, 6463, 8, 2, 1 },
+    { 4489, 6471, 0, 8, 1 },
+    { 4497, 6471, 0, 3, 1 },
+    { 4500, 6471, 0, 7, 1 },
+    { 4507, 6471, 0, 5, 1 },
+    { 4512, 6471, 0, 5, 1 },
+    { 4517, 6471, 0, 11, 1 },
+    { 4528, 6471, 1, 6, 1 },
+    { 4534, 6472, 0, 6, 1 },
+    { 4540, 6472, 0, 4, 1 },
+    { 4544, 6472, 0, 6, 1 },
+    { 4550, 6472, 1, 8, 1 },
+    { 4558, 6473, 0, 3, 1 },
+    { 4561, 6473, 0, 3, 1 },
+    { 4564, 6473, 0, 4, 1 },
+    { 4568, 6473, 0, 4, 1 },
+    { 4572, 6473, 0, 7, 1 },
+    { 4579, 6473, 0, 5, 1 },
+    { 4584, 6473, 14, 2, 1 },
+    { 4586, 6487, 179, 2, 1 },
+    { 4588, 6666, 1, 5, 1 },
+    { 4593, 6667, 0, 4, 1 },
+    { 4597, 6667, 0, 11, 1 },
+    { 4608, 6667, 0, 8, 1 },
+    { 4616, 6667, 0, 4, 1 },
+    { 4620, 6667, 2, 2, 1 },
+    { 4622, 6669, 5, 2, 1 },
+    { 4624, 6674, 0, 3, 1 },
+    { 4627, 6674, 0, 4, 1 },
+    { 4631, 6674, 0, 5, 1 },
+    { 4636, 6674, 0, 7, 1 },
+    { 4643, 6674, 1, 4, 1 },
+    { 4647, 6675, 0, 4, 1 },
+    { 4651, 6675, 13, 2, 1 },
+    { 4653, 6688, 0, 9, 1 },
+    { 4662, 6688, 0, 5, 1 },
+    { 4667, 6688, 0, 5, 1 },
+    { 4672, 6688, 0, 5, 1 },
+    { 4677, 6688, 14, 3, 1 },
+    { 4680, 6702, 0, 4, 1 },
+    { 4684, 6702, 0, 11, 1 },
+    { 4695, 6702, 0, 4, 1 },
+    { 4699, 6702, 0, 11, 1 },
+    { 4710, 6702, 0, 5, 1 },
+    { 4715, 6702, 0, 10, 1 },
+    { 4725, 6702, 0, 8, 1 },
+    { 4733, 6702, 0, 10, 1 },
+    { 4743, 6702, 0, 3, 1 },
+    { 4746, 6702, 0, 10, 1 },
+    { 4756, 6702, 7, 2, 1 },
+    { 4758, 6709, 10, 2, 1 },
+    { 4760, 6719, 1, 3, 1 },
+    { 4763, 6720, 8, 2, 1 },
+    { 4765, 6728, 0, 3, 1 },
+    { 4768, 6728, 7, 2, 1 },
+    { 4770, 6735, 9, 2, 1 },
+    { 4772, 6744, 0, 4, 1 },
+    { 4776, 6744, 0, 6, 1 },
+    { 4782, 6744, 0, 5, 1 },
+    { 4787, 6744, 0, 6, 1 },
+    { 4793, 6744, 0, 5, 1 },
+    { 4798, 6744, 4, 2, 1 },
+    { 4800, 6748, 0, 4, 1 },
+    { 4804, 6748, 0, 10, 1 },
+    { 4814, 6748, 0, 7, 1 },
+    { 4821, 6748, 0, 6, 1 },
+    { 4827, 6748, 0, 7, 1 },
+    { 4834, 6748, 0, 3, 1 },
+    { 4837, 6748, 0, 8, 1 },
+    { 4845, 6748, 0, 11, 1 },
+    { 4856, 6748, 0, 5, 1 },
+    { 4861, 6748, 0, 5, 1 },
+    { 4866, 6748, 0, 6, 1 },
+    { 4872, 6748, 0, 4, 1 },
+    { 4876, 6748, 0, 8, 1 },
+    { 4884, 6748, 0, 3, 1 },
+    { 4887, 6748, 0, 4, 1 },
+    { 4891, 6748, 0, 7, 1 },
+    { 4898, 6748, 0, 6, 1 },
+    { 4904, 6748, 0, 6, 1 },
+    { 4910, 6748, 0, 10, 1 },
+    { 4920, 6748, 0, 4, 1 },
+    { 4924, 6748, 0, 10, 1 },
+    { 4934, 6748, 1, 6, 1 },
+    { 4940, 6749, 0, 7, 1 },
+    { 4947, 6749, 0, 7, 1 },
+    { 4954, 6749, 0, 4, 1 },
+    { 4958, 6749, 0, 9, 1 },
+    { 4967, 6749, 0, 5, 1 },
+    { 4972, 6749, 0, 3, 1 },
+    { 4975, 6749, 0, 3, 1 },
+    { 4978, 6749, 1, 3, 1 },
+    { 4981, 6750, 15, 2, 1 },
+    { 4983, 6765, 0, 6, 1 },
+    { 4989, 6765, 3, 5, 1 },
+    { 4994, 6768, 0, 5, 1 },
+    { 4999, 6768, 0, 6, 1 },
+    { 5005, 6768, 0, 4, 1 },
+    { 5009, 6768, 10, 2, 1 },
+    { 5011, 6778, 0, 4, 1 },
+    { 5015, 6778, 40, 2, 1 },
+    { 5017, 6818, 0, 5, 1 },
+    { 5022, 6818, 0, 4, 1 },
+    { 5026, 6818, 10, 3, 1 },
+    { 5029, 6828, 7, 2, 1 },
+    { 5031, 6835, 0, 3, 1 },
+    { 5034, 6835, 0, 6, 1 },
+    { 5040, 6835, 8, 2, 1 },
+    { 5042, 6843, 0, 8, 1 },
+    { 5050, 6843, 0, 4, 1 },
+    { 5054, 6843, 0, 6, 1 },
+    { 5060, 6843, 0, 6, 1 },
+    { 5066, 6843, 0, 4, 1 },
+    { 5070, 6843, 0, 5, 1 },
+    { 5075, 6843, 0, 8, 1 },
+    { 5083, 6843, 0, 7, 1 },
+    { 5090, 6843, 0, 7, 1 },
+    { 5097, 6843, 0, 15, 1 },
+    { 5112, 6843, 0, 6, 1 },
+    { 5118, 6843, 0, 3, 1 },
+    { 5121, 6843, 0, 4, 1 },
+    { 5125, 6843, 0, 3, 1 },
+    { 5128, 6843, 0, 4, 1 },
+    { 5132, 6843, 0, 4, 1 },
+    { 5136, 6843, 5, 2, 1 },
+    { 5138, 6848, 0, 3, 1 },
+    { 5141, 6848, 0, 3, 1 },
+    { 5144, 6848, 5, 2, 1 },
+    { 5146, 6853, 0, 3, 1 },
+    { 5149, 6853, 0, 3, 1 },
+    { 5152, 6853, 0, 10, 1 },
+    { 5162, 6853, 0, 7, 1 },
+    { 5169, 6853, 0, 12, 1 },
+    { 5181, 6853, 0, 6, 1 },
+    { 5187, 6853, 0, 6, 1 },
+    { 5193, 6853, 0, 7, 1 },
+    { 5200, 6853, 1, 7, 1 },
+    { 5207, 6854, 2, 4, 1 },
+    { 5211, 6856, 8, 2, 1 },
+    { 5213, 6864, 47, 2, 1 },
+    { 5215, 6911, 0, 6, 1 },
+    { 5221, 6911, 0, 4, 1 },
+    { 5225, 6911, 0, 6, 1 },
+    { 5231, 6911, 0, 8, 1 },
+    { 5239, 6911, 0, 4, 1 },
+    { 5243, 6911, 0, 6, 1 },
+    { 5249, 6911, 0, 5, 1 },
+    { 5254, 6911, 1, 8, 1 },
+    { 5262, 6912, 0, 5, 1 },
+    { 5267, 6912, 0, 3, 1 },
+    { 5270, 6912, 0, 3, 1 },
+    { 5273, 6912, 0, 4, 1 },
+    { 5277, 6912, 0, 3, 1 },
+    { 5280, 6912, 8, 2, 1 },
+    { 5282, 6920, 11, 2, 1 },
+    { 5284, 6931, 0, 9, 1 },
+    { 5293, 6931, 0, 5, 1 },
+    { 5298, 6931, 0, 4, 1 },
+    { 5302, 6931, 0, 5, 1 },
+    { 5307, 6931, 0, 4, 1 },
+    { 5311, 6931, 0, 7, 1 },
+    { 5318, 6931, 0, 5, 1 },
+    { 5323, 6931, 3, 4, 1 },
+    { 5327, 6934, 0, 8, 1 },
+    { 5335, 6934, 0, 6, 1 },
+    { 5341, 6934, 0, 4, 1 },
+    { 5345, 6934, 0, 8, 1 },
+    { 5353, 6934, 3, 2, 1 },
+    { 5355, 6937, 0, 4, 1 },
+    { 5359, 6937, 0, 4, 1 },
+    { 5363, 6937, 0, 7, 1 },
+    { 5370, 6937, 17, 4, 1 },
+    { 5374, 6954, 0, 2, 1 },
+    { 5376, 6954, 1, 2, 1 },
+    { 5378, 6955, 0, 3, 1 },
+    { 5381, 6955, 0, 4, 1 },
+    { 5385, 6955, 0, 3, 1 },
+    { 5388, 6955, 0, 5, 1 },
+    { 5393, 6955, 5, 2, 1 },
+    { 5395, 6960, 0, 5, 1 },
+    { 5400, 6960, 0, 2, 1 },
+    { 5402, 6960, 0, 5, 1 },
+    { 5407, 6960, 0, 5, 1 },
+    { 5412, 6960, 8, 2, 1 },
+    { 5414, 6968, 0, 4, 1 },
+    { 5418, 6968, 7, 2, 1 },
+    { 5420, 6975, 0, 6, 1 },
+    { 5426, 6975, 0, 6, 1 },
+    { 5432, 6975, 0, 8, 1 },
+    { 5440, 6975, 0, 8, 1 },
+    { 5448, 6975, 0, 4, 1 },
+    { 5452, 6975, 0, 5, 1 },
+    { 5457, 6975, 1, 9, 1 },
+    { 5466, 6976, 0, 4, 1 },
+    { 5470, 6976, 0, 4, 1 },
+    { 5474, 6976, 0, 3, 1 },
+    { 5477, 6976, 0, 3, 1 },
+    { 5480, 6976, 3, 5, 1 },
+    { 5485, 6979, 0, 5, 1 },
+    { 5490, 6979, 0, 4, 1 },
+    { 5494, 6979, 0, 2, 1 },
+    { 5496, 6979, 0, 3, 1 },
+    { 5499, 6979, 8, 2, 1 },
+    { 5501, 6987, 12, 2, 1 },
+    { 5503, 6999, 0, 5, 1 },
+    { 5508, 6999, 0, 7, 1 },
+    { 5515, 6999, 0, 4, 1 },
+    { 5519, 6999, 0, 9, 1 },
+    { 5528, 6999, 0, 9, 1 },
+    { 5537, 6999, 0, 3, 1 },
+    { 5540, 6999, 0, 8, 1 },
+    { 5548, 6999, 0, 9, 1 },
+    { 5557, 6999, 0, 7, 1 },
+    { 5564, 6999, 3, 5, 1 },
+    { 5569, 7002, 0, 6, 1 },
+    { 5575, 7002, 0, 6, 1 },
+    { 5581, 7002, 0, 5, 1 },
+    { 5586, 7002, 0, 5, 1 },
+    { 5591, 7002, 52, 2, 1 },
+    { 5593, 7054, 0, 5, 1 },
+    { 5598, 7054, 0, 8, 1 },
+    { 5606, 7054, 0, 6, 1 },
+    { 5612, 7054, 1, 7, 1 },
+    { 5619, 7055, 0, 4, 1 },
+    { 5623, 7055, 0, 7, 1 },
+    { 5630, 7055, 0, 6, 1 },
+    { 5636, 7055, 5, 2, 1 },
+    { 5638, 7060, 0, 6, 1 },
+    { 5644, 7060, 0, 5, 1 },
+    { 5649, 7060, 1, 2, 1 },
+    { 5651, 7061, 6, 2, 1 },
+    { 5653, 7067, 0, 6, 1 },
+    { 5659, 7067, 1, 7, 1 },
+    { 5666, 7068, 3, 2, 1 },
+    { 5668, 7071, 0, 3, 1 },
+    { 5671, 7071, 0, 6, 1 },
+    { 5677, 7071, 0, 4, 1 },
+    { 5681, 7071, 0, 6, 1 },
+    { 5687, 7071, 0, 6, 1 },
+    { 5693, 7071, 0, 10, 1 },
+    { 5703, 7071, 0, 5, 1 },
+    { 5708, 7071, 0, 6, 1 },
+    { 5714, 7071, 0, 3, 1 },
+    { 5717, 7071, 0, 4, 1 },
+    { 5721, 7071, 3, 2, 1 },
+    { 5723, 7074, 0, 3, 1 },
+    { 5726, 7074, 1, 2, 1 },
+    { 5728, 7075, 0, 3, 1 },
+    { 5731, 7075, 2, 4, 1 },
+    { 5735, 7077, 0, 4, 1 },
+    { 5739, 7077, 1, 10, 1 },
+    { 5749, 7078, 0, 3, 1 },
+    { 5752, 7078, 0, 7, 1 },
+    { 5759, 7078, 0, 6, 1 },
+    { 5765, 7078, 0, 4, 1 },
+    { 5769, 7078, 1, 2, 1 },
+    { 5771, 7079, 0, 2, 1 },
+    { 5773, 7079, 9, 2, 1 },
+    { 5775, 7088, 0, 3, 1 },
+    { 5778, 7088, 0, 7, 1 },
+    { 5785, 7088, 0, 7, 1 },
+    { 5792, 7088, 0, 4, 1 },
+    { 5796, 7088, 0, 7, 1 },
+    { 5803, 7088, 0, 6, 1 },
+    { 5809, 7088, 0, 7, 1 },
+    { 5816, 7088, 0, 4, 1 },
+    { 5820, 7088, 0, 5, 1 },
+    { 5825, 7088, 0, 5, 1 },
+    { 5830, 7088, 15, 2, 1 },
+    { 5832, 7103, 0, 6, 1 },
+    { 5838, 7103, 0, 3, 1 },
+    { 5841, 7103, 0, 2, 1 },
+    { 5843, 7103, 0, 6, 1 },
+    { 5849, 7103, 1, 2, 1 },
+    { 5851, 7104, 8, 2, 1 },
+    { 5853, 7112, 0, 5, 1 },
+    { 5858, 7112, 14, 2, 1 },
+    { 5860, 7126, 12, 2, 1 },
+    { 5862, 7138, 1, 5, 1 },
+    { 5867, 7139, 0, 5, 1 },
+    { 5872, 7139, 0, 5, 1 },
+    { 5877, 7139, 2, 3, 1 },
+    { 5880, 7141, 0, 5, 1 },
+    { 5885, 7141, 0, 7, 1 },
+    { 5892, 7141, 0, 5, 1 },
+    { 5897, 7141, 0, 5, 1 },
+    { 5902, 7141, 0, 4, 1 },
+    { 5906, 7141, 0, 6, 1 },
+    { 5912, 7141, 0, 4, 1 },
+    { 5916, 7141, 22, 2, 1 },
+    { 5918, 7163, 1, 5, 1 },
+    { 5923, 7164, 0, 7, 1 },
+    { 5930, 7164, 0, 8, 1 },
+    { 5938, 7164, 0, 6, 1 },
+    { 5944, 7164, 0, 13, 1 },
+    { 5957, 7164, 0, 9, 1 },
+    { 5966, 7164, 0, 18, 1 },
+    { 5984, 7164, 0, 5, 1 },
+    { 5989, 7164, 0, 3, 1 },
+    { 5992, 7164, 17, 2, 1 },
+    { 5994, 7181, 0, 4, 1 },
+    { 5998, 7181, 0, 3, 1 },
+    { 6001, 7181, 0, 5, 1 },
+    { 6006, 7181, 0, 5, 1 },
+    { 6011, 7181, 4, 2, 1 },
+    { 6013, 7185, 0, 3, 1 },
+    { 6016, 7185, 18, 2, 1 },
+    { 6018, 7203, 12, 2, 1 },
+    { 6020, 7215, 83, 2, 1 },
+    { 6022, 7298, 0, 5, 1 },
+    { 6027, 7298, 0, 3, 1 },
+    { 6030, 7298, 9, 2, 1 },
+    { 6032, 7307, 23, 2, 1 },
+    { 6034, 7330, 0, 6, 1 },
+    { 6040, 7330, 0, 10, 1 },
+    { 6050, 7330, 0, 3, 1 },
+    { 6053, 7330, 0, 3, 1 },
+    { 6056, 7330, 0, 3, 1 },
+    { 6059, 7330, 73, 2, 1 },
+    { 6061, 7403, 6, 2, 1 },
+    { 6063, 7409, 4, 2, 1 },
+    { 6065, 7413, 0, 2, 1 },
+    { 6067, 7413, 0, 9, 1 },
+    { 6076, 7413, 0, 4, 1 },
+    { 6080, 7413, 0, 8, 1 },
+    { 6088, 7413, 8, 2, 1 },
+    { 6090, 7421, 20, 2, 1 },
+    { 6092, 7441, 0, 5, 1 },
+    { 6097, 7441, 0, 8, 1 },
+    { 6105, 7441, 0, 8, 1 },
+    { 6113, 7441, 0, 17, 1 },
+    { 6130, 7441, 0, 18, 1 },
+    { 6148, 7441, 0, 12, 1 },
+    { 6160, 7441, 0, 3, 1 },
+    { 6163, 7441, 1, 2, 1 },
+    { 6165, 7442, 5, 2, 1 },
+    { 6167, 7447, 0, 6, 1 },
+    { 6173, 7447, 0, 5, 1 },
+    { 6178, 7447, 0, 3, 1 },
+    { 6181, 7447, 0, 6, 1 },
+    { 6187, 7447, 0, 6, 1 },
+    { 6193, 7447, 0, 3, 1 },
+    { 6196, 7447, 0, 3, 1 },
+    { 6199, 7447, 0, 6, 1 },
+    { 6205, 7447, 0, 4, 1 },
+    { 6209, 7447, 0, 6, 1 },
+    { 6215, 7447, 0, 4, 1 },
+    { 6219, 7447, 0, 4, 1 },
+    { 6223, 7447, 0, 10, 1 },
+    { 6233, 7447, 13, 2, 1 },
+    { 6235, 7460, 0, 5, 1 },
+    { 6240, 7460, 0, 10, 1 },
+    { 6250, 7460, 0, 5, 1 },
+    { 6255, 7460, 0, 4, 1 },
+    { 6259, 7460, 0, 6, 1 },
+    { 6265, 7460, 0, 4, 1 },
+    { 6269, 7460, 0, 6, 1 },
+    { 6275, 7460, 8, 2, 1 },
+    { 6277, 7468, 0, 6, 1 },
+    { 6283, 7468, 0, 5, 1 },
+    { 6288, 7468, 0, 7, 1 },
+    { 6295, 7468, 0, 6, 1 },
+    { 6301, 7468, 0, 4, 1 },
+    { 6305, 7468, 0, 7, 1 },
+    { 6312, 7468, 0, 5, 1 },
+    { 6317, 7468, 0, 7, 1 },
+    { 6324, 7468, 0, 7, 1 },
+    { 6331, 7468, 0, 14, 1 },
+    { 6345, 7468, 0, 6, 1 },
+    { 6351, 7468, 0, 5, 1 },
+    { 6356, 7468, 1, 7, 1 },
+    { 6363, 7469, 0, 7, 1 },
+    { 6370, 7469, 0, 5, 1 },
+    { 6375, 7469, 0, 4, 1 },
+    { 6379, 7469, 2, 2, 1 },
+    { 6381, 7471, 0, 7, 1 },
+    { 6388, 7471, 0, 4, 1 },
+    { 6392, 7471, 1, 4, 1 },
+    { 6396, 7472, 0, 11, 1 },
+    { 6407, 7472, 0, 3, 1 },
+    { 6410, 7472, 0, 7, 1 },
+    { 6417, 7472, 0, 4, 1 },
+    { 6421, 7472, 0, 7, 1 },
+    { 6428, 7472, 0, 3, 1 },
+    { 6431, 7472, 0, 13, 1 },
+    { 6444, 7472, 0, 8, 1 },
+    { 6452, 7472, 0, 4, 1 },
+    { 6456, 7472, 0, 5, 1 },
+    { 6461, 7472, 0, 5, 1 },
+    { 6466, 7472, 0, 3, 1 },
+    { 6469, 7472, 9, 2, 1 },
+    { 6471, 7481, 0, 3, 1 },
+    { 6474, 7481, 0, 3, 1 },
+    { 6477, 7481, 0, 4, 1 },
+    { 6481, 7481, 0, 5, 1 },
+    { 6486, 7481, 0, 7, 1 },
+    { 6493, 7481, 0, 6, 1 },
+    { 6499, 7481, 0, 3, 1 },
+    { 6502, 7481, 0, 11, 1 },
+    { 6513, 7481, 0, 11, 1 },
+    { 6524, 7481, 0, 11, 1 },
+    { 6535, 7481, 0, 11, 1 },
+    { 6546, 7481, 0, 10, 1 },
+    { 6556, 7481, 0, 11, 1 },
+    { 6567, 7481, 0, 11, 1 },
+    { 6578, 7481, 0, 12, 1 },
+    { 6590, 7481, 0, 11, 1 },
+    { 6601, 7481, 0, 10, 1 },
+    { 6611, 7481, 0, 11, 1 },
+    { 6622, 7481, 0, 12, 1 },
+    { 6634, 7481, 0, 11, 1 },
+    { 6645, 7481, 0, 10, 1 },
+    { 6655, 7481, 4, 12, 1 },
+    { 6667, 7485, 0, 10, 1 },
+    { 6677, 7485, 0, 14, 1 },
+    { 6691, 7485, 0, 11, 1 },
+    { 6702, 7485, 0, 10, 1 },
+    { 6712, 7485, 0, 17, 1 },
+    { 6729, 7485, 0, 10, 1 },
+    { 6739, 7485, 0, 11, 1 },
+    { 6750, 7485, 0, 14, 1 },
+    { 6764, 7485, 0, 12, 1 },
+    { 6776, 7485, 0, 11, 1 },
+    { 6787, 7485, 0, 14, 1 },
+    { 6801, 7485, 0, 12, 1 },
+    { 6813, 7485, 0, 10, 1 },
+    { 6823, 7485, 0, 12, 1 },
+    { 6835, 7485, 6, 10, 1 },
+    { 6845, 7491, 0, 8, 1 },
+    { 6853, 7491, 0, 9, 1 },
+    { 6862, 7491, 0, 10, 1 },
+    { 6872, 7491, 0, 10, 1 },
+    { 6882, 7491, 0, 11, 1 },
+    { 6893, 7491, 0, 14, 1 },
+    { 6907, 7491, 0, 17, 1 },
+    { 6924, 7491, 0, 9, 1 },
+    { 6933, 7491, 0, 10, 1 },
+    { 6943, 7491, 0, 11, 1 },
+    { 6954, 7491, 0, 13, 1 },
+    { 6967, 7491, 0, 10, 1 },
+    { 6977, 7491, 0, 22, 1 },
+    { 6999, 7491, 0, 11, 1 },
+    { 7010, 7491, 0, 10, 1 },
+    { 7020, 7491, 0, 10, 1 },
+    { 7030, 7491, 0, 11, 1 },
+    { 7041, 7491, 0, 9, 1 },
+    { 7050, 7491, 0, 9, 1 },
+    { 7059, 7491, 0, 13, 1 },
+    { 7072, 7491, 0, 11, 1 },
+    { 7083, 7491, 0, 11, 1 },
+    { 7094, 7491, 0, 9, 1 },
+    { 7103, 7491, 0, 14, 1 },
+    { 7117, 7491, 0, 10, 1 },
+    { 7127, 7491, 0, 10, 1 },
+    { 7137, 7491, 0, 10, 1 },
+    { 7147, 7491, 0, 11, 1 },
+    { 7158, 7491, 0, 11, 1 },
+    { 7169, 7491, 0, 13, 1 },
+    { 7182, 7491, 0, 13, 1 },
+    { 7195, 7491, 0, 16, 1 },
+    { 7211, 7491, 0, 11, 1 },
+    { 7222, 7491, 0, 12, 1 },
+    { 7234, 7491, 0, 11, 1 },
+    { 7245, 7491, 0, 11, 1 },
+    { 7256, 7491, 0, 14, 1 },
+    { 7270, 7491, 0, 11, 1 },
+    { 7281, 7491, 0, 13, 1 },
+    { 7294, 7491, 0, 11, 1 },
+    { 7305, 7491, 0, 15, 1 },
+    { 7320, 7491, 0, 11, 1 },
+    { 7331, 7491, 0, 10, 1 },
+    { 7341, 7491, 0, 9, 1 },
+    { 7350, 7491, 0, 9, 1 },
+    { 7359, 7491, 6, 11, 1 },
+    { 7370, 7497, 0, 14, 1 },
+    { 7384, 7497, 0, 11, 1 },
+    { 7395, 7497, 0, 15, 1 },
+    { 7410, 7497, 0, 11, 1 },
+    { 7421, 7497, 0, 11, 1 },
+    { 7432, 7497, 0, 10, 1 },
+    { 7442, 7497, 0, 9, 1 },
+    { 7451, 7497, 0, 15, 1 },
+    { 7466, 7497, 0, 12, 1 },
+    { 7478, 7497, 0, 12, 1 },
+    { 7490, 7497, 0, 14, 1 },
+    { 7504, 7497, 0, 15, 1 },
+    { 7519, 7497, 0, 14, 1 },
+    { 7533, 7497, 0, 16, 1 },
+    { 7549, 7497, 0, 15, 1 },
+    { 7564, 7497, 0, 14, 1 },
+    { 7578, 7497, 0, 12, 1 },
+    { 7590, 7497, 0, 17, 1 },
+    { 7607, 7497, 0, 18, 1 },
+    { 7625, 7497, 0, 17, 1 },
+    { 7642, 7497, 0, 14, 1 },
+    { 7656, 7497, 0, 11, 1 },
+    { 7667, 7497, 0, 14, 1 },
+    { 7681, 7497, 0, 15, 1 },
+    { 7696, 7497, 0, 14, 1 },
+    { 7710, 7497, 0, 16, 1 },
+    { 7726, 7497, 0, 19, 1 },
+    { 7745, 7497, 0, 17, 1 },
+    { 7762, 7497, 0, 12, 1 },
+    { 7774, 7497, 0, 14, 1 },
+    { 7788, 7497, 0, 12, 1 },
+    { 7800, 7497, 0, 19, 1 },
+    { 7819, 7497, 0, 16, 1 },
+    { 7835, 7497, 0, 12, 1 },
+    { 7847, 7497, 0, 12, 1 },
+    { 7859, 7497, 0, 11, 1 },
+    { 7870, 7497, 0, 14, 1 },
+    { 7884, 7497, 0, 11, 1 },
+    { 7895, 7497, 0, 11, 1 },
+    { 7906, 7497, 0, 12, 1 },
+    { 7918, 7497, 0, 10, 1 },
+    { 7928, 7497, 0, 12, 1 },
+    { 7940, 7497, 0, 12, 1 },
+    { 7952, 7497, 0, 9, 1 },
+    { 7961, 7497, 0, 11, 1 },
+    { 7972, 7497, 0, 8, 1 },
+    { 7980, 7497, 0, 9, 1 },
+    { 7989, 7497, 0, 15, 1 },
+    { 8004, 7497, 0, 11, 1 },
+    { 8015, 7497, 6, 10, 1 },
+    { 8025, 7503, 0, 12, 1 },
+    { 8037, 7503, 0, 11, 1 },
+    { 8048, 7503, 10, 9, 1 },
+    { 8057, 7513, 0, 8, 1 },
+    { 8065, 7513, 0, 11, 1 },
+    { 8076, 7513, 0, 10, 1 },
+    { 8086, 7513, 0, 10, 1 },
+    { 8096, 7513, 0, 11, 1 },
+    { 8107, 7513, 0, 12, 1 },
+    { 8119, 7513, 0, 9, 1 },
+    { 8128, 7513, 0, 8, 1 },
+    { 8136, 7513, 0, 11, 1 },
+    { 8147, 7513, 0, 11, 1 },
+    { 8158, 7513, 0, 14, 1 },
+    { 8172, 7513, 0, 11, 1 },
+    { 8183, 7513, 0, 11, 1 },
+    { 8194, 7513, 0, 11, 1 },
+    { 8205, 7513, 0, 9, 1 },
+    { 8214, 7513, 0, 13, 1 },
+    { 8227, 7513, 0, 10, 1 },
+    { 8237, 7513, 0, 23, 1 },
+    { 8260, 7513, 0, 24, 1 },
+    { 8284, 7513, 0, 9, 1 },
+    { 8293, 7513, 0, 11, 1 },
+    { 8304, 7513, 0, 20, 1 },
+    { 8324, 7513, 0, 11, 1 },
+    { 8335, 7513, 0, 10, 1 },
+    { 8345, 7513, 0, 10, 1 },
+    { 8355, 7513, 0, 11, 1 },
+    { 8366, 7513, 0, 16, 1 },
+    { 8382, 7513, 0, 17, 1 },
+    { 8399, 7513, 0, 10, 1 },
+    { 8409, 7513, 0, 13, 1 },
+    { 8422, 7513, 0, 13, 1 },
+    { 8435, 7513, 0, 11, 1 },
+    { 8446, 7513, 0, 3, 1 },
+    { 8449, 7513, 5, 3, 1 },
+    { 8452, 7518, 0, 6, 1 },
+    { 8458, 7518, 0, 5, 1 },
+    { 8463, 7518, 0, 7, 1 },
+    { 8470, 7518, 0, 6, 1 },
+    { 8476, 7518, 6, 2, 1 },
+    { 8478, 7524, 0, 9, 1 },
+    { 8487, 7524, 0, 4, 1 },
+    { 8491, 7524, 0, 8, 1 },
+    { 8499, 7524, 0, 3, 1 },
+    { 8502, 7524, 0, 7, 1 },
+    { 8509, 7524, 1, 2, 1 },
+    { 8511, 7525, 0, 3, 1 },
+    { 8514, 7525, 18, 2, 0 },
+    { 8516, 7543, 0, 6, 1 },
+    { 8522, 7543, 0, 4, 1 },
+    { 8526, 7543, 0, 4, 1 },
+    { 8530, 7543, 0, 3, 1 },
+    { 8533, 7543, 11, 2, 1 },
+    { 8535, 7554, 4, 4, 1 },
+    { 8539, 7558, 0, 7, 1 },
+    { 8546, 7558, 5, 2, 1 },
+    { 8548, 7563, 0, 4, 1 },
+    { 8552, 7563, 0, 4, 1 },
+    { 8556, 7563, 0, 4, 1 },
+    { 8560, 7563, 0, 6, 1 },
+    { 8566, 7563, 0, 8, 1 },
+    { 8574, 7563, 0, 4, 1 },
+    { 8578, 7563, 0, 14, 1 },
+    { 8592, 7563, 0, 6, 1 },
+    { 8598, 7563, 0, 6, 1 },
+    { 8604, 7563, 0, 6, 1 },
+    { 8610, 7563, 0, 12, 1 },
+    { 8622, 7563, 0, 12, 1 },
+    { 8634, 7563, 0, 6, 1 },
+    { 8640, 7563, 10, 6, 1 },
+    { 8646, 7573, 0, 4, 1 },
+    { 8650, 7573, 0, 8, 1 },
+    { 8658, 7573, 6, 6, 1 },
+    { 8664, 7579, 0, 6, 1 },
+    { 8670, 7579, 0, 6, 1 },
+    { 8676, 7579, 0, 6, 1 },
+    { 8682, 7579, 4, 10, 1 },
+    { 8692, 7583, 0, 6, 1 },
+    { 8698, 7583, 0, 12, 1 },
+    { 8710, 7583, 0, 14, 1 },
+    { 8724, 7583, 0, 12, 1 },
+    { 8736, 7583, 0, 12, 1 },
+    { 8748, 7583, 0, 14, 1 },
+    { 8762, 7583, 0, 14, 1 },
+    { 8776, 7583, 0, 16, 1 },
+    { 8792, 7583, 0, 16, 1 },
+    { 8808, 7583, 0, 16, 1 },
+    { 8824, 7583, 0, 16, 1 },
+    { 8840, 7583, 0, 14, 1 },
+    { 8854, 7583, 0, 12, 1 },
+    { 8866, 7583, 0, 10, 1 },
+    { 8876, 7583, 0, 12, 1 },
+    { 8888, 7583, 0, 10, 1 },
+    { 8898, 7583, 0, 10, 1 },
+    { 8908, 7583, 0, 8, 1 },
+    { 8916, 7583, 0, 10, 1 },
+    { 8926, 7583, 0, 8, 1 },
+    { 8934, 7583, 0, 10, 1 },
+    { 8944, 7583, 0, 8, 1 },
+    { 8952, 7583, 0, 10, 1 },
+    { 8962, 7583, 0, 10, 1 },
+    { 8972, 7583, 0, 10, 1 },
+    { 8982, 7583, 0, 8, 1 },
+    { 8990, 7583, 0, 8, 1 },
+    { 8998, 7583, 0, 6, 1 },
+    { 9004, 7583, 0, 8, 1 },
+    { 9012, 7583, 0, 12, 1 },
+    { 9024, 7583, 0, 6, 1 },
+    { 9030, 7583, 0, 14, 1 },
+    { 9044, 7583, 0, 6, 1 },
+    { 9050, 7583, 0, 6, 1 },
+    { 9056, 7583, 0, 12, 1 },
+    { 9068, 7583, 0, 18, 1 },
+    { 9086, 7583, 0, 8, 1 },
+    { 9094, 7583, 0, 10, 1 },
+    { 9104, 7583, 0, 14, 1 },
+    { 9118, 7583, 0, 14, 1 },
+    { 9132, 7583, 0, 8, 1 },
+    { 9140, 7583, 0, 9, 1 },
+    { 9149, 7583, 0, 9, 1 },
+    { 9158, 7583, 0, 12, 1 },
+    { 9170, 7583, 0, 18, 1 },
+    { 9188, 7583, 0, 15, 1 },
+    { 9203, 7583, 0, 15, 1 },
+    { 9218, 7583, 0, 15, 1 },
+    { 9233, 7583, 0, 12, 1 },
+    { 9245, 7583, 0, 12, 1 },
+    { 9257, 7583, 0, 12, 1 },
+    { 9269, 7583, 0, 12, 1 },
+    { 9281, 7583, 0, 12, 1 },
+    { 9293, 7583, 0, 21, 1 },
+    { 9314, 7583, 0, 18, 1 },
+    { 9332, 7583, 0, 33, 1 },
+    { 9365, 7583, 0, 15, 1 },
+    { 9380, 7583, 0, 12, 1 },
+    { 9392, 7583, 0, 15, 1 },
+    { 9407, 7583, 0, 12, 1 },
+    { 9419, 7583, 0, 9, 1 },
+    { 9428, 7583, 6, 9, 1 },
+    { 9437, 7589, 0, 9, 1 },
+    { 9446, 7589, 0, 6, 1 },
+    { 9452, 7589, 0, 9, 1 },
+    { 9461, 7589, 0, 12, 1 },
+    { 9473, 7589, 0, 12, 1 },
+    { 9485, 7589, 0, 12, 1 },
+    { 9497, 7589, 0, 6, 1 },
+    { 9503, 7589, 0, 9, 1 },
+    { 9512, 7589, 0, 9, 1 },
+    { 9521, 7589, 0, 18, 1 },
+    { 9539, 7589, 0, 12, 1 },
+    { 9551, 7589, 0, 6, 1 },
+    { 9557, 7589, 0, 6, 1 },
+    { 9563, 7589, 0, 6, 1 },
+    { 9569, 7589, 0, 6, 1 },
+    { 9575, 7589, 0, 9, 1 },
+    { 9584, 7589, 0, 9, 1 },
+    { 9593, 7589, 0, 6, 1 },
+    { 9599, 7589, 0, 6, 1 },
+    { 9605, 7589, 0, 6, 1 },
+    { 9611, 7589, 0, 6, 1 },
+    { 9617, 7589, 0, 6, 1 },
+    { 9623, 7589, 0, 6, 1 },
+    { 9629, 7589, 0, 6, 1 },
+    { 9635, 7589, 0, 6, 1 },
+    { 9641, 7589, 0, 6, 1 },
+    { 9647, 7589, 0, 6, 1 },
+    { 9653, 7589, 0, 6, 1 },
+    { 9659, 7589, 0, 6, 1 },
+    { 9665, 7589, 0, 6, 1 },
+    { 9671, 7589, 0, 15, 1 },
+    { 9686, 7589, 0, 6, 1 },
+    { 9692, 7589, 0, 6, 1 },
+    { 9698, 7589, 0, 9, 1 },
+    { 9707, 7589, 0, 6, 1 },
+    { 9713, 7589, 0, 6, 1 },
+    { 9719, 7589, 0, 6, 1 },
+    { 9725, 7589, 0, 6, 1 },
+    { 9731, 7589, 0, 6, 1 },
+    { 9737, 7589, 0, 9, 1 },
+    { 9746, 7589, 0, 6, 1 },
+    { 9752, 7589, 0, 6, 1 },
+    { 9758, 7589, 0, 6, 1 },
+    { 9764, 7589, 0, 6, 1 },
+    { 9770, 7589, 0, 9, 1 },
+    { 9779, 7589, 0, 6, 1 },
+    { 9785, 7589, 0, 6, 1 },
+    { 9791, 7589, 0, 6, 1 },
+    { 9797, 7589, 0, 6, 1 },
+    { 9803, 7589, 0, 9, 1 },
+    { 9812, 7589, 0, 6, 1 },
+    { 9818, 7589, 0, 6, 1 },
+    { 9824, 7589, 0, 6, 1 },
+    { 9830, 7589, 0, 6, 1 },
+    { 9836, 7589, 0, 6, 1 },
+    { 9842, 7589, 0, 12, 1 },
+    { 9854, 7589, 0, 6, 1 },
+    { 9860, 7589, 0, 6, 1 },
+    { 9866, 7589, 0, 6, 1 },
+    { 9872, 7589, 0, 6, 1 },
+    { 9878, 7589, 0, 6, 1 },
+    { 9884, 7589, 0, 6, 1 },
+    { 9890, 7589, 0, 6, 1 },
+    { 9896, 7589, 0, 6, 1 },
+    { 9902, 7589, 0, 6, 1 },
+    { 9908, 7589, 0, 6, 1 },
+    { 9914, 7589, 0, 12, 1 },
+    { 9926, 7589, 0, 9, 1 },
+    { 9935, 7589, 0, 6, 1 },
+    { 9941, 7589, 0, 6, 1 },
+    { 9947, 7589, 0, 12, 1 },
+    { 9959, 7589, 6, 6, 1 },
+    { 9965, 7595, 0, 6, 1 },
+    { 9971, 7595, 0, 6, 1 },
+    { 9977, 7595, 0, 6, 1 },
+    { 9983, 7595, 0, 6, 1 },
+    { 1340, 7595, 0, 3, 1 },
+    { 9989, 7595, 0, 3, 1 },
+    { 1880, 7595, 0, 3, 1 },
+    { 2599, 7595, 0, 3, 1 },
+    { 3903, 7595, 0, 3, 1 },
+    { 4113, 7595, 0, 3, 1 },
+    { 4380, 7595, 0, 3, 1 },
+    { 9992, 7595, 0, 8, 1 },
+    { 10000, 7595, 0, 3, 1 },
+    { 50, 7595, 0, 2, 1 },
+    { 10003, 7595, 0, 8, 1 },
+    { 1308, 7595, 0, 2, 1 },
+    { 2599, 7595, 0, 3, 1 },
+    { 3903, 7595, 0, 3, 1 },
+    { 4113, 7595, 0, 3, 1 },
+    { 4380, 7595, 0, 3, 1 },
+    { 10011, 7595, 0, 3, 1 },
+    { 10014, 7595, 0, 22, 1 },
+    { 10036, 7595, 0, 19, 1 },
+    { 10055, 7595, 0, 9, 1 },
+    { 10064, 7595, 0, 8, 1 },
+    { 10072, 7595, 0, 9, 1 },
+    { 10081, 7595, 0, 6, 1 },
+    { 10087, 7595, 0, 16, 1 },
+    { 10103, 7595, 0, 19, 1 },
+    { 10122, 7595, 0, 8, 1 },
+    { 10130, 7595, 0, 7, 1 },
+    { 10137, 7595, 0, 7, 1 },
+    { 10144, 7595, 0, 10, 1 },
+    { 10154, 7595, 0, 9, 1 },
+    { 10163, 7595, 0, 9, 1 },
+    { 10172, 7595, 0, 11, 1 },
+    { 453, 7595, 0, 6, 1 },
+    { 10183, 7595, 0, 10, 1 },
+    { 883, 7595, 0, 6, 1 },
+    { 10193, 7595, 0, 3, 1 },
+    { 10196, 7595, 0, 5, 1 },
+    { 1074, 7595, 0, 8, 1 },
+    { 10201, 7595, 0, 13, 1 },
+    { 10214, 7595, 0, 12, 1 },
+    { 10226, 7595, 0, 7, 1 },
+    { 10233, 7595, 0, 13, 1 },
+    { 1293, 7595, 0, 4, 1 },
+    { 10246, 7595, 0, 10, 1 },
+    { 10256, 7595, 0, 10, 1 },
+    { 1413, 7595, 0, 10, 1 },
+    { 10266, 7595, 0, 7, 1 },
+    { 10273, 7595, 0, 7, 1 },
+    { 10280, 7595, 0, 4, 1 },
+    { 1711, 7595, 0, 6, 1 },
+    { 10284, 7595, 0, 4, 1 },
+    { 10288, 7595, 0, 8, 1 },
+    { 10296, 7595, 0, 9, 1 },
+    { 10305, 7595, 0, 6, 1 },
+    { 1913, 7595, 0, 8, 1 },
+    { 10311, 7595, 0, 13, 1 },
+    { 1948, 7595, 0, 9, 1 },
+    { 2013, 7595, 0, 8, 1 },
+    { 2034, 7595, 0, 7, 1 },
+    { 10324, 7595, 0, 10, 1 },
+    { 10334, 7595, 0, 6, 1 },
+    { 10340, 7595, 0, 4, 1 },
+    { 10344, 7595, 0, 7, 1 },
+    { 10351, 7595, 0, 10, 1 },
+    { 10361, 7595, 0, 14, 1 },
+    { 2647, 7595, 0, 5, 1 },
+    { 10375, 7595, 0, 11, 1 },
+    { 10386, 7595, 0, 9, 1 },
+    { 3048, 7595, 0, 9, 1 },
+    { 10395, 7595, 0, 7, 1 },
+    { 10402, 7595, 0, 10, 1 },
+    { 10412, 7595, 0, 7, 1 },
+    { 10419, 7595, 0, 9, 1 },
+    { 10428, 7595, 0, 8, 1 },
+    { 10436, 7595, 0, 11, 1 },
+    { 3840, 7595, 0, 5, 1 },
+    { 10447, 7595, 0, 10, 1 },
+    { 10457, 7595, 0, 9, 1 },
+    { 10466, 7595, 0, 10, 1 },
+    { 10476, 7595, 0, 11, 1 },
+    { 10487, 7595, 0, 11, 1 },
+    { 10498, 7595, 0, 21, 1 },
+    { 10519, 7595, 0, 5, 1 },
+    { 4667, 7595, 0, 5, 1 },
+    { 10524, 7595, 0, 10, 1 },
+    { 10534, 7595, 0, 10, 1 },
+    { 10544, 7595, 0, 7, 1 },
+    { 10551, 7595, 0, 3, 1 },
+    { 10554, 7595, 0, 8, 1 },
+    { 10562, 7595, 0, 10, 1 },
+    { 5054, 7595, 0, 6, 1 },
+    { 10572, 7595, 0, 9, 1 },
+    { 5254, 7595, 0, 8, 1 },
+    { 5341, 7595, 0, 4, 1 },
+    { 10581, 7595, 0, 9, 1 },
+    { 5440, 7595, 0, 8, 1 },
+    { 10590, 7595, 0, 7, 1 },
+    { 10597, 7595, 0, 6, 1 },
+    { 5923, 7595, 0, 7, 1 },
+    { 10603, 7595, 0, 7, 1 },
+    { 10610, 7595, 0, 5, 1 },
+    { 10615, 7595, 0, 12, 1 },
+    { 6456, 7595, 0, 5, 1 },
+    { 1340, 7595, 0, 3, 1 },
+    { 1880, 7595, 0, 3, 1 },
+    { 2599, 7595, 0, 3, 1 },
+    { 4113, 7595, 0, 3, 1 },
+    { 4380, 7595, 0, 3, 1 },
+    { 1308, 7595, 0, 2, 1 },
+    { 1340, 7595, 0, 3, 1 },
+    { 4113, 7595, 0, 3, 1 },
+    { 10000, 7595, 0, 3, 1 },
+    { 4380, 7595, 0, 3, 1 },
+    { 1340, 7595, 0, 3, 1 },
+    { 4113, 7595, 0, 3, 1 },
+    { 10627, 7595, 0, 3, 1 },
+    { 4380, 7595, 0, 3, 1 },
+    { 10630, 7595, 0, 3, 1 },
+    { 10003, 7595, 0, 8, 1 },
+    { 1340, 7595, 0, 3, 1 },
+    { 1880, 7595, 0, 3, 1 },
+    { 2599, 7595, 0, 3, 1 },
+    { 3903, 7595, 0, 3, 1 },
+    { 4113, 7595, 0, 3, 1 },
+    { 4380, 7595, 0, 3, 1 },
+    { 10003, 7595, 0, 8, 1 },
+    { 1308, 7595, 0, 2, 1 },
+    { 1340, 7595, 0, 3, 1 },
+    { 10633, 7595, 0, 7, 1 },
+    { 10640, 7595, 0, 4, 1 },
+    { 4113, 7595, 0, 3, 1 },
+    { 10644, 7595, 0, 4, 1 },
+    { 4380, 7595, 0, 3, 1 },
+    { 4793, 7595, 0, 5, 1 },
+    { 1308, 7595, 0, 2, 1 },
+    { 10648, 7595, 0, 2, 1 },
+    { 10650, 7595, 0, 2, 1 },
+    { 3135, 7595, 0, 2, 1 },
+    { 10652, 7595, 0, 2, 1 },
+    { 10654, 7595, 0, 2, 1 },
+    { 10656, 7595, 0, 5, 2 },
+    { 10661, 7595, 0, 10, 1 },
+    { 10671, 7595, 0, 5, 1 },
+    { 10676, 7595, 0, 10, 1 },
+    { 10686, 7595, 0, 4, 1 },
+    { 10690, 7595, 0, 9, 2 },
+    { 10699, 7595, 0, 9, 1 },
+    { 10708, 7595, 0, 11, 1 },
+    { 10719, 7595, 0, 4, 1 },
+    { 10723, 7595, 0, 7, 1 },
+    { 10730, 7595, 0, 6, 1 },
+    { 10736, 7595, 0, 6, 1 },
+    { 10742, 7595, 0, 9, 1 },
+    { 10751, 7595, 0, 8, 1 },
+    { 10759, 7595, 0, 7, 1 },
+    { 10766, 7595, 0, 4, 1 },
+    { 10770, 7595, 0, 10, 2 },
+    { 10780, 7595, 0, 14, 1 },
+    { 10794, 7595, 0, 12, 1 },
+    { 10806, 7595, 0, 9, 1 },
+    { 5026, 7595, 1, 3, 1 },
+    { 10815, 7596, 1, 9, 1 },
+    { 10824, 7597, 0, 9, 1 },
+    { 10833, 7597, 0, 7, 1 },
+    { 10840, 7597, 0, 9, 1 },
+    { 10849, 7597, 0, 6, 1 },
+    { 10855, 7597, 0, 3, 1 },
+    { 10858, 7597, 0, 5, 1 },
+    { 671, 7597, 0, 3, 1 },
+    { 1340, 7597, 1, 3, 1 },
+    { 1466, 7598, 0, 4, 1 },
+    { 1880, 7598, 0, 3, 1 },
+    { 10863, 7598, 0, 3, 1 },
+    { 2599, 7598, 0, 3, 1 },
+    { 3063, 7598, 0, 3, 1 },
+    { 3903, 7598, 0, 3, 1 },
+    { 10866, 7598, 0, 6, 1 },
+    { 4062, 7598, 0, 6, 1 },
+    { 4113, 7598, 0, 3, 1 },
+    { 4380, 7598, 0, 3, 1 },
+    { 10872, 7598, 0, 6, 1 },
+    { 10878, 7598, 0, 3, 1 },
+    { 10881, 7598, 0, 4, 1 },
+    { 10885, 7598, 0, 7, 1 },
+    { 10892, 7598, 0, 3, 1 },
+    { 10895, 7598, 0, 4, 1 },
+    { 10899, 7598, 0, 3, 1 },
+    { 10902, 7598, 0, 3, 1 },
+    { 2599, 7598, 0, 3, 1 },
+    { 10905, 7598, 0, 7, 1 },
+    { 10912, 7598, 0, 11, 1 },
+    { 10923, 7598, 0, 4, 1 },
+    { 10927, 7598, 0, 3, 1 },
+    { 10930, 7598, 0, 5, 1 },
+    { 50, 7598, 1, 2, 1 },
+    { 712, 7599, 0, 3, 1 },
+    { 1308, 7599, 1, 2, 1 },
+    { 10935, 7600, 1, 9, 0 },
+    { 10944, 7601, 2, 9, 2 },
+    { 10953, 7603, 0, 13, 1 },
+    { 10966, 7603, 0, 13, 1 },
+    { 10650, 7603, 0, 2, 1 },
+    { 3029, 7603, 0, 4, 1 },
+    { 10979, 7603, 0, 9, 1 },
+    { 10988, 7603, 0, 12, 1 },
+    { 11000, 7603, 0, 2, 1 },
+    { 11002, 7603, 2, 8, 0 },
+    { 11010, 7605, 0, 4, 1 },
+    { 11014, 7605, 0, 3, 1 },
+    { 11017, 7605, 0, 3, 1 },
+    { 1340, 7605, 3, 3, 1 },
+    { 11020, 7608, 0, 4, 1 },
+    { 1880, 7608, 9, 3, 1 },
+    { 2599, 7617, 5, 3, 1 },
+    { 2962, 7622, 0, 2, 1 },
+    { 3029, 7622, 0, 4, 1 },
+    { 4113, 7622, 0, 3, 1 },
+    { 11024, 7622, 0, 3, 1 },
+    { 11027, 7622, 0, 2, 1 },
+    { 4380, 7622, 0, 3, 1 },
+    { 11029, 7622, 0, 2, 1 },
+    { 11031, 7622, 0, 3, 1 },
+    { 5040, 7622, 0, 2, 1 },
+    { 11034, 7622, 0, 3, 1 },
+    { 11037, 7622, 0, 3, 1 },
+    { 11040, 7622, 0, 2, 1 },
+    { 1340, 7622, 0, 3, 1 },
+    { 630, 7622, 0, 2, 1 },
+    { 1071, 7622, 0, 3, 1 },
+    { 1971, 7622, 0, 2, 1 },
+    { 1992, 7622, 0, 2, 1 },
+    { 2478, 7622, 0, 2, 1 },
+    { 3823, 7622, 0, 2, 1 },
+    { 6059, 7622, 0, 2, 1 },
+    { 11042, 7622, 0, 2, 1 },
+    { 712, 7622, 0, 3, 1 },
+    { 1340, 7622, 0, 3, 1 },
+    { 1880, 7622, 0, 3, 1 },
+    { 2599, 7622, 0, 3, 1 },
+    { 3029, 7622, 0, 4, 1 },
+    { 3063, 7622, 0, 3, 1 },
+    { 3903, 7622, 0, 3, 1 },
+    { 4089, 7622, 0, 4, 1 },
+    { 4113, 7622, 0, 3, 1 },
+    { 4380, 7622, 0, 3, 1 },
+    { 11044, 7622, 0, 2, 1 },
+    { 4677, 7622, 0, 3, 1 },
+    { 10003, 7622, 0, 8, 1 },
+    { 1340, 7622, 0, 3, 1 },
+    { 1880, 7622, 0, 3, 1 },
+    { 2599, 7622, 0, 3, 1 },
+    { 3903, 7622, 0, 3, 1 },
+    { 4113, 7622, 0, 3, 1 },
+    { 4380, 7622, 0, 3, 1 },
+    { 5009, 7622, 0, 2, 1 },
+    { 11046, 7622, 0, 3, 1 },
+    { 4280, 7622, 0, 2, 1 },
+    { 712, 7622, 0, 3, 1 },
+    { 1308, 7622, 0, 2, 1 },
+    { 1340, 7622, 0, 3, 1 },
+    { 1880, 7622, 0, 3, 1 },
+    { 2599, 7622, 0, 3, 1 },
+    { 3029, 7622, 0, 4, 1 },
+    { 4113, 7622, 0, 3, 1 },
+    { 4380, 7622, 0, 3, 1 },
+    { 5564, 7622, 0, 5, 1 },
+    { 6011, 7622, 0, 2, 1 },
+    { 11049, 7622, 0, 10, 1 },
+    { 50, 7622, 0, 2, 1 },
+    { 10003, 7622, 0, 8, 1 },
+    { 11059, 7622, 1, 18, 0 },
+    { 11077, 7623, 1, 8, 0 },
+    { 10988, 7624, 0, 12, 1 },
+    { 11085, 7624, 0, 8, 2 },
+    { 11093, 7624, 0, 10, 1 },
+    { 2599, 7624, 0, 3, 1 },
+    { 11103, 7624, 0, 1, 1 },
+    { 11104, 7624, 0, 1, 1 },
+    { 11105, 7624, 0, 1, 1 },
+    { 11106, 7624, 0, 1, 1 },
+    { 11107, 7624, 0, 1, 1 },
+    { 11108, 7624, 0, 1, 1 },
+    { 11109, 7624, 0, 1, 1 },
+    { 11110, 7624, 0, 1, 1 },
+    { 11111, 7624, 0, 1, 1 },
+    { 11112, 7624, 0, 1, 1 },
+    { 11113, 7624, 0, 1, 1 },
+    { 11114, 7624, 0, 1, 1 },
+    { 11115, 7624, 0, 5, 1 },
+    { 10003, 7624, 0, 8, 1 },
+    { 11120, 7624, 0, 1, 1 },
+    { 11121, 7624, 0, 1, 1 },
+    { 11122, 7624, 0, 1, 1 },
+    { 11123, 7624, 0, 1, 1 },
+    { 11124, 7624, 0, 1, 1 },
+    { 11125, 7624, 0, 1, 1 },
+    { 11126, 7624, 0, 1, 1 },
+    { 11127, 7624, 0, 1, 1 },
+    { 11128, 7624, 0, 1, 1 },
+    { 11129, 7624, 0, 1, 1 },
+    { 11130, 7624, 0, 1, 1 },
+    { 11131, 7624, 0, 1, 1 },
+    { 11132, 7624, 0, 1, 1 },
+    { 11133, 7624, 0, 1, 1 },
+    { 11134, 7624, 0, 1, 1 },
+    { 11135, 7624, 0, 1, 1 },
+    { 11136, 7624, 0, 1, 1 },
+    { 11137, 7624, 0, 1, 1 },
+    { 11138, 7624, 0, 1, 1 },
+    { 11139, 7624, 0, 1, 1 },
+    { 11140, 7624, 0, 1, 1 },
+    { 11141, 7624, 0, 1, 1 },
+    { 11142, 7624, 0, 1, 1 },
+    { 11143, 7624, 0, 1, 1 },
+    { 1340, 7624, 0, 3, 1 },
+    { 1880, 7624, 0, 3, 1 },
+    { 2599, 7624, 0, 3, 1 },
+    { 4113, 7624, 0, 3, 1 },
+    { 4380, 7624, 0, 3, 1 },
+    { 1308, 7624, 0, 2, 1 },
+    { 1340, 7624, 0, 3, 1 },
+    { 1880, 7624, 0, 3, 1 },
+    { 11000, 7624, 0, 2, 1 },
+    { 4380, 7624, 0, 3, 1 },
+    { 11144, 7624, 0, 11, 1 },
+    { 10905, 7624, 0, 7, 1 },
+    { 11155, 7624, 0, 7, 1 },
+    { 11162, 7624, 0, 6, 1 },
+    { 11168, 7624, 0, 10, 1 },
+    { 11178, 7624, 0, 8, 1 },
+    { 11186, 7624, 0, 8, 1 },
+    { 11194, 7624, 0, 7, 1 },
+    { 11201, 7624, 0, 4, 1 },
+    { 11205, 7624, 0, 6, 1 },
+    { 11211, 7624, 0, 5, 1 },
+    { 11216, 7624, 0, 5, 1 },
+    { 11221, 7624, 0, 3, 1 },
+    { 11224, 7624, 0, 6, 1 },
+    { 11230, 7624, 0, 6, 1 },
+    { 126, 7624, 0, 6, 1 },
+    { 11236, 7624, 0, 4, 1 },
+    { 11240, 7624, 0, 11, 1 },
+    { 11251, 7624, 0, 5, 1 },
+    { 11256, 7624, 0, 7, 1 },
+    { 10003, 7624, 0, 8, 1 },
+    { 1308, 7624, 0, 2, 1 },
+    { 1340, 7624, 0, 3, 1 },
+    { 1872, 7624, 0, 3, 1 },
+    { 11263, 7624, 0, 5, 1 },
+    { 1880, 7624, 0, 3, 1 },
+    { 3029, 7624, 0, 4, 1 },
+    { 11268, 7624, 0, 7, 1 },
+    { 3975, 7624, 0, 5, 1 },
+    { 4113, 7624, 0, 3, 1 },
+    { 4380, 7624, 0, 3, 1 },
+    { 11275, 7624, 0, 3, 1 },
+    { 4924, 7624, 0, 10, 1 },
+    { 11278, 7624, 0, 5, 1 },
+    { 11283, 7624, 0, 7, 1 },
+    { 11290, 7624, 0, 4, 1 },
+    { 1340, 7624, 0, 3, 1 },
+    { 1880, 7624, 0, 3, 1 },
+    { 2599, 7624, 0, 3, 1 },
+    { 4113, 7624, 0, 3, 1 },
+    { 4380, 7624, 0, 3, 1 },
+    { 1308, 7624, 0, 2, 1 },
+    { 1340, 7624, 0, 3, 1 },
+    { 1880, 7624, 0, 3, 1 },
+    { 2599, 7624, 0, 3, 1 },
+    { 4113, 7624, 0, 3, 1 },
+    { 4380, 7624, 0, 3, 1 },
+    { 11294, 7624, 0, 8, 1 },
+    { 11236, 7624, 0, 4, 1 },
+    { 380, 7624, 0, 4, 1 },
+    { 744, 7624, 0, 4, 1 },
+    { 11302, 7624, 0, 7, 1 },
+    { 11309, 7624, 0, 7, 1 },
+    { 1340, 7624, 0, 3, 1 },
+    { 11316, 7624, 0, 11, 1 },
+    { 11327, 7624, 0, 10, 1 },
+    { 11337, 7624, 0, 7, 1 },
+    { 11344, 7624, 0, 8, 1 },
+    { 11352, 7624, 0, 8, 1 },
+    { 1880, 7624, 0, 3, 1 },
+    { 11360, 7624, 0, 7, 1 },
+    { 10863, 7624, 0, 3, 1 },
+    { 11367, 7624, 0, 8, 1 },
+    { 11375, 7624, 0, 9, 1 },
+    { 3029, 7624, 0, 4, 1 },
+    { 3063, 7624, 0, 3, 1 },
+    { 11384, 7624, 0, 8, 1 },
+    { 3903, 7624, 0, 3, 1 },
+    { 11392, 7624, 0, 10, 1 },
+    { 10866, 7624, 0, 6, 1 },
+    { 11402, 7624, 0, 7, 1 },
+    { 4113, 7624, 0, 3, 1 },
+    { 11409, 7624, 0, 6, 1 },
+    { 11415, 7624, 0, 8, 1 },
+    { 4380, 7624, 0, 3, 1 },
+    { 11423, 7624, 0, 6, 1 },
+    { 11429, 7624, 0, 13, 1 },
+    { 11442, 7624, 0, 8, 1 },
+    { 11450, 7624, 0, 11, 1 },
+    { 11461, 7624, 0, 6, 1 },
+    { 11467, 7624, 0, 7, 1 },
+    { 11474, 7624, 0, 5, 1 },
+    { 11479, 7624, 0, 10, 1 },
+    { 11489, 7624, 0, 5, 1 },
+    { 11494, 7624, 0, 10, 1 },
+    { 6011, 7624, 0, 2, 1 },
+    { 10855, 7624, 0, 3, 1 },
+    { 6392, 7624, 0, 4, 1 },
+    { 11504, 7624, 0, 6, 1 },
+    { 28, 7624, 0, 3, 1 },
+    { 11510, 7624, 0, 3, 1 },
+    { 11513, 7624, 0, 3, 1 },
+    { 11516, 7624, 0, 3, 1 },
+    { 11519, 7624, 0, 3, 1 },
+    { 233, 7624, 0, 2, 1 },
+    { 11522, 7624, 0, 5, 1 },
+    { 11527, 7624, 0, 9, 1 },
+    { 333, 7624, 0, 3, 1 },
+    { 11536, 7624, 0, 3, 1 },
+    { 377, 7624, 0, 3, 1 },
+    { 11539, 7624, 0, 3, 1 },
+    { 11114, 7624, 0, 1, 1 },
+    { 11542, 7624, 0, 7, 1 },
+    { 11549, 7624, 0, 5, 1 },
+    { 11554, 7624, 0, 3, 1 },
+    { 11557, 7624, 0, 3, 1 },
+    { 709, 7624, 0, 3, 1 },
+    { 744, 7624, 0, 4, 1 },
+    { 11560, 7624, 0, 3, 1 },
+    { 11563, 7624, 0, 8, 1 },
+    { 11571, 7624, 0, 3, 1 },
+    { 11574, 7624, 0, 13, 1 },
+    { 11587, 7624, 0, 8, 1 },
+    { 11595, 7624, 0, 6, 1 },
+    { 11601, 7624, 0, 3, 1 },
+    { 11604, 7624, 0, 3, 1 },
+    { 11607, 7624, 0, 3, 1 },
+    { 1340, 7624, 3, 3, 1 },
+    { 11610, 7627, 0, 8, 1 },
+    { 1466, 7627, 0, 4, 1 },
+    { 11618, 7627, 0, 3, 1 },
+    { 11621, 7627, 0, 3, 1 },
+    { 11624, 7627, 0, 6, 1 },
+    { 11630, 7627, 0, 8, 1 },
+    { 11638, 7627, 0, 3, 1 },
+    { 11641, 7627, 0, 3, 1 },
+    { 11644, 7627, 0, 3, 1 },
+    { 1717, 7627, 0, 3, 1 },
+    { 11647, 7627, 0, 3, 1 },
+    { 1872, 7627, 0, 3, 1 },
+    { 1880, 7627, 0, 3, 1 },
+    { 11650, 7627, 0, 3, 1 },
+    { 11653, 7627, 0, 3, 1 },
+    { 11656, 7627, 0, 3, 1 },
+    { 11659, 7627, 0, 3, 1 },
+    { 11662, 7627, 0, 3, 1 },
+    { 11665, 7627, 0, 3, 1 },
+    { 11668, 7627, 0, 3, 1 },
+    { 11671, 7627, 0, 5, 1 },
+    { 11676, 7627, 0, 4, 1 },
+    { 11680, 7627, 0, 7, 1 },
+    { 2258, 7627, 0, 2, 1 },
+    { 11687, 7627, 0, 3, 1 },
+    { 11690, 7627, 0, 6, 1 },
+    { 11696, 7627, 0, 3, 1 },
+    { 11699, 7627, 0, 3, 1 },
+    { 11702, 7627, 0, 3, 1 },
+    { 11705, 7627, 0, 3, 1 },
+    { 11708, 7627, 0, 3, 1 },
+    { 11711, 7627, 0, 3, 1 },
+    { 11714, 7627, 0, 7, 1 },
+    { 2599, 7627, 27, 3, 1 },
+    { 11721, 7654, 0, 3, 1 },
+    { 11724, 7654, 0, 3, 1 },
+    { 11727, 7654, 0, 3, 1 },
+    { 11730, 7654, 0, 3, 1 },
+    { 11733, 7654, 0, 3, 1 },
+    { 11736, 7654, 0, 5, 1 },
+    { 11741, 7654, 0, 3, 1 },
+    { 11744, 7654, 0, 9, 1 },
+    { 11753, 7654, 0, 3, 1 },
+    { 11756, 7654, 0, 3, 1 },
+    { 11759, 7654, 27, 3, 1 },
+    { 11762, 7681, 0, 3, 1 },
+    { 11765, 7681, 0, 3, 1 },
+    { 11768, 7681, 0, 8, 1 },
+    { 11776, 7681, 0, 6, 1 },
+    { 11782, 7681, 0, 6, 1 },
+    { 11788, 7681, 0, 6, 1 },
+    { 11794, 7681, 0, 7, 1 },
+    { 11801, 7681, 0, 3, 1 },
+    { 3837, 7681, 0, 3, 1 },
+    { 3903, 7681, 0, 3, 1 },
+    { 11804, 7681, 0, 6, 1 },
+    { 4030, 7681, 0, 2, 1 },
+    { 11810, 7681, 0, 3, 1 },
+    { 11813, 7681, 0, 5, 1 },
+    { 4113, 7681, 0, 3, 1 },
+    { 11818, 7681, 0, 7, 1 },
+    { 10000, 7681, 0, 3, 2 },
+    { 11825, 7681, 0, 3, 1 },
+    { 11828, 7681, 0, 3, 1 },
+    { 11831, 7681, 0, 3, 1 },
+    { 4344, 7681, 0, 3, 1 },
+    { 4380, 7681, 0, 3, 1 },
+    { 11834, 7681, 0, 6, 1 },
+    { 11840, 7681, 0, 6, 1 },
+    { 11846, 7681, 0, 3, 1 },
+    { 11849, 7681, 0, 3, 1 },
+    { 4677, 7681, 0, 3, 1 },
+    { 11852, 7681, 0, 3, 1 },
+    { 11855, 7681, 0, 3, 1 },
+    { 11858, 7681, 0, 3, 1 },
+    { 11861, 7681, 0, 3, 1 },
+    { 4793, 7681, 0, 5, 1 },
+    { 11864, 7681, 0, 3, 1 },
+    { 11867, 7681, 0, 6, 1 },
+    { 11873, 7681, 0, 3, 1 },
+    { 11876, 7681, 0, 8, 1 },
+    { 4975, 7681, 0, 3, 1 },
+    { 11884, 7681, 0, 9, 1 },
+    { 11893, 7681, 0, 8, 1 },
+    { 11901, 7681, 0, 8, 1 },
+    { 11909, 7681, 0, 5, 1 },
+    { 11914, 7681, 0, 10, 1 },
+    { 11924, 7681, 0, 10, 1 },
+    { 11934, 7681, 0, 11, 1 },
+    { 11945, 7681, 0, 8, 1 },
+    { 11953, 7681, 0, 3, 1 },
+    { 11956, 7681, 0, 3, 1 },
+    { 11959, 7681, 0, 3, 1 },
+    { 11962, 7681, 0, 3, 1 },
+    { 11965, 7681, 0, 8, 1 },
+    { 11973, 7681, 0, 3, 1 },
+    { 5717, 7681, 0, 4, 1 },
+    { 5721, 7681, 0, 2, 1 },
+    { 11976, 7681, 0, 3, 1 },
+    { 11979, 7681, 0, 3, 1 },
+    { 11982, 7681, 0, 3, 1 },
+    { 11985, 7681, 0, 3, 1 },
+    { 11988, 7681, 0, 3, 1 },
+    { 10878, 7681, 0, 3, 1 },
+    { 6011, 7681, 0, 2, 1 },
+    { 11991, 7681, 0, 3, 1 },
+    { 6160, 7681, 0, 3, 1 },
+    { 11994, 7681, 0, 3, 1 },
+    { 11997, 7681, 0, 4, 1 },
+    { 6392, 7681, 0, 4, 1 },
+    { 12001, 7681, 0, 3, 1 },
+    { 1340, 7681, 0, 3, 1 },
+    { 1880, 7681, 0, 3, 1 },
+    { 2599, 7681, 0, 3, 1 },
+    { 4113, 7681, 0, 3, 1 },
+    { 4380, 7681, 0, 3, 1 },
+    { 12004, 7681, 0, 2, 1 },
+    { 1340, 7681, 0, 3, 1 },
+    { 1880, 7681, 0, 3, 1 },
+    { 2599, 7681, 0, 3, 1 },
+    { 4113, 7681, 0, 3, 1 },
+    { 4380, 7681, 0, 3, 1 },
+    { 12006, 7681, 0, 9, 1 },
+    { 1308, 7681, 0, 2, 1 },
+    { 1308, 7681, 0, 2, 1 },
+    { 4380, 7681, 0, 3, 1 },
+    { 1340, 7681, 1, 3, 1 },
+    { 2599, 7682, 0, 3, 1 },
+    { 12015, 7682, 0, 9, 1 },
+    { 3903, 7682, 0, 3, 1 },
+    { 12024, 7682, 0, 7, 1 },
+    { 12031, 7682, 0, 2, 1 },
+    { 1340, 7682, 0, 3, 1 },
+    { 1880, 7682, 0, 3, 1 },
+    { 2599, 7682, 0, 3, 1 },
+    { 12033, 7682, 0, 3, 1 },
+    { 4113, 7682, 0, 3, 1 },
+    { 4380, 7682, 0, 3, 1 },
+    { 8514, 7682, 0, 2, 1 },
+    { 12036, 7682, 0, 2, 1 },
+    { 12038, 7682, 0, 5, 2 },
+    { 11115, 7682, 0, 5, 1 },
+    { 12043, 7682, 0, 2, 1 },
+    { 10003, 7682, 0, 8, 1 },
+    { 1308, 7682, 0, 2, 1 },
+    { 12045, 7682, 0, 2, 1 },
+    { 12047, 7682, 0, 2, 1 },
+    { 10988, 7682, 0, 12, 1 },
+    { 12049, 7682, 0, 2, 1 },
+    { 4170, 7682, 0, 2, 1 },
+    { 4215, 7682, 0, 2, 1 },
+    { 11216, 7682, 0, 5, 1 },
+    { 12051, 7682, 0, 2, 1 },
+    { 11027, 7682, 0, 2, 1 },
+    { 4275, 7682, 0, 2, 1 },
+    { 12053, 7682, 0, 2, 1 },
+    { 4472, 7682, 0, 2, 1 },
+    { 12055, 7682, 0, 2, 1 },
+    { 5376, 7682, 0, 2, 1 },
+    { 12057, 7682, 0, 2, 1 },
+    { 12059, 7682, 1, 4, 0 },
+    { 10905, 7683, 0, 7, 1 },
+    { 12063, 7683, 0, 3, 1 },
+    { 12066, 7683, 0, 13, 1 },
+    { 12079, 7683, 0, 9, 1 },
+    { 12088, 7683, 0, 11, 1 },
+    { 12099, 7683, 0, 8, 1 },
+    { 12107, 7683, 0, 9, 1 },
+    { 12116, 7683, 1, 5, 0 },
+    { 12121, 7684, 0, 6, 1 },
+    { 2599, 7684, 0, 3, 1 },
+    { 10003, 7684, 0, 8, 1 },
+    { 11049, 7684, 0, 10, 1 },
+    { 10923, 7684, 0, 4, 1 },
+    { 10927, 7684, 0, 3, 1 },
+    { 10930, 7684, 0, 5, 1 },
+    { 10003, 7684, 0, 8, 1 },
+    { 12127, 7684, 0, 7, 1 },
+    { 12134, 7684, 1, 7, 2 },
+    { 12141, 7685, 2, 4, 0 },
+    { 12145, 7687, 0, 6, 1 },
+    { 10979, 7687, 0, 9, 1 },
+    { 12151, 7687, 0, 14, 1 },
+    { 10988, 7687, 0, 12, 1 },
+    { 12165, 7687, 0, 7, 1 },
+    { 50, 7687, 0, 2, 1 },
+    { 12172, 7687, 0, 4, 1 },
+    { 12176, 7687, 0, 9, 1 },
+    { 1308, 7687, 0, 2, 1 },
+    { 1340, 7687, 0, 3, 1 },
+    { 10648, 7687, 0, 2, 1 },
+    { 1880, 7687, 0, 3, 1 },
+    { 12185, 7687, 0, 3, 1 },
+    { 12188, 7687, 0, 2, 1 },
+    { 12190, 7687, 0, 4, 1 },
+    { 3063, 7687, 0, 3, 1 },
+    { 3833, 7687, 0, 2, 1 },
+    { 4113, 7687, 0, 3, 1 },
+    { 4215, 7687, 0, 2, 1 },
+    { 11000, 7687, 0, 2, 1 },
+    { 4380, 7687, 0, 3, 1 },
+    { 12194, 7687, 0, 6, 1 },
+    { 12200, 7687, 0, 15, 1 },
+    { 12215, 7687, 0, 3, 4 },
+    { 10003, 7687, 0, 8, 1 },
+    { 1308, 7687, 0, 2, 1 },
+    { 10863, 7687, 0, 3, 1 },
+    { 2599, 7687, 0, 3, 1 },
+    { 3903, 7687, 0, 3, 1 },
+    { 12218, 7687, 1, 7, 0 },
+    { 12225, 7688, 0, 6, 2 },
+    { 12231, 7688, 0, 6, 1 },
+    { 12237, 7688, 0, 9, 1 },
+    { 12246, 7688, 1, 7, 0 },
+    { 12253, 7689, 1, 8, 0 },
+    { 12261, 7690, 0, 4, 1 },
+    { 12265, 7690, 2, 10, 0 },
+    { 12275, 7692, 0, 8, 1 },
+    { 12283, 7692, 1, 7, 1 },
+    { 11077, 7693, 0, 8, 1 },
+    { 12290, 7693, 0, 8, 1 },
+    { 12298, 7693, 0, 11, 2 },
+    { 12309, 7693, 0, 10, 2 },
+    { 12319, 7693, 2, 3, 1 },
+    { 12322, 7695, 0, 9, 1 },
+    { 12331, 7695, 1, 8, 1 },
+    { 12339, 7696, 0, 7, 1 },
+    { 12346, 7696, 3, 7, 0 },
+    { 12353, 7699, 8, 3, 0 },
+    { 12356, 7707, 0, 10, 2 },
+    { 12366, 7707, 0, 7, 2 },
+    { 12373, 7707, 0, 11, 1 },
+    { 12384, 7707, 2, 12, 0 },
+    { 12396, 7709, 0, 5, 1 },
+    { 12401, 7709, 0, 5, 1 },
+    { 12406, 7709, 0, 9, 1 },
+    { 11115, 7709, 0, 5, 1 },
+    { 10905, 7709, 0, 7, 1 },
+    { 12261, 7709, 0, 4, 1 },
+    { 1308, 7709, 0, 2, 1 },
+    { 1340, 7709, 0, 3, 1 },
+    { 2599, 7709, 0, 3, 1 },
+    { 4113, 7709, 0, 3, 1 },
+    { 50, 7709, 0, 2, 1 },
+    { 12415, 7709, 0, 2, 1 },
+    { 715, 7709, 0, 2, 1 },
+    { 12417, 7709, 0, 10, 1 },
+    { 1340, 7709, 1, 3, 1 },
+    { 12427, 7710, 0, 2, 1 },
+    { 1880, 7710, 0, 3, 1 },
+    { 2220, 7710, 0, 2, 1 },
+    { 2449, 7710, 0, 2, 1 },
+    { 2599, 7710, 0, 3, 1 },
+    { 2652, 7710, 0, 2, 1 },
+    { 12429, 7710, 0, 2, 1 },
+    { 12431, 7710, 0, 2, 1 },
+    { 12433, 7710, 0, 2, 1 },
+    { 12435, 7710, 0, 2, 1 },
+    { 12437, 7710, 0, 2, 1 },
+    { 12439, 7710, 0, 2, 1 },
+    { 2799, 7710, 0, 2, 1 },
+    { 12441, 7710, 0, 2, 1 },
+    { 2806, 7710, 0, 2, 1 },
+    { 12443, 7710, 0, 12, 1 },
+    { 12455, 7710, 0, 2, 1 },
+    { 12457, 7710, 0, 2, 1 },
+    { 12459, 7710, 0, 2, 1 },
+    { 12461, 7710, 0, 2, 1 },
+    { 3903, 7710, 0, 3, 1 },
+    { 3944, 7710, 0, 2, 1 },
+    { 4113, 7710, 0, 3, 1 },
+    { 12463, 7710, 0, 2, 1 },
+    { 12465, 7710, 0, 2, 1 },
+    { 4380, 7710, 0, 3, 1 },
+    { 12467, 7710, 0, 2, 1 },
+    { 12469, 7710, 1, 12, 0 },
+    { 5144, 7711, 0, 2, 1 },
+    { 5211, 7711, 0, 2, 1 },
+    { 5282, 7711, 0, 2, 1 },
+    { 5412, 7711, 0, 2, 1 },
+    { 5649, 7711, 0, 2, 1 },
+    { 5830, 7711, 0, 2, 1 },
+    { 6016, 7711, 0, 2, 1 },
+    { 12481, 7711, 0, 2, 1 },
+    { 6702, 7711, 0, 10, 1 },
+    { 7331, 7711, 0, 10, 1 },
+    { 12483, 7711, 0, 10, 1 },
+    { 12493, 7711, 0, 2, 1 },
+    { 12495, 7711, 0, 2, 1 },
+    { 12497, 7711, 0, 2, 1 },
+    { 9623, 7711, 0, 6, 1 },
+    { 12499, 7711, 0, 6, 1 },
+    { 9872, 7711, 0, 6, 1 },
+    { 12505, 7711, 0, 4, 1 },
+    { 12509, 7711, 0, 5, 1 },
+    { 1340, 7711, 1, 3, 1 },
+    { 12514, 7712, 0, 3, 1 },
+    { 1880, 7712, 0, 3, 1 },
+    { 12517, 7712, 1, 16, 1 },
+    { 12533, 7713, 0, 4, 1 },
+    { 2599, 7713, 0, 3, 1 },
+    { 3029, 7713, 0, 4, 1 },
+    { 3063, 7713, 0, 3, 1 },
+    { 12537, 7713, 0, 9, 1 },
+    { 12546, 7713, 0, 6, 1 },
+    { 3903, 7713, 0, 3, 1 },
+    { 12552, 7713, 0, 4, 1 },
+    { 12556, 7713, 0, 3, 1 },
+    { 4113, 7713, 0, 3, 1 },
+    { 10000, 7713, 0, 3, 1 },
+    { 4380, 7713, 0, 3, 1 },
+    { 12559, 7713, 0, 4, 2 },
+    { 11864, 7713, 0, 3, 1 },
+    { 12563, 7713, 1, 4, 1 },
+    { 12567, 7714, 0, 8, 1 },
+    { 10855, 7714, 0, 3, 1 },
+    { 12575, 7714, 0, 3, 2 },
+    { 12578, 7714, 0, 6, 1 },
+    { 12584, 7714, 0, 4, 2 },
+    { 12588, 7714, 0, 5, 1 },
+    { 12593, 7714, 0, 10, 1 },
+    { 12603, 7714, 0, 2, 1 },
+    { 12605, 7714, 1, 13, 1 },
+    { 126, 7715, 0, 6, 1 },
+    { 12618, 7715, 0, 10, 1 },
+    { 12628, 7715, 0, 13, 1 },
+    { 12641, 7715, 0, 10, 1 },
+    { 12651, 7715, 0, 17, 1 },
+    { 12668, 7715, 50, 9, 0 },
+    { 12677, 7765, 0, 10, 1 },
+    { 12687, 7765, 0, 8, 1 },
+    { 12695, 7765, 0, 8, 1 },
+    { 12703, 7765, 0, 14, 1 },
+    { 12717, 7765, 0, 19, 1 },
+    { 12736, 7765, 1, 7, 1 },
+    { 352, 7766, 0, 2, 1 },
+    { 12743, 7766, 0, 16, 1 },
+    { 12759, 7766, 0, 12, 1 },
+    { 12771, 7766, 0, 20, 1 },
+    { 12791, 7766, 0, 7, 1 },
+    { 12798, 7766, 0, 14, 1 },
+    { 12812, 7766, 0, 11, 1 },
+    { 12823, 7766, 0, 11, 1 },
+    { 12834, 7766, 0, 10, 1 },
+    { 12844, 7766, 0, 7, 1 },
+    { 10003, 7766, 0, 8, 1 },
+    { 12851, 7766, 0, 8, 1 },
+    { 12859, 7766, 0, 7, 1 },
+    { 12866, 7766, 2, 11, 1 },
+    { 12877, 7768, 0, 6, 1 },
+    { 12883, 7768, 0, 7, 1 },
+    { 854, 7768, 0, 2, 1 },
+    { 12890, 7768, 0, 13, 1 },
+    { 12903, 7768, 0, 5, 1 },
+    { 12417, 7768, 0, 10, 1 },
+    { 12908, 7768, 0, 7, 1 },
+    { 12915, 7768, 0, 7, 1 },
+    { 12922, 7768, 0, 10, 1 },
+    { 12932, 7768, 0, 12, 1 },
+    { 12944, 7768, 0, 15, 1 },
+    { 12959, 7768, 0, 15, 1 },
+    { 12974, 7768, 0, 15, 1 },
+    { 1306, 7768, 0, 2, 1 },
+    { 1308, 7768, 0, 2, 1 },
+    { 12989, 7768, 3, 4, 0 },
+    { 12993, 7771, 0, 8, 1 },
+    { 13001, 7771, 3, 12, 2 },
+    { 13013, 7774, 0, 10, 1 },
+    { 13023, 7774, 2, 10, 0 },
+    { 13033, 7776, 0, 10, 1 },
+    { 13043, 7776, 0, 10, 1 },
+    { 13053, 7776, 0, 8, 1 },
+    { 13061, 7776, 0, 5, 1 },
+    { 13066, 7776, 0, 8, 1 },
+    { 13074, 7776, 0, 8, 1 },
+    { 13082, 7776, 0, 8, 1 },
+    { 13090, 7776, 0, 8, 1 },
+    { 1638, 7776, 0, 2, 1 },
+    { 13098, 7776, 0, 15, 1 },
+    { 13113, 7776, 0, 13, 2 },
+    { 13126, 7776, 0, 18, 2 },
+    { 13144, 7776, 0, 11, 1 },
+    { 13155, 7776, 0, 10, 1 },
+    { 13165, 7776, 0, 11, 1 },
+    { 13176, 7776, 0, 8, 1 },
+    { 13184, 7776, 0, 7, 1 },
+    { 13191, 7776, 0, 10, 1 },
+    { 13201, 7776, 0, 11, 1 },
+    { 13212, 7776, 0, 9, 1 },
+    { 13221, 7776, 0, 7, 1 },
+    { 13228, 7776, 0, 6, 1 },
+    { 13234, 7776, 0, 8, 1 },
+    { 13242, 7776, 0, 12, 1 },
+    { 13254, 7776, 0, 7, 1 },
+    { 13261, 7776, 0, 10, 1 },
+    { 13271, 7776, 0, 8, 1 },
+    { 13279, 7776, 0, 14, 1 },
+    { 13293, 7776, 0, 14, 1 },
+    { 13307, 7776, 0, 11, 1 },
+    { 13318, 7776, 0, 11, 1 },
+    { 13329, 7776, 0, 11, 1 },
+    { 13340, 7776, 0, 9, 1 },
+    { 13349, 7776, 0, 11, 1 },
+    { 13360, 7776, 0, 13, 1 },
+    { 13373, 7776, 0, 11, 1 },
+    { 13384, 7776, 0, 13, 1 },
+    { 13397, 7776, 0, 13, 1 },
+    { 13410, 7776, 0, 10, 1 },
+    { 13420, 7776, 0, 11, 1 },
+    { 13431, 7776, 0, 11, 1 },
+    { 13442, 7776, 0, 5, 1 },
+    { 13447, 7776, 17, 16, 1 },
+    { 13463, 7793, 0, 9, 1 },
+    { 13472, 7793, 0, 15, 1 },
+    { 13487, 7793, 0, 15, 1 },
+    { 13502, 7793, 0, 13, 1 },
+    { 13515, 7793, 0, 16, 1 },
+    { 1992, 7793, 0, 2, 1 },
+    { 13531, 7793, 8, 8, 0 },
+    { 13539, 7801, 0, 8, 1 },
+    { 13547, 7801, 0, 11, 1 },
+    { 13558, 7801, 0, 16, 1 },
+    { 13574, 7801, 0, 14, 1 },
+    { 13588, 7801, 1, 5, 0 },
+    { 13593, 7802, 0, 11, 1 },
+    { 13604, 7802, 0, 16, 1 },
+    { 13620, 7802, 0, 5, 1 },
+    { 13625, 7802, 0, 11, 1 },
+    { 13636, 7802, 0, 12, 1 },
+    { 13648, 7802, 0, 10, 1 },
+    { 13658, 7802, 0, 9, 1 },
+    { 13667, 7802, 0, 8, 1 },
+    { 13675, 7802, 0, 7, 1 },
+    { 13682, 7802, 0, 7, 1 },
+    { 13689, 7802, 0, 7, 1 },
+    { 13696, 7802, 0, 7, 1 },
+    { 13703, 7802, 0, 7, 1 },
+    { 13710, 7802, 0, 7, 1 },
+    { 13717, 7802, 0, 7, 1 },
+    { 13724, 7802, 0, 7, 1 },
+    { 13731, 7802, 0, 7, 1 },
+    { 13738, 7802, 0, 7, 1 },
+    { 13745, 7802, 0, 7, 1 },
+    { 13752, 7802, 0, 7, 1 },
+    { 13759, 7802, 0, 7, 1 },
+    { 13766, 7802, 0, 7, 1 },
+    { 13773, 7802, 0, 7, 1 },
+    { 13780, 7802, 0, 7, 1 },
+    { 13787, 7802, 0, 7, 1 },
+    { 13794, 7802, 0, 7, 1 },
+    { 13801, 7802, 0, 7, 1 },
+    { 13808, 7802, 0, 7, 1 },
+    { 13815, 7802, 0, 7, 1 },
+    { 13822, 7802, 0, 7, 1 },
+    { 13829, 7802, 0, 7, 1 },
+    { 13836, 7802, 0, 7, 1 },
+    { 13843, 7802, 0, 7, 1 },
+    { 13850, 7802, 0, 7, 1 },
+    { 13857, 7802, 0, 7, 1 },
+    { 13864, 7802, 0, 7, 1 },
+    { 13871, 7802, 0, 7, 1 },
+    { 13878, 7802, 0, 7, 1 },
+    { 13885, 7802, 0, 7, 1 },
+    { 13892, 7802, 0, 7, 1 },
+    { 13899, 7802, 0, 7, 1 },
+    { 13906, 7802, 0, 7, 1 },
+    { 13913, 7802, 0, 7, 1 },
+    { 13920, 7802, 0, 7, 1 },
+    { 13927, 7802, 0, 7, 1 },
+    { 13934, 7802, 0, 7, 1 },
+    { 13941, 7802, 0, 7, 1 },
+    { 13948, 7802, 0, 7, 1 },
+    { 13955, 7802, 0, 7, 1 },
+    { 13962, 7802, 0, 7, 1 },
+    { 13969, 7802, 0, 7, 1 },
+    { 13976, 7802, 0, 7, 1 },
+    { 13983, 7802, 0, 7, 1 },
+    { 13990, 7802, 0, 7, 1 },
+    { 13997, 7802, 0, 7, 1 },
+    { 14004, 7802, 0, 10, 1 },
+    { 14014, 7802, 0, 8, 1 },
+    { 14022, 7802, 0, 12, 1 },
+    { 14034, 7802, 0, 7, 1 },
+    { 14041, 7802, 0, 5, 1 },
+    { 14046, 7802, 0, 17, 1 },
+    { 14063, 7802, 0, 6, 1 },
+    { 14069, 7802, 0, 10, 1 },
+    { 14079, 7802, 0, 10, 1 },
+    { 12145, 7802, 0, 6, 1 },
+    { 14089, 7802, 0, 11, 1 },
+    { 2606, 7802, 0, 2, 1 },
+    { 14100, 7802, 0, 17, 1 },
+    { 14117, 7802, 0, 9, 1 },
+    { 14126, 7802, 0, 9, 1 },
+    { 14135, 7802, 0, 6, 1 },
+    { 2799, 7802, 0, 2, 1 },
+    { 14141, 7802, 0, 10, 1 },
+    { 14151, 7802, 0, 9, 1 },
+    { 14160, 7802, 0, 15, 1 },
+    { 14175, 7802, 0, 14, 1 },
+    { 14189, 7802, 0, 8, 1 },
+    { 14197, 7802, 1, 18, 0 },
+    { 14215, 7803, 0, 8, 1 },
+    { 14223, 7803, 2, 7, 0 },
+    { 14230, 7805, 0, 15, 1 },
+    { 2929, 7805, 0, 2, 1 },
+    { 14245, 7805, 0, 9, 1 },
+    { 14254, 7805, 2, 9, 0 },
+    { 14263, 7807, 0, 9, 1 },
+    { 14272, 7807, 0, 12, 1 },
+    { 14284, 7807, 0, 14, 1 },
+    { 14298, 7807, 0, 12, 1 },
+    { 14310, 7807, 0, 15, 1 },
+    { 14325, 7807, 0, 14, 1 },
+    { 14339, 7807, 0, 12, 1 },
+    { 14351, 7807, 0, 9, 1 },
+    { 14360, 7807, 0, 17, 1 },
+    { 14377, 7807, 0, 8, 1 },
+    { 14385, 7807, 0, 18, 1 },
+    { 14403, 7807, 0, 13, 1 },
+    { 14416, 7807, 0, 13, 1 },
+    { 14429, 7807, 0, 11, 1 },
+    { 14440, 7807, 0, 21, 1 },
+    { 14461, 7807, 0, 9, 1 },
+    { 14470, 7807, 0, 10, 1 },
+    { 14480, 7807, 0, 9, 1 },
+    { 14489, 7807, 0, 16, 1 },
+    { 14505, 7807, 0, 11, 1 },
+    { 14516, 7807, 0, 15, 1 },
+    { 14531, 7807, 0, 11, 1 },
+    { 14542, 7807, 0, 12, 1 },
+    { 14554, 7807, 0, 16, 1 },
+    { 14570, 7807, 0, 10, 1 },
+    { 14580, 7807, 0, 13, 1 },
+    { 14593, 7807, 0, 14, 1 },
+    { 14607, 7807, 0, 10, 1 },
+    { 14617, 7807, 0, 12, 1 },
+    { 14629, 7807, 0, 20, 1 },
+    { 14649, 7807, 0, 17, 1 },
+    { 14666, 7807, 0, 11, 1 },
+    { 14677, 7807, 0, 15, 1 },
+    { 14692, 7807, 0, 13, 1 },
+    { 14705, 7807, 0, 14, 1 },
+    { 14719, 7807, 0, 12, 1 },
+    { 14731, 7807, 0, 12, 1 },
+    { 14743, 7807, 0, 11, 1 },
+    { 14754, 7807, 0, 14, 1 },
+    { 14768, 7807, 0, 16, 1 },
+    { 14784, 7807, 0, 11, 1 },
+    { 14795, 7807, 0, 13, 1 },
+    { 14808, 7807, 0, 15, 1 },
+    { 14823, 7807, 0, 12, 1 },
+    { 14835, 7807, 0, 14, 1 },
+    { 14849, 7807, 0, 17, 1 },
+    { 14866, 7807, 0, 12, 1 },
+    { 14878, 7807, 0, 7, 1 },
+    { 14885, 7807, 0, 13, 1 },
+    { 14898, 7807, 0, 12, 1 },
+    { 14910, 7807, 0, 16, 1 },
+    { 14926, 7807, 0, 13, 1 },
+    { 14939, 7807, 0, 7, 1 },
+    { 14946, 7807, 0, 16, 1 },
+    { 14962, 7807, 0, 8, 1 },
+    { 14970, 7807, 0, 11, 1 },
+    { 14981, 7807, 0, 15, 1 },
+    { 14996, 7807, 0, 8, 1 },
+    { 15004, 7807, 0, 13, 1 },
+    { 15017, 7807, 0, 16, 1 },
+    { 3135, 7807, 0, 2, 1 },
+    { 15033, 7807, 0, 9, 1 },
+    { 12253, 7807, 1, 8, 0 },
+    { 15042, 7808, 1, 6, 0 },
+    { 15048, 7809, 0, 3, 1 },
+    { 15051, 7809, 0, 9, 1 },
+    { 15060, 7809, 0, 9, 1 },
+    { 15069, 7809, 0, 5, 1 },
+    { 3359, 7809, 0, 2, 1 },
+    { 15074, 7809, 0, 8, 1 },
+    { 15082, 7809, 0, 9, 1 },
+    { 15091, 7809, 0, 10, 1 },
+    { 15101, 7809, 2, 6, 0 },
+    { 15107, 7811, 0, 13, 2 },
+    { 15120, 7811, 1, 17, 0 },
+    { 15137, 7812, 1, 4, 0 },
+    { 15141, 7813, 0, 6, 1 },
+    { 15147, 7813, 0, 10, 1 },
+    { 15157, 7813, 0, 13, 1 },
+    { 15170, 7813, 1, 11, 0 },
+    { 15181, 7814, 0, 8, 1 },
+    { 15189, 7814, 0, 11, 1 },
+    { 15200, 7814, 1, 9, 1 },
+    { 15209, 7815, 0, 3, 1 },
+    { 15212, 7815, 0, 10, 1 },
+    { 15222, 7815, 0, 17, 1 },
+    { 15239, 7815, 0, 9, 1 },
+    { 15248, 7815, 0, 7, 1 },
+    { 15255, 7815, 0, 8, 1 },
+    { 15263, 7815, 0, 7, 1 },
+    { 15270, 7815, 0, 8, 1 },
+    { 15278, 7815, 0, 11, 1 },
+    { 15289, 7815, 0, 16, 1 },
+    { 15305, 7815, 0, 12, 1 },
+    { 15317, 7815, 0, 9, 1 },
+    { 10988, 7815, 0, 12, 1 },
+    { 15326, 7815, 0, 7, 1 },
+    { 15333, 7815, 11, 13, 0 },
+    { 15346, 7826, 0, 8, 1 },
+    { 15354, 7826, 0, 5, 1 },
+    { 15359, 7826, 0, 8, 1 },
+    { 15367, 7826, 0, 10, 1 },
+    { 15377, 7826, 0, 7, 1 },
+    { 4217, 7826, 0, 2, 1 },
+    { 15384, 7826, 1, 11, 0 },
+    { 15395, 7827, 1, 21, 0 },
+    { 15416, 7828, 0, 10, 1 },
+    { 15426, 7828, 0, 9, 1 },
+    { 15435, 7828, 0, 8, 1 },
+    { 15443, 7828, 0, 9, 1 },
+    { 15452, 7828, 0, 5, 1 },
+    { 15457, 7828, 0, 10, 1 },
+    { 15467, 7828, 0, 7, 1 },
+    { 15474, 7828, 0, 15, 1 },
+    { 15489, 7828, 0, 11, 1 },
+    { 15500, 7828, 0, 12, 1 },
+    { 15512, 7828, 0, 18, 1 },
+    { 15530, 7828, 0, 6, 1 },
+    { 15536, 7828, 0, 8, 2 },
+    { 15544, 7828, 0, 5, 1 },
+    { 15549, 7828, 0, 8, 1 },
+    { 15557, 7828, 0, 11, 1 },
+    { 15568, 7828, 0, 17, 1 },
+    { 15585, 7828, 0, 7, 1 },
+    { 15592, 7828, 0, 10, 1 },
+    { 15602, 7828, 0, 12, 1 },
+    { 15614, 7828, 1, 5, 0 },
+    { 15619, 7829, 0, 12, 1 },
+    { 15631, 7829, 1, 14, 1 },
+    { 15645, 7830, 0, 3, 1 },
+    { 15648, 7830, 0, 6, 1 },
+    { 12055, 7830, 0, 2, 1 },
+    { 15654, 7830, 0, 11, 1 },
+    { 15665, 7830, 0, 10, 1 },
+    { 15675, 7830, 0, 12, 2 },
+    { 15687, 7830, 0, 8, 1 },
+    { 15695, 7830, 0, 8, 1 },
+    { 15703, 7830, 1, 6, 0 },
+    { 15709, 7831, 0, 7, 1 },
+    { 15716, 7831, 0, 14, 1 },
+    { 15730, 7831, 0, 7, 1 },
+    { 5015, 7831, 0, 2, 1 },
+    { 5040, 7831, 0, 2, 1 },
+    { 15737, 7831, 0, 16, 1 },
+    { 15753, 7831, 0, 7, 1 },
+    { 15760, 7831, 0, 15, 1 },
+    { 11224, 7831, 0, 6, 1 },
+    { 15775, 7831, 0, 14, 1 },
+    { 15789, 7831, 0, 11, 1 },
+    { 15800, 7831, 0, 8, 1 },
+    { 15808, 7831, 0, 9, 1 },
+    { 15817, 7831, 0, 18, 1 },
+    { 15835, 7831, 0, 13, 1 },
+    { 15848, 7831, 0, 8, 1 },
+    { 15856, 7831, 0, 9, 1 },
+    { 15865, 7831, 0, 13, 1 },
+    { 15878, 7831, 0, 9, 1 },
+    { 15887, 7831, 0, 11, 1 },
+    { 15898, 7831, 0, 8, 1 },
+    { 15906, 7831, 0, 8, 1 },
+    { 15914, 7831, 0, 8, 1 },
+    { 15922, 7831, 0, 9, 1 },
+    { 15931, 7831, 0, 10, 1 },
+    { 15941, 7831, 0, 12, 1 },
+    { 15953, 7831, 0, 10, 1 },
+    { 15963, 7831, 0, 7, 1 },
+    { 15970, 7831, 0, 10, 1 },
+    { 15980, 7831, 0, 10, 1 },
+    { 15990, 7831, 0, 7, 1 },
+    { 15997, 7831, 0, 10, 1 },
+    { 16007, 7831, 0, 8, 1 },
+    { 16015, 7831, 0, 13, 1 },
+    { 16028, 7831, 0, 17, 1 },
+    { 16045, 7831, 1, 6, 0 },
+    { 16051, 7832, 0, 12, 1 },
+    { 16063, 7832, 0, 11, 1 },
+    { 16074, 7832, 1, 10, 0 },
+    { 16084, 7833, 0, 12, 1 },
+    { 16096, 7833, 0, 8, 1 },
+    { 16104, 7833, 0, 9, 1 },
+    { 16113, 7833, 0, 13, 1 },
+    { 16126, 7833, 0, 16, 1 },
+    { 16142, 7833, 0, 12, 1 },
+    { 16154, 7833, 0, 13, 1 },
+    { 16167, 7833, 0, 15, 1 },
+    { 16182, 7833, 1, 8, 0 },
+    { 6032, 7834, 0, 2, 1 },
+    { 16190, 7834, 0, 13, 1 },
+    { 6059, 7834, 0, 2, 1 },
+    { 6061, 7834, 0, 2, 1 },
+    { 16203, 7834, 0, 10, 1 },
+    { 16213, 7834, 0, 12, 2 },
+    { 16225, 7834, 3, 10, 0 },
+    { 16235, 7837, 0, 10, 1 },
+    { 16245, 7837, 1, 8, 0 },
+    { 16253, 7838, 0, 10, 1 },
+    { 16263, 7838, 0, 11, 1 },
+    { 16274, 7838, 0, 7, 1 },
+    { 16281, 7838, 0, 12, 1 },
+    { 16293, 7838, 0, 12, 1 },
+    { 16305, 7838, 0, 10, 1 },
+    { 16315, 7838, 1, 15, 1 },
+    { 16330, 7839, 0, 12, 1 },
+    { 16342, 7839, 0, 7, 1 },
+    { 16349, 7839, 0, 14, 1 },
+    { 16363, 7839, 2, 5, 1 },
+    { 16368, 7841, 0, 8, 1 },
+    { 8514, 7841, 0, 2, 1 },
+    { 16376, 7841, 0, 7, 1 },
+    { 16383, 7841, 0, 3, 1 },
+    { 12339, 7841, 0, 7, 1 },
+    { 1638, 7841, 0, 2, 1 },
+    { 12237, 7841, 0, 9, 1 },
+    { 50, 7841, 0, 2, 1 },
+    { 1308, 7841, 0, 2, 1 },
+    { 10648, 7841, 0, 2, 1 },
+    { 2135, 7841, 0, 2, 1 },
+    { 12188, 7841, 0, 2, 1 },
+    { 11000, 7841, 0, 2, 1 },
+    { 5040, 7841, 0, 2, 1 },
+    { 1340, 7841, 0, 3, 1 },
+    { 1880, 7841, 0, 3, 1 },
+    { 2599, 7841, 0, 3, 1 },
+    { 11730, 7841, 0, 3, 1 },
+    { 4113, 7841, 0, 3, 1 },
+    { 4380, 7841, 0, 3, 1 },
+    { 10003, 7841, 0, 8, 1 },
+    { 1340, 7841, 0, 3, 1 },
+    { 1880, 7841, 0, 3, 1 },
+    { 3063, 7841, 0, 3, 1 },
+    { 16386, 7841, 0, 4, 1 },
+    { 4380, 7841, 0, 3, 1 },
+    { 1340, 7841, 0, 3, 1 },
+    { 1880, 7841, 0, 3, 1 },
+    { 4113, 7841, 0, 3, 1 },
+    { 4380, 7841, 0, 3, 1 },
+    { 16390, 7841, 0, 3, 1 },
+    { 2599, 7841, 0, 3, 1 },
+    { 3029, 7841, 0, 4, 1 },
+    { 50, 7841, 0, 2, 1 },
+    { 712, 7841, 0, 3, 1 },
+    { 1340, 7841, 2, 3, 1 },
+    { 16393, 7843, 0, 7, 1 },
+    { 2599, 7843, 0, 3, 1 },
+    { 3686, 7843, 0, 3, 1 },
+    { 3903, 7843, 0, 3, 1 },
+    { 4113, 7843, 0, 3, 1 },
+    { 4380, 7843, 0, 3, 1 },
+    { 4667, 7843, 0, 5, 1 },
+    { 4677, 7843, 0, 3, 1 },
+    { 5851, 7843, 0, 2, 1 },
+    { 10003, 7843, 0, 8, 1 },
+    { 1308, 7843, 0, 2, 1 },
+    { 16400, 7843, 0, 2, 1 },
+    { 16402, 7843, 2, 11, 0 },
+    { 16413, 7845, 1, 4, 0 },
+    { 16417, 7846, 0, 5, 1 },
+    { 10912, 7846, 0, 11, 1 },
+    { 10923, 7846, 0, 4, 1 },
+    { 10927, 7846, 0, 3, 1 },
+    { 10930, 7846, 0, 5, 1 },
+    { 11115, 7846, 0, 5, 1 },
+    { 10003, 7846, 0, 8, 1 },
+    { 12883, 7846, 0, 7, 1 },
+    { 1340, 7846, 0, 3, 1 },
+    { 16422, 7846, 0, 13, 1 },
+    { 16435, 7846, 1, 7, 0 },
+    { 16442, 7847, 0, 6, 1 },
+    { 16448, 7847, 2, 5, 1 },
+    { 16453, 7849, 0, 18, 1 },
+    { 16471, 7849, 0, 7, 1 },
+    { 16478, 7849, 0, 10, 1 },
+    { 16488, 7849, 0, 8, 1 },
+    { 16496, 7849, 0, 7, 1 },
+    { 16503, 7849, 0, 10, 1 },
+    { 16513, 7849, 0, 8, 1 },
+    { 16521, 7849, 0, 7, 1 },
+    { 16528, 7849, 0, 15, 1 },
+    { 16543, 7849, 0, 7, 1 },
+    { 16550, 7849, 0, 6, 1 },
+    { 13604, 7849, 0, 16, 1 },
+    { 16556, 7849, 0, 6, 2 },
+    { 16562, 7849, 0, 15, 1 },
+    { 16577, 7849, 0, 9, 1 },
+    { 16586, 7849, 0, 4, 1 },
+    { 16590, 7849, 0, 17, 1 },
+    { 16607, 7849, 0, 15, 1 },
+    { 16622, 7849, 1, 14, 1 },
+    { 16636, 7850, 1, 12, 0 },
+    { 16648, 7851, 0, 9, 1 },
+    { 16657, 7851, 0, 6, 1 },
+    { 16663, 7851, 0, 9, 1 },
+    { 16672, 7851, 0, 6, 1 },
+    { 16678, 7851, 0, 6, 1 },
+    { 16684, 7851, 0, 12, 1 },
+    { 16696, 7851, 0, 11, 1 },
+    { 16707, 7851, 0, 10, 1 },
+    { 16717, 7851, 0, 7, 1 },
+    { 16724, 7851, 0, 10, 1 },
+    { 16734, 7851, 0, 9, 1 },
+    { 16743, 7851, 0, 12, 1 },
+    { 16755, 7851, 0, 10, 1 },
+    { 16765, 7851, 0, 10, 1 },
+    { 10979, 7851, 0, 9, 1 },
+    { 15141, 7851, 0, 6, 1 },
+    { 16775, 7851, 0, 10, 1 },
+    { 16785, 7851, 0, 10, 1 },
+    { 16795, 7851, 0, 10, 1 },
+    { 16805, 7851, 0, 9, 1 },
+    { 16814, 7851, 0, 8, 1 },
+    { 16822, 7851, 0, 6, 1 },
+    { 16828, 7851, 0, 13, 1 },
+    { 10988, 7851, 0, 12, 1 },
+    { 16841, 7851, 0, 14, 1 },
+    { 16855, 7851, 0, 11, 1 },
+    { 16866, 7851, 0, 5, 1 },
+    { 16871, 7851, 1, 12, 0 },
+    { 12165, 7852, 0, 7, 1 },
+    { 16883, 7852, 0, 9, 1 },
+    { 16892, 7852, 0, 7, 1 },
+    { 16899, 7852, 0, 20, 1 },
+    { 16919, 7852, 0, 11, 1 },
+    { 16930, 7852, 0, 10, 1 },
+    { 16940, 7852, 0, 10, 1 },
+    { 16950, 7852, 0, 13, 1 },
+    { 16963, 7852, 0, 9, 2 },
+    { 16972, 7852, 0, 12, 1 },
+    { 16984, 7852, 0, 11, 1 },
+    { 16995, 7852, 0, 23, 1 },
+    { 17018, 7852, 0, 21, 1 },
+    { 17039, 7852, 0, 3, 1 },
+    { 17042, 7852, 0, 8, 1 },
+    { 17050, 7852, 0, 4, 1 },
+    { 17054, 7852, 0, 4, 1 },
+    { 17058, 7852, 0, 12, 1 },
+    { 10686, 7852, 0, 4, 1 },
+    { 2255, 7852, 0, 3, 1 },
+    { 17070, 7852, 0, 7, 2 },
+    { 17077, 7852, 0, 13, 1 },
+    { 17090, 7852, 0, 5, 1 },
+    { 17095, 7852, 0, 3, 2 },
+    { 17098, 7852, 0, 8, 2 },
+    { 17106, 7852, 1, 9, 0 },
+    { 10742, 7853, 0, 9, 1 },
+    { 12015, 7853, 0, 9, 1 },
+    { 17115, 7853, 0, 5, 1 },
+    { 15557, 7853, 0, 11, 1 },
+    { 17120, 7853, 0, 2, 1 },
+    { 17122, 7853, 0, 11, 1 },
+    { 17133, 7853, 0, 3, 2 },
+    { 17136, 7853, 0, 8, 2 },
+    { 10849, 7853, 0, 6, 1 },
+    { 17144, 7853, 0, 7, 2 },
+    { 17151, 7853, 0, 7, 1 },
+    { 17158, 7853, 1, 9, 1 },
+    { 17167, 7854, 0, 13, 1 },
+    { 712, 7854, 0, 3, 1 },
+    { 10003, 7854, 0, 8, 1 },
+    { 1308, 7854, 0, 2, 1 },
+    { 12533, 7854, 0, 4, 1 },
+    { 10988, 7854, 0, 12, 1 },
+    { 17180, 7854, 0, 3, 1 },
+    { 5564, 7854, 0, 5, 1 },
+    { 1340, 7854, 0, 3, 1 },
+    { 1880, 7854, 0, 3, 1 },
+    { 2599, 7854, 0, 3, 1 },
+    { 4113, 7854, 0, 3, 1 },
+    { 4380, 7854, 0, 3, 1 },
+    { 377, 7854, 0, 3, 1 },
+    { 1340, 7854, 0, 3, 1 },
+    { 1880, 7854, 0, 3, 1 },
+    { 10863, 7854, 0, 3, 1 },
+    { 2599, 7854, 0, 3, 1 },
+    { 3903, 7854, 0, 3, 1 },
+    { 4113, 7854, 0, 3, 1 },
+    { 4380, 7854, 0, 3, 1 },
+    { 17183, 7854, 0, 3, 1 },
+    { 10855, 7854, 0, 3, 1 },
+    { 377, 7854, 0, 3, 1 },
+    { 12172, 7854, 0, 4, 1 },
+    { 1340, 7854, 0, 3, 1 },
+    { 1880, 7854, 0, 3, 1 },
+    { 2599, 7854, 0, 3, 1 },
+    { 4113, 7854, 0, 3, 1 },
+    { 4380, 7854, 0, 3, 1 },
+    { 17186, 7854, 0, 3, 1 },
+    { 17189, 7854, 0, 3, 1 },
+    { 5851, 7854, 0, 2, 1 },
+    { 17192, 7854, 1, 5, 2 },
+    { 17197, 7855, 0, 4, 1 },
+    { 1340, 7855, 0, 3, 1 },
+    { 1880, 7855, 0, 3, 1 },
+    { 12185, 7855, 0, 3, 1 },
+    { 10863, 7855, 0, 3, 1 },
+    { 2599, 7855, 0, 3, 1 },
+    { 3029, 7855, 0, 4, 1 },
+    { 17201, 7855, 0, 3, 1 },
+    { 3837, 7855, 0, 3, 1 },
+    { 3903, 7855, 0, 3, 1 },
+    { 4113, 7855, 0, 3, 1 },
+    { 9992, 7855, 0, 8, 1 },
+    { 4380, 7855, 0, 3, 1 },
+    { 4677, 7855, 0, 3, 1 },
+    { 17204, 7855, 1, 3, 0 },
+    { 1308, 7856, 0, 2, 1 },
+    { 17207, 7856, 0, 3, 1 },
+    { 1340, 7856, 1, 3, 1 },
+    { 1880, 7857, 0, 3, 1 },
+    { 17210, 7857, 0, 3, 1 },
+    { 2599, 7857, 0, 3, 1 },
+    { 17213, 7857, 0, 3, 1 },
+    { 3837, 7857, 0, 3, 1 },
+    { 4380, 7857, 0, 3, 1 },
+    { 17216, 7857, 0, 3, 1 },
+    { 17219, 7857, 0, 4, 1 },
+    { 1340, 7857, 1, 3, 1 },
+    { 1880, 7858, 0, 3, 1 },
+    { 17223, 7858, 0, 3, 1 },
+    { 2599, 7858, 0, 3, 1 },
+    { 3903, 7858, 0, 3, 1 },
+    { 4089, 7858, 0, 4, 1 },
+    { 4113, 7858, 0, 3, 1 },
+    { 4380, 7858, 0, 3, 1 },
+    { 17226, 7858, 0, 3, 1 },
+    { 17229, 7858, 0, 8, 1 },
+    { 1340, 7858, 1, 3, 1 },
+    { 1880, 7859, 0, 3, 1 },
+    { 10863, 7859, 0, 3, 1 },
+    { 10988, 7859, 0, 12, 1 },
+    { 10000, 7859, 0, 3, 1 },
+    { 4380, 7859, 0, 3, 1 },
+    { 17237, 7859, 0, 7, 2 },
+    { 712, 7859, 0, 3, 1 },
+    { 1340, 7859, 0, 3, 1 },
+    { 1880, 7859, 0, 3, 1 },
+    { 2599, 7859, 0, 3, 1 },
+    { 3029, 7859, 0, 4, 1 },
+    { 4089, 7859, 0, 4, 1 },
+    { 4113, 7859, 0, 3, 1 },
+    { 4380, 7859, 0, 3, 1 },
+    { 12618, 7859, 0, 10, 1 },
+    { 11115, 7859, 0, 5, 1 },
+    { 10905, 7859, 0, 7, 1 },
+    { 17244, 7859, 0, 11, 1 },
+    { 17255, 7859, 1, 6, 0 },
+    { 17261, 7860, 0, 4, 1 },
+    { 16866, 7860, 0, 5, 1 },
+    { 11085, 7860, 0, 8, 2 },
+    { 17265, 7860, 0, 13, 1 },
+    { 4451, 7860, 1, 5, 0 },
+    { 1308, 7861, 0, 2, 1 },
+    { 17278, 7861, 0, 6, 1 },
+    { 17284, 7861, 0, 3, 1 },
+    { 17287, 7861, 0, 5, 1 },
+    { 17292, 7861, 0, 11, 1 },
+    { 17303, 7861, 0, 5, 1 },
+    { 10003, 7861, 0, 8, 1 },
+    { 17308, 7861, 1, 13, 0 },
+    { 17321, 7862, 2, 10, 0 },
+    { 17331, 7864, 0, 2, 1 },
+    { 17333, 7864, 0, 9, 1 },
+    { 17342, 7864, 0, 3, 1 },
+    { 17345, 7864, 0, 5, 1 },
+    { 10988, 7864, 0, 12, 1 },
+    { 17350, 7864, 0, 15, 1 },
+    { 1308, 7864, 0, 2, 1 },
+    { 50, 7864, 0, 2, 1 },
+    { 712, 7864, 0, 3, 1 },
+    { 1340, 7864, 0, 3, 1 },
+    { 2599, 7864, 0, 3, 1 },
+    { 3029, 7864, 0, 4, 1 },
+    { 3903, 7864, 0, 3, 1 },
+    { 4089, 7864, 0, 4, 1 },
+    { 4113, 7864, 0, 3, 1 },
+    { 4380, 7864, 0, 3, 1 },
+    { 4677, 7864, 0, 3, 1 },
+    { 1340, 7864, 0, 3, 1 },
+    { 1880, 7864, 0, 3, 1 },
+    { 4113, 7864, 0, 3, 1 },
+    { 4380, 7864, 0, 3, 1 },
+    { 4793, 7864, 0, 5, 1 },
+    { 17365, 7864, 0, 4, 2 },
+    { 17369, 7864, 0, 10, 1 },
+    { 17379, 7864, 0, 8, 1 },
+    { 12172, 7864, 0, 4, 1 },
+    { 17387, 7864, 0, 6, 1 },
+    { 17393, 7864, 0, 6, 1 },
+    { 10003, 7864, 0, 8, 1 },
+    { 17399, 7864, 0, 3, 1 },
+    { 17402, 7864, 0, 9, 1 },
+    { 17411, 7864, 0, 21, 1 },
+    { 17432, 7864, 0, 31, 1 },
+    { 1340, 7864, 0, 3, 1 },
+    { 17463, 7864, 0, 7, 1 },
+    { 17470, 7864, 0, 7, 1 },
+    { 17477, 7864, 0, 18, 1 },
+    { 17495, 7864, 0, 6, 1 },
+    { 17501, 7864, 0, 5, 1 },
+    { 13648, 7864, 0, 10, 1 },
+    { 13658, 7864, 0, 9, 1 },
+    { 17506, 7864, 0, 15, 1 },
+    { 17521, 7864, 0, 7, 1 },
+    { 12190, 7864, 0, 4, 1 },
+    { 17528, 7864, 0, 5, 1 },
+    { 17533, 7864, 0, 16, 1 },
+    { 17549, 7864, 0, 7, 1 },
+    { 10988, 7864, 0, 12, 1 },
+    { 10000, 7864, 0, 3, 1 },
+    { 17556, 7864, 0, 8, 1 },
+    { 17564, 7864, 0, 6, 1 },
+    { 17570, 7864, 0, 10, 1 },
+    { 17580, 7864, 0, 4, 1 },
+    { 17584, 7864, 0, 3, 1 },
+    { 5851, 7864, 0, 2, 1 },
+    { 17587, 7864, 0, 11, 1 },
+    { 17598, 7864, 0, 3, 1 },
+    { 1880, 7864, 0, 3, 1 },
+    { 2599, 7864, 0, 3, 1 },
+    { 17601, 7864, 0, 4, 1 },
+    { 1340, 7864, 0, 3, 1 },
+    { 1880, 7864, 0, 3, 1 },
+    { 2599, 7864, 0, 3, 1 },
+    { 3903, 7864, 0, 3, 1 },
+    { 4113, 7864, 0, 3, 1 },
+    { 4380, 7864, 0, 3, 1 },
+    { 17605, 7864, 0, 3, 1 },
+    { 1308, 7864, 0, 2, 1 },
+    { 17608, 7864, 0, 3, 1 },
+    { 17611, 7864, 0, 4, 1 },
+    { 4113, 7864, 0, 3, 1 },
+    { 4380, 7864, 0, 3, 1 },
+    { 17615, 7864, 1, 5, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 2599, 7865, 0, 3, 1 },
+    { 3903, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 2599, 7865, 0, 3, 1 },
+    { 3686, 7865, 0, 3, 1 },
+    { 17620, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 712, 7865, 0, 3, 1 },
+    { 1308, 7865, 0, 2, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 17623, 7865, 0, 2, 1 },
+    { 50, 7865, 0, 2, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 2599, 7865, 0, 3, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 1288, 7865, 0, 5, 1 },
+    { 17625, 7865, 0, 9, 1 },
+    { 17634, 7865, 0, 11, 2 },
+    { 333, 7865, 0, 3, 1 },
+    { 12172, 7865, 0, 4, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 3946, 7865, 0, 4, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 10003, 7865, 0, 8, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 2599, 7865, 0, 3, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 15980, 7865, 0, 10, 1 },
+    { 17645, 7865, 0, 9, 1 },
+    { 744, 7865, 0, 4, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1638, 7865, 0, 2, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 10863, 7865, 0, 3, 1 },
+    { 11727, 7865, 0, 3, 1 },
+    { 3903, 7865, 0, 3, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 5860, 7865, 0, 2, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 2599, 7865, 0, 3, 1 },
+    { 17654, 7865, 0, 4, 1 },
+    { 3029, 7865, 0, 4, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 10855, 7865, 0, 3, 1 },
+    { 630, 7865, 0, 2, 1 },
+    { 1308, 7865, 0, 2, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 2599, 7865, 0, 3, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 17658, 7865, 0, 3, 1 },
+    { 10003, 7865, 0, 8, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 2599, 7865, 0, 3, 1 },
+    { 17661, 7865, 0, 3, 1 },
+    { 3008, 7865, 0, 3, 1 },
+    { 3686, 7865, 0, 3, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 17664, 7865, 0, 6, 1 },
+    { 6702, 7865, 0, 10, 1 },
+    { 17670, 7865, 0, 9, 1 },
+    { 17679, 7865, 0, 11, 1 },
+    { 17690, 7865, 0, 10, 1 },
+    { 7331, 7865, 0, 10, 1 },
+    { 17700, 7865, 0, 11, 1 },
+    { 17711, 7865, 0, 10, 1 },
+    { 7918, 7865, 0, 10, 1 },
+    { 12483, 7865, 0, 10, 1 },
+    { 17721, 7865, 0, 11, 1 },
+    { 17732, 7865, 0, 9, 1 },
+    { 17741, 7865, 0, 10, 1 },
+    { 17751, 7865, 0, 11, 1 },
+    { 17762, 7865, 0, 11, 1 },
+    { 17773, 7865, 0, 10, 1 },
+    { 17783, 7865, 0, 6, 1 },
+    { 17789, 7865, 0, 6, 1 },
+    { 9623, 7865, 0, 6, 1 },
+    { 9764, 7865, 0, 6, 1 },
+    { 17795, 7865, 0, 6, 1 },
+    { 17801, 7865, 0, 6, 1 },
+    { 17807, 7865, 0, 6, 1 },
+    { 17813, 7865, 0, 6, 1 },
+    { 17819, 7865, 0, 6, 1 },
+    { 12499, 7865, 0, 6, 1 },
+    { 17825, 7865, 0, 6, 1 },
+    { 17831, 7865, 0, 6, 1 },
+    { 17837, 7865, 0, 6, 1 },
+    { 17843, 7865, 0, 6, 1 },
+    { 9872, 7865, 0, 6, 1 },
+    { 1103, 7865, 0, 2, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 10863, 7865, 0, 3, 1 },
+    { 3903, 7865, 0, 3, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 17849, 7865, 0, 11, 1 },
+    { 10699, 7865, 0, 9, 1 },
+    { 17860, 7865, 0, 7, 1 },
+    { 17867, 7865, 0, 8, 1 },
+    { 17875, 7865, 0, 4, 1 },
+    { 12261, 7865, 0, 4, 1 },
+    { 17879, 7865, 0, 8, 1 },
+    { 17887, 7865, 0, 6, 1 },
+    { 17893, 7865, 0, 6, 1 },
+    { 17899, 7865, 0, 7, 1 },
+    { 17906, 7865, 0, 7, 1 },
+    { 17913, 7865, 0, 9, 1 },
+    { 10003, 7865, 0, 8, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 2324, 7865, 0, 4, 1 },
+    { 17922, 7865, 0, 4, 1 },
+    { 17926, 7865, 0, 2, 1 },
+    { 4089, 7865, 0, 4, 1 },
+    { 102, 7865, 0, 5, 1 },
+    { 377, 7865, 0, 3, 1 },
+    { 12172, 7865, 0, 4, 1 },
+    { 1340, 7865, 0, 3, 1 },
+    { 1466, 7865, 0, 4, 1 },
+    { 1880, 7865, 0, 3, 1 },
+    { 12533, 7865, 0, 4, 1 },
+    { 12190, 7865, 0, 4, 1 },
+    { 3029, 7865, 0, 4, 1 },
+    { 3837, 7865, 0, 3, 1 },
+    { 4113, 7865, 0, 3, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 17928, 7865, 0, 5, 1 },
+    { 17186, 7865, 0, 3, 1 },
+    { 4677, 7865, 0, 3, 1 },
+    { 17933, 7865, 0, 3, 1 },
+    { 5323, 7865, 0, 4, 1 },
+    { 17936, 7865, 0, 4, 1 },
+    { 17940, 7865, 0, 5, 1 },
+    { 10003, 7865, 0, 8, 1 },
+    { 17945, 7865, 0, 4, 1 },
+    { 1065, 7865, 0, 6, 1 },
+    { 1231, 7865, 0, 4, 1 },
+    { 1308, 7865, 0, 2, 1 },
+    { 17949, 7865, 0, 7, 1 },
+    { 17956, 7865, 0, 7, 1 },
+    { 2153, 7865, 0, 4, 1 },
+    { 2304, 7865, 0, 5, 1 },
+    { 2426, 7865, 0, 5, 1 },
+    { 17963, 7865, 0, 5, 1 },
+    { 3029, 7865, 0, 4, 1 },
+    { 17968, 7865, 0, 8, 1 },
+    { 17976, 7865, 0, 6, 1 },
+    { 17982, 7865, 0, 8, 1 },
+    { 17990, 7865, 0, 5, 1 },
+    { 3840, 7865, 0, 5, 1 },
+    { 4147, 7865, 0, 4, 1 },
+    { 4380, 7865, 0, 3, 1 },
+    { 11010, 7865, 0, 4, 1 },
+    { 17995, 7865, 0, 6, 1 },
+    { 5270, 7865, 0, 3, 1 },
+    { 5323, 7865, 0, 4, 1 },
+    { 5485, 7865, 0, 5, 1 },
+    { 18001, 7865, 0, 4, 1 },
+    { 18005, 7865, 0, 4, 1 },
+    { 5851, 7865, 0, 2, 1 },
+    { 18009, 7865, 0, 6, 1 },
+    { 18015, 7865, 0, 6, 1 },
+    { 6173, 7865, 0, 5, 1 },
+    { 50, 7865, 0, 2, 1 },
+    { 712, 7865, 0, 3, 1 },
+    { 1308, 7865, 1, 2, 1 },
+    { 18021, 7866, 0, 4, 1 },
+    { 18025, 7866, 0, 4, 1 },
+    { 18029, 7866, 0, 5, 1 },
+    { 12188, 7866, 0, 2, 1 },
+    { 3903, 7866, 0, 3, 1 },
+    { 4074, 7866, 1, 2, 1 },
+    { 4113, 7867, 0, 3, 1 },
+    { 11000, 7867, 0, 2, 1 },
+    { 18034, 7867, 0, 6, 1 },
+    { 10011, 7867, 0, 3, 1 },
+    { 10855, 7867, 0, 3, 1 },
+    { 10003, 7867, 0, 8, 1 },
+    { 2599, 7867, 0, 3, 1 },
+    { 10988, 7867, 0, 12, 1 },
+    { 50, 7867, 0, 2, 1 },
+    { 1308, 7867, 4, 2, 1 },
+    { 2599, 7871, 0, 3, 1 },
+    { 18040, 7871, 0, 3, 1 },
+    { 17201, 7871, 0, 3, 1 },
+    { 16413, 7871, 0, 4, 1 },
+    { 4113, 7871, 0, 3, 1 },
+    { 4380, 7871, 0, 3, 1 },
+    { 50, 7871, 0, 2, 1 },
+    { 1308, 7871, 2, 2, 1 },
+    { 1340, 7873, 0, 3, 1 },
+    { 4113, 7873, 0, 3, 1 },
+    { 4380, 7873, 0, 3, 1 },
+    { 4981, 7873, 0, 2, 1 },
+    { 5992, 7873, 0, 2, 1 },
+    { 6011, 7873, 0, 2, 1 },
+    { 18043, 7873, 0, 2, 1 },
+    { 18045, 7873, 0, 2, 1 },
+    { 50, 7873, 0, 2, 1 },
+    { 147, 7873, 0, 2, 1 },
+    { 233, 7873, 0, 2, 1 },
+    { 11115, 7873, 0, 5, 1 },
+    { 18047, 7873, 0, 5, 1 },
+    { 712, 7873, 0, 3, 1 },
+    { 10003, 7873, 0, 8, 1 },
+    { 921, 7873, 0, 8, 1 },
+    { 947, 7873, 0, 2, 1 },
+    { 10905, 7873, 0, 7, 1 },
+    { 1306, 7873, 0, 2, 1 },
+    { 1308, 7873, 0, 2, 1 },
+    { 1340, 7873, 0, 3, 1 },
+    { 1466, 7873, 0, 4, 1 },
+    { 18052, 7873, 0, 2, 1 },
+    { 18054, 7873, 0, 5, 1 },
+    { 18059, 7873, 0, 2, 1 },
+    { 1880, 7873, 0, 3, 1 },
+    { 1957, 7873, 0, 2, 1 },
+    { 12533, 7873, 0, 4, 1 },
+    { 18061, 7873, 0, 3, 1 },
+    { 2599, 7873, 0, 3, 1 },
+    { 18064, 7873, 0, 7, 1 },
+    { 11727, 7873, 0, 3, 1 },
+    { 3029, 7873, 0, 4, 1 },
+    { 3063, 7873, 0, 3, 1 },
+    { 18071, 7873, 0, 8, 1 },
+    { 3096, 7873, 0, 2, 1 },
+    { 3835, 7873, 0, 2, 1 },
+    { 3903, 7873, 0, 3, 1 },
+    { 4113, 7873, 0, 3, 1 },
+    { 18079, 7873, 0, 3, 1 },
+    { 4380, 7873, 0, 3, 1 },
+    { 4485, 7873, 0, 2, 1 },
+    { 4647, 7873, 0, 4, 1 },
+    { 4677, 7873, 0, 3, 1 },
+    { 10551, 7873, 0, 3, 1 },
+    { 12567, 7873, 0, 8, 1 },
+    { 5938, 7873, 0, 6, 1 },
+    { 6011, 7873, 0, 2, 1 },
+    { 6032, 7873, 0, 2, 1 },
+    { 18082, 7873, 0, 2, 1 },
+    { 6059, 7873, 0, 2, 1 },
+    { 10855, 7873, 0, 3, 1 },
+    { 18084, 7873, 0, 19, 1 },
+    { 18103, 7873, 0, 20, 1 },
+    { 11115, 7873, 0, 5, 1 },
+    { 10905, 7873, 0, 7, 1 },
+    { 18123, 7873, 0, 9, 1 },
+    { 18132, 7873, 0, 6, 1 },
+    { 18138, 7873, 0, 11, 1 },
+    { 11162, 7873, 0, 6, 1 },
+    { 18149, 7873, 0, 7, 1 },
+    { 18156, 7873, 0, 6, 1 },
+    { 18162, 7873, 0, 9, 1 },
+    { 18171, 7873, 0, 10, 1 },
+    { 18181, 7873, 0, 13, 1 },
+    { 18194, 7873, 0, 12, 1 },
+    { 18206, 7873, 0, 10, 1 },
+    { 18216, 7873, 0, 8, 1 },
+    { 11216, 7873, 0, 5, 1 },
+    { 18224, 7873, 0, 8, 1 },
+    { 11224, 7873, 0, 6, 1 },
+    { 18232, 7873, 0, 6, 1 },
+    { 11230, 7873, 0, 6, 1 },
+    { 1992, 7873, 0, 2, 1 },
+    { 18238, 7873, 0, 4, 1 },
+    { 18242, 7873, 0, 6, 1 },
+    { 18248, 7873, 0, 14, 2 },
+    { 18262, 7873, 0, 6, 1 },
+    { 18268, 7873, 0, 12, 1 },
+    { 18280, 7873, 2, 11, 0 },
+    { 11115, 7875, 0, 5, 1 },
+    { 18291, 7875, 0, 11, 1 },
+    { 18302, 7875, 0, 11, 1 },
+    { 18313, 7875, 1, 7, 0 },
+    { 18320, 7876, 1, 10, 0 },
+    { 18330, 7877, 1, 4, 0 },
+    { 18334, 7878, 0, 9, 1 },
+    { 18343, 7878, 0, 8, 1 },
+    { 18351, 7878, 0, 7, 1 },
+    { 18358, 7878, 0, 17, 1 },
+    { 18375, 7878, 0, 10, 1 },
+    { 1340, 7878, 0, 3, 1 },
+    { 18385, 7878, 1, 8, 0 },
+    { 18393, 7879, 0, 5, 1 },
+    { 18398, 7879, 0, 8, 1 },
+    { 18406, 7879, 0, 4, 1 },
+    { 18410, 7879, 0, 5, 1 },
+    { 18415, 7879, 0, 7, 1 },
+    { 18422, 7879, 0, 6, 1 },
+    { 18428, 7879, 0, 11, 1 },
+    { 18439, 7879, 1, 9, 0 },
+    { 18448, 7880, 0, 5, 1 },
+    { 18453, 7880, 0, 6, 1 },
+    { 18459, 7880, 0, 6, 1 },
+    { 18465, 7880, 0, 10, 1 },
+    { 18475, 7880, 0, 12, 1 },
+    { 18487, 7880, 0, 3, 1 },
+    { 12261, 7880, 0, 4, 1 },
+    { 18490, 7880, 1, 4, 0 },
+    { 10742, 7881, 0, 9, 1 },
+    { 18494, 7881, 0, 7, 1 },
+    { 18501, 7881, 0, 10, 1 },
+    { 18511, 7881, 0, 9, 2 },
+    { 18520, 7881, 0, 8, 1 },
+    { 18528, 7881, 0, 5, 1 },
+    { 18533, 7881, 0, 3, 1 },
+    { 18536, 7881, 1, 7, 0 },
+    { 18543, 7882, 0, 8, 2 },
+    { 18551, 7882, 0, 6, 2 },
+    { 18557, 7882, 0, 6, 2 },
+    { 18563, 7882, 0, 12, 1 },
+    { 18575, 7882, 0, 8, 1 },
+    { 18583, 7882, 1, 5, 1 },
+    { 18588, 7883, 1, 3, 1 },
+    { 18591, 7884, 0, 4, 1 },
+    { 18595, 7884, 0, 11, 1 },
+    { 18606, 7884, 0, 11, 1 },
+    { 18617, 7884, 1, 12, 0 },
+    { 18629, 7885, 0, 3, 2 },
+    { 18632, 7885, 0, 8, 1 },
+    { 17122, 7885, 0, 11, 1 },
+    { 18640, 7885, 0, 9, 1 },
+    { 18649, 7885, 0, 3, 1 },
+    { 18652, 7885, 0, 8, 1 },
+    { 18660, 7885, 0, 6, 2 },
+    { 10833, 7885, 0, 7, 1 },
+    { 18666, 7885, 4, 9, 0 },
+    { 5796, 7889, 0, 7, 1 },
+    { 18675, 7889, 1, 8, 0 },
+    { 18683, 7890, 0, 4, 1 },
+    { 18687, 7890, 0, 7, 1 },
+    { 18694, 7890, 0, 10, 1 },
+    { 18704, 7890, 1, 8, 0 },
+    { 18712, 7891, 0, 13, 1 },
+    { 18725, 7891, 0, 9, 1 },
+    { 18734, 7891, 0, 8, 1 },
+    { 1340, 7891, 0, 3, 1 },
+    { 1880, 7891, 0, 3, 1 },
+    { 2599, 7891, 0, 3, 1 },
+    { 3903, 7891, 0, 3, 1 },
+    { 4113, 7891, 0, 3, 1 },
+    { 4380, 7891, 0, 3, 1 },
+    { 50, 7891, 0, 2, 1 },
+    { 1308, 7891, 0, 2, 1 },
+    { 2599, 7891, 0, 3, 1 },
+    { 2962, 7891, 0, 2, 1 },
+    { 4113, 7891, 0, 3, 1 },
+    { 4380, 7891, 0, 3, 1 },
+    { 10011, 7891, 0, 3, 1 },
+    { 7504, 7891, 0, 15, 1 },
+    { 7519, 7891, 0, 14, 1 },
+    { 8888, 7891, 0, 10, 1 },
+    { 8898, 7891, 0, 10, 1 },
+    { 10003, 7891, 0, 8, 1 },
+    { 1340, 7891, 0, 3, 1 },
+    { 18742, 7891, 0, 7, 1 },
+    { 1880, 7891, 0, 3, 1 },
+    { 2599, 7891, 0, 3, 1 },
+    { 3063, 7891, 0, 3, 1 },
+    { 4113, 7891, 0, 3, 1 },
+    { 4380, 7891, 0, 3, 1 },
+    { 18749, 7891, 0, 11, 1 },
+    { 18760, 7891, 0, 4, 1 },
+    { 18764, 7891, 0, 4, 1 },
+    { 18768, 7891, 0, 4, 1 },
+    { 18772, 7891, 0, 3, 1 },
+    { 18775, 7891, 0, 7, 1 },
+    { 132, 7891, 0, 2, 1 },
+    { 18782, 7891, 0, 9, 1 },
+    { 176, 7891, 0, 2, 1 },
+    { 18791, 7891, 0, 11, 1 },
+    { 18802, 7891, 0, 10, 1 },
+    { 18812, 7891, 0, 9, 1 },
+    { 18821, 7891, 0, 2, 1 },
+    { 18823, 7891, 0, 6, 1 },
+    { 18829, 7891, 0, 21, 1 },
+    { 18850, 7891, 0, 21, 1 },
+    { 18871, 7891, 0, 19, 1 },
+    { 18890, 7891, 0, 19, 1 },
+    { 318, 7891, 0, 2, 1 },
+    { 18909, 7891, 0, 5, 1 },
+    { 18914, 7891, 0, 12, 1 },
+    { 18926, 7891, 0, 11, 1 },
+    { 18937, 7891, 0, 5, 1 },
+    { 18942, 7891, 0, 2, 1 },
+    { 341, 7891, 0, 2, 1 },
+    { 18944, 7891, 0, 6, 1 },
+    { 352, 7891, 0, 2, 1 },
+    { 18950, 7891, 0, 6, 1 },
+    { 18956, 7891, 0, 13, 1 },
+    { 18969, 7891, 0, 12, 1 },
+    { 18981, 7891, 0, 4, 1 },
+    { 404, 7891, 0, 2, 1 },
+    { 18985, 7891, 0, 2, 1 },
+    { 18987, 7891, 0, 8, 1 },
+    { 492, 7891, 0, 2, 1 },
+    { 18995, 7891, 0, 6, 1 },
+    { 19001, 7891, 0, 15, 1 },
+    { 19016, 7891, 0, 16, 1 },
+    { 19032, 7891, 0, 16, 1 },
+    { 19048, 7891, 0, 4, 1 },
+    { 19052, 7891, 0, 21, 1 },
+    { 19073, 7891, 0, 19, 1 },
+    { 19092, 7891, 0, 3, 1 },
+    { 19095, 7891, 0, 10, 1 },
+    { 19105, 7891, 0, 7, 1 },
+    { 19112, 7891, 0, 9, 1 },
+    { 19121, 7891, 0, 7, 1 },
+    { 676, 7891, 0, 2, 1 },
+    { 686, 7891, 0, 2, 1 },
+    { 19128, 7891, 0, 6, 1 },
+    { 19134, 7891, 0, 2, 1 },
+    { 10003, 7891, 0, 8, 1 },
+    { 769, 7891, 0, 2, 1 },
+    { 781, 7891, 0, 2, 1 },
+    { 19136, 7891, 0, 7, 1 },
+    { 19143, 7891, 0, 7, 1 },
+    { 19150, 7891, 0, 17, 1 },
+    { 19167, 7891, 0, 5, 1 },
+    { 19172, 7891, 0, 14, 1 },
+    { 19186, 7891, 0, 15, 1 },
+    { 19201, 7891, 0, 15, 1 },
+    { 854, 7891, 0, 2, 1 },
+    { 19216, 7891, 0, 7, 1 },
+    { 19223, 7891, 0, 8, 1 },
+    { 904, 7891, 0, 2, 1 },
+    { 906, 7891, 0, 2, 1 },
+    { 19231, 7891, 0, 6, 1 },
+    { 19237, 7891, 0, 15, 1 },
+    { 19252, 7891, 0, 16, 1 },
+    { 19268, 7891, 0, 16, 1 },
+    { 942, 7891, 0, 2, 1 },
+    { 947, 7891, 0, 2, 1 },
+    { 19284, 7891, 0, 8, 1 },
+    { 956, 7891, 0, 3, 1 },
+    { 19292, 7891, 0, 8, 1 },
+    { 19300, 7891, 0, 13, 1 },
+    { 974, 7891, 0, 3, 1 },
+    { 19313, 7891, 0, 8, 1 },
+    { 19321, 7891, 0, 15, 1 },
+    { 19336, 7891, 0, 14, 1 },
+    { 19350, 7891, 0, 10, 1 },
+    { 19360, 7891, 0, 17, 1 },
+    { 19377, 7891, 0, 16, 1 },
+    { 19393, 7891, 0, 13, 1 },
+    { 19406, 7891, 0, 12, 1 },
+    { 19418, 7891, 0, 7, 1 },
+    { 19425, 7891, 0, 7, 1 },
+    { 19432, 7891, 0, 9, 1 },
+    { 19441, 7891, 0, 2, 1 },
+    { 19443, 7891, 0, 2, 1 },
+    { 19445, 7891, 0, 12, 1 },
+    { 19457, 7891, 0, 13, 1 },
+    { 19470, 7891, 0, 11, 1 },
+    { 19481, 7891, 0, 12, 1 },
+    { 1130, 7891, 0, 2, 1 },
+    { 19493, 7891, 0, 6, 1 },
+    { 1194, 7891, 0, 2, 1 },
+    { 1245, 7891, 0, 2, 1 },
+    { 1306, 7891, 0, 2, 1 },
+    { 1308, 7891, 0, 2, 1 },
+    { 19499, 7891, 0, 4, 1 },
+    { 19503, 7891, 0, 7, 1 },
+    { 1507, 7891, 0, 2, 1 },
+    { 19510, 7891, 0, 7, 1 },
+    { 19517, 7891, 0, 7, 1 },
+    { 18052, 7891, 0, 2, 1 },
+    { 19524, 7891, 0, 2, 1 },
+    { 19526, 7891, 0, 5, 1 },
+    { 1593, 7891, 0, 2, 1 },
+    { 19531, 7891, 0, 14, 1 },
+    { 19545, 7891, 0, 13, 1 },
+    { 1880, 7891, 0, 3, 1 },
+    { 19558, 7891, 0, 14, 1 },
+    { 19572, 7891, 0, 13, 1 },
+    { 19585, 7891, 0, 3, 1 },
+    { 19588, 7891, 0, 2, 1 },
+    { 19590, 7891, 0, 4, 1 },
+    { 19594, 7891, 0, 2, 1 },
+    { 19596, 7891, 0, 2, 1 },
+    { 19598, 7891, 0, 5, 1 },
+    { 19603, 7891, 0, 7, 1 },
+    { 19610, 7891, 0, 2, 1 },
+    { 2135, 7891, 0, 2, 1 },
+    { 19612, 7891, 0, 7, 1 },
+    { 19619, 7891, 0, 8, 1 },
+    { 2258, 7891, 0, 2, 1 },
+    { 19627, 7891, 0, 6, 1 },
+    { 19633, 7891, 0, 12, 1 },
+    { 19645, 7891, 0, 11, 1 },
+    { 19656, 7891, 0, 13, 1 },
+    { 19669, 7891, 0, 12, 1 },
+    { 2322, 7891, 0, 2, 1 },
+    { 19681, 7891, 0, 15, 1 },
+    { 19696, 7891, 0, 16, 1 },
+    { 19712, 7891, 0, 15, 1 },
+    { 19727, 7891, 0, 21, 1 },
+    { 19748, 7891, 0, 20, 1 },
+    { 19768, 7891, 0, 14, 1 },
+    { 19782, 7891, 0, 14, 1 },
+    { 19796, 7891, 0, 15, 1 },
+    { 19811, 7891, 0, 14, 1 },
+    { 19825, 7891, 0, 20, 1 },
+    { 19845, 7891, 0, 19, 1 },
+    { 19864, 7891, 0, 13, 1 },
+    { 19877, 7891, 0, 9, 1 },
+    { 19886, 7891, 0, 3, 1 },
+    { 2454, 7891, 0, 2, 1 },
+    { 19889, 7891, 0, 5, 1 },
+    { 19894, 7891, 0, 6, 1 },
+    { 12188, 7891, 0, 2, 1 },
+    { 19900, 7891, 0, 7, 1 },
+    { 2599, 7891, 0, 3, 1 },
+    { 2606, 7891, 0, 2, 1 },
+    { 19907, 7891, 0, 8, 1 },
+    { 19915, 7891, 0, 5, 1 },
+    { 19920, 7891, 0, 17, 1 },
+    { 19937, 7891, 0, 16, 1 },
+    { 19953, 7891, 0, 10, 1 },
+    { 2980, 7891, 0, 2, 1 },
+    { 19963, 7891, 0, 7, 1 },
+    { 3115, 7891, 0, 2, 1 },
+    { 19970, 7891, 0, 7, 1 },
+    { 3359, 7891, 0, 2, 1 },
+    { 19977, 7891, 0, 9, 1 },
+    { 19986, 7891, 0, 7, 1 },
+    { 19993, 7891, 0, 8, 1 },
+    { 20001, 7891, 0, 6, 1 },
+    { 20007, 7891, 0, 3, 1 },
+    { 20010, 7891, 0, 5, 1 },
+    { 3482, 7891, 0, 2, 1 },
+    { 20015, 7891, 0, 2, 1 },
+    { 20017, 7891, 0, 5, 1 },
+    { 20022, 7891, 0, 5, 1 },
+    { 3523, 7891, 0, 2, 1 },
+    { 20027, 7891, 0, 3, 1 },
+    { 20030, 7891, 0, 7, 1 },
+    { 20037, 7891, 0, 7, 1 },
+    { 20044, 7891, 0, 2, 1 },
+    { 20046, 7891, 0, 4, 1 },
+    { 20050, 7891, 0, 3, 1 },
+    { 20053, 7891, 0, 9, 1 },
+    { 20062, 7891, 0, 8, 1 },
+    { 3684, 7891, 0, 2, 1 },
+    { 3693, 7891, 0, 2, 1 },
+    { 20070, 7891, 0, 7, 1 },
+    { 20077, 7891, 0, 5, 1 },
+    { 20082, 7891, 0, 8, 1 },
+    { 20090, 7891, 0, 7, 1 },
+    { 20097, 7891, 0, 3, 1 },
+    { 20100, 7891, 0, 6, 1 },
+    { 20106, 7891, 0, 13, 1 },
+    { 20119, 7891, 0, 12, 1 },
+    { 20131, 7891, 0, 6, 1 },
+    { 12047, 7891, 0, 2, 1 },
+    { 3823, 7891, 0, 2, 1 },
+    { 3835, 7891, 0, 2, 1 },
+    { 20137, 7891, 0, 15, 1 },
+    { 20152, 7891, 0, 14, 1 },
+    { 20166, 7891, 0, 7, 1 },
+    { 20173, 7891, 0, 2, 1 },
+    { 20175, 7891, 0, 5, 1 },
+    { 20180, 7891, 0, 6, 1 },
+    { 3942, 7891, 0, 2, 1 },
+    { 3944, 7891, 0, 2, 1 },
+    { 20186, 7891, 0, 6, 1 },
+    { 20192, 7891, 0, 3, 1 },
+    { 20195, 7891, 0, 6, 1 },
+    { 20201, 7891, 0, 5, 1 },
+    { 20206, 7891, 0, 13, 1 },
+    { 20219, 7891, 0, 21, 1 },
+    { 20240, 7891, 0, 12, 1 },
+    { 20252, 7891, 0, 13, 1 },
+    { 20265, 7891, 0, 18, 1 },
+    { 4036, 7891, 0, 2, 1 },
+    { 4041, 7891, 0, 2, 1 },
+    { 10988, 7891, 0, 12, 1 },
+    { 4078, 7891, 0, 2, 1 },
+    { 20283, 7891, 0, 6, 1 },
+    { 20289, 7891, 0, 6, 1 },
+    { 20295, 7891, 1, 4, 0 },
+    { 4217, 7892, 0, 2, 1 },
+    { 20299, 7892, 0, 6, 1 },
+    { 4275, 7892, 0, 2, 1 },
+    { 20305, 7892, 0, 5, 1 },
+    { 10652, 7892, 0, 2, 1 },
+    { 20310, 7892, 0, 9, 1 },
+    { 20319, 7892, 0, 12, 1 },
+    { 20331, 7892, 0, 11, 1 },
+    { 11000, 7892, 0, 2, 1 },
+    { 20342, 7892, 0, 8, 1 },
+    { 20350, 7892, 0, 2, 1 },
+    { 4414, 7892, 0, 2, 1 },
+    { 20352, 7892, 0, 6, 1 },
+    { 20358, 7892, 0, 5, 1 },
+    { 20363, 7892, 0, 7, 1 },
+    { 20370, 7892, 0, 5, 1 },
+    { 20375, 7892, 0, 5, 1 },
+    { 20380, 7892, 0, 2, 1 },
+    { 20382, 7892, 0, 2, 1 },
+    { 4472, 7892, 0, 2, 1 },
+    { 20384, 7892, 0, 7, 1 },
+    { 20391, 7892, 0, 13, 1 },
+    { 20404, 7892, 0, 12, 1 },
+    { 20416, 7892, 0, 7, 1 },
+    { 4485, 7892, 0, 2, 1 },
+    { 20423, 7892, 0, 2, 1 },
+    { 20425, 7892, 0, 8, 1 },
+    { 20433, 7892, 0, 8, 1 },
+    { 20441, 7892, 0, 8, 1 },
+    { 20449, 7892, 0, 4, 1 },
+    { 20453, 7892, 0, 7, 1 },
+    { 20460, 7892, 0, 3, 1 },
+    { 4622, 7892, 0, 2, 1 },
+    { 20463, 7892, 0, 2, 1 },
+    { 20465, 7892, 0, 9, 1 },
+    { 20474, 7892, 0, 7, 1 },
+    { 4651, 7892, 0, 2, 1 },
+    { 20481, 7892, 0, 5, 1 },
+    { 4758, 7892, 0, 2, 1 },
+    { 20486, 7892, 0, 2, 1 },
+    { 20488, 7892, 0, 3, 1 },
+    { 20491, 7892, 0, 6, 1 },
+    { 20497, 7892, 0, 2, 1 },
+    { 20499, 7892, 0, 2, 1 },
+    { 20501, 7892, 0, 2, 1 },
+    { 20503, 7892, 0, 6, 1 },
+    { 20509, 7892, 0, 7, 1 },
+    { 20516, 7892, 0, 2, 1 },
+    { 4798, 7892, 0, 2, 1 },
+    { 20518, 7892, 0, 15, 1 },
+    { 20533, 7892, 0, 13, 1 },
+    { 20546, 7892, 0, 14, 1 },
+    { 20560, 7892, 0, 12, 1 },
+    { 20572, 7892, 0, 2, 1 },
+    { 20574, 7892, 0, 2, 1 },
+    { 20576, 7892, 0, 5, 1 },
+    { 20581, 7892, 0, 6, 1 },
+    { 20587, 7892, 0, 2, 1 },
+    { 20589, 7892, 0, 2, 1 },
+    { 4981, 7892, 0, 2, 1 },
+    { 20591, 7892, 0, 4, 1 },
+    { 20595, 7892, 0, 4, 1 },
+    { 20599, 7892, 0, 6, 1 },
+    { 5040, 7892, 0, 2, 1 },
+    { 20605, 7892, 0, 7, 1 },
+    { 20612, 7892, 0, 3, 1 },
+    { 20615, 7892, 0, 8, 1 },
+    { 20623, 7892, 0, 8, 1 },
+    { 20631, 7892, 0, 7, 1 },
+    { 20638, 7892, 0, 6, 1 },
+    { 5353, 7892, 0, 2, 1 },
+    { 20644, 7892, 0, 3, 1 },
+    { 20647, 7892, 0, 7, 1 },
+    { 20654, 7892, 0, 6, 1 },
+    { 20660, 7892, 0, 5, 1 },
+    { 20665, 7892, 0, 8, 1 },
+    { 5418, 7892, 0, 2, 1 },
+    { 20673, 7892, 0, 7, 1 },
+    { 20680, 7892, 0, 2, 1 },
+    { 5494, 7892, 0, 2, 1 },
+    { 5499, 7892, 0, 2, 1 },
+    { 20682, 7892, 0, 9, 1 },
+    { 5636, 7892, 0, 2, 1 },
+    { 20691, 7892, 0, 8, 1 },
+    { 20699, 7892, 0, 9, 1 },
+    { 20708, 7892, 0, 2, 1 },
+    { 20710, 7892, 0, 3, 1 },
+    { 20713, 7892, 0, 7, 1 },
+    { 20720, 7892, 0, 2, 1 },
+    { 20722, 7892, 0, 12, 1 },
+    { 20734, 7892, 0, 11, 1 },
+    { 20745, 7892, 0, 6, 1 },
+    { 20751, 7892, 0, 5, 1 },
+    { 20756, 7892, 1, 3, 0 },
+    { 5858, 7893, 0, 2, 1 },
+    { 5860, 7893, 0, 2, 1 },
+    { 20759, 7893, 0, 6, 1 },
+    { 20765, 7893, 0, 3, 1 },
+    { 20768, 7893, 0, 7, 1 },
+    { 20775, 7893, 0, 2, 1 },
+    { 5916, 7893, 0, 2, 1 },
+    { 20777, 7893, 0, 21, 1 },
+    { 20798, 7893, 0, 21, 1 },
+    { 20819, 7893, 0, 19, 1 },
+    { 20838, 7893, 0, 19, 1 },
+    { 20857, 7893, 0, 7, 1 },
+    { 20864, 7893, 0, 17, 1 },
+    { 20881, 7893, 0, 16, 1 },
+    { 20897, 7893, 0, 18, 1 },
+    { 20915, 7893, 0, 17, 1 },
+    { 20932, 7893, 0, 18, 1 },
+    { 20950, 7893, 0, 17, 1 },
+    { 20967, 7893, 0, 8, 1 },
+    { 20975, 7893, 0, 16, 1 },
+    { 20991, 7893, 0, 15, 1 },
+    { 21006, 7893, 0, 19, 1 },
+    { 21025, 7893, 0, 18, 1 },
+    { 21043, 7893, 0, 16, 1 },
+    { 21059, 7893, 0, 15, 1 },
+    { 21074, 7893, 0, 18, 1 },
+    { 21092, 7893, 0, 17, 1 },
+    { 21109, 7893, 0, 19, 1 },
+    { 21128, 7893, 0, 18, 1 },
+    { 21146, 7893, 0, 19, 1 },
+    { 21165, 7893, 0, 18, 1 },
+    { 21183, 7893, 0, 15, 1 },
+    { 21198, 7893, 0, 14, 1 },
+    { 21212, 7893, 0, 18, 1 },
+    { 21230, 7893, 0, 17, 1 },
+    { 21247, 7893, 0, 15, 1 },
+    { 21262, 7893, 0, 14, 1 },
+    { 21276, 7893, 0, 17, 1 },
+    { 21293, 7893, 0, 16, 1 },
+    { 21309, 7893, 0, 18, 1 },
+    { 21327, 7893, 0, 17, 1 },
+    { 21344, 7893, 0, 18, 1 },
+    { 21362, 7893, 0, 17, 1 },
+    { 21379, 7893, 0, 16, 1 },
+    { 21395, 7893, 0, 15, 1 },
+    { 21410, 7893, 0, 17, 1 },
+    { 21427, 7893, 0, 16, 1 },
+    { 21443, 7893, 0, 17, 1 },
+    { 21460, 7893, 0, 16, 1 },
+    { 21476, 7893, 0, 6, 1 },
+    { 21482, 7893, 0, 7, 1 },
+    { 21489, 7893, 0, 7, 1 },
+    { 21496, 7893, 0, 2, 1 },
+    { 21498, 7893, 0, 5, 1 },
+    { 21503, 7893, 0, 7, 1 },
+    { 6011, 7893, 0, 2, 1 },
+    { 21510, 7893, 0, 2, 1 },
+    { 21512, 7893, 0, 5, 1 },
+    { 21517, 7893, 0, 3, 1 },
+    { 21520, 7893, 0, 6, 1 },
+    { 21526, 7893, 0, 13, 1 },
+    { 21539, 7893, 0, 12, 1 },
+    { 6065, 7893, 0, 2, 1 },
+    { 21551, 7893, 0, 11, 1 },
+    { 21562, 7893, 0, 10, 1 },
+    { 21572, 7893, 0, 10, 1 },
+    { 21582, 7893, 0, 9, 1 },
+    { 21591, 7893, 0, 11, 1 },
+    { 21602, 7893, 0, 13, 1 },
+    { 21615, 7893, 0, 12, 1 },
+    { 21627, 7893, 0, 10, 1 },
+    { 21637, 7893, 0, 12, 1 },
+    { 21649, 7893, 0, 11, 1 },
+    { 21660, 7893, 0, 12, 1 },
+    { 21672, 7893, 0, 14, 1 },
+    { 21686, 7893, 0, 11, 1 },
+    { 21697, 7893, 0, 12, 1 },
+    { 21709, 7893, 0, 13, 1 },
+    { 21722, 7893, 0, 15, 1 },
+    { 21737, 7893, 0, 12, 1 },
+    { 21749, 7893, 0, 13, 1 },
+    { 21762, 7893, 0, 3, 1 },
+    { 21765, 7893, 0, 6, 1 },
+    { 21771, 7893, 0, 2, 1 },
+    { 6088, 7893, 0, 2, 1 },
+    { 21773, 7893, 0, 3, 1 },
+    { 6090, 7893, 0, 2, 1 },
+    { 21776, 7893, 0, 3, 1 },
+    { 21779, 7893, 0, 6, 1 },
+    { 21785, 7893, 0, 7, 1 },
+    { 21792, 7893, 0, 6, 1 },
+    { 21798, 7893, 0, 8, 1 },
+    { 21806, 7893, 0, 8, 1 },
+    { 21814, 7893, 0, 6, 1 },
+    { 6165, 7893, 0, 2, 1 },
+    { 21820, 7893, 0, 13, 1 },
+    { 21833, 7893, 0, 12, 1 },
+    { 21845, 7893, 0, 7, 1 },
+    { 21852, 7893, 0, 7, 1 },
+    { 21859, 7893, 0, 2, 1 },
+    { 21861, 7893, 0, 2, 1 },
+    { 21863, 7893, 0, 2, 1 },
+    { 21865, 7893, 0, 2, 1 },
+    { 21867, 7893, 0, 22, 1 },
+    { 21889, 7893, 0, 21, 1 },
+    { 21910, 7893, 0, 22, 1 },
+    { 21932, 7893, 0, 19, 1 },
+    { 21951, 7893, 0, 18, 1 },
+    { 21969, 7893, 0, 19, 1 },
+    { 21988, 7893, 0, 18, 1 },
+    { 22006, 7893, 0, 15, 1 },
+    { 22021, 7893, 0, 24, 1 },
+    { 22045, 7893, 0, 23, 1 },
+    { 22068, 7893, 0, 25, 1 },
+    { 22093, 7893, 0, 24, 1 },
+    { 22117, 7893, 0, 24, 1 },
+    { 22141, 7893, 0, 23, 1 },
+    { 22164, 7893, 0, 23, 1 },
+    { 22187, 7893, 0, 22, 1 },
+    { 22209, 7893, 0, 19, 1 },
+    { 22228, 7893, 0, 21, 1 },
+    { 22249, 7893, 0, 18, 1 },
+    { 22267, 7893, 0, 19, 1 },
+    { 1308, 7893, 0, 2, 1 },
+    { 4113, 7893, 0, 3, 1 },
+    { 12031, 7893, 0, 2, 1 },
+    { 4380, 7893, 0, 3, 1 },
+    { 1340, 7893, 0, 3, 1 },
+    { 1880, 7893, 0, 3, 1 },
+    { 2599, 7893, 0, 3, 1 },
+    { 3903, 7893, 0, 3, 1 },
+    { 4089, 7893, 0, 4, 1 },
+    { 4113, 7893, 0, 3, 1 },
+    { 4380, 7893, 0, 3, 1 },
+    { 10011, 7893, 0, 3, 1 },
+    { 50, 7893, 0, 2, 1 },
+    { 97, 7893, 0, 2, 1 },
+    { 22286, 7893, 52, 5, 1 },
+    { 22291, 7945, 28, 5, 1 },
+    { 22296, 7973, 0, 5, 1 },
+    { 22301, 7973, 22, 6, 1 },
+    { 22307, 7995, 0, 8, 1 },
+    { 22315, 7995, 0, 8, 1 },
+    { 22323, 7995, 0, 8, 1 },
+    { 22331, 7995, 0, 7, 1 },
+    { 22338, 7995, 0, 6, 1 },
+    { 10003, 7995, 0, 8, 1 },
+    { 22344, 7995, 0, 5, 1 },
+    { 809, 7995, 0, 3, 1 },
+    { 22349, 7995, 0, 3, 1 },
+    { 22352, 7995, 0, 9, 1 },
+    { 22361, 7995, 0, 3, 1 },
+    { 22364, 7995, 0, 7, 1 },
+    { 22371, 7995, 0, 8, 1 },
+    { 22379, 7995, 0, 5, 1 },
+    { 22384, 7995, 0, 7, 1 },
+    { 1161, 7995, 0, 5, 1 },
+    { 22391, 7995, 58, 5, 1 },
+    { 22396, 8053, 0, 8, 1 },
+    { 22404, 8053, 0, 8, 1 },
+    { 22412, 8053, 0, 5, 1 },
+    { 22417, 8053, 0, 7, 1 },
+    { 22424, 8053, 0, 3, 1 },
+    { 22427, 8053, 0, 4, 1 },
+    { 1308, 8053, 0, 2, 1 },
+    { 22431, 8053, 0, 7, 1 },
+    { 22438, 8053, 0, 8, 1 },
+    { 22446, 8053, 0, 6, 1 },
+    { 22452, 8053, 0, 8, 1 },
+    { 22460, 8053, 0, 3, 1 },
+    { 22463, 8053, 0, 4, 1 },
+    { 22467, 8053, 0, 4, 1 },
+    { 22471, 8053, 0, 6, 1 },
+    { 10648, 8053, 0, 2, 1 },
+    { 22477, 8053, 0, 6, 1 },
+    { 22483, 8053, 22, 5, 1 },
+    { 22488, 8075, 0, 7, 1 },
+    { 22495, 8075, 0, 12, 1 },
+    { 22507, 8075, 0, 3, 1 },
+    { 22510, 8075, 0, 5, 1 },
+    { 22515, 8075, 0, 6, 1 },
+    { 22521, 8075, 0, 4, 1 },
+    { 22525, 8075, 0, 10, 1 },
+    { 22535, 8075, 15, 5, 1 },
+    { 22540, 8090, 63, 7, 1 },
+    { 22547, 8153, 51, 9, 1 },
+    { 22556, 8204, 38, 4, 1 },
+    { 22560, 8242, 0, 10, 1 },
+    { 22570, 8242, 0, 5, 1 },
+    { 22575, 8242, 0, 6, 1 },
+    { 12188, 8242, 0, 2, 1 },
+    { 22581, 8242, 0, 5, 1 },
+    { 2606, 8242, 0, 2, 1 },
+    { 22586, 8242, 0, 7, 1 },
+    { 22593, 8242, 36, 5, 1 },
+    { 22598, 8278, 0, 5, 1 },
+    { 22603, 8278, 0, 11, 1 },
+    { 22614, 8278, 0, 5, 1 },
+    { 22619, 8278, 0, 3, 1 },
+    { 22622, 8278, 0, 4, 1 },
+    { 22626, 8278, 0, 5, 1 },
+    { 22631, 8278, 25, 9, 1 },
+    { 22640, 8303, 142, 8, 1 },
+    { 22648, 8445, 0, 4, 1 },
+    { 22652, 8445, 0, 6, 1 },
+    { 22658, 8445, 46, 5, 1 },
+    { 22663, 8491, 51, 7, 1 },
+    { 22670, 8542, 0, 6, 1 },
+    { 22676, 8542, 19, 8, 1 },
+    { 22684, 8561, 0, 5, 1 },
+    { 22689, 8561, 34, 5, 1 },
+    { 22694, 8595, 0, 9, 1 },
+    { 22703, 8595, 15, 6, 1 },
+    { 22709, 8610, 20, 9, 1 },
+    { 22718, 8630, 30, 8, 1 },
+    { 22726, 8660, 0, 10, 1 },
+    { 22736, 8660, 1, 8, 2 },
+    { 22744, 8661, 0, 8, 1 },
+    { 22752, 8661, 0, 4, 1 },
+    { 22756, 8661, 0, 4, 1 },
+    { 22760, 8661, 1, 10, 2 },
+    { 22770, 8662, 1, 4, 2 },
+    { 22774, 8663, 31, 5, 1 },
+    { 22779, 8694, 23, 8, 1 },
+    { 22787, 8717, 0, 5, 1 },
+    { 3381, 8717, 31, 5, 1 },
+    { 22792, 8748, 0, 2, 1 },
+    { 22794, 8748, 0, 10, 1 },
+    { 22804, 8748, 0, 9, 1 },
+    { 22813, 8748, 0, 10, 1 },
+    { 22823, 8748, 0, 4, 1 },
+    { 22827, 8748, 0, 7, 1 },
+    { 22834, 8748, 0, 8, 1 },
+    { 22842, 8748, 0, 4, 1 },
+    { 22846, 8748, 30, 3, 1 },
+    { 22849, 8778, 32, 6, 1 },
+    { 22855, 8810, 27, 8, 1 },
+    { 22863, 8837, 0, 4, 1 },
+    { 22867, 8837, 0, 4, 1 },
+    { 22871, 8837, 0, 9, 1 },
+    { 22880, 8837, 0, 3, 1 },
+    { 22883, 8837, 75, 6, 1 },
+    { 22889, 8912, 22, 8, 1 },
+    { 4083, 8934, 1, 6, 2 },
+    { 22897, 8935, 0, 7, 1 },
+    { 22904, 8935, 38, 4, 1 },
+    { 4108, 8973, 2, 2, 1 },
+    { 22908, 8975, 34, 7, 1 },
+    { 22915, 9009, 0, 6, 1 },
+    { 22921, 9009, 0, 7, 1 },
+    { 22928, 9009, 0, 4, 1 },
+    { 22932, 9009, 19, 4, 1 },
+    { 22936, 9028, 26, 7, 1 },
+    { 4299, 9054, 42, 7, 1 },
+    { 22943, 9096, 0, 4, 1 },
+    { 11000, 9096, 0, 2, 1 },
+    { 4397, 9096, 50, 5, 1 },
+    { 22947, 9146, 0, 8, 1 },
+    { 22955, 9146, 0, 8, 1 },
+    { 22963, 9146, 0, 6, 1 },
+    { 22969, 9146, 0, 6, 1 },
+    { 22975, 9146, 0, 5, 1 },
+    { 22980, 9146, 0, 6, 1 },
+    { 22986, 9146, 0, 5, 1 },
+    { 22991, 9146, 0, 7, 1 },
+    { 22998, 9146, 0, 6, 1 },
+    { 23004, 9146, 0, 5, 1 },
+    { 23009, 9146, 0, 4, 1 },
+    { 23013, 9146, 0, 8, 1 },
+    { 23021, 9146, 0, 3, 1 },
+    { 23024, 9146, 0, 8, 1 },
+    { 23032, 9146, 0, 9, 1 },
+    { 23041, 9146, 0, 6, 1 },
+    { 23047, 9146, 26, 4, 1 },
+    { 23051, 9172, 69, 7, 1 },
+    { 23058, 9241, 1, 7, 2 },
+    { 23065, 9242, 0, 9, 1 },
+    { 23074, 9242, 0, 6, 1 },
+    { 23080, 9242, 1, 6, 2 },
+    { 23086, 9243, 23, 5, 1 },
+    { 23091, 9266, 23, 7, 1 },
+    { 23098, 9289, 36, 8, 1 },
+    { 23106, 9325, 0, 5, 1 },
+    { 23111, 9325, 0, 8, 1 },
+    { 23119, 9325, 0, 3, 1 },
+    { 23122, 9325, 0, 8, 1 },
+    { 23130, 9325, 0, 9, 1 },
+    { 23139, 9325, 0, 7, 1 },
+    { 23146, 9325, 0, 5, 1 },
+    { 23151, 9325, 31, 7, 1 },
+    { 23158, 9356, 17, 9, 1 },
+    { 5867, 9373, 57, 5, 1 },
+    { 23167, 9430, 0, 8, 1 },
+    { 23175, 9430, 13, 7, 1 },
+    { 23182, 9443, 24, 6, 1 },
+    { 23188, 9467, 0, 5, 1 },
+    { 23193, 9467, 0, 5, 1 },
+    { 17634, 9467, 0, 11, 1 },
+    { 23198, 9467, 0, 6, 1 },
+    { 23204, 9467, 0, 5, 1 },
+    { 23209, 9467, 0, 6, 1 },
+    { 23215, 9467, 0, 6, 1 },
+    { 23221, 9467, 29, 8, 1 },
+    { 23229, 9496, 0, 6, 1 },
+    { 23235, 9496, 0, 7, 1 },
+    { 23242, 9496, 0, 9, 1 },
+    { 23251, 9496, 0, 13, 1 },
+    { 23264, 9496, 0, 9, 1 },
+    { 23273, 9496, 0, 11, 1 },
+    { 23284, 9496, 0, 11, 1 },
+    { 23295, 9496, 0, 11, 1 },
+    { 23306, 9496, 0, 11, 1 },
+    { 23317, 9496, 0, 11, 1 },
+    { 23328, 9496, 0, 11, 1 },
+    { 23339, 9496, 0, 9, 1 },
+    { 23348, 9496, 0, 11, 1 },
+    { 23359, 9496, 0, 11, 1 },
+    { 23370, 9496, 0, 11, 1 },
+    { 23381, 9496, 0, 10, 1 },
+    { 23391, 9496, 0, 10, 1 },
+    { 23401, 9496, 0, 12, 1 },
+    { 23413, 9496, 0, 11, 1 },
+    { 23424, 9496, 0, 10, 1 },
+    { 23434, 9496, 0, 10, 1 },
+    { 23444, 9496, 0, 14, 1 },
+    { 23458, 9496, 0, 14, 1 },
+    { 23472, 9496, 0, 10, 1 },
+    { 23482, 9496, 0, 10, 1 },
+    { 23492, 9496, 0, 11, 1 },
+    { 23503, 9496, 0, 11, 1 },
+    { 23514, 9496, 0, 11, 1 },
+    { 23525, 9496, 0, 11, 1 },
+    { 23536, 9496, 0, 10, 1 },
+    { 23546, 9496, 0, 11, 1 },
+    { 23557, 9496, 0, 10, 1 },
+    { 23567, 9496, 0, 10, 1 },
+    { 23577, 9496, 0, 10, 1 },
+    { 23587, 9496, 0, 11, 1 },
+    { 23598, 9496, 0, 11, 1 },
+    { 23609, 9496, 0, 14, 1 },
+    { 23623, 9496, 0, 11, 1 },
+    { 23634, 9496, 0, 11, 1 },
+    { 23645, 9496, 0, 11, 1 },
+    { 23656, 9496, 0, 10, 1 },
+    { 23666, 9496, 0, 9, 1 },
+    { 23675, 9496, 0, 10, 1 },
+    { 23685, 9496, 0, 10, 1 },
+    { 23695, 9496, 0, 11, 1 },
+    { 23706, 9496, 0, 11, 1 },
+    { 23717, 9496, 0, 10, 1 },
+    { 23727, 9496, 0, 11, 1 },
+    { 23738, 9496, 0, 11, 1 },
+    { 23749, 9496, 0, 11, 1 },
+    { 23760, 9496, 34, 8, 1 },
+    { 23768, 9530, 16, 9, 1 },
+    { 23777, 9546, 28, 9, 1 },
+    { 8491, 9574, 1, 8, 2 },
+    { 23786, 9575, 0, 6, 1 },
+    { 23792, 9575, 0, 6, 1 },
+    { 23798, 9575, 0, 6, 1 },
+    { 23804, 9575, 0, 6, 1 },
+    { 23810, 9575, 0, 6, 1 },
+    { 23816, 9575, 0, 9, 1 },
+    { 23825, 9575, 0, 6, 1 },
+    { 23831, 9575, 0, 9, 1 },
+    { 23840, 9575, 0, 6, 1 },
+    { 23846, 9575, 0, 6, 1 },
+    { 23852, 9575, 0, 6, 1 },
+    { 23858, 9575, 0, 6, 1 },
+    { 23864, 9575, 0, 6, 1 },
+    { 23870, 9575, 0, 6, 1 },
+    { 23876, 9575, 0, 6, 1 },
+    { 23882, 9575, 0, 6, 1 },
+    { 23888, 9575, 0, 6, 1 },
+    { 23894, 9575, 0, 6, 1 },
+    { 23900, 9575, 0, 6, 1 },
+    { 23906, 9575, 0, 6, 1 },
+    { 23912, 9575, 0, 6, 1 },
+    { 23918, 9575, 0, 6, 1 },
+    { 23924, 9575, 0, 6, 1 },
+    { 23930, 9575, 0, 6, 1 },
+    { 23936, 9575, 0, 6, 1 },
+    { 23942, 9575, 0, 6, 1 },
+    { 23948, 9575, 0, 6, 1 },
+    { 23954, 9575, 0, 6, 1 },
+    { 23960, 9575, 0, 6, 1 },
+    { 23966, 9575, 0, 6, 1 },
+    { 23972, 9575, 0, 6, 1 },
+    { 23978, 9575, 0, 6, 1 },
+    { 23984, 9575, 0, 6, 1 },
+    { 23990, 9575, 0, 9, 1 },
+    { 23999, 9575, 0, 6, 1 },
+    { 24005, 9575, 0, 6, 1 },
+    { 24011, 9575, 0, 6, 1 },
+    { 24017, 9575, 0, 6, 1 },
+    { 24023, 9575, 0, 6, 1 },
+    { 24029, 9575, 0, 6, 1 },
+    { 24035, 9575, 0, 6, 1 },
+    { 24041, 9575, 0, 6, 1 },
+    { 24047, 9575, 0, 6, 1 },
+    { 24053, 9575, 0, 6, 1 },
+    { 24059, 9575, 0, 6, 1 },
+    { 24065, 9575, 0, 6, 1 },
+    { 24071, 9575, 0, 6, 1 },
+    { 24077, 9575, 0, 9, 1 },
+    { 50, 9575, 0, 2, 1 },
+    { 1308, 9575, 1, 2, 1 },
+    { 12188, 9576, 0, 2, 1 },
+    { 3029, 9576, 0, 4, 1 },
+    { 3835, 9576, 0, 2, 1 },
+    { 3946, 9576, 0, 4, 1 },
+    { 4108, 9576, 0, 2, 1 },
+    { 11000, 9576, 0, 2, 1 },
+    { 5144, 9576, 0, 2, 1 },
+    { 744, 9576, 0, 4, 1 },
+    { 1340, 9576, 0, 3, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 2599, 9576, 0, 3, 1 },
+    { 3096, 9576, 0, 2, 1 },
+    { 3207, 9576, 0, 2, 1 },
+    { 3903, 9576, 0, 3, 1 },
+    { 4113, 9576, 0, 3, 1 },
+    { 4380, 9576, 0, 3, 1 },
+    { 6011, 9576, 0, 2, 1 },
+    { 6032, 9576, 0, 2, 1 },
+    { 6059, 9576, 0, 2, 1 },
+    { 712, 9576, 0, 3, 1 },
+    { 1340, 9576, 0, 3, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 2599, 9576, 0, 3, 1 },
+    { 3029, 9576, 0, 4, 1 },
+    { 4113, 9576, 0, 3, 1 },
+    { 4380, 9576, 0, 3, 1 },
+    { 24086, 9576, 0, 3, 1 },
+    { 12172, 9576, 0, 4, 1 },
+    { 1340, 9576, 0, 3, 1 },
+    { 1466, 9576, 0, 4, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 12190, 9576, 0, 4, 1 },
+    { 2599, 9576, 0, 3, 1 },
+    { 17549, 9576, 0, 7, 1 },
+    { 3903, 9576, 0, 3, 1 },
+    { 10000, 9576, 0, 3, 1 },
+    { 17556, 9576, 0, 8, 1 },
+    { 4380, 9576, 0, 3, 1 },
+    { 24089, 9576, 0, 11, 1 },
+    { 17584, 9576, 0, 3, 1 },
+    { 12194, 9576, 0, 6, 1 },
+    { 5851, 9576, 0, 2, 1 },
+    { 17587, 9576, 0, 11, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 2599, 9576, 0, 3, 1 },
+    { 4113, 9576, 0, 3, 1 },
+    { 4380, 9576, 0, 3, 1 },
+    { 1340, 9576, 0, 3, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 2599, 9576, 0, 3, 1 },
+    { 4380, 9576, 0, 3, 1 },
+    { 11873, 9576, 0, 3, 1 },
+    { 24100, 9576, 0, 3, 1 },
+    { 50, 9576, 0, 2, 1 },
+    { 10003, 9576, 0, 8, 1 },
+    { 24103, 9576, 0, 5, 1 },
+    { 24108, 9576, 0, 8, 1 },
+    { 24116, 9576, 0, 8, 1 },
+    { 1308, 9576, 0, 2, 1 },
+    { 24124, 9576, 0, 5, 1 },
+    { 24129, 9576, 0, 7, 1 },
+    { 1971, 9576, 0, 2, 1 },
+    { 24136, 9576, 0, 7, 1 },
+    { 12188, 9576, 0, 2, 1 },
+    { 24143, 9576, 0, 7, 1 },
+    { 24150, 9576, 0, 9, 1 },
+    { 24159, 9576, 0, 8, 1 },
+    { 24167, 9576, 0, 9, 1 },
+    { 24176, 9576, 0, 2, 1 },
+    { 24178, 9576, 0, 7, 1 },
+    { 24185, 9576, 0, 4, 1 },
+    { 24189, 9576, 0, 7, 1 },
+    { 24196, 9576, 0, 7, 1 },
+    { 3289, 9576, 0, 2, 1 },
+    { 3903, 9576, 0, 3, 1 },
+    { 4036, 9576, 0, 2, 1 },
+    { 4108, 9576, 0, 2, 1 },
+    { 11000, 9576, 0, 2, 1 },
+    { 4472, 9576, 0, 2, 1 },
+    { 4798, 9576, 0, 2, 1 },
+    { 5144, 9576, 0, 2, 1 },
+    { 24203, 9576, 0, 5, 1 },
+    { 24208, 9576, 0, 5, 1 },
+    { 1308, 9576, 0, 2, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 1340, 9576, 0, 3, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 24213, 9576, 0, 3, 1 },
+    { 2599, 9576, 0, 3, 1 },
+    { 11727, 9576, 0, 3, 1 },
+    { 4113, 9576, 0, 3, 1 },
+    { 4380, 9576, 0, 3, 1 },
+    { 1340, 9576, 0, 3, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 4113, 9576, 0, 3, 1 },
+    { 4380, 9576, 0, 3, 1 },
+    { 1340, 9576, 0, 3, 1 },
+    { 1880, 9576, 0, 3, 1 },
+    { 2599, 9576, 0, 3, 1 },
+    { 24216, 9576, 0, 6, 1 },
+    { 24222, 9576, 1, 11, 0 },
+    { 3903, 9577, 0, 3, 1 },
+    { 4113, 9577, 0, 3, 1 },
+    { 4380, 9577, 0, 3, 1 },
+    { 24233, 9577, 0, 3, 1 },
+    { 11120, 9577, 0, 1, 1 },
+    { 1340, 9577, 0, 3, 1 },
+    { 1880, 9577, 0, 3, 1 },
+    { 2599, 9577, 0, 3, 1 },
+    { 3029, 9577, 0, 4, 1 },
+    { 3063, 9577, 0, 3, 1 },
+    { 4113, 9577, 0, 3, 1 },
+    { 4380, 9577, 0, 3, 1 },
+    { 24236, 9577, 0, 3, 1 },
+    { 24239, 9577, 2, 6, 1 },
+    { 1340, 9579, 0, 3, 1 },
+    { 1880, 9579, 0, 3, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 4113, 9579, 0, 3, 1 },
+    { 4380, 9579, 0, 3, 1 },
+    { 1308, 9579, 0, 2, 1 },
+    { 1340, 9579, 0, 3, 1 },
+    { 1880, 9579, 0, 3, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 4113, 9579, 0, 3, 1 },
+    { 4380, 9579, 0, 3, 1 },
+    { 24245, 9579, 0, 2, 1 },
+    { 10003, 9579, 0, 8, 1 },
+    { 10193, 9579, 0, 3, 1 },
+    { 24247, 9579, 0, 4, 1 },
+    { 24251, 9579, 0, 4, 2 },
+    { 24255, 9579, 0, 5, 1 },
+    { 24260, 9579, 0, 3, 1 },
+    { 50, 9579, 0, 2, 1 },
+    { 24263, 9579, 0, 4, 1 },
+    { 1340, 9579, 0, 3, 1 },
+    { 1880, 9579, 0, 3, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 24267, 9579, 0, 3, 1 },
+    { 17963, 9579, 0, 5, 1 },
+    { 3063, 9579, 0, 3, 1 },
+    { 3686, 9579, 0, 3, 1 },
+    { 4113, 9579, 0, 3, 1 },
+    { 4177, 9579, 0, 3, 1 },
+    { 4380, 9579, 0, 3, 1 },
+    { 10011, 9579, 0, 3, 1 },
+    { 17189, 9579, 0, 3, 1 },
+    { 10855, 9579, 0, 3, 1 },
+    { 24270, 9579, 0, 3, 1 },
+    { 1340, 9579, 0, 3, 1 },
+    { 1880, 9579, 0, 3, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 4113, 9579, 0, 3, 1 },
+    { 4380, 9579, 0, 3, 1 },
+    { 50, 9579, 0, 2, 1 },
+    { 712, 9579, 0, 3, 1 },
+    { 1308, 9579, 0, 2, 1 },
+    { 1638, 9579, 0, 2, 1 },
+    { 1880, 9579, 0, 3, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 3029, 9579, 0, 4, 1 },
+    { 4113, 9579, 0, 3, 1 },
+    { 4380, 9579, 0, 3, 1 },
+    { 5144, 9579, 0, 2, 1 },
+    { 10003, 9579, 0, 8, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 11049, 9579, 0, 10, 1 },
+    { 10003, 9579, 0, 8, 1 },
+    { 11017, 9579, 0, 3, 1 },
+    { 1340, 9579, 0, 3, 1 },
+    { 11020, 9579, 0, 4, 1 },
+    { 1880, 9579, 0, 3, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 2962, 9579, 0, 2, 1 },
+    { 3903, 9579, 0, 3, 1 },
+    { 4113, 9579, 0, 3, 1 },
+    { 4380, 9579, 0, 3, 1 },
+    { 1340, 9579, 0, 3, 1 },
+    { 1880, 9579, 0, 3, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 2962, 9579, 0, 2, 1 },
+    { 3837, 9579, 0, 3, 1 },
+    { 4113, 9579, 0, 3, 1 },
+    { 4380, 9579, 0, 3, 1 },
+    { 24273, 9579, 0, 3, 1 },
+    { 10011, 9579, 0, 3, 1 },
+    { 50, 9579, 0, 2, 1 },
+    { 1308, 9579, 0, 2, 1 },
+    { 2599, 9579, 0, 3, 1 },
+    { 4113, 9579, 0, 3, 1 },
+    { 4380, 9579, 0, 3, 1 },
+    { 4667, 9579, 0, 5, 1 },
+    { 24276, 9579, 0, 6, 1 },
+    { 12172, 9579, 0, 4, 1 },
+    { 5851, 9579, 0, 2, 1 },
+    { 404, 9579, 0, 2, 1 },
+    { 10003, 9579, 0, 8, 1 },
+    { 1638, 9579, 0, 2, 1 },
+    { 3207, 9579, 0, 2, 1 },
+    { 5860, 9579, 0, 2, 1 },
+    { 50, 9579, 0, 2, 1 },
+    { 11115, 9579, 0, 5, 1 },
+    { 24282, 9579, 0, 8, 1 },
+    { 24290, 9579, 0, 3, 1 },
+    { 1308, 9579, 0, 2, 1 },
+    { 24293, 9579, 1, 6, 1 },
+    { 24299, 9580, 0, 4, 1 },
+    { 17244, 9580, 0, 11, 1 },
+    { 24303, 9580, 0, 6, 1 },
+    { 11155, 9580, 0, 7, 1 },
+    { 24309, 9580, 0, 9, 1 },
+    { 1880, 9580, 0, 3, 1 },
+    { 24318, 9580, 0, 8, 1 },
+    { 24326, 9580, 0, 11, 1 },
+    { 24337, 9580, 0, 11, 1 },
+    { 24348, 9580, 0, 11, 1 },
+    { 24359, 9580, 0, 11, 1 },
+    { 24370, 9580, 0, 11, 1 },
+    { 24381, 9580, 0, 11, 1 },
+    { 24392, 9580, 0, 6, 1 },
+    { 2599, 9580, 0, 3, 1 },
+    { 24398, 9580, 0, 5, 1 },
+    { 24403, 9580, 0, 4, 1 },
+    { 24407, 9580, 0, 3, 1 },
+    { 24410, 9580, 0, 7, 1 },
+    { 24417, 9580, 0, 6, 1 },
+    { 24423, 9580, 0, 5, 1 },
+    { 24428, 9580, 0, 4, 1 },
+    { 24432, 9580, 0, 4, 1 },
+    { 4113, 9580, 0, 3, 1 },
+    { 24436, 9580, 0, 6, 1 },
+    { 24442, 9580, 0, 4, 1 },
+    { 4380, 9580, 0, 3, 1 },
+    { 11010, 9580, 0, 4, 1 },
+    { 12339, 9580, 0, 7, 1 },
+    { 24446, 9580, 0, 9, 1 },
+    { 24455, 9580, 0, 8, 1 },
+    { 24463, 9580, 0, 4, 1 },
+    { 24467, 9580, 1, 7, 0 },
+    { 24474, 9581, 0, 3, 1 },
+    { 11230, 9581, 0, 6, 1 },
+    { 18734, 9581, 0, 8, 1 },
+    { 24477, 9581, 0, 5, 1 },
+    { 10730, 9581, 0, 6, 1 },
+    { 11115, 9581, 0, 5, 1 },
+    { 1308, 9581, 0, 2, 1 },
+    { 1340, 9581, 0, 3, 1 },
+    { 1880, 9581, 0, 3, 1 },
+    { 2599, 9581, 0, 3, 1 },
+    { 3903, 9581, 0, 3, 1 },
+    { 10000, 9581, 0, 3, 1 },
+    { 4380, 9581, 0, 3, 1 },
+    { 17584, 9581, 0, 3, 1 },
+    { 5851, 9581, 0, 2, 1 },
+    { 10003, 9581, 0, 8, 1 },
+    { 1340, 9581, 0, 3, 1 },
+    { 1880, 9581, 0, 3, 1 },
+    { 2599, 9581, 0, 3, 1 },
+    { 11730, 9581, 0, 3, 1 },
+    { 4089, 9581, 0, 4, 1 },
+    { 4113, 9581, 0, 3, 1 },
+    { 4380, 9581, 0, 3, 1 },
+    { 1340, 9581, 0, 3, 1 },
+    { 1880, 9581, 0, 3, 1 },
+    { 12190, 9581, 0, 4, 1 },
+    { 2599, 9581, 0, 3, 1 },
+    { 4113, 9581, 0, 3, 1 },
+    { 4380, 9581, 0, 3, 1 },
+    { 12194, 9581, 0, 6, 1 },
+    { 1880, 9581, 0, 3, 1 },
+    { 2599, 9581, 0, 3, 1 },
+    { 4277, 9581, 0, 3, 1 },
+    { 4380, 9581, 0, 3, 1 },
+    { 1340, 9581, 0, 3, 1 },
+    { 1880, 9581, 0, 3, 1 },
+    { 2599, 9581, 0, 3, 1 },
+    { 4113, 9581, 0, 3, 1 },
+    { 4380, 9581, 0, 3, 1 },
+    { 11115, 9581, 0, 5, 1 },
+    { 11155, 9581, 0, 7, 1 },
+    { 24482, 9581, 0, 2, 1 },
+    { 10003, 9581, 0, 8, 1 },
+    { 2599, 9581, 0, 3, 1 },
+    { 1340, 9581, 0, 3, 1 },
+    { 1880, 9581, 0, 3, 1 },
+    { 2599, 9581, 0, 3, 1 },
+    { 24484, 9581, 0, 3, 1 },
+    { 24487, 9581, 0, 8, 1 },
+    { 4113, 9581, 0, 3, 1 },
+    { 4380, 9581, 0, 3, 1 },
+    { 1340, 9581, 1, 3, 1 },
+    { 1880, 9582, 0, 3, 1 },
+    { 4113, 9582, 0, 3, 1 },
+    { 4380, 9582, 0, 3, 1 },
+    { 50, 9582, 0, 2, 1 },
+    { 1308, 9582, 0, 2, 1 },
+    { 1340, 9582, 0, 3, 1 },
+    { 2599, 9582, 0, 3, 1 },
+    { 4113, 9582, 0, 3, 1 },
+    { 11000, 9582, 0, 2, 1 },
+    { 4380, 9582, 0, 3, 1 },
+    { 52, 9582, 0, 7, 1 },
+    { 24495, 9582, 0, 11, 1 },
+    { 24506, 9582, 0, 3, 1 },
+    { 24509, 9582, 0, 8, 1 },
+    { 24517, 9582, 0, 7, 1 },
+    { 24524, 9582, 0, 6, 1 },
+    { 24530, 9582, 0, 5, 1 },
+    { 10154, 9582, 0, 9, 1 },
+    { 24535, 9582, 0, 8, 1 },
+    { 24543, 9582, 0, 9, 1 },
+    { 24552, 9582, 0, 16, 1 },
+    { 24568, 9582, 0, 11, 1 },
+    { 284, 9582, 0, 9, 1 },
+    { 24579, 9582, 0, 3, 1 },
+    { 24582, 9582, 0, 9, 1 },
+    { 24591, 9582, 0, 6, 1 },
+    { 24597, 9582, 0, 12, 1 },
+    { 24609, 9582, 0, 8, 1 },
+    { 24617, 9582, 0, 8, 1 },
+    { 24625, 9582, 0, 9, 1 },
+    { 24634, 9582, 0, 14, 1 },
+    { 24648, 9582, 0, 11, 1 },
+    { 24659, 9582, 0, 12, 1 },
+    { 377, 9582, 0, 3, 1 },
+    { 24671, 9582, 0, 12, 1 },
+    { 24683, 9582, 0, 9, 1 },
+    { 24692, 9582, 0, 7, 1 },
+    { 24699, 9582, 0, 12, 1 },
+    { 24711, 9582, 0, 10, 1 },
+    { 12505, 9582, 0, 4, 1 },
+    { 24721, 9582, 0, 13, 1 },
+    { 24734, 9582, 0, 8, 1 },
+    { 24742, 9582, 0, 13, 1 },
+    { 24755, 9582, 0, 6, 1 },
+    { 10172, 9582, 0, 11, 1 },
+    { 24761, 9582, 0, 9, 1 },
+    { 24770, 9582, 0, 7, 1 },
+    { 24777, 9582, 0, 6, 1 },
+    { 24783, 9582, 0, 9, 1 },
+    { 24792, 9582, 0, 10, 1 },
+    { 24802, 9582, 0, 8, 1 },
+    { 24810, 9582, 0, 4, 1 },
+    { 24814, 9582, 0, 7, 1 },
+    { 24821, 9582, 0, 7, 1 },
+    { 24828, 9582, 0, 4, 1 },
+    { 24832, 9582, 0, 4, 1 },
+    { 24836, 9582, 0, 9, 1 },
+    { 535, 9582, 0, 9, 1 },
+    { 579, 9582, 0, 8, 1 },
+    { 24845, 9582, 0, 5, 1 },
+    { 24850, 9582, 0, 5, 1 },
+    { 24855, 9582, 0, 6, 1 },
+    { 24861, 9582, 0, 9, 1 },
+    { 24870, 9582, 0, 13, 1 },
+    { 24883, 9582, 0, 8, 1 },
+    { 24891, 9582, 0, 7, 1 },
+    { 24898, 9582, 0, 8, 1 },
+    { 654, 9582, 0, 6, 1 },
+    { 24906, 9582, 0, 4, 1 },
+    { 688, 9582, 0, 5, 1 },
+    { 24910, 9582, 0, 6, 1 },
+    { 24916, 9582, 0, 4, 1 },
+    { 24920, 9582, 0, 7, 1 },
+    { 24927, 9582, 0, 10, 1 },
+    { 24937, 9582, 0, 4, 1 },
+    { 834, 9582, 0, 6, 1 },
+    { 24941, 9582, 0, 9, 1 },
+    { 24950, 9582, 0, 15, 1 },
+    { 24965, 9582, 0, 13, 1 },
+    { 24978, 9582, 0, 6, 1 },
+    { 24984, 9582, 0, 16, 1 },
+    { 25000, 9582, 0, 6, 1 },
+    { 25006, 9582, 0, 7, 1 },
+    { 25013, 9582, 0, 7, 1 },
+    { 25020, 9582, 0, 15, 1 },
+    { 25035, 9582, 0, 9, 1 },
+    { 25044, 9582, 0, 6, 1 },
+    { 25050, 9582, 0, 7, 1 },
+    { 896, 9582, 0, 8, 1 },
+    { 25057, 9582, 0, 9, 1 },
+    { 25066, 9582, 0, 8, 1 },
+    { 25074, 9582, 0, 7, 1 },
+    { 25081, 9582, 0, 3, 1 },
+    { 25084, 9582, 0, 6, 1 },
+    { 25090, 9582, 0, 8, 1 },
+    { 25098, 9582, 0, 10, 1 },
+    { 25108, 9582, 0, 9, 1 },
+    { 25117, 9582, 0, 3, 1 },
+    { 25120, 9582, 0, 6, 1 },
+    { 25126, 9582, 0, 10, 1 },
+    { 25136, 9582, 0, 7, 1 },
+    { 25143, 9582, 0, 10, 1 },
+    { 25153, 9582, 0, 14, 1 },
+    { 25167, 9582, 0, 6, 1 },
+    { 25173, 9582, 0, 7, 1 },
+    { 25180, 9582, 0, 6, 1 },
+    { 1107, 9582, 0, 6, 1 },
+    { 25186, 9582, 0, 11, 1 },
+    { 25197, 9582, 0, 10, 1 },
+    { 25207, 9582, 0, 13, 1 },
+    { 25220, 9582, 0, 7, 1 },
+    { 25227, 9582, 0, 8, 1 },
+    { 25235, 9582, 0, 9, 1 },
+    { 25244, 9582, 0, 15, 1 },
+    { 25259, 9582, 0, 12, 1 },
+    { 25271, 9582, 0, 9, 1 },
+    { 25280, 9582, 0, 14, 1 },
+    { 25294, 9582, 0, 10, 1 },
+    { 25304, 9582, 0, 6, 1 },
+    { 25310, 9582, 0, 6, 1 },
+    { 25316, 9582, 0, 12, 1 },
+    { 25328, 9582, 0, 12, 1 },
+    { 25340, 9582, 0, 8, 1 },
+    { 25348, 9582, 0, 7, 1 },
+    { 25355, 9582, 0, 5, 1 },
+    { 25360, 9582, 0, 4, 1 },
+    { 25364, 9582, 0, 14, 1 },
+    { 25378, 9582, 0, 4, 1 },
+    { 25382, 9582, 0, 7, 1 },
+    { 25389, 9582, 0, 10, 1 },
+    { 25399, 9582, 0, 20, 1 },
+    { 25419, 9582, 0, 15, 1 },
+    { 25434, 9582, 0, 8, 1 },
+    { 25442, 9582, 0, 8, 1 },
+    { 25450, 9582, 0, 13, 1 },
+    { 25463, 9582, 0, 14, 1 },
+    { 1358, 9582, 0, 9, 1 },
+    { 1381, 9582, 0, 8, 1 },
+    { 25477, 9582, 0, 15, 1 },
+    { 25492, 9582, 0, 14, 1 },
+    { 25506, 9582, 0, 12, 1 },
+    { 25518, 9582, 0, 15, 1 },
+    { 25533, 9582, 0, 7, 1 },
+    { 25540, 9582, 0, 10, 1 },
+    { 25550, 9582, 0, 11, 1 },
+    { 25561, 9582, 0, 29, 1 },
+    { 25590, 9582, 0, 8, 1 },
+    { 25598, 9582, 0, 7, 1 },
+    { 25605, 9582, 0, 13, 1 },
+    { 25618, 9582, 0, 6, 1 },
+    { 25624, 9582, 0, 6, 1 },
+    { 25630, 9582, 0, 9, 1 },
+    { 25639, 9582, 0, 8, 1 },
+    { 25647, 9582, 0, 8, 1 },
+    { 25655, 9582, 0, 14, 1 },
+    { 25669, 9582, 0, 7, 1 },
+    { 25676, 9582, 0, 5, 1 },
+    { 1584, 9582, 0, 5, 1 },
+    { 25681, 9582, 0, 4, 1 },
+    { 25685, 9582, 0, 6, 1 },
+    { 25691, 9582, 0, 8, 1 },
+    { 25699, 9582, 0, 3, 1 },
+    { 25702, 9582, 0, 14, 1 },
+    { 25716, 9582, 0, 8, 1 },
+    { 25724, 9582, 0, 11, 1 },
+    { 25735, 9582, 0, 7, 1 },
+    { 25742, 9582, 0, 5, 1 },
+    { 1711, 9582, 0, 6, 1 },
+    { 25747, 9582, 0, 7, 1 },
+    { 25754, 9582, 0, 8, 1 },
+    { 25762, 9582, 0, 9, 1 },
+    { 25771, 9582, 0, 5, 1 },
+    { 25776, 9582, 0, 8, 1 },
+    { 25784, 9582, 0, 6, 1 },
+    { 25790, 9582, 0, 10, 1 },
+    { 25800, 9582, 0, 9, 1 },
+    { 1883, 9582, 0, 9, 1 },
+    { 25809, 9582, 0, 11, 1 },
+    { 25820, 9582, 0, 8, 1 },
+    { 25828, 9582, 0, 9, 1 },
+    { 25837, 9582, 0, 6, 1 },
+    { 25843, 9582, 0, 10, 1 },
+    { 25853, 9582, 0, 10, 1 },
+    { 25863, 9582, 0, 12, 1 },
+    { 25875, 9582, 0, 7, 1 },
+    { 25882, 9582, 0, 10, 1 },
+    { 25892, 9582, 0, 11, 1 },
+    { 25903, 9582, 0, 25, 1 },
+    { 25928, 9582, 0, 8, 1 },
+    { 25936, 9582, 0, 5, 1 },
+    { 1976, 9582, 0, 6, 1 },
+    { 25941, 9582, 0, 9, 1 },
+    { 25950, 9582, 0, 6, 1 },
+    { 25956, 9582, 0, 10, 1 },
+    { 2073, 9582, 0, 6, 1 },
+    { 2086, 9582, 0, 4, 1 },
+    { 25966, 9582, 0, 13, 1 },
+    { 2090, 9582, 0, 7, 1 },
+    { 25979, 9582, 0, 9, 1 },
+    { 25988, 9582, 0, 5, 1 },
+    { 25993, 9582, 0, 8, 1 },
+    { 26001, 9582, 0, 9, 1 },
+    { 2153, 9582, 0, 4, 1 },
+    { 26010, 9582, 0, 7, 1 },
+    { 26017, 9582, 0, 8, 1 },
+    { 26025, 9582, 0, 7, 1 },
+    { 26032, 9582, 0, 8, 1 },
+    { 26040, 9582, 0, 7, 1 },
+    { 26047, 9582, 0, 5, 1 },
+    { 26052, 9582, 0, 12, 1 },
+    { 26064, 9582, 0, 9, 1 },
+    { 2309, 9582, 0, 10, 1 },
+    { 26073, 9582, 0, 9, 1 },
+    { 26082, 9582, 0, 9, 1 },
+    { 26091, 9582, 0, 12, 1 },
+    { 26103, 9582, 0, 11, 1 },
+    { 26114, 9582, 0, 8, 1 },
+    { 26122, 9582, 0, 8, 1 },
+    { 26130, 9582, 0, 4, 1 },
+    { 26134, 9582, 0, 8, 1 },
+    { 2381, 9582, 0, 9, 1 },
+    { 2404, 9582, 0, 7, 1 },
+    { 2434, 9582, 0, 6, 1 },
+    { 17070, 9582, 0, 7, 1 },
+    { 26142, 9582, 0, 9, 1 },
+    { 26151, 9582, 0, 11, 1 },
+    { 26162, 9582, 0, 7, 1 },
+    { 26169, 9582, 0, 7, 1 },
+    { 26176, 9582, 0, 7, 1 },
+    { 26183, 9582, 0, 4, 1 },
+    { 2510, 9582, 0, 5, 1 },
+    { 26187, 9582, 0, 5, 1 },
+    { 26192, 9582, 0, 11, 1 },
+    { 26203, 9582, 0, 4, 1 },
+    { 26207, 9582, 0, 8, 1 },
+    { 26215, 9582, 0, 10, 1 },
+    { 2699, 9582, 0, 7, 1 },
+    { 26225, 9582, 0, 7, 1 },
+    { 26232, 9582, 0, 18, 1 },
+    { 26250, 9582, 0, 6, 1 },
+    { 2732, 9582, 0, 6, 1 },
+    { 26256, 9582, 0, 14, 1 },
+    { 26270, 9582, 0, 6, 1 },
+    { 2752, 9582, 0, 8, 1 },
+    { 26276, 9582, 0, 15, 1 },
+    { 26291, 9582, 0, 8, 1 },
+    { 26299, 9582, 0, 8, 1 },
+    { 26307, 9582, 0, 10, 1 },
+    { 26317, 9582, 0, 17, 1 },
+    { 26334, 9582, 0, 14, 1 },
+    { 26348, 9582, 0, 10, 1 },
+    { 26358, 9582, 0, 12, 1 },
+    { 26370, 9582, 0, 7, 1 },
+    { 26377, 9582, 0, 16, 1 },
+    { 26393, 9582, 0, 8, 1 },
+    { 2913, 9582, 0, 5, 1 },
+    { 26401, 9582, 0, 10, 1 },
+    { 26411, 9582, 0, 12, 1 },
+    { 26423, 9582, 0, 13, 1 },
+    { 26436, 9582, 0, 6, 1 },
+    { 26442, 9582, 0, 7, 1 },
+    { 26449, 9582, 0, 12, 1 },
+    { 26461, 9582, 0, 12, 1 },
+    { 26473, 9582, 0, 12, 1 },
+    { 26485, 9582, 0, 11, 1 },
+    { 26496, 9582, 0, 4, 1 },
+    { 26500, 9582, 0, 4, 1 },
+    { 26504, 9582, 0, 9, 1 },
+    { 26513, 9582, 0, 7, 1 },
+    { 26520, 9582, 0, 9, 1 },
+    { 26529, 9582, 0, 9, 1 },
+    { 3168, 9582, 0, 7, 1 },
+    { 26538, 9582, 0, 6, 1 },
+    { 26544, 9582, 0, 9, 1 },
+    { 26553, 9582, 0, 3, 1 },
+    { 26556, 9582, 0, 10, 1 },
+    { 26566, 9582, 0, 7, 1 },
+    { 26573, 9582, 0, 11, 1 },
+    { 26584, 9582, 0, 10, 1 },
+    { 26594, 9582, 0, 4, 1 },
+    { 26598, 9582, 0, 6, 1 },
+    { 26604, 9582, 0, 9, 1 },
+    { 3298, 9582, 0, 4, 1 },
+    { 26613, 9582, 0, 10, 1 },
+    { 3332, 9582, 0, 5, 1 },
+    { 26623, 9582, 0, 5, 1 },
+    { 26628, 9582, 0, 13, 1 },
+    { 26641, 9582, 0, 14, 1 },
+    { 26655, 9582, 0, 5, 1 },
+    { 26660, 9582, 0, 6, 1 },
+    { 26666, 9582, 0, 7, 1 },
+    { 26673, 9582, 0, 10, 1 },
+    { 26683, 9582, 0, 6, 1 },
+    { 26689, 9582, 0, 4, 1 },
+    { 26693, 9582, 0, 7, 1 },
+    { 26700, 9582, 0, 11, 1 },
+    { 3583, 9582, 0, 7, 1 },
+    { 26711, 9582, 0, 4, 1 },
+    { 3608, 9582, 0, 6, 1 },
+    { 26715, 9582, 0, 13, 1 },
+    { 26728, 9582, 0, 12, 1 },
+    { 3645, 9582, 0, 6, 1 },
+    { 26740, 9582, 0, 10, 1 },
+    { 26750, 9582, 0, 6, 1 },
+    { 26756, 9582, 0, 8, 1 },
+    { 26764, 9582, 0, 7, 1 },
+    { 26771, 9582, 0, 10, 1 },
+    { 26781, 9582, 0, 6, 1 },
+    { 26787, 9582, 0, 5, 1 },
+    { 26792, 9582, 0, 3, 1 },
+    { 3724, 9582, 0, 6, 1 },
+    { 26795, 9582, 0, 8, 1 },
+    { 26803, 9582, 0, 10, 1 },
+    { 26813, 9582, 0, 7, 1 },
+    { 26820, 9582, 0, 8, 1 },
+    { 26828, 9582, 0, 4, 1 },
+    { 26832, 9582, 0, 7, 1 },
+    { 26839, 9582, 0, 8, 1 },
+    { 26847, 9582, 0, 8, 1 },
+    { 26855, 9582, 0, 8, 1 },
+    { 26863, 9582, 0, 10, 1 },
+    { 3840, 9582, 0, 5, 1 },
+    { 26873, 9582, 0, 7, 1 },
+    { 26880, 9582, 0, 19, 1 },
+    { 26899, 9582, 0, 6, 1 },
+    { 3862, 9582, 0, 8, 1 },
+    { 26905, 9582, 0, 9, 1 },
+    { 26914, 9582, 0, 8, 1 },
+    { 26922, 9582, 0, 11, 1 },
+    { 26933, 9582, 0, 8, 1 },
+    { 26941, 9582, 0, 4, 1 },
+    { 26945, 9582, 0, 6, 1 },
+    { 26951, 9582, 0, 6, 1 },
+    { 26957, 9582, 0, 9, 1 },
+    { 26966, 9582, 0, 7, 1 },
+    { 26973, 9582, 0, 8, 1 },
+    { 26981, 9582, 0, 6, 1 },
+    { 26987, 9582, 0, 4, 1 },
+    { 3975, 9582, 0, 5, 1 },
+    { 26991, 9582, 0, 8, 1 },
+    { 26999, 9582, 0, 10, 1 },
+    { 27009, 9582, 0, 8, 1 },
+    { 4001, 9582, 0, 6, 1 },
+    { 27017, 9582, 0, 10, 1 },
+    { 27027, 9582, 0, 8, 1 },
+    { 27035, 9582, 0, 8, 1 },
+    { 27043, 9582, 0, 8, 1 },
+    { 27051, 9582, 0, 6, 1 },
+    { 27057, 9582, 0, 6, 1 },
+    { 27063, 9582, 0, 12, 1 },
+    { 27075, 9582, 0, 16, 1 },
+    { 4057, 9582, 0, 5, 1 },
+    { 27091, 9582, 0, 8, 1 },
+    { 27099, 9582, 0, 16, 1 },
+    { 27115, 9582, 0, 16, 1 },
+    { 27131, 9582, 0, 14, 1 },
+    { 27145, 9582, 0, 14, 1 },
+    { 27159, 9582, 0, 20, 1 },
+    { 27179, 9582, 0, 15, 1 },
+    { 27194, 9582, 0, 6, 1 },
+    { 27200, 9582, 0, 17, 1 },
+    { 27217, 9582, 0, 19, 1 },
+    { 27236, 9582, 0, 8, 1 },
+    { 27244, 9582, 0, 5, 1 },
+    { 27249, 9582, 0, 8, 1 },
+    { 27257, 9582, 0, 5, 1 },
+    { 27262, 9582, 0, 12, 1 },
+    { 27274, 9582, 0, 9, 1 },
+    { 27283, 9582, 0, 9, 1 },
+    { 27292, 9582, 0, 7, 1 },
+    { 27299, 9582, 0, 9, 1 },
+    { 27308, 9582, 0, 7, 1 },
+    { 27315, 9582, 0, 6, 1 },
+    { 27321, 9582, 0, 7, 1 },
+    { 27328, 9582, 0, 5, 1 },
+    { 4269, 9582, 0, 3, 1 },
+    { 4277, 9582, 0, 3, 1 },
+    { 27333, 9582, 0, 4, 1 },
+    { 27337, 9582, 0, 13, 1 },
+    { 27350, 9582, 0, 15, 1 },
+    { 27365, 9582, 0, 5, 1 },
+    { 4355, 9582, 0, 6, 1 },
+    { 27370, 9582, 0, 7, 1 },
+    { 27377, 9582, 0, 7, 1 },
+    { 27384, 9582, 0, 6, 1 },
+    { 27390, 9582, 0, 11, 1 },
+    { 27401, 9582, 0, 5, 1 },
+    { 27406, 9582, 0, 6, 1 },
+    { 27412, 9582, 0, 7, 1 },
+    { 27419, 9582, 0, 9, 1 },
+    { 27428, 9582, 0, 6, 1 },
+    { 27434, 9582, 0, 5, 1 },
+    { 27439, 9582, 0, 11, 1 },
+    { 27450, 9582, 0, 6, 1 },
+    { 4429, 9582, 0, 5, 1 },
+    { 27456, 9582, 0, 8, 1 },
+    { 4489, 9582, 0, 8, 1 },
+    { 27464, 9582, 0, 12, 1 },
+    { 27476, 9582, 0, 16, 1 },
+    { 27492, 9582, 0, 9, 1 },
+    { 27501, 9582, 0, 7, 1 },
+    { 4517, 9582, 0, 11, 1 },
+    { 27508, 9582, 0, 6, 1 },
+    { 27514, 9582, 0, 10, 1 },
+    { 27524, 9582, 0, 11, 1 },
+    { 27535, 9582, 0, 10, 1 },
+    { 27545, 9582, 0, 6, 1 },
+    { 27551, 9582, 0, 5, 1 },
+    { 27556, 9582, 0, 6, 1 },
+    { 27562, 9582, 0, 8, 1 },
+    { 27570, 9582, 0, 10, 1 },
+    { 27580, 9582, 0, 28, 1 },
+    { 27608, 9582, 0, 12, 1 },
+    { 27620, 9582, 0, 8, 1 },
+    { 4667, 9582, 0, 5, 1 },
+    { 27628, 9582, 0, 7, 1 },
+    { 27635, 9582, 0, 6, 1 },
+    { 27641, 9582, 0, 5, 1 },
+    { 4776, 9582, 0, 6, 1 },
+    { 27646, 9582, 0, 8, 1 },
+    { 27654, 9582, 0, 7, 1 },
+    { 10554, 9582, 0, 8, 1 },
+    { 27661, 9582, 0, 10, 1 },
+    { 27671, 9582, 0, 12, 1 },
+    { 27683, 9582, 0, 9, 1 },
+    { 27692, 9582, 0, 7, 1 },
+    { 20591, 9582, 0, 4, 1 },
+    { 27699, 9582, 0, 6, 1 },
+    { 27705, 9582, 0, 10, 1 },
+    { 27715, 9582, 0, 5, 1 },
+    { 27720, 9582, 0, 12, 1 },
+    { 27732, 9582, 0, 8, 1 },
+    { 27740, 9582, 0, 8, 1 },
+    { 27748, 9582, 0, 12, 1 },
+    { 27760, 9582, 0, 12, 1 },
+    { 27772, 9582, 0, 9, 1 },
+    { 27781, 9582, 0, 7, 1 },
+    { 27788, 9582, 0, 12, 1 },
+    { 27800, 9582, 0, 4, 1 },
+    { 27804, 9582, 0, 10, 1 },
+    { 27814, 9582, 0, 12, 1 },
+    { 27826, 9582, 0, 11, 1 },
+    { 27837, 9582, 0, 11, 1 },
+    { 5181, 9582, 0, 6, 1 },
+    { 27848, 9582, 0, 7, 1 },
+    { 5200, 9582, 0, 7, 1 },
+    { 27855, 9582, 0, 15, 1 },
+    { 27870, 9582, 0, 17, 1 },
+    { 27887, 9582, 0, 18, 1 },
+    { 27905, 9582, 0, 13, 1 },
+    { 27918, 9582, 0, 14, 1 },
+    { 27932, 9582, 0, 14, 1 },
+    { 27946, 9582, 0, 8, 1 },
+    { 27954, 9582, 0, 18, 1 },
+    { 27972, 9582, 0, 8, 1 },
+    { 27980, 9582, 0, 7, 1 },
+    { 27987, 9582, 0, 10, 1 },
+    { 27997, 9582, 0, 8, 1 },
+    { 5302, 9582, 0, 5, 1 },
+    { 28005, 9582, 0, 10, 1 },
+    { 28015, 9582, 0, 7, 1 },
+    { 5355, 9582, 0, 4, 1 },
+    { 5378, 9582, 0, 3, 1 },
+    { 28022, 9582, 0, 5, 1 },
+    { 28027, 9582, 0, 7, 1 },
+    { 28034, 9582, 0, 7, 1 },
+    { 28041, 9582, 0, 14, 1 },
+    { 28055, 9582, 0, 13, 1 },
+    { 28068, 9582, 0, 9, 1 },
+    { 5480, 9582, 0, 5, 1 },
+    { 28077, 9582, 0, 3, 1 },
+    { 28080, 9582, 0, 6, 1 },
+    { 28086, 9582, 0, 5, 1 },
+    { 28091, 9582, 0, 8, 1 },
+    { 28099, 9582, 0, 9, 1 },
+    { 28108, 9582, 0, 5, 1 },
+    { 28113, 9582, 0, 15, 1 },
+    { 28128, 9582, 0, 7, 1 },
+    { 28135, 9582, 0, 5, 1 },
+    { 28140, 9582, 0, 10, 1 },
+    { 28150, 9582, 0, 6, 1 },
+    { 5548, 9582, 0, 9, 1 },
+    { 28156, 9582, 0, 12, 1 },
+    { 28168, 9582, 0, 9, 1 },
+    { 28177, 9582, 0, 6, 1 },
+    { 28183, 9582, 0, 12, 1 },
+    { 28195, 9582, 0, 6, 1 },
+    { 28201, 9582, 0, 8, 1 },
+    { 28209, 9582, 0, 6, 1 },
+    { 5653, 9582, 0, 6, 1 },
+    { 28215, 9582, 0, 4, 1 },
+    { 28219, 9582, 0, 3, 1 },
+    { 5739, 9582, 0, 10, 1 },
+    { 28222, 9582, 0, 17, 1 },
+    { 28239, 9582, 0, 10, 1 },
+    { 28249, 9582, 0, 5, 1 },
+    { 28254, 9582, 0, 7, 1 },
+    { 5778, 9582, 0, 7, 1 },
+    { 28261, 9582, 0, 4, 1 },
+    { 28265, 9582, 0, 11, 1 },
+    { 28276, 9582, 0, 8, 1 },
+    { 20759, 9582, 0, 6, 1 },
+    { 28284, 9582, 0, 5, 1 },
+    { 5902, 9582, 0, 4, 1 },
+    { 28289, 9582, 0, 9, 1 },
+    { 28298, 9582, 0, 4, 1 },
+    { 28302, 9582, 0, 7, 1 },
+    { 5984, 9582, 0, 5, 1 },
+    { 28309, 9582, 0, 7, 1 },
+    { 28316, 9582, 0, 5, 1 },
+    { 28321, 9582, 0, 3, 1 },
+    { 28324, 9582, 0, 8, 1 },
+    { 6040, 9582, 0, 10, 1 },
+    { 28332, 9582, 0, 3, 1 },
+    { 28335, 9582, 0, 10, 1 },
+    { 28345, 9582, 0, 6, 1 },
+    { 28351, 9582, 0, 15, 1 },
+    { 28366, 9582, 0, 9, 1 },
+    { 28375, 9582, 0, 16, 1 },
+    { 28391, 9582, 0, 8, 1 },
+    { 28399, 9582, 0, 9, 1 },
+    { 28408, 9582, 0, 7, 1 },
+    { 28415, 9582, 0, 15, 1 },
+    { 28430, 9582, 0, 4, 1 },
+    { 28434, 9582, 0, 4, 1 },
+    { 28438, 9582, 0, 6, 1 },
+    { 28444, 9582, 0, 6, 1 },
+    { 28450, 9582, 0, 10, 1 },
+    { 6181, 9582, 0, 6, 1 },
+    { 28460, 9582, 0, 7, 1 },
+    { 28467, 9582, 0, 8, 1 },
+    { 28475, 9582, 0, 7, 1 },
+    { 28482, 9582, 0, 7, 1 },
+    { 6223, 9582, 0, 10, 1 },
+    { 28489, 9582, 0, 11, 1 },
+    { 6283, 9582, 0, 5, 1 },
+    { 28500, 9582, 0, 8, 1 },
+    { 28508, 9582, 0, 3, 1 },
+    { 28511, 9582, 0, 12, 1 },
+    { 28523, 9582, 0, 15, 1 },
+    { 28538, 9582, 0, 13, 1 },
+    { 28551, 9582, 0, 7, 1 },
+    { 28558, 9582, 0, 9, 1 },
+    { 28567, 9582, 0, 7, 1 },
+    { 28574, 9582, 0, 8, 1 },
+    { 28582, 9582, 0, 12, 1 },
+    { 28594, 9582, 0, 8, 1 },
+    { 28602, 9582, 0, 8, 1 },
+    { 28610, 9582, 0, 14, 1 },
+    { 28624, 9582, 0, 20, 1 },
+    { 28644, 9582, 0, 36, 1 },
+    { 28680, 9582, 0, 10, 1 },
+    { 28690, 9582, 0, 11, 1 },
+    { 28701, 9582, 0, 4, 1 },
+    { 28705, 9582, 0, 9, 1 },
+    { 28714, 9582, 0, 8, 1 },
+    { 28722, 9582, 0, 5, 1 },
+    { 28727, 9582, 0, 10, 1 },
+    { 28737, 9582, 0, 7, 1 },
+    { 28744, 9582, 0, 8, 1 },
+    { 28752, 9582, 0, 14, 1 },
+    { 112, 9582, 0, 4, 1 },
+    { 712, 9582, 0, 3, 1 },
+    { 1340, 9582, 0, 3, 1 },
+    { 1466, 9582, 0, 4, 1 },
+    { 1880, 9582, 0, 3, 1 },
+    { 2599, 9582, 0, 3, 1 },
+    { 3029, 9582, 0, 4, 1 },
+    { 3063, 9582, 0, 3, 1 },
+    { 3903, 9582, 0, 3, 1 },
+    { 4051, 9582, 0, 6, 1 },
+    { 4089, 9582, 0, 4, 1 },
+    { 4113, 9582, 0, 3, 1 },
+    { 4380, 9582, 0, 3, 1 },
+    { 4677, 9582, 0, 3, 1 },
+    { 50, 9582, 0, 2, 1 },
+    { 712, 9582, 0, 3, 1 },
+    { 1308, 9582, 0, 2, 1 },
+    { 1340, 9582, 0, 3, 1 },
+    { 1466, 9582, 0, 4, 1 },
+    { 1880, 9582, 0, 3, 1 },
+    { 2599, 9582, 0, 3, 1 },
+    { 3063, 9582, 0, 3, 1 },
+    { 4051, 9582, 0, 6, 1 },
+    { 4113, 9582, 0, 3, 1 },
+    { 4380, 9582, 0, 3, 1 },
+    { 10003, 9582, 0, 8, 1 },
+    { 1340, 9582, 0, 3, 1 },
+    { 1880, 9582, 0, 3, 1 },
+    { 10863, 9582, 0, 3, 1 },
+    { 4113, 9582, 0, 3, 1 },
+    { 4380, 9582, 0, 3, 1 },
+    { 712, 9582, 0, 3, 1 },
+    { 10003, 9582, 0, 8, 1 },
+    { 1340, 9582, 0, 3, 1 },
+    { 1880, 9582, 0, 3, 1 },
+    { 2599, 9582, 0, 3, 1 },
+    { 3903, 9582, 0, 3, 1 },
+    { 4089, 9582, 0, 4, 1 },
+    { 4113, 9582, 0, 3, 1 },
+    { 4380, 9582, 0, 3, 1 },
+    { 50, 9582, 0, 2, 1 },
+    { 11513, 9582, 0, 3, 1 },
+    { 1308, 9582, 0, 2, 1 },
+    { 1880, 9582, 0, 3, 1 },
+    { 2599, 9582, 0, 3, 1 },
+    { 3903, 9582, 0, 3, 1 },
+    { 4113, 9582, 0, 3, 1 },
+    { 4380, 9582, 0, 3, 1 },
+    { 947, 9582, 0, 2, 1 },
+    { 1103, 9582, 0, 2, 1 },
+    { 1308, 9582, 0, 2, 1 },
+    { 1340, 9582, 0, 3, 1 },
+    { 18059, 9582, 0, 2, 1 },
+    { 3006, 9582, 0, 2, 1 },
+    { 3029, 9582, 0, 4, 1 },
+    { 3946, 9582, 0, 4, 1 },
+    { 4072, 9582, 0, 2, 1 },
+    { 4089, 9582, 0, 4, 1 },
+    { 11000, 9582, 0, 2, 1 },
+    { 4380, 9582, 0, 3, 1 },
+    { 4677, 9582, 0, 3, 1 },
+    { 5181, 9582, 0, 6, 1 },
+    { 6011, 9582, 0, 2, 1 },
+    { 6059, 9582, 0, 2, 1 },
+    { 6469, 9582, 0, 2, 1 },
+    { 22619, 9582, 1, 3, 0 },
+    { 28766, 9583, 1, 3, 0 },
+    { 12172, 9584, 0, 4, 1 },
+    { 10000, 9584, 0, 3, 1 },
+    { 12605, 9584, 0, 13, 1 },
+    { 28769, 9584, 0, 14, 1 },
+    { 28783, 9584, 0, 14, 1 },
+    { 28797, 9584, 0, 6, 1 },
+    { 28803, 9584, 0, 6, 1 },
+    { 28809, 9584, 0, 14, 1 },
+    { 28823, 9584, 0, 10, 1 },
+    { 28833, 9584, 0, 18, 1 },
+    { 28851, 9584, 0, 8, 1 },
+    { 28859, 9584, 0, 16, 1 },
+    { 28875, 9584, 0, 12, 1 },
+    { 28887, 9584, 0, 20, 1 },
+    { 28907, 9584, 0, 9, 1 },
+    { 28916, 9584, 0, 17, 1 },
+    { 28933, 9584, 0, 10, 1 },
+    { 28943, 9584, 0, 6, 1 },
+    { 28949, 9584, 0, 12, 1 },
+    { 28961, 9584, 1, 13, 0 },
+    { 28974, 9585, 0, 12, 1 },
+    { 28986, 9585, 7, 15, 1 },
+    { 29001, 9592, 0, 13, 1 },
+    { 29014, 9592, 0, 4, 1 },
+    { 29018, 9592, 0, 4, 1 },
+    { 29022, 9592, 0, 4, 1 },
+    { 11115, 9592, 0, 5, 1 },
+    { 29026, 9592, 0, 9, 1 },
+    { 29035, 9592, 0, 12, 1 },
+    { 12844, 9592, 0, 7, 1 },
+    { 29047, 9592, 0, 6, 1 },
+    { 29053, 9592, 0, 8, 1 },
+    { 12883, 9592, 0, 7, 1 },
+    { 29061, 9592, 0, 8, 1 },
+    { 29069, 9592, 0, 10, 1 },
+    { 29079, 9592, 0, 7, 1 },
+    { 29086, 9592, 0, 9, 1 },
+    { 29095, 9592, 1, 5, 0 },
+    { 29100, 9593, 0, 9, 1 },
+    { 29109, 9593, 1, 11, 1 },
+    { 29120, 9594, 0, 11, 1 },
+    { 17849, 9594, 0, 11, 1 },
+    { 29131, 9594, 0, 8, 1 },
+    { 29139, 9594, 0, 10, 1 },
+    { 29149, 9594, 0, 14, 1 },
+    { 29163, 9594, 2, 10, 1 },
+    { 29173, 9596, 0, 13, 1 },
+    { 16422, 9596, 0, 13, 1 },
+    { 29186, 9596, 0, 11, 2 },
+    { 13033, 9596, 0, 10, 1 },
+    { 24299, 9596, 0, 4, 1 },
+    { 29197, 9596, 0, 6, 1 },
+    { 18398, 9596, 0, 8, 1 },
+    { 13176, 9596, 0, 8, 1 },
+    { 13184, 9596, 0, 7, 1 },
+    { 29203, 9596, 0, 5, 1 },
+    { 29208, 9596, 0, 7, 1 },
+    { 13212, 9596, 0, 9, 1 },
+    { 13254, 9596, 0, 7, 1 },
+    { 13271, 9596, 0, 8, 1 },
+    { 29215, 9596, 0, 9, 1 },
+    { 29224, 9596, 0, 4, 1 },
+    { 29228, 9596, 0, 5, 1 },
+    { 29233, 9596, 0, 14, 1 },
+    { 29247, 9596, 0, 7, 1 },
+    { 29254, 9596, 0, 7, 1 },
+    { 29261, 9596, 0, 15, 1 },
+    { 29276, 9596, 0, 9, 1 },
+    { 29285, 9596, 0, 17, 1 },
+    { 29302, 9596, 3, 6, 0 },
+    { 29308, 9599, 0, 13, 1 },
+    { 13539, 9599, 0, 8, 1 },
+    { 29321, 9599, 4, 6, 0 },
+    { 29327, 9603, 1, 8, 1 },
+    { 29335, 9604, 0, 10, 1 },
+    { 29345, 9604, 0, 8, 1 },
+    { 13604, 9604, 0, 16, 1 },
+    { 29353, 9604, 0, 12, 1 },
+    { 29365, 9604, 0, 7, 1 },
+    { 29372, 9604, 0, 7, 1 },
+    { 29379, 9604, 0, 7, 1 },
+    { 29386, 9604, 0, 7, 1 },
+    { 2443, 9604, 0, 2, 1 },
+    { 29393, 9604, 0, 7, 1 },
+    { 29400, 9604, 0, 12, 1 },
+    { 29412, 9604, 0, 6, 1 },
+    { 29418, 9604, 0, 5, 1 },
+    { 29423, 9604, 0, 7, 1 },
+    { 29430, 9604, 0, 6, 1 },
+    { 14151, 9604, 0, 9, 1 },
+    { 14189, 9604, 0, 8, 1 },
+    { 2929, 9604, 0, 2, 1 },
+    { 3006, 9604, 0, 2, 1 },
+    { 16672, 9604, 0, 6, 1 },
+    { 29436, 9604, 0, 11, 1 },
+    { 16678, 9604, 0, 6, 1 },
+    { 29447, 9604, 0, 4, 1 },
+    { 29451, 9604, 0, 7, 1 },
+    { 14351, 9604, 0, 9, 1 },
+    { 14461, 9604, 0, 9, 1 },
+    { 14996, 9604, 0, 8, 1 },
+    { 3207, 9604, 0, 2, 1 },
+    { 29458, 9604, 0, 9, 1 },
+    { 29467, 9604, 0, 8, 1 },
+    { 29475, 9604, 0, 10, 1 },
+    { 29485, 9604, 0, 8, 1 },
+    { 15170, 9604, 1, 11, 0 },
+    { 29493, 9605, 0, 9, 1 },
+    { 29502, 9605, 0, 6, 1 },
+    { 18511, 9605, 0, 9, 1 },
+    { 29508, 9605, 0, 7, 1 },
+    { 15248, 9605, 0, 7, 1 },
+    { 29515, 9605, 0, 9, 1 },
+    { 29524, 9605, 0, 8, 1 },
+    { 29532, 9605, 0, 7, 1 },
+    { 29539, 9605, 0, 9, 1 },
+    { 29548, 9605, 0, 5, 1 },
+    { 15289, 9605, 0, 16, 1 },
+    { 10988, 9605, 0, 12, 1 },
+    { 29553, 9605, 0, 6, 1 },
+    { 11216, 9605, 0, 5, 1 },
+    { 29559, 9605, 0, 7, 1 },
+    { 29566, 9605, 0, 13, 1 },
+    { 29579, 9605, 0, 9, 1 },
+    { 4411, 9605, 2, 3, 0 },
+    { 29588, 9607, 0, 5, 1 },
+    { 29593, 9607, 0, 6, 1 },
+    { 29599, 9607, 0, 7, 1 },
+    { 29606, 9607, 0, 24, 1 },
+    { 15687, 9607, 0, 8, 1 },
+    { 29630, 9607, 0, 10, 1 },
+    { 15716, 9607, 0, 14, 1 },
+    { 5015, 9607, 0, 2, 1 },
+    { 29640, 9607, 2, 11, 0 },
+    { 29651, 9609, 1, 10, 0 },
+    { 29661, 9610, 0, 10, 1 },
+    { 29671, 9610, 0, 13, 1 },
+    { 5213, 9610, 0, 2, 1 },
+    { 29684, 9610, 0, 6, 1 },
+    { 11224, 9610, 0, 6, 1 },
+    { 29690, 9610, 0, 8, 1 },
+    { 29698, 9610, 0, 10, 1 },
+    { 15800, 9610, 0, 8, 1 },
+    { 29708, 9610, 0, 9, 1 },
+    { 15848, 9610, 0, 8, 1 },
+    { 29717, 9610, 0, 14, 1 },
+    { 29731, 9610, 0, 10, 1 },
+    { 29741, 9610, 0, 8, 1 },
+    { 12165, 9610, 0, 7, 1 },
+    { 29749, 9610, 2, 4, 0 },
+    { 29753, 9612, 0, 13, 1 },
+    { 12567, 9612, 0, 8, 1 },
+    { 29766, 9612, 0, 5, 1 },
+    { 29771, 9612, 0, 8, 1 },
+    { 29779, 9612, 1, 9, 0 },
+    { 29788, 9613, 0, 8, 1 },
+    { 29796, 9613, 1, 10, 1 },
+    { 21496, 9614, 0, 2, 1 },
+    { 29806, 9614, 1, 8, 0 },
+    { 12121, 9615, 0, 6, 1 },
+    { 6032, 9615, 0, 2, 1 },
+    { 29814, 9615, 0, 4, 1 },
+    { 29818, 9615, 0, 6, 1 },
+    { 29824, 9615, 1, 8, 1 },
+    { 11230, 9616, 0, 6, 1 },
+    { 29832, 9616, 2, 11, 1 },
+    { 8514, 9618, 0, 2, 1 },
+    { 29843, 9618, 0, 5, 2 },
+    { 29848, 9618, 0, 4, 1 },
+    { 29852, 9618, 0, 7, 1 },
+    { 1308, 9618, 0, 2, 1 },
+    { 29859, 9618, 0, 4, 1 },
+    { 29863, 9618, 0, 10, 1 },
+    { 12505, 9618, 0, 4, 1 },
+    { 1340, 9618, 0, 3, 1 },
+    { 12533, 9618, 0, 4, 1 },
+    { 3029, 9618, 0, 4, 1 },
+    { 4113, 9618, 0, 3, 1 },
+    { 29873, 9618, 0, 5, 1 },
+    { 24236, 9618, 0, 3, 1 },
+    { 11864, 9618, 0, 3, 1 },
+    { 5564, 9618, 0, 5, 1 },
+    { 10855, 9618, 0, 3, 1 },
+    { 29878, 9618, 0, 3, 1 },
+    { 1340, 9618, 1, 3, 1 },
+    { 1880, 9619, 0, 3, 1 },
+    { 12533, 9619, 0, 4, 1 },
+    { 18061, 9619, 0, 3, 1 },
+    { 2599, 9619, 0, 3, 1 },
+    { 11126, 9619, 0, 1, 1 },
+    { 3686, 9619, 0, 3, 1 },
+    { 3903, 9619, 0, 3, 1 },
+    { 3946, 9619, 0, 4, 1 },
+    { 4089, 9619, 0, 4, 1 },
+    { 4113, 9619, 0, 3, 1 },
+    { 4177, 9619, 0, 3, 1 },
+    { 4380, 9619, 0, 3, 1 },
+    { 10011, 9619, 0, 3, 1 },
+    { 50, 9619, 0, 2, 1 },
+    { 712, 9619, 0, 3, 1 },
+    { 1308, 9619, 0, 2, 1 },
+    { 1340, 9619, 0, 3, 1 },
+    { 1880, 9619, 0, 3, 1 },
+    { 10863, 9619, 0, 3, 1 },
+    { 3006, 9619, 0, 2, 1 },
+    { 3029, 9619, 0, 4, 1 },
+    { 3063, 9619, 0, 3, 1 },
+    { 3903, 9619, 0, 3, 1 },
+    { 4113, 9619, 0, 3, 1 },
+    { 10000, 9619, 0, 3, 1 },
+    { 4380, 9619, 0, 3, 1 },
+    { 10855, 9619, 0, 3, 1 },
+    { 11049, 9619, 0, 10, 1 },
+    { 10003, 9619, 0, 8, 1 },
+    { 29881, 9619, 0, 7, 1 },
+    { 1308, 9619, 0, 2, 1 },
+    { 29888, 9619, 0, 5, 1 },
+    { 2599, 9619, 0, 3, 1 },
+    { 29893, 9619, 0, 15, 1 },
+    { 29908, 9619, 0, 6, 1 },
+    { 10988, 9619, 0, 12, 1 },
+    { 11085, 9619, 0, 8, 2 },
+    { 17167, 9619, 0, 13, 1 },
+    { 29914, 9619, 1, 2, 1 },
+    { 29916, 9620, 0, 8, 1 },
+    { 29924, 9620, 0, 6, 1 },
+    { 29930, 9620, 0, 6, 1 },
+    { 29936, 9620, 0, 7, 1 },
+    { 12415, 9620, 1, 2, 1 },
+    { 29943, 9621, 1, 8, 0 },
+    { 29951, 9622, 0, 10, 1 },
+    { 29961, 9622, 0, 8, 1 },
+    { 176, 9622, 0, 2, 1 },
+    { 29969, 9622, 0, 9, 1 },
+    { 29978, 9622, 0, 7, 1 },
+    { 29985, 9622, 0, 6, 1 },
+    { 29991, 9622, 0, 9, 1 },
+    { 30000, 9622, 0, 4, 1 },
+    { 30004, 9622, 0, 6, 1 },
+    { 30010, 9622, 0, 4, 1 },
+    { 30014, 9622, 0, 4, 1 },
+    { 30018, 9622, 0, 9, 1 },
+    { 30027, 9622, 0, 6, 1 },
+    { 30033, 9622, 0, 5, 1 },
+    { 30038, 9622, 0, 6, 1 },
+    { 30044, 9622, 0, 5, 1 },
+    { 30049, 9622, 0, 7, 1 },
+    { 30056, 9622, 0, 7, 1 },
+    { 30063, 9622, 0, 4, 1 },
+    { 30067, 9622, 0, 6, 1 },
+    { 30073, 9622, 0, 5, 1 },
+    { 30078, 9622, 0, 5, 1 },
+    { 30083, 9622, 0, 5, 1 },
+    { 30088, 9622, 0, 7, 1 },
+    { 30095, 9622, 0, 6, 1 },
+    { 30101, 9622, 0, 5, 1 },
+    { 30106, 9622, 0, 9, 1 },
+    { 30115, 9622, 0, 5, 1 },
+    { 30120, 9622, 0, 4, 1 },
+    { 30124, 9622, 0, 7, 1 },
+    { 30131, 9622, 0, 14, 1 },
+    { 30145, 9622, 0, 15, 1 },
+    { 30160, 9622, 0, 9, 1 },
+    { 30169, 9622, 0, 9, 1 },
+    { 30178, 9622, 0, 6, 1 },
+    { 30184, 9622, 0, 7, 1 },
+    { 30191, 9622, 0, 8, 1 },
+    { 30199, 9622, 0, 11, 1 },
+    { 30210, 9622, 0, 12, 1 },
+    { 30222, 9622, 0, 6, 1 },
+    { 30228, 9622, 0, 7, 1 },
+    { 30235, 9622, 0, 5, 1 },
+    { 30240, 9622, 0, 10, 1 },
+    { 30250, 9622, 0, 9, 1 },
+    { 30259, 9622, 0, 9, 1 },
+    { 30268, 9622, 0, 6, 1 },
+    { 30274, 9622, 0, 5, 1 },
+    { 30279, 9622, 0, 5, 1 },
+    { 30284, 9622, 0, 9, 1 },
+    { 30293, 9622, 0, 11, 1 },
+    { 30304, 9622, 0, 12, 1 },
+    { 30316, 9622, 0, 6, 1 },
+    { 30322, 9622, 0, 6, 1 },
+    { 30328, 9622, 0, 4, 1 },
+    { 30332, 9622, 0, 6, 1 },
+    { 30338, 9622, 0, 8, 1 },
+    { 30346, 9622, 0, 9, 1 },
+    { 30355, 9622, 0, 6, 1 },
+    { 30361, 9622, 0, 7, 1 },
+    { 30368, 9622, 0, 6, 1 },
+    { 30374, 9622, 0, 8, 1 },
+    { 30382, 9622, 0, 7, 1 },
+    { 30389, 9622, 0, 8, 1 },
+    { 30397, 9622, 0, 9, 1 },
+    { 30406, 9622, 0, 5, 1 },
+    { 10003, 9622, 0, 8, 1 },
+    { 30411, 9622, 0, 4, 1 },
+    { 30415, 9622, 0, 5, 1 },
+    { 30420, 9622, 0, 4, 1 },
+    { 30424, 9622, 0, 5, 1 },
+    { 30429, 9622, 0, 9, 1 },
+    { 30438, 9622, 0, 7, 1 },
+    { 30445, 9622, 0, 11, 1 },
+    { 30456, 9622, 0, 10, 1 },
+    { 30466, 9622, 0, 5, 1 },
+    { 30471, 9622, 0, 9, 1 },
+    { 30480, 9622, 0, 13, 1 },
+    { 30493, 9622, 1, 2, 1 },
+    { 30495, 9623, 0, 7, 1 },
+    { 30502, 9623, 1, 8, 0 },
+    { 30510, 9624, 0, 7, 1 },
+    { 30517, 9624, 0, 5, 1 },
+    { 30522, 9624, 0, 12, 1 },
+    { 30534, 9624, 0, 13, 1 },
+    { 30547, 9624, 0, 8, 1 },
+    { 30555, 9624, 0, 8, 1 },
+    { 30563, 9624, 0, 7, 1 },
+    { 30570, 9624, 0, 11, 1 },
+    { 30581, 9624, 0, 10, 1 },
+    { 30591, 9624, 0, 6, 1 },
+    { 30597, 9624, 0, 6, 1 },
+    { 30603, 9624, 0, 10, 1 },
+    { 1308, 9624, 0, 2, 1 },
+    { 30613, 9624, 0, 11, 1 },
+    { 30624, 9624, 0, 12, 1 },
+    { 30636, 9624, 0, 10, 1 },
+    { 30646, 9624, 0, 6, 1 },
+    { 30652, 9624, 0, 3, 1 },
+    { 30655, 9624, 0, 13, 1 },
+    { 30668, 9624, 0, 12, 1 },
+    { 30680, 9624, 0, 13, 1 },
+    { 30693, 9624, 0, 5, 1 },
+    { 30698, 9624, 0, 5, 1 },
+    { 30703, 9624, 0, 7, 1 },
+    { 30710, 9624, 0, 9, 1 },
+    { 30719, 9624, 0, 6, 1 },
+    { 30725, 9624, 0, 7, 1 },
+    { 30732, 9624, 0, 5, 1 },
+    { 30737, 9624, 0, 6, 1 },
+    { 30743, 9624, 0, 6, 1 },
+    { 30749, 9624, 0, 8, 1 },
+    { 30757, 9624, 0, 3, 1 },
+    { 30760, 9624, 0, 8, 1 },
+    { 30768, 9624, 0, 8, 1 },
+    { 30776, 9624, 0, 7, 1 },
+    { 30783, 9624, 0, 8, 1 },
+    { 30791, 9624, 0, 9, 1 },
+    { 30800, 9624, 0, 7, 1 },
+    { 30807, 9624, 0, 7, 1 },
+    { 30814, 9624, 0, 8, 1 },
+    { 30822, 9624, 0, 4, 1 },
+    { 30826, 9624, 0, 7, 1 },
+    { 30833, 9624, 0, 8, 1 },
+    { 30841, 9624, 0, 6, 1 },
+    { 30847, 9624, 0, 11, 1 },
+    { 30858, 9624, 0, 15, 1 },
+    { 30873, 9624, 0, 7, 1 },
+    { 30880, 9624, 0, 6, 1 },
+    { 30886, 9624, 0, 5, 1 },
+    { 30891, 9624, 0, 3, 1 },
+    { 30894, 9624, 0, 7, 1 },
+    { 30901, 9624, 0, 3, 1 },
+    { 30904, 9624, 0, 6, 1 },
+    { 30910, 9624, 0, 7, 1 },
+    { 30917, 9624, 0, 6, 1 },
+    { 30923, 9624, 0, 6, 1 },
+    { 30929, 9624, 0, 5, 1 },
+    { 30934, 9624, 0, 3, 1 },
+    { 30937, 9624, 0, 8, 1 },
+    { 30945, 9624, 0, 9, 1 },
+    { 30954, 9624, 0, 11, 1 },
+    { 30965, 9624, 0, 8, 1 },
+    { 30973, 9624, 0, 5, 1 },
+    { 30978, 9624, 0, 5, 1 },
+    { 30983, 9624, 0, 6, 1 },
+    { 30989, 9624, 0, 4, 1 },
+    { 2258, 9624, 1, 2, 1 },
+    { 30993, 9625, 0, 9, 1 },
+    { 31002, 9625, 0, 7, 1 },
+    { 31009, 9625, 0, 5, 1 },
+    { 31014, 9625, 0, 7, 1 },
+    { 31021, 9625, 0, 6, 1 },
+    { 31027, 9625, 0, 5, 1 },
+    { 31032, 9625, 0, 11, 1 },
+    { 31043, 9625, 0, 4, 1 },
+    { 31047, 9625, 0, 5, 1 },
+    { 31052, 9625, 0, 7, 1 },
+    { 31059, 9625, 0, 6, 1 },
+    { 31065, 9625, 0, 5, 1 },
+    { 31070, 9625, 0, 6, 1 },
+    { 31076, 9625, 0, 6, 1 },
+    { 31082, 9625, 0, 7, 1 },
+    { 31089, 9625, 0, 7, 1 },
+    { 31096, 9625, 0, 4, 1 },
+    { 31100, 9625, 0, 10, 1 },
+    { 31110, 9625, 0, 8, 1 },
+    { 31118, 9625, 0, 6, 1 },
+    { 31124, 9625, 0, 9, 1 },
+    { 31133, 9625, 0, 5, 1 },
+    { 31138, 9625, 0, 6, 1 },
+    { 31144, 9625, 0, 10, 1 },
+    { 31154, 9625, 0, 6, 1 },
+    { 31160, 9625, 0, 7, 1 },
+    { 31167, 9625, 0, 13, 1 },
+    { 31180, 9625, 0, 9, 1 },
+    { 31189, 9625, 0, 10, 1 },
+    { 31199, 9625, 0, 5, 1 },
+    { 31204, 9625, 0, 7, 1 },
+    { 31211, 9625, 0, 8, 1 },
+    { 31219, 9625, 0, 8, 1 },
+    { 31227, 9625, 0, 7, 1 },
+    { 31234, 9625, 0, 6, 1 },
+    { 31240, 9625, 0, 7, 1 },
+    { 31247, 9625, 0, 7, 1 },
+    { 31254, 9625, 0, 3, 1 },
+    { 31257, 9625, 0, 4, 1 },
+    { 31261, 9625, 0, 5, 1 },
+    { 31266, 9625, 0, 7, 1 },
+    { 31273, 9625, 0, 9, 1 },
+    { 31282, 9625, 0, 8, 1 },
+    { 31290, 9625, 0, 5, 1 },
+    { 31295, 9625, 0, 4, 1 },
+    { 31299, 9625, 0, 5, 1 },
+    { 31304, 9625, 0, 13, 1 },
+    { 31317, 9625, 0, 10, 1 },
+    { 31327, 9625, 0, 7, 1 },
+    { 31334, 9625, 0, 12, 1 },
+    { 12433, 9625, 0, 2, 1 },
+    { 31346, 9625, 0, 6, 1 },
+    { 31352, 9625, 0, 6, 1 },
+    { 31358, 9625, 0, 10, 1 },
+    { 31368, 9625, 0, 6, 1 },
+    { 31374, 9625, 0, 5, 1 },
+    { 31379, 9625, 0, 5, 1 },
+    { 31384, 9625, 0, 7, 1 },
+    { 31391, 9625, 0, 12, 1 },
+    { 31403, 9625, 0, 10, 1 },
+    { 31413, 9625, 0, 6, 1 },
+    { 31419, 9625, 0, 5, 1 },
+    { 31424, 9625, 0, 6, 1 },
+    { 31430, 9625, 0, 7, 1 },
+    { 31437, 9625, 0, 6, 1 },
+    { 31443, 9625, 0, 12, 1 },
+    { 31455, 9625, 0, 9, 1 },
+    { 31464, 9625, 4, 7, 0 },
+    { 31471, 9629, 0, 5, 1 },
+    { 31476, 9629, 0, 6, 1 },
+    { 31482, 9629, 0, 8, 1 },
+    { 31490, 9629, 0, 5, 1 },
+    { 31495, 9629, 0, 5, 1 },
+    { 31500, 9629, 0, 8, 1 },
+    { 31508, 9629, 0, 10, 1 },
+    { 12441, 9629, 1, 2, 1 },
+    { 2804, 9630, 1, 2, 1 },
+    { 31518, 9631, 0, 5, 1 },
+    { 31523, 9631, 0, 6, 1 },
+    { 31529, 9631, 0, 3, 1 },
+    { 31532, 9631, 0, 8, 1 },
+    { 31540, 9631, 0, 3, 1 },
+    { 31543, 9631, 0, 4, 1 },
+    { 31547, 9631, 0, 11, 1 },
+    { 31558, 9631, 0, 8, 1 },
+    { 31566, 9631, 0, 9, 1 },
+    { 31575, 9631, 0, 8, 1 },
+    { 31583, 9631, 1, 9, 0 },
+    { 31592, 9632, 0, 9, 1 },
+    { 31601, 9632, 0, 6, 1 },
+    { 31607, 9632, 0, 8, 1 },
+    { 31615, 9632, 0, 9, 1 },
+    { 31624, 9632, 0, 6, 1 },
+    { 31630, 9632, 0, 5, 1 },
+    { 31635, 9632, 0, 6, 1 },
+    { 31641, 9632, 0, 9, 1 },
+    { 31650, 9632, 0, 7, 1 },
+    { 31657, 9632, 0, 14, 1 },
+    { 31671, 9632, 0, 7, 1 },
+    { 31678, 9632, 0, 3, 1 },
+    { 31681, 9632, 0, 11, 1 },
+    { 31692, 9632, 0, 9, 1 },
+    { 31701, 9632, 0, 9, 1 },
+    { 31710, 9632, 0, 10, 1 },
+    { 31720, 9632, 0, 7, 1 },
+    { 31727, 9632, 0, 6, 1 },
+    { 31733, 9632, 0, 7, 1 },
+    { 31740, 9632, 0, 8, 1 },
+    { 31748, 9632, 0, 7, 1 },
+    { 31755, 9632, 0, 4, 1 },
+    { 31759, 9632, 1, 9, 1 },
+    { 31768, 9633, 0, 8, 1 },
+    { 31776, 9633, 0, 8, 1 },
+    { 31784, 9633, 0, 7, 1 },
+    { 31791, 9633, 0, 6, 1 },
+    { 31797, 9633, 0, 9, 1 },
+    { 31806, 9633, 0, 8, 1 },
+    { 31814, 9633, 0, 10, 1 },
+    { 31824, 9633, 0, 7, 1 },
+    { 31831, 9633, 0, 10, 1 },
+    { 31841, 9633, 0, 8, 1 },
+    { 31849, 9633, 0, 7, 1 },
+    { 31856, 9633, 0, 6, 1 },
+    { 31862, 9633, 0, 7, 1 },
+    { 31869, 9633, 0, 10, 1 },
+    { 31879, 9633, 0, 8, 1 },
+    { 31887, 9633, 0, 5, 1 },
+    { 31892, 9633, 0, 5, 1 },
+    { 31897, 9633, 0, 6, 1 },
+    { 31903, 9633, 0, 7, 1 },
+    { 31910, 9633, 0, 9, 1 },
+    { 31919, 9633, 0, 11, 1 },
+    { 31930, 9633, 0, 8, 1 },
+    { 31938, 9633, 0, 9, 1 },
+    { 31947, 9633, 0, 7, 1 },
+    { 31954, 9633, 0, 8, 1 },
+    { 31962, 9633, 0, 12, 1 },
+    { 31974, 9633, 0, 12, 1 },
+    { 31986, 9633, 0, 10, 1 },
+    { 31996, 9633, 0, 12, 1 },
+    { 32008, 9633, 0, 10, 1 },
+    { 32018, 9633, 0, 11, 1 },
+    { 32029, 9633, 0, 8, 1 },
+    { 32037, 9633, 0, 8, 1 },
+    { 32045, 9633, 0, 4, 1 },
+    { 32049, 9633, 0, 9, 1 },
+    { 32058, 9633, 0, 9, 1 },
+    { 32067, 9633, 0, 10, 1 },
+    { 32077, 9633, 0, 9, 1 },
+    { 32086, 9633, 0, 7, 1 },
+    { 32093, 9633, 0, 8, 1 },
+    { 32101, 9633, 0, 9, 1 },
+    { 32110, 9633, 0, 10, 1 },
+    { 32120, 9633, 0, 13, 1 },
+    { 32133, 9633, 0, 8, 1 },
+    { 32141, 9633, 0, 12, 1 },
+    { 32153, 9633, 0, 6, 1 },
+    { 32159, 9633, 0, 8, 1 },
+    { 32167, 9633, 0, 9, 1 },
+    { 32176, 9633, 0, 6, 1 },
+    { 32182, 9633, 0, 6, 1 },
+    { 32188, 9633, 0, 7, 1 },
+    { 32195, 9633, 0, 8, 1 },
+    { 32203, 9633, 0, 11, 1 },
+    { 32214, 9633, 0, 12, 1 },
+    { 32226, 9633, 0, 7, 1 },
+    { 32233, 9633, 0, 9, 1 },
+    { 32242, 9633, 0, 9, 1 },
+    { 32251, 9633, 0, 7, 1 },
+    { 32258, 9633, 0, 4, 1 },
+    { 32262, 9633, 0, 7, 1 },
+    { 32269, 9633, 0, 6, 1 },
+    { 32275, 9633, 0, 6, 1 },
+    { 32281, 9633, 0, 5, 1 },
+    { 32286, 9633, 0, 8, 1 },
+    { 32294, 9633, 0, 4, 1 },
+    { 32298, 9633, 0, 6, 1 },
+    { 32304, 9633, 0, 11, 1 },
+    { 32315, 9633, 0, 9, 1 },
+    { 32324, 9633, 0, 6, 1 },
+    { 32330, 9633, 0, 9, 1 },
+    { 32339, 9633, 0, 7, 1 },
+    { 32346, 9633, 0, 6, 1 },
+    { 32352, 9633, 0, 7, 1 },
+    { 32359, 9633, 0, 8, 1 },
+    { 20050, 9633, 0, 3, 1 },
+    { 32367, 9633, 0, 5, 1 },
+    { 32372, 9633, 0, 9, 1 },
+    { 32381, 9633, 0, 5, 1 },
+    { 32386, 9633, 0, 4, 1 },
+    { 32390, 9633, 0, 6, 1 },
+    { 32396, 9633, 0, 5, 1 },
+    { 32401, 9633, 0, 6, 1 },
+    { 32407, 9633, 0, 6, 1 },
+    { 32413, 9633, 0, 7, 1 },
+    { 32420, 9633, 0, 6, 1 },
+    { 32426, 9633, 0, 7, 1 },
+    { 32433, 9633, 0, 7, 1 },
+    { 32440, 9633, 0, 9, 1 },
+    { 32449, 9633, 0, 10, 1 },
+    { 32459, 9633, 0, 6, 1 },
+    { 32465, 9633, 0, 11, 1 },
+    { 32476, 9633, 0, 7, 1 },
+    { 32483, 9633, 0, 6, 1 },
+    { 32489, 9633, 0, 6, 1 },
+    { 32495, 9633, 0, 6, 1 },
+    { 32501, 9633, 0, 9, 1 },
+    { 32510, 9633, 0, 10, 1 },
+    { 32520, 9633, 0, 5, 1 },
+    { 32525, 9633, 0, 13, 1 },
+    { 32538, 9633, 0, 6, 1 },
+    { 32544, 9633, 0, 6, 1 },
+    { 32550, 9633, 0, 6, 1 },
+    { 32556, 9633, 0, 5, 1 },
+    { 32561, 9633, 0, 6, 1 },
+    { 32567, 9633, 0, 7, 1 },
+    { 32574, 9633, 0, 8, 1 },
+    { 32582, 9633, 0, 7, 1 },
+    { 32589, 9633, 0, 14, 1 },
+    { 3903, 9633, 0, 3, 1 },
+    { 32603, 9633, 0, 9, 1 },
+    { 32612, 9633, 0, 10, 1 },
+    { 32622, 9633, 0, 9, 1 },
+    { 32631, 9633, 0, 7, 1 },
+    { 32638, 9633, 0, 7, 1 },
+    { 32645, 9633, 0, 5, 1 },
+    { 32650, 9633, 0, 5, 1 },
+    { 32655, 9633, 2, 15, 0 },
+    { 32670, 9635, 0, 7, 1 },
+    { 32677, 9635, 0, 8, 1 },
+    { 32685, 9635, 0, 8, 1 },
+    { 32693, 9635, 0, 4, 1 },
+    { 32697, 9635, 0, 6, 1 },
+    { 32703, 9635, 0, 8, 1 },
+    { 4034, 9635, 1, 2, 1 },
+    { 32711, 9636, 0, 6, 1 },
+    { 32717, 9636, 0, 7, 1 },
+    { 4051, 9636, 0, 6, 1 },
+    { 10988, 9636, 0, 12, 1 },
+    { 32724, 9636, 0, 12, 1 },
+    { 32736, 9636, 0, 15, 1 },
+    { 32751, 9636, 0, 8, 1 },
+    { 32759, 9636, 0, 7, 1 },
+    { 32766, 9636, 2, 16, 0 },
+    { 32782, 9638, 0, 14, 1 },
+    { 32796, 9638, 0, 10, 1 },
+    { 32806, 9638, 0, 6, 1 },
+    { 32812, 9638, 0, 10, 1 },
+    { 32822, 9638, 0, 9, 1 },
+    { 32831, 9638, 0, 5, 1 },
+    { 32836, 9638, 0, 8, 1 },
+    { 32844, 9638, 0, 6, 1 },
+    { 32850, 9638, 0, 8, 1 },
+    { 32858, 9638, 0, 8, 1 },
+    { 32866, 9638, 0, 11, 1 },
+    { 32877, 9638, 0, 5, 1 },
+    { 32882, 9638, 0, 8, 1 },
+    { 32890, 9638, 0, 12, 1 },
+    { 32902, 9638, 0, 7, 1 },
+    { 32909, 9638, 0, 6, 1 },
+    { 32915, 9638, 0, 8, 1 },
+    { 32923, 9638, 0, 8, 1 },
+    { 4215, 9638, 1, 2, 1 },
+    { 32931, 9639, 0, 11, 1 },
+    { 32942, 9639, 0, 9, 1 },
+    { 32951, 9639, 0, 9, 1 },
+    { 32960, 9639, 0, 7, 1 },
+    { 32967, 9639, 0, 8, 1 },
+    { 32975, 9639, 6, 8, 0 },
+    { 32983, 9645, 0, 11, 1 },
+    { 32994, 9645, 0, 9, 1 },
+    { 33003, 9645, 0, 13, 1 },
+    { 33016, 9645, 0, 8, 1 },
+    { 33024, 9645, 0, 8, 1 },
+    { 11027, 9645, 1, 2, 1 },
+    { 33032, 9646, 0, 9, 1 },
+    { 33041, 9646, 0, 16, 1 },
+    { 33057, 9646, 0, 7, 1 },
+    { 33064, 9646, 0, 10, 1 },
+    { 33074, 9646, 0, 4, 1 },
+    { 12031, 9646, 1, 2, 1 },
+    { 33078, 9647, 0, 6, 1 },
+    { 33084, 9647, 1, 2, 1 },
+    { 33086, 9648, 0, 10, 1 },
+    { 33096, 9648, 0, 6, 1 },
+    { 33102, 9648, 0, 8, 1 },
+    { 33110, 9648, 0, 9, 1 },
+    { 33119, 9648, 0, 8, 1 },
+    { 33127, 9648, 0, 6, 1 },
+    { 33133, 9648, 0, 6, 1 },
+    { 33139, 9648, 0, 6, 1 },
+    { 33145, 9648, 0, 5, 1 },
+    { 33150, 9648, 0, 4, 1 },
+    { 33154, 9648, 1, 4, 1 },
+    { 33158, 9649, 0, 6, 1 },
+    { 33164, 9649, 0, 7, 1 },
+    { 33171, 9649, 0, 8, 1 },
+    { 33179, 9649, 1, 7, 0 },
+    { 33186, 9650, 0, 11, 1 },
+    { 33197, 9650, 0, 7, 1 },
+    { 33204, 9650, 0, 9, 1 },
+    { 33213, 9650, 0, 10, 1 },
+    { 33223, 9650, 0, 4, 1 },
+    { 33227, 9650, 0, 8, 1 },
+    { 33235, 9650, 0, 13, 1 },
+    { 33248, 9650, 0, 9, 1 },
+    { 33257, 9650, 0, 8, 1 },
+    { 33265, 9650, 0, 9, 1 },
+    { 33274, 9650, 0, 10, 1 },
+    { 11010, 9650, 0, 4, 1 },
+    { 33284, 9650, 0, 4, 1 },
+    { 33288, 9650, 0, 5, 1 },
+    { 33293, 9650, 0, 6, 1 },
+    { 33299, 9650, 0, 11, 1 },
+    { 33310, 9650, 0, 6, 1 },
+    { 33316, 9650, 0, 5, 1 },
+    { 33321, 9650, 0, 9, 1 },
+    { 33330, 9650, 0, 8, 1 },
+    { 33338, 9650, 0, 4, 1 },
+    { 33342, 9650, 0, 9, 1 },
+    { 33351, 9650, 0, 5, 1 },
+    { 33356, 9650, 0, 8, 1 },
+    { 33364, 9650, 0, 7, 1 },
+    { 33371, 9650, 0, 8, 1 },
+    { 33379, 9650, 0, 9, 1 },
+    { 33388, 9650, 0, 6, 1 },
+    { 33394, 9650, 0, 7, 1 },
+    { 33401, 9650, 0, 9, 1 },
+    { 33410, 9650, 0, 9, 1 },
+    { 33419, 9650, 0, 5, 1 },
+    { 33424, 9650, 0, 5, 1 },
+    { 33429, 9650, 0, 6, 1 },
+    { 33435, 9650, 1, 2, 1 },
+    { 33437, 9651, 0, 4, 1 },
+    { 33441, 9651, 0, 5, 1 },
+    { 33446, 9651, 0, 6, 1 },
+    { 33452, 9651, 0, 5, 1 },
+    { 33457, 9651, 0, 7, 1 },
+    { 33464, 9651, 0, 5, 1 },
+    { 33469, 9651, 0, 4, 1 },
+    { 33473, 9651, 0, 6, 1 },
+    { 33479, 9651, 0, 7, 1 },
+    { 33486, 9651, 0, 6, 1 },
+    { 33492, 9651, 0, 5, 1 },
+    { 33497, 9651, 0, 13, 1 },
+    { 33510, 9651, 0, 6, 1 },
+    { 33516, 9651, 0, 5, 1 },
+    { 33521, 9651, 0, 7, 1 },
+    { 33528, 9651, 0, 9, 1 },
+    { 33537, 9651, 0, 7, 1 },
+    { 33544, 9651, 0, 8, 1 },
+    { 33552, 9651, 0, 6, 1 },
+    { 33558, 9651, 0, 5, 1 },
+    { 33563, 9651, 0, 7, 1 },
+    { 33570, 9651, 0, 8, 1 },
+    { 33578, 9651, 0, 8, 1 },
+    { 33586, 9651, 0, 5, 1 },
+    { 33591, 9651, 0, 7, 1 },
+    { 33598, 9651, 0, 9, 1 },
+    { 33607, 9651, 0, 10, 1 },
+    { 33617, 9651, 0, 7, 1 },
+    { 33624, 9651, 0, 12, 1 },
+    { 33636, 9651, 0, 13, 1 },
+    { 33649, 9651, 0, 6, 1 },
+    { 33655, 9651, 0, 7, 1 },
+    { 33662, 9651, 0, 9, 1 },
+    { 33671, 9651, 0, 5, 1 },
+    { 33676, 9651, 0, 8, 1 },
+    { 33684, 9651, 0, 3, 1 },
+    { 33687, 9651, 0, 5, 1 },
+    { 33692, 9651, 0, 5, 1 },
+    { 33697, 9651, 0, 7, 1 },
+    { 33704, 9651, 1, 2, 1 },
+    { 33706, 9652, 0, 7, 1 },
+    { 33713, 9652, 0, 6, 1 },
+    { 33719, 9652, 0, 6, 1 },
+    { 33725, 9652, 0, 6, 1 },
+    { 33731, 9652, 0, 6, 1 },
+    { 33737, 9652, 0, 8, 1 },
+    { 33745, 9652, 0, 5, 1 },
+    { 33750, 9652, 0, 7, 1 },
+    { 33757, 9652, 0, 13, 1 },
+    { 5378, 9652, 0, 3, 1 },
+    { 33770, 9652, 0, 5, 1 },
+    { 33775, 9652, 0, 7, 1 },
+    { 33782, 9652, 0, 8, 1 },
+    { 33790, 9652, 0, 8, 1 },
+    { 33798, 9652, 0, 5, 1 },
+    { 33803, 9652, 0, 8, 1 },
+    { 33811, 9652, 0, 9, 1 },
+    { 33820, 9652, 0, 6, 1 },
+    { 33826, 9652, 0, 6, 1 },
+    { 33832, 9652, 0, 7, 1 },
+    { 33839, 9652, 0, 9, 1 },
+    { 33848, 9652, 0, 7, 1 },
+    { 33855, 9652, 0, 5, 1 },
+    { 33860, 9652, 0, 6, 1 },
+    { 33866, 9652, 0, 6, 1 },
+    { 33872, 9652, 0, 5, 1 },
+    { 33877, 9652, 0, 10, 1 },
+    { 33887, 9652, 0, 6, 1 },
+    { 33893, 9652, 0, 7, 1 },
+    { 33900, 9652, 0, 6, 1 },
+    { 33906, 9652, 0, 7, 1 },
+    { 33913, 9652, 0, 5, 1 },
+    { 33918, 9652, 0, 7, 1 },
+    { 33925, 9652, 0, 4, 1 },
+    { 33929, 9652, 0, 6, 1 },
+    { 33935, 9652, 0, 5, 1 },
+    { 33940, 9652, 0, 11, 1 },
+    { 33951, 9652, 0, 9, 1 },
+    { 33960, 9652, 0, 10, 1 },
+    { 33970, 9652, 0, 8, 1 },
+    { 33978, 9652, 0, 8, 1 },
+    { 33986, 9652, 0, 12, 1 },
+    { 33998, 9652, 0, 7, 1 },
+    { 34005, 9652, 0, 8, 1 },
+    { 34013, 9652, 0, 8, 1 },
+    { 34021, 9652, 0, 5, 1 },
+    { 34026, 9652, 0, 10, 1 },
+    { 34036, 9652, 0, 9, 1 },
+    { 5501, 9652, 1, 2, 1 },
+    { 34045, 9653, 0, 6, 1 },
+    { 34051, 9653, 0, 4, 1 },
+    { 34055, 9653, 0, 9, 1 },
+    { 34064, 9653, 0, 9, 1 },
+    { 34073, 9653, 0, 7, 1 },
+    { 34080, 9653, 0, 7, 1 },
+    { 34087, 9653, 0, 9, 1 },
+    { 34096, 9653, 0, 8, 1 },
+    { 34104, 9653, 0, 15, 1 },
+    { 34119, 9653, 0, 9, 1 },
+    { 34128, 9653, 0, 16, 1 },
+    { 34144, 9653, 0, 6, 1 },
+    { 34150, 9653, 0, 11, 1 },
+    { 34161, 9653, 0, 5, 1 },
+    { 34166, 9653, 0, 7, 1 },
+    { 34173, 9653, 0, 9, 1 },
+    { 34182, 9653, 0, 6, 1 },
+    { 34188, 9653, 0, 7, 1 },
+    { 34195, 9653, 0, 5, 1 },
+    { 34200, 9653, 0, 4, 1 },
+    { 34204, 9653, 0, 6, 1 },
+    { 34210, 9653, 0, 4, 1 },
+    { 34214, 9653, 0, 7, 1 },
+    { 34221, 9653, 0, 8, 1 },
+    { 34229, 9653, 1, 8, 1 },
+    { 34237, 9654, 0, 5, 1 },
+    { 34242, 9654, 0, 7, 1 },
+    { 34249, 9654, 0, 9, 1 },
+    { 34258, 9654, 0, 6, 1 },
+    { 34264, 9654, 0, 7, 1 },
+    { 34271, 9654, 0, 6, 1 },
+    { 34277, 9654, 0, 6, 1 },
+    { 34283, 9654, 0, 12, 1 },
+    { 34295, 9654, 0, 11, 1 },
+    { 34306, 9654, 0, 9, 1 },
+    { 34315, 9654, 0, 9, 1 },
+    { 34324, 9654, 0, 13, 1 },
+    { 34337, 9654, 0, 8, 1 },
+    { 34345, 9654, 0, 9, 1 },
+    { 34354, 9654, 0, 6, 1 },
+    { 34360, 9654, 0, 4, 1 },
+    { 34364, 9654, 0, 8, 1 },
+    { 34372, 9654, 3, 8, 0 },
+    { 28261, 9657, 0, 4, 1 },
+    { 34380, 9657, 0, 8, 1 },
+    { 34388, 9657, 0, 4, 1 },
+    { 34392, 9657, 0, 9, 1 },
+    { 34401, 9657, 0, 5, 1 },
+    { 34406, 9657, 0, 6, 1 },
+    { 5851, 9657, 1, 2, 1 },
+    { 34412, 9658, 0, 5, 1 },
+    { 34417, 9658, 0, 5, 1 },
+    { 34422, 9658, 0, 8, 1 },
+    { 34430, 9658, 0, 7, 1 },
+    { 5916, 9658, 1, 2, 1 },
+    { 34437, 9659, 0, 5, 1 },
+    { 34442, 9659, 0, 6, 1 },
+    { 34448, 9659, 0, 6, 1 },
+    { 34454, 9659, 0, 7, 1 },
+    { 34461, 9659, 0, 8, 1 },
+    { 34469, 9659, 0, 8, 1 },
+    { 34477, 9659, 0, 6, 1 },
+    { 34483, 9659, 0, 6, 1 },
+    { 34489, 9659, 0, 7, 1 },
+    { 34496, 9659, 0, 9, 1 },
+    { 34505, 9659, 0, 6, 1 },
+    { 34511, 9659, 0, 6, 1 },
+    { 34517, 9659, 0, 9, 1 },
+    { 34526, 9659, 0, 11, 1 },
+    { 34537, 9659, 0, 5, 1 },
+    { 34542, 9659, 0, 6, 1 },
+    { 34548, 9659, 0, 8, 1 },
+    { 34556, 9659, 0, 6, 1 },
+    { 34562, 9659, 0, 6, 1 },
+    { 34568, 9659, 0, 7, 1 },
+    { 34575, 9659, 0, 9, 1 },
+    { 34584, 9659, 0, 10, 1 },
+    { 34594, 9659, 0, 10, 1 },
+    { 34604, 9659, 0, 5, 1 },
+    { 34609, 9659, 0, 7, 1 },
+    { 34616, 9659, 0, 8, 1 },
+    { 34624, 9659, 0, 6, 1 },
+    { 6065, 9659, 1, 2, 1 },
+    { 34630, 9660, 0, 7, 1 },
+    { 34637, 9660, 0, 5, 1 },
+    { 34642, 9660, 0, 6, 1 },
+    { 34648, 9660, 0, 4, 1 },
+    { 34652, 9660, 0, 5, 1 },
+    { 34657, 9660, 0, 6, 1 },
+    { 34663, 9660, 0, 7, 1 },
+    { 34670, 9660, 0, 5, 1 },
+    { 34675, 9660, 0, 4, 1 },
+    { 34679, 9660, 0, 8, 1 },
+    { 34687, 9660, 0, 5, 1 },
+    { 34692, 9660, 0, 6, 1 },
+    { 34698, 9660, 0, 7, 1 },
+    { 34705, 9660, 0, 5, 1 },
+    { 34710, 9660, 0, 5, 1 },
+    { 34715, 9660, 0, 4, 1 },
+    { 34719, 9660, 0, 9, 1 },
+    { 34728, 9660, 0, 10, 1 },
+    { 34738, 9660, 0, 8, 1 },
+    { 34746, 9660, 0, 6, 1 },
+    { 34752, 9660, 0, 6, 1 },
+    { 34758, 9660, 0, 6, 1 },
+    { 34764, 9660, 1, 8, 0 },
+    { 34772, 9661, 0, 7, 1 },
+    { 34779, 9661, 0, 13, 1 },
+    { 34792, 9661, 0, 12, 1 },
+    { 34804, 9661, 0, 9, 1 },
+    { 34813, 9661, 0, 11, 1 },
+    { 34824, 9661, 0, 9, 1 },
+    { 34833, 9661, 1, 2, 1 },
+    { 34835, 9662, 0, 3, 1 },
+    { 34838, 9662, 0, 3, 1 },
+    { 34841, 9662, 0, 5, 1 },
+    { 34846, 9662, 0, 10, 1 },
+    { 34856, 9662, 0, 6, 1 },
+    { 34862, 9662, 0, 5, 1 },
+    { 34867, 9662, 0, 4, 1 },
+    { 34871, 9662, 0, 11, 1 },
+    { 34882, 9662, 0, 9, 1 },
+    { 34891, 9662, 0, 6, 1 },
+    { 34897, 9662, 0, 8, 1 },
+    { 34905, 9662, 0, 6, 1 },
+    { 34911, 9662, 0, 7, 1 },
+    { 34918, 9662, 0, 12, 1 },
+    { 34930, 9662, 0, 12, 1 },
+    { 34942, 9662, 0, 21, 1 },
+    { 34963, 9662, 0, 13, 1 },
+    { 34976, 9662, 0, 15, 1 },
+    { 34991, 9662, 0, 18, 1 },
+    { 35009, 9662, 0, 15, 1 },
+    { 35024, 9662, 0, 18, 1 },
+    { 35042, 9662, 0, 19, 1 },
+    { 35061, 9662, 0, 13, 1 },
+    { 35074, 9662, 0, 13, 1 },
+    { 35087, 9662, 0, 14, 1 },
+    { 35101, 9662, 0, 14, 1 },
+    { 35115, 9662, 0, 12, 1 },
+    { 35127, 9662, 0, 12, 1 },
+    { 35139, 9662, 0, 11, 1 },
+    { 35150, 9662, 0, 14, 1 },
+    { 35164, 9662, 0, 18, 1 },
+    { 35182, 9662, 0, 12, 1 },
+    { 35194, 9662, 0, 16, 1 },
+    { 35210, 9662, 0, 18, 1 },
+    { 35228, 9662, 0, 12, 1 },
+    { 35240, 9662, 0, 13, 1 },
+    { 35253, 9662, 0, 12, 1 },
+    { 35265, 9662, 0, 17, 1 },
+    { 35282, 9662, 0, 13, 1 },
+    { 35295, 9662, 0, 13, 1 },
+    { 35308, 9662, 0, 10, 1 },
+    { 35318, 9662, 0, 12, 1 },
+    { 35330, 9662, 0, 12, 1 },
+    { 35342, 9662, 0, 12, 1 },
+    { 35354, 9662, 0, 12, 1 },
+    { 35366, 9662, 0, 19, 1 },
+    { 35385, 9662, 0, 16, 1 },
+    { 35401, 9662, 0, 16, 1 },
+    { 35417, 9662, 0, 13, 1 },
+    { 35430, 9662, 0, 12, 1 },
+    { 35442, 9662, 0, 9, 1 },
+    { 35451, 9662, 0, 13, 1 },
+    { 35464, 9662, 0, 19, 1 },
+    { 35483, 9662, 0, 17, 1 },
+    { 35500, 9662, 0, 19, 1 },
+    { 35519, 9662, 0, 15, 1 },
+    { 35534, 9662, 0, 12, 1 },
+    { 35546, 9662, 0, 15, 1 },
+    { 35561, 9662, 0, 13, 1 },
+    { 35574, 9662, 0, 15, 1 },
+    { 35589, 9662, 0, 16, 1 },
+    { 35605, 9662, 0, 14, 1 },
+    { 35619, 9662, 0, 14, 1 },
+    { 35633, 9662, 0, 16, 1 },
+    { 35649, 9662, 0, 13, 1 },
+    { 35662, 9662, 0, 14, 1 },
+    { 35676, 9662, 0, 12, 1 },
+    { 35688, 9662, 0, 19, 1 },
+    { 35707, 9662, 0, 14, 1 },
+    { 35721, 9662, 0, 16, 1 },
+    { 35737, 9662, 0, 17, 1 },
+    { 35754, 9662, 0, 15, 1 },
+    { 35769, 9662, 0, 19, 1 },
+    { 35788, 9662, 0, 13, 1 },
+    { 35801, 9662, 0, 15, 1 },
+    { 35816, 9662, 0, 14, 1 },
+    { 35830, 9662, 0, 16, 1 },
+    { 35846, 9662, 0, 9, 1 },
+    { 35855, 9662, 0, 16, 1 },
+    { 35871, 9662, 0, 15, 1 },
+    { 35886, 9662, 0, 15, 1 },
+    { 35901, 9662, 0, 18, 1 },
+    { 35919, 9662, 0, 14, 1 },
+    { 35933, 9662, 0, 13, 1 },
+    { 35946, 9662, 0, 13, 1 },
+    { 35959, 9662, 0, 13, 1 },
+    { 35972, 9662, 0, 13, 1 },
+    { 35985, 9662, 0, 13, 1 },
+    { 35998, 9662, 0, 16, 1 },
+    { 36014, 9662, 0, 11, 1 },
+    { 36025, 9662, 0, 12, 1 },
+    { 36037, 9662, 0, 12, 1 },
+    { 36049, 9662, 0, 12, 1 },
+    { 36061, 9662, 0, 14, 1 },
+    { 36075, 9662, 0, 16, 1 },
+    { 36091, 9662, 0, 18, 1 },
+    { 36109, 9662, 0, 11, 1 },
+    { 36120, 9662, 0, 14, 1 },
+    { 36134, 9662, 0, 14, 1 },
+    { 36148, 9662, 0, 14, 1 },
+    { 36162, 9662, 0, 11, 1 },
+    { 36173, 9662, 2, 22, 0 },
+    { 36195, 9664, 0, 13, 1 },
+    { 36208, 9664, 0, 20, 1 },
+    { 36228, 9664, 0, 13, 1 },
+    { 36241, 9664, 0, 21, 1 },
+    { 36262, 9664, 0, 13, 1 },
+    { 36275, 9664, 0, 15, 1 },
+    { 36290, 9664, 0, 15, 1 },
+    { 36305, 9664, 0, 15, 1 },
+    { 36320, 9664, 0, 14, 1 },
+    { 36334, 9664, 0, 13, 1 },
+    { 36347, 9664, 0, 17, 1 },
+    { 36364, 9664, 0, 12, 1 },
+    { 36376, 9664, 0, 12, 1 },
+    { 36388, 9664, 0, 11, 1 },
+    { 36399, 9664, 0, 12, 1 },
+    { 36411, 9664, 0, 15, 1 },
+    { 36426, 9664, 0, 18, 1 },
+    { 36444, 9664, 0, 13, 1 },
+    { 36457, 9664, 0, 12, 1 },
+    { 36469, 9664, 0, 12, 1 },
+    { 36481, 9664, 0, 13, 1 },
+    { 36494, 9664, 0, 15, 1 },
+    { 36509, 9664, 0, 14, 1 },
+    { 36523, 9664, 0, 12, 1 },
+    { 36535, 9664, 0, 13, 1 },
+    { 36548, 9664, 0, 11, 1 },
+    { 36559, 9664, 0, 12, 1 },
+    { 36571, 9664, 0, 13, 1 },
+    { 36584, 9664, 0, 14, 1 },
+    { 36598, 9664, 0, 9, 1 },
+    { 36607, 9664, 0, 19, 1 },
+    { 36626, 9664, 0, 13, 1 },
+    { 36639, 9664, 0, 13, 1 },
+    { 36652, 9664, 0, 12, 1 },
+    { 36664, 9664, 0, 14, 1 },
+    { 36678, 9664, 0, 15, 1 },
+    { 36693, 9664, 0, 12, 1 },
+    { 36705, 9664, 0, 13, 1 },
+    { 36718, 9664, 0, 15, 1 },
+    { 36733, 9664, 0, 12, 1 },
+    { 36745, 9664, 0, 12, 1 },
+    { 36757, 9664, 0, 12, 1 },
+    { 36769, 9664, 0, 12, 1 },
+    { 36781, 9664, 0, 13, 1 },
+    { 36794, 9664, 0, 18, 1 },
+    { 36812, 9664, 0, 12, 1 },
+    { 36824, 9664, 0, 12, 1 },
+    { 36836, 9664, 0, 17, 1 },
+    { 36853, 9664, 0, 15, 1 },
+    { 36868, 9664, 0, 15, 1 },
+    { 36883, 9664, 0, 19, 1 },
+    { 36902, 9664, 0, 14, 1 },
+    { 36916, 9664, 0, 15, 1 },
+    { 36931, 9664, 0, 12, 1 },
+    { 36943, 9664, 1, 14, 0 },
+    { 36957, 9665, 0, 15, 1 },
+    { 36972, 9665, 0, 22, 1 },
+    { 36994, 9665, 0, 18, 1 },
+    { 37012, 9665, 0, 12, 1 },
+    { 37024, 9665, 0, 15, 1 },
+    { 37039, 9665, 0, 13, 1 },
+    { 37052, 9665, 0, 15, 1 },
+    { 37067, 9665, 0, 12, 1 },
+    { 37079, 9665, 0, 13, 1 },
+    { 37092, 9665, 0, 13, 1 },
+    { 37105, 9665, 0, 14, 1 },
+    { 37119, 9665, 0, 12, 1 },
+    { 37131, 9665, 0, 12, 1 },
+    { 37143, 9665, 0, 16, 1 },
+    { 37159, 9665, 0, 17, 1 },
+    { 37176, 9665, 0, 11, 1 },
+    { 37187, 9665, 0, 12, 1 },
+    { 37199, 9665, 0, 14, 1 },
+    { 37213, 9665, 0, 17, 1 },
+    { 37230, 9665, 0, 14, 1 },
+    { 37244, 9665, 0, 13, 1 },
+    { 37257, 9665, 0, 11, 1 },
+    { 37268, 9665, 0, 15, 1 },
+    { 37283, 9665, 0, 20, 1 },
+    { 37303, 9665, 0, 12, 1 },
+    { 37315, 9665, 0, 10, 1 },
+    { 37325, 9665, 0, 6, 1 },
+    { 37331, 9665, 0, 7, 1 },
+    { 37338, 9665, 0, 9, 1 },
+    { 37347, 9665, 0, 3, 1 },
+    { 37350, 9665, 0, 8, 1 },
+    { 37358, 9665, 0, 8, 1 },
+    { 37366, 9665, 0, 5, 1 },
+    { 37371, 9665, 0, 5, 1 },
+    { 37376, 9665, 0, 6, 1 },
+    { 37382, 9665, 0, 3, 1 },
+    { 37385, 9665, 0, 7, 1 },
+    { 37392, 9665, 0, 6, 1 },
+    { 37398, 9665, 0, 7, 1 },
+    { 37405, 9665, 0, 7, 1 },
+    { 37412, 9665, 0, 7, 1 },
+    { 37419, 9665, 0, 6, 1 },
+    { 37425, 9665, 1, 8, 0 },
+    { 37433, 9666, 0, 12, 1 },
+    { 37445, 9666, 0, 11, 1 },
+    { 37456, 9666, 0, 5, 1 },
+    { 37461, 9666, 0, 9, 1 },
+    { 37470, 9666, 0, 14, 1 },
+    { 37484, 9666, 0, 12, 1 },
+    { 712, 9666, 0, 3, 1 },
+    { 1340, 9666, 0, 3, 1 },
+    { 1880, 9666, 0, 3, 1 },
+    { 2599, 9666, 0, 3, 1 },
+    { 3029, 9666, 0, 4, 1 },
+    { 4113, 9666, 0, 3, 1 },
+    { 4380, 9666, 0, 3, 1 },
+    { 37496, 9666, 0, 15, 1 },
+    { 37511, 9666, 0, 8, 1 },
+    { 37519, 9666, 0, 4, 1 },
+    { 37523, 9666, 0, 8, 1 },
+    { 50, 9666, 0, 2, 1 },
+    { 1308, 9666, 1, 2, 1 },
+    { 11621, 9667, 0, 3, 1 },
+    { 37531, 9667, 0, 4, 1 },
+    { 18061, 9667, 0, 3, 1 },
+    { 37535, 9667, 0, 4, 1 },
+    { 2732, 9667, 0, 6, 1 },
+    { 37539, 9667, 0, 3, 1 },
+    { 3324, 9667, 0, 4, 1 },
+    { 37542, 9667, 0, 5, 1 },
+    { 3903, 9667, 0, 3, 1 },
+    { 37547, 9667, 0, 6, 1 },
+    { 4113, 9667, 0, 3, 1 },
+    { 4380, 9667, 0, 3, 1 },
+    { 37553, 9667, 0, 10, 1 },
+    { 5181, 9667, 0, 6, 1 },
+    { 37563, 9667, 0, 12, 1 },
+    { 1308, 9667, 0, 2, 1 },
+    { 1340, 9667, 0, 3, 1 },
+    { 1880, 9667, 0, 3, 1 },
+    { 2599, 9667, 0, 3, 1 },
+    { 3837, 9667, 0, 3, 1 },
+    { 4051, 9667, 0, 6, 1 },
+    { 4113, 9667, 0, 3, 1 },
+    { 4380, 9667, 0, 3, 1 },
+    { 4677, 9667, 0, 3, 1 },
+    { 37575, 9667, 0, 8, 1 },
+    { 37583, 9667, 1, 5, 1 },
+    { 37588, 9668, 0, 7, 1 },
+    { 11115, 9668, 0, 5, 1 },
+    { 37595, 9668, 0, 4, 1 },
+    { 37599, 9668, 0, 10, 1 },
+    { 5735, 9668, 0, 4, 1 },
+    { 37609, 9668, 0, 9, 1 },
+    { 107, 9668, 0, 2, 1 },
+    { 37618, 9668, 0, 10, 1 },
+    { 37628, 9668, 1, 5, 0 },
+    { 11115, 9669, 0, 5, 1 },
+    { 12844, 9669, 0, 7, 1 },
+    { 37633, 9669, 0, 8, 1 },
+    { 37641, 9669, 0, 14, 1 },
+    { 37655, 9669, 0, 18, 1 },
+    { 37673, 9669, 0, 11, 1 },
+    { 37684, 9669, 0, 6, 1 },
+    { 29095, 9669, 2, 5, 0 },
+    { 37690, 9671, 1, 12, 0 },
+    { 37702, 9672, 0, 7, 1 },
+    { 10905, 9672, 0, 7, 1 },
+    { 37709, 9672, 0, 10, 1 },
+    { 37719, 9672, 0, 16, 1 },
+    { 16448, 9672, 0, 5, 1 },
+    { 17244, 9672, 0, 11, 1 },
+    { 13176, 9672, 0, 8, 1 },
+    { 13184, 9672, 0, 7, 1 },
+    { 13201, 9672, 0, 11, 1 },
+    { 13212, 9672, 0, 9, 1 },
+    { 13221, 9672, 0, 7, 1 },
+    { 13254, 9672, 0, 7, 1 },
+    { 37735, 9672, 0, 7, 1 },
+    { 37742, 9672, 0, 6, 1 },
+    { 13271, 9672, 0, 8, 1 },
+    { 11162, 9672, 2, 6, 1 },
+    { 37748, 9674, 0, 7, 1 },
+    { 29308, 9674, 0, 13, 1 },
+    { 37755, 9674, 0, 16, 1 },
+    { 1992, 9674, 55, 2, 1 },
+    { 13539, 9729, 0, 8, 1 },
+    { 37771, 9729, 0, 16, 1 },
+    { 37787, 9729, 0, 12, 1 },
+    { 37799, 9729, 3, 13, 0 },
+    { 37812, 9732, 0, 8, 1 },
+    { 37820, 9732, 0, 11, 1 },
+    { 37831, 9732, 0, 7, 1 },
+    { 37838, 9732, 0, 9, 1 },
+    { 12145, 9732, 0, 6, 1 },
+    { 37847, 9732, 0, 8, 1 },
+    { 2799, 9732, 0, 2, 1 },
+    { 14141, 9732, 0, 10, 1 },
+    { 37855, 9732, 0, 7, 1 },
+    { 29423, 9732, 0, 7, 1 },
+    { 14151, 9732, 0, 9, 1 },
+    { 14189, 9732, 0, 8, 1 },
+    { 24398, 9732, 0, 5, 1 },
+    { 37862, 9732, 0, 7, 1 },
+    { 16672, 9732, 0, 6, 1 },
+    { 16678, 9732, 0, 6, 1 },
+    { 37869, 9732, 0, 14, 1 },
+    { 37883, 9732, 0, 14, 1 },
+    { 37897, 9732, 0, 15, 1 },
+    { 14351, 9732, 0, 9, 1 },
+    { 14461, 9732, 0, 9, 1 },
+    { 37912, 9732, 0, 11, 1 },
+    { 37923, 9732, 0, 15, 1 },
+    { 37938, 9732, 0, 12, 1 },
+    { 37950, 9732, 0, 11, 1 },
+    { 37961, 9732, 0, 8, 1 },
+    { 37969, 9732, 0, 7, 1 },
+    { 37976, 9732, 0, 8, 1 },
+    { 37984, 9732, 0, 11, 1 },
+    { 37995, 9732, 0, 12, 1 },
+    { 38007, 9732, 0, 12, 1 },
+    { 38019, 9732, 0, 12, 1 },
+    { 38031, 9732, 0, 13, 1 },
+    { 14996, 9732, 0, 8, 1 },
+    { 12457, 9732, 0, 2, 1 },
+    { 29458, 9732, 0, 9, 1 },
+    { 18216, 9732, 0, 8, 1 },
+    { 38044, 9732, 0, 11, 1 },
+    { 38055, 9732, 0, 6, 1 },
+    { 38061, 9732, 0, 11, 1 },
+    { 38072, 9732, 0, 11, 1 },
+    { 38083, 9732, 0, 10, 1 },
+    { 11211, 9732, 0, 5, 1 },
+    { 15289, 9732, 0, 16, 1 },
+    { 38093, 9732, 0, 6, 1 },
+    { 38099, 9732, 0, 6, 1 },
+    { 11216, 9732, 0, 5, 1 },
+    { 29559, 9732, 0, 7, 1 },
+    { 38105, 9732, 0, 8, 1 },
+    { 29599, 9732, 0, 7, 1 },
+    { 38113, 9732, 0, 7, 1 },
+    { 38120, 9732, 0, 7, 1 },
+    { 38127, 9732, 0, 6, 1 },
+    { 38133, 9732, 0, 10, 1 },
+    { 38143, 9732, 0, 10, 1 },
+    { 11224, 9732, 0, 6, 1 },
+    { 38153, 9732, 0, 13, 1 },
+    { 15800, 9732, 0, 8, 1 },
+    { 15848, 9732, 0, 8, 1 },
+    { 15856, 9732, 0, 9, 1 },
+    { 38166, 9732, 0, 9, 1 },
+    { 16866, 9732, 0, 5, 1 },
+    { 38175, 9732, 0, 12, 1 },
+    { 38187, 9732, 0, 11, 1 },
+    { 38198, 9732, 1, 7, 0 },
+    { 38205, 9733, 0, 9, 1 },
+    { 38214, 9733, 0, 4, 1 },
+    { 38218, 9733, 0, 9, 1 },
+    { 12121, 9733, 0, 6, 1 },
+    { 38227, 9733, 0, 6, 1 },
+    { 6059, 9733, 0, 2, 1 },
+    { 11230, 9733, 0, 6, 1 },
+    { 38233, 9733, 0, 11, 1 },
+    { 38244, 9733, 0, 7, 1 },
+    { 38251, 9733, 0, 7, 1 },
+    { 8514, 9733, 0, 2, 1 },
+    { 38258, 9733, 0, 5, 1 },
+    { 38263, 9733, 0, 7, 1 },
+    { 38270, 9733, 0, 3, 1 },
+    { 50, 9733, 0, 2, 1 },
+    { 1340, 9733, 0, 3, 1 },
+    { 1880, 9733, 0, 3, 1 },
+    { 10863, 9733, 0, 3, 1 },
+    { 3033, 9733, 0, 3, 1 },
+    { 3837, 9733, 0, 3, 1 },
+    { 4113, 9733, 0, 3, 1 },
+    { 10000, 9733, 0, 3, 1 },
+    { 4380, 9733, 0, 3, 1 },
+    { 17183, 9733, 0, 3, 1 },
+    { 38273, 9733, 0, 8, 1 },
+    { 24260, 9733, 0, 3, 1 },
+    { 38281, 9733, 0, 4, 1 },
+    { 38285, 9733, 0, 6, 1 },
+    { 38291, 9733, 0, 4, 1 },
+    { 38295, 9733, 0, 5, 1 },
+    { 38300, 9733, 0, 5, 1 },
+    { 38305, 9733, 0, 5, 1 },
+    { 38310, 9733, 0, 10, 1 },
+    { 17284, 9733, 0, 3, 1 },
+    { 10003, 9733, 0, 8, 1 },
+    { 1340, 9733, 0, 3, 1 },
+    { 1880, 9733, 0, 3, 1 },
+    { 10863, 9733, 0, 3, 1 },
+    { 3903, 9733, 0, 3, 1 },
+    { 4113, 9733, 0, 3, 1 },
+    { 10000, 9733, 0, 3, 1 },
+    { 4380, 9733, 0, 3, 1 },
+    { 1340, 9733, 0, 3, 1 },
+    { 1880, 9733, 0, 3, 1 },
+    { 4380, 9733, 0, 3, 1 },
+    { 1340, 9733, 0, 3, 1 },
+    { 1880, 9733, 0, 3, 1 },
+    { 2599, 9733, 0, 3, 1 },
+    { 11126, 9733, 0, 1, 1 },
+    { 3903, 9733, 0, 3, 1 },
+    { 4113, 9733, 0, 3, 1 },
+    { 4177, 9733, 0, 3, 1 },
+    { 4380, 9733, 0, 3, 1 },
+    { 10730, 9733, 0, 6, 1 },
+    { 38320, 9733, 0, 4, 1 },
+    { 712, 9733, 0, 3, 1 },
+    { 1340, 9733, 0, 3, 1 },
+    { 1880, 9733, 0, 3, 1 },
+    { 38324, 9733, 0, 3, 1 },
+    { 10863, 9733, 0, 3, 1 },
+    { 38327, 9733, 0, 3, 1 },
+    { 38330, 9733, 0, 3, 1 },
+    { 2593, 9733, 0, 3, 1 },
+    { 38333, 9733, 0, 3, 1 },
+    { 2599, 9733, 0, 3, 1 },
+    { 3029, 9733, 0, 4, 1 },
+    { 4113, 9733, 0, 3, 1 },
+    { 4380, 9733, 0, 3, 1 },
+    { 10855, 9733, 0, 3, 1 },
+    { 11236, 9733, 0, 4, 1 },
+    { 38336, 9733, 0, 3, 1 },
+    { 377, 9733, 0, 3, 1 },
+    { 38339, 9733, 0, 3, 1 },
+    { 38342, 9733, 0, 8, 1 },
+    { 459, 9733, 0, 4, 1 },
+    { 38350, 9733, 0, 10, 1 },
+    { 38360, 9733, 0, 6, 1 },
+    { 38366, 9733, 0, 4, 1 },
+    { 38370, 9733, 0, 7, 1 },
+    { 38377, 9733, 0, 10, 1 },
+    { 38387, 9733, 0, 9, 1 },
+    { 38396, 9733, 0, 7, 1 },
+    { 38403, 9733, 0, 10, 1 },
+    { 712, 9733, 0, 3, 1 },
+    { 38413, 9733, 0, 11, 1 },
+    { 38424, 9733, 0, 9, 1 },
+    { 38433, 9733, 0, 5, 1 },
+    { 38438, 9733, 0, 7, 1 },
+    { 1308, 9733, 0, 2, 1 },
+    { 1340, 9733, 0, 3, 1 },
+    { 38445, 9733, 0, 7, 1 },
+    { 38452, 9733, 0, 5, 1 },
+    { 38457, 9733, 0, 9, 1 },
+    { 38466, 9733, 0, 14, 1 },
+    { 1880, 9733, 0, 3, 1 },
+    { 38480, 9733, 0, 6, 1 },
+    { 38486, 9733, 0, 3, 1 },
+    { 38489, 9733, 0, 3, 1 },
+    { 38492, 9733, 0, 6, 1 },
+    { 38498, 9733, 0, 6, 1 },
+    { 38504, 9733, 0, 7, 1 },
+    { 38511, 9733, 0, 6, 1 },
+    { 38517, 9733, 0, 5, 1 },
+    { 38522, 9733, 0, 7, 1 },
+    { 38529, 9733, 0, 7, 1 },
+    { 2599, 9733, 47, 3, 1 },
+    { 38536, 9780, 0, 7, 1 },
+    { 38543, 9780, 0, 3, 1 },
+    { 38546, 9780, 0, 9, 1 },
+    { 38555, 9780, 0, 5, 1 },
+    { 3029, 9780, 0, 4, 1 },
+    { 38560, 9780, 0, 8, 1 },
+    { 38568, 9780, 0, 12, 1 },
+    { 38580, 9780, 0, 5, 1 },
+    { 38585, 9780, 0, 6, 1 },
+    { 38591, 9780, 0, 7, 1 },
+    { 38598, 9780, 0, 7, 1 },
+    { 38605, 9780, 0, 7, 1 },
+    { 38612, 9780, 0, 8, 1 },
+    { 38620, 9780, 0, 15, 1 },
+    { 38635, 9780, 0, 5, 1 },
+    { 38640, 9780, 0, 7, 1 },
+    { 38647, 9780, 0, 7, 1 },
+    { 38654, 9780, 0, 10, 1 },
+    { 38664, 9780, 0, 9, 1 },
+    { 38673, 9780, 0, 5, 1 },
+    { 38678, 9780, 0, 10, 1 },
+    { 38688, 9780, 0, 6, 1 },
+    { 38694, 9780, 0, 7, 1 },
+    { 38701, 9780, 0, 5, 1 },
+    { 38706, 9780, 0, 4, 1 },
+    { 38710, 9780, 0, 6, 1 },
+    { 38716, 9780, 0, 6, 1 },
+    { 38722, 9780, 0, 7, 1 },
+    { 38729, 9780, 0, 7, 1 },
+    { 38736, 9780, 0, 8, 1 },
+    { 38744, 9780, 0, 5, 1 },
+    { 38749, 9780, 0, 6, 1 },
+    { 38755, 9780, 0, 8, 1 },
+    { 38763, 9780, 0, 5, 1 },
+    { 38768, 9780, 0, 6, 1 },
+    { 38774, 9780, 0, 5, 1 },
+    { 38779, 9780, 0, 4, 1 },
+    { 38783, 9780, 0, 7, 1 },
+    { 38790, 9780, 0, 10, 1 },
+    { 38800, 9780, 0, 8, 1 },
+    { 38808, 9780, 0, 6, 1 },
+    { 3837, 9780, 0, 3, 1 },
+    { 3840, 9780, 0, 5, 1 },
+    { 38814, 9780, 0, 6, 1 },
+    { 38820, 9780, 0, 6, 1 },
+    { 38826, 9780, 0, 6, 1 },
+    { 3903, 9780, 0, 3, 1 },
+    { 38832, 9780, 0, 7, 1 },
+    { 10988, 9780, 0, 12, 1 },
+    { 38839, 9780, 0, 5, 1 },
+    { 4113, 9780, 0, 3, 1 },
+    { 38844, 9780, 0, 13, 1 },
+    { 10000, 9780, 0, 3, 1 },
+    { 38857, 9780, 0, 8, 1 },
+    { 38865, 9780, 0, 4, 1 },
+    { 38869, 9780, 0, 5, 1 },
+    { 38874, 9780, 0, 6, 1 },
+    { 38880, 9780, 0, 6, 1 },
+    { 38886, 9780, 0, 7, 1 },
+    { 38893, 9780, 0, 7, 1 },
+    { 38900, 9780, 0, 5, 1 },
+    { 4380, 9780, 0, 3, 1 },
+    { 38905, 9780, 0, 7, 1 },
+    { 38912, 9780, 0, 9, 1 },
+    { 38921, 9780, 0, 9, 1 },
+    { 38930, 9780, 0, 10, 1 },
+    { 20380, 9780, 0, 2, 1 },
+    { 38940, 9780, 0, 4, 1 },
+    { 38944, 9780, 0, 4, 1 },
+    { 38948, 9780, 0, 7, 1 },
+    { 38955, 9780, 0, 8, 1 },
+    { 38963, 9780, 0, 9, 1 },
+    { 38972, 9780, 0, 9, 1 },
+    { 38981, 9780, 0, 7, 1 },
+    { 38988, 9780, 0, 9, 1 },
+    { 38997, 9780, 0, 6, 1 },
+    { 39003, 9780, 0, 6, 1 },
+    { 11010, 9780, 0, 4, 1 },
+    { 39009, 9780, 0, 10, 1 },
+    { 39019, 9780, 0, 8, 1 },
+    { 39027, 9780, 0, 9, 1 },
+    { 39036, 9780, 0, 6, 1 },
+    { 39042, 9780, 0, 5, 1 },
+    { 39047, 9780, 0, 8, 1 },
+    { 4804, 9780, 0, 10, 1 },
+    { 17933, 9780, 0, 3, 1 },
+    { 39055, 9780, 0, 6, 1 },
+    { 39061, 9780, 0, 7, 1 },
+    { 39068, 9780, 0, 5, 1 },
+    { 39073, 9780, 0, 8, 1 },
+    { 39081, 9780, 0, 5, 1 },
+    { 5270, 9780, 0, 3, 1 },
+    { 5323, 9780, 0, 4, 1 },
+    { 39086, 9780, 0, 9, 1 },
+    { 15980, 9780, 0, 10, 1 },
+    { 39095, 9780, 0, 5, 1 },
+    { 39100, 9780, 0, 7, 1 },
+    { 39107, 9780, 0, 5, 1 },
+    { 39112, 9780, 0, 6, 1 },
+    { 39118, 9780, 0, 5, 1 },
+    { 39123, 9780, 0, 3, 1 },
+    { 39126, 9780, 0, 9, 1 },
+    { 39135, 9780, 0, 12, 1 },
+    { 39147, 9780, 0, 12, 1 },
+    { 39159, 9780, 0, 8, 1 },
+    { 39167, 9780, 0, 7, 1 },
+    { 39174, 9780, 0, 8, 1 },
+    { 39182, 9780, 0, 7, 1 },
+    { 39189, 9780, 0, 10, 1 },
+    { 39199, 9780, 0, 11, 1 },
+    { 39210, 9780, 0, 8, 1 },
+    { 39218, 9780, 0, 8, 1 },
+    { 39226, 9780, 0, 6, 1 },
+    { 39232, 9780, 0, 5, 1 },
+    { 39237, 9780, 0, 10, 1 },
+    { 39247, 9780, 0, 5, 1 },
+    { 5851, 9780, 0, 2, 1 },
+    { 11283, 9780, 0, 7, 1 },
+    { 5938, 9780, 0, 6, 1 },
+    { 39252, 9780, 0, 5, 1 },
+    { 39257, 9780, 0, 9, 1 },
+    { 39266, 9780, 0, 5, 1 },
+    { 39271, 9780, 0, 8, 1 },
+    { 39279, 9780, 0, 5, 1 },
+    { 39284, 9780, 0, 9, 1 },
+    { 39293, 9780, 0, 6, 1 },
+    { 39299, 9780, 0, 8, 1 },
+    { 39307, 9780, 0, 3, 1 },
+    { 39310, 9780, 0, 6, 1 },
+    { 39316, 9780, 0, 6, 1 },
+    { 39322, 9780, 0, 5, 1 },
+    { 39327, 9780, 0, 9, 1 },
+    { 39336, 9780, 0, 9, 1 },
+    { 39345, 9780, 0, 7, 1 },
+    { 39352, 9780, 0, 4, 1 },
+    { 39356, 9780, 0, 7, 1 },
+    { 39363, 9780, 0, 9, 1 },
+    { 39372, 9780, 0, 5, 1 },
+    { 39377, 9780, 0, 8, 1 },
+    { 39385, 9780, 0, 5, 1 },
+    { 39390, 9780, 0, 5, 1 },
+    { 39395, 9780, 0, 9, 1 },
+    { 1308, 9780, 0, 2, 1 },
+    { 4089, 9780, 0, 4, 1 },
+    { 39404, 9780, 0, 3, 1 },
+    { 1308, 9780, 0, 2, 1 },
+    { 1880, 9780, 0, 3, 1 },
+    { 2599, 9780, 0, 3, 1 },
+    { 4113, 9780, 0, 3, 1 },
+    { 4380, 9780, 0, 3, 1 },
+    { 39407, 9780, 0, 5, 1 },
+    { 50, 9780, 0, 2, 1 },
+    { 712, 9780, 0, 3, 1 },
+    { 1340, 9780, 0, 3, 1 },
+    { 1880, 9780, 0, 3, 1 },
+    { 39412, 9780, 0, 3, 1 },
+    { 2599, 9780, 0, 3, 1 },
+    { 3029, 9780, 0, 4, 1 },
+    { 39415, 9780, 0, 4, 1 },
+    { 4089, 9780, 0, 4, 1 },
+    { 4113, 9780, 0, 3, 1 },
+    { 4380, 9780, 0, 3, 1 },
+    { 4677, 9780, 0, 3, 1 },
+    { 4695, 9780, 0, 4, 1 },
+    { 0, 9780, 0, 3, 1 },
+    { 39419, 9780, 0, 3, 1 },
+    { 39422, 9780, 0, 4, 1 },
+    { 17387, 9780, 0, 6, 1 },
+    { 532, 9780, 0, 3, 1 },
+    { 11115, 9780, 0, 5, 1 },
+    { 10905, 9780, 0, 7, 1 },
+    { 1504, 9780, 0, 3, 1 },
+    { 39426, 9780, 1, 8, 0 },
+    { 11656, 9781, 0, 3, 1 },
+    { 39434, 9781, 0, 3, 1 },
+    { 3471, 9781, 0, 3, 1 },
+    { 3837, 9781, 0, 3, 1 },
+    { 39437, 9781, 0, 5, 1 },
+    { 1340, 9781, 0, 3, 1 },
+    { 1880, 9781, 0, 3, 1 },
+    { 2599, 9781, 0, 3, 1 },
+    { 4113, 9781, 0, 3, 1 },
+    { 4380, 9781, 0, 3, 1 },
+    { 39442, 9781, 0, 3, 1 },
+    { 39445, 9781, 0, 3, 1 },
+    { 39448, 9781, 0, 12, 1 },
+    { 10003, 9781, 0, 8, 1 },
+    { 1340, 9781, 0, 3, 1 },
+    { 1880, 9781, 0, 3, 1 },
+    { 2599, 9781, 0, 3, 1 },
+    { 3063, 9781, 0, 3, 1 },
+    { 4113, 9781, 0, 3, 1 },
+    { 16386, 9781, 0, 4, 1 },
+    { 4380, 9781, 0, 3, 1 },
+    { 39460, 9781, 0, 4, 1 },
+    { 11115, 9781, 0, 5, 1 },
+    { 39464, 9781, 0, 5, 1 },
+    { 10905, 9781, 0, 7, 1 },
+    { 1308, 9781, 0, 2, 1 },
+    { 10648, 9781, 0, 2, 1 },
+    { 12188, 9781, 0, 2, 1 },
+    { 4108, 9781, 0, 2, 1 },
+    { 11000, 9781, 0, 2, 1 },
+    { 39469, 9781, 0, 4, 1 },
+    { 1340, 9781, 0, 3, 1 },
+    { 1466, 9781, 0, 4, 1 },
+    { 1880, 9781, 0, 3, 1 },
+    { 2599, 9781, 0, 3, 1 },
+    { 3903, 9781, 0, 3, 1 },
+    { 4113, 9781, 0, 3, 1 },
+    { 4380, 9781, 0, 3, 1 },
+    { 10003, 9781, 0, 8, 1 },
+    { 1340, 9781, 0, 3, 1 },
+    { 1880, 9781, 0, 3, 1 },
+    { 2599, 9781, 0, 3, 1 },
+    { 3903, 9781, 0, 3, 1 },
+    { 4089, 9781, 0, 4, 1 },
+    { 4113, 9781, 0, 3, 1 },
+    { 4380, 9781, 0, 3, 1 },
+    { 10011, 9781, 0, 3, 1 },
+    { 12172, 9781, 0, 4, 1 },
+    { 10003, 9781, 0, 8, 1 },
+    { 1340, 9781, 0, 3, 1 },
+    { 10000, 9781, 0, 3, 1 },
+    { 17284, 9781, 0, 3, 1 },
+    { 39473, 9781, 0, 4, 1 },
+    { 12505, 9781, 0, 4, 1 },
+    { 11115, 9781, 0, 5, 1 },
+    { 10003, 9781, 0, 8, 1 },
+    { 1308, 9781, 0, 2, 1 },
+    { 1340, 9781, 0, 3, 1 },
+    { 12533, 9781, 0, 4, 1 },
+    { 3029, 9781, 0, 4, 1 },
+    { 10000, 9781, 0, 3, 1 },
+    { 11027, 9781, 0, 2, 1 },
+    { 4380, 9781, 0, 3, 1 },
+    { 11864, 9781, 0, 3, 1 },
+    { 5323, 9781, 0, 4, 1 },
+    { 5564, 9781, 0, 5, 1 },
+    { 5851, 9781, 0, 2, 1 },
+    { 12215, 9781, 0, 3, 1 },
+    { 10979, 9781, 0, 9, 1 },
+    { 39477, 9781, 0, 6, 1 },
+    { 39483, 9781, 0, 8, 1 },
+    { 50, 9781, 0, 2, 1 },
+    { 10003, 9781, 0, 8, 1 },
+    { 39491, 9781, 1, 7, 0 },
+    { 1308, 9782, 0, 2, 1 },
+    { 1880, 9782, 0, 3, 1 },
+    { 2599, 9782, 0, 3, 1 },
+    { 3006, 9782, 0, 2, 1 },
+    { 4380, 9782, 0, 3, 1 },
+    { 39498, 9782, 0, 2, 1 },
+    { 6020, 9782, 0, 2, 1 },
+    { 39500, 9782, 0, 7, 1 },
+    { 50, 9782, 0, 2, 1 },
+    { 39507, 9782, 0, 7, 1 },
+    { 39514, 9782, 0, 9, 1 },
+    { 39523, 9782, 0, 3, 1 },
+    { 10003, 9782, 0, 8, 1 },
+    { 39526, 9782, 0, 3, 1 },
+    { 39529, 9782, 1, 7, 0 },
+    { 1340, 9783, 0, 3, 1 },
+    { 39536, 9783, 0, 8, 1 },
+    { 1880, 9783, 0, 3, 1 },
+    { 39544, 9783, 0, 7, 1 },
+    { 2599, 9783, 0, 3, 1 },
+    { 39551, 9783, 0, 6, 1 },
+    { 3063, 9783, 0, 3, 1 },
+    { 39557, 9783, 0, 8, 1 },
+    { 39565, 9783, 0, 8, 1 },
+    { 39573, 9783, 0, 3, 1 },
+    { 39576, 9783, 0, 6, 1 },
+    { 24423, 9783, 1, 5, 1 },
+    { 39582, 9784, 0, 5, 1 },
+    { 3903, 9784, 0, 3, 1 },
+    { 17879, 9784, 0, 8, 1 },
+    { 39587, 9784, 0, 8, 1 },
+    { 39595, 9784, 0, 3, 1 },
+    { 39598, 9784, 4, 6, 1 },
+    { 39604, 9788, 0, 5, 1 },
+    { 39609, 9788, 0, 4, 1 },
+    { 39613, 9788, 0, 7, 1 },
+    { 4113, 9788, 0, 3, 1 },
+    { 39620, 9788, 0, 3, 1 },
+    { 4380, 9788, 0, 3, 1 },
+    { 11044, 9788, 0, 2, 1 },
+    { 39623, 9788, 0, 10, 1 },
+    { 39633, 9788, 0, 3, 1 },
+    { 39636, 9788, 1, 12, 0 },
+    { 39648, 9789, 0, 3, 1 },
+    { 39651, 9789, 0, 4, 1 },
+    { 39655, 9789, 0, 11, 1 },
+    { 39666, 9789, 0, 8, 1 },
+    { 908, 9789, 0, 5, 2 },
+    { 12989, 9789, 0, 4, 2 },
+    { 25691, 9789, 0, 8, 2 },
+    { 39674, 9789, 0, 11, 1 },
+    { 24176, 9789, 0, 2, 1 },
+    { 39685, 9789, 0, 9, 2 },
+    { 39694, 9789, 0, 8, 1 },
+    { 12339, 9789, 0, 7, 1 },
+    { 12563, 9789, 0, 4, 1 },
+    { 39702, 9789, 0, 7, 1 },
+    { 50, 9789, 0, 2, 1 },
+    { 1308, 9789, 0, 2, 1 },
+    { 1466, 9789, 0, 4, 1 },
+    { 2599, 9789, 0, 3, 1 },
+    { 3903, 9789, 0, 3, 1 },
+    { 4113, 9789, 0, 3, 1 },
+    { 4380, 9789, 0, 3, 1 },
+    { 1340, 9789, 0, 3, 1 },
+    { 1880, 9789, 0, 3, 1 },
+    { 2599, 9789, 0, 3, 1 },
+    { 3837, 9789, 0, 3, 1 },
+    { 4113, 9789, 0, 3, 1 },
+    { 4380, 9789, 0, 3, 1 },
+    { 4760, 9789, 0, 3, 1 },
+    { 10011, 9789, 0, 3, 1 },
+    { 1340, 9789, 0, 3, 1 },
+    { 1880, 9789, 0, 3, 1 },
+    { 2599, 9789, 0, 3, 1 },
+    { 4113, 9789, 0, 3, 1 },
+    { 4380, 9789, 0, 3, 1 },
+    { 1340, 9789, 0, 3, 1 },
+    { 1880, 9789, 0, 3, 1 },
+    { 2599, 9789, 0, 3, 1 },
+    { 4113, 9789, 0, 3, 1 },
+    { 4380, 9789, 0, 3, 1 },
+    { 17284, 9789, 0, 3, 1 },
+    { 1880, 9789, 0, 3, 1 },
+    { 2599, 9789, 1, 3, 1 },
+    { 1340, 9790, 0, 3, 1 },
+    { 1880, 9790, 0, 3, 1 },
+    { 2599, 9790, 0, 3, 1 },
+    { 3029, 9790, 0, 4, 1 },
+    { 3837, 9790, 0, 3, 1 },
+    { 4113, 9790, 0, 3, 1 },
+    { 4380, 9790, 0, 3, 1 },
+    { 6011, 9790, 0, 2, 1 },
+    { 39709, 9790, 0, 10, 1 },
+    { 11113, 9790, 0, 1, 1 },
+    { 50, 9790, 0, 2, 1 },
+    { 11114, 9790, 0, 1, 1 },
+    { 628, 9790, 0, 2, 1 },
+    { 10003, 9790, 0, 8, 1 },
+    { 39719, 9790, 0, 5, 1 },
+    { 11120, 9790, 0, 1, 1 },
+    { 1340, 9790, 0, 3, 1 },
+    { 11020, 9790, 0, 4, 1 },
+    { 11121, 9790, 0, 1, 1 },
+    { 11122, 9790, 0, 1, 1 },
+    { 11123, 9790, 0, 1, 1 },
+    { 39724, 9790, 0, 2, 1 },
+    { 39726, 9790, 0, 4, 1 },
+    { 39730, 9790, 0, 3, 1 },
+    { 11124, 9790, 0, 1, 1 },
+    { 11125, 9790, 0, 1, 1 },
+    { 11126, 9790, 0, 1, 1 },
+    { 39733, 9790, 0, 6, 1 },
+    { 39739, 9790, 0, 12, 1 },
+    { 11128, 9790, 0, 1, 1 },
+    { 39751, 9790, 0, 7, 1 },
+    { 39758, 9790, 0, 15, 1 },
+    { 39773, 9790, 0, 6, 1 },
+    { 11129, 9790, 0, 1, 1 },
+    { 39779, 9790, 0, 6, 1 },
+    { 11130, 9790, 0, 1, 1 },
+    { 10988, 9790, 0, 12, 1 },
+    { 11131, 9790, 0, 1, 1 },
+    { 39785, 9790, 0, 14, 1 },
+    { 11132, 9790, 0, 1, 1 },
+    { 4380, 9790, 0, 3, 1 },
+    { 11133, 9790, 0, 1, 1 },
+    { 39799, 9790, 1, 4, 0 },
+    { 39803, 9791, 0, 5, 1 },
+    { 11044, 9791, 0, 2, 1 },
+    { 4667, 9791, 0, 5, 1 },
+    { 11135, 9791, 0, 1, 1 },
+    { 11136, 9791, 0, 1, 1 },
+    { 11137, 9791, 0, 1, 1 },
+    { 5851, 9791, 0, 2, 1 },
+    { 11138, 9791, 0, 1, 1 },
+    { 11140, 9791, 0, 1, 1 },
+    { 11141, 9791, 0, 1, 1 },
+    { 11142, 9791, 0, 1, 1 },
+    { 11143, 9791, 0, 1, 1 },
+    { 10742, 9791, 0, 9, 1 },
+    { 10003, 9791, 0, 8, 1 },
+    { 1340, 9791, 0, 3, 1 },
+    { 1880, 9791, 0, 3, 1 },
+    { 39808, 9791, 0, 8, 1 },
+    { 2599, 9791, 0, 3, 1 },
+    { 4113, 9791, 0, 3, 1 },
+    { 4380, 9791, 0, 3, 1 },
+    { 24236, 9791, 0, 3, 1 },
+    { 39816, 9791, 0, 3, 1 },
+    { 1340, 9791, 0, 3, 1 },
+    { 2599, 9791, 0, 3, 1 },
+    { 39819, 9791, 0, 8, 1 },
+    { 3903, 9791, 0, 3, 1 },
+    { 4113, 9791, 0, 3, 1 },
+    { 4248, 9791, 0, 3, 1 },
+    { 4380, 9791, 0, 3, 1 },
+    { 39827, 9791, 4, 8, 0 },
+    { 39835, 9795, 0, 3, 1 },
+    { 18734, 9795, 0, 8, 1 },
+    { 11115, 9795, 0, 5, 1 },
+    { 17197, 9795, 0, 4, 1 },
+    { 39838, 9795, 0, 6, 1 },
+    { 10003, 9795, 0, 8, 1 },
+    { 39844, 9795, 0, 6, 1 },
+    { 39850, 9795, 0, 7, 1 },
+    { 11115, 9795, 0, 5, 1 },
+    { 39857, 9795, 0, 4, 1 },
+    { 39861, 9795, 0, 8, 2 },
+    { 24247, 9795, 0, 4, 1 },
+    { 17860, 9795, 0, 7, 1 },
+    { 39869, 9795, 0, 4, 1 },
+    { 39873, 9795, 0, 12, 1 },
+    { 12261, 9795, 0, 4, 1 },
+    { 39885, 9795, 0, 5, 1 },
+    { 10742, 9795, 0, 9, 1 },
+    { 39890, 9795, 0, 7, 1 },
+    { 39897, 9795, 0, 8, 1 },
+    { 39905, 9795, 0, 6, 1 },
+    { 39911, 9795, 0, 10, 1 },
+    { 39921, 9795, 0, 10, 2 },
+    { 39931, 9795, 0, 4, 1 },
+    { 39935, 9795, 0, 3, 2 },
+    { 10003, 9795, 0, 8, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 377, 9795, 0, 3, 1 },
+    { 10003, 9795, 0, 8, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 12190, 9795, 0, 4, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 17928, 9795, 0, 5, 1 },
+    { 11290, 9795, 0, 4, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 3835, 9795, 0, 2, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 10011, 9795, 0, 3, 1 },
+    { 39938, 9795, 0, 5, 2 },
+    { 17887, 9795, 0, 6, 1 },
+    { 39943, 9795, 0, 4, 1 },
+    { 39947, 9795, 0, 6, 1 },
+    { 712, 9795, 0, 3, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 3835, 9795, 0, 2, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 10011, 9795, 0, 3, 1 },
+    { 1308, 9795, 0, 2, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 39953, 9795, 0, 9, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 39962, 9795, 0, 9, 1 },
+    { 3903, 9795, 0, 3, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 39971, 9795, 0, 4, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 39975, 9795, 0, 8, 1 },
+    { 39983, 9795, 0, 7, 1 },
+    { 5564, 9795, 0, 5, 1 },
+    { 39990, 9795, 0, 6, 1 },
+    { 39996, 9795, 0, 8, 1 },
+    { 40004, 9795, 0, 9, 1 },
+    { 40013, 9795, 0, 8, 1 },
+    { 39507, 9795, 0, 7, 1 },
+    { 40021, 9795, 0, 10, 1 },
+    { 40031, 9795, 0, 11, 1 },
+    { 40042, 9795, 0, 7, 1 },
+    { 40049, 9795, 0, 8, 1 },
+    { 40057, 9795, 0, 10, 1 },
+    { 40067, 9795, 0, 8, 1 },
+    { 39514, 9795, 0, 9, 1 },
+    { 40075, 9795, 0, 7, 1 },
+    { 40082, 9795, 0, 7, 1 },
+    { 40089, 9795, 0, 8, 1 },
+    { 39536, 9795, 0, 8, 1 },
+    { 40097, 9795, 0, 15, 1 },
+    { 40112, 9795, 0, 5, 1 },
+    { 26169, 9795, 0, 7, 1 },
+    { 39551, 9795, 0, 6, 1 },
+    { 40117, 9795, 0, 7, 1 },
+    { 40124, 9795, 0, 6, 1 },
+    { 39557, 9795, 0, 8, 1 },
+    { 40130, 9795, 0, 6, 1 },
+    { 40136, 9795, 0, 7, 1 },
+    { 40143, 9795, 0, 9, 1 },
+    { 40152, 9795, 0, 7, 1 },
+    { 40159, 9795, 0, 9, 1 },
+    { 40168, 9795, 0, 9, 1 },
+    { 40177, 9795, 0, 6, 1 },
+    { 39565, 9795, 0, 8, 1 },
+    { 40183, 9795, 0, 5, 1 },
+    { 40188, 9795, 0, 10, 1 },
+    { 39587, 9795, 0, 8, 1 },
+    { 39595, 9795, 0, 3, 1 },
+    { 40198, 9795, 0, 8, 1 },
+    { 39613, 9795, 0, 7, 1 },
+    { 40206, 9795, 0, 5, 1 },
+    { 40211, 9795, 0, 16, 1 },
+    { 39620, 9795, 0, 3, 1 },
+    { 40227, 9795, 0, 7, 1 },
+    { 40234, 9795, 0, 5, 1 },
+    { 40239, 9795, 0, 8, 1 },
+    { 40247, 9795, 0, 5, 1 },
+    { 39648, 9795, 0, 3, 1 },
+    { 40252, 9795, 0, 8, 1 },
+    { 40260, 9795, 0, 6, 1 },
+    { 40266, 9795, 0, 9, 1 },
+    { 40275, 9795, 0, 7, 1 },
+    { 40282, 9795, 0, 11, 1 },
+    { 40293, 9795, 0, 4, 1 },
+    { 40297, 9795, 0, 4, 1 },
+    { 39655, 9795, 0, 11, 1 },
+    { 39666, 9795, 0, 8, 1 },
+    { 40301, 9795, 0, 7, 1 },
+    { 11115, 9795, 0, 5, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 10863, 9795, 0, 3, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 4834, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 3903, 9795, 0, 3, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 40308, 9795, 0, 11, 1 },
+    { 50, 9795, 0, 2, 1 },
+    { 1308, 9795, 0, 2, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 1130, 9795, 0, 2, 1 },
+    { 3835, 9795, 0, 2, 1 },
+    { 12004, 9795, 0, 2, 1 },
+    { 10003, 9795, 0, 8, 1 },
+    { 17645, 9795, 0, 9, 1 },
+    { 12253, 9795, 0, 8, 1 },
+    { 1308, 9795, 0, 2, 1 },
+    { 10011, 9795, 0, 3, 1 },
+    { 50, 9795, 0, 2, 1 },
+    { 1308, 9795, 0, 2, 1 },
+    { 12188, 9795, 0, 2, 1 },
+    { 3006, 9795, 0, 2, 1 },
+    { 20173, 9795, 0, 2, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 4355, 9795, 0, 6, 1 },
+    { 11000, 9795, 0, 2, 1 },
+    { 5323, 9795, 0, 4, 1 },
+    { 50, 9795, 0, 2, 1 },
+    { 712, 9795, 0, 3, 1 },
+    { 1308, 9795, 0, 2, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 12188, 9795, 0, 2, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 3063, 9795, 0, 3, 1 },
+    { 3903, 9795, 0, 3, 1 },
+    { 4089, 9795, 0, 4, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 18079, 9795, 0, 3, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 39651, 9795, 0, 4, 1 },
+    { 10855, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 1308, 9795, 0, 2, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 3903, 9795, 0, 3, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 10000, 9795, 0, 3, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 40319, 9795, 0, 3, 1 },
+    { 12185, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 11727, 9795, 0, 3, 1 },
+    { 3029, 9795, 0, 4, 1 },
+    { 40322, 9795, 0, 4, 1 },
+    { 40326, 9795, 0, 6, 1 },
+    { 40332, 9795, 0, 3, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 40335, 9795, 0, 11, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 17928, 9795, 0, 5, 1 },
+    { 11283, 9795, 0, 7, 1 },
+    { 40346, 9795, 0, 3, 1 },
+    { 1340, 9795, 0, 3, 1 },
+    { 1880, 9795, 0, 3, 1 },
+    { 2599, 9795, 0, 3, 1 },
+    { 3903, 9795, 0, 3, 1 },
+    { 4113, 9795, 0, 3, 1 },
+    { 40349, 9795, 0, 4, 1 },
+    { 4380, 9795, 0, 3, 1 },
+    { 40353, 9795, 0, 3, 1 },
+    { 12469, 9795, 1, 12, 0 },
+    { 40356, 9796, 0, 3, 1 },
+    { 40359, 9796, 0, 7, 1 },
+    { 40366, 9796, 0, 12, 1 },
+    { 29559, 9796, 0, 7, 1 },
+    { 40378, 9796, 0, 5, 1 },
+    { 18985, 9796, 0, 2, 1 },
+    { 40383, 9796, 0, 3, 1 },
+    { 40386, 9796, 0, 3, 1 },
+    { 712, 9796, 0, 3, 1 },
+    { 1340, 9796, 1, 3, 1 },
+    { 18059, 9797, 0, 2, 1 },
+    { 1880, 9797, 0, 3, 1 },
+    { 18061, 9797, 0, 3, 1 },
+    { 2599, 9797, 0, 3, 1 },
+    { 3029, 9797, 0, 4, 1 },
+    { 17201, 9797, 0, 3, 1 },
+    { 40389, 9797, 0, 3, 1 },
+    { 3903, 9797, 0, 3, 1 },
+    { 4089, 9797, 0, 4, 1 },
+    { 4106, 9797, 1, 2, 1 },
+    { 4113, 9798, 0, 3, 1 },
+    { 4380, 9798, 0, 3, 1 },
+    { 17186, 9798, 0, 3, 1 },
+    { 5749, 9798, 0, 3, 1 },
+    { 40392, 9798, 0, 3, 1 },
+    { 6011, 9798, 0, 2, 1 },
+    { 10855, 9798, 0, 3, 1 },
+    { 17284, 9798, 0, 3, 1 },
+    { 112, 9798, 0, 4, 1 },
+    { 712, 9798, 0, 3, 1 },
+    { 1308, 9798, 0, 2, 1 },
+    { 1340, 9798, 0, 3, 1 },
+    { 1466, 9798, 0, 4, 1 },
+    { 1880, 9798, 0, 3, 1 },
+    { 2599, 9798, 0, 3, 1 },
+    { 3029, 9798, 0, 4, 1 },
+    { 3063, 9798, 0, 3, 1 },
+    { 3191, 9798, 0, 4, 1 },
+    { 3946, 9798, 0, 4, 1 },
+    { 4051, 9798, 0, 6, 1 },
+    { 4089, 9798, 0, 4, 1 },
+    { 4113, 9798, 0, 3, 1 },
+    { 4380, 9798, 0, 3, 1 },
+    { 4677, 9798, 0, 3, 1 },
+    { 5938, 9798, 0, 6, 1 },
+    { 40395, 9798, 0, 11, 1 },
+    { 11162, 9798, 0, 6, 1 },
+    { 40406, 9798, 0, 10, 1 },
+    { 40416, 9798, 0, 10, 1 },
+    { 10003, 9798, 0, 8, 1 },
+    { 1293, 9798, 0, 4, 1 },
+    { 1340, 9798, 1, 3, 1 },
+    { 40426, 9799, 0, 4, 1 },
+    { 1880, 9799, 0, 3, 1 },
+    { 2422, 9799, 0, 4, 1 },
+    { 2599, 9799, 0, 3, 1 },
+    { 17661, 9799, 0, 3, 1 },
+    { 3903, 9799, 0, 3, 1 },
+    { 4113, 9799, 0, 3, 1 },
+    { 4380, 9799, 0, 3, 1 },
+    { 40430, 9799, 0, 3, 1 },
+    { 40433, 9799, 0, 11, 1 },
+    { 17741, 9799, 0, 10, 1 },
+    { 40444, 9799, 0, 12, 1 },
+    { 40456, 9799, 0, 6, 1 },
+    { 17813, 9799, 0, 6, 1 },
+    { 40462, 9799, 0, 6, 1 },
+    { 50, 9799, 0, 2, 1 },
+    { 1308, 9799, 0, 2, 1 },
+    { 12188, 9799, 0, 2, 1 },
+    { 17963, 9799, 0, 5, 1 },
+    { 3029, 9799, 0, 4, 1 },
+    { 3835, 9799, 0, 2, 1 },
+    { 3903, 9799, 0, 3, 1 },
+    { 3946, 9799, 0, 4, 1 },
+    { 4108, 9799, 0, 2, 1 },
+    { 11000, 9799, 0, 2, 1 },
+    { 5144, 9799, 0, 2, 1 },
+    { 6011, 9799, 0, 2, 1 },
+    { 712, 9799, 0, 3, 1 },
+    { 1103, 9799, 0, 2, 1 },
+    { 40468, 9799, 0, 9, 1 },
+    { 40477, 9799, 0, 8, 1 },
+    { 40485, 9799, 0, 9, 1 },
+    { 40494, 9799, 0, 9, 1 },
+    { 40503, 9799, 0, 10, 1 },
+    { 40513, 9799, 0, 10, 1 },
+    { 1243, 9799, 0, 2, 1 },
+    { 1306, 9799, 0, 2, 1 },
+    { 1308, 9799, 0, 2, 1 },
+    { 1340, 9799, 0, 3, 1 },
+    { 1507, 9799, 0, 2, 1 },
+    { 40523, 9799, 0, 6, 1 },
+    { 1576, 9799, 0, 2, 1 },
+    { 1580, 9799, 0, 2, 1 },
+    { 40529, 9799, 0, 2, 1 },
+    { 40531, 9799, 0, 14, 1 },
+    { 40545, 9799, 0, 14, 1 },
+    { 40559, 9799, 0, 7, 1 },
+    { 40566, 9799, 0, 2, 1 },
+    { 1880, 9799, 0, 3, 1 },
+    { 2599, 9799, 0, 3, 1 },
+    { 40568, 9799, 0, 2, 1 },
+    { 3006, 9799, 0, 2, 1 },
+    { 11730, 9799, 0, 3, 1 },
+    { 40570, 9799, 0, 15, 1 },
+    { 3291, 9799, 0, 2, 1 },
+    { 40585, 9799, 0, 7, 1 },
+    { 40592, 9799, 0, 7, 1 },
+    { 40599, 9799, 0, 7, 1 },
+    { 40606, 9799, 0, 12, 1 },
+    { 40618, 9799, 0, 12, 1 },
+    { 40630, 9799, 0, 4, 1 },
+    { 40634, 9799, 0, 10, 1 },
+    { 3328, 9799, 0, 2, 1 },
+    { 3359, 9799, 0, 2, 1 },
+    { 40644, 9799, 0, 4, 1 },
+    { 40648, 9799, 0, 2, 1 },
+    { 40650, 9799, 0, 2, 1 },
+    { 40652, 9799, 0, 4, 1 },
+    { 22792, 9799, 0, 2, 1 },
+    { 3684, 9799, 0, 2, 1 },
+    { 3686, 9799, 0, 3, 1 },
+    { 40656, 9799, 0, 7, 1 },
+    { 40663, 9799, 0, 5, 1 },
+    { 3713, 9799, 0, 2, 1 },
+    { 40668, 9799, 0, 4, 1 },
+    { 3927, 9799, 0, 2, 1 },
+    { 40672, 9799, 0, 8, 1 },
+    { 4113, 9799, 0, 3, 1 },
+    { 40680, 9799, 0, 8, 1 },
+    { 40688, 9799, 0, 2, 1 },
+    { 40690, 9799, 0, 5, 1 },
+    { 40695, 9799, 0, 6, 1 },
+    { 4380, 9799, 0, 3, 1 },
+    { 4586, 9799, 0, 2, 1 },
+    { 40701, 9799, 0, 7, 1 },
+    { 11044, 9799, 0, 2, 1 },
+    { 40708, 9799, 0, 5, 1 },
+    { 40713, 9799, 0, 5, 1 },
+    { 40718, 9799, 0, 2, 1 },
+    { 5136, 9799, 0, 2, 1 },
+    { 40720, 9799, 0, 10, 1 },
+    { 40730, 9799, 0, 10, 1 },
+    { 5400, 9799, 0, 2, 1 },
+    { 40740, 9799, 0, 4, 1 },
+    { 20720, 9799, 0, 2, 1 },
+    { 40744, 9799, 0, 8, 1 },
+    { 6063, 9799, 0, 2, 1 },
+    { 40752, 9799, 0, 8, 1 },
+    { 11139, 9799, 0, 1, 1 },
+    { 40760, 9799, 0, 7, 1 },
+    { 40767, 9799, 0, 9, 1 },
+    { 6233, 9799, 0, 2, 1 },
+    { 40776, 9799, 0, 5, 1 },
+    { 40781, 9799, 0, 5, 1 },
+    { 40786, 9799, 0, 11, 1 },
+    { 40797, 9799, 0, 12, 1 },
+    { 40809, 9799, 0, 8, 1 },
+    { 40817, 9799, 0, 8, 1 },
+    { 40825, 9799, 0, 2, 1 },
+    { 40827, 9799, 0, 2, 1 },
+    { 50, 9799, 0, 2, 1 },
+    { 10003, 9799, 0, 8, 1 },
+    { 1308, 9799, 0, 2, 1 },
+    { 1340, 9799, 0, 3, 1 },
+    { 12188, 9799, 0, 2, 1 },
+    { 4108, 9799, 0, 2, 1 },
+    { 11000, 9799, 0, 2, 1 },
+    { 4380, 9799, 0, 3, 1 },
+    { 5144, 9799, 0, 2, 1 },
+    { 50, 9799, 0, 2, 1 },
+    { 11115, 9799, 0, 5, 1 },
+    { 1308, 9799, 11, 2, 1 },
+    { 40829, 9810, 0, 4, 1 },
+    { 40833, 9810, 0, 5, 1 },
+    { 2599, 9810, 4, 3, 1 },
+    { 40838, 9814, 0, 4, 1 },
+    { 40842, 9814, 0, 22, 1 },
+    { 40864, 9814, 0, 19, 1 },
+    { 40883, 9814, 0, 19, 1 },
+    { 40902, 9814, 0, 17, 1 },
+    { 40919, 9814, 0, 18, 1 },
+    { 3686, 9814, 0, 3, 1 },
+    { 3835, 9814, 0, 2, 1 },
+    { 4113, 9814, 0, 3, 1 },
+    { 40937, 9814, 0, 3, 1 },
+    { 4380, 9814, 6, 3, 1 },
+    { 24273, 9820, 0, 3, 1 },
+    { 40940, 9820, 0, 6, 1 },
+    { 40946, 9820, 0, 14, 1 },
+    { 40960, 9820, 0, 5, 1 },
+    { 40965, 9820, 0, 16, 1 },
+    { 10011, 9820, 0, 3, 2 },
+    { 40981, 9820, 3, 2, 1 },
+    { 176, 9823, 3, 2, 1 },
+    { 352, 9826, 3, 2, 1 },
+    { 384, 9829, 3, 2, 1 },
+    { 485, 9832, 3, 2, 1 },
+    { 947, 9835, 3, 2, 1 },
+    { 10905, 9838, 0, 7, 1 },
+    { 1308, 9838, 3, 2, 1 },
+    { 19524, 9841, 3, 2, 1 },
+    { 40983, 9844, 3, 2, 1 },
+    { 1638, 9847, 3, 2, 1 },
+    { 40985, 9850, 0, 3, 1 },
+    { 18406, 9850, 0, 4, 1 },
+    { 39808, 9850, 1, 8, 0 },
+    { 40988, 9851, 0, 3, 1 },
+    { 40991, 9851, 3, 2, 1 },
+    { 37812, 9854, 0, 8, 1 },
+    { 2399, 9854, 3, 2, 1 },
+    { 40993, 9857, 0, 7, 1 },
+    { 41000, 9857, 0, 7, 1 },
+    { 2656, 9857, 3, 2, 1 },
+    { 12439, 9860, 2, 2, 1 },
+    { 41007, 9862, 3, 2, 1 },
+    { 2962, 9865, 3, 2, 1 },
+    { 2978, 9868, 3, 2, 1 },
+    { 3006, 9871, 3, 2, 1 },
+    { 41009, 9874, 0, 5, 1 },
+    { 41014, 9874, 0, 3, 1 },
+    { 3298, 9874, 0, 4, 1 },
+    { 40648, 9874, 3, 2, 1 },
+    { 3379, 9877, 3, 2, 1 },
+    { 3388, 9880, 3, 2, 1 },
+    { 41017, 9883, 0, 11, 1 },
+    { 3717, 9883, 3, 2, 1 },
+    { 3833, 9886, 3, 2, 1 },
+    { 3835, 9889, 3, 2, 1 },
+    { 20173, 9892, 11, 2, 1 },
+    { 17879, 9903, 0, 8, 1 },
+    { 3942, 9903, 3, 2, 1 },
+    { 3944, 9906, 3, 2, 1 },
+    { 4036, 9909, 3, 2, 1 },
+    { 4041, 9912, 3, 2, 1 },
+    { 4106, 9915, 3, 2, 1 },
+    { 41028, 9918, 2, 2, 1 },
+    { 4108, 9920, 3, 2, 1 },
+    { 41030, 9923, 3, 2, 1 },
+    { 41032, 9926, 3, 2, 1 },
+    { 12463, 9929, 3, 2, 1 },
+    { 24442, 9932, 0, 4, 1 },
+    { 41034, 9932, 0, 3, 1 },
+    { 41037, 9932, 3, 2, 1 },
+    { 41039, 9935, 3, 2, 1 },
+    { 41041, 9938, 3, 2, 1 },
+    { 41043, 9941, 3, 2, 1 },
+    { 11000, 9944, 3, 2, 1 },
+    { 4414, 9947, 3, 2, 1 },
+    { 41045, 9950, 0, 8, 1 },
+    { 41053, 9950, 0, 7, 1 },
+    { 4651, 9950, 3, 2, 1 },
+    { 20574, 9953, 2, 2, 1 },
+    { 5144, 9955, 3, 2, 1 },
+    { 5211, 9958, 2, 2, 1 },
+    { 38175, 9960, 0, 12, 1 },
+    { 5858, 9960, 3, 2, 1 },
+    { 41060, 9963, 3, 2, 1 },
+    { 41062, 9966, 3, 2, 1 },
+    { 6065, 9969, 3, 2, 1 },
+    { 6165, 9972, 3, 2, 1 },
+    { 21863, 9975, 3, 2, 1 },
+    { 11040, 9978, 3, 2, 1 },
+    { 41064, 9981, 3, 2, 1 },
+    { 41066, 9984, 1, 2, 1 },
+    { 41068, 9985, 3, 2, 1 },
+    { 1340, 9988, 1, 3, 1 },
+    { 1880, 9989, 0, 3, 1 },
+    { 41070, 9989, 0, 3, 1 },
+    { 3903, 9989, 0, 3, 1 },
+    { 4113, 9989, 0, 3, 1 },
+    { 4380, 9989, 0, 3, 1 },
+    { 1308, 9989, 0, 2, 1 },
+    { 1340, 9989, 0, 3, 1 },
+    { 4113, 9989, 0, 3, 1 },
+    { 4380, 9989, 0, 3, 1 },
+    { 41073, 9989, 0, 2, 1 },
+    { 1340, 9989, 0, 3, 1 },
+    { 1880, 9989, 0, 3, 1 },
+    { 2599, 9989, 0, 3, 1 },
+    { 10650, 9989, 1, 2, 1 },
+    { 3903, 9990, 0, 3, 1 },
+    { 4113, 9990, 0, 3, 1 },
+    { 4380, 9990, 0, 3, 1 },
+    { 12505, 9990, 0, 4, 1 },
+    { 11557, 9990, 0, 3, 1 },
+    { 1308, 9990, 0, 2, 1 },
+    { 1340, 9990, 0, 3, 1 },
+    { 41075, 9990, 0, 3, 1 },
+    { 1880, 9990, 0, 3, 1 },
+    { 12533, 9990, 0, 4, 1 },
+    { 10863, 9990, 0, 3, 1 },
+    { 2599, 9990, 0, 3, 1 },
+    { 3029, 9990, 0, 4, 1 },
+    { 3063, 9990, 0, 3, 1 },
+    { 3903, 9990, 0, 3, 1 },
+    { 4113, 9990, 0, 3, 1 },
+    { 10000, 9990, 0, 3, 1 },
+    { 4380, 9990, 0, 3, 1 },
+    { 41078, 9990, 0, 3, 1 },
+    { 11864, 9990, 0, 3, 1 },
+    { 5564, 9990, 0, 5, 1 },
+    { 11976, 9990, 0, 3, 1 },
+    { 10855, 9990, 0, 3, 1 },
+    { 404, 9990, 0, 2, 1 },
+    { 1308, 9990, 0, 2, 1 },
+    { 1340, 9990, 0, 3, 1 },
+    { 17201, 9990, 0, 3, 1 },
+    { 4113, 9990, 0, 3, 1 },
+    { 4380, 9990, 0, 3, 1 },
+    { 50, 9990, 0, 2, 1 },
+    { 712, 9990, 0, 3, 1 },
+    { 10003, 9990, 0, 8, 1 },
+    { 1340, 9990, 0, 3, 1 },
+    { 1880, 9990, 0, 3, 1 },
+    { 2599, 9990, 0, 3, 1 },
+    { 2732, 9990, 0, 6, 1 },
+    { 3029, 9990, 0, 4, 1 },
+    { 3063, 9990, 0, 3, 1 },
+    { 4089, 9990, 0, 4, 1 },
+    { 4113, 9990, 0, 3, 1 },
+    { 4380, 9990, 0, 3, 1 },
+    { 4677, 9990, 0, 3, 1 },
+    { 744, 9990, 0, 4, 1 },
+    { 1306, 9990, 0, 2, 1 },
+    { 1340, 9990, 0, 3, 1 },
+    { 1717, 9990, 0, 3, 1 },
+    { 1880, 9990, 0, 3, 1 },
+    { 3835, 9990, 0, 2, 1 },
+    { 4113, 9990, 0, 3, 1 },
+    { 4380, 9990, 0, 3, 1 },
+    { 10730, 9990, 0, 6, 1 },
+    { 712, 9990, 0, 3, 1 },
+    { 10011, 9990, 0, 3, 1 },
+    { 10730, 9990, 0, 6, 1 },
+    { 41081, 9990, 0, 7, 2 },
+    { 41088, 9990, 0, 7, 1 },
+    { 1340, 9990, 0, 3, 1 },
+    { 11162, 9990, 0, 6, 1 },
+    { 1880, 9990, 0, 3, 1 },
+    { 2599, 9990, 0, 3, 1 },
+    { 41095, 9990, 0, 6, 1 },
+    { 4113, 9990, 0, 3, 1 },
+    { 4380, 9990, 0, 3, 1 },
+    { 41101, 9990, 0, 13, 1 },
+    { 41114, 9990, 0, 11, 1 },
+    { 41125, 9990, 0, 10, 1 },
+    { 41135, 9990, 0, 11, 1 },
+    { 41146, 9990, 0, 8, 1 },
+    { 41154, 9990, 0, 9, 1 },
+    { 6924, 9990, 0, 9, 1 },
+    { 41163, 9990, 0, 8, 1 },
+    { 41171, 9990, 0, 8, 1 },
+    { 41179, 9990, 0, 9, 1 },
+    { 6702, 9990, 0, 10, 1 },
+    { 17690, 9990, 0, 10, 1 },
+    { 7918, 9990, 0, 10, 1 },
+    { 12483, 9990, 0, 10, 1 },
+    { 17741, 9990, 0, 10, 1 },
+    { 17762, 9990, 0, 11, 1 },
+    { 41188, 9990, 0, 13, 1 },
+    { 41201, 9990, 0, 15, 1 },
+    { 41216, 9990, 0, 16, 1 },
+    { 41232, 9990, 0, 13, 1 },
+    { 41245, 9990, 0, 12, 1 },
+    { 41257, 9990, 0, 11, 1 },
+    { 41268, 9990, 0, 7, 1 },
+    { 41275, 9990, 0, 14, 1 },
+    { 41289, 9990, 0, 10, 1 },
+    { 41299, 9990, 0, 9, 1 },
+    { 6924, 9990, 0, 9, 1 },
+    { 41308, 9990, 0, 9, 1 },
+    { 41317, 9990, 0, 10, 1 },
+    { 41327, 9990, 0, 9, 1 },
+    { 7341, 9990, 0, 9, 1 },
+    { 41336, 9990, 0, 11, 1 },
+    { 37633, 9990, 0, 8, 1 },
+    { 41347, 9990, 0, 8, 1 },
+    { 41355, 9990, 0, 9, 1 },
+    { 10833, 9990, 0, 7, 2 },
+    { 38258, 9990, 0, 5, 1 },
+    { 1340, 9990, 0, 3, 1 },
+    { 1880, 9990, 0, 3, 1 },
+    { 2599, 9990, 0, 3, 1 },
+    { 3903, 9990, 0, 3, 1 },
+    { 4113, 9990, 0, 3, 1 },
+    { 4380, 9990, 0, 3, 1 },
+    { 4380, 9990, 0, 3, 1 },
+    { 50, 9990, 0, 2, 1 },
+    { 41364, 9990, 0, 5, 1 },
+    { 41369, 9990, 0, 3, 1 },
+    { 1308, 9990, 1, 2, 1 },
+    { 1880, 9991, 0, 3, 1 },
+    { 2599, 9991, 0, 3, 1 },
+    { 41372, 9991, 0, 7, 1 },
+    { 3471, 9991, 0, 3, 1 },
+    { 3903, 9991, 0, 3, 1 },
+    { 4113, 9991, 0, 3, 1 },
+    { 4177, 9991, 0, 3, 1 },
+    { 18079, 9991, 0, 3, 1 },
+    { 41379, 9991, 0, 3, 1 },
+    { 10000, 9991, 0, 3, 1 },
+    { 4380, 9991, 0, 3, 1 },
+    { 5181, 9991, 0, 6, 1 },
+    { 5851, 9991, 0, 2, 1 },
+    { 10855, 9991, 0, 3, 1 },
+    { 50, 9991, 0, 2, 1 },
+    { 712, 9991, 0, 3, 1 },
+    { 1308, 9991, 0, 2, 1 },
+    { 1340, 9991, 0, 3, 1 },
+    { 1880, 9991, 0, 3, 1 },
+    { 2599, 9991, 0, 3, 1 },
+    { 3029, 9991, 0, 4, 1 },
+    { 3903, 9991, 0, 3, 1 },
+    { 4113, 9991, 0, 3, 1 },
+    { 4380, 9991, 0, 3, 1 },
+    { 10011, 9991, 0, 3, 1 },
+    { 41088, 9991, 0, 7, 1 },
+    { 24176, 9991, 0, 2, 1 },
+    { 41382, 9991, 0, 4, 1 },
+    { 41386, 9991, 0, 6, 2 },
+    { 50, 9991, 0, 2, 1 },
+    { 1308, 9991, 0, 2, 1 },
+    { 2599, 9991, 0, 3, 1 },
+    { 3903, 9991, 0, 3, 1 },
+    { 4380, 9991, 0, 3, 1 },
+    { 41392, 9991, 0, 6, 1 },
+    { 8592, 9991, 0, 6, 1 },
+    { 41398, 9991, 0, 8, 1 },
+    { 41406, 9991, 0, 6, 1 },
+    { 41412, 9991, 0, 6, 1 },
+    { 8634, 9991, 0, 6, 1 },
+    { 41418, 9991, 0, 12, 1 },
+    { 41430, 9991, 0, 8, 1 },
+    { 41438, 9991, 0, 6, 1 },
+    { 41444, 9991, 0, 2, 1 },
+    { 41446, 9991, 0, 4, 1 },
+    { 41450, 9991, 0, 6, 1 },
+    { 41456, 9991, 0, 4, 1 },
+    { 8634, 9991, 0, 6, 1 },
+    { 41460, 9991, 0, 4, 1 },
+    { 41464, 9991, 0, 6, 1 },
+    { 41470, 9991, 0, 12, 1 },
+    { 41482, 9991, 0, 8, 1 },
+    { 41490, 9991, 0, 8, 1 },
+    { 41498, 9991, 0, 6, 1 },
+    { 41504, 9991, 0, 12, 1 },
+    { 41516, 9991, 0, 18, 1 },
+    { 41534, 9991, 0, 18, 1 },
+    { 41552, 9991, 0, 15, 1 },
+    { 41567, 9991, 0, 18, 1 },
+    { 41585, 9991, 0, 12, 1 },
+    { 17789, 9991, 0, 6, 1 },
+    { 9623, 9991, 0, 6, 1 },
+    { 9764, 9991, 0, 6, 1 },
+    { 17801, 9991, 0, 6, 1 },
+    { 17813, 9991, 0, 6, 1 },
+    { 12499, 9991, 0, 6, 1 },
+    { 11113, 9991, 0, 1, 1 },
+    { 41597, 9991, 0, 11, 1 },
+    { 10003, 9991, 0, 8, 1 },
+    { 41608, 9991, 0, 3, 1 },
+    { 10003, 9991, 0, 8, 1 },
+    { 6388, 9991, 0, 4, 1 },
+    { 41611, 9991, 0, 2, 2 },
+    { 3006, 9991, 0, 2, 2 },
+    { 41611, 9991, 0, 2, 2 },
+    { 41613, 9991, 0, 6, 2 },
+    { 10003, 9991, 0, 8, 1 },
+    { 41619, 9991, 1, 9, 0 },
+    { 10988, 9992, 0, 12, 1 },
+    { 11014, 9992, 0, 3, 1 },
+    { 1082, 9992, 0, 8, 1 },
+    { 11024, 9992, 1, 3, 1 },
+    { 11027, 9993, 0, 2, 1 },
+    { 11031, 9993, 0, 3, 1 },
+    { 5040, 9993, 0, 2, 1 },
+    { 11034, 9993, 0, 3, 1 },
+    { 11037, 9993, 0, 3, 1 },
+    { 11040, 9993, 0, 2, 1 },
+    { 11031, 9993, 0, 3, 1 },
+    { 5040, 9993, 0, 2, 1 },
+    { 11034, 9993, 0, 3, 1 },
+    { 11037, 9993, 0, 3, 1 },
+    { 11040, 9993, 0, 2, 1 },
+    { 1288, 9993, 0, 5, 1 },
+    { 41628, 9993, 0, 7, 1 },
+    { 10003, 9993, 0, 8, 1 },
+    { 15980, 9993, 0, 10, 1 },
+    { 41635, 9993, 1, 12, 0 },
+    { 50, 9994, 0, 2, 1 },
+    { 176, 9994, 0, 2, 1 },
+    { 233, 9994, 0, 2, 1 },
+    { 18942, 9994, 0, 2, 1 },
+    { 492, 9994, 0, 2, 1 },
+    { 19443, 9994, 0, 2, 1 },
+    { 41647, 9994, 0, 2, 1 },
+    { 1971, 9994, 0, 2, 1 },
+    { 12188, 9994, 0, 2, 1 },
+    { 3717, 9994, 0, 2, 1 },
+    { 3885, 9994, 0, 2, 1 },
+    { 4036, 9994, 0, 2, 1 },
+    { 4041, 9994, 0, 2, 1 },
+    { 4414, 9994, 0, 2, 1 },
+    { 10654, 9994, 0, 2, 1 },
+    { 4472, 9994, 0, 2, 1 },
+    { 20423, 9994, 0, 2, 1 },
+    { 4651, 9994, 0, 2, 1 },
+    { 41649, 9994, 0, 2, 1 },
+    { 20589, 9994, 0, 2, 1 },
+    { 4981, 9994, 0, 2, 1 },
+    { 41651, 9994, 0, 2, 1 },
+    { 5009, 9994, 0, 2, 1 },
+    { 5144, 9994, 0, 2, 1 },
+    { 5213, 9994, 0, 2, 1 },
+    { 20680, 9994, 0, 2, 1 },
+    { 5860, 9994, 0, 2, 1 },
+    { 50, 9994, 0, 2, 1 },
+    { 176, 9994, 0, 2, 1 },
+    { 233, 9994, 0, 2, 1 },
+    { 18942, 9994, 0, 2, 1 },
+    { 492, 9994, 0, 2, 1 },
+    { 19443, 9994, 0, 2, 1 },
+    { 41647, 9994, 0, 2, 1 },
+    { 1971, 9994, 0, 2, 1 },
+    { 12188, 9994, 0, 2, 1 },
+    { 3717, 9994, 0, 2, 1 },
+    { 3885, 9994, 0, 2, 1 },
+    { 4036, 9994, 0, 2, 1 },
+    { 4041, 9994, 0, 2, 1 },
+    { 4414, 9994, 0, 2, 1 },
+    { 10654, 9994, 0, 2, 1 },
+    { 4472, 9994, 0, 2, 1 },
+    { 20423, 9994, 0, 2, 1 },
+    { 4651, 9994, 0, 2, 1 },
+    { 41649, 9994, 0, 2, 1 },
+    { 20589, 9994, 0, 2, 1 },
+    { 4981, 9994, 0, 2, 1 },
+    { 41651, 9994, 0, 2, 1 },
+    { 5009, 9994, 0, 2, 1 },
+    { 5144, 9994, 0, 2, 1 },
+    { 5213, 9994, 0, 2, 1 },
+    { 20680, 9994, 0, 2, 1 },
+    { 5860, 9994, 0, 2, 1 },
+    { 10003, 9994, 0, 8, 1 },
+    { 41653, 9994, 0, 2, 1 },
+    { 41655, 9994, 0, 9, 1 },
+    { 41664, 9994, 0, 3, 2 },
+    { 107, 9994, 1, 2, 0 },
+    { 41667, 9995, 0, 9, 1 },
+    { 41676, 9995, 0, 4, 1 },
+    { 1992, 9995, 0, 2, 1 },
+    { 6196, 9995, 0, 3, 1 },
+    { 41680, 9995, 1, 5, 0 },
+    { 41685, 9996, 0, 3, 1 },
+    { 18052, 9996, 0, 2, 1 },
+    { 5858, 9996, 0, 2, 1 },
+    { 6032, 9996, 0, 2, 1 },
+    { 6032, 9996, 0, 2, 1 },
+    { 947, 9996, 0, 2, 1 },
+    { 6032, 9996, 0, 2, 1 },
+    { 6059, 9996, 0, 2, 1 },
+    { 41688, 9996, 3, 9, 0 },
+    { 41697, 9999, 5, 6, 0 },
+    { 41655, 10004, 2, 9, 0 },
+    { 41703, 10006, 0, 3, 1 },
+    { 41706, 10006, 4, 6, 0 },
+    { 41712, 10010, 3, 6, 0 },
+    { 41718, 10013, 0, 9, 1 },
+    { 41727, 10013, 0, 13, 1 },
+    { 1130, 10013, 0, 2, 1 },
+    { 1638, 10013, 0, 2, 1 },
+    { 12668, 10013, 4, 9, 0 },
+    { 1742, 10017, 0, 6, 1 },
+    { 10003, 10017, 0, 8, 1 },
+    { 2962, 10017, 0, 2, 1 },
+    { 2962, 10017, 0, 2, 1 },
+    { 1717, 10017, 0, 3, 2 },
+    { 41740, 10017, 1, 10, 0 },
+    { 41750, 10018, 1, 9, 0 },
+    { 41759, 10019, 2, 14, 0 },
+    { 41773, 10021, 4, 14, 0 },
+    { 41787, 10025, 1, 14, 0 },
+    { 41801, 10026, 4, 10, 0 },
+    { 41811, 10030, 2, 14, 0 },
+    { 41825, 10032, 2, 14, 0 },
+    { 41839, 10034, 4, 12, 0 },
+    { 17237, 10038, 0, 7, 2 },
+    { 41851, 10038, 0, 9, 2 },
+    { 41860, 10038, 0, 3, 2 },
+    { 41863, 10038, 4, 12, 0 },
+    { 41875, 10042, 1, 10, 0 },
+    { 41885, 10043, 1, 10, 0 },
+    { 41895, 10044, 2, 9, 0 },
+    { 41904, 10046, 4, 9, 0 },
+    { 41913, 10050, 4, 9, 0 },
+    { 41922, 10054, 1, 10, 0 },
+    { 41932, 10055, 0, 2, 1 },
+    { 41934, 10055, 0, 17, 1 },
+    { 41951, 10055, 0, 17, 1 },
+    { 41968, 10055, 0, 13, 1 },
+    { 41981, 10055, 0, 17, 1 },
+    { 41998, 10055, 0, 17, 1 },
+    { 42015, 10055, 0, 15, 1 },
+    { 42030, 10055, 0, 15, 1 },
+    { 42045, 10055, 0, 12, 1 },
+    { 42057, 10055, 0, 12, 1 },
+    { 42069, 10055, 0, 12, 1 },
+    { 42081, 10055, 0, 13, 1 },
+    { 42094, 10055, 0, 21, 1 },
+    { 42115, 10055, 0, 12, 1 },
+    { 42127, 10055, 0, 12, 1 },
+    { 42139, 10055, 0, 16, 1 },
+    { 42155, 10055, 0, 12, 1 },
+    { 42167, 10055, 0, 12, 1 },
+    { 42179, 10055, 0, 25, 1 },
+    { 42204, 10055, 0, 25, 1 },
+    { 42229, 10055, 0, 25, 1 },
+    { 42254, 10055, 0, 20, 1 },
+    { 42274, 10055, 0, 20, 1 },
+    { 42294, 10055, 0, 20, 1 },
+    { 42314, 10055, 0, 20, 1 },
+    { 42334, 10055, 0, 20, 1 },
+    { 42354, 10055, 2, 9, 0 },
+    { 42363, 10057, 2, 9, 1 },
+    { 42372, 10059, 4, 9, 0 },
+    { 42381, 10063, 1, 9, 0 },
+    { 42390, 10064, 1, 9, 0 },
+    { 11135, 10065, 0, 1, 2 },
+    { 42399, 10065, 0, 5, 1 },
+    { 42404, 10065, 0, 4, 1 },
+    { 42408, 10065, 0, 7, 2 },
+    { 42415, 10065, 0, 11, 2 },
+    { 42426, 10065, 0, 11, 2 },
+    { 42437, 10065, 0, 3, 2 },
+    { 42440, 10065, 0, 3, 2 },
+    { 42443, 10065, 0, 3, 2 },
+    { 42446, 10065, 0, 4, 1 },
+    { 42450, 10065, 0, 8, 1 },
+    { 41759, 10065, 0, 14, 1 },
+    { 41773, 10065, 0, 14, 1 },
+    { 41787, 10065, 0, 14, 1 },
+    { 41801, 10065, 0, 10, 1 },
+    { 41811, 10065, 0, 14, 1 },
+    { 41825, 10065, 0, 14, 1 },
+    { 41839, 10065, 0, 12, 1 },
+    { 41863, 10065, 0, 12, 1 },
+    { 41895, 10065, 0, 9, 1 },
+    { 41904, 10065, 0, 9, 1 },
+    { 41913, 10065, 0, 9, 1 },
+    { 42354, 10065, 0, 9, 1 },
+    { 42363, 10065, 0, 9, 1 },
+    { 42372, 10065, 0, 9, 1 },
+    { 42458, 10065, 0, 13, 1 },
+    { 42381, 10065, 0, 9, 1 },
+    { 42390, 10065, 0, 9, 1 },
+    { 42471, 10065, 0, 4, 1 },
+    { 42475, 10065, 0, 4, 1 },
+    { 42479, 10065, 0, 4, 1 },
+    { 42483, 10065, 0, 4, 1 },
+    { 42487, 10065, 0, 4, 1 },
+    { 42491, 10065, 0, 4, 1 },
+    { 42495, 10065, 0, 4, 1 },
+    { 42499, 10065, 0, 4, 1 },
+    { 42503, 10065, 0, 4, 1 },
+    { 42507, 10065, 0, 4, 1 },
+    { 42511, 10065, 0, 9, 1 },
+    { 42520, 10065, 0, 12, 1 },
+    { 24216, 10065, 0, 6, 1 },
+    { 42532, 10065, 0, 14, 1 },
+    { 42446, 10065, 0, 4, 1 },
+    { 42546, 10065, 0, 3, 2 },
+    { 42549, 10065, 0, 7, 1 },
+    { 42556, 10065, 0, 12, 2 },
+    { 42568, 10065, 0, 2, 1 },
+    { 333, 10065, 0, 3, 1 },
+    { 42507, 10065, 0, 4, 1 },
+    { 1992, 10065, 0, 2, 1 },
+    { 42570, 10065, 0, 7, 1 },
+    { 42577, 10065, 0, 8, 1 },
+    { 42585, 10065, 0, 8, 1 },
+    { 42593, 10065, 0, 4, 1 },
+    { 42597, 10065, 0, 6, 1 },
+    { 42603, 10065, 0, 7, 1 },
+    { 42610, 10065, 0, 4, 1 },
+    { 42614, 10065, 0, 6, 1 },
+    { 21861, 10065, 0, 2, 1 },
+    { 11141, 10065, 0, 1, 1 },
+    { 42620, 10065, 0, 4, 1 },
+    { 1288, 10065, 0, 5, 1 },
+    { 24239, 10065, 0, 6, 1 },
+    { 42624, 10065, 0, 3, 1 },
+    { 1992, 10065, 0, 2, 1 },
+    { 333, 10065, 0, 3, 1 },
+    { 42627, 10065, 0, 3, 1 },
+    { 5370, 10065, 0, 4, 1 },
+    { 4677, 10065, 0, 3, 1 },
+    { 42630, 10065, 0, 3, 1 },
+    { 42633, 10065, 0, 3, 1 },
+    { 42636, 10065, 0, 3, 1 },
+    { 17115, 10065, 0, 5, 1 },
+    { 12457, 10065, 0, 2, 1 },
+    { 42639, 10065, 0, 2, 1 },
+    { 42641, 10065, 0, 8, 1 },
+    { 10003, 10065, 0, 8, 1 },
+    { 29651, 10065, 1, 10, 0 },
+    { 1288, 10066, 0, 5, 2 },
+    { 42649, 10066, 0, 6, 1 },
+    { 1288, 10066, 2, 5, 0 },
+    { 42655, 10068, 0, 3, 1 },
+    { 42655, 10068, 0, 3, 1 },
+    { 11162, 10068, 0, 6, 1 },
+    { 42655, 10068, 0, 3, 1 },
+    { 3135, 10068, 1, 2, 0 },
+    { 42577, 10069, 0, 8, 1 },
+    { 17365, 10069, 0, 4, 2 },
+    { 3645, 10069, 0, 6, 1 },
+    { 42658, 10069, 0, 3, 2 },
+    { 42661, 10069, 0, 9, 1 },
+    { 10003, 10069, 0, 8, 1 },
+    { 10003, 10069, 0, 8, 1 },
+    { 10003, 10069, 0, 8, 1 },
+    { 12253, 10069, 0, 8, 1 },
+    { 17365, 10069, 0, 4, 1 },
+    { 2135, 10069, 0, 2, 1 },
+    { 42446, 10069, 0, 4, 1 },
+    { 42507, 10069, 0, 4, 1 },
+    { 42670, 10069, 0, 6, 1 },
+    { 10003, 10069, 0, 8, 1 },
+    { 42676, 10069, 0, 3, 2 },
+    { 10003, 10069, 0, 8, 1 },
+    { 15326, 10069, 0, 7, 1 },
+    { 42679, 10069, 0, 7, 1 },
+    { 42686, 10069, 0, 10, 1 },
+    { 3686, 10069, 0, 3, 1 },
+    { 24273, 10069, 0, 3, 1 },
+    { 333, 10069, 0, 3, 1 },
+    { 42696, 10069, 0, 9, 2 },
+    { 42507, 10069, 0, 4, 1 },
+    { 42705, 10069, 0, 5, 1 },
+    { 42710, 10069, 0, 3, 1 },
+    { 11162, 10069, 0, 6, 1 },
+    { 2962, 10069, 0, 2, 1 },
+    { 42503, 10069, 0, 4, 1 },
+    { 42713, 10069, 0, 5, 1 },
+    { 42718, 10069, 0, 4, 1 },
+    { 42722, 10069, 0, 3, 2 },
+    { 42725, 10069, 0, 7, 1 },
+    { 1717, 10069, 2, 3, 0 },
+    { 42732, 10071, 2, 6, 0 },
+    { 4680, 10073, 1, 4, 0 },
+    { 42738, 10074, 2, 7, 0 },
+    { 42745, 10076, 0, 9, 1 },
+    { 11124, 10076, 0, 1, 1 },
+    { 42754, 10076, 0, 2, 1 },
+    { 4364, 10076, 1, 4, 0 },
+    { 42756, 10077, 0, 5, 1 },
+    { 42761, 10077, 0, 3, 1 },
+    { 42764, 10077, 0, 4, 1 },
+    { 42768, 10077, 0, 5, 1 },
+    { 42773, 10077, 0, 6, 1 },
+    { 42779, 10077, 0, 5, 1 },
+    { 42784, 10077, 0, 4, 1 },
+    { 42788, 10077, 0, 8, 1 },
+    { 42796, 10077, 0, 5, 1 },
+    { 42801, 10077, 0, 4, 1 },
+    { 42805, 10077, 0, 7, 1 },
+    { 42812, 10077, 0, 10, 1 },
+    { 42822, 10077, 0, 10, 1 },
+    { 42832, 10077, 0, 7, 1 },
+    { 42839, 10077, 0, 7, 1 },
+    { 42846, 10077, 0, 7, 1 },
+    { 42853, 10077, 0, 7, 1 },
+    { 42860, 10077, 0, 5, 1 },
+    { 42865, 10077, 0, 6, 1 },
+    { 42871, 10077, 0, 7, 1 },
+    { 42878, 10077, 0, 4, 1 },
+    { 42882, 10077, 0, 6, 1 },
+    { 42888, 10077, 0, 6, 1 },
+    { 42894, 10077, 0, 5, 1 },
+    { 42899, 10077, 0, 4, 1 },
+    { 42903, 10077, 0, 6, 1 },
+    { 42909, 10077, 0, 7, 1 },
+    { 42916, 10077, 0, 6, 1 },
+    { 42922, 10077, 0, 7, 1 },
+    { 42929, 10077, 0, 3, 1 },
+    { 42932, 10077, 0, 6, 1 },
+    { 42938, 10077, 0, 5, 1 },
+    { 42943, 10077, 0, 7, 1 },
+    { 42950, 10077, 0, 10, 1 },
+    { 42960, 10077, 0, 4, 1 },
+    { 42964, 10077, 0, 8, 1 },
+    { 42972, 10077, 0, 9, 1 },
+    { 42981, 10077, 0, 7, 1 },
+    { 42988, 10077, 0, 6, 1 },
+    { 42994, 10077, 0, 8, 1 },
+    { 43002, 10077, 0, 9, 1 },
+    { 43011, 10077, 0, 4, 1 },
+    { 43015, 10077, 0, 4, 1 },
+    { 43019, 10077, 0, 5, 1 },
+    { 43024, 10077, 0, 8, 1 },
+    { 43032, 10077, 0, 7, 1 },
+    { 43039, 10077, 0, 9, 1 },
+    { 43048, 10077, 0, 8, 1 },
+    { 43056, 10077, 0, 6, 1 },
+    { 5906, 10077, 0, 6, 1 },
+    { 43062, 10077, 0, 8, 1 },
+    { 43070, 10077, 0, 6, 1 },
+    { 22291, 10077, 0, 5, 1 },
+    { 43076, 10077, 0, 6, 1 },
+    { 43082, 10077, 0, 8, 1 },
+    { 43090, 10077, 0, 6, 1 },
+    { 43096, 10077, 0, 11, 1 },
+    { 43107, 10077, 0, 6, 1 },
+    { 43113, 10077, 0, 13, 1 },
+    { 43126, 10077, 0, 5, 1 },
+    { 43131, 10077, 0, 6, 1 },
+    { 43137, 10077, 0, 5, 1 },
+    { 43142, 10077, 0, 9, 1 },
+    { 43151, 10077, 0, 7, 1 },
+    { 43158, 10077, 0, 8, 1 },
+    { 43166, 10077, 0, 6, 1 },
+    { 43172, 10077, 0, 9, 1 },
+    { 43181, 10077, 0, 6, 1 },
+    { 43187, 10077, 0, 5, 1 },
+    { 43192, 10077, 0, 6, 1 },
+    { 43198, 10077, 0, 6, 1 },
+    { 43204, 10077, 0, 9, 1 },
+    { 43213, 10077, 0, 6, 1 },
+    { 43219, 10077, 0, 7, 1 },
+    { 43226, 10077, 0, 5, 1 },
+    { 43231, 10077, 0, 3, 1 },
+    { 43234, 10077, 0, 5, 1 },
+    { 43239, 10077, 0, 7, 1 },
+    { 43246, 10077, 0, 6, 1 },
+    { 43252, 10077, 0, 9, 1 },
+    { 22301, 10077, 0, 6, 1 },
+    { 43261, 10077, 0, 6, 1 },
+    { 43267, 10077, 0, 9, 1 },
+    { 43276, 10077, 0, 9, 1 },
+    { 43285, 10077, 0, 7, 1 },
+    { 43292, 10077, 0, 8, 1 },
+    { 43300, 10077, 0, 9, 1 },
+    { 43309, 10077, 0, 8, 1 },
+    { 43317, 10077, 0, 6, 1 },
+    { 43323, 10077, 0, 5, 1 },
+    { 43328, 10077, 0, 10, 1 },
+    { 43338, 10077, 0, 6, 1 },
+    { 43344, 10077, 0, 6, 1 },
+    { 43350, 10077, 0, 5, 1 },
+    { 43355, 10077, 0, 8, 1 },
+    { 43363, 10077, 0, 7, 1 },
+    { 43370, 10077, 0, 10, 1 },
+    { 43380, 10077, 0, 6, 1 },
+    { 43386, 10077, 0, 5, 1 },
+    { 43391, 10077, 0, 6, 1 },
+    { 43397, 10077, 0, 7, 1 },
+    { 43404, 10077, 0, 7, 1 },
+    { 43411, 10077, 0, 5, 1 },
+    { 43416, 10077, 0, 5, 1 },
+    { 43421, 10077, 0, 6, 1 },
+    { 43427, 10077, 0, 6, 1 },
+    { 43433, 10077, 0, 6, 1 },
+    { 43439, 10077, 0, 4, 1 },
+    { 43443, 10077, 0, 9, 1 },
+    { 43452, 10077, 0, 6, 1 },
+    { 43458, 10077, 0, 10, 1 },
+    { 43468, 10077, 0, 8, 1 },
+    { 43476, 10077, 0, 8, 1 },
+    { 42822, 10077, 0, 10, 1 },
+    { 43484, 10077, 0, 5, 1 },
+    { 43489, 10077, 0, 5, 1 },
+    { 43494, 10077, 0, 8, 1 },
+    { 43502, 10077, 0, 8, 1 },
+    { 43510, 10077, 0, 7, 1 },
+    { 43517, 10077, 0, 6, 1 },
+    { 43523, 10077, 0, 8, 1 },
+    { 43531, 10077, 0, 7, 1 },
+    { 43538, 10077, 0, 8, 1 },
+    { 43546, 10077, 0, 6, 1 },
+    { 43552, 10077, 0, 8, 1 },
+    { 43560, 10077, 0, 6, 1 },
+    { 43566, 10077, 0, 7, 1 },
+    { 43573, 10077, 0, 6, 1 },
+    { 42903, 10077, 0, 6, 1 },
+    { 43579, 10077, 0, 10, 1 },
+    { 43589, 10077, 0, 6, 1 },
+    { 43595, 10077, 0, 9, 1 },
+    { 43604, 10077, 0, 6, 1 },
+    { 43610, 10077, 0, 10, 1 },
+    { 43620, 10077, 0, 9, 1 },
+    { 43629, 10077, 0, 6, 1 },
+    { 43635, 10077, 0, 4, 1 },
+    { 43639, 10077, 0, 13, 1 },
+    { 43652, 10077, 0, 7, 1 },
+    { 43659, 10077, 0, 6, 1 },
+    { 43665, 10077, 0, 5, 1 },
+    { 43670, 10077, 0, 5, 1 },
+    { 5060, 10077, 0, 6, 1 },
+    { 43675, 10077, 0, 9, 1 },
+    { 43684, 10077, 0, 7, 1 },
+    { 43691, 10077, 0, 6, 1 },
+    { 43697, 10077, 0, 6, 1 },
+    { 43703, 10077, 0, 9, 1 },
+    { 43712, 10077, 0, 4, 1 },
+    { 43716, 10077, 0, 4, 1 },
+    { 43720, 10077, 0, 8, 1 },
+    { 43728, 10077, 0, 6, 1 },
+    { 43734, 10077, 0, 8, 1 },
+    { 43742, 10077, 0, 8, 1 },
+    { 43750, 10077, 0, 7, 1 },
+    { 43757, 10077, 0, 9, 1 },
+    { 43766, 10077, 0, 7, 1 },
+    { 43773, 10077, 0, 10, 1 },
+    { 43783, 10077, 0, 15, 1 },
+    { 43798, 10077, 0, 10, 1 },
+    { 43808, 10077, 0, 5, 1 },
+    { 43813, 10077, 0, 5, 1 },
+    { 43818, 10077, 0, 5, 1 },
+    { 43823, 10077, 0, 7, 1 },
+    { 43830, 10077, 0, 3, 1 },
+    { 43833, 10077, 0, 8, 1 },
+    { 43841, 10077, 0, 6, 1 },
+    { 43847, 10077, 0, 9, 1 },
+    { 43856, 10077, 0, 6, 1 },
+    { 43862, 10077, 0, 7, 1 },
+    { 43869, 10077, 0, 9, 1 },
+    { 43878, 10077, 0, 8, 1 },
+    { 43886, 10077, 0, 7, 1 },
+    { 43893, 10077, 0, 3, 1 },
+    { 43896, 10077, 0, 5, 1 },
+    { 43901, 10077, 0, 5, 1 },
+    { 43906, 10077, 0, 11, 1 },
+    { 43917, 10077, 0, 4, 1 },
+    { 43921, 10077, 0, 4, 1 },
+    { 43925, 10077, 0, 6, 1 },
+    { 43931, 10077, 0, 7, 1 },
+    { 43938, 10077, 0, 10, 1 },
+    { 43948, 10077, 0, 7, 1 },
+    { 43955, 10077, 0, 7, 1 },
+    { 22535, 10077, 0, 5, 1 },
+    { 43962, 10077, 0, 5, 1 },
+    { 43967, 10077, 0, 9, 1 },
+    { 42903, 10077, 0, 6, 1 },
+    { 43976, 10077, 0, 13, 1 },
+    { 43989, 10077, 0, 5, 1 },
+    { 43994, 10077, 0, 3, 1 },
+    { 43997, 10077, 0, 3, 1 },
+    { 44000, 10077, 0, 5, 1 },
+    { 44005, 10077, 0, 5, 1 },
+    { 42994, 10077, 0, 8, 1 },
+    { 44010, 10077, 0, 7, 1 },
+    { 44017, 10077, 0, 6, 1 },
+    { 44023, 10077, 0, 6, 1 },
+    { 44029, 10077, 0, 5, 1 },
+    { 44034, 10077, 0, 7, 1 },
+    { 44041, 10077, 0, 7, 1 },
+    { 44048, 10077, 0, 7, 1 },
+    { 44055, 10077, 0, 10, 1 },
+    { 44065, 10077, 0, 8, 1 },
+    { 43439, 10077, 0, 4, 1 },
+    { 44073, 10077, 0, 7, 1 },
+    { 44080, 10077, 0, 7, 1 },
+    { 44087, 10077, 0, 6, 1 },
+    { 44093, 10077, 0, 7, 1 },
+    { 44100, 10077, 0, 8, 1 },
+    { 44108, 10077, 0, 8, 1 },
+    { 44116, 10077, 0, 6, 1 },
+    { 44122, 10077, 0, 8, 1 },
+    { 44130, 10077, 0, 4, 1 },
+    { 44134, 10077, 0, 6, 1 },
+    { 44140, 10077, 0, 6, 1 },
+    { 44146, 10077, 0, 6, 1 },
+    { 44152, 10077, 0, 6, 1 },
+    { 44158, 10077, 0, 4, 1 },
+    { 44162, 10077, 0, 6, 1 },
+    { 44168, 10077, 0, 6, 1 },
+    { 44174, 10077, 0, 6, 1 },
+    { 44180, 10077, 0, 6, 1 },
+    { 44186, 10077, 0, 6, 1 },
+    { 44192, 10077, 0, 6, 1 },
+    { 44198, 10077, 0, 8, 1 },
+    { 44206, 10077, 0, 8, 1 },
+    { 44214, 10077, 0, 8, 1 },
+    { 44222, 10077, 0, 8, 1 },
+    { 44230, 10077, 0, 6, 1 },
+    { 44236, 10077, 0, 5, 1 },
+    { 44241, 10077, 0, 6, 1 },
+    { 44247, 10077, 0, 5, 1 },
+    { 44252, 10077, 0, 7, 1 },
+    { 44259, 10077, 0, 5, 1 },
+    { 44264, 10077, 0, 3, 1 },
+    { 44267, 10077, 0, 5, 1 },
+    { 44272, 10077, 0, 4, 1 },
+    { 44276, 10077, 0, 5, 1 },
+    { 44281, 10077, 0, 3, 1 },
+    { 44284, 10077, 0, 7, 1 },
+    { 44291, 10077, 0, 8, 1 },
+    { 44299, 10077, 0, 6, 1 },
+    { 44305, 10077, 0, 13, 1 },
+    { 44318, 10077, 0, 6, 1 },
+    { 44324, 10077, 0, 5, 1 },
+    { 44329, 10077, 0, 3, 1 },
+    { 44332, 10077, 0, 9, 1 },
+    { 44341, 10077, 0, 6, 1 },
+    { 44347, 10077, 0, 6, 1 },
+    { 44353, 10077, 0, 4, 1 },
+    { 44357, 10077, 0, 7, 1 },
+    { 44364, 10077, 0, 6, 1 },
+    { 44370, 10077, 0, 5, 1 },
+    { 44375, 10077, 0, 3, 1 },
+    { 44378, 10077, 0, 4, 1 },
+    { 44382, 10077, 0, 6, 1 },
+    { 44388, 10077, 0, 4, 1 },
+    { 44392, 10077, 0, 8, 1 },
+    { 44400, 10077, 0, 9, 1 },
+    { 44409, 10077, 0, 9, 1 },
+    { 44418, 10077, 0, 10, 1 },
+    { 44428, 10077, 0, 13, 1 },
+    { 44441, 10077, 0, 7, 1 },
+    { 44448, 10077, 0, 6, 1 },
+    { 1612, 10077, 0, 4, 1 },
+    { 22547, 10077, 0, 9, 1 },
+    { 44454, 10077, 0, 8, 1 },
+    { 44462, 10077, 0, 6, 1 },
+    { 44468, 10077, 0, 6, 1 },
+    { 44093, 10077, 0, 7, 1 },
+    { 44474, 10077, 0, 6, 1 },
+    { 44480, 10077, 0, 6, 1 },
+    { 44486, 10077, 0, 6, 1 },
+    { 44492, 10077, 0, 10, 1 },
+    { 22676, 10077, 0, 8, 1 },
+    { 44502, 10077, 0, 5, 1 },
+    { 44507, 10077, 0, 9, 1 },
+    { 44516, 10077, 0, 10, 1 },
+    { 44526, 10077, 0, 8, 1 },
+    { 44534, 10077, 0, 8, 1 },
+    { 44542, 10077, 0, 8, 1 },
+    { 44550, 10077, 0, 12, 1 },
+    { 44562, 10077, 0, 5, 1 },
+    { 44567, 10077, 0, 8, 1 },
+    { 44575, 10077, 0, 6, 1 },
+    { 44581, 10077, 0, 6, 1 },
+    { 44587, 10077, 0, 7, 1 },
+    { 44594, 10077, 0, 5, 1 },
+    { 44599, 10077, 0, 5, 1 },
+    { 44604, 10077, 0, 9, 1 },
+    { 44613, 10077, 0, 7, 1 },
+    { 44620, 10077, 0, 5, 1 },
+    { 44625, 10077, 0, 7, 1 },
+    { 43997, 10077, 0, 3, 1 },
+    { 44632, 10077, 0, 5, 1 },
+    { 44637, 10077, 0, 8, 1 },
+    { 44645, 10077, 0, 7, 1 },
+    { 44652, 10077, 0, 9, 1 },
+    { 44661, 10077, 0, 5, 1 },
+    { 44666, 10077, 0, 4, 1 },
+    { 44670, 10077, 0, 8, 1 },
+    { 44678, 10077, 0, 7, 1 },
+    { 44685, 10077, 0, 8, 1 },
+    { 44693, 10077, 0, 8, 1 },
+    { 44701, 10077, 0, 5, 1 },
+    { 44706, 10077, 0, 6, 1 },
+    { 44712, 10077, 0, 6, 1 },
+    { 44718, 10077, 0, 9, 1 },
+    { 44727, 10077, 0, 7, 1 },
+    { 44734, 10077, 0, 6, 1 },
+    { 44740, 10077, 0, 7, 1 },
+    { 44747, 10077, 0, 3, 1 },
+    { 22556, 10077, 0, 4, 1 },
+    { 44750, 10077, 0, 5, 1 },
+    { 44755, 10077, 0, 4, 1 },
+    { 44759, 10077, 0, 4, 1 },
+    { 44763, 10077, 0, 7, 1 },
+    { 44770, 10077, 0, 7, 1 },
+    { 44777, 10077, 0, 4, 1 },
+    { 44781, 10077, 0, 16, 1 },
+    { 44797, 10077, 0, 7, 1 },
+    { 43962, 10077, 0, 5, 1 },
+    { 44804, 10077, 0, 12, 1 },
+    { 44816, 10077, 0, 4, 1 },
+    { 44820, 10077, 0, 8, 1 },
+    { 44828, 10077, 0, 9, 1 },
+    { 44837, 10077, 0, 6, 1 },
+    { 44843, 10077, 0, 8, 1 },
+    { 44851, 10077, 0, 4, 1 },
+    { 44855, 10077, 0, 8, 1 },
+    { 44863, 10077, 0, 6, 1 },
+    { 44869, 10077, 0, 8, 1 },
+    { 44877, 10077, 0, 6, 1 },
+    { 44883, 10077, 0, 11, 1 },
+    { 44894, 10077, 0, 5, 1 },
+    { 44899, 10077, 0, 8, 1 },
+    { 44907, 10077, 0, 4, 1 },
+    { 44911, 10077, 0, 10, 1 },
+    { 44652, 10077, 0, 9, 1 },
+    { 44921, 10077, 0, 6, 1 },
+    { 44927, 10077, 0, 8, 1 },
+    { 44935, 10077, 0, 5, 1 },
+    { 44940, 10077, 0, 4, 1 },
+    { 44944, 10077, 0, 6, 1 },
+    { 44950, 10077, 0, 8, 1 },
+    { 23760, 10077, 0, 8, 1 },
+    { 44958, 10077, 0, 6, 1 },
+    { 44964, 10077, 0, 4, 1 },
+    { 44968, 10077, 0, 6, 1 },
+    { 44974, 10077, 0, 7, 1 },
+    { 44981, 10077, 0, 7, 1 },
+    { 44988, 10077, 0, 15, 1 },
+    { 45003, 10077, 0, 7, 1 },
+    { 45010, 10077, 0, 7, 1 },
+    { 45017, 10077, 0, 5, 1 },
+    { 45022, 10077, 0, 5, 1 },
+    { 45027, 10077, 0, 9, 1 },
+    { 45036, 10077, 0, 6, 1 },
+    { 45042, 10077, 0, 5, 1 },
+    { 45047, 10077, 0, 7, 1 },
+    { 45054, 10077, 0, 8, 1 },
+    { 45062, 10077, 0, 5, 1 },
+    { 43573, 10077, 0, 6, 1 },
+    { 45067, 10077, 0, 8, 1 },
+    { 45075, 10077, 0, 10, 1 },
+    { 45085, 10077, 0, 8, 1 },
+    { 45093, 10077, 0, 7, 1 },
+    { 45100, 10077, 0, 6, 1 },
+    { 45106, 10077, 0, 6, 1 },
+    { 45112, 10077, 0, 3, 1 },
+    { 45115, 10077, 0, 3, 1 },
+    { 45118, 10077, 0, 9, 1 },
+    { 45127, 10077, 0, 9, 1 },
+    { 45136, 10077, 0, 6, 1 },
+    { 44661, 10077, 0, 5, 1 },
+    { 45142, 10077, 0, 8, 1 },
+    { 44927, 10077, 0, 8, 1 },
+    { 45150, 10077, 0, 8, 1 },
+    { 45158, 10077, 0, 11, 1 },
+    { 45169, 10077, 0, 7, 1 },
+    { 45176, 10077, 0, 9, 1 },
+    { 45185, 10077, 0, 8, 1 },
+    { 45193, 10077, 0, 4, 1 },
+    { 45197, 10077, 0, 8, 1 },
+    { 45205, 10077, 0, 9, 1 },
+    { 45214, 10077, 0, 5, 1 },
+    { 45219, 10077, 0, 7, 1 },
+    { 45226, 10077, 0, 5, 1 },
+    { 45231, 10077, 0, 8, 1 },
+    { 45239, 10077, 0, 11, 1 },
+    { 45250, 10077, 0, 16, 1 },
+    { 45266, 10077, 0, 5, 1 },
+    { 45271, 10077, 0, 12, 1 },
+    { 45283, 10077, 0, 5, 1 },
+    { 45288, 10077, 0, 3, 1 },
+    { 45291, 10077, 0, 6, 1 },
+    { 45297, 10077, 0, 4, 1 },
+    { 45301, 10077, 0, 6, 1 },
+    { 42909, 10077, 0, 7, 1 },
+    { 45307, 10077, 0, 4, 1 },
+    { 45311, 10077, 0, 8, 1 },
+    { 45319, 10077, 0, 13, 1 },
+    { 45332, 10077, 0, 5, 1 },
+    { 45337, 10077, 0, 4, 1 },
+    { 45341, 10077, 0, 4, 1 },
+    { 45345, 10077, 0, 9, 1 },
+    { 45354, 10077, 0, 8, 1 },
+    { 45362, 10077, 0, 7, 1 },
+    { 45369, 10077, 0, 8, 1 },
+    { 45377, 10077, 0, 8, 1 },
+    { 45385, 10077, 0, 5, 1 },
+    { 45390, 10077, 0, 7, 1 },
+    { 45397, 10077, 0, 7, 1 },
+    { 45404, 10077, 0, 7, 1 },
+    { 45411, 10077, 0, 9, 1 },
+    { 45420, 10077, 0, 9, 1 },
+    { 45429, 10077, 0, 6, 1 },
+    { 45435, 10077, 0, 6, 1 },
+    { 45441, 10077, 0, 6, 1 },
+    { 45447, 10077, 0, 5, 1 },
+    { 45452, 10077, 0, 4, 1 },
+    { 45456, 10077, 0, 6, 1 },
+    { 45462, 10077, 0, 6, 1 },
+    { 45468, 10077, 0, 8, 1 },
+    { 45476, 10077, 0, 11, 1 },
+    { 45487, 10077, 0, 7, 1 },
+    { 1612, 10077, 0, 4, 1 },
+    { 45494, 10077, 0, 6, 1 },
+    { 45500, 10077, 0, 7, 1 },
+    { 45507, 10077, 0, 5, 1 },
+    { 45512, 10077, 0, 5, 1 },
+    { 45517, 10077, 0, 4, 1 },
+    { 45521, 10077, 0, 6, 1 },
+    { 45527, 10077, 0, 8, 1 },
+    { 22547, 10077, 0, 9, 1 },
+    { 45535, 10077, 0, 6, 1 },
+    { 45541, 10077, 0, 8, 1 },
+    { 45549, 10077, 0, 6, 1 },
+    { 45555, 10077, 0, 8, 1 },
+    { 45563, 10077, 0, 12, 1 },
+    { 45575, 10077, 0, 6, 1 },
+    { 45581, 10077, 0, 13, 1 },
+    { 45594, 10077, 0, 11, 1 },
+    { 45605, 10077, 0, 5, 1 },
+    { 45610, 10077, 0, 7, 1 },
+    { 45617, 10077, 0, 6, 1 },
+    { 45623, 10077, 0, 8, 1 },
+    { 45631, 10077, 0, 9, 1 },
+    { 45640, 10077, 0, 8, 1 },
+    { 43962, 10077, 0, 5, 1 },
+    { 45648, 10077, 0, 7, 1 },
+    { 45655, 10077, 0, 8, 1 },
+    { 45663, 10077, 0, 9, 1 },
+    { 45672, 10077, 0, 6, 1 },
+    { 45678, 10077, 0, 10, 1 },
+    { 45688, 10077, 0, 8, 1 },
+    { 45696, 10077, 0, 11, 1 },
+    { 45707, 10077, 0, 12, 1 },
+    { 45719, 10077, 0, 8, 1 },
+    { 45727, 10077, 0, 6, 1 },
+    { 45733, 10077, 0, 8, 1 },
+    { 45741, 10077, 0, 7, 1 },
+    { 45748, 10077, 0, 9, 1 },
+    { 45757, 10077, 0, 13, 1 },
+    { 45770, 10077, 0, 6, 1 },
+    { 45776, 10077, 0, 8, 1 },
+    { 45784, 10077, 0, 9, 1 },
+    { 45793, 10077, 0, 8, 1 },
+    { 45801, 10077, 0, 8, 1 },
+    { 45809, 10077, 0, 12, 1 },
+    { 45821, 10077, 0, 7, 1 },
+    { 45828, 10077, 0, 7, 1 },
+    { 43187, 10077, 0, 5, 1 },
+    { 45835, 10077, 0, 7, 1 },
+    { 45842, 10077, 0, 8, 1 },
+    { 45850, 10077, 0, 6, 1 },
+    { 45856, 10077, 0, 12, 1 },
+    { 45868, 10077, 0, 8, 1 },
+    { 45876, 10077, 0, 8, 1 },
+    { 45884, 10077, 0, 6, 1 },
+    { 45890, 10077, 0, 7, 1 },
+    { 45897, 10077, 0, 4, 1 },
+    { 44222, 10077, 0, 8, 1 },
+    { 45901, 10077, 0, 12, 1 },
+    { 45913, 10077, 0, 12, 1 },
+    { 45925, 10077, 0, 5, 1 },
+    { 45930, 10077, 0, 7, 1 },
+    { 45937, 10077, 0, 6, 1 },
+    { 45943, 10077, 0, 6, 1 },
+    { 45949, 10077, 0, 8, 1 },
+    { 45957, 10077, 0, 4, 1 },
+    { 45961, 10077, 0, 11, 1 },
+    { 45972, 10077, 0, 11, 1 },
+    { 45100, 10077, 0, 6, 1 },
+    { 45983, 10077, 0, 7, 1 },
+    { 45990, 10077, 0, 5, 1 },
+    { 45995, 10077, 0, 5, 1 },
+    { 46000, 10077, 0, 6, 1 },
+    { 46006, 10077, 0, 5, 1 },
+    { 46011, 10077, 0, 5, 1 },
+    { 46016, 10077, 0, 7, 1 },
+    { 46023, 10077, 0, 9, 1 },
+    { 46032, 10077, 0, 4, 1 },
+    { 46036, 10077, 0, 5, 1 },
+    { 46041, 10077, 0, 5, 1 },
+    { 46046, 10077, 0, 8, 1 },
+    { 46054, 10077, 0, 5, 1 },
+    { 46059, 10077, 0, 9, 1 },
+    { 46068, 10077, 0, 7, 1 },
+    { 46075, 10077, 0, 11, 1 },
+    { 46086, 10077, 0, 6, 1 },
+    { 46092, 10077, 0, 9, 1 },
+    { 46101, 10077, 0, 8, 1 },
+    { 46109, 10077, 0, 5, 1 },
+    { 46114, 10077, 0, 8, 1 },
+    { 46122, 10077, 0, 8, 1 },
+    { 46130, 10077, 0, 7, 1 },
+    { 46137, 10077, 0, 7, 1 },
+    { 46144, 10077, 0, 9, 1 },
+    { 46153, 10077, 0, 7, 1 },
+    { 46160, 10077, 0, 9, 1 },
+    { 46169, 10077, 0, 12, 1 },
+    { 46181, 10077, 0, 8, 1 },
+    { 46189, 10077, 0, 9, 1 },
+    { 46198, 10077, 0, 7, 1 },
+    { 46205, 10077, 0, 9, 1 },
+    { 46214, 10077, 0, 7, 1 },
+    { 46221, 10077, 0, 8, 1 },
+    { 46229, 10077, 0, 5, 1 },
+    { 46234, 10077, 0, 6, 1 },
+    { 46240, 10077, 0, 8, 1 },
+    { 46248, 10077, 0, 8, 1 },
+    { 46256, 10077, 0, 9, 1 },
+    { 46265, 10077, 0, 7, 1 },
+    { 46272, 10077, 0, 5, 1 },
+    { 46277, 10077, 0, 9, 1 },
+    { 46286, 10077, 0, 6, 1 },
+    { 46292, 10077, 0, 4, 1 },
+    { 46296, 10077, 0, 6, 1 },
+    { 46302, 10077, 0, 8, 1 },
+    { 46310, 10077, 0, 7, 1 },
+    { 46317, 10077, 0, 8, 1 },
+    { 46325, 10077, 0, 9, 1 },
+    { 46334, 10077, 0, 7, 1 },
+    { 46341, 10077, 0, 6, 1 },
+    { 46347, 10077, 0, 4, 1 },
+    { 46351, 10077, 0, 9, 1 },
+    { 46360, 10077, 0, 8, 1 },
+    { 46368, 10077, 0, 7, 1 },
+    { 46375, 10077, 0, 6, 1 },
+    { 46381, 10077, 0, 6, 1 },
+    { 46387, 10077, 0, 4, 1 },
+    { 46391, 10077, 0, 6, 1 },
+    { 46397, 10077, 0, 3, 1 },
+    { 46400, 10077, 0, 9, 1 },
+    { 46409, 10077, 0, 6, 1 },
+    { 46415, 10077, 0, 5, 1 },
+    { 44023, 10077, 0, 6, 1 },
+    { 46420, 10077, 0, 5, 1 },
+    { 46425, 10077, 0, 8, 1 },
+    { 46433, 10077, 0, 7, 1 },
+    { 46440, 10077, 0, 6, 1 },
+    { 46446, 10077, 0, 6, 1 },
+    { 43476, 10077, 0, 8, 1 },
+    { 46452, 10077, 0, 7, 1 },
+    { 46459, 10077, 0, 5, 1 },
+    { 46464, 10077, 0, 8, 1 },
+    { 46472, 10077, 0, 8, 1 },
+    { 45688, 10077, 0, 8, 1 },
+    { 46480, 10077, 0, 5, 1 },
+    { 44134, 10077, 0, 6, 1 },
+    { 46485, 10077, 0, 9, 1 },
+    { 46494, 10077, 0, 4, 1 },
+    { 46498, 10077, 0, 11, 1 },
+    { 46509, 10077, 0, 11, 1 },
+    { 46520, 10077, 0, 9, 1 },
+    { 43997, 10077, 0, 3, 1 },
+    { 46529, 10077, 0, 5, 1 },
+    { 46534, 10077, 0, 6, 1 },
+    { 46540, 10077, 0, 8, 1 },
+    { 46548, 10077, 0, 4, 1 },
+    { 44299, 10077, 0, 6, 1 },
+    { 46552, 10077, 0, 9, 1 },
+    { 46561, 10077, 0, 5, 1 },
+    { 46566, 10077, 0, 6, 1 },
+    { 46572, 10077, 0, 6, 1 },
+    { 46578, 10077, 0, 4, 1 },
+    { 46582, 10077, 0, 10, 1 },
+    { 46592, 10077, 0, 8, 1 },
+    { 46600, 10077, 0, 6, 1 },
+    { 46606, 10077, 0, 5, 1 },
+    { 46611, 10077, 0, 7, 1 },
+    { 46618, 10077, 0, 7, 1 },
+    { 46625, 10077, 0, 4, 1 },
+    { 46629, 10077, 0, 7, 1 },
+    { 46636, 10077, 0, 4, 1 },
+    { 46640, 10077, 0, 6, 1 },
+    { 46646, 10077, 0, 3, 1 },
+    { 43416, 10077, 0, 5, 1 },
+    { 46649, 10077, 0, 5, 1 },
+    { 46654, 10077, 0, 8, 1 },
+    { 46662, 10077, 0, 5, 1 },
+    { 46667, 10077, 0, 9, 1 },
+    { 2789, 10077, 0, 7, 1 },
+    { 46676, 10077, 0, 11, 1 },
+    { 46687, 10077, 0, 12, 1 },
+    { 46699, 10077, 0, 10, 1 },
+    { 22663, 10077, 0, 7, 1 },
+    { 46709, 10077, 0, 3, 1 },
+    { 46712, 10077, 0, 8, 1 },
+    { 46720, 10077, 0, 5, 1 },
+    { 46725, 10077, 0, 5, 1 },
+    { 46730, 10077, 0, 4, 1 },
+    { 46734, 10077, 0, 6, 1 },
+    { 46740, 10077, 0, 6, 1 },
+    { 46746, 10077, 0, 7, 1 },
+    { 46753, 10077, 0, 11, 1 },
+    { 44158, 10077, 0, 4, 1 },
+    { 46764, 10077, 0, 4, 1 },
+    { 46768, 10077, 0, 4, 1 },
+    { 46772, 10077, 0, 6, 1 },
+    { 45307, 10077, 0, 4, 1 },
+    { 46778, 10077, 0, 8, 1 },
+    { 46786, 10077, 0, 5, 1 },
+    { 46791, 10077, 0, 5, 1 },
+    { 46796, 10077, 0, 7, 1 },
+    { 46803, 10077, 0, 9, 1 },
+    { 44005, 10077, 0, 5, 1 },
+    { 46812, 10077, 0, 10, 1 },
+    { 46822, 10077, 0, 9, 1 },
+    { 46831, 10077, 0, 10, 1 },
+    { 46841, 10077, 0, 9, 1 },
+    { 46850, 10077, 0, 4, 1 },
+    { 46854, 10077, 0, 5, 1 },
+    { 46859, 10077, 0, 8, 1 },
+    { 46867, 10077, 0, 11, 1 },
+    { 43019, 10077, 0, 5, 1 },
+    { 46878, 10077, 0, 6, 1 },
+    { 46884, 10077, 0, 4, 1 },
+    { 46888, 10077, 0, 6, 1 },
+    { 46894, 10077, 0, 9, 1 },
+    { 46903, 10077, 0, 7, 1 },
+    { 46910, 10077, 0, 8, 1 },
+    { 46918, 10077, 0, 6, 1 },
+    { 43766, 10077, 0, 7, 1 },
+    { 23760, 10077, 0, 8, 1 },
+    { 46924, 10077, 0, 6, 1 },
+    { 46930, 10077, 0, 4, 1 },
+    { 46934, 10077, 0, 7, 1 },
+    { 46941, 10077, 0, 5, 1 },
+    { 46946, 10077, 0, 7, 1 },
+    { 46953, 10077, 0, 4, 1 },
+    { 46957, 10077, 0, 6, 1 },
+    { 46963, 10077, 0, 8, 1 },
+    { 46971, 10077, 0, 8, 1 },
+    { 3337, 10077, 0, 7, 1 },
+    { 46979, 10077, 0, 8, 1 },
+    { 46987, 10077, 0, 5, 1 },
+    { 46992, 10077, 0, 4, 1 },
+    { 46996, 10077, 0, 8, 1 },
+    { 47004, 10077, 0, 4, 1 },
+    { 47008, 10077, 0, 5, 1 },
+    { 47013, 10077, 0, 4, 1 },
+    { 47017, 10077, 0, 7, 1 },
+    { 47024, 10077, 0, 7, 1 },
+    { 47031, 10077, 0, 8, 1 },
+    { 47039, 10077, 0, 6, 1 },
+    { 47045, 10077, 0, 5, 1 },
+    { 47050, 10077, 0, 8, 1 },
+    { 47058, 10077, 0, 8, 1 },
+    { 47066, 10077, 0, 9, 1 },
+    { 44480, 10077, 0, 6, 1 },
+    { 47075, 10077, 0, 8, 1 },
+    { 47083, 10077, 0, 10, 1 },
+    { 47093, 10077, 0, 8, 1 },
+    { 22689, 10077, 0, 5, 1 },
+    { 47101, 10077, 0, 6, 1 },
+    { 47107, 10077, 0, 8, 1 },
+    { 47115, 10077, 0, 10, 1 },
+    { 47125, 10077, 0, 7, 1 },
+    { 47132, 10077, 0, 5, 1 },
+    { 47137, 10077, 0, 8, 1 },
+    { 47145, 10077, 0, 4, 1 },
+    { 47149, 10077, 0, 6, 1 },
+    { 47155, 10077, 0, 8, 1 },
+    { 44186, 10077, 0, 6, 1 },
+    { 47163, 10077, 0, 8, 1 },
+    { 47171, 10077, 0, 7, 1 },
+    { 47178, 10077, 0, 6, 1 },
+    { 43635, 10077, 0, 4, 1 },
+    { 47184, 10077, 0, 7, 1 },
+    { 47191, 10077, 0, 4, 1 },
+    { 47195, 10077, 0, 7, 1 },
+    { 47202, 10077, 0, 13, 1 },
+    { 47215, 10077, 0, 5, 1 },
+    { 47220, 10077, 0, 11, 1 },
+    { 47231, 10077, 0, 6, 1 },
+    { 47237, 10077, 0, 8, 1 },
+    { 47245, 10077, 0, 4, 1 },
+    { 47249, 10077, 0, 6, 1 },
+    { 44382, 10077, 0, 6, 1 },
+    { 47255, 10077, 0, 7, 1 },
+    { 47262, 10077, 0, 13, 1 },
+    { 47275, 10077, 0, 7, 1 },
+    { 47282, 10077, 0, 8, 1 },
+    { 47290, 10077, 0, 5, 1 },
+    { 47295, 10077, 0, 8, 1 },
+    { 47303, 10077, 0, 6, 1 },
+    { 47309, 10077, 0, 8, 1 },
+    { 47317, 10077, 0, 6, 1 },
+    { 47323, 10077, 0, 7, 1 },
+    { 47330, 10077, 0, 9, 1 },
+    { 47339, 10077, 0, 7, 1 },
+    { 47346, 10077, 0, 8, 1 },
+    { 47354, 10077, 0, 5, 1 },
+    { 47359, 10077, 0, 8, 1 },
+    { 47367, 10077, 0, 5, 1 },
+    { 47372, 10077, 0, 5, 1 },
+    { 47377, 10077, 0, 5, 1 },
+    { 41014, 10077, 0, 3, 1 },
+    { 47382, 10077, 0, 4, 1 },
+    { 47386, 10077, 0, 5, 1 },
+    { 22709, 10077, 0, 9, 1 },
+    { 47391, 10077, 0, 6, 1 },
+    { 47397, 10077, 0, 8, 1 },
+    { 47405, 10077, 0, 5, 1 },
+    { 47410, 10077, 0, 7, 1 },
+    { 47417, 10077, 0, 10, 1 },
+    { 47427, 10077, 0, 9, 1 },
+    { 47436, 10077, 0, 10, 1 },
+    { 47446, 10077, 0, 8, 1 },
+    { 47454, 10077, 0, 12, 1 },
+    { 47466, 10077, 0, 13, 1 },
+    { 47479, 10077, 0, 3, 1 },
+    { 47482, 10077, 0, 8, 1 },
+    { 47490, 10077, 0, 5, 1 },
+    { 47495, 10077, 0, 6, 1 },
+    { 47501, 10077, 0, 6, 1 },
+    { 47507, 10077, 0, 5, 1 },
+    { 47512, 10077, 0, 9, 1 },
+    { 47521, 10077, 0, 5, 1 },
+    { 47050, 10077, 0, 8, 1 },
+    { 47526, 10077, 0, 6, 1 },
+    { 47532, 10077, 0, 6, 1 },
+    { 47538, 10077, 0, 9, 1 },
+    { 47547, 10077, 0, 7, 1 },
+    { 47554, 10077, 0, 6, 1 },
+    { 47560, 10077, 0, 8, 1 },
+    { 47568, 10077, 0, 8, 1 },
+    { 47576, 10077, 0, 7, 1 },
+    { 47583, 10077, 0, 14, 1 },
+    { 47597, 10077, 0, 5, 1 },
+    { 47602, 10077, 0, 5, 1 },
+    { 47607, 10077, 0, 8, 1 },
+    { 47615, 10077, 0, 7, 1 },
+    { 47622, 10077, 0, 2, 1 },
+    { 47624, 10077, 0, 4, 1 },
+    { 47628, 10077, 0, 10, 1 },
+    { 47638, 10077, 0, 8, 1 },
+    { 47646, 10077, 0, 6, 1 },
+    { 47652, 10077, 0, 8, 1 },
+    { 44712, 10077, 0, 6, 1 },
+    { 47660, 10077, 0, 8, 1 },
+    { 47668, 10077, 0, 8, 1 },
+    { 47676, 10077, 0, 4, 1 },
+    { 47680, 10077, 0, 5, 1 },
+    { 1231, 10077, 0, 4, 4 },
+    { 1231, 10077, 0, 4, 4 },
+    { 1231, 10077, 0, 4, 4 },
+    { 47685, 10077, 0, 3, 1 },
+    { 47688, 10077, 0, 6, 1 },
+    { 45575, 10077, 0, 6, 1 },
+    { 47694, 10077, 0, 12, 1 },
+    { 47706, 10077, 0, 3, 1 },
+    { 47709, 10077, 0, 6, 1 },
+    { 47715, 10077, 0, 4, 1 },
+    { 47719, 10077, 0, 8, 1 },
+    { 22774, 10077, 0, 5, 1 },
+    { 45301, 10077, 0, 6, 1 },
+    { 47727, 10077, 0, 8, 1 },
+    { 47735, 10077, 0, 6, 1 },
+    { 47741, 10077, 0, 6, 1 },
+    { 47747, 10077, 0, 8, 1 },
+    { 47755, 10077, 0, 7, 1 },
+    { 47762, 10077, 0, 9, 1 },
+    { 47771, 10077, 0, 10, 1 },
+    { 47781, 10077, 0, 4, 1 },
+    { 44259, 10077, 0, 5, 1 },
+    { 47785, 10077, 0, 5, 1 },
+    { 47790, 10077, 0, 6, 1 },
+    { 47796, 10077, 0, 6, 1 },
+    { 47802, 10077, 0, 6, 1 },
+    { 47808, 10077, 0, 6, 1 },
+    { 47814, 10077, 0, 4, 1 },
+    { 47818, 10077, 0, 11, 1 },
+    { 47829, 10077, 0, 4, 1 },
+    { 47833, 10077, 0, 5, 1 },
+    { 47838, 10077, 0, 5, 1 },
+    { 47843, 10077, 0, 6, 1 },
+    { 47849, 10077, 0, 8, 1 },
+    { 47857, 10077, 0, 7, 1 },
+    { 47864, 10077, 0, 4, 1 },
+    { 47868, 10077, 0, 3, 1 },
+    { 47871, 10077, 0, 5, 1 },
+    { 47876, 10077, 0, 7, 1 },
+    { 47883, 10077, 0, 11, 1 },
+    { 47894, 10077, 0, 7, 1 },
+    { 22779, 10077, 0, 8, 1 },
+    { 47901, 10077, 0, 7, 1 },
+    { 47908, 10077, 0, 6, 1 },
+    { 47914, 10077, 0, 8, 1 },
+    { 47922, 10077, 0, 11, 1 },
+    { 47933, 10077, 0, 6, 1 },
+    { 47939, 10077, 0, 9, 1 },
+    { 47948, 10077, 0, 5, 1 },
+    { 43893, 10077, 0, 3, 1 },
+    { 46566, 10077, 0, 6, 1 },
+    { 47953, 10077, 0, 8, 1 },
+    { 47961, 10077, 0, 3, 1 },
+    { 47964, 10077, 0, 3, 1 },
+    { 47967, 10077, 0, 6, 1 },
+    { 44712, 10077, 0, 6, 1 },
+    { 47973, 10077, 0, 10, 1 },
+    { 47983, 10077, 0, 5, 1 },
+    { 47988, 10077, 0, 11, 1 },
+    { 47999, 10077, 0, 11, 1 },
+    { 48010, 10077, 0, 3, 1 },
+    { 48013, 10077, 0, 3, 1 },
+    { 48016, 10077, 0, 4, 1 },
+    { 48020, 10077, 0, 7, 1 },
+    { 48027, 10077, 0, 4, 1 },
+    { 48031, 10077, 0, 4, 1 },
+    { 48035, 10077, 0, 4, 1 },
+    { 48039, 10077, 0, 8, 1 },
+    { 48047, 10077, 0, 8, 1 },
+    { 48055, 10077, 0, 9, 1 },
+    { 48064, 10077, 0, 8, 1 },
+    { 48072, 10077, 0, 7, 1 },
+    { 44180, 10077, 0, 6, 1 },
+    { 48079, 10077, 0, 15, 1 },
+    { 48094, 10077, 0, 6, 1 },
+    { 48100, 10077, 0, 4, 1 },
+    { 48104, 10077, 0, 10, 1 },
+    { 48114, 10077, 0, 7, 1 },
+    { 48121, 10077, 0, 6, 1 },
+    { 48127, 10077, 0, 9, 1 },
+    { 48136, 10077, 0, 5, 1 },
+    { 48141, 10077, 0, 5, 1 },
+    { 48146, 10077, 0, 6, 1 },
+    { 48152, 10077, 0, 3, 1 },
+    { 48155, 10077, 0, 9, 1 },
+    { 48164, 10077, 0, 6, 1 },
+    { 48170, 10077, 0, 9, 1 },
+    { 48179, 10077, 0, 6, 1 },
+    { 43416, 10077, 0, 5, 1 },
+    { 48185, 10077, 0, 5, 1 },
+    { 48190, 10077, 0, 3, 1 },
+    { 48193, 10077, 0, 8, 1 },
+    { 48201, 10077, 0, 7, 1 },
+    { 48208, 10077, 0, 4, 1 },
+    { 48212, 10077, 0, 8, 1 },
+    { 48220, 10077, 0, 4, 1 },
+    { 48224, 10077, 0, 6, 1 },
+    { 45291, 10077, 0, 6, 1 },
+    { 48230, 10077, 0, 6, 1 },
+    { 48236, 10077, 0, 9, 1 },
+    { 45062, 10077, 0, 5, 1 },
+    { 42903, 10077, 0, 6, 1 },
+    { 48245, 10077, 0, 9, 1 },
+    { 48254, 10077, 0, 6, 1 },
+    { 44192, 10077, 0, 6, 1 },
+    { 48260, 10077, 0, 6, 1 },
+    { 48266, 10077, 0, 5, 1 },
+    { 48271, 10077, 0, 6, 1 },
+    { 48277, 10077, 0, 4, 1 },
+    { 46229, 10077, 0, 5, 1 },
+    { 48281, 10077, 0, 4, 1 },
+    { 48285, 10077, 0, 6, 1 },
+    { 48291, 10077, 0, 4, 1 },
+    { 48295, 10077, 0, 3, 1 },
+    { 48298, 10077, 0, 5, 1 },
+    { 48303, 10077, 0, 8, 1 },
+    { 48311, 10077, 0, 7, 1 },
+    { 48318, 10077, 0, 9, 1 },
+    { 48327, 10077, 0, 8, 1 },
+    { 48335, 10077, 0, 17, 1 },
+    { 48352, 10077, 0, 10, 1 },
+    { 48362, 10077, 0, 7, 1 },
+    { 48369, 10077, 0, 6, 1 },
+    { 47715, 10077, 0, 4, 1 },
+    { 22736, 10077, 0, 8, 1 },
+    { 48375, 10077, 0, 8, 1 },
+    { 48383, 10077, 0, 10, 1 },
+    { 48393, 10077, 0, 13, 1 },
+    { 43192, 10077, 0, 6, 1 },
+    { 48406, 10077, 0, 6, 1 },
+    { 48412, 10077, 0, 6, 1 },
+    { 48418, 10077, 0, 7, 1 },
+    { 48425, 10077, 0, 5, 1 },
+    { 48430, 10077, 0, 7, 1 },
+    { 48437, 10077, 0, 5, 1 },
+    { 48442, 10077, 0, 4, 1 },
+    { 48446, 10077, 0, 6, 1 },
+    { 48452, 10077, 0, 7, 1 },
+    { 48459, 10077, 0, 13, 1 },
+    { 48472, 10077, 0, 7, 1 },
+    { 48479, 10077, 0, 8, 1 },
+    { 48487, 10077, 0, 9, 1 },
+    { 48496, 10077, 0, 6, 1 },
+    { 48502, 10077, 0, 5, 1 },
+    { 48507, 10077, 0, 4, 1 },
+    { 48511, 10077, 0, 6, 1 },
+    { 48517, 10077, 0, 6, 1 },
+    { 48523, 10077, 0, 6, 1 },
+    { 48529, 10077, 0, 8, 1 },
+    { 48537, 10077, 0, 3, 1 },
+    { 48540, 10077, 0, 3, 1 },
+    { 48543, 10077, 0, 5, 1 },
+    { 48548, 10077, 0, 6, 1 },
+    { 48554, 10077, 0, 5, 1 },
+    { 48559, 10077, 0, 8, 1 },
+    { 48567, 10077, 0, 10, 1 },
+    { 48577, 10077, 0, 4, 1 },
+    { 47719, 10077, 0, 8, 1 },
+    { 44542, 10077, 0, 8, 1 },
+    { 48581, 10077, 0, 7, 1 },
+    { 48588, 10077, 0, 9, 1 },
+    { 48597, 10077, 0, 8, 1 },
+    { 48605, 10077, 0, 7, 1 },
+    { 48612, 10077, 0, 6, 1 },
+    { 48618, 10077, 0, 10, 1 },
+    { 22855, 10077, 0, 8, 1 },
+    { 48628, 10077, 0, 9, 1 },
+    { 48637, 10077, 0, 8, 1 },
+    { 48645, 10077, 0, 9, 1 },
+    { 48654, 10077, 0, 7, 1 },
+    { 48661, 10077, 0, 5, 1 },
+    { 48666, 10077, 0, 6, 1 },
+    { 48672, 10077, 0, 8, 1 },
+    { 48680, 10077, 0, 8, 1 },
+    { 48688, 10077, 0, 8, 1 },
+    { 48696, 10077, 0, 8, 1 },
+    { 47833, 10077, 0, 5, 1 },
+    { 48704, 10077, 0, 4, 1 },
+    { 48708, 10077, 0, 8, 1 },
+    { 48716, 10077, 0, 4, 1 },
+    { 48720, 10077, 0, 4, 1 },
+    { 43416, 10077, 0, 5, 1 },
+    { 48724, 10077, 0, 7, 1 },
+    { 48731, 10077, 0, 9, 1 },
+    { 48740, 10077, 0, 7, 1 },
+    { 48747, 10077, 0, 5, 1 },
+    { 48752, 10077, 0, 6, 1 },
+    { 48758, 10077, 0, 6, 1 },
+    { 48764, 10077, 0, 4, 1 },
+    { 48768, 10077, 0, 6, 1 },
+    { 48774, 10077, 0, 4, 1 },
+    { 48778, 10077, 0, 6, 1 },
+    { 48784, 10077, 0, 6, 1 },
+    { 48790, 10077, 0, 6, 1 },
+    { 43962, 10077, 0, 5, 1 },
+    { 48796, 10077, 0, 7, 1 },
+    { 46709, 10077, 0, 3, 1 },
+    { 48803, 10077, 0, 9, 1 },
+    { 48812, 10077, 0, 8, 1 },
+    { 48820, 10077, 0, 4, 1 },
+    { 48824, 10077, 0, 13, 1 },
+    { 48837, 10077, 0, 8, 1 },
+    { 48845, 10077, 0, 8, 1 },
+    { 48853, 10077, 0, 6, 1 },
+    { 48859, 10077, 0, 9, 1 },
+    { 47427, 10077, 0, 9, 1 },
+    { 48868, 10077, 0, 5, 1 },
+    { 48873, 10077, 0, 10, 1 },
+    { 48883, 10077, 0, 10, 1 },
+    { 48893, 10077, 0, 12, 1 },
+    { 48905, 10077, 0, 6, 1 },
+    { 48911, 10077, 0, 6, 1 },
+    { 48917, 10077, 0, 6, 1 },
+    { 48923, 10077, 0, 9, 1 },
+    { 22883, 10077, 0, 6, 1 },
+    { 48932, 10077, 0, 6, 1 },
+    { 48938, 10077, 0, 6, 1 },
+    { 44222, 10077, 0, 8, 1 },
+    { 48944, 10077, 0, 6, 1 },
+    { 48950, 10077, 0, 11, 1 },
+    { 48961, 10077, 0, 5, 1 },
+    { 46791, 10077, 0, 5, 1 },
+    { 48966, 10077, 0, 5, 1 },
+    { 48971, 10077, 0, 6, 1 },
+    { 48977, 10077, 0, 3, 1 },
+    { 48980, 10077, 0, 6, 1 },
+    { 48986, 10077, 0, 7, 1 },
+    { 43665, 10077, 0, 5, 1 },
+    { 48993, 10077, 0, 5, 1 },
+    { 43670, 10077, 0, 5, 1 },
+    { 48998, 10077, 0, 6, 1 },
+    { 49004, 10077, 0, 4, 1 },
+    { 49008, 10077, 0, 6, 1 },
+    { 49014, 10077, 0, 9, 1 },
+    { 49023, 10077, 0, 12, 1 },
+    { 49035, 10077, 0, 8, 1 },
+    { 49043, 10077, 0, 4, 1 },
+    { 49047, 10077, 0, 6, 1 },
+    { 49053, 10077, 0, 6, 1 },
+    { 47953, 10077, 0, 8, 1 },
+    { 44927, 10077, 0, 8, 1 },
+    { 49059, 10077, 0, 9, 1 },
+    { 46611, 10077, 0, 7, 1 },
+    { 49068, 10077, 0, 9, 1 },
+    { 49077, 10077, 0, 6, 1 },
+    { 49083, 10077, 0, 4, 1 },
+    { 49087, 10077, 0, 4, 1 },
+    { 49091, 10077, 0, 4, 1 },
+    { 23760, 10077, 0, 8, 1 },
+    { 49095, 10077, 0, 10, 1 },
+    { 49105, 10077, 0, 6, 1 },
+    { 49111, 10077, 0, 7, 1 },
+    { 49118, 10077, 0, 7, 1 },
+    { 49125, 10077, 0, 5, 1 },
+    { 49130, 10077, 0, 4, 1 },
+    { 49134, 10077, 0, 6, 1 },
+    { 49140, 10077, 0, 6, 1 },
+    { 17342, 10077, 0, 3, 1 },
+    { 49146, 10077, 0, 7, 1 },
+    { 49153, 10077, 0, 8, 1 },
+    { 49161, 10077, 0, 10, 1 },
+    { 49171, 10077, 0, 8, 1 },
+    { 22889, 10077, 0, 8, 1 },
+    { 43989, 10077, 0, 5, 1 },
+    { 49179, 10077, 0, 5, 1 },
+    { 49184, 10077, 0, 5, 1 },
+    { 49189, 10077, 0, 6, 1 },
+    { 49195, 10077, 0, 6, 1 },
+    { 49201, 10077, 0, 5, 1 },
+    { 49206, 10077, 0, 9, 1 },
+    { 49215, 10077, 0, 12, 1 },
+    { 49227, 10077, 0, 7, 1 },
+    { 43062, 10077, 0, 8, 1 },
+    { 49234, 10077, 0, 5, 1 },
+    { 1231, 10077, 0, 4, 4 },
+    { 49239, 10077, 0, 4, 1 },
+    { 49243, 10077, 0, 4, 1 },
+    { 49247, 10077, 0, 6, 1 },
+    { 49253, 10077, 0, 14, 1 },
+    { 49267, 10077, 0, 7, 1 },
+    { 49274, 10077, 0, 5, 1 },
+    { 49279, 10077, 0, 12, 1 },
+    { 49291, 10077, 0, 7, 1 },
+    { 49298, 10077, 0, 7, 1 },
+    { 49305, 10077, 0, 9, 1 },
+    { 49314, 10077, 0, 9, 1 },
+    { 47132, 10077, 0, 5, 1 },
+    { 48812, 10077, 0, 8, 1 },
+    { 46485, 10077, 0, 9, 1 },
+    { 49323, 10077, 0, 5, 1 },
+    { 49328, 10077, 0, 8, 1 },
+    { 49336, 10077, 0, 6, 1 },
+    { 49342, 10077, 0, 6, 1 },
+    { 22904, 10077, 0, 4, 1 },
+    { 49348, 10077, 0, 8, 1 },
+    { 49356, 10077, 0, 3, 1 },
+    { 49359, 10077, 0, 4, 1 },
+    { 49363, 10077, 0, 5, 1 },
+    { 49368, 10077, 0, 7, 1 },
+    { 49375, 10077, 0, 5, 1 },
+    { 49380, 10077, 0, 9, 1 },
+    { 49389, 10077, 0, 13, 1 },
+    { 49402, 10077, 0, 6, 1 },
+    { 49408, 10077, 0, 4, 1 },
+    { 49412, 10077, 0, 8, 1 },
+    { 49420, 10077, 0, 10, 1 },
+    { 49430, 10077, 0, 7, 1 },
+    { 49437, 10077, 0, 5, 1 },
+    { 49442, 10077, 0, 3, 1 },
+    { 49445, 10077, 0, 14, 1 },
+    { 49459, 10077, 0, 12, 1 },
+    { 49471, 10077, 0, 7, 1 },
+    { 49478, 10077, 0, 7, 1 },
+    { 49485, 10077, 1, 7, 0 },
+    { 49492, 10078, 0, 6, 1 },
+    { 49498, 10078, 0, 3, 1 },
+    { 49501, 10078, 0, 5, 1 },
+    { 49506, 10078, 0, 5, 1 },
+    { 49511, 10078, 0, 8, 1 },
+    { 49519, 10078, 0, 9, 1 },
+    { 49528, 10078, 0, 6, 1 },
+    { 48027, 10078, 0, 4, 1 },
+    { 49534, 10078, 0, 6, 1 },
+    { 49540, 10078, 0, 11, 1 },
+    { 49551, 10078, 0, 12, 1 },
+    { 49563, 10078, 0, 7, 1 },
+    { 49570, 10078, 0, 5, 1 },
+    { 49575, 10078, 0, 8, 1 },
+    { 49583, 10078, 0, 5, 1 },
+    { 49588, 10078, 0, 7, 1 },
+    { 22908, 10078, 0, 7, 1 },
+    { 49595, 10078, 0, 5, 1 },
+    { 48977, 10078, 0, 3, 1 },
+    { 49600, 10078, 0, 4, 1 },
+    { 49604, 10078, 0, 5, 1 },
+    { 49609, 10078, 0, 5, 1 },
+    { 49614, 10078, 0, 6, 1 },
+    { 49620, 10078, 0, 8, 1 },
+    { 48452, 10078, 0, 7, 1 },
+    { 49628, 10078, 0, 6, 1 },
+    { 49634, 10078, 0, 6, 1 },
+    { 49640, 10078, 0, 6, 1 },
+    { 49646, 10078, 0, 9, 1 },
+    { 49655, 10078, 0, 7, 1 },
+    { 49662, 10078, 0, 6, 1 },
+    { 49668, 10078, 0, 6, 1 },
+    { 49674, 10078, 0, 6, 1 },
+    { 49680, 10078, 0, 5, 1 },
+    { 49685, 10078, 0, 6, 1 },
+    { 49691, 10078, 0, 5, 1 },
+    { 49696, 10078, 0, 8, 1 },
+    { 49704, 10078, 0, 11, 1 },
+    { 49715, 10078, 0, 6, 1 },
+    { 49721, 10078, 0, 4, 1 },
+    { 49725, 10078, 0, 9, 1 },
+    { 49734, 10078, 0, 4, 1 },
+    { 49738, 10078, 0, 8, 1 },
+    { 49746, 10078, 0, 7, 1 },
+    { 49753, 10078, 0, 4, 1 },
+    { 49757, 10078, 0, 8, 1 },
+    { 49765, 10078, 0, 4, 1 },
+    { 22932, 10078, 0, 4, 1 },
+    { 49769, 10078, 0, 5, 1 },
+    { 49774, 10078, 0, 6, 1 },
+    { 49780, 10078, 0, 7, 1 },
+    { 28332, 10078, 0, 3, 1 },
+    { 49787, 10078, 0, 5, 1 },
+    { 49792, 10078, 0, 4, 1 },
+    { 49796, 10078, 0, 6, 1 },
+    { 49802, 10078, 0, 8, 1 },
+    { 49810, 10078, 0, 5, 1 },
+    { 49815, 10078, 0, 9, 1 },
+    { 49824, 10078, 0, 5, 1 },
+    { 49829, 10078, 0, 8, 1 },
+    { 49837, 10078, 0, 7, 1 },
+    { 49844, 10078, 0, 8, 1 },
+    { 49852, 10078, 0, 7, 1 },
+    { 49859, 10078, 0, 9, 1 },
+    { 49868, 10078, 0, 6, 1 },
+    { 49874, 10078, 0, 6, 1 },
+    { 49880, 10078, 0, 4, 1 },
+    { 49884, 10078, 0, 5, 1 },
+    { 49889, 10078, 0, 12, 1 },
+    { 22936, 10078, 0, 7, 1 },
+    { 49901, 10078, 0, 7, 1 },
+    { 49908, 10078, 0, 8, 1 },
+    { 49402, 10078, 0, 6, 1 },
+    { 49916, 10078, 0, 4, 1 },
+    { 49920, 10078, 0, 4, 1 },
+    { 49924, 10078, 0, 9, 1 },
+    { 49933, 10078, 0, 6, 1 },
+    { 49939, 10078, 0, 7, 1 },
+    { 49946, 10078, 0, 4, 1 },
+    { 49950, 10078, 0, 6, 1 },
+    { 49956, 10078, 0, 5, 1 },
+    { 49961, 10078, 0, 7, 1 },
+    { 49968, 10078, 0, 6, 1 },
+    { 49974, 10078, 0, 9, 1 },
+    { 49983, 10078, 0, 7, 1 },
+    { 44093, 10078, 0, 7, 1 },
+    { 49990, 10078, 0, 6, 1 },
+    { 49996, 10078, 0, 5, 1 },
+    { 50001, 10078, 0, 8, 1 },
+    { 22676, 10078, 0, 8, 1 },
+    { 50009, 10078, 0, 6, 1 },
+    { 50015, 10078, 0, 5, 1 },
+    { 50020, 10078, 0, 6, 1 },
+    { 50026, 10078, 0, 3, 1 },
+    { 50029, 10078, 0, 9, 1 },
+    { 50038, 10078, 0, 14, 1 },
+    { 50052, 10078, 0, 8, 1 },
+    { 50060, 10078, 0, 8, 1 },
+    { 50068, 10078, 0, 11, 1 },
+    { 50079, 10078, 0, 6, 1 },
+    { 50085, 10078, 0, 4, 1 },
+    { 50089, 10078, 0, 4, 1 },
+    { 50093, 10078, 0, 10, 1 },
+    { 50103, 10078, 0, 7, 1 },
+    { 50110, 10078, 0, 5, 1 },
+    { 47939, 10078, 0, 9, 1 },
+    { 50115, 10078, 0, 5, 1 },
+    { 4299, 10078, 0, 7, 1 },
+    { 50120, 10078, 0, 4, 1 },
+    { 50124, 10078, 0, 7, 1 },
+    { 50131, 10078, 0, 8, 1 },
+    { 50139, 10078, 0, 6, 1 },
+    { 50145, 10078, 0, 9, 1 },
+    { 50154, 10078, 0, 10, 1 },
+    { 50164, 10078, 0, 6, 1 },
+    { 50170, 10078, 0, 6, 1 },
+    { 50176, 10078, 0, 5, 1 },
+    { 50181, 10078, 0, 5, 1 },
+    { 50186, 10078, 0, 7, 1 },
+    { 50193, 10078, 0, 8, 1 },
+    { 50201, 10078, 0, 8, 1 },
+    { 50209, 10078, 0, 6, 1 },
+    { 50215, 10078, 0, 5, 1 },
+    { 50220, 10078, 0, 14, 1 },
+    { 43439, 10078, 0, 4, 1 },
+    { 50234, 10078, 0, 5, 1 },
+    { 50239, 10078, 0, 9, 1 },
+    { 50248, 10078, 0, 8, 1 },
+    { 50256, 10078, 0, 6, 1 },
+    { 50262, 10078, 0, 12, 1 },
+    { 50274, 10078, 0, 16, 1 },
+    { 50290, 10078, 0, 15, 1 },
+    { 50305, 10078, 0, 8, 1 },
+    { 22663, 10078, 0, 7, 1 },
+    { 43962, 10078, 0, 5, 1 },
+    { 47386, 10078, 0, 5, 1 },
+    { 50313, 10078, 0, 9, 1 },
+    { 50322, 10078, 0, 9, 1 },
+    { 50331, 10078, 0, 6, 1 },
+    { 50337, 10078, 0, 7, 1 },
+    { 50344, 10078, 0, 5, 1 },
+    { 50349, 10078, 0, 9, 1 },
+    { 50358, 10078, 0, 6, 1 },
+    { 50364, 10078, 0, 13, 1 },
+    { 50377, 10078, 0, 9, 1 },
+    { 48031, 10078, 0, 4, 1 },
+    { 50386, 10078, 0, 8, 1 },
+    { 50394, 10078, 0, 9, 1 },
+    { 50403, 10078, 0, 6, 1 },
+    { 50409, 10078, 0, 5, 1 },
+    { 49874, 10078, 0, 6, 1 },
+    { 50414, 10078, 0, 9, 1 },
+    { 50423, 10078, 0, 8, 1 },
+    { 44236, 10078, 0, 5, 1 },
+    { 50431, 10078, 0, 4, 1 },
+    { 50435, 10078, 0, 11, 1 },
+    { 44005, 10078, 0, 5, 1 },
+    { 50446, 10078, 0, 6, 1 },
+    { 50452, 10078, 0, 6, 1 },
+    { 50458, 10078, 0, 6, 1 },
+    { 50464, 10078, 0, 11, 1 },
+    { 50475, 10078, 0, 9, 1 },
+    { 50484, 10078, 0, 5, 1 },
+    { 50489, 10078, 0, 7, 1 },
+    { 46572, 10078, 0, 6, 1 },
+    { 50496, 10078, 0, 6, 1 },
+    { 50502, 10078, 0, 8, 1 },
+    { 50510, 10078, 0, 9, 1 },
+    { 50519, 10078, 0, 12, 1 },
+    { 50531, 10078, 0, 8, 1 },
+    { 50539, 10078, 0, 6, 1 },
+    { 50545, 10078, 0, 3, 1 },
+    { 50548, 10078, 0, 6, 1 },
+    { 50554, 10078, 0, 5, 1 },
+    { 50559, 10078, 0, 8, 1 },
+    { 50567, 10078, 0, 6, 1 },
+    { 50573, 10078, 0, 8, 1 },
+    { 50581, 10078, 0, 5, 1 },
+    { 50586, 10078, 0, 5, 1 },
+    { 50591, 10078, 0, 8, 1 },
+    { 50599, 10078, 0, 7, 1 },
+    { 50606, 10078, 0, 7, 1 },
+    { 46746, 10078, 0, 7, 1 },
+    { 44843, 10078, 0, 8, 1 },
+    { 50613, 10078, 0, 8, 1 },
+    { 50621, 10078, 0, 6, 1 },
+    { 50627, 10078, 0, 7, 1 },
+    { 50634, 10078, 0, 7, 1 },
+    { 50641, 10078, 0, 10, 1 },
+    { 50651, 10078, 0, 3, 1 },
+    { 48971, 10078, 0, 6, 1 },
+    { 50654, 10078, 0, 5, 1 },
+    { 23047, 10078, 0, 4, 1 },
+    { 48487, 10078, 0, 9, 1 },
+    { 50659, 10078, 0, 4, 1 },
+    { 50663, 10078, 0, 4, 1 },
+    { 50667, 10078, 0, 4, 1 },
+    { 50671, 10078, 0, 11, 1 },
+    { 50682, 10078, 0, 7, 1 },
+    { 50689, 10078, 0, 5, 1 },
+    { 50694, 10078, 0, 8, 1 },
+    { 48752, 10078, 0, 6, 1 },
+    { 50702, 10078, 0, 8, 1 },
+    { 50710, 10078, 0, 6, 1 },
+    { 50716, 10078, 0, 5, 1 },
+    { 50721, 10078, 0, 5, 1 },
+    { 50726, 10078, 0, 6, 1 },
+    { 50732, 10078, 0, 8, 1 },
+    { 50740, 10078, 0, 8, 1 },
+    { 45575, 10078, 0, 6, 1 },
+    { 50748, 10078, 0, 15, 1 },
+    { 50763, 10078, 0, 16, 1 },
+    { 43126, 10078, 0, 5, 1 },
+    { 46709, 10078, 0, 3, 1 },
+    { 50779, 10078, 0, 5, 1 },
+    { 50784, 10078, 0, 8, 1 },
+    { 50792, 10078, 0, 9, 1 },
+    { 45688, 10078, 0, 8, 1 },
+    { 50801, 10078, 0, 8, 1 },
+    { 50809, 10078, 0, 8, 1 },
+    { 48201, 10078, 0, 7, 1 },
+    { 50817, 10078, 0, 9, 1 },
+    { 50826, 10078, 0, 8, 1 },
+    { 50834, 10078, 0, 4, 1 },
+    { 50838, 10078, 0, 8, 1 },
+    { 50846, 10078, 0, 9, 1 },
+    { 50855, 10078, 0, 7, 1 },
+    { 50862, 10078, 0, 4, 1 },
+    { 50866, 10078, 0, 8, 1 },
+    { 50874, 10078, 0, 10, 1 },
+    { 50884, 10078, 0, 6, 1 },
+    { 43192, 10078, 0, 6, 1 },
+    { 50890, 10078, 0, 9, 1 },
+    { 42909, 10078, 0, 7, 1 },
+    { 50899, 10078, 0, 8, 1 },
+    { 50907, 10078, 0, 8, 1 },
+    { 50915, 10078, 0, 8, 1 },
+    { 50923, 10078, 0, 5, 1 },
+    { 50928, 10078, 0, 5, 1 },
+    { 46791, 10078, 0, 5, 1 },
+    { 50933, 10078, 0, 5, 1 },
+    { 50938, 10078, 0, 7, 1 },
+    { 50945, 10078, 0, 5, 1 },
+    { 43665, 10078, 0, 5, 1 },
+    { 50950, 10078, 0, 6, 1 },
+    { 50956, 10078, 0, 7, 1 },
+    { 23051, 10078, 0, 7, 1 },
+    { 50963, 10078, 0, 6, 1 },
+    { 50969, 10078, 0, 5, 1 },
+    { 50446, 10078, 0, 6, 1 },
+    { 50974, 10078, 0, 5, 1 },
+    { 50979, 10078, 0, 8, 1 },
+    { 50987, 10078, 0, 4, 1 },
+    { 50991, 10078, 0, 6, 1 },
+    { 50997, 10078, 0, 4, 1 },
+    { 51001, 10078, 0, 8, 1 },
+    { 51009, 10078, 0, 10, 1 },
+    { 51019, 10078, 0, 12, 1 },
+    { 51031, 10078, 0, 5, 1 },
+    { 51036, 10078, 0, 6, 1 },
+    { 51042, 10078, 0, 6, 1 },
+    { 51048, 10078, 0, 6, 1 },
+    { 51054, 10078, 0, 4, 1 },
+    { 51058, 10078, 0, 5, 1 },
+    { 51063, 10078, 0, 7, 1 },
+    { 51070, 10078, 0, 9, 1 },
+    { 51079, 10078, 0, 7, 1 },
+    { 1231, 10078, 0, 4, 4 },
+    { 1231, 10078, 0, 4, 4 },
+    { 51086, 10078, 0, 5, 1 },
+    { 51091, 10078, 0, 4, 1 },
+    { 51095, 10078, 0, 10, 1 },
+    { 51105, 10078, 0, 6, 1 },
+    { 51111, 10078, 0, 4, 1 },
+    { 42894, 10078, 0, 5, 1 },
+    { 51115, 10078, 0, 5, 1 },
+    { 51120, 10078, 0, 4, 1 },
+    { 45047, 10078, 0, 7, 1 },
+    { 51124, 10078, 0, 7, 1 },
+    { 51131, 10078, 0, 8, 1 },
+    { 51139, 10078, 0, 8, 1 },
+    { 51147, 10078, 0, 9, 1 },
+    { 51156, 10078, 0, 8, 1 },
+    { 51164, 10078, 0, 11, 1 },
+    { 51175, 10078, 0, 4, 1 },
+    { 51179, 10078, 0, 5, 1 },
+    { 51184, 10078, 0, 5, 1 },
+    { 51189, 10078, 0, 9, 1 },
+    { 50510, 10078, 0, 9, 1 },
+    { 51198, 10078, 0, 8, 1 },
+    { 51206, 10078, 0, 8, 1 },
+    { 51214, 10078, 0, 4, 1 },
+    { 51218, 10078, 0, 5, 1 },
+    { 42761, 10078, 0, 3, 1 },
+    { 51223, 10078, 0, 5, 1 },
+    { 51228, 10078, 0, 6, 1 },
+    { 51234, 10078, 0, 12, 1 },
+    { 51246, 10078, 0, 6, 1 },
+    { 51252, 10078, 0, 6, 1 },
+    { 51258, 10078, 0, 5, 1 },
+    { 51263, 10078, 0, 8, 1 },
+    { 51271, 10078, 0, 6, 1 },
+    { 51277, 10078, 0, 6, 1 },
+    { 43192, 10078, 0, 6, 1 },
+    { 51283, 10078, 0, 12, 1 },
+    { 51295, 10078, 0, 4, 1 },
+    { 51299, 10078, 0, 10, 1 },
+    { 51309, 10078, 0, 8, 1 },
+    { 23091, 10078, 0, 7, 1 },
+    { 51317, 10078, 0, 6, 1 },
+    { 51323, 10078, 0, 7, 1 },
+    { 51330, 10078, 0, 5, 1 },
+    { 46375, 10078, 0, 6, 1 },
+    { 51335, 10078, 0, 6, 1 },
+    { 51341, 10078, 0, 7, 1 },
+    { 51348, 10078, 0, 4, 1 },
+    { 51352, 10078, 0, 5, 1 },
+    { 51357, 10078, 0, 4, 1 },
+    { 51361, 10078, 0, 7, 1 },
+    { 51368, 10078, 0, 8, 1 },
+    { 51376, 10078, 0, 10, 1 },
+    { 51386, 10078, 0, 7, 1 },
+    { 51393, 10078, 0, 7, 1 },
+    { 51400, 10078, 0, 7, 1 },
+    { 51407, 10078, 0, 9, 1 },
+    { 51416, 10078, 0, 10, 1 },
+    { 51426, 10078, 0, 3, 1 },
+    { 51429, 10078, 0, 5, 1 },
+    { 51434, 10078, 0, 3, 1 },
+    { 51437, 10078, 0, 9, 1 },
+    { 51446, 10078, 0, 8, 1 },
+    { 51454, 10078, 0, 7, 1 },
+    { 51461, 10078, 0, 9, 1 },
+    { 51470, 10078, 0, 6, 1 },
+    { 51476, 10078, 0, 8, 1 },
+    { 51484, 10078, 0, 5, 1 },
+    { 51489, 10078, 0, 10, 1 },
+    { 51499, 10078, 0, 9, 1 },
+    { 51508, 10078, 0, 9, 1 },
+    { 44587, 10078, 0, 7, 1 },
+    { 51517, 10078, 0, 9, 1 },
+    { 51526, 10078, 0, 8, 1 },
+    { 51534, 10078, 0, 6, 1 },
+    { 51540, 10078, 0, 8, 1 },
+    { 51548, 10078, 0, 7, 1 },
+    { 46153, 10078, 0, 7, 1 },
+    { 51555, 10078, 0, 7, 1 },
+    { 23098, 10078, 0, 8, 1 },
+    { 51562, 10078, 0, 6, 1 },
+    { 51568, 10078, 0, 5, 1 },
+    { 51063, 10078, 0, 7, 1 },
+    { 51573, 10078, 0, 8, 1 },
+    { 51581, 10078, 0, 4, 1 },
+    { 51585, 10078, 0, 4, 1 },
+    { 51589, 10078, 0, 7, 1 },
+    { 51596, 10078, 0, 7, 1 },
+    { 51603, 10078, 0, 10, 1 },
+    { 51613, 10078, 0, 6, 1 },
+    { 51619, 10078, 0, 10, 1 },
+    { 51629, 10078, 0, 7, 1 },
+    { 51636, 10078, 0, 7, 1 },
+    { 51643, 10078, 0, 4, 1 },
+    { 51647, 10078, 0, 4, 1 },
+    { 51651, 10078, 0, 6, 1 },
+    { 51657, 10078, 0, 4, 1 },
+    { 51661, 10078, 0, 12, 1 },
+    { 51673, 10078, 0, 5, 1 },
+    { 51678, 10078, 0, 9, 1 },
+    { 51687, 10078, 0, 4, 1 },
+    { 48425, 10078, 0, 5, 1 },
+    { 51691, 10078, 0, 8, 1 },
+    { 51699, 10078, 0, 5, 1 },
+    { 5060, 10078, 0, 6, 1 },
+    { 51704, 10078, 0, 4, 1 },
+    { 51708, 10078, 0, 10, 1 },
+    { 51718, 10078, 0, 6, 1 },
+    { 51724, 10078, 0, 10, 1 },
+    { 23151, 10078, 0, 7, 1 },
+    { 51734, 10078, 0, 5, 1 },
+    { 51739, 10078, 0, 5, 1 },
+    { 51744, 10078, 0, 10, 1 },
+    { 51754, 10078, 0, 5, 1 },
+    { 51759, 10078, 0, 6, 1 },
+    { 48716, 10078, 0, 4, 1 },
+    { 51765, 10078, 0, 6, 1 },
+    { 51771, 10078, 0, 5, 1 },
+    { 51776, 10078, 0, 6, 1 },
+    { 51782, 10078, 0, 12, 1 },
+    { 51794, 10078, 0, 10, 1 },
+    { 51804, 10078, 0, 4, 1 },
+    { 44180, 10078, 0, 6, 1 },
+    { 42909, 10078, 0, 7, 1 },
+    { 51808, 10078, 0, 4, 1 },
+    { 44222, 10078, 0, 8, 1 },
+    { 51812, 10078, 0, 6, 1 },
+    { 51818, 10078, 0, 9, 1 },
+    { 51827, 10078, 0, 9, 1 },
+    { 23158, 10078, 0, 9, 1 },
+    { 51836, 10078, 0, 6, 1 },
+    { 51842, 10078, 0, 6, 1 },
+    { 51848, 10078, 0, 7, 1 },
+    { 51855, 10078, 0, 8, 1 },
+    { 51863, 10078, 0, 9, 1 },
+    { 50682, 10078, 0, 7, 1 },
+    { 51872, 10078, 0, 6, 1 },
+    { 44974, 10078, 0, 7, 1 },
+    { 51878, 10078, 0, 5, 1 },
+    { 43439, 10078, 0, 4, 1 },
+    { 51883, 10078, 0, 7, 1 },
+    { 45226, 10078, 0, 5, 1 },
+    { 51890, 10078, 0, 5, 1 },
+    { 51895, 10078, 0, 7, 1 },
+    { 51902, 10078, 0, 8, 1 },
+    { 51910, 10078, 0, 6, 1 },
+    { 51916, 10078, 0, 13, 1 },
+    { 51929, 10078, 0, 15, 1 },
+    { 51944, 10078, 0, 13, 1 },
+    { 51957, 10078, 0, 4, 1 },
+    { 51961, 10078, 0, 6, 1 },
+    { 51967, 10078, 0, 8, 1 },
+    { 51975, 10078, 0, 5, 1 },
+    { 51980, 10078, 0, 8, 1 },
+    { 51988, 10078, 0, 10, 1 },
+    { 48031, 10078, 0, 4, 1 },
+    { 51998, 10078, 0, 6, 1 },
+    { 52004, 10078, 0, 7, 1 },
+    { 52011, 10078, 0, 7, 1 },
+    { 52018, 10078, 0, 9, 1 },
+    { 52027, 10078, 0, 5, 1 },
+    { 51120, 10078, 0, 4, 1 },
+    { 52032, 10078, 0, 10, 1 },
+    { 52042, 10078, 0, 9, 1 },
+    { 52051, 10078, 0, 7, 1 },
+    { 52058, 10078, 0, 6, 1 },
+    { 50403, 10078, 0, 6, 1 },
+    { 52064, 10078, 0, 6, 1 },
+    { 52070, 10078, 0, 6, 1 },
+    { 52076, 10078, 0, 15, 1 },
+    { 52091, 10078, 0, 9, 1 },
+    { 48944, 10078, 0, 6, 1 },
+    { 52100, 10078, 0, 6, 1 },
+    { 52106, 10078, 0, 9, 1 },
+    { 52115, 10078, 0, 7, 1 },
+    { 52122, 10078, 0, 3, 1 },
+    { 52125, 10078, 0, 6, 1 },
+    { 45115, 10078, 0, 3, 1 },
+    { 52131, 10078, 0, 8, 1 },
+    { 52139, 10078, 0, 7, 1 },
+    { 52146, 10078, 0, 9, 1 },
+    { 52155, 10078, 0, 8, 1 },
+    { 52163, 10078, 0, 8, 1 },
+    { 52171, 10078, 0, 6, 1 },
+    { 52177, 10078, 0, 9, 1 },
+    { 52186, 10078, 0, 5, 1 },
+    { 52191, 10078, 0, 4, 1 },
+    { 52195, 10078, 0, 7, 1 },
+    { 52202, 10078, 0, 5, 1 },
+    { 51957, 10078, 0, 4, 1 },
+    { 52207, 10078, 0, 8, 1 },
+    { 52215, 10078, 0, 4, 1 },
+    { 52219, 10078, 0, 7, 1 },
+    { 52226, 10078, 0, 6, 1 },
+    { 52232, 10078, 0, 5, 1 },
+    { 48637, 10078, 0, 8, 1 },
+    { 52237, 10078, 0, 11, 1 },
+    { 23175, 10078, 0, 7, 1 },
+    { 44017, 10078, 0, 6, 1 },
+    { 52248, 10078, 0, 4, 1 },
+    { 52252, 10078, 0, 6, 1 },
+    { 43416, 10078, 0, 5, 1 },
+    { 45226, 10078, 0, 5, 1 },
+    { 52258, 10078, 0, 9, 1 },
+    { 52267, 10078, 0, 9, 1 },
+    { 52276, 10078, 0, 4, 1 },
+    { 52280, 10078, 0, 5, 1 },
+    { 52285, 10078, 0, 5, 1 },
+    { 52290, 10078, 0, 6, 1 },
+    { 52296, 10078, 0, 8, 1 },
+    { 52304, 10078, 0, 6, 1 },
+    { 52310, 10078, 0, 11, 1 },
+    { 52321, 10078, 0, 10, 1 },
+    { 52331, 10078, 0, 5, 1 },
+    { 52336, 10078, 0, 6, 1 },
+    { 52342, 10078, 0, 5, 1 },
+    { 52347, 10078, 0, 5, 1 },
+    { 52352, 10078, 0, 7, 1 },
+    { 43720, 10078, 0, 8, 1 },
+    { 52359, 10078, 0, 4, 1 },
+    { 52363, 10078, 0, 6, 1 },
+    { 23182, 10078, 0, 6, 1 },
+    { 52369, 10078, 0, 7, 1 },
+    { 52376, 10078, 0, 4, 1 },
+    { 44382, 10078, 0, 6, 1 },
+    { 52380, 10078, 0, 5, 1 },
+    { 52385, 10078, 0, 9, 1 },
+    { 52394, 10078, 0, 4, 1 },
+    { 52398, 10078, 0, 9, 1 },
+    { 45575, 10078, 0, 6, 1 },
+    { 52407, 10078, 0, 8, 1 },
+    { 52285, 10078, 0, 5, 1 },
+    { 52415, 10078, 0, 5, 1 },
+    { 51776, 10078, 0, 6, 1 },
+    { 52420, 10078, 0, 9, 1 },
+    { 49314, 10078, 0, 9, 1 },
+    { 52429, 10078, 0, 6, 1 },
+    { 52435, 10078, 0, 8, 1 },
+    { 52443, 10078, 0, 8, 1 },
+    { 52451, 10078, 0, 4, 1 },
+    { 52455, 10078, 0, 4, 1 },
+    { 52459, 10078, 0, 8, 1 },
+    { 52467, 10078, 0, 8, 1 },
+    { 52475, 10078, 0, 9, 1 },
+    { 42903, 10078, 0, 6, 1 },
+    { 43192, 10078, 0, 6, 1 },
+    { 52484, 10078, 0, 13, 1 },
+    { 44299, 10078, 0, 6, 1 },
+    { 52497, 10078, 0, 9, 1 },
+    { 52506, 10078, 0, 5, 1 },
+    { 48146, 10078, 0, 6, 1 },
+    { 23221, 10078, 0, 8, 1 },
+    { 52511, 10078, 0, 5, 1 },
+    { 52516, 10078, 0, 4, 1 },
+    { 43416, 10078, 0, 5, 1 },
+    { 52520, 10078, 0, 8, 1 },
+    { 52528, 10078, 0, 9, 1 },
+    { 52537, 10078, 0, 4, 1 },
+    { 46957, 10078, 0, 6, 1 },
+    { 52541, 10078, 0, 10, 1 },
+    { 44526, 10078, 0, 8, 1 },
+    { 46485, 10078, 0, 9, 1 },
+    { 52551, 10078, 0, 10, 1 },
+    { 52561, 10078, 0, 6, 1 },
+    { 52567, 10078, 0, 8, 1 },
+    { 52575, 10078, 0, 5, 1 },
+    { 52580, 10078, 0, 8, 1 },
+    { 52588, 10078, 0, 5, 1 },
+    { 52593, 10078, 0, 9, 1 },
+    { 52602, 10078, 0, 9, 1 },
+    { 52611, 10078, 0, 2, 1 },
+    { 47948, 10078, 0, 5, 1 },
+    { 52613, 10078, 0, 6, 1 },
+    { 52619, 10078, 0, 7, 1 },
+    { 52626, 10078, 0, 5, 1 },
+    { 52631, 10078, 0, 6, 1 },
+    { 52637, 10078, 0, 8, 1 },
+    { 49402, 10078, 0, 6, 1 },
+    { 52645, 10078, 0, 9, 1 },
+    { 44318, 10078, 0, 6, 1 },
+    { 52654, 10078, 0, 8, 1 },
+    { 52662, 10078, 0, 5, 1 },
+    { 52667, 10078, 0, 6, 1 },
+    { 52673, 10078, 0, 8, 1 },
+    { 23760, 10078, 0, 8, 1 },
+    { 52681, 10078, 0, 8, 1 },
+    { 52689, 10078, 0, 8, 1 },
+    { 52697, 10078, 0, 4, 1 },
+    { 52701, 10078, 0, 3, 1 },
+    { 52704, 10078, 0, 4, 1 },
+    { 52708, 10078, 0, 6, 1 },
+    { 52714, 10078, 0, 4, 1 },
+    { 52718, 10078, 0, 7, 1 },
+    { 52725, 10078, 0, 9, 1 },
+    { 52734, 10078, 0, 5, 1 },
+    { 52739, 10078, 0, 6, 1 },
+    { 52125, 10078, 0, 6, 1 },
+    { 52745, 10078, 0, 11, 1 },
+    { 52756, 10078, 0, 6, 1 },
+    { 52762, 10078, 0, 6, 1 },
+    { 52768, 10078, 0, 8, 1 },
+    { 5906, 10078, 0, 6, 1 },
+    { 52776, 10078, 0, 3, 1 },
+    { 52779, 10078, 0, 3, 1 },
+    { 43439, 10078, 0, 4, 1 },
+    { 52782, 10078, 0, 5, 1 },
+    { 52787, 10078, 0, 7, 1 },
+    { 51368, 10078, 0, 8, 1 },
+    { 52794, 10078, 0, 15, 1 },
+    { 52809, 10078, 0, 11, 1 },
+    { 52820, 10078, 0, 8, 1 },
+    { 45617, 10078, 0, 6, 1 },
+    { 52828, 10078, 0, 14, 1 },
+    { 52842, 10078, 0, 3, 1 },
+    { 52845, 10078, 0, 4, 1 },
+    { 52849, 10078, 0, 5, 1 },
+    { 52854, 10078, 0, 6, 1 },
+    { 52860, 10078, 0, 11, 1 },
+    { 52871, 10078, 0, 6, 1 },
+    { 52877, 10078, 0, 9, 1 },
+    { 52232, 10078, 0, 5, 1 },
+    { 52886, 10078, 0, 8, 1 },
+    { 52894, 10078, 0, 8, 1 },
+    { 52902, 10078, 0, 12, 1 },
+    { 52914, 10078, 0, 6, 1 },
+    { 47790, 10078, 0, 6, 1 },
+    { 44661, 10078, 0, 5, 1 },
+    { 52920, 10078, 0, 8, 1 },
+    { 52928, 10078, 0, 5, 1 },
+    { 52933, 10078, 0, 8, 1 },
+    { 52941, 10078, 0, 10, 1 },
+    { 23777, 10078, 0, 9, 1 },
+    { 1231, 10078, 0, 4, 4 },
+    { 10003, 10078, 0, 8, 1 },
+    { 52951, 10078, 0, 5, 1 },
+    { 1717, 10078, 0, 3, 1 },
+    { 52956, 10078, 0, 5, 1 },
+    { 52961, 10078, 0, 9, 1 },
+    { 5370, 10078, 0, 4, 1 },
+    { 10003, 10078, 0, 8, 1 },
+    { 52970, 10078, 0, 6, 1 },
+    { 52970, 10078, 0, 6, 1 },
+    { 4680, 10078, 1, 4, 0 },
+    { 11104, 10079, 0, 1, 1 },
+    { 11105, 10079, 0, 1, 1 },
+    { 52976, 10079, 0, 9, 1 },
+    { 52985, 10079, 0, 8, 1 },
+    { 52993, 10079, 0, 7, 1 },
+    { 53000, 10079, 0, 10, 1 },
+    { 53010, 10079, 0, 7, 1 },
+    { 11135, 10079, 0, 1, 1 },
+    { 11138, 10079, 0, 1, 1 },
+    { 53017, 10079, 0, 7, 1 },
+    { 53024, 10079, 0, 8, 1 },
+    { 53032, 10079, 0, 8, 1 },
+    { 53040, 10079, 0, 8, 1 },
+    { 53048, 10079, 0, 8, 1 },
+    { 53056, 10079, 0, 7, 1 },
+    { 3764, 10079, 0, 3, 1 },
+    { 4680, 10079, 2, 4, 0 },
+    { 53063, 10081, 3, 3, 0 },
+    { 3764, 10084, 0, 3, 1 },
+    { 42507, 10084, 6, 4, 0 },
+    { 2883, 10090, 0, 7, 2 },
+    { 53066, 10090, 0, 7, 2 },
+    { 12253, 10090, 0, 8, 1 },
+    { 53073, 10090, 0, 12, 1 },
+    { 11127, 10090, 0, 1, 1 },
+    { 17189, 10090, 0, 3, 1 },
+    { 17365, 10090, 0, 4, 1 },
+    { 42404, 10090, 0, 4, 1 },
+    { 17115, 10090, 0, 5, 1 },
+    { 12253, 10090, 0, 8, 1 },
+    { 12253, 10090, 3, 8, 0 },
+    { 5557, 10093, 0, 7, 1 },
+    { 6356, 10093, 0, 7, 1 },
+    { 10003, 10093, 0, 8, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53085, 10093, 0, 3, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53085, 10093, 0, 3, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53088, 10093, 0, 2, 1 },
+    { 53090, 10093, 0, 5, 1 },
+    { 53095, 10093, 0, 6, 1 },
+    { 53101, 10093, 0, 12, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53088, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53113, 10093, 0, 5, 1 },
+    { 53118, 10093, 0, 5, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53123, 10093, 0, 6, 1 },
+    { 53118, 10093, 0, 5, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 781, 10093, 0, 2, 1 },
+    { 53129, 10093, 0, 3, 1 },
+    { 53113, 10093, 0, 5, 1 },
+    { 53123, 10093, 0, 6, 1 },
+    { 53132, 10093, 0, 9, 1 },
+    { 53141, 10093, 0, 12, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53090, 10093, 0, 5, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 781, 10093, 0, 2, 1 },
+    { 53129, 10093, 0, 3, 1 },
+    { 53132, 10093, 0, 9, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53118, 10093, 0, 5, 1 },
+    { 2652, 10093, 0, 2, 1 },
+    { 53118, 10093, 0, 5, 1 },
+    { 53141, 10093, 0, 12, 1 },
+    { 53101, 10093, 0, 12, 1 },
+    { 53095, 10093, 0, 6, 1 },
+    { 10003, 10093, 0, 8, 1 },
+    { 53153, 10093, 0, 7, 1 },
+    { 53160, 10093, 0, 4, 1 },
+    { 11120, 10093, 0, 1, 1 },
+    { 53164, 10093, 0, 3, 1 },
+    { 53167, 10093, 1, 6, 0 },
+    { 12188, 10094, 0, 2, 1 },
+    { 53173, 10094, 0, 4, 1 },
+    { 176, 10094, 0, 2, 1 },
+    { 12172, 10094, 0, 4, 1 },
+    { 404, 10094, 0, 2, 1 },
+    { 421, 10094, 0, 2, 1 },
+    { 630, 10094, 0, 2, 1 },
+    { 676, 10094, 0, 2, 1 },
+    { 947, 10094, 0, 2, 1 },
+    { 1105, 10094, 0, 2, 1 },
+    { 1130, 10094, 0, 2, 1 },
+    { 1306, 10094, 0, 2, 1 },
+    { 1582, 10094, 0, 2, 1 },
+    { 1593, 10094, 0, 2, 1 },
+    { 1638, 10094, 0, 2, 1 },
+    { 1782, 10094, 0, 2, 1 },
+    { 1880, 10094, 0, 3, 1 },
+    { 1892, 10094, 0, 2, 1 },
+    { 1971, 10094, 0, 2, 1 },
+    { 2135, 10094, 0, 2, 1 },
+    { 2322, 10094, 0, 2, 1 },
+    { 2606, 10094, 0, 2, 1 },
+    { 2921, 10094, 0, 2, 1 },
+    { 2929, 10094, 0, 2, 1 },
+    { 2964, 10094, 0, 2, 1 },
+    { 2978, 10094, 0, 2, 1 },
+    { 3006, 10094, 0, 2, 1 },
+    { 3063, 10094, 0, 3, 1 },
+    { 3115, 10094, 0, 2, 1 },
+    { 3135, 10094, 0, 2, 1 },
+    { 3207, 10094, 0, 2, 1 },
+    { 3359, 10094, 0, 2, 1 },
+    { 3684, 10094, 0, 2, 1 },
+    { 3693, 10094, 0, 2, 1 },
+    { 3713, 10094, 0, 2, 1 },
+    { 3823, 10094, 0, 2, 1 },
+    { 3835, 10094, 0, 2, 1 },
+    { 3927, 10094, 0, 2, 1 },
+    { 4041, 10094, 0, 2, 1 },
+    { 4074, 10094, 0, 2, 1 },
+    { 4113, 10094, 0, 3, 1 },
+    { 4175, 10094, 0, 2, 1 },
+    { 4215, 10094, 0, 2, 1 },
+    { 4217, 10094, 0, 2, 1 },
+    { 4280, 10094, 0, 2, 1 },
+    { 4429, 10094, 0, 5, 1 },
+    { 4586, 10094, 0, 2, 1 },
+    { 4758, 10094, 0, 2, 1 },
+    { 53177, 10094, 0, 3, 1 },
+    { 4981, 10094, 0, 2, 1 },
+    { 5015, 10094, 0, 2, 1 },
+    { 5213, 10094, 0, 2, 1 },
+    { 5353, 10094, 0, 2, 1 },
+    { 5376, 10094, 0, 2, 1 },
+    { 5916, 10094, 0, 2, 1 },
+    { 6032, 10094, 0, 2, 1 },
+    { 6059, 10094, 0, 2, 1 },
+    { 1288, 10094, 0, 5, 1 },
+    { 53088, 10094, 1, 2, 0 },
+    { 17133, 10095, 1, 3, 0 },
+    { 41932, 10096, 0, 2, 1 },
+    { 18942, 10096, 0, 2, 1 },
+    { 53180, 10096, 0, 4, 1 },
+    { 53184, 10096, 0, 2, 1 },
+    { 3115, 10096, 0, 2, 1 },
+    { 53186, 10096, 0, 5, 1 },
+    { 53191, 10096, 0, 8, 1 },
+    { 53199, 10096, 0, 5, 1 },
+    { 53204, 10096, 0, 3, 1 },
+    { 53207, 10096, 0, 5, 1 },
+    { 53212, 10096, 0, 3, 1 },
+    { 4070, 10096, 0, 2, 1 },
+    { 53215, 10096, 0, 4, 1 },
+    { 53219, 10096, 0, 3, 1 },
+    { 4414, 10096, 0, 2, 1 },
+    { 53222, 10096, 0, 4, 1 },
+    { 53226, 10096, 0, 3, 1 },
+    { 20463, 10096, 0, 2, 1 },
+    { 53229, 10096, 0, 3, 1 },
+    { 53232, 10096, 0, 4, 1 },
+    { 53236, 10096, 0, 3, 1 },
+    { 53239, 10096, 0, 4, 1 },
+    { 5040, 10096, 0, 2, 1 },
+    { 53243, 10096, 0, 3, 1 },
+    { 53246, 10096, 0, 3, 1 },
+    { 5418, 10096, 0, 2, 1 },
+    { 5494, 10096, 0, 2, 1 },
+    { 53249, 10096, 0, 9, 1 },
+    { 6030, 10096, 0, 2, 1 },
+    { 53258, 10096, 0, 4, 1 },
+    { 53262, 10096, 0, 2, 1 },
+    { 53264, 10096, 0, 4, 1 },
+    { 53268, 10096, 0, 4, 1 },
+    { 53272, 10096, 0, 4, 1 },
+    { 6059, 10096, 0, 2, 1 },
+    { 53276, 10096, 0, 2, 1 },
+    { 53278, 10096, 0, 3, 1 },
+    { 53281, 10096, 0, 3, 1 },
+    { 53284, 10096, 0, 4, 1 },
+    { 53288, 10096, 0, 4, 1 },
+    { 53292, 10096, 0, 4, 1 },
+    { 53296, 10096, 0, 4, 1 },
+    { 53300, 10096, 0, 3, 1 },
+    { 53303, 10096, 0, 3, 1 },
+    { 53306, 10096, 0, 4, 1 },
+    { 53310, 10096, 0, 4, 1 },
+    { 53314, 10096, 0, 6, 1 },
+    { 40825, 10096, 0, 2, 1 },
+    { 53320, 10096, 0, 3, 1 },
+    { 5323, 10096, 0, 4, 1 },
+    { 12435, 10096, 0, 2, 1 },
+    { 53323, 10096, 0, 3, 1 },
+    { 2883, 10096, 0, 7, 2 },
+    { 53326, 10096, 0, 7, 2 },
+    { 53333, 10096, 0, 8, 2 },
+    { 53323, 10096, 0, 3, 2 },
+    { 12253, 10096, 0, 8, 1 },
+    { 37588, 10096, 0, 7, 1 },
+    { 5591, 10096, 0, 2, 1 },
+    { 12043, 10096, 0, 2, 1 },
+    { 53341, 10096, 0, 3, 1 },
+    { 1992, 10096, 0, 2, 1 },
+    { 6059, 10096, 0, 2, 1 },
+    { 1742, 10096, 0, 6, 1 },
+    { 10003, 10096, 0, 8, 1 },
+    { 2599, 10096, 0, 3, 1 },
+    { 53344, 10096, 0, 8, 1 },
+    { 53352, 10096, 0, 5, 1 },
+    { 11115, 10096, 0, 5, 1 },
+    { 12823, 10096, 0, 11, 1 },
+    { 10003, 10096, 0, 8, 1 },
+    { 53357, 10096, 2, 8, 0 },
+    { 53365, 10098, 1, 10, 0 },
+    { 10988, 10099, 0, 12, 1 },
+    { 53375, 10099, 0, 7, 1 },
+    { 11216, 10099, 0, 5, 1 },
+    { 53382, 10099, 1, 9, 0 },
+    { 17265, 10100, 0, 13, 1 },
+    { 42627, 10100, 0, 3, 1 },
+    { 53391, 10100, 0, 8, 1 },
+    { 53399, 10100, 0, 10, 1 },
+    { 37588, 10100, 0, 7, 1 },
+    { 53409, 10100, 0, 15, 1 },
+    { 53424, 10100, 0, 4, 1 },
+    { 53428, 10100, 0, 3, 1 },
+    { 53431, 10100, 0, 4, 1 },
+    { 53435, 10100, 0, 11, 1 },
+    { 53446, 10100, 0, 13, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 53459, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 0, 3, 1 },
+    { 17213, 10100, 0, 3, 1 },
+    { 1103, 10100, 0, 2, 1 },
+    { 17201, 10100, 3, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 53462, 10103, 0, 9, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 53471, 10103, 0, 3, 1 },
+    { 53474, 10103, 0, 3, 1 },
+    { 53477, 10103, 0, 5, 1 },
+    { 18061, 10103, 0, 3, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 11810, 10103, 0, 3, 1 },
+    { 11976, 10103, 0, 3, 1 },
+    { 53482, 10103, 0, 9, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 1103, 10103, 0, 2, 1 },
+    { 17201, 10103, 0, 3, 1 },
+    { 17213, 10103, 0, 3, 1 },
+    { 10003, 10103, 0, 8, 1 },
+    { 11121, 10103, 0, 1, 1 },
+    { 10003, 10103, 0, 8, 1 },
+    { 53491, 10103, 0, 3, 1 },
+    { 53494, 10103, 0, 7, 1 },
+    { 53501, 10103, 1, 5, 0 },
+    { 53506, 10104, 0, 4, 1 },
+    { 53510, 10104, 1, 3, 0 },
+    { 53513, 10105, 0, 8, 1 },
+    { 53521, 10105, 0, 8, 1 },
+    { 53529, 10105, 0, 8, 1 },
+    { 53537, 10105, 1, 3, 1 },
+    { 41703, 10106, 1, 3, 1 },
+    { 41932, 10107, 0, 2, 1 },
+    { 53540, 10107, 0, 10, 1 },
+    { 53550, 10107, 0, 3, 1 },
+    { 11010, 10107, 0, 4, 1 },
+    { 4760, 10107, 0, 3, 1 },
+    { 41703, 10107, 1, 3, 1 },
+    { 41932, 10108, 0, 2, 1 },
+    { 53540, 10108, 0, 10, 1 },
+    { 53550, 10108, 0, 3, 1 },
+    { 41703, 10108, 1, 3, 1 },
+    { 41932, 10109, 0, 2, 1 },
+    { 53540, 10109, 0, 10, 1 },
+    { 53553, 10109, 1, 10, 0 },
+    { 17237, 10110, 0, 7, 2 },
+    { 53563, 10110, 2, 2, 0 },
+    { 41860, 10112, 0, 3, 2 },
+    { 53565, 10112, 2, 6, 0 },
+    { 53565, 10114, 2, 6, 0 },
+    { 53565, 10116, 2, 6, 0 },
+    { 53571, 10118, 1, 9, 0 },
+    { 53565, 10119, 2, 6, 0 },
+    { 53571, 10121, 1, 9, 0 },
+    { 41932, 10122, 0, 2, 1 },
+    { 53540, 10122, 0, 10, 1 },
+    { 53565, 10122, 2, 6, 0 },
+    { 53565, 10124, 2, 6, 0 },
+    { 53571, 10126, 1, 9, 0 },
+    { 41932, 10127, 0, 2, 1 },
+    { 53540, 10127, 0, 10, 1 },
+    { 53565, 10127, 2, 6, 0 },
+    { 53571, 10129, 1, 9, 0 },
+    { 53565, 10130, 2, 6, 0 },
+    { 53571, 10132, 1, 9, 0 },
+    { 53565, 10133, 2, 6, 0 },
+    { 53571, 10135, 1, 9, 0 },
+    { 41932, 10136, 0, 2, 1 },
+    { 53540, 10136, 0, 10, 1 },
+    { 53565, 10136, 2, 6, 0 },
+    { 53571, 10138, 1, 9, 0 },
+    { 41932, 10139, 0, 2, 1 },
+    { 53540, 10139, 0, 10, 1 },
+    { 53565, 10139, 2, 6, 0 },
+    { 53565, 10141, 2, 6, 0 },
+    { 53565, 10143, 2, 6, 0 },
+    { 53571, 10145, 1, 9, 0 },
+    { 53565, 10146, 2, 6, 0 },
+    { 53571, 10148, 1, 9, 0 },
+    { 41932, 10149, 0, 2, 1 },
+    { 53540, 10149, 0, 10, 1 },
+    { 53565, 10149, 2, 6, 0 },
+    { 53571, 10151, 1, 9, 0 },
+    { 41932, 10152, 0, 2, 1 },
+    { 53540, 10152, 0, 10, 1 },
+    { 53565, 10152, 2, 6, 0 },
+    { 53565, 10154, 2, 6, 0 },
+    { 53571, 10156, 1, 9, 0 },
+    { 53565, 10157, 2, 6, 0 },
+    { 53571, 10159, 1, 9, 0 },
+    { 53565, 10160, 2, 6, 0 },
+    { 53571, 10162, 1, 9, 0 },
+    { 41932, 10163, 0, 2, 1 },
+    { 53540, 10163, 0, 10, 1 },
+    { 53565, 10163, 2, 6, 0 },
+    { 53565, 10165, 2, 6, 0 },
+    { 11127, 10167, 0, 1, 1 },
+    { 53580, 10167, 0, 3, 1 },
+    { 53583, 10167, 0, 3, 1 },
+    { 17115, 10167, 0, 5, 1 },
+    { 53586, 10167, 0, 4, 1 },
+    { 15709, 10167, 0, 7, 1 },
+    { 53586, 10167, 0, 4, 1 },
+    { 15709, 10167, 0, 7, 1 },
+    { 53586, 10167, 0, 4, 1 },
+    { 53586, 10167, 0, 4, 1 },
+    { 15709, 10167, 0, 7, 1 },
+    { 12253, 10167, 1, 8, 0 },
+    { 17365, 10168, 0, 4, 1 },
+    { 53590, 10168, 0, 3, 1 },
+    { 11113, 10168, 0, 1, 1 },
+    { 2518, 10168, 0, 6, 1 },
+    { 11113, 10168, 0, 1, 1 },
+    { 11114, 10168, 0, 1, 1 },
+    { 2518, 10168, 0, 6, 1 },
+    { 53593, 10168, 0, 4, 1 },
+    { 53597, 10168, 0, 5, 1 },
+    { 53602, 10168, 0, 5, 1 },
+    { 53607, 10168, 0, 4, 1 },
+    { 53611, 10168, 0, 4, 1 },
+    { 53615, 10168, 0, 4, 1 },
+    { 53619, 10168, 0, 3, 1 },
+    { 53622, 10168, 0, 3, 1 },
+    { 53625, 10168, 0, 3, 1 },
+    { 53063, 10168, 0, 3, 1 },
+    { 333, 10168, 0, 3, 1 },
+    { 53088, 10168, 1, 2, 0 },
+    { 53628, 10169, 0, 2, 1 },
+    { 53630, 10169, 0, 2, 1 },
+    { 11127, 10169, 0, 1, 1 },
+    { 53586, 10169, 0, 4, 1 },
+    { 53632, 10169, 0, 4, 1 },
+    { 53636, 10169, 0, 6, 1 },
+    { 17605, 10169, 0, 3, 1 },
+    { 53642, 10169, 0, 5, 1 },
+    { 41685, 10169, 0, 3, 1 },
+    { 53647, 10169, 0, 9, 1 },
+    { 53656, 10169, 0, 5, 1 },
+    { 53656, 10169, 0, 5, 1 },
+    { 53656, 10169, 0, 5, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53553, 10169, 0, 10, 1 },
+    { 53661, 10169, 0, 14, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 41932, 10169, 0, 2, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 53675, 10169, 0, 3, 1 },
+    { 53678, 10169, 0, 14, 1 },
+    { 1288, 10169, 0, 5, 1 },
+    { 333, 10169, 0, 3, 1 },
+};
@@ -0,0 +1,306 @@
+/*
+ * Generates psl-data.h, the public suffix trie used by PublicSuffixList,
+ * from public_suffix_list.dat (https://publicsuffix.org/list/).
+ *
+ * Build and run:
+ *   g++ -std=c++11 -O2 -o psl-generate psl-generate.cpp
+ *   ./psl-generate public_suffix_list.dat psl-data.h
+ *
+ * Rules are stored as a trie of labels read from right to left. The nodes
+ * are written breadth first so the children of a node are contiguous and
+ * sorted, allowing a binary search at each level. Internationalized rules
+ * are stored both in UTF-8 and in punycode (xn--) form.
+ */
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
+
+enum NodeFlags
+{
+    PSL_TERMINAL = 1,  // the labels up to this node are a public suffix
+    PSL_WILDCARD = 2,  // "*.<labels up to this node>" is a public suffix
+    PSL_EXCEPTION = 4, // "!<labels up to this node>" exception rule
+};
+
+struct Node
+{
+    unsigned flags = 0;
+    std::map<std::string, std::unique_ptr<Node>> children;
+};
+
+static std::u32string decodeUtf8(const std::string &s)
+{
+    std::u32string out;
+    for (size_t i = 0; i < s.size();)
+    {
+        const unsigned char c = s[i];
+        char32_t cp;
+        int extra;
+        if (c < 0x80)      { cp = c; extra = 0; }
+        else if (c < 0xe0) { cp = c & 0x1f; extra = 1; }
+        else if (c < 0xf0) { cp = c & 0x0f; extra = 2; }
+        else               { cp = c & 0x07; extra = 3; }
+        for (int j = 1; j <= extra && i + j < s.size(); j++)
+            cp = (cp << 6) | (static_cast<unsigned char>(s[i + j]) & 0x3f);
+        out += cp;
+        i += extra + 1;
+    }
+    return out;
+}
+
+// RFC 3492
+static unsigned adaptBias(unsigned delta, unsigned numPoints, bool firstTime)
+{
+    const unsigned base = 36, tmin = 1, tmax = 26, skew = 38, damp = 700;
+    delta = firstTime ? delta / damp : delta / 2;
+    delta += delta / numPoints;
+    unsigned k = 0;
+    while (delta > ((base - tmin) * tmax) / 2)
+    {
+        delta /= base - tmin;
+        k += base;
+    }
+    return k + (base - tmin + 1) * delta / (delta + skew);
+}
+
+static std::string punycode(const std::string &label)
+{
+    const unsigned base = 36, tmin = 1, tmax = 26;
+    const std::u32string in = decodeUtf8(label);
+
+    std::string out;
+    for (char32_t c : in)
+        if (c < 0x80)
+            out += static_cast<char>(c);
+
+    const unsigned basic = out.size();
+    unsigned handled = basic;
+    if (basic > 0)
+        out += '-';
+
+    const auto digit = [](unsigned d) { return static_cast<char>(d < 26 ? 'a' + d : '0' + d - 26); };
+
+    unsigned n = 128, delta = 0, bias = 72;
+    while (handled < in.size())
+    {
+        char32_t m = 0x10ffff;
+        for (char32_t c : in)
+            if (c >= n && c < m)
+                m = c;
+
+        delta += (m - n) * (handled + 1);
+        n = m;
+
+        for (char32_t c : in)
+        {
+            if (c < n)
+                delta++;
+            if (c != n)
+                continue;
+
+            unsigned q = delta;
+            for (unsigned k = base;; k += base)
+            {
+                const unsigned t = k <= bias ? tmin : (k >= bias + tmax ? tmax : k - bias);
+                if (q < t)
+                    break;
+                out += digit(t + (q - t) % (base - t));
+                q = (q - t) / (base - t);
+            }
+            out += digit(q);
+            bias = adaptBias(delta, handled + 1, handled == basic);
+            delta = 0;
+            handled++;
+        }
+        delta++;
+        n++;
+    }
+    return "xn--" + out;
+}
+
+static bool isAscii(const std::string &s)
+{
+    for (unsigned char c : s)
+        if (c >= 0x80)
+            return false;
+    return true;
+}
+
+static std::vector<std::string> splitLabels(const std::string &rule)
+{
+    std::vector<std::string> labels;
+    std::stringstream ss(rule);
+    std::string label;
+    while (std::getline(ss, label, '.'))
+        labels.push_back(label);
+    return labels;
+}
+
+static void addRule(Node &root, std::vector<std::string> labels, unsigned flag)
+{
+    Node *node = &root;
+    for (auto it = labels.rbegin(); it != labels.rend(); ++it)
+    {
+        std::unique_ptr<Node> &child = node->children[*it];
+        if (!child)
+            child.reset(new Node);
+        node = child.get();
+    }
+    node->flags |= flag;
+}
+
+static void addRule(Node &root, const std::string &line)
+{
+    std::string rule = line;
+    unsigned flag = PSL_TERMINAL;
+    if (rule[0] == '!')
+    {
+        flag = PSL_EXCEPTION;
+        rule = rule.substr(1);
+    }
+    else if (rule.compare(0, 2, "*.") == 0)
+    {
+        flag = PSL_WILDCARD;
+        rule = rule.substr(2);
+    }
+
+    for (char &c : rule)
+        if (c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+
+    std::vector<std::string> labels = splitLabels(rule);
+    addRule(root, labels, flag);
+
+    if (!isAscii(rule))
+    {
+        for (std::string &label : labels)
+            if (!isAscii(label))
+                label = punycode(label);
+        addRule(root, labels, flag);
+    }
+}
+
+static std::string escapeLabel(const std::string &s)
+{
+    std::string out;
+    for (unsigned char c : s)
+    {
+        if (c >= 0x20 && c < 0x7f && c != '"' && c != '\\' && c != '?')
+        {
+            out += static_cast<char>(c);
+        }
+        else
+        {
+            char buf[5];
+            snprintf(buf, sizeof(buf), "\\%03o", c);
+            out += buf;
+        }
+    }
+    return out;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " public_suffix_list.dat psl-data.h" << std::endl;
+        return 1;
+    }
+
+    std::ifstream in(argv[1]);
+    if (!in)
+    {
+        std::cerr << "Cannot read " << argv[1] << std::endl;
+        return 1;
+    }
+
+    Node root;
+    unsigned ruleCount = 0;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        //Rule is the first whitespace delimited word of the line
+        const size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || line.compare(begin, 2, "//") == 0)
+            continue;
+        const size_t end = line.find_first_of(" \t\r", begin);
+        addRule(root, line.substr(begin, end == std::string::npos ? std::string::npos : end - begin));
+        ruleCount++;
+    }
+
+    //Breadth first numbering, children of a node get contiguous indexes
+    struct Entry
+    {
+        const std::string *label;
+        const Node *node;
+        uint32_t firstChild;
+    };
+    std::vector<Entry> entries;
+    static const std::string rootLabel;
+    entries.push_back({&rootLabel, &root, 0});
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i].firstChild = entries.size();
+        for (const auto &child : entries[i].node->children)
+            entries.push_back({&child.first, child.second.get(), 0});
+    }
+
+    //Label storage, each distinct label is stored once
+    std::string labels;
+    std::map<std::string, uint32_t> labelOffsets;
+    for (const Entry &e : entries)
+    {
+        if (labelOffsets.count(*e.label))
+            continue;
+        labelOffsets[*e.label] = labels.size();
+        labels += *e.label;
+    }
+
+    std::ofstream out(argv[2]);
+    if (!out)
+    {
+        std::cerr << "Cannot write " << argv[2] << std::endl;
+        return 1;
+    }
+
+    out << "/* Generated by psl-generate.cpp from public_suffix_list.dat, do not edit.\n"
+        << " * " << ruleCount << " rules, " << entries.size() << " nodes.\n"
+        << " */\n\n"
+        << "struct PslNode\n{\n"
+        << "    unsigned int labelOffset;\n"
+        << "    unsigned int firstChild;\n"
+        << "    unsigned short childCount;\n"
+        << "    unsigned char labelLength;\n"
+        << "    unsigned char flags;\n"
+        << "};\n\n"
+        << "enum PslNodeFlags\n{\n"
+        << "    PSL_TERMINAL = " << PSL_TERMINAL << ",\n"
+        << "    PSL_WILDCARD = " << PSL_WILDCARD << ",\n"
+        << "    PSL_EXCEPTION = " << PSL_EXCEPTION << "\n"
+        << "};\n\n";
+
+    out << "static const char PslLabels[] =\n";
+    const size_t chunk = 96;
+    for (size_t i = 0; i < labels.size(); i += chunk)
+        out << "    \"" << escapeLabel(labels.substr(i, chunk)) << "\"\n";
+    out << "    ;\n\n";
+
+    out << "static const PslNode PslNodes[] =\n{\n";
+    for (const Entry &e : entries)
+    {
+        out << "    { " << labelOffsets[*e.label] << ", " << e.firstChild << ", "
+            << e.node->children.size() << ", " << e.label->size() << ", "
+            << e.node->flags << " },\n";
+    }
+    out << "};\n";
+
+    std::cout << ruleCount << " rules, " << entries.size() << " nodes, "
+              << labels.size() << " bytes of labels" << std::endl;
+    return 0;
+}
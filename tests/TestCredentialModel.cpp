@@ -2,6 +2,7 @@
 
 #include <QJsonDocument>
 #include <QJsonArray>
+#include <QSignalSpy>
 
 #include "../src/CredentialModel.h"
 
@@ -71,3 +72,65 @@ QModelIndex TestCredentialModel::findLoginIndex(QString loginName, QString servi
 
     return requiredIdx;
 }
+
+void TestCredentialModel::incrementalReload()
+{
+    CredentialModel *model = createCredentialModelWithThreeLogins();
+    QSignalSpy resetSpy(model, &QAbstractItemModel::modelReset);
+    QSignalSpy insertSpy(model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removeSpy(model, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy changeSpy(model, &QAbstractItemModel::dataChanged);
+
+    // Same content: nothing to notify
+    model->load(QJsonDocument::fromJson(emptyLoginTestJson).array());
+    Q_ASSERT(resetSpy.isEmpty() && insertSpy.isEmpty() && removeSpy.isEmpty() && changeSpy.isEmpty());
+
+    // Drop loginA, update loginB and add a new service
+    QJsonArray array = QJsonDocument::fromJson(emptyLoginTestJson).array();
+    QJsonObject service = array.at(0).toObject();
+    QJsonArray childs = service["childs"].toArray();
+    childs.removeAt(1);
+    QJsonObject loginB = childs.at(1).toObject();
+    loginB["description"] = "updated";
+    childs.replace(1, loginB);
+    service["childs"] = childs;
+    array.replace(0, service);
+    QJsonObject newService{{"service", "new.io"}, {"childs", QJsonArray{loginB}}};
+    array.append(newService);
+
+    model->load(array);
+    Q_ASSERT(resetSpy.isEmpty());
+    Q_ASSERT(removeSpy.count() == 1);
+    Q_ASSERT(insertSpy.count() == 2);
+    Q_ASSERT(!changeSpy.isEmpty());
+    Q_ASSERT(model->rowCount() == 2);
+    Q_ASSERT(model->rowCount(model->getServiceIndexByName("service.io")) == 2);
+
+    delete model;
+}
+
+void TestCredentialModel::lazyLoading()
+{
+    // Big enough database to only expose logins on demand
+    QJsonArray childs;
+    for (int i = 0; i < 2500; i++)
+        childs.append(QJsonObject{{"login", QString("login%1").arg(i)}, {"address", QJsonArray{i & 0xFF, i >> 8}}});
+    QJsonArray array{QJsonObject{{"service", "big.io"}, {"childs", childs}}};
+
+    CredentialModel *model = new CredentialModel();
+    model->load(array);
+
+    QModelIndex serviceIdx = model->index(0, 0);
+    Q_ASSERT(model->rowCount() == 1);
+    Q_ASSERT(model->hasChildren(serviceIdx));
+    Q_ASSERT(model->rowCount(serviceIdx) == 0);
+    Q_ASSERT(model->canFetchMore(serviceIdx));
+
+    model->fetchMore(serviceIdx);
+    Q_ASSERT(!model->canFetchMore(serviceIdx));
+    Q_ASSERT(model->rowCount(serviceIdx) == 2500);
+    Q_ASSERT(model->getLoginItemByIndex(model->index(0, 0, serviceIdx)) != nullptr);
+    Q_ASSERT(model->getServiceItemByIndex(model->index(0, 0, serviceIdx)) == nullptr);
+
+    delete model;
+}
@@ -20,6 +20,8 @@ public:
 private Q_SLOTS:
     void noChanges();
     void oneCredentialRemoved();
+    void incrementalReload();
+    void lazyLoading();
 
 };
 
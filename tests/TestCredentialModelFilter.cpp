@@ -45,3 +45,39 @@ void TestCredentialModelFilter::findAndRemoveCredentialFromSourceModel()
     filter->deleteLater();
     sourceModel->deleteLater();
 }
+
+void TestCredentialModelFilter::filterByText()
+{
+    CredentialModel *sourceModel = TestCredentialModel::createCredentialModelWithThreeLogins();
+    CredentialModelFilter *filter = new CredentialModelFilter();
+    filter->setSourceModel(sourceModel);
+
+    // Logins matching the filter
+    filter->setFilter("LOGIN");
+    Q_ASSERT(filter->rowCount() == 1);
+    Q_ASSERT(filter->rowCount(filter->index(0, 0)) == 2);
+
+    // Growing query, narrowed from the previous matches
+    filter->setFilter("loginb");
+    Q_ASSERT(filter->rowCount(filter->index(0, 0)) == 1);
+
+    // Service matching the filter shows all its logins
+    filter->setFilter("serv");
+    Q_ASSERT(filter->rowCount(filter->index(0, 0)) == 3);
+
+    filter->setFilter("nothing");
+    Q_ASSERT(filter->rowCount() == 0);
+
+    // Source changes are applied to the current filter
+    filter->setFilter("login");
+    QModelIndex srcIdx = sourceModel->index(1, 0, sourceModel->index(0, 0));
+    Q_ASSERT(sourceModel->getLoginItemByIndex(srcIdx)->name() == "loginA");
+    sourceModel->updateLoginItem(srcIdx, CredentialModel::ItemNameRole, "renamed");
+    Q_ASSERT(filter->rowCount(filter->index(0, 0)) == 1);
+
+    filter->setFilter("");
+    Q_ASSERT(filter->rowCount(filter->index(0, 0)) == 3);
+
+    filter->deleteLater();
+    sourceModel->deleteLater();
+}
@@ -11,6 +11,7 @@ public:
 
 private slots:
     void findAndRemoveCredentialFromSourceModel();
+    void filterByText();
 };
 
 #endif // TESTCREDENTIALMODELFILTER_H
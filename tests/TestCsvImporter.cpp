@@ -0,0 +1,63 @@
+#include <qtestcase.h>
+
+#include "TestCsvImporter.h"
+#include "../src/CsvImporter.h"
+
+namespace
+{
+QString writeCsv(QTemporaryFile &file, const QByteArray &content)
+{
+    file.open();
+    file.write(content);
+    file.close();
+    return file.fileName();
+}
+}
+
+TestCsvImporter::TestCsvImporter(QObject *parent) : QObject(parent)
+{
+}
+
+void TestCsvImporter::test_sniffSeparator()
+{
+    QCOMPARE(CsvImporter::sniffSeparator("a.com,john,pass\nb.com,jane,word\n"), QChar(','));
+    QCOMPARE(CsvImporter::sniffSeparator("a.com;john;pass\nb.com;jane;word\n"), QChar(';'));
+    QCOMPARE(CsvImporter::sniffSeparator("a.com\tjohn\tpass\n"), QChar('\t'));
+
+    //Quoted separators don't count
+    QCOMPARE(CsvImporter::sniffSeparator("\"a,b\";john;pass\n"), QChar(';'));
+
+    //Mostly valid rows: keep the separator so the bad lines get reported
+    QCOMPARE(CsvImporter::sniffSeparator("a,b,c\nd,e,f\ng,h,i\nj,k\n"), QChar(','));
+
+    QVERIFY(CsvImporter::sniffSeparator("nothing to see here\n").isNull());
+}
+
+void TestCsvImporter::test_importParsed()
+{
+    QTemporaryFile file;
+    CsvImporter importer(writeCsv(file, "a.com;john;pass\n\"b;c.com\";jane;\"wo\"\"rd\"\n"));
+    QSignalSpy spy(&importer, &CsvImporter::importParsed);
+    importer.start();
+    QVERIFY(importer.wait());
+
+    QCOMPARE(spy.count(), 1);
+    const QJsonArray creds = spy.at(0).at(0).toJsonArray();
+    QCOMPARE(creds.size(), 2);
+    QCOMPARE(creds.at(0).toObject()["service"].toString(), QString("a.com"));
+    QCOMPARE(creds.at(0).toObject()["login"].toString(), QString("john"));
+    QCOMPARE(creds.at(1).toObject()["service"].toString(), QString("b;c.com"));
+    QCOMPARE(creds.at(1).toObject()["password"].toString(), QString("wo\"rd"));
+}
+
+void TestCsvImporter::test_invalidRows()
+{
+    QTemporaryFile file;
+    CsvImporter importer(writeCsv(file, "a,b,c\nd,e,f\ng,h\ni,j,k\n"));
+    QSignalSpy spy(&importer, &CsvImporter::importFailed);
+    importer.start();
+    QVERIFY(importer.wait());
+
+    QCOMPARE(spy.count(), 1);
+    QVERIFY(spy.at(0).at(0).toString().contains("lines number: 3"));
+}
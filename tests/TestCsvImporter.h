@@ -0,0 +1,19 @@
+#ifndef TESTCSVIMPORTER_H
+#define TESTCSVIMPORTER_H
+
+#include <QtTest/QtTest>
+
+class TestCsvImporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TestCsvImporter(QObject *parent = nullptr);
+
+private slots:
+    void test_sniffSeparator();
+    void test_importParsed();
+    void test_invalidRows();
+};
+
+#endif // TESTCSVIMPORTER_H
@@ -0,0 +1,55 @@
+#include <qtestcase.h>
+
+#include "TestFlashPlacement.h"
+#include "../src/Mooltipass/MPFlashPlacement.h"
+
+namespace
+{
+QByteArray nodeAddress(quint16 page, quint8 node)
+{
+    QByteArray address(2, 0);
+    address[0] = static_cast<char>(node | ((page << 3) & 0xF8));
+    address[1] = static_cast<char>(page >> 5);
+    return address;
+}
+}
+
+void TestFlashPlacement::test_pageFromAddress()
+{
+    QCOMPARE(MPFlashPlacement::pageFromAddress(nodeAddress(0, 3)), quint16(0));
+    QCOMPARE(MPFlashPlacement::pageFromAddress(nodeAddress(31, 7)), quint16(31));
+    QCOMPARE(MPFlashPlacement::pageFromAddress(nodeAddress(1234, 2)), quint16(1234));
+}
+
+void TestFlashPlacement::test_takeClosestPage()
+{
+    MPFlashPlacement placement;
+    placement.addFreeAddress(nodeAddress(10, 0));
+    placement.addFreeAddress(nodeAddress(10, 1));
+    placement.addFreeAddress(nodeAddress(50, 4));
+    placement.addFreeAddress(nodeAddress(200, 2));
+    QCOMPARE(placement.size(), 4);
+
+    QCOMPARE(placement.take(48), nodeAddress(50, 4));
+    QCOMPARE(placement.take(48), nodeAddress(10, 0));
+    QCOMPARE(placement.take(500), nodeAddress(200, 2));
+    QCOMPARE(placement.take(-1), nodeAddress(10, 1));
+    QCOMPARE(placement.size(), 0);
+    QVERIFY(placement.take(10).isNull());
+}
+
+void TestFlashPlacement::test_writeBatchOrder()
+{
+    MPNodeWriteBatch batch;
+    batch.add(nodeAddress(30, 1), "a");
+    batch.add(nodeAddress(5, 0), "b");
+    batch.add(nodeAddress(30, 0), "c");
+    batch.add(nodeAddress(5, 3), "d");
+
+    QByteArray order;
+    for (const auto &write : batch.takeSorted())
+        order += write.second;
+
+    QCOMPARE(order, QByteArray("bdac"));
+    QVERIFY(batch.isEmpty());
+}
@@ -0,0 +1,16 @@
+#ifndef TESTFLASHPLACEMENT_H
+#define TESTFLASHPLACEMENT_H
+
+#include <QtTest/QtTest>
+
+class TestFlashPlacement : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_pageFromAddress();
+    void test_takeClosestPage();
+    void test_writeBatchOrder();
+};
+
+#endif // TESTFLASHPLACEMENT_H
@@ -0,0 +1,77 @@
+#include <qtestcase.h>
+
+#include "TestHibpOfflineIndex.h"
+#include "../src/HibpOfflineIndex.h"
+
+namespace
+{
+QByteArray sha1(const QByteArray &pwd)
+{
+    return QCryptographicHash::hash(pwd, QCryptographicHash::Sha1);
+}
+
+bool buildIndex(const QVector<QByteArray> &hashes, QTemporaryDir &dir, QString &indexFile)
+{
+    QFile text(dir.filePath("pwned.txt"));
+    if (!text.open(QIODevice::WriteOnly))
+        return false;
+
+    //pwned count is the position in the list, starting at 1
+    for (int i = 0; i < hashes.size(); i++)
+        text.write(hashes.at(i).toHex().toUpper() + ":" + QByteArray::number(i + 1) + "\r\n");
+    text.close();
+
+    indexFile = dir.filePath("pwned.bin");
+    return HibpOfflineIndex::buildFromText(text.fileName(), indexFile);
+}
+}
+
+TestHibpOfflineIndex::TestHibpOfflineIndex(QObject *parent) : QObject(parent)
+{
+    for (int i = 0; i < 5000; i++)
+        m_hashes.append(sha1("password" + QByteArray::number(i)));
+    std::sort(m_hashes.begin(), m_hashes.end());
+}
+
+void TestHibpOfflineIndex::test_lookup()
+{
+    QTemporaryDir dir;
+    QString indexFile;
+    QVERIFY(buildIndex(m_hashes, dir, indexFile));
+
+    HibpOfflineIndex index;
+    QVERIFY(index.open(indexFile));
+    QCOMPARE(index.size(), quint64(m_hashes.size()));
+
+    for (int i = 0; i < m_hashes.size(); i++)
+        QCOMPARE(index.lookup(m_hashes.at(i)), quint32(i + 1));
+
+    QCOMPARE(index.lookup(sha1("not in the list")), quint32(0));
+    QCOMPARE(index.lookup(QByteArray(20, '\0')), quint32(0));
+    QCOMPARE(index.lookup(QByteArray(20, '\xff')), quint32(0));
+    QCOMPARE(index.lookup(QByteArray("short")), quint32(0));
+}
+
+void TestHibpOfflineIndex::test_bulkLookup()
+{
+    QTemporaryDir dir;
+    QString indexFile;
+    QVERIFY(buildIndex(m_hashes, dir, indexFile));
+
+    HibpOfflineIndex index;
+    QVERIFY(index.open(indexFile));
+
+    QVector<QByteArray> queries = { m_hashes.at(4000), sha1("unknown"), m_hashes.at(12), m_hashes.at(4000) };
+    QVector<quint32> counts = index.lookup(queries);
+    QCOMPARE(counts, QVector<quint32>({ 4001, 0, 13, 4001 }));
+}
+
+void TestHibpOfflineIndex::test_rejectUnsorted()
+{
+    QVector<QByteArray> unsorted = m_hashes.mid(0, 10);
+    std::reverse(unsorted.begin(), unsorted.end());
+
+    QTemporaryDir dir;
+    QString indexFile;
+    QVERIFY(!buildIndex(unsorted, dir, indexFile));
+}
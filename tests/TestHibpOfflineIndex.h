@@ -0,0 +1,22 @@
+#ifndef TESTHIBPOFFLINEINDEX_H
+#define TESTHIBPOFFLINEINDEX_H
+
+#include <QtTest/QtTest>
+
+class TestHibpOfflineIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TestHibpOfflineIndex(QObject *parent = nullptr);
+
+private slots:
+    void test_lookup();
+    void test_bulkLookup();
+    void test_rejectUnsorted();
+
+private:
+    QVector<QByteArray> m_hashes;
+};
+
+#endif // TESTHIBPOFFLINEINDEX_H
@@ -0,0 +1,141 @@
+#include <qtestcase.h>
+
+#include "TestNodeGraphChecker.h"
+#include "../src/Mooltipass/MPNodeGraphChecker.h"
+
+namespace
+{
+typedef MPNodeGraphChecker::Link Link;
+typedef MPNodeGraphChecker::Node Node;
+typedef MPNodeGraphChecker::GraphSnapshot GraphSnapshot;
+
+const QByteArray EMPTY = QByteArray(2, 0);
+
+QByteArray address(int index)
+{
+    QByteArray addr;
+    addr.append(static_cast<char>(index & 0xFF));
+    addr.append(static_cast<char>((index >> 8) & 0xFF));
+    return addr;
+}
+
+Link link(const QByteArray &addr)
+{
+    Link l;
+    l.address = addr;
+    return l;
+}
+
+/* Parents at 1..parentCount, children of parent p right after 0x1000 + p * childCount */
+GraphSnapshot buildGraph(int parentCount, int childCount, bool isData = false)
+{
+    GraphSnapshot graph;
+    graph.enabled = true;
+    graph.reportOrphans = true;
+    graph.checkPreviousChild = !isData;
+    graph.start = link(parentCount > 0 ? address(1) : EMPTY);
+
+    for (int p = 1; p <= parentCount; p++)
+    {
+        Node parent;
+        parent.address = address(p);
+        parent.previous = link(p > 1 ? address(p - 1) : EMPTY);
+        parent.next = link(p < parentCount ? address(p + 1) : EMPTY);
+        parent.firstChild = link(childCount > 0 ? address(0x1000 + p * childCount) : EMPTY);
+        graph.parents << parent;
+
+        for (int c = 0; c < childCount; c++)
+        {
+            const int idx = 0x1000 + p * childCount + c;
+            Node child;
+            child.address = address(idx);
+            child.previous = link(isData || c == 0 ? EMPTY : address(idx - 1));
+            child.next = link(c + 1 < childCount ? address(idx + 1) : EMPTY);
+            graph.children << child;
+        }
+    }
+    return graph;
+}
+
+bool hasIssue(const MPNodeGraphChecker::RepairPlan &plan, MPNodeGraphChecker::IssueType type, const QByteArray &addr)
+{
+    for (const auto &issue: plan)
+    {
+        if (issue.type == type && issue.link.address == addr)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+void TestNodeGraphChecker::test_consistentGraphs()
+{
+    MPNodeGraphChecker checker;
+    checker.setGraph(MPNodeGraphChecker::CredentialGraph, buildGraph(3, 4));
+    checker.setGraph(MPNodeGraphChecker::DataGraph, buildGraph(2, 3, true));
+    checker.setFavorites({address(2) + address(0x1000 + 2 * 4 + 1), EMPTY + EMPTY});
+    QVERIFY(checker.run().isEmpty());
+
+    //Enough nodes to go through the thread pool
+    MPNodeGraphChecker bigChecker;
+    bigChecker.setGraph(MPNodeGraphChecker::CredentialGraph, buildGraph(200, 5));
+    bigChecker.setGraph(MPNodeGraphChecker::WebAuthnGraph, buildGraph(100, 2));
+    bigChecker.setGraph(MPNodeGraphChecker::DataGraph, buildGraph(100, 8, true));
+    QVERIFY(bigChecker.run().isEmpty());
+}
+
+void TestNodeGraphChecker::test_brokenLinks()
+{
+    GraphSnapshot graph = buildGraph(4, 3);
+    graph.parents[1].previous = link(address(3));          //should be 1
+    graph.children[4].previous = link(EMPTY);              //second child of parent 2
+    graph.parents[2].next = link(address(2));              //parent loop
+    graph.reportOrphans = false;
+
+    const auto issues = MPNodeGraphChecker::checkGraph(graph, MPNodeGraphChecker::CredentialGraph);
+    QCOMPARE(issues.size(), 3);
+    QVERIFY(hasIssue(issues, MPNodeGraphChecker::BadPreviousParent, address(2)));
+    QVERIFY(hasIssue(issues, MPNodeGraphChecker::BadPreviousChild, graph.children[4].address));
+    QVERIFY(hasIssue(issues, MPNodeGraphChecker::ParentLoop, address(2)));
+
+    GraphSnapshot data = buildGraph(2, 2, true);
+    data.parents[1].firstChild = link(address(0x0F00));    //not loaded
+    const auto dataIssues = MPNodeGraphChecker::checkGraph(data, MPNodeGraphChecker::DataGraph);
+    QVERIFY(hasIssue(dataIssues, MPNodeGraphChecker::MissingChild, address(0x0F00)));
+    //The children of the broken parent are left without a parent
+    QVERIFY(hasIssue(dataIssues, MPNodeGraphChecker::OrphanChild, data.children[2].address));
+    QVERIFY(hasIssue(dataIssues, MPNodeGraphChecker::OrphanChild, data.children[3].address));
+}
+
+void TestNodeGraphChecker::test_orphansAndFavorites()
+{
+    GraphSnapshot graph = buildGraph(3, 2);
+    Node orphan;
+    orphan.address = address(0x0800);
+    orphan.next = link(EMPTY);
+    orphan.previous = link(EMPTY);
+    orphan.firstChild = link(EMPTY);
+    graph.parents << orphan;
+
+    //Virtual node not linked yet
+    Node newChild;
+    newChild.virtualAddress = 7;
+    newChild.next = link(EMPTY);
+    newChild.previous = link(EMPTY);
+    graph.children << newChild;
+
+    MPNodeGraphChecker checker;
+    checker.setGraph(MPNodeGraphChecker::CredentialGraph, graph);
+    checker.setFavorites({address(1) + address(0x1000 + 2 + 1), address(1) + address(0x1000 + 3 * 2)});
+    const auto plan = checker.run();
+
+    QCOMPARE(plan.size(), 3);
+    QVERIFY(hasIssue(plan, MPNodeGraphChecker::OrphanParent, address(0x0800)));
+    QCOMPARE(plan[1].type, MPNodeGraphChecker::OrphanChild);
+    QVERIFY(plan[1].link.address.isNull());
+    QCOMPARE(plan[1].link.virtualAddress, quint32(7));
+    QCOMPARE(plan[2].type, MPNodeGraphChecker::BadFavorite);
+    QCOMPARE(plan[2].favoriteIndex, 1);
+}
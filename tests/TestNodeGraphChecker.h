@@ -0,0 +1,16 @@
+#ifndef TESTNODEGRAPHCHECKER_H
+#define TESTNODEGRAPHCHECKER_H
+
+#include <QtTest/QtTest>
+
+class TestNodeGraphChecker : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_consistentGraphs();
+    void test_brokenLinks();
+    void test_orphansAndFavorites();
+};
+
+#endif // TESTNODEGRAPHCHECKER_H
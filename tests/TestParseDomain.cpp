@@ -2,6 +2,7 @@
 
 #include "TestParseDomain.h"
 #include "../src/ParseDomain.h"
+#include "../src/PublicSuffixList.h"
 
 
 TestParseDomain::TestParseDomain(QObject *parent) : QObject(parent)
@@ -163,3 +164,81 @@ void TestParseDomain::test_URLs_data()
         << true << true << true
         << ".s3.amazonaws.com" << "machine-1234" << "" << (-1);
 }
+
+void TestParseDomain::test_publicSuffix()
+{
+    QFETCH(QString, host);
+    QFETCH(QString, suffix);
+
+    QCOMPARE(PublicSuffixList::publicSuffix(host), suffix);
+}
+
+void TestParseDomain::test_publicSuffix_data()
+{
+    QTest::addColumn<QString>("host");
+    QTest::addColumn<QString>("suffix");
+
+    QTest::newRow("simple") << "google.com" << "com";
+    QTest::newRow("subdomain") << "mail.google.com" << "com";
+    QTest::newRow("two labels") << "www.bbc.co.uk" << "co.uk";
+    QTest::newRow("only suffix") << "co.uk" << "co.uk";
+    QTest::newRow("private suffix") << "machine-1234.s3.amazonaws.com" << "s3.amazonaws.com";
+    QTest::newRow("unknown TLD") << "sundayfun.bogo" << "";
+    QTest::newRow("single label") << "mycomputer" << "";
+    QTest::newRow("wildcard") << "shop.foo.ck" << "foo.ck";
+    QTest::newRow("exception") << "www.ck" << "ck";
+    QTest::newRow("under exception") << "a.www.ck" << "ck";
+    QTest::newRow("wildcard exception") << "city.kobe.jp" << "kobe.jp";
+    QTest::newRow("IDN") << QString::fromUtf8("example.\xe5\x85\xac\xe5\x8f\xb8") << QString::fromUtf8("\xe5\x85\xac\xe5\x8f\xb8");
+    QTest::newRow("IDN ACE") << "example.xn--55qx5d" << "xn--55qx5d";
+}
+
+QStringList TestParseDomain::domainCorpus()
+{
+    const QStringList prefixes = { "", "www.", "mail.", "login.eu.", "a1.b2.c3." };
+    const QStringList names = { "google", "themooltipass", "my-bank", "example", "shop123", "wiki" };
+    const QStringList suffixes = { "com", "org", "net", "de", "fr", "co.uk", "com.au", "blogspot.be",
+                                   "s3.amazonaws.com", "github.io", "kobe.jp", "local", "bogo" };
+
+    QStringList corpus;
+    for (int i = 0; i < 20; i++)
+        foreach (const QString &prefix, prefixes)
+            foreach (const QString &name, names)
+                foreach (const QString &suffix, suffixes)
+                    corpus << prefix + name + QString::number(i) + "." + suffix;
+    return corpus;
+}
+
+void TestParseDomain::benchmark_publicSuffixList()
+{
+    const QStringList corpus = domainCorpus();
+    int total = 0;
+    QBENCHMARK {
+        foreach (const QString &host, corpus)
+            total += PublicSuffixList::suffixLabelCount(host);
+    }
+    QVERIFY(total > 0);
+}
+
+void TestParseDomain::benchmark_qurlTopLevelDomain()
+{
+    // Previous implementation, for comparison
+    const QStringList corpus = domainCorpus();
+    int total = 0;
+    QBENCHMARK {
+        foreach (const QString &host, corpus)
+            total += QUrl::fromUserInput(host).topLevelDomain().count('.');
+    }
+    QVERIFY(total > 0);
+}
+
+void TestParseDomain::benchmark_parseDomain()
+{
+    const QStringList corpus = domainCorpus();
+    int websites = 0;
+    QBENCHMARK {
+        foreach (const QString &host, corpus)
+            websites += ParseDomain(host).isWebsite();
+    }
+    QVERIFY(websites > 0);
+}
@@ -13,6 +13,15 @@ public:
 private slots:
     void test_URLs();
     void test_URLs_data();
+    void test_publicSuffix();
+    void test_publicSuffix_data();
+
+    void benchmark_publicSuffixList();
+    void benchmark_qurlTopLevelDomain();
+    void benchmark_parseDomain();
+
+private:
+    static QStringList domainCorpus();
 };
 
 #endif // TESTPARSEDOMAIN_H
@@ -0,0 +1,45 @@
+#include <qtestcase.h>
+
+#include "TestPasswordStrengthEvaluator.h"
+#include "../src/PasswordStrengthEvaluator.h"
+
+TestPasswordStrengthEvaluator::TestPasswordStrengthEvaluator(QObject *parent) : QObject(parent)
+{
+}
+
+void TestPasswordStrengthEvaluator::test_singleRequest()
+{
+    PasswordStrengthEvaluator evaluator;
+    QList<double> results;
+    connect(&evaluator, &PasswordStrengthEvaluator::entropyReady, this, [&results](double entropy)
+    {
+        results.append(entropy);
+    });
+
+    const QByteArray password = "c0rrect-h0rse-battery";
+    evaluator.evaluate(password);
+    QTRY_COMPARE(results.size(), 1);
+    QCOMPARE(results.first(), PasswordStrengthEvaluator::computeEntropy(password));
+}
+
+void TestPasswordStrengthEvaluator::test_staleResultDropped()
+{
+    PasswordStrengthEvaluator evaluator;
+    QList<double> results;
+    connect(&evaluator, &PasswordStrengthEvaluator::entropyReady, this, [&results](double entropy)
+    {
+        results.append(entropy);
+    });
+
+    //The first request is either replaced while waiting or computed and dropped
+    const QByteArray weak = "password";
+    const QByteArray strong = "Xq7#pL2!vR9$mZ4&";
+    evaluator.evaluate(weak);
+    evaluator.evaluate(strong);
+
+    QTRY_COMPARE(results.size(), 1);
+    //Leave time for a stale result to show up
+    QTest::qWait(200);
+    QCOMPARE(results.size(), 1);
+    QCOMPARE(results.first(), PasswordStrengthEvaluator::computeEntropy(strong));
+}
@@ -0,0 +1,18 @@
+#ifndef TESTPASSWORDSTRENGTHEVALUATOR_H
+#define TESTPASSWORDSTRENGTHEVALUATOR_H
+
+#include <QtTest/QtTest>
+
+class TestPasswordStrengthEvaluator : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TestPasswordStrengthEvaluator(QObject *parent = nullptr);
+
+private slots:
+    void test_singleRequest();
+    void test_staleResultDropped();
+};
+
+#endif // TESTPASSWORDSTRENGTHEVALUATOR_H
@@ -0,0 +1,86 @@
+#include <qtestcase.h>
+
+#include "TestRequestCoalescer.h"
+#include "../src/RequestCoalescer.h"
+
+TestRequestCoalescer::TestRequestCoalescer(QObject *parent) : QObject(parent)
+{
+}
+
+void TestRequestCoalescer::test_sharedInFlight()
+{
+    RequestCoalescer<bool, QString> coalescer;
+    QStringList results;
+    const auto cb = [&results](bool success, QString value)
+    {
+        QVERIFY(success);
+        results.append(value);
+    };
+
+    QVERIFY(coalescer.join("a", cb));
+    QVERIFY(!coalescer.join("a", cb));
+    QVERIFY(coalescer.join("b", cb));
+    QVERIFY(coalescer.isPending("a"));
+
+    coalescer.finish("a", true, true, "first");
+    QCOMPARE(results, QStringList({"first", "first"}));
+    QVERIFY(!coalescer.isPending("a"));
+
+    //No TTL: next request goes to the device again
+    QVERIFY(coalescer.join("a", cb));
+}
+
+void TestRequestCoalescer::test_cachedResult()
+{
+    RequestCoalescer<bool, int> coalescer(60000);
+    int calls = 0;
+    int last = 0;
+    const auto cb = [&calls, &last](bool, int value)
+    {
+        ++calls;
+        last = value;
+    };
+
+    QVERIFY(coalescer.join("k", cb));
+    coalescer.finish("k", true, true, 42);
+    QCOMPARE(calls, 1);
+
+    QVERIFY(!coalescer.join("k", cb));
+    QCOMPARE(calls, 2);
+    QCOMPARE(last, 42);
+
+    coalescer.invalidate("k");
+    QVERIFY(coalescer.join("k", cb));
+}
+
+void TestRequestCoalescer::test_failureNotCached()
+{
+    RequestCoalescer<bool, int> coalescer(60000);
+    int calls = 0;
+    const auto cb = [&calls](bool, int) { ++calls; };
+
+    QVERIFY(coalescer.join("k", cb));
+    QVERIFY(!coalescer.join("k", cb));
+    coalescer.finish("k", false, false, 0);
+    QCOMPARE(calls, 2);
+
+    QVERIFY(coalescer.join("k", cb));
+}
+
+void TestRequestCoalescer::test_invalidateInFlight()
+{
+    RequestCoalescer<bool, int> coalescer(60000);
+    int calls = 0;
+    const auto cb = [&calls](bool, int) { ++calls; };
+
+    QVERIFY(coalescer.join("k", cb));
+    coalescer.invalidate();
+    coalescer.finish("k", true, true, 1);
+    QCOMPARE(calls, 1);
+
+    //Result arrived after invalidation, it must not be reused
+    QVERIFY(coalescer.join("k", cb));
+    coalescer.finish("k", true, true, 2);
+    QVERIFY(!coalescer.join("k", cb));
+    QCOMPARE(calls, 3);
+}
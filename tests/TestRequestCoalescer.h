@@ -0,0 +1,20 @@
+#ifndef TESTREQUESTCOALESCER_H
+#define TESTREQUESTCOALESCER_H
+
+#include <QtTest/QtTest>
+
+class TestRequestCoalescer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TestRequestCoalescer(QObject *parent = nullptr);
+
+private slots:
+    void test_sharedInFlight();
+    void test_cachedResult();
+    void test_failureNotCached();
+    void test_invalidateInFlight();
+};
+
+#endif // TESTREQUESTCOALESCER_H
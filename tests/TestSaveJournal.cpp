@@ -0,0 +1,108 @@
+#include <qtestcase.h>
+
+#include "TestSaveJournal.h"
+#include "../src/Mooltipass/MPSaveJournal.h"
+
+namespace
+{
+const QByteArray TEST_CPZ = QByteArray::fromHex("5e4a0c11d2f3b7a8");
+const quint16 TEST_CMD = 42;
+
+void recordSave(MPSaveJournal &journal)
+{
+    journal.begin(true, 10, 20, 11, 21);
+    journal.addNodeWrite(QByteArray::fromHex("0801"), QByteArray(264, 'a'));
+    journal.addNodeWrite(QByteArray::fromHex("1001"), QByteArray(264, 'b'));
+    journal.addCommand(TEST_CMD, QByteArray::fromHex("0801"));
+    journal.addNodeWrite(QByteArray::fromHex("1801"), QByteArray(264, '\xFF'));
+}
+}
+
+void TestSaveJournal::test_resumeAfterInterruption()
+{
+    MPSaveJournal journal;
+    journal.setCardCPZ(TEST_CPZ);
+    recordSave(journal);
+    QVERIFY(journal.commit());
+    journal.markDone(0);
+    journal.markDone(1);
+
+    //Another daemon instance after a disconnect
+    MPSaveJournal resumed;
+    resumed.setCardCPZ(TEST_CPZ);
+    QVERIFY(resumed.loadPending());
+    QVERIFY(resumed.isBLE());
+    QCOMPARE(resumed.credChangeBefore(), quint32(10));
+    QCOMPARE(resumed.dataChangeAfter(), quint32(21));
+    QCOMPARE(resumed.nextEntry(), 2);
+    QCOMPARE(resumed.entries().size(), 4);
+    QVERIFY(!resumed.entries()[2].isNodeWrite());
+    QCOMPARE(resumed.entries()[2].cmd, TEST_CMD);
+    QCOMPARE(resumed.entries()[3].address, QByteArray::fromHex("1801"));
+    QCOMPARE(resumed.entries()[3].data, QByteArray(264, '\xFF'));
+
+    QCOMPARE(resumed.newAttempt(), 1);
+    MPSaveJournal again;
+    again.setCardCPZ(TEST_CPZ);
+    QVERIFY(again.loadPending());
+    QCOMPARE(again.newAttempt(), 2);
+
+    again.finish();
+}
+
+void TestSaveJournal::test_finishRemovesJournal()
+{
+    MPSaveJournal journal;
+    journal.setCardCPZ(TEST_CPZ);
+    recordSave(journal);
+    QVERIFY(journal.commit());
+    for (int i = 0; i < 4; i++)
+    {
+        journal.markDone(i);
+    }
+    journal.finish();
+
+    MPSaveJournal other;
+    other.setCardCPZ(TEST_CPZ);
+    QVERIFY(!other.loadPending());
+}
+
+void TestSaveJournal::test_noJournalWithoutCommit()
+{
+    MPSaveJournal journal;
+    QCOMPARE(journal.addCommand(TEST_CMD, QByteArray()), -1);
+
+    journal.setCardCPZ(TEST_CPZ);
+    recordSave(journal);
+    journal.abort();
+    QCOMPARE(journal.addCommand(TEST_CMD, QByteArray()), -1);
+
+    MPSaveJournal other;
+    other.setCardCPZ(TEST_CPZ);
+    QVERIFY(!other.loadPending());
+
+    //A journal is only readable with the card it was made for
+    recordSave(journal);
+    QVERIFY(journal.commit());
+    MPSaveJournal otherCard;
+    otherCard.setCardCPZ(QByteArray::fromHex("0102030405060708"));
+    QVERIFY(!otherCard.loadPending());
+    journal.finish();
+}
+
+void TestSaveJournal::test_abortRemovesCommittedJournal()
+{
+    MPSaveJournal journal;
+    journal.setCardCPZ(TEST_CPZ);
+    recordSave(journal);
+    QVERIFY(journal.commit());
+    journal.markDone(0);
+
+    //Device refused the next write, the save must not be replayed
+    journal.abort();
+    QVERIFY(!journal.isActive());
+
+    MPSaveJournal other;
+    other.setCardCPZ(TEST_CPZ);
+    QVERIFY(!other.loadPending());
+}
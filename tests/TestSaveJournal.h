@@ -0,0 +1,17 @@
+#ifndef TESTSAVEJOURNAL_H
+#define TESTSAVEJOURNAL_H
+
+#include <QtTest/QtTest>
+
+class TestSaveJournal : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_resumeAfterInterruption();
+    void test_finishRemovesJournal();
+    void test_noJournalWithoutCommit();
+    void test_abortRemovesCommittedJournal();
+};
+
+#endif // TESTSAVEJOURNAL_H
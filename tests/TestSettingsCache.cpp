@@ -0,0 +1,93 @@
+#include <qtestcase.h>
+
+#include "TestSettingsCache.h"
+#include "../src/SettingsCache.h"
+
+void TestSettingsCache::test_setValue()
+{
+    QTemporaryDir dir;
+    const QString fileName = dir.filePath("settings.ini");
+
+    SettingsCache cache(fileName, QSettings::IniFormat);
+    QCOMPARE(cache.value("settings/key", 42).toInt(), 42);
+
+    QSignalSpy spy(&cache, &SettingsCache::valueChanged);
+    cache.setValue("settings/key", 1);
+    QCOMPARE(cache.value("settings/key").toInt(), 1);
+    QCOMPARE(spy.count(), 1);
+
+    //Same value, nothing to notify
+    cache.setValue("settings/key", 1);
+    QCOMPARE(spy.count(), 1);
+
+    cache.sync();
+    QSettings s(fileName, QSettings::IniFormat);
+    QCOMPARE(s.value("settings/key").toInt(), 1);
+}
+
+void TestSettingsCache::test_remove()
+{
+    QTemporaryDir dir;
+    const QString fileName = dir.filePath("settings.ini");
+    {
+        QSettings s(fileName, QSettings::IniFormat);
+        s.setValue("settings/key", "value");
+    }
+
+    SettingsCache cache(fileName, QSettings::IniFormat);
+    QVERIFY(cache.contains("settings/key"));
+
+    cache.remove("settings/key");
+    QVERIFY(!cache.contains("settings/key"));
+
+    cache.sync();
+    QSettings s(fileName, QSettings::IniFormat);
+    QVERIFY(!s.contains("settings/key"));
+}
+
+void TestSettingsCache::test_externalChange()
+{
+    QTemporaryDir dir;
+    const QString fileName = dir.filePath("settings.ini");
+    {
+        QSettings s(fileName, QSettings::IniFormat);
+        s.setValue("settings/external", false);
+    }
+
+    SettingsCache cache(fileName, QSettings::IniFormat);
+    QCOMPARE(cache.value("settings/external").toBool(), false);
+
+    QSignalSpy spy(&cache, &SettingsCache::valueChanged);
+    {
+        QSettings s(fileName, QSettings::IniFormat);
+        s.setValue("settings/external", true);
+    }
+
+    QTRY_COMPARE(cache.value("settings/external").toBool(), true);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toString(), QString("settings/external"));
+}
+
+void TestSettingsCache::test_reloadKeepsTypes()
+{
+    QTemporaryDir dir;
+    const QString fileName = dir.filePath("settings.ini");
+
+    SettingsCache cache(fileName, QSettings::IniFormat);
+    cache.setValue("settings/number", 5);
+    cache.setValue("settings/enabled", true);
+    cache.sync();
+
+    QSignalSpy spy(&cache, &SettingsCache::valueChanged);
+    {
+        QSettings s(fileName, QSettings::IniFormat);
+        s.setValue("settings/other", "value");
+    }
+
+    //Values read back as strings are not reported as changed
+    QTRY_VERIFY(cache.contains("settings/other"));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toString(), QString("settings/other"));
+    QCOMPARE(cache.value("settings/number").userType(), static_cast<int>(QMetaType::Int));
+    QCOMPARE(cache.value("settings/enabled").toBool(), true);
+}
@@ -0,0 +1,17 @@
+#ifndef TESTSETTINGSCACHE_H
+#define TESTSETTINGSCACHE_H
+
+#include <QtTest/QtTest>
+
+class TestSettingsCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void test_setValue();
+    void test_remove();
+    void test_externalChange();
+    void test_reloadKeepsTypes();
+};
+
+#endif // TESTSETTINGSCACHE_H
@@ -1,6 +1,8 @@
 #include "TestTreeItem.h"
 #include "../src/TreeItem.h"
-
+#include "../src/RootItem.h"
+#include "../src/ServiceItem.h"
+#include "../src/LoginItem.h"
 
 
 TestTreeItem::TestTreeItem(QObject *parent) : QObject(parent)
@@ -82,3 +84,36 @@ void TestTreeItem::removeChild()
     delete k;
     delete b;
 }
+
+void TestTreeItem::findByName()
+{
+    RootItem *root = new RootItem();
+    ServiceItem *s1 = root->addService("service.io");
+    ServiceItem *s2 = root->addService("other.io");
+    LoginItem *l1 = s1->addLogin("loginA");
+
+    Q_ASSERT(root->findServiceByName("Service.IO") == s1);
+    Q_ASSERT(root->findServiceByName("other.io") == s2);
+    Q_ASSERT(s1->findLoginByName("loginA") == l1);
+    Q_ASSERT(s1->findLoginByName("logina") == nullptr);
+
+    // Renamed items are found under their new name only
+    s2->setName("renamed.io");
+    l1->setName("loginB");
+    Q_ASSERT(root->findServiceByName("other.io") == nullptr);
+    Q_ASSERT(root->findServiceByName("renamed.io") == s2);
+    Q_ASSERT(s1->findLoginByName("loginA") == nullptr);
+    Q_ASSERT(s1->findLoginByName("loginB") == l1);
+
+    // First item wins on duplicates, the next one takes over on removal
+    ServiceItem *s3 = root->addService("SERVICE.io");
+    Q_ASSERT(root->findServiceByName("service.io") == s1);
+    root->removeOne(s1);
+    delete s1;
+    Q_ASSERT(root->findServiceByName("service.io") == s3);
+
+    root->clear();
+    Q_ASSERT(root->findServiceByName("renamed.io") == nullptr);
+
+    delete root;
+}
@@ -8,6 +8,14 @@
 #include "TestCredentialModelFilter.h"
 #include "TestDbExportsRegistry.h"
 #include "TestParseDomain.h"
+#include "TestRequestCoalescer.h"
+#include "TestCsvImporter.h"
+#include "TestHibpOfflineIndex.h"
+#include "TestSettingsCache.h"
+#include "TestFlashPlacement.h"
+#include "TestSaveJournal.h"
+#include "TestNodeGraphChecker.h"
+#include "TestPasswordStrengthEvaluator.h"
 
 // Note: This is equivalent to QTEST_APPLESS_MAIN for multiple test classes.
 int main(int argc, char** argv)
@@ -50,6 +58,46 @@ int main(int argc, char** argv)
         runTest(&testParseDomain);
     }
 
+    {
+        TestRequestCoalescer testRequestCoalescer;
+        runTest(&testRequestCoalescer);
+    }
+
+    {
+        TestCsvImporter testCsvImporter;
+        runTest(&testCsvImporter);
+    }
+
+    {
+        TestHibpOfflineIndex testHibpOfflineIndex;
+        runTest(&testHibpOfflineIndex);
+    }
+
+    {
+        TestSettingsCache testSettingsCache;
+        runTest(&testSettingsCache);
+    }
+
+    {
+        TestFlashPlacement testFlashPlacement;
+        runTest(&testFlashPlacement);
+    }
+
+    {
+        TestSaveJournal testSaveJournal;
+        runTest(&testSaveJournal);
+    }
+
+    {
+        TestNodeGraphChecker testNodeGraphChecker;
+        runTest(&testNodeGraphChecker);
+    }
+
+    {
+        TestPasswordStrengthEvaluator testPasswordStrengthEvaluator;
+        runTest(&testPasswordStrengthEvaluator);
+    }
+
     return status;
 }
 
@@ -28,6 +28,7 @@ DEFINES += QT_DEPRECATED_WARNINGS
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
 include (../src/QSimpleUpdater/QSimpleUpdater.pri)
+include (../src/qtcsv/qtcsv.pri)
 
 SOURCES += \
     ../src/SimpleCrypt/SimpleCrypt.cpp \
@@ -39,10 +40,20 @@ SOURCES += \
     ../src/ServiceItem.cpp \
     ../src/CredentialModel.cpp \
     ../src/CredentialModelFilter.cpp \
+    ../src/CredentialSearchIndex.cpp \
     ../src/DbExportsRegistry.cpp \
     ../src/DbBackupChangeNumbersComparator.cpp \
     ../src/ParseDomain.cpp \
+    ../src/PublicSuffixList.cpp \
     ../src/DeviceDetector.cpp \
+    ../src/CsvImporter.cpp \
+    ../src/HibpOfflineIndex.cpp \
+    ../src/SettingsCache.cpp \
+    ../src/Mooltipass/MPFlashPlacement.cpp \
+    ../src/Mooltipass/MPSaveJournal.cpp \
+    ../src/Mooltipass/MPNodeGraphChecker.cpp \
+    ../src/PasswordStrengthEvaluator.cpp \
+    ../src/zxcvbn-c/zxcvbn.c \
     main.cpp \
     FilesCacheTests.cpp \
     UpdaterTests.cpp \
@@ -51,7 +62,15 @@ SOURCES += \
     TestCredentialModel.cpp \
     TestCredentialModelFilter.cpp \
     TestDbExportsRegistry.cpp \
-    TestParseDomain.cpp
+    TestParseDomain.cpp \
+    TestRequestCoalescer.cpp \
+    TestCsvImporter.cpp \
+    TestHibpOfflineIndex.cpp \
+    TestSettingsCache.cpp \
+    TestFlashPlacement.cpp \
+    TestSaveJournal.cpp \
+    TestNodeGraphChecker.cpp \
+    TestPasswordStrengthEvaluator.cpp
 
 HEADERS += \
     ../src/SimpleCrypt/SimpleCrypt.h \
@@ -63,10 +82,22 @@ HEADERS += \
     ../src/ServiceItem.h \
     ../src/CredentialModel.h \
     ../src/CredentialModelFilter.h \
+    ../src/CredentialSearchIndex.h \
     ../src/DbExportsRegistry.h \
     ../src/DbBackupChangeNumbersComparator.h \
     ../src/ParseDomain.h \
+    ../src/PublicSuffixList.h \
+    ../src/publicsuffix/psl-data.h \
     ../src/DeviceDetector.h \
+    ../src/RequestCoalescer.h \
+    ../src/CsvImporter.h \
+    ../src/HibpOfflineIndex.h \
+    ../src/SettingsCache.h \
+    ../src/Mooltipass/MPFlashPlacement.h \
+    ../src/Mooltipass/MPSaveJournal.h \
+    ../src/Mooltipass/MPNodeGraphChecker.h \
+    ../src/PasswordStrengthEvaluator.h \
+    ../src/zxcvbn-c/zxcvbn.h \
     UpdaterTests.h \
     FilesCacheTests.h \
     DbBackupsTrackerTests.h \
@@ -74,6 +105,16 @@ HEADERS += \
     TestCredentialModel.h \
     TestCredentialModelFilter.h \
     TestDbExportsRegistry.h \
-    TestParseDomain.h
+    TestParseDomain.h \
+    TestRequestCoalescer.h \
+    TestCsvImporter.h \
+    TestHibpOfflineIndex.h \
+    TestSettingsCache.h \
+    TestFlashPlacement.h \
+    TestSaveJournal.h \
+    TestNodeGraphChecker.h \
+    TestPasswordStrengthEvaluator.h
+
+INCLUDEPATH += ../src/zxcvbn-c
 
 DEFINES += SRCDIR=\\\"$$PWD/\\\"